@@ -288,6 +288,25 @@ public:
      */
     bool int64_base_atomics_supported() const;
 
+    /** Sets the directory where program binaries are cached on disk
+     *
+     * When a directory is set, programs which are not in the runtime cache are looked up on disk
+     * before being compiled from source, and freshly compiled programs are stored back. The cache
+     * entries are keyed on the device name, the driver version and the program build options, so
+     * entries written by a previous driver are simply never hit again.
+     *
+     * @note The directory must exist, it is not created.
+     *
+     * @param[in] path Directory to cache program binaries in. An empty string disables the cache.
+     */
+    void set_binary_cache_path(std::string path);
+
+    /** Return the directory where program binaries are cached on disk
+     *
+     * @return The binary cache directory, empty if the cache is disabled
+     */
+    const std::string &binary_cache_path() const;
+
 private:
     /** Load program and its dependencies.
      *
@@ -315,8 +334,33 @@ private:
      */
     std::string stringify_set(const StringSet &s, const std::string &kernel_path) const;
 
+    /** Return the path of the on-disk cache entry of a built program
+     *
+     * @param[in] built_program_name Name of the built program, including its build options
+     *
+     * @return The filename of the cache entry, keyed on device name, driver version and @p built_program_name
+     */
+    std::string binary_cache_filename(const std::string &built_program_name) const;
+
+    /** Try to create a program from a binary cached on disk
+     *
+     * @param[in]  cache_filename Path of the cache entry to load
+     * @param[out] program        Built program on success
+     *
+     * @return True if the binary was found and built successfully
+     */
+    bool load_binary_from_cache(const std::string &cache_filename, cl::Program &program) const;
+
+    /** Store the binary of a built program in the on-disk cache
+     *
+     * @param[in] cache_filename Path of the cache entry to write
+     * @param[in] program        Built program to store
+     */
+    void save_binary_to_cache(const std::string &cache_filename, const cl::Program &program) const;
+
     cl::Context _context;                                             /**< Underlying CL context. */
     CLDevice    _device;                                              /**< Underlying CL device. */
+    std::string _binary_cache_path;                                   /**< Directory of the on-disk program binary cache. Empty if disabled. */
     mutable std::map<std::string, const Program> _programs_map;       /**< Map with all already loaded program data. */
     mutable std::map<std::string, cl::Program>   _built_programs_map; /**< Map with all already built program data. */
 };
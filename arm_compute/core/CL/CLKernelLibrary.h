@@ -99,6 +99,22 @@ public:
      * @return The content of CL_DEVICE_MAX_COMPUTE_UNITS
      */
     cl_uint get_num_compute_units();
+    /** Sets the directory where program binaries are cached on disk
+     *
+     * Programs which are not in the runtime cache are looked up on disk before being compiled from
+     * source, and freshly compiled programs are stored back. The cache entries are keyed on the
+     * device name, the driver version and the program build options.
+     *
+     * @note The directory must exist, it is not created.
+     *
+     * @param[in] path Directory to cache program binaries in. An empty string disables the cache.
+     */
+    void set_binary_cache_path(std::string path);
+    /** Return the directory where program binaries are cached on disk
+     *
+     * @return The binary cache directory, empty if the cache is disabled
+     */
+    const std::string &binary_cache_path();
     /** Creates a kernel from the kernel library.
      *
      * @param[in] kernel_name       Kernel name.
@@ -31,7 +31,10 @@
 #include "arm_compute/core/IKernel.h"
 #include "arm_compute/core/experimental/Types.h"
 
+#include <cstdint>
 #include <string>
+#include <type_traits>
+#include <vector>
 
 namespace arm_compute
 {
@@ -72,13 +75,14 @@ protected:
     void configure_internal(const Window &window, cl::NDRange lws_hint = CLKernelLibrary::get().default_ndrange())
     {
         _lws_hint = lws_hint;
+        _cached_args.clear();
         IKernel::configure(window);
     }
 
 public:
     /** Constructor */
     ICLKernel()
-        : _kernel(nullptr), _target(GPUTarget::MIDGARD), _config_id(arm_compute::default_config_id), _max_workgroup_size(0), _lws_hint()
+        : _kernel(nullptr), _target(GPUTarget::MIDGARD), _config_id(arm_compute::default_config_id), _max_workgroup_size(0), _lws_hint(), _cached_args()
     {
     }
     /** Returns a reference to the OpenCL kernel of this object.
@@ -241,7 +245,7 @@ public:
     template <typename T>
     void add_argument(unsigned int &idx, T value)
     {
-        _kernel.setArg(idx++, value);
+        set_argument(idx++, value);
     }
 
     /** Set the Local-Workgroup-Size hint
@@ -336,6 +340,35 @@ private:
      */
     template <unsigned int dimension_size>
     void add_tensor_argument(unsigned int &idx, const ICLTensor *tensor, const Window &window);
+    /** Set a kernel argument, skipping the driver call when the value is unchanged since the last run
+     *
+     * The per-argument cache is dropped by @ref configure_internal.
+     *
+     * @param[in] index Index of the argument to set.
+     * @param[in] size  Size of the argument value in bytes.
+     * @param[in] value Pointer to the argument value.
+     */
+    void set_arg_cached(unsigned int index, size_t size, const void *value);
+    /** Set a kernel argument through the cache (trivially copyable values only)
+     *
+     * @param[in] index Index of the argument to set.
+     * @param[in] value Value to set as an argument of the object's kernel.
+     */
+    template <typename T>
+    typename std::enable_if<std::is_trivially_copyable<T>::value, void>::type set_argument(unsigned int index, const T &value)
+    {
+        set_arg_cached(index, sizeof(T), &value);
+    }
+    /** Set a kernel argument bypassing the cache (wrapper objects with non-trivial copies)
+     *
+     * @param[in] index Index of the argument to set.
+     * @param[in] value Value to set as an argument of the object's kernel.
+     */
+    template <typename T>
+    typename std::enable_if<!std::is_trivially_copyable<T>::value, void>::type set_argument(unsigned int index, const T &value)
+    {
+        _kernel.setArg(index, value);
+    }
 
 protected:
     cl::Kernel  _kernel;             /**< OpenCL kernel to run */
@@ -343,7 +376,8 @@ protected:
     std::string _config_id;          /**< Configuration ID */
     size_t      _max_workgroup_size; /**< The maximum workgroup size for this kernel */
 private:
-    cl::NDRange _lws_hint; /**< Local workgroup size hint for the OpenCL kernel */
+    cl::NDRange                       _lws_hint;    /**< Local workgroup size hint for the OpenCL kernel */
+    std::vector<std::vector<uint8_t>> _cached_args; /**< Last value set for each kernel argument */
 };
 
 /** Add the kernel to the command queue with the given window.
@@ -385,15 +419,16 @@ void ICLKernel::add_array_argument(unsigned &idx, const ICLArray<T> *array, cons
     }
 
     unsigned int idx_start = idx;
-    _kernel.setArg(idx++, array->cl_buffer());
+    const cl_mem buffer    = array->cl_buffer().get();
+    set_argument(idx++, buffer);
 
     for(unsigned int dimension = 0; dimension < dimension_size; dimension++)
     {
-        _kernel.setArg<cl_uint>(idx++, strides[dimension]);
-        _kernel.setArg<cl_uint>(idx++, strides[dimension] * window[dimension].step());
+        set_argument<cl_uint>(idx++, strides[dimension]);
+        set_argument<cl_uint>(idx++, strides[dimension] * window[dimension].step());
     }
 
-    _kernel.setArg<cl_uint>(idx++, offset_first_element);
+    set_argument<cl_uint>(idx++, offset_first_element);
 
     ARM_COMPUTE_ERROR_ON_MSG_VAR(idx_start + num_arguments_per_array<dimension_size>() != idx,
                                  "add_%dD_array_argument() is supposed to add exactly %d arguments to the kernel", dimension_size, num_arguments_per_array<dimension_size>());
@@ -34,6 +34,7 @@ namespace cl
 {
 class Buffer;
 class CommandQueue;
+class Event;
 }
 
 namespace arm_compute
@@ -83,6 +84,24 @@ public:
      * @param[in,out] q The CL command queue to use for the mapping operation.
      */
     void unmap(cl::CommandQueue &q);
+    /** Enqueue a non-blocking map operation of the allocated buffer on the given queue and return an event for it.
+     *
+     * @note The mapping pointer returned by @ref ITensor::buffer() must not be accessed before the returned event has completed.
+     *
+     * @param[in,out] q The CL command queue to use for the mapping operation.
+     *
+     * @return An event that completes once the mapping is ready to use.
+     */
+    cl::Event map_async(cl::CommandQueue &q);
+    /** Enqueue an unmap operation of the allocated and mapped buffer on the given queue and return an event for it.
+     *
+     * @note The memory must not be accessed by the device before the returned event has completed.
+     *
+     * @param[in,out] q The CL command queue to use for the unmapping operation.
+     *
+     * @return An event that completes once the unmap (and any resulting transfer back to the device) has finished.
+     */
+    cl::Event unmap_async(cl::CommandQueue &q);
     /** Clear the contents of the tensor synchronously.
      *
      * @param[in,out] q The CL command queue to use for the clear operation.
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_CLELEMENTWISECHAINKERNEL_H
+#define ARM_COMPUTE_CLELEMENTWISECHAINKERNEL_H
+
+#include "arm_compute/core/CL/ICLKernel.h"
+#include "arm_compute/core/Types.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+class ICLTensor;
+
+/** Elementwise operations that can be fused in a chain */
+enum class ElementwiseChainOp
+{
+    ADD, /**< acc + x */
+    SUB, /**< acc - x */
+    MUL, /**< acc * x */
+    MIN, /**< fmin(acc, x) */
+    MAX  /**< fmax(acc, x) */
+};
+
+/** Kernel performing a chain of elementwise operations in a single pass.
+ *
+ * The OpenCL source of the kernel is generated at configure time from the requested chain, so the
+ * intermediate results stay in registers instead of making a global-memory round trip per operation.
+ * The chain starts from the first input and folds in one input per operation:
+ *
+ *     acc = op_n(... op_1(op_0(input_0, input_1), input_2) ..., input_n+1)
+ *
+ * with an optional activation applied to the final result.
+ */
+class CLElementwiseChainKernel : public ICLKernel
+{
+public:
+    /** Default constructor */
+    CLElementwiseChainKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLElementwiseChainKernel(const CLElementwiseChainKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLElementwiseChainKernel &operator=(const CLElementwiseChainKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    CLElementwiseChainKernel(CLElementwiseChainKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    CLElementwiseChainKernel &operator=(CLElementwiseChainKernel &&) = default;
+    /** Default destructor */
+    ~CLElementwiseChainKernel() = default;
+    /** Set the inputs and output of the kernel
+     *
+     * @param[in]  inputs   Input tensors. All tensors must have the same shape and data type. Data types supported: F16/F32.
+     * @param[out] output   Output tensor. Data type supported: same as @p inputs
+     * @param[in]  ops      Chain of operations to perform, one less than the number of inputs
+     * @param[in]  act_info (Optional) Activation to apply to the result of the chain. Only RELU, LOGISTIC and TANH are supported.
+     */
+    void configure(const std::vector<const ICLTensor *> &inputs, ICLTensor *output, const std::vector<ElementwiseChainOp> &ops, const ActivationLayerInfo &act_info = ActivationLayerInfo());
+    /** Static function to check if given info will lead to a valid configuration of @ref CLElementwiseChainKernel
+     *
+     * @param[in] inputs   Input tensor infos. All tensors must have the same shape and data type. Data types supported: F16/F32.
+     * @param[in] output   Output tensor info. Data type supported: same as @p inputs
+     * @param[in] ops      Chain of operations to perform, one less than the number of inputs
+     * @param[in] act_info (Optional) Activation to apply to the result of the chain. Only RELU, LOGISTIC and TANH are supported.
+     *
+     * @return a status
+     */
+    static Status validate(const std::vector<const ITensorInfo *> &inputs, const ITensorInfo *output, const std::vector<ElementwiseChainOp> &ops,
+                           const ActivationLayerInfo &act_info = ActivationLayerInfo());
+
+    // Inherited methods overridden:
+    void run(const Window &window, cl::CommandQueue &queue) override;
+
+private:
+    std::vector<const ICLTensor *> _inputs;
+    ICLTensor                     *_output;
+};
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_CLELEMENTWISECHAINKERNEL_H */
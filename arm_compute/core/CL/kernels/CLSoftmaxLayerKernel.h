@@ -154,5 +154,70 @@ private:
     const ICLTensor *_sum;
     ICLTensor       *_output;
 };
+/** Interface for computing a full softmax row in a single launch.
+ *
+ * One work-group co-operates on a whole row: max, shift/exp/sum and normalization are
+ * performed back to back with local-memory reductions, so no intermediate global tensors
+ * and no additional kernel launches are needed.
+ */
+class CLLogits1DFusedSoftmaxKernel : public ICLKernel
+{
+public:
+    /** Default constructor */
+    CLLogits1DFusedSoftmaxKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLLogits1DFusedSoftmaxKernel(const CLLogits1DFusedSoftmaxKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLLogits1DFusedSoftmaxKernel &operator=(const CLLogits1DFusedSoftmaxKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    CLLogits1DFusedSoftmaxKernel(CLLogits1DFusedSoftmaxKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    CLLogits1DFusedSoftmaxKernel &operator=(CLLogits1DFusedSoftmaxKernel &&) = default;
+    /** Set the input and output tensors.
+     *
+     * @param[in]  input  Source tensor. Data types supported: F16/F32
+     * @param[out] output Destination tensor. Data types supported: same as @p input
+     * @param[in]  info   Contains information consumed by kernels for softmax described in @ref SoftmaxKernelInfo.
+     */
+    void configure(const ICLTensor *input, ICLTensor *output, const SoftmaxKernelInfo &info);
+    /** Set the input and output tensors.
+     *
+     * @param[in]  compile_context The compile context to be used.
+     * @param[in]  input           Source tensor. Data types supported: F16/F32
+     * @param[out] output          Destination tensor. Data types supported: same as @p input
+     * @param[in]  info            Contains information consumed by kernels for softmax described in @ref SoftmaxKernelInfo.
+     */
+    void configure(const CLCompileContext &compile_context, const ICLTensor *input, ICLTensor *output, const SoftmaxKernelInfo &info);
+    /** Static function to check if given info will lead to a valid configuration of @ref CLLogits1DFusedSoftmaxKernel
+     *
+     * @param[in] input  Source tensor. Data types supported: F16/F32
+     * @param[in] output Destination tensor. Data types supported: same as @p input
+     * @param[in] info   Contains information consumed by kernels for softmax described in @ref SoftmaxKernelInfo.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *output, const SoftmaxKernelInfo &info);
+    /** Checks if the given configuration is eligible for the single-launch fused kernel
+     *
+     * @note Rows wider than the fused width cap fall back to the staged kernels, where the
+     *       multi-work-group parallel reduction is more efficient.
+     *
+     * @param[in] input Source tensor info to check
+     * @param[in] info  Contains information consumed by kernels for softmax described in @ref SoftmaxKernelInfo.
+     *
+     * @return True if the fused kernel can be used for the given configuration
+     */
+    static bool is_fused_supported(const ITensorInfo *input, const SoftmaxKernelInfo &info);
+
+    // Inherited methods overridden:
+    void run(const Window &window, cl::CommandQueue &queue) override;
+
+private:
+    const ICLTensor *_input;
+    ICLTensor       *_output;
+
+private:
+    static const unsigned int _max_fused_width;
+};
 } // namespace arm_compute
 #endif /*ARM_COMPUTE_CLSOFTMAXLAYERKERNEL_H */
@@ -136,6 +136,31 @@ public:
      * @return true of the cpu supports dot product, false otherwise
      */
     bool has_dotprod() const;
+    /** Checks if the cpu model supports the Scalable Vector Extension.
+     *
+     * @return true of the cpu supports sve, false otherwise
+     */
+    bool has_sve() const;
+    /** Checks if the cpu model supports the Scalable Vector Extension 2.
+     *
+     * @return true of the cpu supports sve2, false otherwise
+     */
+    bool has_sve2() const;
+    /** Checks if the cpu model supports the int8 matrix multiply instructions.
+     *
+     * @return true of the cpu supports i8mm, false otherwise
+     */
+    bool has_i8mm() const;
+    /** Checks if the cpu model supports the bfloat16 instructions.
+     *
+     * @return true of the cpu supports bf16, false otherwise
+     */
+    bool has_bf16() const;
+    /** Checks if the cpu model supports the fp16 multiply-accumulate to fp32 instructions.
+     *
+     * @return true of the cpu supports fhm, false otherwise
+     */
+    bool has_fhm() const;
     /** Gets the cpu model for a given cpuid.
      *
      * @param[in] cpuid the id of the cpu core to be retrieved,
@@ -178,6 +203,31 @@ public:
      * @param[in] dotprod whether the cpu supports dot product.
      */
     void set_dotprod(const bool dotprod);
+    /** Set sve support
+     *
+     * @param[in] sve whether the cpu supports the Scalable Vector Extension.
+     */
+    void set_sve(const bool sve);
+    /** Set sve2 support
+     *
+     * @param[in] sve2 whether the cpu supports the Scalable Vector Extension 2.
+     */
+    void set_sve2(const bool sve2);
+    /** Set i8mm support
+     *
+     * @param[in] i8mm whether the cpu supports the int8 matrix multiply instructions.
+     */
+    void set_i8mm(const bool i8mm);
+    /** Set bf16 support
+     *
+     * @param[in] bf16 whether the cpu supports the bfloat16 instructions.
+     */
+    void set_bf16(const bool bf16);
+    /** Set fhm support
+     *
+     * @param[in] fhm whether the cpu supports the fp16 multiply-accumulate to fp32 instructions.
+     */
+    void set_fhm(const bool fhm);
     /** Set the cpumodel for a given cpu core
      *
      * @param[in] cpuid the id of the core to be set.
@@ -200,6 +250,11 @@ private:
     std::vector<CPUModel> _percpu        = {};
     bool                  _fp16          = false;
     bool                  _dotprod       = false;
+    bool                  _sve           = false;
+    bool                  _sve2          = false;
+    bool                  _i8mm          = false;
+    bool                  _bf16          = false;
+    bool                  _fhm           = false;
     unsigned int          _L1_cache_size = 32768;
     unsigned int          _L2_cache_size = 262144;
 };
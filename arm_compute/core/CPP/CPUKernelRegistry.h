@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_CPUKERNELREGISTRY_H
+#define ARM_COMPUTE_CPUKERNELREGISTRY_H
+
+#include "arm_compute/core/CPP/CPPTypes.h"
+#include "arm_compute/core/Helpers.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace arm_compute
+{
+/** Architecture features a kernel implementation can declare as required.
+ *
+ * The values form a bitmask so that an implementation can require several
+ * features at once (e.g. CPUFeature::SVE2 | CPUFeature::I8MM). All of them
+ * are detected at runtime via HWCAPs in get_cpu_configuration() and exposed
+ * through @ref CPUInfo.
+ */
+enum class CPUFeature : uint32_t
+{
+    NONE    = 0,      /**< No feature required, runs on any supported CPU */
+    FP16    = 1 << 0, /**< Half-precision vector arithmetic */
+    DOTPROD = 1 << 1, /**< Int8 dot product instructions */
+    SVE     = 1 << 2, /**< Scalable Vector Extension */
+    SVE2    = 1 << 3, /**< Scalable Vector Extension 2 */
+    I8MM    = 1 << 4, /**< Int8 matrix multiply instructions */
+    BF16    = 1 << 5, /**< Bfloat16 instructions */
+    FHM     = 1 << 6  /**< Fp16 multiply-accumulate to fp32 instructions */
+};
+
+/** Enable bitwise operations on CPUFeature enumerations */
+template <>
+struct enable_bitwise_ops<arm_compute::CPUFeature>
+{
+    static constexpr bool value = true; /**< Enabled. */
+};
+
+/** Checks if the CPU described by @p cpuinfo provides all the requested features.
+ *
+ * @param[in] cpuinfo  CPU information to check against.
+ * @param[in] features Bitmask of required @ref CPUFeature.
+ *
+ * @return True if every requested feature is available, false otherwise.
+ */
+inline bool cpu_supports_features(const CPUInfo &cpuinfo, CPUFeature features)
+{
+    if(((features & CPUFeature::FP16) != CPUFeature::NONE) && !cpuinfo.has_fp16())
+    {
+        return false;
+    }
+    if(((features & CPUFeature::DOTPROD) != CPUFeature::NONE) && !cpuinfo.has_dotprod())
+    {
+        return false;
+    }
+    if(((features & CPUFeature::SVE) != CPUFeature::NONE) && !cpuinfo.has_sve())
+    {
+        return false;
+    }
+    if(((features & CPUFeature::SVE2) != CPUFeature::NONE) && !cpuinfo.has_sve2())
+    {
+        return false;
+    }
+    if(((features & CPUFeature::I8MM) != CPUFeature::NONE) && !cpuinfo.has_i8mm())
+    {
+        return false;
+    }
+    if(((features & CPUFeature::BF16) != CPUFeature::NONE) && !cpuinfo.has_bf16())
+    {
+        return false;
+    }
+    if(((features & CPUFeature::FHM) != CPUFeature::NONE) && !cpuinfo.has_fhm())
+    {
+        return false;
+    }
+    return true;
+}
+
+/** One candidate implementation in a @ref select_cpu_kernel() list.
+ *
+ * @tparam KernelType Function type of the kernel entry point (not a pointer).
+ */
+template <typename KernelType>
+struct CPUKernelImplementation
+{
+    const char *name;              /**< Implementation name, for logging and tests */
+    CPUFeature  required_features; /**< Features the implementation needs to run */
+    KernelType *kernel;            /**< Kernel entry point, nullptr to disable the entry */
+};
+
+/** Selects the best kernel implementation for the CPU the library is running on.
+ *
+ * Candidates are tried in declaration order and the first entry whose required
+ * features are all available wins, so lists must be ordered from the most to the
+ * least specialised implementation and end with a CPUFeature::NONE fallback.
+ * This mirrors the priority-by-ordering scheme of the assembly GEMM selection
+ * lists, but keyed purely on architecture features: supporting new silicon means
+ * adding one entry at the top of the relevant list rather than editing every
+ * selection site.
+ *
+ * @param[in] implementations Candidate list, ordered by decreasing priority.
+ * @param[in] cpuinfo         CPU information of the machine the kernel will run on.
+ *
+ * @return The highest-priority runnable kernel, nullptr if no candidate is runnable.
+ */
+template <typename KernelType, std::size_t N>
+KernelType *select_cpu_kernel(const std::array<CPUKernelImplementation<KernelType>, N> &implementations, const CPUInfo &cpuinfo)
+{
+    for(const auto &impl : implementations)
+    {
+        if(impl.kernel != nullptr && cpu_supports_features(cpuinfo, impl.required_features))
+        {
+            return impl.kernel;
+        }
+    }
+    return nullptr;
+}
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_CPUKERNELREGISTRY_H */
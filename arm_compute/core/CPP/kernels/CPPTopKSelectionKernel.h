@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_CPPTOPKSELECTIONKERNEL_H
+#define ARM_COMPUTE_CPPTOPKSELECTIONKERNEL_H
+
+#include "arm_compute/core/CPP/ICPPKernel.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** CPP kernel to select the top K scores and their class indices per batch row.
+ *
+ * Each row of the scores tensor is reduced independently with a bounded min-heap,
+ * so rows are distributed across threads without any cross-thread merge step.
+ */
+class CPPTopKSelectionKernel : public ICPPKernel
+{
+public:
+    const char *name() const override
+    {
+        return "CPPTopKSelectionKernel";
+    }
+    /** Default constructor */
+    CPPTopKSelectionKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CPPTopKSelectionKernel(const CPPTopKSelectionKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CPPTopKSelectionKernel &operator=(const CPPTopKSelectionKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    CPPTopKSelectionKernel(CPPTopKSelectionKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    CPPTopKSelectionKernel &operator=(CPPTopKSelectionKernel &&) = default;
+    /** Default destructor */
+    ~CPPTopKSelectionKernel() = default;
+
+    /** Set the input and outputs of the kernel.
+     *
+     * @param[in]  scores  A classes x batch_size tensor of scores. Data types supported: F16/S32/F32/QASYMM8/QASYMM8_SIGNED
+     * @param[out] values  Top @p k scores of each row, sorted in descending order. A k x batch_size tensor. Data types supported: same as @p scores
+     * @param[out] indices Class indices of the top @p k scores of each row. A k x batch_size tensor. Data types supported: U32
+     * @param[in]  k       Number of elements to select per row. Must not exceed the number of classes.
+     */
+    void configure(const ITensor *scores, ITensor *values, ITensor *indices, const unsigned int k);
+
+    /** Static function to check if given info will lead to a valid configuration of @ref CPPTopKSelectionKernel
+     *
+     * @param[in] scores  A classes x batch_size tensor info of scores. Data types supported: F16/S32/F32/QASYMM8/QASYMM8_SIGNED
+     * @param[in] values  Top @p k scores of each row, sorted in descending order. A k x batch_size tensor info. Data types supported: same as @p scores
+     * @param[in] indices Class indices of the top @p k scores of each row. A k x batch_size tensor info. Data types supported: U32
+     * @param[in] k       Number of elements to select per row. Must not exceed the number of classes.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *scores, const ITensorInfo *values, const ITensorInfo *indices, const unsigned int k);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+    bool is_parallelisable() const override;
+
+private:
+    /** Template function to run the top K selection for a range of rows. */
+    template <typename T>
+    void run_topk(const Window &window);
+
+    const ITensor *_scores;
+    ITensor       *_values;
+    ITensor       *_indices;
+
+    unsigned int _k;
+    unsigned int _num_classes;
+};
+} // namespace arm_compute
+#endif /*ARM_COMPUTE_CPPTOPKSELECTIONKERNEL_H */
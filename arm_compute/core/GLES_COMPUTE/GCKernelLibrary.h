@@ -228,10 +228,21 @@ public:
      * @return The created kernel.
      */
     GCKernel create_kernel(const std::string &shader_name, const StringSet &build_options_set = {}) const;
-    /** Serializes and saves programs to a binary. */
-    void save_binary();
-    /** Load serialized binary with all the programs. */
-    void load_binary();
+    /** Sets the directory where program binaries are cached on disk
+     *
+     * Programs which are not in the runtime cache are looked up on disk before being compiled from
+     * source, and freshly linked programs are stored back through glGetProgramBinary. The cache
+     * entries are keyed on the renderer and the driver version, so entries written by a different
+     * driver are simply never hit, and stale or corrupted entries fall back to compiling from source.
+     *
+     * @param[in] path Directory to cache program binaries in. An empty string disables the cache.
+     */
+    void set_binary_cache_path(std::string path);
+    /** Return the directory where program binaries are cached on disk
+     *
+     * @return The binary cache directory, empty if the cache is disabled
+     */
+    const std::string &binary_cache_path() const;
     /** Setup a dummy fbo to workaround an issue on Galaxy S8. */
     void setup_dummy_fbo();
 
@@ -255,12 +266,34 @@ private:
      * @return Concatenated string.
      */
     std::string stringify_set(const StringSet &s) const;
+    /** Return the cache filename of a built program
+     *
+     * @param[in] built_program_name Name of the built program, including its build options.
+     *
+     * @return Path of the cache entry inside the binary cache directory.
+     */
+    std::string binary_cache_filename(const std::string &built_program_name) const;
+    /** Try to load a program binary from the disk cache
+     *
+     * @param[in]  cache_filename Path of the cache entry.
+     * @param[out] gles_program   Id of the linked program on success.
+     *
+     * @return True if the program was loaded and linked from the cache.
+     */
+    bool load_binary_from_cache(const std::string &cache_filename, GLuint &gles_program) const;
+    /** Store the binary of a linked program in the disk cache
+     *
+     * @param[in] cache_filename Path of the cache entry.
+     * @param[in] gles_program   Id of the linked program.
+     */
+    void save_binary_to_cache(const std::string &cache_filename, GLuint gles_program) const;
 
     EGLDisplay  _display;                                                /**< Underlying EGL Display. */
     EGLContext  _context;                                                /**< Underlying EGL Context. */
     GLuint      _frame_buffer;                                           /**< Dummy fbo */
     GLuint      _tex_rt;                                                 /**< Dummy texture for render target */
     std::string _shader_path;                                            /**< Path to the shaders folder. */
+    std::string _binary_cache_path;                                      /**< Path to the program binary cache folder, empty if the cache is disabled. */
     mutable std::map<std::string, const GCProgram>  _programs_map;       /**< Map with all already loaded program data. */
     mutable std::map<std::string, const GCKernel>   _built_programs_map; /**< Map with all already built program data. */
     static const std::map<std::string, std::string> _shader_program_map; /**< Map that associates kernel names with programs. */
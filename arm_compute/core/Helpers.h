@@ -44,6 +44,7 @@
 
 namespace arm_compute
 {
+class CPUInfo;
 class IKernel;
 class ITensor;
 class ITensorInfo;
@@ -62,6 +63,13 @@ typename std::enable_if<enable_bitwise_ops<T>::value, T>::type operator&(T lhs,
     using underlying_type = typename std::underlying_type<T>::type;
     return static_cast<T>(static_cast<underlying_type>(lhs) & static_cast<underlying_type>(rhs));
 }
+
+template <typename T>
+typename std::enable_if<enable_bitwise_ops<T>::value, T>::type operator|(T lhs, T rhs)
+{
+    using underlying_type = typename std::underlying_type<T>::type;
+    return static_cast<T>(static_cast<underlying_type>(lhs) | static_cast<underlying_type>(rhs));
+}
 #endif /* DOXYGEN_SKIP_THIS */
 
 /** Helper function to create and return a unique_ptr pointed to a CL/GLES kernel object
@@ -421,6 +429,52 @@ private:
 template <typename L, typename... Ts>
 inline void execute_window_loop(const Window &w, L &&lambda_function, Ts &&... iterators);
 
+/** Two-level cache tiling of a window
+ *
+ * Describes how a window is cut into tiles before execution: an outer tile sized
+ * for the L2 cache and, within it, an inner tile sized for the L1 cache. A tile
+ * size of 0 disables that level.
+ */
+struct WindowTiling
+{
+    size_t inner_dim{ Window::DimX };  /**< Dimension the inner tiles cut */
+    size_t inner_size{ 0 };            /**< Elements per inner tile, 0 to disable */
+    size_t outer_dim{ Window::DimY };  /**< Dimension the outer tiles cut */
+    size_t outer_size{ 0 };            /**< Elements per outer tile, 0 to disable */
+};
+
+/** Calculate a two-level tiling of a window from the data caches of the running CPU
+ *
+ * The inner tile is sized so that a square working set of @p bytes_per_element
+ * elements read once and written once fits in half the L1 data cache, the outer
+ * tile likewise against the L2 cache. Tile sizes are rounded up to the step of
+ * their dimension and levels whose tile already covers the whole dimension are
+ * disabled.
+ *
+ * @param[in] window            Window that will be executed
+ * @param[in] bytes_per_element Size of one processed element in bytes
+ * @param[in] cpu_info          CPU info of the thread that will execute the window
+ * @param[in] inner_dim         (Optional) Dimension the inner tiles cut
+ * @param[in] outer_dim         (Optional) Dimension the outer tiles cut
+ *
+ * @return The tiling to execute the window with
+ */
+WindowTiling calculate_cache_tiling(const Window &window, size_t bytes_per_element, const CPUInfo &cpu_info,
+                                    size_t inner_dim = Window::DimX, size_t outer_dim = Window::DimY);
+
+/** Execute a window tile by tile, calling the tile_function for each innermost tile
+ *
+ * The window is walked one outer tile at a time and, within each, one inner tile
+ * at a time, so consecutive calls stay within the cache footprints the tiling
+ * describes. The sub-windows passed to @p tile_function partition @p w exactly.
+ *
+ * @param[in] w             Window to execute
+ * @param[in] tiling        Tiling to cut the window with
+ * @param[in] tile_function The function of type void(function)( const Window & tile ) to call for each tile.
+ */
+template <typename L>
+inline void execute_window_loop_tiled(const Window &w, const WindowTiling &tiling, L &&tile_function);
+
 /** Update window and padding size for each of the access patterns.
  *
  * First the window size is reduced based on all access patterns that are not
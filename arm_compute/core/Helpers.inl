@@ -138,6 +138,23 @@ inline void execute_window_loop(const Window &w, L &&lambda_function, Ts &&... i
     ForEachDimension<Coordinates::num_max_dimensions>::unroll(w, id, std::forward<L>(lambda_function), std::forward<Ts>(iterators)...);
 }
 
+template <typename L>
+inline void execute_window_loop_tiled(const Window &w, const WindowTiling &tiling, L &&tile_function)
+{
+    const size_t num_outer_tiles = (tiling.outer_size != 0) ? w.num_tiles(tiling.outer_dim, tiling.outer_size) : 1;
+
+    for(size_t outer = 0; outer < num_outer_tiles; ++outer)
+    {
+        const Window outer_tile      = (tiling.outer_size != 0) ? w.tile_window(tiling.outer_dim, outer, tiling.outer_size) : w;
+        const size_t num_inner_tiles = (tiling.inner_size != 0) ? outer_tile.num_tiles(tiling.inner_dim, tiling.inner_size) : 1;
+
+        for(size_t inner = 0; inner < num_inner_tiles; ++inner)
+        {
+            tile_function((tiling.inner_size != 0) ? outer_tile.tile_window(tiling.inner_dim, inner, tiling.inner_size) : outer_tile);
+        }
+    }
+}
+
 inline constexpr Iterator::Iterator()
     : _ptr(nullptr), _dims()
 {
@@ -35,7 +35,8 @@ class ITensor;
 /** Tensor packing service */
 class ITensorPack
 {
-private:
+public:
+    /** Pack element, holding either a mutable or a constant tensor */
     struct PackElement
     {
         PackElement() = default;
@@ -52,7 +53,9 @@ private:
         const ITensor *ctensor{ nullptr };
     };
 
-public:
+    /** Constant iterator over the packed elements, keyed by their id */
+    using const_iterator = std::map<unsigned int, PackElement>::const_iterator;
+
     /** Default Constructor */
     ITensorPack() = default;
     /** Add tensor to the pack
@@ -92,6 +95,16 @@ public:
      * @return True if empty else false
      */
     bool empty() const;
+    /** Iterator to the first packed element
+     *
+     * @return A constant iterator to the first packed element
+     */
+    const_iterator begin() const;
+    /** Iterator past the last packed element
+     *
+     * @return A constant iterator past the last packed element
+     */
+    const_iterator end() const;
 
 private:
     std::map<unsigned int, PackElement> _pack{}; /**< Container with the packed tensors */
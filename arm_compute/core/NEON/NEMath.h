@@ -94,6 +94,17 @@ float32x4_t vtaylor_polyq_f32(float32x4_t x, const std::array<float32x4_t, 8> &c
  */
 float32x4_t vexpq_f32(float32x4_t x);
 
+/** Calculate exponential with reduced-precision
+ *
+ * Uses a fifth degree polynomial on the reduced argument instead of the
+ * table-based seventh degree one; the relative error stays below 1e-3.
+ *
+ * @param[in] x Input vector value in F32 format.
+ *
+ * @return The calculated exponent.
+ */
+float32x4_t vexpq_fast_f32(float32x4_t x);
+
 /** Calculate logarithm
  *
  * @param[in] x Input vector value in F32 format.
@@ -114,6 +125,17 @@ float32x4_t vlogq_f32(float32x4_t x);
  */
 float32x4_t vtanhq_f32(float32x4_t val);
 
+/** Calculate hyperbolic tangent with reduced-precision
+ *
+ * Same construction as @ref vtanhq_f32 but built on the reduced-precision
+ * exponential; the relative error stays below 1e-3.
+ *
+ * @param[in] val Input vector value in F32 format.
+ *
+ * @return The calculated Hyperbolic Tangent.
+ */
+float32x4_t vtanhq_fast_f32(float32x4_t val);
+
 /** Calculate n power of a number.
  *
  * pow(x,n) = e^(n*log(x))
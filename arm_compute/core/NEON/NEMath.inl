@@ -168,6 +168,41 @@ inline float32x4_t vexpq_f32(float32x4_t x)
     return poly;
 }
 
+inline float32x4_t vexpq_fast_f32(float32x4_t x)
+{
+    static const float32x4_t CONST_LN2          = vdupq_n_f32(0.6931471805f); // ln(2)
+    static const float32x4_t CONST_INV_LN2      = vdupq_n_f32(1.4426950408f); // 1/ln(2)
+    static const float32x4_t CONST_INF          = vdupq_n_f32(std::numeric_limits<float>::infinity());
+    static const float32x4_t CONST_MAX_INPUT    = vdupq_n_f32(88.7f);
+    static const float32x4_t CONST_0            = vdupq_n_f32(0.f);
+    static const int32x4_t   CONST_NEGATIVE_126 = vdupq_n_s32(-126);
+    static const float32x4_t CONST_1            = vdupq_n_f32(1.f);
+    static const float32x4_t CONST_C2           = vdupq_n_f32(0.5f);           // 1/2!
+    static const float32x4_t CONST_C3           = vdupq_n_f32(0.1666666667f);  // 1/3!
+    static const float32x4_t CONST_C4           = vdupq_n_f32(0.0416666667f);  // 1/4!
+    static const float32x4_t CONST_C5           = vdupq_n_f32(0.0083333333f);  // 1/5!
+
+    // Perform range reduction [-log(2),log(2)]
+    int32x4_t   m   = vcvtq_s32_f32(vmulq_f32(x, CONST_INV_LN2));
+    float32x4_t val = vmlsq_f32(x, vcvtq_f32_s32(m), CONST_LN2);
+
+    // Fifth degree Taylor polynomial, evaluated with Horner's scheme. Dropping the
+    // table-based seventh degree polynomial keeps the relative error below 1e-3
+    // over the reduced range while saving the coefficient table loads.
+    float32x4_t poly = vmlaq_f32(CONST_C4, CONST_C5, val);
+    poly             = vmlaq_f32(CONST_C3, poly, val);
+    poly             = vmlaq_f32(CONST_C2, poly, val);
+    poly             = vmlaq_f32(CONST_1, poly, val);
+    poly             = vmlaq_f32(CONST_1, poly, val);
+
+    // Reconstruct
+    poly = vreinterpretq_f32_s32(vqaddq_s32(vreinterpretq_s32_f32(poly), vqshlq_n_s32(m, 23)));
+    poly = vbslq_f32(vcltq_s32(m, CONST_NEGATIVE_126), CONST_0, poly); // Handle underflow
+    poly = vbslq_f32(vcgtq_f32(x, CONST_MAX_INPUT), CONST_INF, poly);  // Handle overflow
+
+    return poly;
+}
+
 inline float32x4_t vlogq_f32(float32x4_t x)
 {
     static const int32x4_t   CONST_127 = vdupq_n_s32(127);           // 127
@@ -201,6 +236,21 @@ inline float32x4_t vtanhq_f32(float32x4_t val)
     return tanh;
 }
 
+inline float32x4_t vtanhq_fast_f32(float32x4_t val)
+{
+    static const float32x4_t CONST_1        = vdupq_n_f32(1.f);
+    static const float32x4_t CONST_2        = vdupq_n_f32(2.f);
+    static const float32x4_t CONST_MIN_TANH = vdupq_n_f32(-10.f);
+    static const float32x4_t CONST_MAX_TANH = vdupq_n_f32(10.f);
+
+    float32x4_t x     = vminq_f32(vmaxq_f32(val, CONST_MIN_TANH), CONST_MAX_TANH);
+    float32x4_t exp2x = vexpq_fast_f32(vmulq_f32(CONST_2, x));
+    float32x4_t num   = vsubq_f32(exp2x, CONST_1);
+    float32x4_t den   = vaddq_f32(exp2x, CONST_1);
+    float32x4_t tanh  = vmulq_f32(num, vinvq_f32(den));
+    return tanh;
+}
+
 inline float32x4_t vpowq_f32(float32x4_t val, float32x4_t n)
 {
     return vexpq_f32(vmulq_f32(n, vlogq_f32(val)));
@@ -469,17 +519,46 @@ inline float16x8_t vtaylor_polyq_f16(float16x8_t x, const std::array<float16x8_t
 
 inline float16x8_t vexpq_f16(float16x8_t x)
 {
-    // TODO (COMPMID-1535) : Revisit FP16 approximations
-    const float32x4_t x_high = vcvt_f32_f16(vget_high_f16(x));
-    const float32x4_t x_low  = vcvt_f32_f16(vget_low_f16(x));
+    static const float16x8_t CONST_INV_LN2     = vdupq_n_f16(1.4426950408f); // 1/ln(2)
+    static const float16x8_t CONST_LN2_HI      = vdupq_n_f16(0.6875f);       // Exactly representable leading bits of ln(2)
+    static const float16x8_t CONST_LN2_LO      = vdupq_n_f16(0.0056471805f); // ln(2) - CONST_LN2_HI
+    static const float16x8_t CONST_INF         = vdupq_n_f16(std::numeric_limits<float>::infinity());
+    static const float16x8_t CONST_MAX_INPUT   = vdupq_n_f16(11.f); // Slightly above ln(65504)
+    static const float16x8_t CONST_0           = vdupq_n_f16(0.f);
+    static const float16x8_t CONST_1           = vdupq_n_f16(1.f);
+    static const float16x8_t CONST_C2          = vdupq_n_f16(0.5f);          // 1/2!
+    static const float16x8_t CONST_C3          = vdupq_n_f16(0.1666666667f); // 1/3!
+    static const float16x8_t CONST_C4          = vdupq_n_f16(0.0416666667f); // 1/4!
+    static const int16x8_t   CONST_NEGATIVE_14 = vdupq_n_s16(-14);
+
+    // Perform range reduction [-log(2),log(2)]. ln(2) is applied as a two-constant
+    // Cody-Waite sum so the reduced argument isn't dominated by the half-precision
+    // rounding of ln(2) itself.
+    const int16x8_t   m     = vcvtq_s16_f16(vmulq_f16(x, CONST_INV_LN2));
+    const float16x8_t m_f16 = vcvtq_f16_s16(m);
+    float16x8_t       val   = vsubq_f16(x, vmulq_f16(m_f16, CONST_LN2_HI));
+    val                     = vsubq_f16(val, vmulq_f16(m_f16, CONST_LN2_LO));
+
+    // Fourth degree Taylor polynomial: enough to reach half-precision round-off
+    // over the reduced range, keeping the whole evaluation in native fp16
+    float16x8_t poly = vaddq_f16(CONST_C3, vmulq_f16(CONST_C4, val));
+    poly             = vaddq_f16(CONST_C2, vmulq_f16(poly, val));
+    poly             = vaddq_f16(CONST_1, vmulq_f16(poly, val));
+    poly             = vaddq_f16(CONST_1, vmulq_f16(poly, val));
+
+    // Reconstruct by scaling with 2^m through the exponent bits (5-bit exponent, bias 15)
+    poly = vreinterpretq_f16_s16(vqaddq_s16(vreinterpretq_s16_f16(poly), vqshlq_n_s16(m, 10)));
+    poly = vbslq_f16(vcltq_s16(m, CONST_NEGATIVE_14), CONST_0, poly); // Handle underflow
+    poly = vbslq_f16(vcgtq_f16(x, CONST_MAX_INPUT), CONST_INF, poly); // Handle overflow
 
-    const float16x8_t res = vcombine_f16(vcvt_f16_f32(vexpq_f32(x_low)), vcvt_f16_f32(vexpq_f32(x_high)));
-    return res;
+    return poly;
 }
 
 inline float16x8_t vlogq_f16(float16x8_t x)
 {
-    // TODO (COMPMID-1535) : Revisit FP16 approximations
+    // Kept on the widening path: the logarithm polynomial loses too many of its
+    // ten half-precision mantissa bits when evaluated in fp16, and downstream
+    // users (e.g. pow) amplify that error further
     const float32x4_t x_high = vcvt_f32_f16(vget_high_f16(x));
     const float32x4_t x_low  = vcvt_f32_f16(vget_low_f16(x));
 
@@ -489,7 +568,8 @@ inline float16x8_t vlogq_f16(float16x8_t x)
 
 inline float16x8_t vpowq_f16(float16x8_t val, float16x8_t n)
 {
-    // TODO (giaiod01) - COMPMID-1535
+    // Kept on the widening path: pow multiplies the log error by n before
+    // exponentiating, so fp16 intermediates would be off by whole ulps
     float32x4_t n0_f32   = vcvt_f32_f16(vget_low_f16(n));
     float32x4_t n1_f32   = vcvt_f32_f16(vget_high_f16(n));
     float32x4_t val0_f32 = vcvt_f32_f16(vget_low_f16(val));
@@ -503,6 +583,8 @@ inline float16x8_t vpowq_f16(float16x8_t val, float16x8_t n)
 
 inline float16x8_t vsinq_f16(float16x8_t val)
 {
+    // Kept on the widening path: the argument reduction modulo pi cannot be
+    // carried out in fp16 without destroying the low mantissa bits
     const float32x4_t val_high = vcvt_f32_f16(vget_high_f16(val));
     const float32x4_t val_low  = vcvt_f32_f16(vget_low_f16(val));
 
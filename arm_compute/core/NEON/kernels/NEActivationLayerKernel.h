@@ -31,6 +31,8 @@
 #include <arm_fp16.h>
 #endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
 
+#include <array>
+
 namespace arm_compute
 {
 // Forward declarations
@@ -92,6 +94,17 @@ private:
     template <ActivationLayerInfo::ActivationFunction F, typename T>
     typename std::enable_if<arm_compute::utils::traits::is_floating_point<T>::value, void>::type
     activation(const ITensor *src, ITensor *dst, const Window &window);
+    /** Function to apply an activation function on a tensor using the reduced-precision
+     *  transcendental approximations.
+     *
+     * Only instantiated for the exponential-bound activations on FP32; selected when
+     * fast math is requested through @ref ActivationLayerInfo.
+     *
+     * @param[in] window Region on which to execute the kernel
+     */
+    template <ActivationLayerInfo::ActivationFunction F, typename T>
+    typename std::enable_if<std::is_same<T, float>::value, void>::type
+    activation_fast(const ITensor *src, ITensor *dst, const Window &window);
     /** Function to apply an activation function on a tensor.
      *
      * @param[in] window Region on which to execute the kernel
@@ -110,10 +123,34 @@ private:
      */
     template <ActivationLayerInfo::ActivationFunction F, typename T>
     typename std::enable_if<std::is_same<T, qsymm16_t>::value, void>::type activation(const ITensor *src, ITensor *dst, const Window &window);
+    /** Function to apply an activation function on an 8-bit quantized tensor through the lookup table built in configure().
+     *
+     * The table maps every possible 8-bit input value directly to the quantized activation result,
+     * so the whole dequantize-activate-requantize chain collapses into a table gather.
+     *
+     * @param[in] window Region on which to execute the kernel
+     */
+    void activation_lut(const ITensor *src, ITensor *dst, const Window &window);
+#if defined(__ARM_FEATURE_SVE)
+    /** Function to apply an activation function on an FP32 tensor using scalable vectors.
+     *
+     * Vector-length agnostic: the governing predicate covers the row tail, so there is no
+     * leftover scalar loop. Only instantiated for the non-transcendental activations; the
+     * others keep the NEON path with its table-based polynomial approximations.
+     *
+     * @param[in] window Region on which to execute the kernel
+     */
+    template <ActivationLayerInfo::ActivationFunction F>
+    void activation_sve(const ITensor *src, ITensor *dst, const Window &window);
+#endif /* defined(__ARM_FEATURE_SVE) */
 
 private:
     ActivationFunctionExecutorPtr _func;
+#if defined(__ARM_FEATURE_SVE)
+    ActivationFunctionExecutorPtr _func_sve;
+#endif /* defined(__ARM_FEATURE_SVE) */
     ActivationLayerInfo           _act_info;
+    std::array<uint8_t, 256>      _lut;
 };
 } // namespace arm_compute
 #endif /*ARM_COMPUTE_NEACTIVATIONLAYERKERNEL_H */
@@ -100,6 +100,10 @@ private:
     using AddFunction = void(const ITensor *input1, const ITensor *input2, ITensor *output, ConvertPolicy policy, const Window &window);
     /** Add function to use for the particular tensor types passed to configure() */
     AddFunction *_func;
+#if defined(__ARM_FEATURE_SVE)
+    /** Scalable-vector variant of @ref _func, preferred at run time on cores implementing SVE */
+    AddFunction *_func_sve;
+#endif /* defined(__ARM_FEATURE_SVE) */
     ConvertPolicy _policy;
 };
 } // namespace arm_compute
@@ -26,6 +26,9 @@
 
 #include "arm_compute/core/NEON/INEKernel.h"
 
+#include <cstdint>
+#include <vector>
+
 namespace arm_compute
 {
 // Forward declarations
@@ -88,6 +91,14 @@ public:
                            const ITensorInfo *mean, const ITensorInfo *var,
                            const ITensorInfo *beta = nullptr, const ITensorInfo *gamma = nullptr,
                            float epsilon = 0.001f, ActivationLayerInfo act_info = ActivationLayerInfo());
+    /** Fold the normalization parameters into packed per-channel scale/shift coefficients
+     *
+     * Computes gamma / sqrt(var + epsilon) and the matching shift once and switches the
+     * kernel onto an apply loop that only performs a multiply-add per element. Must be
+     * called once the parameter tensors hold their final contents, typically from the
+     * owning function's prepare(); further calls are no-ops.
+     */
+    void fold_coefficients();
 
     // Inherited methods overridden:
     void run(const Window &window, const ThreadInfo &info) override;
@@ -97,6 +108,14 @@ private:
     void configure_non_fused();
     /** Configure execution function in case of fused activation **/
     void configure_fused();
+    /** Configure execution function consuming the folded coefficients **/
+    void configure_folded();
+    /** Template function to compute the folded per-channel coefficients
+     *
+     * @tparam T Specialization data type
+     */
+    template <typename T>
+    void fold_coefficients_typed();
 
     /** Template function to run batch normalization on fp32
      *
@@ -118,6 +137,26 @@ private:
      */
     template <typename T, bool fused_activation, typename F>
     void batch_normalization_nhwc(const Window &window);
+    /** Template function to run batch normalization using the folded coefficients
+     *
+     * @tparam T                Specialization data type
+     * @tparam fused_activation Boolean that flags if its a fused activation or not
+     * @tparam F                Activation function functor to run
+     *
+     * @param[in] window Region on which to execute the kernel. (Must be a valid region of the window returned by window()).
+     */
+    template <typename T, bool fused_activation, typename F>
+    void batch_normalization_folded_nchw(const Window &window);
+    /** Template function to run batch normalization using the folded coefficients on tensors with NHWC format
+     *
+     * @tparam T                Specialization data type
+     * @tparam fused_activation Boolean that flags if its a fused activation or not
+     * @tparam F                Activation function functor to run
+     *
+     * @param[in] window Region on which to execute the kernel. (Must be a valid region of the window returned by window()).
+     */
+    template <typename T, bool fused_activation, typename F>
+    void batch_normalization_folded_nhwc(const Window &window);
     /** Common signature for all the batch normalization functions
      *
      * @param[in] window Region on which to execute the kernel.
@@ -134,6 +173,9 @@ private:
     const ITensor       *_beta;
     float                _epsilon;
     ActivationLayerInfo  _act_info;
+    std::vector<uint8_t> _folded_scale; /**< Packed per-channel multiplier gamma / sqrt(var + epsilon) */
+    std::vector<uint8_t> _folded_shift; /**< Packed per-channel addend beta - mean * multiplier */
+    bool                 _folded;       /**< True once the coefficients have been folded */
 };
 } // namespace arm_compute
 #endif /*ARM_COMPUTE_NEBATCHNORMALIZATIONLAYERKERNEL_H */
@@ -76,18 +76,22 @@ public:
      * @param[out] output         The output tensor. 3 lower dimensions represent a single output [width, height, OFM],
      *                            while the rest represent batch of outputs. Data types supported: Same as @p input
      * @param[in]  convolved_dims Output convolved dimensions.
+     * @param[in]  residual       (Optional) Residual tensor added element-wise while the output is written (fused skip
+     *                            connection epilogue). Shape must match @p output. Data types supported: F32. Defaults to nullptr
      */
-    void configure(const ITensor *input, ITensor *output, const Size2D &convolved_dims);
+    void configure(const ITensor *input, ITensor *output, const Size2D &convolved_dims, const ITensor *residual = nullptr);
     /** Static function to check if given info will lead to a valid configuration of @ref NECol2ImKernel
      *
      * @param[in] input          The input tensor to convert. Data types supported: All
      * @param[in] output         The output tensor. 3 lower dimensions represent a single output [width, height, OFM],
      *                           while the rest represent batch of outputs. Data types supported: Same as @p input
      * @param[in] convolved_dims Output convolved dimensions.
+     * @param[in] residual       (Optional) Residual tensor info added element-wise while the output is written.
+     *                           Shape must match @p output. Data types supported: F32. Defaults to nullptr
      *
      * @return a status
      */
-    static Status validate(const ITensorInfo *input, const ITensorInfo *output, const Size2D &convolved_dims);
+    static Status validate(const ITensorInfo *input, const ITensorInfo *output, const Size2D &convolved_dims, const ITensorInfo *residual = nullptr);
 
     // Inherited methods overridden:
     void run(const Window &window, const ThreadInfo &info) override;
@@ -100,6 +104,13 @@ private:
     template <typename T>
     void run_col2im(const Window &window);
 
+    /** Template function to run the col2im adding the residual tensor as the output is written
+     *
+     * @param[in] window Region on which to execute the kernel. (Must be a valid region of the window returned by window()).
+     */
+    template <typename T>
+    void run_col2im_residual(const Window &window);
+
     /** Common signature for all the specialised col2im functions
      *
      * @param[in] window Region on which to execute the kernel.
@@ -109,6 +120,7 @@ private:
     Col2ImFunctionPtr _func;
     const ITensor    *_input;
     ITensor          *_output;
+    const ITensor    *_residual;
     Size2D            _convolved_dims;
 };
 } // namespace arm_compute
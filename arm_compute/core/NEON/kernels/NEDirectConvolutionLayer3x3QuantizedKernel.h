@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_NEDIRECTCONVOLUTIONLAYER3X3QUANTIZEDKERNEL_H
+#define ARM_COMPUTE_NEDIRECTCONVOLUTIONLAYER3X3QUANTIZEDKERNEL_H
+
+#include "arm_compute/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+
+/** NEON kernel to run a 3x3 quantized direct convolution on NHWC tensors.
+ *
+ * The kernel consumes the input feature maps directly, without an im2col stage, by
+ * exploiting the channels-first memory layout of NHWC tensors: for every filter tap
+ * the input and weight channel runs are contiguous and are reduced with 8-bit dot
+ * products. Quantization offsets are folded in from running input and weight sums,
+ * so taps that fall outside the input behave as zero-point padding and no border
+ * handling is required. The raw accumulators are written out as S32 and are expected
+ * to be requantized by @ref NEDirectConvolutionLayerOutputStageKernel.
+ */
+class NEDirectConvolutionLayer3x3QuantizedKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEDirectConvolutionLayer3x3QuantizedKernel";
+    }
+    /** Default constructor */
+    NEDirectConvolutionLayer3x3QuantizedKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEDirectConvolutionLayer3x3QuantizedKernel(const NEDirectConvolutionLayer3x3QuantizedKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEDirectConvolutionLayer3x3QuantizedKernel &operator=(const NEDirectConvolutionLayer3x3QuantizedKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEDirectConvolutionLayer3x3QuantizedKernel(NEDirectConvolutionLayer3x3QuantizedKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEDirectConvolutionLayer3x3QuantizedKernel &operator=(NEDirectConvolutionLayer3x3QuantizedKernel &&) = default;
+    /** Default destructor */
+    ~NEDirectConvolutionLayer3x3QuantizedKernel() = default;
+    /** Set the input, weights and output tensors.
+     *
+     * @note Supported data layouts: NHWC
+     *
+     * @param[in]  input     Input tensor. Data types supported: QASYMM8/QASYMM8_SIGNED.
+     * @param[in]  weights   Weights tensor of dimensions [IFM, 3, 3, OFM]. Data type supported: Same as @p input.
+     * @param[out] output    Output tensor holding the raw convolution accumulators. Data type supported: S32.
+     * @param[in]  conv_info Contains padding and stride information described in @ref PadStrideInfo.
+     *                       Only unit and double strides are supported, with equal strides in x and y.
+     */
+    void configure(const ITensor *input, const ITensor *weights, ITensor *output, const PadStrideInfo &conv_info);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEDirectConvolutionLayer3x3QuantizedKernel
+     *
+     * @note Supported data layouts: NHWC
+     *
+     * @param[in] input     Input tensor info. Data types supported: QASYMM8/QASYMM8_SIGNED.
+     * @param[in] weights   Weights tensor info of dimensions [IFM, 3, 3, OFM]. Data type supported: Same as @p input.
+     * @param[in] output    Output tensor info holding the raw convolution accumulators. Data type supported: S32.
+     * @param[in] conv_info Contains padding and stride information described in @ref PadStrideInfo.
+     *                      Only unit and double strides are supported, with equal strides in x and y.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *output, const PadStrideInfo &conv_info);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    /** Typed loop over the output pixels of the scheduled window
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    template <typename T>
+    void convolve(const Window &window);
+
+    const ITensor *_input;
+    const ITensor *_weights;
+    ITensor       *_output;
+    PadStrideInfo  _conv_info;
+};
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_NEDIRECTCONVOLUTIONLAYER3X3QUANTIZEDKERNEL_H */
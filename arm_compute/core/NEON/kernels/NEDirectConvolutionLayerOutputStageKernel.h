@@ -31,6 +31,10 @@ namespace arm_compute
 {
 class ITensor;
 /** NEON kernel to accumulate the biases, if provided, or downscale in case of quantized input.
+ *
+ * For floating point input an optional per-channel scale/shift pair (e.g. a non-foldable batch normalization)
+ * and an activation function can additionally be applied while the output values are still in registers,
+ * avoiding extra full-tensor passes over the activations.
  *
  * @note We assume bias to be shared
  * @note For quantized computations (i.e. @p input of S32 type) the output data type for auto-initialization must be passed as part
@@ -57,46 +61,62 @@ public:
     ~NEDirectConvolutionLayerOutputStageKernel() = default;
     /** Set the accumulate buffer and the biases of the kernel.
      *
-     * @param[in, out] input  Input to add the bias to. If @p output is not specified then accumulation is done in-place.
-     *                        Data type supported: F16/F32/S32
-     * @param[in]      bias   (Optional) The shared bias tensor to add. It must be 1D Tensor. Data type supported: Same as @p input
-     * @param[out]     output (Optional) If the output tensor is specified the accumulation is done out-of-place. (Defaults to nullptr)
-     *                        Note that in-place computation is only supported for F16/F32. For S32 this must not be nullptr.
-     *                        Data type supported: F16/F32 or QASYMM8/QASYMM8_SIGNED if @p input is S32
-     * @param[in]      info   (Optional) DirectConvolutionLayerOutputStageKernel descriptor metadata
+     * @param[in, out] input    Input to add the bias to. If @p output is not specified then accumulation is done in-place.
+     *                          Data type supported: F16/F32/S32
+     * @param[in]      bias     (Optional) The shared bias tensor to add. It must be 1D Tensor. Data type supported: Same as @p input
+     * @param[out]     output   (Optional) If the output tensor is specified the accumulation is done out-of-place. (Defaults to nullptr)
+     *                          Note that in-place computation is only supported for F16/F32. For S32 this must not be nullptr.
+     *                          Data type supported: F16/F32 or QASYMM8/QASYMM8_SIGNED if @p input is S32
+     * @param[in]      info     (Optional) DirectConvolutionLayerOutputStageKernel descriptor metadata
+     * @param[in]      scale    (Optional) Per-channel multiplier applied after the bias. It must be 1D Tensor. Only supported for F16/F32 @p input.
+     *                          Data type supported: Same as @p input. If set, @p shift must be set as well.
+     * @param[in]      shift    (Optional) Per-channel addend applied after the scale. It must be 1D Tensor. Only supported for F16/F32 @p input.
+     *                          Data type supported: Same as @p input. If set, @p scale must be set as well.
+     * @param[in]      act_info (Optional) Activation function to fuse. Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU are supported, for F16/F32 @p input.
      */
     void configure(ITensor *input, const ITensor *bias = nullptr, ITensor *output = nullptr,
-                   const DirectConvolutionLayerOutputStageKernelInfo &info = DirectConvolutionLayerOutputStageKernelInfo());
+                   const DirectConvolutionLayerOutputStageKernelInfo &info = DirectConvolutionLayerOutputStageKernelInfo(),
+                   const ITensor *scale = nullptr, const ITensor *shift = nullptr, const ActivationLayerInfo &act_info = ActivationLayerInfo());
     /** Static function to check if given info will lead to a valid configuration of @ref NEDirectConvolutionLayerOutputStageKernel
      *
-     * @param[in] input  Input to add the bias to. If @p output is not specified then accumulation is done in-place.
-     *                   Data type supported: F16/F32/S32
-     * @param[in] bias   (Optional) The shared bias tensor to add. It must be 1D Tensor. Data type supported: Same as @p input
-     * @param[in] output (Optional) If the output tensor is specified the accumulation is done out-of-place. (Defaults to nullptr)
-     *                   Note that in-place computation is only supported for F16/F32. For S32 this must not be nullptr.
-     *                   Data type supported: F16/F32 or QASYMM8/QASYMM8_SIGNED if @p input is S32
-     * @param[in] info   (Optional) DirectConvolutionLayerOutputStageKernel descriptor metadata
+     * @param[in] input    Input to add the bias to. If @p output is not specified then accumulation is done in-place.
+     *                     Data type supported: F16/F32/S32
+     * @param[in] bias     (Optional) The shared bias tensor to add. It must be 1D Tensor. Data type supported: Same as @p input
+     * @param[in] output   (Optional) If the output tensor is specified the accumulation is done out-of-place. (Defaults to nullptr)
+     *                     Note that in-place computation is only supported for F16/F32. For S32 this must not be nullptr.
+     *                     Data type supported: F16/F32 or QASYMM8/QASYMM8_SIGNED if @p input is S32
+     * @param[in] info     (Optional) DirectConvolutionLayerOutputStageKernel descriptor metadata
+     * @param[in] scale    (Optional) Per-channel multiplier applied after the bias. It must be 1D Tensor. Only supported for F16/F32 @p input.
+     *                     Data type supported: Same as @p input. If set, @p shift must be set as well.
+     * @param[in] shift    (Optional) Per-channel addend applied after the scale. It must be 1D Tensor. Only supported for F16/F32 @p input.
+     *                     Data type supported: Same as @p input. If set, @p scale must be set as well.
+     * @param[in] act_info (Optional) Activation function to fuse. Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU are supported, for F16/F32 @p input.
      *
      * @return a status
      */
     static Status validate(const ITensorInfo *input, const ITensorInfo *bias = nullptr, const ITensorInfo *output = nullptr,
-                           const DirectConvolutionLayerOutputStageKernelInfo &info = DirectConvolutionLayerOutputStageKernelInfo());
+                           const DirectConvolutionLayerOutputStageKernelInfo &info = DirectConvolutionLayerOutputStageKernelInfo(),
+                           const ITensorInfo *scale = nullptr, const ITensorInfo *shift = nullptr, const ActivationLayerInfo &act_info = ActivationLayerInfo());
 
     // Inherited methods overridden:
     void run(const Window &window, const ThreadInfo &info) override;
 
 private:
     using OutputStageKernel = void(ITensor *input, const ITensor *bias, const Window &window, ITensor *output,
-                                   int result_fixedpoint_multiplier, int result_shift, int result_offset_after_shift);
+                                   int result_fixedpoint_multiplier, int result_shift, int result_offset_after_shift,
+                                   const ITensor *scale, const ITensor *shift, const ActivationLayerInfo &act_info);
 
 private:
-    OutputStageKernel *_func;
-    ITensor           *_input;
-    const ITensor     *_bias;
-    ITensor           *_output;
-    int                _result_fixedpoint_multiplier;
-    int                _result_shift;
-    int                _result_offset_after_shift;
+    OutputStageKernel  *_func;
+    ITensor            *_input;
+    const ITensor      *_bias;
+    ITensor            *_output;
+    const ITensor      *_scale;
+    const ITensor      *_shift;
+    ActivationLayerInfo _act_info;
+    int                 _result_fixedpoint_multiplier;
+    int                 _result_shift;
+    int                 _result_offset_after_shift;
 };
 } // namespace arm_compute
 #endif /*ARM_COMPUTE_NEDIRECTCONVOLUTIONLAYEROUTPUTSTAGEKERNEL_H */
@@ -84,7 +84,11 @@ protected:
     void configure_common(const ITensorInfo *input1, const ITensorInfo *input2, ITensorInfo *output);
 
     /** Function to use for the particular tensor types passed to configure() */
-    std::function<void(const ITensor *input1, const ITensor *input2, ITensor *output, const Window &window)> _function;
+    ElementwiseFunction *_function;
+#if defined(__ARM_FEATURE_SVE)
+    /** Scalable-vector variant of @ref _function, preferred at run time on cores implementing SVE */
+    ElementwiseFunction *_sve_function;
+#endif /* defined(__ARM_FEATURE_SVE) */
 
     const ITensor *_input1;
     const ITensor *_input2;
@@ -101,6 +101,17 @@ private:
     template <typename U>
     void gather_n_axis(const Window &window, const ThreadInfo &info);
 
+    /** Implementation of the gather operation for the 1 axis.
+     *
+     * The indexed rows are contiguous in memory, so they are copied with wide vector
+     * loads/stores while the next indexed row is prefetched.
+     *
+     * @param[in] window Region on which to execute the kernel. (Must be a region of the window returned by window())
+     * @param[in] info   Info about executing thread and CPU.
+     */
+    template <typename U>
+    void gather_1_axis_row(const Window &window, const ThreadInfo &info);
+
     using kernel_ptr = void (NEGatherKernel::*)(const Window &window, const ThreadInfo &info);
 
     const ITensor *_input;
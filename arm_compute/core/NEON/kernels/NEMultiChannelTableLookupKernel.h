@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_NEMULTICHANNELTABLELOOKUPKERNEL_H
+#define ARM_COMPUTE_NEMULTICHANNELTABLELOOKUPKERNEL_H
+
+#include "arm_compute/core/NEON/INESimpleKernel.h"
+
+namespace arm_compute
+{
+class ITensor;
+class ILut;
+
+/** Interface for the kernel to perform per-channel table lookup on interleaved RGB/RGBA images.
+ *
+ * Applies an independent 256-entry U8 LUT to each colour channel in a single pass over the
+ * interleaved data, avoiding the channel extract/combine round trips otherwise needed to run
+ * @ref NETableLookupKernel per channel. For RGBA8888 the alpha channel is copied through
+ * unchanged.
+ */
+class NEMultiChannelTableLookupKernel : public INESimpleKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEMultiChannelTableLookupKernel";
+    }
+    /** Default constructor */
+    NEMultiChannelTableLookupKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEMultiChannelTableLookupKernel(const NEMultiChannelTableLookupKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEMultiChannelTableLookupKernel &operator=(const NEMultiChannelTableLookupKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEMultiChannelTableLookupKernel(NEMultiChannelTableLookupKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEMultiChannelTableLookupKernel &operator=(NEMultiChannelTableLookupKernel &&) = default;
+    /** Initialise the kernel's input, luts and output.
+     *
+     * @param[in]  input  An input tensor. Formats supported: RGB888/RGBA8888.
+     * @param[in]  lut_r  LUT applied to the first channel. Must hold 256 U8 elements.
+     * @param[in]  lut_g  LUT applied to the second channel. Must hold 256 U8 elements.
+     * @param[in]  lut_b  LUT applied to the third channel. Must hold 256 U8 elements.
+     * @param[out] output The output tensor. Format supported: same as @p input
+     */
+    void configure(const ITensor *input, const ILut *lut_r, const ILut *lut_g, const ILut *lut_b, ITensor *output);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    /** Perform per-channel table lookup on an RGB888 window.
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    void lut_rgb(const Window &window);
+    /** Perform per-channel table lookup on an RGBA8888 window, alpha passed through.
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    void lut_rgba(const Window &window);
+    /** Common signature for all the specialised lut functions
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    using MultiChannelLookupFunction = void (NEMultiChannelTableLookupKernel::*)(const Window &window);
+    /** Sub function to use for the particular format passed to configure() */
+    MultiChannelLookupFunction _func;
+    const ILut                *_lut[3];
+};
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_NEMULTICHANNELTABLELOOKUPKERNEL_H */
@@ -83,15 +83,17 @@ private:
     /** Template function to run the permute
      *
      * @param[in] window Region on which to execute the kernel. (Must be a valid region of the window returned by window()).
+     * @param[in] info   Info about executing thread and CPU.
      */
     template <typename T>
-    void run_permute(const Window &window);
+    void run_permute(const Window &window, const ThreadInfo &info);
 
     /** Common signature for all the specialised permute functions
      *
      * @param[in] window Region on which to execute the kernel.
+     * @param[in] info   Info about executing thread and CPU.
      */
-    using PermuteFunctionPtr = void (NEPermuteKernel::*)(const Window &window);
+    using PermuteFunctionPtr = void (NEPermuteKernel::*)(const Window &window, const ThreadInfo &info);
 
     PermuteFunctionPtr _func;
     const ITensor     *_input;
@@ -100,6 +100,16 @@ private:
      * @param[in] exclude_padding Flag to specify exclusion of padding from the operation.
      */
     void poolingMxN_f32_nchw(const Window &window_input, const Window &window, PoolingType pooling_type, bool exclude_padding = false);
+    /** Function to perform global pooling for 32-bit floating point values.
+     *
+     * Reduces each input plane as a flat vectorized reduction, without per-element boundary checks.
+     *
+     * @param[in] window_input    Input region on which to execute the kernel.
+     * @param[in] window          Output region on which to execute the kernel.
+     * @param[in] pooling_type    Pooling operation to be computed.
+     * @param[in] exclude_padding Flag to specify exclusion of padding from the operation.
+     */
+    void pooling_global_f32_nchw(const Window &window_input, const Window &window, PoolingType pooling_type, bool exclude_padding = false);
     /** Function to perform MxN pooling for 32-bit floating point values (NHWC).
      *
      * @param[in] window_input    Input region on which to execute the kernel.
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_NEREDUCEMEANKERNEL_H
+#define ARM_COMPUTE_NEREDUCEMEANKERNEL_H
+
+#include "arm_compute/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** NEON kernel to perform a fused mean reduction over multiple axes in a single pass
+ *
+ * Instead of chaining one single-axis reduction per axis with intermediate tensors in between,
+ * the supported axis sets are accumulated directly into the output, vectorized along dimension 0.
+ */
+class NEReduceMeanKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEReduceMeanKernel";
+    }
+    /** Default constructor */
+    NEReduceMeanKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEReduceMeanKernel(const NEReduceMeanKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEReduceMeanKernel &operator=(const NEReduceMeanKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEReduceMeanKernel(NEReduceMeanKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEReduceMeanKernel &operator=(NEReduceMeanKernel &&) = default;
+    /** Default destructor */
+    ~NEReduceMeanKernel() = default;
+
+    /** Set the source and destination of the kernel
+     *
+     * @param[in]  input          Source tensor. Data type supported: F32.
+     * @param[out] output         Destination tensor. Data type supported: same as @p input.
+     *                            Must have the same shape as @p input with the reduced dimensions set to 1.
+     * @param[in]  reduction_axis Reduction axis vector. Supported axis sets: {1,2} and {1,2,3}.
+     */
+    void configure(const ITensor *input, ITensor *output, const Coordinates &reduction_axis);
+
+    /** Static function to check if given info will lead to a valid configuration of @ref NEReduceMeanKernel
+     *
+     * @param[in] input          Source tensor info. Data type supported: F32.
+     * @param[in] output         Destination tensor info. Data type supported: same as @p input.
+     *                           Must have the same shape as @p input with the reduced dimensions set to 1.
+     * @param[in] reduction_axis Reduction axis vector. Supported axis sets: {1,2} and {1,2,3}.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *output, const Coordinates &reduction_axis);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    const ITensor *_input;
+    ITensor       *_output;
+    bool           _reduce_batch;
+};
+} // namespace arm_compute
+#endif /*ARM_COMPUTE_NEREDUCEMEANKERNEL_H */
@@ -88,6 +88,11 @@ public:
 private:
     /** function to perform scale using nearest interpolation on the given window */
     void scale_nearest_nchw(const Window &window);
+    /** function to perform scale using nearest interpolation when the output is an integer multiple (2x, 4x) of the input
+     *
+     *  @note Replicates input pixels directly with interleaving stores, the offsets table is not used.
+     */
+    void scale_nearest_upscale_nchw(const Window &window);
     /** function to perform scale using bilinear interpolation on the given window */
     void scale_bilinear_nchw(const Window &window);
     /** function to perform scale using area interpolation on the given window
@@ -135,5 +135,80 @@ private:
     float                  _beta;
     ITensor               *_tmp; //Temporary. Used internally
 };
+
+/** Interface for the single-pass online-normalizer softmax kernel.
+ *
+ * The kernel computes the row maximum and the sum of exponentials together in one
+ * sweep over the logits, rescaling the running sum whenever a new maximum is found,
+ * and then normalizes in a second sweep. The input tensor is therefore read at most
+ * twice and no intermediate max or exponentials tensors are required.
+ */
+template <bool IS_LOG = false>
+class NELogits1DOnlineSoftmaxKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        if(IS_LOG)
+        {
+            return "NELogits1DOnlineLogSoftmaxKernel";
+        }
+        else
+        {
+            return "NELogits1DOnlineSoftmaxKernel";
+        }
+    }
+    /** Default constructor */
+    NELogits1DOnlineSoftmaxKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NELogits1DOnlineSoftmaxKernel(const NELogits1DOnlineSoftmaxKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NELogits1DOnlineSoftmaxKernel &operator=(const NELogits1DOnlineSoftmaxKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NELogits1DOnlineSoftmaxKernel(NELogits1DOnlineSoftmaxKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NELogits1DOnlineSoftmaxKernel &operator=(NELogits1DOnlineSoftmaxKernel &&) = default;
+    /** Default destructor */
+    ~NELogits1DOnlineSoftmaxKernel() = default;
+    /** Set the input and output tensors.
+     *
+     * @param[in]  input  Source tensor. Data types supported: F16/F32.
+     * @param[out] output Destination tensor. Data types supported: same as @p input.
+     * @param[in]  beta   A scaling factor for the exponent.
+     */
+    void configure(const ITensor *input, ITensor *output, const float beta);
+    /** Set the input and output tensor infos.
+     *
+     * The kernel keeps no tensor pointers when configured this way; the tensors to
+     * operate on are supplied at run time through @ref run_op, so one configured
+     * instance can serve concurrent tensor sets.
+     *
+     * @param[in]  input  Source tensor info. Data types supported: F16/F32.
+     * @param[out] output Destination tensor info. Data types supported: same as @p input.
+     * @param[in]  beta   A scaling factor for the exponent.
+     */
+    void configure(const ITensorInfo *input, ITensorInfo *output, const float beta);
+    /** Static function to check if given info will lead to a valid configuration of @ref NELogits1DOnlineSoftmaxKernel
+     *
+     * @param[in] input  Source tensor info. Data types supported: F16/F32.
+     * @param[in] output Destination tensor info. Data types supported: same as @p input.
+     * @param[in] beta   A scaling factor for the exponent.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *output, const float beta);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+    void run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+
+private:
+    using LogitsOnlineSoftmaxFunction = void(const ITensor &in, ITensor &out, const float beta, const Window &window);
+
+    LogitsOnlineSoftmaxFunction *_func;
+    const ITensor               *_input;
+    ITensor                     *_output;
+    float                        _beta;
+};
 } // namespace arm_compute
 #endif /*ARM_COMPUTE_NESOFTMAXLAYERKERNEL_H */
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_NESPARSECOMPRESSKERNEL_H
+#define ARM_COMPUTE_NESPARSECOMPRESSKERNEL_H
+
+#include "arm_compute/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+
+/** Kernel to compress a dense tensor into a bitmap plus a packed stream of its non-zero values.
+ *
+ * Post-activation tensors of pruned models are largely zero, so streaming them densely between
+ * stages wastes DDR bandwidth. The compressed form holds one presence bit per element (in tensor
+ * iteration order, LSB first within each byte) and the non-zero values packed contiguously; the
+ * achieved count is reported so callers can profile the sparsity actually observed.
+ *
+ * The packed positions depend on the prefix count of earlier elements, so the kernel is not
+ * parallelisable and runs in a single thread.
+ */
+class NESparseCompressKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NESparseCompressKernel";
+    }
+    /** Default constructor */
+    NESparseCompressKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NESparseCompressKernel(const NESparseCompressKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NESparseCompressKernel &operator=(const NESparseCompressKernel &) = delete;
+    /** Default Move Constructor. */
+    NESparseCompressKernel(NESparseCompressKernel &&) = default;
+    /** Default move assignment operator */
+    NESparseCompressKernel &operator=(NESparseCompressKernel &&) = default;
+    /** Default destructor */
+    ~NESparseCompressKernel() = default;
+    /** Set the input and output of the kernel
+     *
+     * @param[in]  input    Source tensor. Data type supported: F32
+     * @param[out] bitmap   Presence bitmap, one bit per element of @p input. Data type supported: U8.
+     *                      1D with ceil(elements / 8) entries; auto-initialized if empty.
+     * @param[out] nonzeros Packed non-zero values. Data type supported: same as @p input.
+     *                      1D sized for the dense element count (worst case); auto-initialized if empty.
+     * @param[out] nnz      Number of non-zero values written to @p nonzeros. Data type supported: U32.
+     *                      Single element; auto-initialized if empty.
+     */
+    void configure(const ITensor *input, ITensor *bitmap, ITensor *nonzeros, ITensor *nnz);
+    /** Static function to check if given info will lead to a valid configuration of @ref NESparseCompressKernel
+     *
+     * @param[in] input    Source tensor info. Data type supported: F32
+     * @param[in] bitmap   Presence bitmap info. Data type supported: U8
+     * @param[in] nonzeros Packed non-zero values info. Data type supported: same as @p input
+     * @param[in] nnz      Non-zero count info. Data type supported: U32
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *bitmap, const ITensorInfo *nonzeros, const ITensorInfo *nnz);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+    bool is_parallelisable() const override;
+
+private:
+    const ITensor *_input;
+    ITensor       *_bitmap;
+    ITensor       *_nonzeros;
+    ITensor       *_nnz;
+};
+
+/** Kernel to reconstruct a dense tensor from the bitmap + packed non-zeros form built by @ref NESparseCompressKernel.
+ *
+ * Like the compression, the packed stream is consumed sequentially, so the kernel runs in a
+ * single thread.
+ */
+class NESparseDecompressKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NESparseDecompressKernel";
+    }
+    /** Default constructor */
+    NESparseDecompressKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NESparseDecompressKernel(const NESparseDecompressKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NESparseDecompressKernel &operator=(const NESparseDecompressKernel &) = delete;
+    /** Default Move Constructor. */
+    NESparseDecompressKernel(NESparseDecompressKernel &&) = default;
+    /** Default move assignment operator */
+    NESparseDecompressKernel &operator=(NESparseDecompressKernel &&) = default;
+    /** Default destructor */
+    ~NESparseDecompressKernel() = default;
+    /** Set the input and output of the kernel
+     *
+     * @param[in]  bitmap   Presence bitmap, one bit per element of @p output. Data type supported: U8
+     * @param[in]  nonzeros Packed non-zero values. Data type supported: F32
+     * @param[out] output   Destination tensor, must carry the dense shape. Data type supported: same as @p nonzeros
+     */
+    void configure(const ITensor *bitmap, const ITensor *nonzeros, ITensor *output);
+    /** Static function to check if given info will lead to a valid configuration of @ref NESparseDecompressKernel
+     *
+     * @param[in] bitmap   Presence bitmap info. Data type supported: U8
+     * @param[in] nonzeros Packed non-zero values info. Data type supported: F32
+     * @param[in] output   Destination tensor info. Data type supported: same as @p nonzeros
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *bitmap, const ITensorInfo *nonzeros, const ITensorInfo *output);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+    bool is_parallelisable() const override;
+
+private:
+    const ITensor *_bitmap;
+    const ITensor *_nonzeros;
+    ITensor       *_output;
+};
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_NESPARSECOMPRESSKERNEL_H */
@@ -308,6 +308,338 @@ inline void nchw_to_nhwc(
   );
 }
 
+/*****************************************************************************/
+/* 8-bit implementation : NCHW -> NHWC
+ */
+template <>
+inline void nchw_to_nhwc(
+  const uint8_t* const in,
+  uint8_t* const out,
+  const int n_batches,
+  const int n_channels,
+  const int n_rows,
+  const int n_cols,
+  int in_batch_stride,
+  int in_channel_stride,
+  int in_row_stride,
+  int out_batch_stride,
+  int out_row_stride,
+  int out_col_stride
+)
+{
+  typedef uint8_t T;
+
+  // Fill in the stride values
+  in_row_stride = (in_row_stride) ? in_row_stride : n_cols;
+  in_channel_stride = (in_channel_stride) ? in_channel_stride
+                                          : n_rows * in_row_stride;
+  in_batch_stride = (in_batch_stride) ? in_batch_stride
+                                      : n_channels * in_channel_stride;
+
+  out_col_stride = (out_col_stride) ? out_col_stride : n_channels;
+  out_row_stride = (out_row_stride) ? out_row_stride : n_cols * out_col_stride;
+  out_batch_stride = (out_batch_stride) ? out_batch_stride
+                                        : n_rows * out_row_stride;
+
+  // Perform the re-ordering
+  for (int n = 0; n < n_batches; n++)
+  {
+    const T* const in_batch = in + n*in_batch_stride;
+    T* const out_batch = out + n*out_batch_stride;
+
+    for (int i = 0; i < n_rows; i++)
+    {
+      const T* const in_row = in_batch + i*in_row_stride;
+      T* const out_row = out_batch + i*out_row_stride;
+
+      int j = 0, j_remaining = n_cols;
+#ifdef __arm_any__
+      for (; j_remaining >= 16; j += 16, j_remaining -= 16)
+      {
+        int c = 0, c_remaining = n_channels;
+        for (; c_remaining >= 4; c += 4, c_remaining -= 4)
+        {
+          // Read 4 channels worth of 16 columns, then zip to produce 16
+          // columns worth of 4 channels.
+          uint8x16_t channel_pixels[4];
+          channel_pixels[0] = vld1q_u8(in_row + (c + 0)*in_channel_stride + j);
+          channel_pixels[1] = vld1q_u8(in_row + (c + 1)*in_channel_stride + j);
+          channel_pixels[2] = vld1q_u8(in_row + (c + 2)*in_channel_stride + j);
+          channel_pixels[3] = vld1q_u8(in_row + (c + 3)*in_channel_stride + j);
+
+          const auto zip1 = vzipq_u8(channel_pixels[0], channel_pixels[2]);
+          const auto zip2 = vzipq_u8(channel_pixels[1], channel_pixels[3]);
+          const auto out_0 = vzipq_u8(zip1.val[0], zip2.val[0]);
+          const auto out_1 = vzipq_u8(zip1.val[1], zip2.val[1]);
+
+          // Each 32-bit lane now holds one column's worth of 4 channels
+          vst1q_lane_u32(reinterpret_cast<uint32_t*>(out_row + (j +  0)*out_col_stride + c), vreinterpretq_u32_u8(out_0.val[0]), 0);
+          vst1q_lane_u32(reinterpret_cast<uint32_t*>(out_row + (j +  1)*out_col_stride + c), vreinterpretq_u32_u8(out_0.val[0]), 1);
+          vst1q_lane_u32(reinterpret_cast<uint32_t*>(out_row + (j +  2)*out_col_stride + c), vreinterpretq_u32_u8(out_0.val[0]), 2);
+          vst1q_lane_u32(reinterpret_cast<uint32_t*>(out_row + (j +  3)*out_col_stride + c), vreinterpretq_u32_u8(out_0.val[0]), 3);
+          vst1q_lane_u32(reinterpret_cast<uint32_t*>(out_row + (j +  4)*out_col_stride + c), vreinterpretq_u32_u8(out_0.val[1]), 0);
+          vst1q_lane_u32(reinterpret_cast<uint32_t*>(out_row + (j +  5)*out_col_stride + c), vreinterpretq_u32_u8(out_0.val[1]), 1);
+          vst1q_lane_u32(reinterpret_cast<uint32_t*>(out_row + (j +  6)*out_col_stride + c), vreinterpretq_u32_u8(out_0.val[1]), 2);
+          vst1q_lane_u32(reinterpret_cast<uint32_t*>(out_row + (j +  7)*out_col_stride + c), vreinterpretq_u32_u8(out_0.val[1]), 3);
+          vst1q_lane_u32(reinterpret_cast<uint32_t*>(out_row + (j +  8)*out_col_stride + c), vreinterpretq_u32_u8(out_1.val[0]), 0);
+          vst1q_lane_u32(reinterpret_cast<uint32_t*>(out_row + (j +  9)*out_col_stride + c), vreinterpretq_u32_u8(out_1.val[0]), 1);
+          vst1q_lane_u32(reinterpret_cast<uint32_t*>(out_row + (j + 10)*out_col_stride + c), vreinterpretq_u32_u8(out_1.val[0]), 2);
+          vst1q_lane_u32(reinterpret_cast<uint32_t*>(out_row + (j + 11)*out_col_stride + c), vreinterpretq_u32_u8(out_1.val[0]), 3);
+          vst1q_lane_u32(reinterpret_cast<uint32_t*>(out_row + (j + 12)*out_col_stride + c), vreinterpretq_u32_u8(out_1.val[1]), 0);
+          vst1q_lane_u32(reinterpret_cast<uint32_t*>(out_row + (j + 13)*out_col_stride + c), vreinterpretq_u32_u8(out_1.val[1]), 1);
+          vst1q_lane_u32(reinterpret_cast<uint32_t*>(out_row + (j + 14)*out_col_stride + c), vreinterpretq_u32_u8(out_1.val[1]), 2);
+          vst1q_lane_u32(reinterpret_cast<uint32_t*>(out_row + (j + 15)*out_col_stride + c), vreinterpretq_u32_u8(out_1.val[1]), 3);
+        }
+        for (; c_remaining; c++, c_remaining--)
+        {
+          for (int _j = 0; _j < 16; _j++)
+          {
+            const T* const in_col = in_row + j + _j;
+            T* const out_col = out_row + (j + _j)*out_col_stride;
+            const T* const in_channel = in_col + c*in_channel_stride;
+            out_col[c] = *(in_channel);
+          }
+        }
+      }
+      for (; j_remaining >= 8; j += 8, j_remaining -= 8)
+      {
+        int c = 0, c_remaining = n_channels;
+        for (; c_remaining >= 4; c += 4, c_remaining -= 4)
+        {
+          // Read 4 channels worth of 8 columns, then zip to produce 8 columns
+          // worth of 4 channels.
+          uint8x8_t channel_pixels[4];
+          channel_pixels[0] = vld1_u8(in_row + (c + 0)*in_channel_stride + j);
+          channel_pixels[1] = vld1_u8(in_row + (c + 1)*in_channel_stride + j);
+          channel_pixels[2] = vld1_u8(in_row + (c + 2)*in_channel_stride + j);
+          channel_pixels[3] = vld1_u8(in_row + (c + 3)*in_channel_stride + j);
+
+          const auto zip1 = vzip_u8(channel_pixels[0], channel_pixels[2]);
+          const auto zip2 = vzip_u8(channel_pixels[1], channel_pixels[3]);
+          const auto out_0 = vzip_u8(zip1.val[0], zip2.val[0]);
+          const auto out_1 = vzip_u8(zip1.val[1], zip2.val[1]);
+
+          vst1_lane_u32(reinterpret_cast<uint32_t*>(out_row + (j + 0)*out_col_stride + c), vreinterpret_u32_u8(out_0.val[0]), 0);
+          vst1_lane_u32(reinterpret_cast<uint32_t*>(out_row + (j + 1)*out_col_stride + c), vreinterpret_u32_u8(out_0.val[0]), 1);
+          vst1_lane_u32(reinterpret_cast<uint32_t*>(out_row + (j + 2)*out_col_stride + c), vreinterpret_u32_u8(out_0.val[1]), 0);
+          vst1_lane_u32(reinterpret_cast<uint32_t*>(out_row + (j + 3)*out_col_stride + c), vreinterpret_u32_u8(out_0.val[1]), 1);
+          vst1_lane_u32(reinterpret_cast<uint32_t*>(out_row + (j + 4)*out_col_stride + c), vreinterpret_u32_u8(out_1.val[0]), 0);
+          vst1_lane_u32(reinterpret_cast<uint32_t*>(out_row + (j + 5)*out_col_stride + c), vreinterpret_u32_u8(out_1.val[0]), 1);
+          vst1_lane_u32(reinterpret_cast<uint32_t*>(out_row + (j + 6)*out_col_stride + c), vreinterpret_u32_u8(out_1.val[1]), 0);
+          vst1_lane_u32(reinterpret_cast<uint32_t*>(out_row + (j + 7)*out_col_stride + c), vreinterpret_u32_u8(out_1.val[1]), 1);
+        }
+        for (; c_remaining; c++, c_remaining--)
+        {
+          for (int _j = 0; _j < 8; _j++)
+          {
+            const T* const in_col = in_row + j + _j;
+            T* const out_col = out_row + (j + _j)*out_col_stride;
+            const T* const in_channel = in_col + c*in_channel_stride;
+            out_col[c] = *(in_channel);
+          }
+        }
+      }
+#endif  // __arm_any__
+      for (; j_remaining; j++, j_remaining--)
+      {
+        const T* const in_col = in_row + j;
+        T* const out_col = out_row + j*out_col_stride;
+
+        for (int c = 0; c < n_channels; c++)
+        {
+          const T* const in_channel = in_col + c*in_channel_stride;
+          out_col[c] = *(in_channel);
+        }
+      }
+    }
+  }
+}
+
+template <>
+inline void nchw_to_nhwc(
+  const int8_t* const in,
+  int8_t* const out,
+  const int n_batches,
+  const int n_channels,
+  const int n_rows,
+  const int n_cols,
+  int in_batch_stride,
+  int in_channel_stride,
+  int in_row_stride,
+  int out_batch_stride,
+  int out_row_stride,
+  int out_col_stride
+)
+{
+  nchw_to_nhwc(
+    reinterpret_cast<const uint8_t*>(in),
+    reinterpret_cast<uint8_t*>(out),
+    n_batches, n_channels, n_rows, n_cols,
+    in_batch_stride, in_channel_stride, in_row_stride,
+    out_batch_stride, out_row_stride, out_col_stride
+  );
+}
+
+/*****************************************************************************/
+/* 16-bit implementation : NCHW -> NHWC
+ */
+template <>
+inline void nchw_to_nhwc(
+  const uint16_t* const in,
+  uint16_t* const out,
+  const int n_batches,
+  const int n_channels,
+  const int n_rows,
+  const int n_cols,
+  int in_batch_stride,
+  int in_channel_stride,
+  int in_row_stride,
+  int out_batch_stride,
+  int out_row_stride,
+  int out_col_stride
+)
+{
+  typedef uint16_t T;
+
+  // Fill in the stride values
+  in_row_stride = (in_row_stride) ? in_row_stride : n_cols;
+  in_channel_stride = (in_channel_stride) ? in_channel_stride
+                                          : n_rows * in_row_stride;
+  in_batch_stride = (in_batch_stride) ? in_batch_stride
+                                      : n_channels * in_channel_stride;
+
+  out_col_stride = (out_col_stride) ? out_col_stride : n_channels;
+  out_row_stride = (out_row_stride) ? out_row_stride : n_cols * out_col_stride;
+  out_batch_stride = (out_batch_stride) ? out_batch_stride
+                                        : n_rows * out_row_stride;
+
+  // Perform the re-ordering
+  for (int n = 0; n < n_batches; n++)
+  {
+    const T* const in_batch = in + n*in_batch_stride;
+    T* const out_batch = out + n*out_batch_stride;
+
+    for (int i = 0; i < n_rows; i++)
+    {
+      const T* const in_row = in_batch + i*in_row_stride;
+      T* const out_row = out_batch + i*out_row_stride;
+
+      int j = 0, j_remaining = n_cols;
+#ifdef __arm_any__
+      for (; j_remaining >= 8; j += 8, j_remaining -= 8)
+      {
+        int c = 0, c_remaining = n_channels;
+        for (; c_remaining >= 4; c += 4, c_remaining -= 4)
+        {
+          // Read 4 channels worth of 8 columns, then zip to produce 8 columns
+          // worth of 4 channels.
+          uint16x8_t channel_pixels[4];
+          channel_pixels[0] = vld1q_u16(in_row + (c + 0)*in_channel_stride + j);
+          channel_pixels[1] = vld1q_u16(in_row + (c + 1)*in_channel_stride + j);
+          channel_pixels[2] = vld1q_u16(in_row + (c + 2)*in_channel_stride + j);
+          channel_pixels[3] = vld1q_u16(in_row + (c + 3)*in_channel_stride + j);
+
+          const auto zip1 = vzipq_u16(channel_pixels[0], channel_pixels[2]);
+          const auto zip2 = vzipq_u16(channel_pixels[1], channel_pixels[3]);
+          const auto out_0 = vzipq_u16(zip1.val[0], zip2.val[0]);
+          const auto out_1 = vzipq_u16(zip1.val[1], zip2.val[1]);
+
+          // Each half vector now holds one column's worth of 4 channels
+          vst1_u16(out_row + (j + 0)*out_col_stride + c, vget_low_u16(out_0.val[0]));
+          vst1_u16(out_row + (j + 1)*out_col_stride + c, vget_high_u16(out_0.val[0]));
+          vst1_u16(out_row + (j + 2)*out_col_stride + c, vget_low_u16(out_0.val[1]));
+          vst1_u16(out_row + (j + 3)*out_col_stride + c, vget_high_u16(out_0.val[1]));
+          vst1_u16(out_row + (j + 4)*out_col_stride + c, vget_low_u16(out_1.val[0]));
+          vst1_u16(out_row + (j + 5)*out_col_stride + c, vget_high_u16(out_1.val[0]));
+          vst1_u16(out_row + (j + 6)*out_col_stride + c, vget_low_u16(out_1.val[1]));
+          vst1_u16(out_row + (j + 7)*out_col_stride + c, vget_high_u16(out_1.val[1]));
+        }
+        for (; c_remaining; c++, c_remaining--)
+        {
+          for (int _j = 0; _j < 8; _j++)
+          {
+            const T* const in_col = in_row + j + _j;
+            T* const out_col = out_row + (j + _j)*out_col_stride;
+            const T* const in_channel = in_col + c*in_channel_stride;
+            out_col[c] = *(in_channel);
+          }
+        }
+      }
+      for (; j_remaining >= 4; j += 4, j_remaining -= 4)
+      {
+        int c = 0, c_remaining = n_channels;
+        for (; c_remaining >= 4; c += 4, c_remaining -= 4)
+        {
+          // Read 4 channels worth of 4 columns, then zip to produce 4 columns
+          // worth of 4 channels.
+          uint16x4_t channel_pixels[4];
+          channel_pixels[0] = vld1_u16(in_row + (c + 0)*in_channel_stride + j);
+          channel_pixels[1] = vld1_u16(in_row + (c + 1)*in_channel_stride + j);
+          channel_pixels[2] = vld1_u16(in_row + (c + 2)*in_channel_stride + j);
+          channel_pixels[3] = vld1_u16(in_row + (c + 3)*in_channel_stride + j);
+
+          const auto zip1 = vzip_u16(channel_pixels[0], channel_pixels[2]);
+          const auto zip2 = vzip_u16(channel_pixels[1], channel_pixels[3]);
+          const auto out_0 = vzip_u16(zip1.val[0], zip2.val[0]);
+          const auto out_1 = vzip_u16(zip1.val[1], zip2.val[1]);
+
+          vst1_u16(out_row + (j + 0)*out_col_stride + c, out_0.val[0]);
+          vst1_u16(out_row + (j + 1)*out_col_stride + c, out_0.val[1]);
+          vst1_u16(out_row + (j + 2)*out_col_stride + c, out_1.val[0]);
+          vst1_u16(out_row + (j + 3)*out_col_stride + c, out_1.val[1]);
+        }
+        for (; c_remaining; c++, c_remaining--)
+        {
+          for (int _j = 0; _j < 4; _j++)
+          {
+            const T* const in_col = in_row + j + _j;
+            T* const out_col = out_row + (j + _j)*out_col_stride;
+            const T* const in_channel = in_col + c*in_channel_stride;
+            out_col[c] = *(in_channel);
+          }
+        }
+      }
+#endif  // __arm_any__
+      for (; j_remaining; j++, j_remaining--)
+      {
+        const T* const in_col = in_row + j;
+        T* const out_col = out_row + j*out_col_stride;
+
+        for (int c = 0; c < n_channels; c++)
+        {
+          const T* const in_channel = in_col + c*in_channel_stride;
+          out_col[c] = *(in_channel);
+        }
+      }
+    }
+  }
+}
+
+template <>
+inline void nchw_to_nhwc(
+  const int16_t* const in,
+  int16_t* const out,
+  const int n_batches,
+  const int n_channels,
+  const int n_rows,
+  const int n_cols,
+  int in_batch_stride,
+  int in_channel_stride,
+  int in_row_stride,
+  int out_batch_stride,
+  int out_row_stride,
+  int out_col_stride
+)
+{
+  nchw_to_nhwc(
+    reinterpret_cast<const uint16_t*>(in),
+    reinterpret_cast<uint16_t*>(out),
+    n_batches, n_channels, n_rows, n_cols,
+    in_batch_stride, in_channel_stride, in_row_stride,
+    out_batch_stride, out_row_stride, out_col_stride
+  );
+}
+
 /*****************************************************************************/
 /* Generic implementation : NCHW -> NHWC
  */
@@ -550,6 +882,298 @@ inline void nhwc_to_nchw(
   );
 }
 
+/*****************************************************************************/
+/* 8-bit implementation : NHWC -> NCHW
+ */
+template <>
+inline void nhwc_to_nchw(
+  const uint8_t* const in,  // Input data in NHWC form
+  uint8_t* const out,       // Output data in NCHW form
+  const int n_batches,
+  const int n_rows,
+  const int n_cols,
+  const int n_channels,
+  int in_batch_stride,
+  int in_row_stride,
+  int in_col_stride,
+  int out_batch_stride,
+  int out_channel_stride,
+  int out_row_stride
+)
+{
+  typedef uint8_t T;
+
+  // Fill in stride values
+  in_col_stride = (in_col_stride) ? in_col_stride : n_channels;
+  in_row_stride = (in_row_stride) ? in_row_stride : n_cols * in_col_stride;
+  in_batch_stride = (in_batch_stride) ? in_batch_stride
+                                      : n_rows * in_row_stride;
+
+  out_row_stride = (out_row_stride) ? out_row_stride : n_cols;
+  out_channel_stride = (out_channel_stride) ? out_channel_stride
+                                            : n_rows * out_row_stride;
+  out_batch_stride = (out_batch_stride) ? out_batch_stride
+                                        : n_channels * out_channel_stride;
+
+  // Perform the re-ordering
+  // For every batch
+  for (int n = 0; n < n_batches; n++)
+  {
+    const T* const in_batch = in + n*in_batch_stride;
+    T* const out_batch = out + n*out_batch_stride;
+
+    // For every row
+    for (int i = 0; i < n_rows; i++)
+    {
+      const T* const in_i = in_batch + i*in_row_stride;
+      T* const out_i = out_batch + i*out_row_stride;
+
+      // For every column, beginning with chunks of 4
+      int j = 0, j_remaining = n_cols;
+#ifdef __arm_any__
+      for (; j_remaining >= 4; j += 4, j_remaining -= 4)
+      {
+        // For every channel, beginning with chunks of 16
+        int c = 0, c_remaining = n_channels;
+        for (; c_remaining >= 16; c += 16, c_remaining -= 16)
+        {
+          // Read 4 columns worth of 16 channels then zip to produce 16
+          // channels worth of 4 columns.
+          uint8x16_t pixel_channels[4];
+          pixel_channels[0] = vld1q_u8(in_i + (j + 0)*in_col_stride + c);
+          pixel_channels[1] = vld1q_u8(in_i + (j + 1)*in_col_stride + c);
+          pixel_channels[2] = vld1q_u8(in_i + (j + 2)*in_col_stride + c);
+          pixel_channels[3] = vld1q_u8(in_i + (j + 3)*in_col_stride + c);
+
+          const auto zip1 = vzipq_u8(pixel_channels[0], pixel_channels[2]);
+          const auto zip2 = vzipq_u8(pixel_channels[1], pixel_channels[3]);
+          const auto out_0 = vzipq_u8(zip1.val[0], zip2.val[0]);
+          const auto out_1 = vzipq_u8(zip1.val[1], zip2.val[1]);
+
+          // Each 32-bit lane now holds one channel's worth of 4 columns
+          vst1q_lane_u32(reinterpret_cast<uint32_t*>(out_i + (c +  0)*out_channel_stride + j), vreinterpretq_u32_u8(out_0.val[0]), 0);
+          vst1q_lane_u32(reinterpret_cast<uint32_t*>(out_i + (c +  1)*out_channel_stride + j), vreinterpretq_u32_u8(out_0.val[0]), 1);
+          vst1q_lane_u32(reinterpret_cast<uint32_t*>(out_i + (c +  2)*out_channel_stride + j), vreinterpretq_u32_u8(out_0.val[0]), 2);
+          vst1q_lane_u32(reinterpret_cast<uint32_t*>(out_i + (c +  3)*out_channel_stride + j), vreinterpretq_u32_u8(out_0.val[0]), 3);
+          vst1q_lane_u32(reinterpret_cast<uint32_t*>(out_i + (c +  4)*out_channel_stride + j), vreinterpretq_u32_u8(out_0.val[1]), 0);
+          vst1q_lane_u32(reinterpret_cast<uint32_t*>(out_i + (c +  5)*out_channel_stride + j), vreinterpretq_u32_u8(out_0.val[1]), 1);
+          vst1q_lane_u32(reinterpret_cast<uint32_t*>(out_i + (c +  6)*out_channel_stride + j), vreinterpretq_u32_u8(out_0.val[1]), 2);
+          vst1q_lane_u32(reinterpret_cast<uint32_t*>(out_i + (c +  7)*out_channel_stride + j), vreinterpretq_u32_u8(out_0.val[1]), 3);
+          vst1q_lane_u32(reinterpret_cast<uint32_t*>(out_i + (c +  8)*out_channel_stride + j), vreinterpretq_u32_u8(out_1.val[0]), 0);
+          vst1q_lane_u32(reinterpret_cast<uint32_t*>(out_i + (c +  9)*out_channel_stride + j), vreinterpretq_u32_u8(out_1.val[0]), 1);
+          vst1q_lane_u32(reinterpret_cast<uint32_t*>(out_i + (c + 10)*out_channel_stride + j), vreinterpretq_u32_u8(out_1.val[0]), 2);
+          vst1q_lane_u32(reinterpret_cast<uint32_t*>(out_i + (c + 11)*out_channel_stride + j), vreinterpretq_u32_u8(out_1.val[0]), 3);
+          vst1q_lane_u32(reinterpret_cast<uint32_t*>(out_i + (c + 12)*out_channel_stride + j), vreinterpretq_u32_u8(out_1.val[1]), 0);
+          vst1q_lane_u32(reinterpret_cast<uint32_t*>(out_i + (c + 13)*out_channel_stride + j), vreinterpretq_u32_u8(out_1.val[1]), 1);
+          vst1q_lane_u32(reinterpret_cast<uint32_t*>(out_i + (c + 14)*out_channel_stride + j), vreinterpretq_u32_u8(out_1.val[1]), 2);
+          vst1q_lane_u32(reinterpret_cast<uint32_t*>(out_i + (c + 15)*out_channel_stride + j), vreinterpretq_u32_u8(out_1.val[1]), 3);
+        }
+        for (; c_remaining; c++, c_remaining--)
+        {
+          for (int _j = 0; _j < 4; _j++)
+          {
+            const T* const in_j = in_i + (j + _j)*in_col_stride;
+            T* const out_j = out_i + (j + _j);
+            const T* const in_channel = in_j + c;
+            T* const out_channel = out_j + c*out_channel_stride;
+            *(out_channel) = *(in_channel);
+          }
+        }
+      }
+#endif  // __arm_any__
+      for (; j_remaining; j++, j_remaining--)
+      {
+        const T* const in_j = in_i + j*in_col_stride;
+        T* const out_j = out_i + j;
+
+        for (int c = 0; c < n_channels; c++)
+        {
+          const T* const in_channel = in_j + c;
+          T* const out_channel = out_j + c*out_channel_stride;
+          *(out_channel) = *(in_channel);
+        }
+      }
+    }
+  }
+}
+
+template <>
+inline void nhwc_to_nchw(
+  const int8_t* const in,  // Input data in NHWC form
+  int8_t* const out,       // Output data in NCHW form
+  const int n_batches,
+  const int n_rows,
+  const int n_cols,
+  const int n_channels,
+  int in_batch_stride,
+  int in_row_stride,
+  int in_col_stride,
+  int out_batch_stride,
+  int out_channel_stride,
+  int out_row_stride
+)
+{
+  nhwc_to_nchw(
+    reinterpret_cast<const uint8_t*>(in),
+    reinterpret_cast<uint8_t*>(out),
+    n_batches, n_rows, n_cols, n_channels,
+    in_batch_stride, in_row_stride, in_col_stride,
+    out_batch_stride, out_channel_stride, out_row_stride
+  );
+}
+
+/*****************************************************************************/
+/* 16-bit implementation : NHWC -> NCHW
+ */
+template <>
+inline void nhwc_to_nchw(
+  const uint16_t* const in,  // Input data in NHWC form
+  uint16_t* const out,       // Output data in NCHW form
+  const int n_batches,
+  const int n_rows,
+  const int n_cols,
+  const int n_channels,
+  int in_batch_stride,
+  int in_row_stride,
+  int in_col_stride,
+  int out_batch_stride,
+  int out_channel_stride,
+  int out_row_stride
+)
+{
+  typedef uint16_t T;
+
+  // Fill in stride values
+  in_col_stride = (in_col_stride) ? in_col_stride : n_channels;
+  in_row_stride = (in_row_stride) ? in_row_stride : n_cols * in_col_stride;
+  in_batch_stride = (in_batch_stride) ? in_batch_stride
+                                      : n_rows * in_row_stride;
+
+  out_row_stride = (out_row_stride) ? out_row_stride : n_cols;
+  out_channel_stride = (out_channel_stride) ? out_channel_stride
+                                            : n_rows * out_row_stride;
+  out_batch_stride = (out_batch_stride) ? out_batch_stride
+                                        : n_channels * out_channel_stride;
+
+  // Perform the re-ordering
+  // For every batch
+  for (int n = 0; n < n_batches; n++)
+  {
+    const T* const in_batch = in + n*in_batch_stride;
+    T* const out_batch = out + n*out_batch_stride;
+
+    // For every row
+    for (int i = 0; i < n_rows; i++)
+    {
+      const T* const in_i = in_batch + i*in_row_stride;
+      T* const out_i = out_batch + i*out_row_stride;
+
+      // For every column, beginning with chunks of 4
+      int j = 0, j_remaining = n_cols;
+#ifdef __arm_any__
+      for (; j_remaining >= 4; j += 4, j_remaining -= 4)
+      {
+        // For every channel, beginning with chunks of 8
+        int c = 0, c_remaining = n_channels;
+        for (; c_remaining >= 8; c += 8, c_remaining -= 8)
+        {
+          // Read 4 columns worth of 8 channels then zip to produce 8 channels
+          // worth of 4 columns.
+          uint16x8_t pixel_channels[4];
+          pixel_channels[0] = vld1q_u16(in_i + (j + 0)*in_col_stride + c);
+          pixel_channels[1] = vld1q_u16(in_i + (j + 1)*in_col_stride + c);
+          pixel_channels[2] = vld1q_u16(in_i + (j + 2)*in_col_stride + c);
+          pixel_channels[3] = vld1q_u16(in_i + (j + 3)*in_col_stride + c);
+
+          const auto zip1 = vzipq_u16(pixel_channels[0], pixel_channels[2]);
+          const auto zip2 = vzipq_u16(pixel_channels[1], pixel_channels[3]);
+          const auto out_0 = vzipq_u16(zip1.val[0], zip2.val[0]);
+          const auto out_1 = vzipq_u16(zip1.val[1], zip2.val[1]);
+
+          // Each half vector now holds one channel's worth of 4 columns
+          vst1_u16(out_i + (c + 0)*out_channel_stride + j, vget_low_u16(out_0.val[0]));
+          vst1_u16(out_i + (c + 1)*out_channel_stride + j, vget_high_u16(out_0.val[0]));
+          vst1_u16(out_i + (c + 2)*out_channel_stride + j, vget_low_u16(out_0.val[1]));
+          vst1_u16(out_i + (c + 3)*out_channel_stride + j, vget_high_u16(out_0.val[1]));
+          vst1_u16(out_i + (c + 4)*out_channel_stride + j, vget_low_u16(out_1.val[0]));
+          vst1_u16(out_i + (c + 5)*out_channel_stride + j, vget_high_u16(out_1.val[0]));
+          vst1_u16(out_i + (c + 6)*out_channel_stride + j, vget_low_u16(out_1.val[1]));
+          vst1_u16(out_i + (c + 7)*out_channel_stride + j, vget_high_u16(out_1.val[1]));
+        }
+        for (; c_remaining >= 4; c += 4, c_remaining -= 4)
+        {
+          // Read 4 columns worth of 4 channels then zip to produce 4 channels
+          // worth of 4 columns.
+          uint16x4_t pixel_channels[4];
+          pixel_channels[0] = vld1_u16(in_i + (j + 0)*in_col_stride + c);
+          pixel_channels[1] = vld1_u16(in_i + (j + 1)*in_col_stride + c);
+          pixel_channels[2] = vld1_u16(in_i + (j + 2)*in_col_stride + c);
+          pixel_channels[3] = vld1_u16(in_i + (j + 3)*in_col_stride + c);
+
+          const auto zip1 = vzip_u16(pixel_channels[0], pixel_channels[2]);
+          const auto zip2 = vzip_u16(pixel_channels[1], pixel_channels[3]);
+          const auto out_0 = vzip_u16(zip1.val[0], zip2.val[0]);
+          const auto out_1 = vzip_u16(zip1.val[1], zip2.val[1]);
+
+          vst1_u16(out_i + (c + 0)*out_channel_stride + j, out_0.val[0]);
+          vst1_u16(out_i + (c + 1)*out_channel_stride + j, out_0.val[1]);
+          vst1_u16(out_i + (c + 2)*out_channel_stride + j, out_1.val[0]);
+          vst1_u16(out_i + (c + 3)*out_channel_stride + j, out_1.val[1]);
+        }
+        for (; c_remaining; c++, c_remaining--)
+        {
+          for (int _j = 0; _j < 4; _j++)
+          {
+            const T* const in_j = in_i + (j + _j)*in_col_stride;
+            T* const out_j = out_i + (j + _j);
+            const T* const in_channel = in_j + c;
+            T* const out_channel = out_j + c*out_channel_stride;
+            *(out_channel) = *(in_channel);
+          }
+        }
+      }
+#endif  // __arm_any__
+      for (; j_remaining; j++, j_remaining--)
+      {
+        const T* const in_j = in_i + j*in_col_stride;
+        T* const out_j = out_i + j;
+
+        for (int c = 0; c < n_channels; c++)
+        {
+          const T* const in_channel = in_j + c;
+          T* const out_channel = out_j + c*out_channel_stride;
+          *(out_channel) = *(in_channel);
+        }
+      }
+    }
+  }
+}
+
+template <>
+inline void nhwc_to_nchw(
+  const int16_t* const in,  // Input data in NHWC form
+  int16_t* const out,       // Output data in NCHW form
+  const int n_batches,
+  const int n_rows,
+  const int n_cols,
+  const int n_channels,
+  int in_batch_stride,
+  int in_row_stride,
+  int in_col_stride,
+  int out_batch_stride,
+  int out_channel_stride,
+  int out_row_stride
+)
+{
+  nhwc_to_nchw(
+    reinterpret_cast<const uint16_t*>(in),
+    reinterpret_cast<uint16_t*>(out),
+    n_batches, n_rows, n_cols, n_channels,
+    in_batch_stride, in_row_stride, in_col_stride,
+    out_batch_stride, out_channel_stride, out_row_stride
+  );
+}
+
 /*****************************************************************************/
 /* Generic implementation : NHWC -> NCHW
  */
@@ -24,111 +24,145 @@
 #ifndef ARM_COMPUTE_TRACEPOINT_H
 #define ARM_COMPUTE_TRACEPOINT_H
 
+#include "support/Mutex.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
 #include <string>
-#include <type_traits>
 #include <vector>
 
 namespace arm_compute
 {
-#ifdef ARM_COMPUTE_TRACING_ENABLED
-#define CREATE_TRACEPOINT(...) TracePoint __tp(__VA_ARGS__)
-
-/** Class used to dump configuration values in functions and kernels  */
-class TracePoint final
+/** Always-on binary ring-buffer trace log
+ *
+ * Records fixed-size events (site id, event type, thread and timestamp) into a
+ * preallocated lock-free ring buffer. Site names live in a string table that
+ * is written once alongside the events and resolved offline, so no string is
+ * formatted on the recording path. The log is activated by setting the
+ * ARM_COMPUTE_TRACE_BUFFER environment variable to the dump path; the binary
+ * trace is written when the process exits, or earlier through @ref dump().
+ * When the variable is not set the only cost at a trace point is a boolean
+ * check, which makes the trace points cheap enough to stay compiled into
+ * release builds.
+ */
+class TraceLog final
 {
 public:
-    /** Layer types */
-    enum class Layer
+    static constexpr unsigned int capacity      = 1u << 16; /**< Number of event slots in the ring buffer; older events get overwritten */
+    static constexpr uint32_t     trace_version = 1;        /**< Version tag of the binary dump format */
+
+    /** Type of a recorded event */
+    enum class EventType : uint8_t
     {
-        CORE,
-        RUNTIME
+        Enter   = 0, /**< A traced scope was entered */
+        Exit    = 1, /**< A traced scope was left */
+        Instant = 2  /**< A point event without duration */
     };
-    /** struct describing the arguments for a tracepoint */
-    struct Args final
+
+    /** One recorded event, dumped verbatim */
+    struct Entry
     {
-        std::vector<std::string> args{};
+        uint64_t  timestamp_ns{ 0 };          /**< Timestamp in nanoseconds */
+        uint32_t  thread_id{ 0 };             /**< Id of the recording thread */
+        uint16_t  site{ 0 };                  /**< Index into the site string table */
+        EventType type{ EventType::Instant }; /**< Type of the event */
+        uint8_t   unused{ 0 };                /**< Explicit padding */
     };
-    /** Constructor
+
+    /** Process-level trace log accessor
+     *
+     * @return Trace log instance
+     */
+    static TraceLog &get();
+    /** True if the trace log has been activated through the environment */
+    static bool is_enabled();
+    /** Current timestamp in nanoseconds */
+    static uint64_t now_ns()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+    /** Register a trace site and return its string table id
      *
-     * @param[in] source     type of layer for the tracepoint
-     * @param[in] class_name the name of the class creating the tracepoint
-     * @param[in] object     a pointer to the actual object owning the tracepoint
-     * @param[in] args       a struct describing all the arguments used in the call to the configure() method
+     * Registering the same name again returns the existing id.
      *
+     * @param[in] name Name of the trace site
+     *
+     * @return Id of the site to pass to @ref record
      */
-    TracePoint(Layer source, const std::string &class_name, void *object, Args &&args);
-    /** Destructor */
-    ~TracePoint();
+    uint16_t register_site(const std::string &name);
+    /** Record one event
+     *
+     * Lock-free; safe to call concurrently from any thread.
+     *
+     * @param[in] site Id of the trace site as returned by @ref register_site
+     * @param[in] type Type of the event
+     */
+    void record(uint16_t site, EventType type);
+    /** Write the string table and the recorded events as a binary trace
+     *
+     * @param[in] filename File to write the trace to
+     */
+    void dump(const std::string &filename) const;
+    /** Discard all recorded events */
+    void clear();
 
 private:
-    static int g_depth; /**< current depth */
-    int        _depth;  /**< tracepoint depth */
+    TraceLog();
+    ~TraceLog();
+
+    std::vector<Entry>              _entries;
+    std::atomic<uint64_t>           _next;
+    std::vector<std::string>        _sites;
+    std::map<std::string, uint16_t> _site_ids;
+    mutable arm_compute::Mutex      _sites_mutex;
 };
 
-/** Operator to write an argument to a @ref TracePoint
- *
- * @param[in] tp  Tracepoint to be used for writing
- * @param[in] arg Argument to be written in the tracepoint
+/** Trace point recording enter and exit events for the enclosing scope
  *
- * @return A referece to the updated tracepoint
+ * Does nothing when the @ref TraceLog is disabled.
  */
-template <typename T>
-TracePoint::Args &&operator<<(typename std::enable_if < !std::is_pointer<T>::value, TracePoint::Args >::type &&tp, const T &arg);
-template <typename T>
-TracePoint::Args &&operator<<(TracePoint::Args &&tp, const T *arg);
-
-#define CONST_REF_CLASS(type)                                             \
-    template <>                                                           \
-    TracePoint::Args &&operator<<(TracePoint::Args &&tp, const type &arg) \
-    {                                                                     \
-        ARM_COMPUTE_UNUSED(tp);                                           \
-        tp.args.push_back(#type "(" + to_string(arg) + ")");              \
-        return std::move(tp);                                             \
-    }
-
-#define CONST_PTR_ADDRESS(type)                                           \
-    template <>                                                           \
-    TracePoint::Args &&operator<<(TracePoint::Args &&tp, const type *arg) \
-    {                                                                     \
-        ARM_COMPUTE_UNUSED(tp);                                           \
-        tp.args.push_back(#type "*(" + to_ptr_string(arg) + ")");         \
-        return std::move(tp);                                             \
+class TracePoint final
+{
+public:
+    /** Constructor
+     *
+     * @param[in] site Id of the trace site as returned by @ref TraceLog::register_site
+     */
+    explicit TracePoint(uint16_t site)
+        : _site(site), _armed(TraceLog::is_enabled())
+    {
+        if(_armed)
+        {
+            TraceLog::get().record(_site, TraceLog::EventType::Enter);
+        }
     }
-#define CONST_PTR_CLASS(type)                                             \
-    template <>                                                           \
-    TracePoint::Args &&operator<<(TracePoint::Args &&tp, const type *arg) \
-    {                                                                     \
-        ARM_COMPUTE_UNUSED(tp);                                           \
-        if(arg)                                                           \
-            tp.args.push_back(#type "(" + to_string(*arg) + ")");         \
-        else                                                              \
-            tp.args.push_back(#type "( nullptr )");                       \
-        return std::move(tp);                                             \
+    /** Destructor */
+    ~TracePoint()
+    {
+        if(_armed)
+        {
+            TraceLog::get().record(_site, TraceLog::EventType::Exit);
+        }
     }
+    TracePoint(const TracePoint &) = delete;
+    TracePoint &operator=(const TracePoint &) = delete;
 
-#define CONST_REF_SIMPLE(type)                                               \
-    template <>                                                              \
-    TracePoint::Args &&operator<<(TracePoint::Args &&tp, const type &arg)    \
-    {                                                                        \
-        ARM_COMPUTE_UNUSED(tp);                                              \
-        tp.args.push_back(#type "(" + support::cpp11::to_string(arg) + ")"); \
-        return std::move(tp);                                                \
-    }
+private:
+    uint16_t _site;
+    bool     _armed;
+};
 
-#define TRACE_TO_STRING(type)              \
-    std::string to_string(const type &arg) \
-    {                                      \
-        ARM_COMPUTE_UNUSED(arg);           \
-        return "";                         \
-    }
-#else /* ARM_COMPUTE_TRACING_ENABLED */
-#define CREATE_TRACEPOINT(...)
-#define CONST_REF_CLASS(type)
-#define CONST_PTR_ADDRESS(type)
-#define CONST_PTR_CLASS(type)
-#define CONST_REF_SIMPLE(type)
-#define TRACE_TO_STRING(type)
-#endif /* ARM_COMPUTE_TRACING_ENABLED */
+/** Place a trace point covering the rest of the enclosing scope
+ *
+ * The site name is registered once on first execution; afterwards the trace
+ * point records two fixed-size ring buffer entries per execution, or performs
+ * a single boolean check when tracing is disabled.
+ */
+#define CREATE_TRACEPOINT(name)                                                                                                    \
+    static const uint16_t __tp_site = arm_compute::TraceLog::is_enabled() ? arm_compute::TraceLog::get().register_site(name) : 0u; \
+    arm_compute::TracePoint __tp(__tp_site)
 } //namespace arm_compute
 
 #endif /* ARM_COMPUTE_TRACEPOINT_H */
@@ -1568,12 +1568,29 @@ public:
     {
         return _enabled;
     }
+    /** Check if reduced-precision transcendental approximations are allowed */
+    bool fast_math() const
+    {
+        return _fast_math;
+    }
+    /** Allow reduced-precision approximations of the transcendental functions (exp/tanh)
+     *
+     * Only affects the exponential-bound activations (LOGISTIC, TANH, SOFT_RELU, ELU);
+     * the relative error of the approximations stays below 1e-3.
+     *
+     * @param[in] fast_math Flag to set
+     */
+    void set_fast_math(bool fast_math)
+    {
+        _fast_math = fast_math;
+    }
 
 private:
-    ActivationFunction _act     = { ActivationLayerInfo::ActivationFunction::IDENTITY };
-    float              _a       = {};
-    float              _b       = {};
-    bool               _enabled = { false };
+    ActivationFunction _act       = { ActivationLayerInfo::ActivationFunction::IDENTITY };
+    float              _a         = {};
+    float              _b         = {};
+    bool               _enabled   = { false };
+    bool               _fast_math = { false };
 };
 
 /** Fully connected layer info */
@@ -1891,6 +1908,7 @@ struct GEMMLowpOutputStageInfo
     float                   gemmlowp_real_multiplier{ 0 };                                /**< GEMMLowp output stage real multiplier used for quantizing to QASYMM8 */
     bool                    is_quantized_per_channel{ false };                            /**< GEMMLowp quantized per-channel flag */
     DataType                output_data_type{ DataType::UNKNOWN };                        /**< Output tensor data type to use if the output is not initialized */
+    ActivationLayerInfo     activation_info{};                                            /**< Activation to fold into the requantization clamp; only the bounded family (RELU, BOUNDED_RELU, LU_BOUNDED_RELU) is supported */
 };
 
 /** GEMM LHS (Left Hand Side) matrix information */
@@ -1942,6 +1960,7 @@ public:
           _retain_internal_weights(false),
           _gemmlowp_output_stage(),
           _fp_mixed_precision(false),
+          _fast_math(false),
           _broadcast_bias(false),
           _pretranpose_B(true),
           _activation_info()
@@ -1973,6 +1992,7 @@ public:
           _retain_internal_weights(retain_internal_weights),
           _gemmlowp_output_stage(gemmlowp_output_stage),
           _fp_mixed_precision(fp_mixed_precision),
+          _fast_math(false),
           _broadcast_bias(broadcast_bias),
           _pretranpose_B(reshape_b_only_on_first_run),
           _activation_info(activation_info)
@@ -2052,6 +2072,22 @@ public:
     {
         return _fp_mixed_precision;
     };
+    /** Flag which specifies if fast math computation is allowed, enabling internal down-conversion of FP32 operands to BFLOAT16.
+     *
+     * @return True if fast math computation is allowed
+     */
+    bool fast_math() const
+    {
+        return _fast_math;
+    };
+    /** Set fast math flag
+     *
+     * @param[in] fast_math Flag to set
+     */
+    void set_fast_math(bool fast_math)
+    {
+        _fast_math = fast_math;
+    }
     /** Flag which specifies whether to broadcast the shape of the bias tensor.
      *
      * @return True if the shape of the bias tensor is to be broadcasted.
@@ -2102,6 +2138,7 @@ private:
     bool                    _retain_internal_weights;
     GEMMLowpOutputStageInfo _gemmlowp_output_stage;
     bool                    _fp_mixed_precision;
+    bool                    _fast_math;
     bool                    _broadcast_bias;
     bool                    _pretranpose_B;
     ActivationLayerInfo     _activation_info;
@@ -266,6 +266,29 @@ public:
      * @return The subwindow "id" out of "total"
      */
     Window split_window(size_t dimension, size_t id, size_t total) const;
+    /** Return the number of tiles needed to cover a dimension with the given tile size
+     *
+     * @param[in] dimension Dimension to tile
+     * @param[in] tile_size Number of elements per tile
+     *
+     * @return The number of tiles, at least 1
+     */
+    size_t num_tiles(size_t dimension, size_t tile_size) const;
+    /** Return one tile of this window along a given dimension
+     *
+     * The tile covers the elements [start + id * tile_size, start + (id + 1) * tile_size)
+     * of the dimension, clamped to the window's end; all other dimensions are unchanged.
+     *
+     * @note @p tile_size must be a multiple of the dimension's step, so that every tile
+     *       boundary falls on a whole iteration.
+     *
+     * @param[in] dimension Dimension along which the tiling is performed
+     * @param[in] id        Id of the tile to return. Must be in the range (0, num_tiles - 1)
+     * @param[in] tile_size Number of elements per tile
+     *
+     * @return The tile "id" of the window
+     */
+    Window tile_window(size_t dimension, size_t id, size_t tile_size) const;
     /** First 1D slice of the window
      *
      * @return The first slice of the window.
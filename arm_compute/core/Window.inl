@@ -231,6 +231,31 @@ inline Window Window::split_window(size_t dimension, size_t id, size_t total) co
     return out;
 }
 
+inline size_t Window::num_tiles(size_t dimension, size_t tile_size) const
+{
+    ARM_COMPUTE_ERROR_ON(dimension >= Coordinates::num_max_dimensions);
+    ARM_COMPUTE_ERROR_ON(tile_size == 0);
+
+    const size_t extent = _dims[dimension].end() - _dims[dimension].start();
+    return std::max<size_t>((extent + tile_size - 1) / tile_size, 1);
+}
+
+inline Window Window::tile_window(size_t dimension, size_t id, size_t tile_size) const
+{
+    ARM_COMPUTE_ERROR_ON(dimension >= Coordinates::num_max_dimensions);
+    ARM_COMPUTE_ERROR_ON(id >= num_tiles(dimension, tile_size));
+    // Tile boundaries must fall on whole iterations
+    ARM_COMPUTE_ERROR_ON((_dims[dimension].step() != 0) && ((tile_size % _dims[dimension].step()) != 0));
+
+    Window out(*this);
+
+    const int start = _dims[dimension].start() + static_cast<int>(id * tile_size);
+    const int end   = std::min(start + static_cast<int>(tile_size), _dims[dimension].end());
+    out.set(dimension, Dimension(start, end, _dims[dimension].step()));
+
+    return out;
+}
+
 template <unsigned int window_dimension>
 inline bool Window::slide_window_slice(Window &slice) const
 {
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_UTILS_HELPERS_PAD_FOLD_H
+#define ARM_COMPUTE_UTILS_HELPERS_PAD_FOLD_H
+
+#include "arm_compute/core/PixelValue.h"
+#include "arm_compute/core/Types.h"
+
+namespace arm_compute
+{
+namespace helpers
+{
+namespace pad_fold
+{
+/** Check if an explicit padding can be folded into the border handling of a convolution
+ *
+ * Folding is possible when the padding value matches the implicit zero of the convolution
+ * borders and the padding is restricted to the spatial dimensions of the given layout.
+ * Quantized data types are excluded as their implicit border zero is represented through
+ * the quantization offset, while an explicit pad inserts the raw value it is given.
+ *
+ * @param[in] padding     Explicit padding applied to each dimension of the input
+ * @param[in] pad_value   Value used to fill the padded area
+ * @param[in] data_type   Data type of the padded tensor
+ * @param[in] data_layout Layout of the padded tensor
+ *
+ * @return True if the padding can be folded into the convolution attributes
+ */
+bool is_foldable_conv_padding(const PaddingList &padding, PixelValue pad_value, DataType data_type, DataLayout data_layout);
+
+/** Fold an explicit spatial padding into the padding attributes of a convolution
+ *
+ * @note The padding must have been validated with @ref is_foldable_conv_padding.
+ *
+ * @param[in] conv_info   Convolution attributes the padding is folded into
+ * @param[in] padding     Explicit padding applied to each dimension of the input
+ * @param[in] data_layout Layout of the padded tensor
+ *
+ * @return Convolution attributes with the explicit padding absorbed
+ */
+PadStrideInfo fold_conv_padding(const PadStrideInfo &conv_info, const PaddingList &padding, DataLayout data_layout);
+} // namespace pad_fold
+} // namespace helpers
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_UTILS_HELPERS_PAD_FOLD_H */
@@ -113,6 +113,29 @@ TensorShape compute_strided_slice_output_shape(TensorShape input_shape, Coordina
                                                int32_t begin_mask = 0, int32_t end_mask = 0, int32_t shrink_axis_mask = 0,
                                                bool return_unshrinked = false);
 
+/** Checks if a strided slice selects a single contiguous block of the input and can therefore alias its memory
+ *
+ * A slice is view-expressible when no axis is shrunk, every stride is 1 and each dimension below the
+ * outermost partially-sliced one covers the full extent of the input. Dimensions above it may select
+ * a single element only, as they merely contribute to the offset of the view.
+ *
+ * @param[in]  input_shape      Input tensor shape
+ * @param[in]  starts           Start coordinates
+ * @param[in]  ends             End coordinates
+ * @param[in]  strides          Slice strides
+ * @param[in]  begin_mask       (Optional) If the ith bit of begin_mask is set, starts[i] is ignored and
+ *                              the fullest possible range in that dimension is used instead.
+ * @param[in]  end_mask         (Optional) If the ith bit of end_mask is set, end[i] is ignored and
+ *                              the fullest possible range in that dimension is used instead.
+ * @param[in]  shrink_axis_mask (Optional) If the ith bit of shrink_axis_mask is set, it implies that the ith specification shrinks the dimensionality by 1.
+ *                              A slice of size 1 starting from starts[i] in the dimension must be preserved.
+ * @param[out] view_start       Absolute start coordinates of the view inside the input, valid only when true is returned
+ *
+ * @return True if the slice can be represented as a view of the input
+ */
+bool slice_is_contiguous_view(TensorShape input_shape, Coordinates starts, Coordinates ends, Coordinates strides,
+                              int32_t begin_mask, int32_t end_mask, int32_t shrink_axis_mask, Coordinates &view_start);
+
 /** Constructs end mask in case we want to perform a slice operation using the strided slice interface
  *
  * @note Ends are inclusive in slice operations that is why construction an end mask is needed
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_MISC_ALLOCATION_GUARD_H
+#define ARM_COMPUTE_MISC_ALLOCATION_GUARD_H
+
+#include <cstddef>
+
+namespace arm_compute
+{
+namespace utils
+{
+/** Scope guard that reports heap allocations happening while it is armed
+ *
+ * Used to verify the zero-allocation steady state of the execution path: the
+ * scheduler and the graph executor arm a guard named after the running kernel
+ * or node, and any global operator new served on the same thread while a guard
+ * is armed is reported on stderr together with that name and counted.
+ *
+ * The interception is only compiled in when the library is built with
+ * ARM_COMPUTE_ALLOC_GUARD defined (debug builds); without it the guard is an
+ * empty object and no global allocation functions are replaced.
+ */
+class ScopedAllocationGuard final
+{
+#if defined(ARM_COMPUTE_ALLOC_GUARD)
+public:
+    /** Arm the guard for the lifetime of the object
+     *
+     * Guards nest; allocations are attributed to the innermost armed guard.
+     *
+     * @param[in] scope Name reported with each detected allocation. Has to outlive the guard
+     */
+    explicit ScopedAllocationGuard(const char *scope);
+    /** Disarm the guard, restoring the enclosing one */
+    ~ScopedAllocationGuard();
+    /** Prevent instances of this class from being copied */
+    ScopedAllocationGuard(const ScopedAllocationGuard &) = delete;
+    /** Prevent instances of this class from being copy assigned */
+    ScopedAllocationGuard &operator=(const ScopedAllocationGuard &) = delete;
+
+private:
+    const char *_previous; /**< Scope of the enclosing guard, restored on destruction */
+#else  /* defined(ARM_COMPUTE_ALLOC_GUARD) */
+public:
+    /** No-op guard of the builds without allocation interception */
+    explicit ScopedAllocationGuard(const char *)
+    {
+    }
+#endif /* defined(ARM_COMPUTE_ALLOC_GUARD) */
+};
+
+/** Number of heap allocations detected while a guard was armed
+ *
+ * @return The process-wide count, always 0 when the interception is not compiled in
+ */
+size_t guarded_allocation_count();
+} // namespace utils
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_MISC_ALLOCATION_GUARD_H */
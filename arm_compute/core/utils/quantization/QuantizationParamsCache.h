@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_QUANTIZATION_PARAMS_CACHE_H
+#define ARM_COMPUTE_QUANTIZATION_PARAMS_CACHE_H
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/QuantizationInfo.h"
+#include "support/Mutex.h"
+
+#include <array>
+#include <map>
+#include <memory>
+#include <tuple>
+#include <utility>
+
+namespace arm_compute
+{
+namespace quantization
+{
+/** Process-level cache of precomputed quantization parameters
+ *
+ * Networks with hundreds of quantized layers repeat the same scale pairs over and over;
+ * this cache stores the fixed-point multiplier decompositions and the 8-bit lookup tables
+ * derived from them so that each distinct parameter set is computed and held once.
+ *
+ * All methods are thread-safe. Returned table references stay valid until @ref clear().
+ */
+class QuantizationParamsCache final
+{
+public:
+    /** Access the process-wide cache
+     *
+     * @return The cache singleton
+     */
+    static QuantizationParamsCache &get();
+    /** Cached equivalent of @ref calculate_quantized_multiplier
+     *
+     * @param[in]  multiplier       Real multiplier to decompose
+     * @param[out] quant_multiplier Fixed-point multiplier
+     * @param[out] shift            Requantization shift
+     * @param[in]  ignore_epsilon   (Optional) When true, assume an exact multiplier of zero for very small values
+     *
+     * @return a status
+     */
+    Status quantized_multiplier(float multiplier, int32_t *quant_multiplier, int32_t *shift, bool ignore_epsilon = false);
+    /** 256-entry dequantization table for an 8-bit asymmetric quantization
+     *
+     * The table is indexed by the 8-bit storage pattern of the quantized value.
+     *
+     * @param[in] qinfo     Quantization info of the values to dequantize
+     * @param[in] is_signed True for QASYMM8_SIGNED values, false for QASYMM8
+     *
+     * @return Table mapping each 8-bit pattern to its dequantized value
+     */
+    const std::array<float, 256> &dequantization_lut(const UniformQuantizationInfo &qinfo, bool is_signed);
+    /** 256-entry requantization table between two 8-bit asymmetric quantizations
+     *
+     * The table is indexed by the 8-bit storage pattern of the source value and holds
+     * the 8-bit storage pattern of the destination value.
+     *
+     * @param[in] src_qinfo Quantization info of the source values
+     * @param[in] dst_qinfo Quantization info of the destination values
+     * @param[in] is_signed True for QASYMM8_SIGNED values, false for QASYMM8
+     *
+     * @return Table mapping each source pattern to the corresponding destination pattern
+     */
+    const std::array<uint8_t, 256> &requantization_lut(const UniformQuantizationInfo &src_qinfo, const UniformQuantizationInfo &dst_qinfo, bool is_signed);
+    /** Number of cached entries across all parameter kinds */
+    size_t num_entries() const;
+    /** Remove all cached entries; invalidates previously returned table references */
+    void clear();
+
+private:
+    /** Default constructor */
+    QuantizationParamsCache() = default;
+
+    using MultiplierKey = std::pair<float, bool>;
+    using LutKey        = std::tuple<float, int32_t, float, int32_t, bool>;
+
+    std::map<MultiplierKey, std::pair<int32_t, int32_t>>      _multipliers{};  /**< Decomposed multipliers keyed by (real multiplier, ignore_epsilon) */
+    std::map<LutKey, std::unique_ptr<std::array<float, 256>>> _dequant_luts{}; /**< Dequantization tables keyed by quantization info */
+    std::map<LutKey, std::unique_ptr<std::array<uint8_t, 256>>> _requant_luts{}; /**< Requantization tables keyed by the quantization info pair */
+    mutable arm_compute::Mutex _mutex{}; /**< Mutex guarding all maps */
+};
+} // namespace quantization
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_QUANTIZATION_PARAMS_CACHE_H */
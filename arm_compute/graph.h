@@ -25,6 +25,7 @@
 #define ARM_COMPUTE_GRAPH_H
 
 // IR
+#include "arm_compute/graph/BatchingExecutor.h"
 #include "arm_compute/graph/Edge.h"
 #include "arm_compute/graph/Graph.h"
 #include "arm_compute/graph/GraphBuilder.h"
@@ -33,6 +34,7 @@
 #include "arm_compute/graph/IGraphPrinter.h"
 #include "arm_compute/graph/INode.h"
 #include "arm_compute/graph/INodeVisitor.h"
+#include "arm_compute/graph/InputPrefetcher.h"
 #include "arm_compute/graph/Logger.h"
 #include "arm_compute/graph/Tensor.h"
 #include "arm_compute/graph/TensorDescriptor.h"
@@ -50,7 +52,9 @@
 // Frontend
 #include "arm_compute/graph/frontend/IStreamOperators.h"
 #include "arm_compute/graph/frontend/Layers.h"
+#include "arm_compute/graph/frontend/ShapeAdaptiveStream.h"
 #include "arm_compute/graph/frontend/Stream.h"
+#include "arm_compute/graph/frontend/StreamPool.h"
 #include "arm_compute/graph/frontend/SubStream.h"
 #include "arm_compute/graph/frontend/Types.h"
 
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_GRAPH_BATCHING_EXECUTOR_H
+#define ARM_COMPUTE_GRAPH_BATCHING_EXECUTOR_H
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/graph/Types.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+// Forward declarations
+class Graph;
+class GraphManager;
+class ITensorHandle;
+
+/** Server-oriented executor that coalesces concurrent single-sample requests into micro-batches.
+ *
+ * Single-sample inference leaves the GEMM M dimension at 1, where the hybrid/gemv kernels deliver a
+ * fraction of peak. This executor sits above @ref GraphManager: the graph is finalized once with its
+ * batch dimension set to the maximum batch size, and concurrent callers submit single samples through
+ * @ref enqueue(). Requests accumulate into the batch tensor until it is full or the oldest request has
+ * waited for the latency budget, then the batched workload runs once and each caller receives its own
+ * output slice. Callers block inside @ref enqueue() for the duration.
+ *
+ * The graph must have exactly one input and one output, with the batch as the fourth dimension sized
+ * to the maximum batch. Input and output samples are exchanged as raw slices of the backend tensors,
+ * so the graph's input node should be created without an accessor (the executor fills the tensor
+ * itself); unused slots of a partial batch are zero-filled.
+ */
+class BatchingExecutor final
+{
+public:
+    /** Constructor
+     *
+     * @param[in] manager        Graph manager that finalized the graph and runs the batched workload
+     * @param[in] graph          Graph to execute, finalized with the batch dimension set to @p max_batch
+     * @param[in] max_batch      Maximum number of requests coalesced into one run
+     * @param[in] latency_budget Longest time a request may wait for the batch to fill before a partial batch runs
+     */
+    BatchingExecutor(GraphManager &manager, Graph &graph, unsigned int max_batch, std::chrono::microseconds latency_budget);
+    /** Destructor: stops the worker and fails any requests still waiting */
+    ~BatchingExecutor();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    BatchingExecutor(const BatchingExecutor &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    BatchingExecutor &operator=(const BatchingExecutor &) = delete;
+
+    /** Locates the graph's input/output tensors and starts the batching worker thread
+     *
+     * @return a status
+     */
+    Status start();
+    /** Stops the worker thread; requests still waiting fail with an error status */
+    void stop();
+    /** Submits one sample and blocks until its batch has executed
+     *
+     * Thread-safe: meant to be called concurrently from one thread per request.
+     *
+     * @param[in]  input       Sample data, laid out as one batch slice of the graph's input tensor
+     * @param[in]  input_size  Size of @p input in bytes, must match the input tensor's batch stride
+     * @param[out] output      Destination for the sample's result, one batch slice of the output tensor
+     * @param[in]  output_size Size of @p output in bytes, must match the output tensor's batch stride
+     *
+     * @return a status
+     */
+    Status enqueue(const void *input, size_t input_size, void *output, size_t output_size);
+
+private:
+    /** One pending request, owned by the stack frame of the caller blocked in enqueue() */
+    struct Request
+    {
+        const void *input;  /**< Sample data to gather into the batch tensor */
+        void       *output; /**< Destination the batch result is scattered to */
+        bool        done;   /**< Set by the worker once the request's batch has executed */
+        Status      status; /**< Outcome reported back to the caller */
+    };
+
+    /** Worker loop: waits for a full batch or an expired latency budget, then runs it */
+    void worker_loop();
+    /** Gathers the requests into the input tensor, runs the graph and scatters the outputs */
+    void execute_batch(const std::vector<Request *> &batch);
+
+    GraphManager             &_manager;
+    Graph                    &_graph;
+    unsigned int              _max_batch;
+    std::chrono::microseconds _latency_budget;
+    ITensorHandle            *_input_handle{ nullptr };
+    ITensorHandle            *_output_handle{ nullptr };
+    size_t                    _input_sample_stride{ 0 };
+    size_t                    _output_sample_stride{ 0 };
+    std::vector<Request *>    _filling{};
+    std::chrono::steady_clock::time_point _oldest_request_time{};
+    std::thread               _worker{};
+    std::mutex                _mutex{};
+    std::condition_variable   _worker_cv{};
+    std::condition_variable   _done_cv{};
+    bool                      _started{ false };
+    bool                      _stop{ false };
+};
+} // namespace graph
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_GRAPH_BATCHING_EXECUTOR_H */
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_GRAPH_CALIBRATION_STATS_H
+#define ARM_COMPUTE_GRAPH_CALIBRATION_STATS_H
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/graph/Types.h"
+
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+
+namespace graph
+{
+// Forward declarations
+class INode;
+
+/** Running value statistics of a single tensor over a calibration run set
+ *
+ * Tracks the minimum and maximum observed value along with a histogram of
+ * absolute values. The histogram range grows by merging adjacent bins
+ * whenever a sample exceeds it, so no prior knowledge of the dynamic range
+ * is needed.
+ */
+class TensorStatistics
+{
+public:
+    static constexpr unsigned int num_bins = 2048; /**< Number of histogram bins */
+
+    /** Default constructor */
+    TensorStatistics();
+    /** Accumulate the values of a tensor into the statistics
+     *
+     * @note Only F32 tensors are profiled; other data types are ignored
+     *
+     * @param[in] tensor Tensor to profile
+     */
+    void update(const ITensor &tensor);
+    /** Minimum observed value */
+    float minimum() const;
+    /** Maximum observed value */
+    float maximum() const;
+    /** Number of accumulated samples */
+    uint64_t num_samples() const;
+    /** Histogram of absolute values over [0, histogram_range()) */
+    const std::vector<uint64_t> &histogram() const;
+    /** Upper bound of the histogram range */
+    float histogram_range() const;
+    /** Derive quantization parameters from the observed value distribution
+     *
+     * @param[in] data_type      Quantized data type to derive parameters for
+     * @param[in] clipping_ratio (Optional) Fraction of the samples the quantized range must cover.
+     *                           Values below 1 clip outliers using the histogram. Defaults to 1 (use the full observed range)
+     *
+     * @return Quantization parameters covering the requested fraction of the observed values
+     */
+    QuantizationInfo quantization_info(DataType data_type, float clipping_ratio = 1.f) const;
+
+private:
+    /** Smallest absolute bound that still covers the requested fraction of the samples */
+    float clipped_abs_bound(float clipping_ratio) const;
+
+    float                 _min;
+    float                 _max;
+    uint64_t              _count;
+    float                 _range;
+    std::vector<uint64_t> _histogram;
+};
+
+/** Per-tensor calibration statistics of a graph
+ *
+ * Populated by @ref GraphManager while executing a graph with
+ * @ref GraphConfig::use_calibration set. Once the calibration run set has been
+ * processed, @ref quantization_table() emits the quantization parameters of
+ * every profiled tensor, keyed by the name of the producing node, ready to be
+ * fed back to the graph builder of the quantized deployment graph.
+ */
+class CalibrationTable
+{
+public:
+    /** Record the current contents of all output tensors of a node
+     *
+     * @param[in] node Node whose outputs to profile
+     */
+    void update(INode &node);
+    /** Statistics of a given tensor
+     *
+     * @param[in] id Tensor to look up
+     *
+     * @return Statistics of the tensor if profiled else nullptr
+     */
+    const TensorStatistics *statistics(TensorID id) const;
+    /** True if no tensor has been profiled yet */
+    bool empty() const;
+    /** Emit the quantization parameters of all profiled tensors
+     *
+     * @param[in] data_type      Quantized data type to derive parameters for
+     * @param[in] clipping_ratio (Optional) Fraction of the samples the quantized range must cover. Defaults to 1
+     *
+     * @return Quantization parameters keyed by producing node name
+     */
+    std::map<std::string, QuantizationInfo> quantization_table(DataType data_type, float clipping_ratio = 1.f) const;
+    /** Write the quantization table as one "name scale offset" line per tensor
+     *
+     * @param[out] stream         Stream to write to
+     * @param[in]  data_type      Quantized data type to derive parameters for
+     * @param[in]  clipping_ratio (Optional) Fraction of the samples the quantized range must cover. Defaults to 1
+     */
+    void save(std::ostream &stream, DataType data_type, float clipping_ratio = 1.f) const;
+
+private:
+    struct Entry
+    {
+        std::string      producer{};
+        TensorStatistics stats{};
+    };
+    std::map<TensorID, Entry> _entries{};
+};
+} // namespace graph
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_GRAPH_CALIBRATION_STATS_H */
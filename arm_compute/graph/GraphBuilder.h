@@ -138,6 +138,7 @@ public:
      * @param[in] bias_accessor         (Optional) Accessor of the bias node data
      * @param[in] weights_quant_info    (Optional) Weights quantization info
      * @param[in] out_quant_info        (Optional) Output quantization info
+     * @param[in] dilation              (Optional) Dilation, in elements, across x and y. Defaults to 1
      *
      * @return Node ID of the created node, EmptyNodeID in case of error
      */
@@ -146,7 +147,8 @@ public:
                                        ConvolutionMethod method = ConvolutionMethod::Default, FastMathHint fast_math_hint = FastMathHint::Disabled,
                                        ITensorAccessorUPtr weights_accessor = nullptr, ITensorAccessorUPtr bias_accessor = nullptr,
                                        const QuantizationInfo &weights_quant_info = QuantizationInfo(),
-                                       const QuantizationInfo &out_quant_info     = QuantizationInfo());
+                                       const QuantizationInfo &out_quant_info     = QuantizationInfo(),
+                                       const Size2D           &dilation           = Size2D(1U, 1U));
     /** Adds a deconvolution layer node to the graph
      *
      * @param[in] g                     Graph to add the node to
@@ -510,6 +512,25 @@ public:
      * @return Node ID of the created node, EmptyNodeID in case of error
      */
     static NodeID add_stack_node(Graph &g, NodeParams params, const std::vector<NodeIdxPair> &inputs, int axis);
+    /** Adds a streaming convolution layer node to the graph
+     *
+     * @param[in] g                     Graph to add the node to
+     * @param[in] params                Common node parameters
+     * @param[in] input                 Input to the streaming convolution layer node as a NodeID-Index pair, holding only the new frames of the window
+     * @param[in] kernel_spatial_extend Spatial extend of convolution kernels
+     * @param[in] depth                 Number of convolution kernels
+     * @param[in] conv_info             Convolution layer information
+     * @param[in] window_width          Width of the sliding window, in elements, along the time axis
+     * @param[in] fast_math_hint        (Optional) Fast math hint
+     * @param[in] weights_accessor      (Optional) Accessor of the weights node data
+     * @param[in] bias_accessor         (Optional) Accessor of the bias node data
+     *
+     * @return Node ID of the created node, EmptyNodeID in case of error
+     */
+    static NodeID add_streaming_convolution_node(Graph &g, NodeParams params, NodeIdxPair input,
+                                                 Size2D kernel_spatial_extend, unsigned int depth, PadStrideInfo conv_info, unsigned int window_width,
+                                                 FastMathHint fast_math_hint = FastMathHint::Disabled,
+                                                 ITensorAccessorUPtr weights_accessor = nullptr, ITensorAccessorUPtr bias_accessor = nullptr);
     /** Adds an upsample layer to the graph
      *
      * @param[in] g                 Graph to add the node to
@@ -27,6 +27,7 @@
 #include "arm_compute/graph/Types.h"
 
 #include "arm_compute/runtime/IMemoryManager.h"
+#include "arm_compute/runtime/IRuntimeContext.h"
 #include "arm_compute/runtime/IWeightsManager.h"
 
 #include <map>
@@ -44,6 +45,7 @@ struct MemoryManagerContext
     std::shared_ptr<arm_compute::IMemoryManager> cross_mm    = { nullptr };             /**< Cross-function memory manager */
     std::shared_ptr<arm_compute::IMemoryGroup>   cross_group = { nullptr };             /**< Cross-function memory group */
     IAllocator                                  *allocator   = { nullptr };             /**< Backend allocator to use */
+    bool                                         intra_scratch_shared = { false };      /**< True if function scratch was folded into the cross-layer analysis, leaving the intra manager without pools */
 };
 
 /** Contains structs required for weights management */
@@ -81,6 +83,20 @@ public:
      * @param[in] config Configuration to use
      */
     void set_config(const GraphConfig &config);
+    /** Sets the runtime context to be used by the graph
+     *
+     * @note Attaching a different runtime context (thus a different scheduler) to each graph
+     *       allows multiple graphs to execute concurrently without contending on the
+     *       process-wide scheduler singleton.
+     *
+     * @param[in] ctx Runtime context to use (not owned, can be nullptr to fall back to the singleton flow)
+     */
+    void set_runtime_context(arm_compute::IRuntimeContext *ctx);
+    /** Runtime context accessor
+     *
+     * @return The runtime context registered to the graph context (can be nullptr)
+     */
+    arm_compute::IRuntimeContext *runtime_context() const;
     /** Inserts a memory manager context
      *
      * @param[in] memory_ctx Memory manage context
@@ -126,6 +142,7 @@ public:
 
 private:
     GraphConfig _config;                                       /**< Graph configuration */
+    arm_compute::IRuntimeContext           *_runtime_ctx;      /**< Runtime context to be used by the graph (not owned) */
     std::map<Target, MemoryManagerContext>  _memory_managers;  /**< Memory managers for each target */
     std::map<Target, WeightsManagerContext> _weights_managers; /**< Weights managers for each target */
 };
@@ -24,9 +24,12 @@
 #ifndef ARM_COMPUTE_GRAPH_GRAPH_MANAGER_H
 #define ARM_COMPUTE_GRAPH_GRAPH_MANAGER_H
 
+#include "arm_compute/graph/CalibrationStats.h"
 #include "arm_compute/graph/Types.h"
 #include "arm_compute/graph/Workload.h"
 
+#include "support/Mutex.h"
+
 #include <map>
 
 namespace arm_compute
@@ -41,6 +44,10 @@ class PassManager;
 /** Graph manager class
  *
  * Manages a list of graphs along with their resources
+ *
+ * Distinct graphs may be finalized and executed concurrently, e.g. a background thread
+ * pre-configuring a workload while the caller executes another; operations on one graph
+ * still have to be serialized by the caller.
  */
 class GraphManager final
 {
@@ -77,9 +84,62 @@ public:
      * @param[in] graph Graph to invalidate
      */
     void invalidate_graph(Graph &graph);
+    /** Calibration statistics collected for a graph
+     *
+     * Populated while executing a graph with @ref GraphConfig::use_calibration set.
+     *
+     * @param[in] graph Graph to look up
+     *
+     * @return Calibration table of the graph if any statistics have been collected else nullptr
+     */
+    const CalibrationTable *calibration_table(const Graph &graph) const;
+    /** Per-node execution times collected for a graph
+     *
+     * Populated while executing a graph with @ref GraphConfig::use_node_time_profiling set.
+     *
+     * @param[in] graph Graph to look up
+     *
+     * @return Execution times of the graph's nodes if any have been collected else nullptr
+     */
+    const std::map<NodeID, NodeExecutionTime> *node_timings(const Graph &graph) const;
+    /** Sets a per-frame execution-time budget for a graph
+     *
+     * Subsequent @ref execute_graph calls run the graph's tasks sequentially and timed; when a
+     * frame is projected to overrun the budget, @p hook is consulted for each remaining task and
+     * may skip it for that frame (see @ref DegradationHook). The first budgeted frame primes the
+     * per-task time estimates and always runs in full. The calibration and node-time-profiling
+     * modes take precedence over the budget.
+     *
+     * @param[in] graph     Graph to budget. Must be finalized.
+     * @param[in] budget_ns Frame budget in nanoseconds
+     * @param[in] hook      (Optional) Hook deciding which tasks may be shed; without one the
+     *                      budget only collects the per-task times and never degrades
+     */
+    void set_execution_budget(const Graph &graph, uint64_t budget_ns, DegradationHook hook = nullptr);
+    /** Execution budget state of a graph
+     *
+     * @param[in] graph Graph to look up
+     *
+     * @return Budget state of the graph if one has been set else nullptr
+     */
+    const ExecutionBudget *execution_budget(const Graph &graph) const;
+    /** Startup phase attribution collected for a graph
+     *
+     * Populated while finalizing a graph with @ref GraphConfig::use_startup_profiling set.
+     *
+     * @param[in] graph Graph to look up
+     *
+     * @return Startup profile of the graph if one has been collected else nullptr
+     */
+    const StartupProfile *startup_profile(const Graph &graph) const;
 
 private:
-    std::map<GraphID, ExecutionWorkload> _workloads = {}; /**< Graph workloads */
+    mutable arm_compute::Mutex           _mtx = {};                /**< Mutex guarding the workloads map */
+    std::map<GraphID, ExecutionWorkload> _workloads = {};          /**< Graph workloads */
+    std::map<GraphID, CalibrationTable>  _calibration_tables = {}; /**< Calibration statistics of graphs executed in calibration mode */
+    std::map<GraphID, std::map<NodeID, NodeExecutionTime>> _node_timings = {}; /**< Execution times of graphs executed with node time profiling */
+    std::map<GraphID, StartupProfile> _startup_profiles = {}; /**< Startup phase attribution of graphs finalized with startup profiling */
+    std::map<GraphID, ExecutionBudget> _budgets = {}; /**< Per-frame execution-time budgets of graphs executed with deadline enforcement */
 };
 } // namespace graph
 } // namespace arm_compute
@@ -66,6 +66,11 @@ public:
      * @param[in] n Node to visit.
      */
     virtual void visit(ConvolutionLayerNode &n) = 0;
+    /** Visit DepthConvertLayerNode.
+     *
+     * @param[in] n Node to visit.
+     */
+    virtual void visit(DepthConvertLayerNode &n) = 0;
     /** Visit DepthwiseConvolutionLayerNode.
      *
      * @param[in] n Node to visit.
@@ -227,6 +232,10 @@ public:
     {
         default_visit();
     }
+    virtual void visit(DepthConvertLayerNode &) override
+    {
+        default_visit();
+    }
     virtual void visit(DepthwiseConvolutionLayerNode &) override
     {
         default_visit();
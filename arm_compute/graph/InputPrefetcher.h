@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_GRAPH_INPUT_PREFETCHER_H
+#define ARM_COMPUTE_GRAPH_INPUT_PREFETCHER_H
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/graph/Types.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+// Forward declarations
+class Graph;
+class ITensorAccessor;
+class Tensor;
+
+/** Pipeline stage that runs a graph's input accessors ahead of execution on an I/O thread.
+ *
+ * Input accessors that read from storage (image decoders, validation data loaders) serialize their
+ * latency with the compute of every frame: @ref GraphManager::execute_graph first waits for the
+ * accessor, then runs the workload. The prefetcher takes over the accessors of the graph's input
+ * nodes and runs them on its own thread into a queue of host-side staging copies, up to @p depth
+ * frames ahead. The accessor it installs in their place only copies the oldest staged frame into
+ * the backend tensor, so execution starts immediately and storage latency is hidden behind the
+ * compute of the preceding frames.
+ *
+ * The graph has to be finalized before the prefetcher is started, and the caller keeps driving it
+ * through @ref GraphManager::execute_graph as usual. End of stream is propagated: once an original
+ * accessor reports no more data, execution consumes the remaining staged frames and then stops the
+ * way it would without the prefetcher. Stopping the prefetcher hands the original accessors back.
+ */
+class InputPrefetcher final
+{
+public:
+    /** Constructor
+     *
+     * @param[in] graph Graph whose input accessors to run ahead. Must be finalized.
+     * @param[in] depth Number of frames staged ahead of execution per input
+     */
+    InputPrefetcher(Graph &graph, unsigned int depth);
+    /** Destructor: stops the worker and hands the original accessors back */
+    ~InputPrefetcher();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    InputPrefetcher(const InputPrefetcher &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    InputPrefetcher &operator=(const InputPrefetcher &) = delete;
+
+    /** Takes over the graph's input accessors, allocates the staging copies and starts the I/O thread
+     *
+     * @return a status
+     */
+    Status start();
+    /** Stops the I/O thread and restores the original input accessors */
+    void stop();
+
+private:
+    // Accessor installed on the graph's input tensors, copies the oldest staged frame in
+    class PrefetchAccessor;
+
+    /** One input node whose accessor runs on the I/O thread */
+    struct InputStream
+    {
+        Tensor                                            *tensor   = { nullptr }; /**< Graph tensor whose accessor was taken over */
+        std::unique_ptr<ITensorAccessor>                   accessor = {};          /**< Original accessor, run on the I/O thread */
+        std::vector<std::unique_ptr<arm_compute::Tensor>>  staging  = {};          /**< Host staging copies, one per in-flight frame */
+        uint64_t                                           consumed = { 0 };       /**< Frames of this stream already copied into the backend tensor */
+    };
+
+    /** I/O thread loop: stages frames while a slot is free, stops at end of stream */
+    void worker_loop();
+    /** Oldest frame not yet consumed by every stream, called with the lock held */
+    uint64_t oldest_consumed() const;
+
+    Graph                   &_graph;
+    unsigned int             _depth;
+    std::vector<InputStream> _streams  = {};
+    std::thread              _worker   = {};
+    std::mutex               _mutex    = {};
+    std::condition_variable  _slot_free   = {}; /**< Signalled when a staging slot is consumed */
+    std::condition_variable  _frame_ready = {}; /**< Signalled when a frame has been staged */
+    uint64_t                 _produced = { 0 };
+    bool                     _eos      = { false };
+    bool                     _stop     = { false };
+    bool                     _started  = { false };
+};
+} // namespace graph
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_GRAPH_INPUT_PREFETCHER_H */
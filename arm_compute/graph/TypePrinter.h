@@ -92,6 +92,9 @@ inline ::std::ostream &operator<<(::std::ostream &os, const NodeType &node_type)
         case NodeType::DetectionPostProcessLayer:
             os << "DetectionPostProcessLayer";
             break;
+        case NodeType::DepthConvertLayer:
+            os << "DepthConvertLayer";
+            break;
         case NodeType::DepthwiseConvolutionLayer:
             os << "DepthwiseConvolutionLayer";
             break;
@@ -167,6 +170,12 @@ inline ::std::ostream &operator<<(::std::ostream &os, const NodeType &node_type)
         case NodeType::StackLayer:
             os << "StackLayer";
             break;
+        case NodeType::StreamingConvolutionLayer:
+            os << "StreamingConvolutionLayer";
+            break;
+        case NodeType::TransitionLayer:
+            os << "TransitionLayer";
+            break;
         case NodeType::UpsampleLayer:
             os << "UpsampleLayer";
             break;
@@ -28,6 +28,7 @@
 #include "arm_compute/core/PixelValue.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/CL/CLTunerTypes.h"
+#include "arm_compute/runtime/Types.h"
 
 #include <limits>
 #include <string>
@@ -36,6 +37,7 @@ namespace arm_compute
 {
 namespace graph
 {
+using arm_compute::AllocationPolicy;
 using arm_compute::CLTunerMode;
 using arm_compute::Status;
 
@@ -84,9 +86,29 @@ struct GraphConfig
     bool        use_transition_memory_manager{ true }; /**< Use a memory manager to manager transition buffer memory */
     bool        use_tuner{ false };                    /**< Use a tuner in tunable backends */
     bool        convert_to_uint8{ false };             /**< Convert graph to a synthetic uint8 graph */
+    bool        convert_to_bfloat16{ false };          /**< Convert eligible FP32 subgraphs to BFLOAT16 storage, inserting boundary conversion nodes. NEON only */
+    bool        use_layout_optimization{ false };      /**< Select per-region data layouts from kernel preferences, inserting the minimal set of permute nodes at region boundaries. NEON only */
+    bool        use_parallel_dispatch{ false };        /**< Run independent branches of the workload concurrently (dependency-aware task dispatch) */
+    bool        use_heterogeneous_placement{ false };  /**< Split the graph across the NEON and CL backends by estimated cost, inserting transition copies at the boundaries */
+    bool        use_cooperative_split{ false };        /**< Split the output rows of large convolutions in two so heterogeneous placement can run the halves on both backends concurrently. Requires use_heterogeneous_placement */
+    bool        use_pipelined_execution{ false };      /**< Cut the graph into two stages with double-buffered boundary tensors and overlap consecutive frames */
+    bool        use_sibling_grouping{ false };         /**< Reorder tasks so sibling consumers of one tensor run back-to-back while it is still cache-resident */
+    bool        use_shared_const_tensors{ false };     /**< Deduplicate identical const tensor contents across graphs through the process-level store */
+    bool        use_calibration{ false };              /**< Record per-tensor value statistics while executing, to derive quantization parameters from a calibration run set */
+    bool        use_node_time_profiling{ false };      /**< Record per-node execution times while executing, consumed by the roofline report printer */
+    bool        use_startup_profiling{ false };        /**< Record per-function validate/configure/prepare and allocation times while finalizing, consumed by the startup profile printer */
+    bool        use_shared_function_scratch{ false };  /**< Let function-internal scratch join the cross-layer lifetime analysis instead of using a separate pool; requires the function and transition memory managers and sequential execution */
+    bool        use_deferred_validation{ false };      /**< Skip node re-validation of topologies that already validated successfully in this process or in the topology cache file; first-time topologies are always validated */
+    bool        use_dry_run{ false };                  /**< Finalize without allocating memory or loading constant data: nodes are validated and configured only, leaving output shapes and the lifetime managers' memory requirements available for inspection. The graph is not registered for execution */
+    bool        use_activation_recompute{ false };     /**< Recompute long-lived activations at their far consumers instead of keeping them resident, trading FLOPs for peak transition memory */
+    unsigned int recompute_span_threshold{ 12 };       /**< Minimum producer-to-consumer topological span for an activation to be recomputed. Requires use_activation_recompute */
+    unsigned int recompute_max_depth{ 4 };             /**< Maximum number of nodes cloned per recompute chain. Requires use_activation_recompute */
     CLTunerMode tuner_mode{ CLTunerMode::EXHAUSTIVE }; /**< Tuner mode to be used by the CL tuner */
+    AllocationPolicy allocation_policy{ AllocationPolicy::Lazy }; /**< Page commitment policy for CPU tensor allocations, trades startup time for deterministic first-frame latency */
     int         num_threads{ -1 };                     /**< Number of threads to use (thread capable backends), if 0 the backend will auto-initialize, if -1 the backend will stay as it is. */
     std::string tuner_file{ "acl_tuner.csv" };         /**< File to load/store tuning values from */
+    std::string weights_cache_file{};                  /**< File to reload transformed weights from on warm starts, written after the first finalize. Empty disables the cache */
+    std::string topology_cache_file{};                 /**< File tracking topology hashes that finalized successfully before, used to skip backend validation on warm starts. Empty disables the cache */
 };
 
 /**< Device target types */
@@ -146,6 +168,7 @@ enum class NodeType
     ConcatenateLayer,
     ConvolutionLayer,
     DeconvolutionLayer,
+    DepthConvertLayer,
     DepthwiseConvolutionLayer,
     DequantizationLayer,
     DetectionOutputLayer,
@@ -173,6 +196,8 @@ enum class NodeType
     SliceLayer,
     SplitLayer,
     StackLayer,
+    StreamingConvolutionLayer,
+    TransitionLayer,
     UpsampleLayer,
     UnaryEltwiseLayer,
     YOLOLayer,
@@ -123,6 +123,17 @@ size_t get_dimension_size(const TensorDescriptor &descriptor, const DataLayoutDi
  * @return Idx of given dimension
  */
 size_t get_dimension_idx(DataLayout data_layout, const DataLayoutDimension data_layout_dimension);
+/** Computes a content hash of the graph topology
+ *
+ * The hash covers the nodes (type, assigned target and output descriptors) and the edges
+ * connecting them, so structurally identical graphs built in different processes hash to
+ * the same value.
+ *
+ * @param[in] g Graph to hash
+ *
+ * @return Topology hash
+ */
+uint64_t compute_topology_hash(const Graph &g);
 /** Get the list of driving nodes of a given node
  *
  * @param[in] node Node to find the driving node of
@@ -130,6 +141,23 @@ size_t get_dimension_idx(DataLayout data_layout, const DataLayoutDimension data_
  * @return A list with the driving node of a given node
  */
 std::vector<NodeIdxPair> get_driving_nodes(const INode &node);
+/** Estimates the operations a node executes, derived from its tensor shapes
+ *
+ * Multiply-accumulate counts as two operations. Nodes without a dedicated
+ * estimate are approximated with one operation per output element.
+ *
+ * @param[in] node Node to estimate
+ *
+ * @return Estimated operation count
+ */
+uint64_t estimate_node_ops(const INode &node);
+/** Estimates the bytes a node moves, assuming each input and output is streamed once
+ *
+ * @param[in] node Node to estimate
+ *
+ * @return Estimated byte count
+ */
+uint64_t estimate_node_bytes(const INode &node);
 /** Configures tensor
  *
  * @param[in, out] tensor Tensor to configure
@@ -30,7 +30,10 @@
 #include "arm_compute/runtime/IMemoryGroup.h"
 
 #include <functional>
+#include <map>
 #include <memory>
+#include <string>
+#include <utility>
 #include <vector>
 
 namespace arm_compute
@@ -94,6 +97,68 @@ struct ExecutionTask
     void prepare();
 };
 
+/** Accumulated wall time of a node's task over the profiled runs */
+struct NodeExecutionTime
+{
+    uint64_t total_ns = { 0 }; /**< Accumulated execution time in nanoseconds */
+    uint64_t runs     = { 0 }; /**< Number of profiled runs */
+};
+
+/** Time spent in the startup phases of a node's function */
+struct NodeStartupTime
+{
+    uint64_t validate_ns  = { 0 }; /**< Time spent validating the node's configuration */
+    uint64_t configure_ns = { 0 }; /**< Time spent instantiating and configuring the backend function */
+    uint64_t prepare_ns   = { 0 }; /**< Time spent preparing the function, i.e. in its weight transforms */
+};
+
+/** Decision hook invoked when the frame budget is projected to overrun
+ *
+ * Called per remaining task while a budgeted execution is projected past its deadline. The first
+ * parameter is the node whose task is about to run, the second the projected overrun in
+ * nanoseconds. Returning true skips the node's task for this frame (its output keeps the previous
+ * frame's content), trading quality for meeting the deadline.
+ */
+using DegradationHook = std::function<bool(const INode &node, uint64_t projected_overrun_ns)>;
+
+/** Per-frame execution-time budget of a graph and the state needed to enforce it */
+struct ExecutionBudget
+{
+    uint64_t              budget_ns     = { 0 };  /**< Frame budget in nanoseconds */
+    DegradationHook       hook          = {};     /**< Hook consulted before skipping a task; without one no task is ever skipped */
+    std::vector<uint64_t> avg_task_ns   = {};     /**< Smoothed measured time of each task, indexed as the workload's tasks */
+    uint64_t              frames        = { 0 };  /**< Number of budgeted frames executed */
+    uint64_t              degraded      = { 0 };  /**< Number of frames in which at least one task was skipped */
+    uint64_t              skipped_tasks = { 0 };  /**< Total tasks skipped across all frames */
+};
+
+/** Startup phase attribution of a graph, collected while finalizing */
+struct StartupProfile
+{
+    std::map<NodeID, NodeStartupTime> nodes = {}; /**< Per-node phase times */
+
+    uint64_t validate_total_ns   = { 0 }; /**< Total time spent in backend validation */
+    uint64_t configure_total_ns  = { 0 }; /**< Total time spent configuring functions */
+    uint64_t allocation_total_ns = { 0 }; /**< Total time spent allocating tensor memory */
+    uint64_t prepare_total_ns    = { 0 }; /**< Total time spent preparing functions */
+};
+
+/** Cached dispatch state of a workload's tasks
+ *
+ * Built on the first run and reused on every subsequent frame, so steady-state execution
+ * does not rebuild the dependency structure or reallocate its storage.
+ */
+struct TaskSchedule
+{
+    bool                                   valid           = { false }; /**< True once the schedule has been built */
+    std::vector<std::vector<unsigned int>> successors      = {};        /**< Per-task list of the tasks consuming its outputs */
+    std::vector<unsigned int>              initial_pending = {};        /**< Number of producing tasks of each task */
+    std::vector<unsigned int>              initial_ready   = {};        /**< Tasks without producers, seeding each frame */
+    std::vector<unsigned int>              pending         = {};        /**< Per-frame remaining-producer counts, reset from @ref initial_pending */
+    std::vector<unsigned int>              ready           = {};        /**< Per-frame ready queue, reset from @ref initial_ready */
+    std::vector<std::string>               scopes          = {};        /**< Node name of each task, labelling its allocation guard */
+};
+
 /** Execution workload */
 struct ExecutionWorkload
 {
@@ -102,6 +167,9 @@ struct ExecutionWorkload
     std::vector<ExecutionTask> tasks   = {};          /**< Execution workload */
     Graph                     *graph   = { nullptr }; /**< Graph bound to the workload */
     GraphContext              *ctx     = { nullptr }; /**< Graph execution context */
+    std::vector<unsigned int>  pipeline_stage = {};   /**< Pipeline stage of each task (0 early, 1 late, 2 boundary copy); empty when execution is not pipelined */
+    std::map<NodeID, std::pair<size_t, size_t>> scratch_windows = {}; /**< Intra lifetime serial window of each node's configuration; only populated when function scratch joins the cross-layer analysis */
+    TaskSchedule               schedule = {};      /**< Cached dispatch state, built on the first run */
 };
 } // namespace graph
 } // namespace arm_compute
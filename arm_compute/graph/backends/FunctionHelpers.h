@@ -450,15 +450,18 @@ std::unique_ptr<IFunction> create_convolution_layer(ConvolutionLayerNode &node,
     const ConvolutionMethod   conv_algorithm = node.convolution_method();
     const bool                fast_math      = node.fast_math_hint() == FastMathHint::Enabled;
     const ActivationLayerInfo fused_act      = node.fused_activation();
+    const Size2D              dilation       = node.dilation();
 
     // Create and configure function (we assume that functions have been validated before creation)
-    std::shared_ptr<IMemoryManager> mm = get_memory_manager(ctx, TargetInfo::TargetType);
-    std::unique_ptr<IFunction>      func;
-    std::string                     func_name;
+    std::shared_ptr<IMemoryManager>  mm = get_memory_manager(ctx, TargetInfo::TargetType);
+    std::shared_ptr<IWeightsManager> wm = get_weights_manager(ctx, TargetInfo::TargetType);
+    std::unique_ptr<IFunction>       func;
+    std::string                      func_name;
 
     if(conv_algorithm == ConvolutionMethod::Winograd)
     {
         ARM_COMPUTE_ERROR_ON_MSG(num_groups != 1, "WinogradConvolutionLayer does not support grouping!");
+        ARM_COMPUTE_ERROR_ON_MSG(dilation != Size2D(1U, 1U), "WinogradConvolutionLayer does not support dilation!");
         std::tie(func, func_name) = create_named_memory_managed_function<typename ConvolutionLayerFunctions::WinogradConvolutionLayer>(
                                         std::string("WinogradConvolutionLayer"), mm,
                                         input, weights, biases, output, conv_info, fused_act, fast_math);
@@ -466,23 +469,24 @@ std::unique_ptr<IFunction> create_convolution_layer(ConvolutionLayerNode &node,
     else if(conv_algorithm == ConvolutionMethod::Direct)
     {
         ARM_COMPUTE_ERROR_ON_MSG(num_groups != 1, "DirectConvolutionLayer does not support grouping!");
+        ARM_COMPUTE_ERROR_ON_MSG(dilation != Size2D(1U, 1U), "DirectConvolutionLayer does not support dilation!");
         std::tie(func, func_name) = create_named_function<typename ConvolutionLayerFunctions::DirectConvolutionLayer>(
                                         std::string("DirectConvolutionLayer"),
                                         input, weights, biases, output, conv_info, fused_act);
     }
     else if(conv_algorithm == ConvolutionMethod::GEMM)
     {
-        std::tie(func, func_name) = create_named_memory_managed_function<typename ConvolutionLayerFunctions::GEMMConvolutionLayer>(
-                                        std::string("GEMMConvolutionLayer"), mm,
+        std::tie(func, func_name) = create_named_weights_managed_function<typename ConvolutionLayerFunctions::GEMMConvolutionLayer>(
+                                        std::string("GEMMConvolutionLayer"), mm, wm.get(),
                                         input, weights, biases, output, conv_info,
-                                        WeightsInfo(), Size2D(1U, 1U), fused_act, num_groups);
+                                        WeightsInfo(), dilation, fused_act, num_groups);
     }
     else
     {
-        std::tie(func, func_name) = create_named_memory_managed_function<typename ConvolutionLayerFunctions::GenericConvolutionLayer>(
-                                        std::string("GenericConvolutionLayer"), mm,
+        std::tie(func, func_name) = create_named_weights_managed_function<typename ConvolutionLayerFunctions::GenericConvolutionLayer>(
+                                        std::string("GenericConvolutionLayer"), mm, wm.get(),
                                         input, weights, biases, output, conv_info,
-                                        WeightsInfo(), Size2D(1U, 1U), fused_act, fast_math, num_groups);
+                                        WeightsInfo(), dilation, fused_act, fast_math, num_groups);
     }
 
     // Log info
@@ -614,6 +618,45 @@ std::unique_ptr<IFunction> create_depthwise_convolution_layer(DepthwiseConvoluti
     return RETURN_UNIQUE_PTR(func);
 }
 
+/** Create a backend depth convert layer function
+ *
+ * @tparam DepthConvertLayerFunction Backend depth convert function
+ * @tparam TargetInfo                Target-specific information
+ *
+ * @param[in] node Node to create the backend function for
+ *
+ * @return Backend depth convert layer function
+ */
+template <typename DepthConvertLayerFunction, typename TargetInfo>
+std::unique_ptr<IFunction> create_depth_convert_layer(DepthConvertLayerNode &node)
+{
+    validate_node<TargetInfo>(node, 1 /* expected inputs */, 1 /* expected outputs */);
+
+    // Extract IO and info
+    typename TargetInfo::TensorType *input  = get_backing_tensor<TargetInfo>(node.input(0));
+    typename TargetInfo::TensorType *output = get_backing_tensor<TargetInfo>(node.output(0));
+
+    ARM_COMPUTE_ERROR_ON(input == nullptr);
+    ARM_COMPUTE_ERROR_ON(output == nullptr);
+
+    // Create and configure function
+    auto func = support::cpp14::make_unique<DepthConvertLayerFunction>();
+    func->configure(input, output, node.policy(), 0);
+
+    // Log info
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated "
+                               << node.name()
+                               << " Type: " << node.type()
+                               << " Target: " << TargetInfo::TargetType
+                               << " Data Type: " << input->info()->data_type()
+                               << " Output data type: " << output->info()->data_type()
+                               << " Input shape: " << input->info()->tensor_shape()
+                               << " Output shape: " << output->info()->tensor_shape()
+                               << std::endl);
+
+    return RETURN_UNIQUE_PTR(func);
+}
+
 /** Create a backend dequantize layer function
  *
  * @tparam DequantizationLayer Function Backend dequantize function
@@ -54,7 +54,8 @@ public:
     std::shared_ptr<arm_compute::IWeightsManager> create_weights_manager() override;
 
 private:
-    Allocator _allocator; /**< NEON backend allocator */
+    Allocator        _allocator;         /**< NEON backend allocator */
+    AllocationPolicy _allocation_policy; /**< Page commitment policy applied to created tensors */
 };
 } // namespace backends
 } // namespace graph
@@ -67,6 +67,26 @@ std::pair<std::unique_ptr<arm_compute::IFunction>, FunctionNameType> create_name
     return std::make_pair(std::move(f), name);
 }
 
+/** Creates and configures a named function
+ *
+ * @param[in] name Name of the function
+ * @param[in] mm   Memory manager to use
+ * @param[in] wm   Weights manager to use
+ * @param[in] args Function arguments
+ *
+ * @return  A configured backend function
+ */
+template <typename FunctionType, typename FunctionNameType, typename MemoryManagerType, typename WeightsManagerType, typename... ParameterType>
+std::pair<std::unique_ptr<arm_compute::IFunction>, FunctionNameType> create_named_weights_managed_function(FunctionNameType name,
+                                                                                                           MemoryManagerType mm,
+                                                                                                           WeightsManagerType wm,
+                                                                                                           ParameterType... args)
+{
+    auto f = arm_compute::support::cpp14::make_unique<FunctionType>(mm, wm);
+    f->configure(std::forward<ParameterType>(args)...);
+    return std::make_pair(std::move(f), name);
+}
+
 /** Checks if an operation is in place
  *
  * @param[in] input  Pointer to input
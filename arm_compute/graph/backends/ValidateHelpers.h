@@ -132,6 +132,7 @@ Status validate_convolution_layer(ConvolutionLayerNode &node)
     const ConvolutionMethod conv_algorithm = node.convolution_method();
     const bool              fast_math      = node.fast_math_hint() == FastMathHint::Enabled;
     const unsigned int      num_groups     = node.num_groups();
+    const Size2D            dilation       = node.dilation();
 
     // Validate function
     Status status{};
@@ -139,19 +140,21 @@ Status validate_convolution_layer(ConvolutionLayerNode &node)
     {
         case ConvolutionMethod::Direct:
             ARM_COMPUTE_RETURN_ERROR_ON_MSG(num_groups != 1, "DirectConvolutionLayer does not support grouping!");
+            ARM_COMPUTE_RETURN_ERROR_ON_MSG(dilation != Size2D(1U, 1U), "DirectConvolutionLayer does not support dilation!");
             status = DirectConvolutionLayer::validate(input, weights, biases, output, conv_info);
             break;
         case ConvolutionMethod::GEMM:
             status = GEMMConvolutionLayer::validate(input, weights, biases, output, conv_info,
-                                                    WeightsInfo(), Size2D(1, 1), ActivationLayerInfo(), num_groups);
+                                                    WeightsInfo(), dilation, ActivationLayerInfo(), num_groups);
             break;
         case ConvolutionMethod::Winograd:
             ARM_COMPUTE_RETURN_ERROR_ON_MSG(num_groups != 1, "WinogradConvolutionLayer does not support grouping!");
+            ARM_COMPUTE_RETURN_ERROR_ON_MSG(dilation != Size2D(1U, 1U), "WinogradConvolutionLayer does not support dilation!");
             status = WinogradConvolutionLayer::validate(input, weights, biases, output, conv_info, ActivationLayerInfo(), fast_math);
             break;
         case ConvolutionMethod::Default:
             status = ConvolutionLayer::validate(input, weights, biases, output, conv_info,
-                                                WeightsInfo(), Size2D(1, 1), ActivationLayerInfo(), fast_math, num_groups);
+                                                WeightsInfo(), dilation, ActivationLayerInfo(), fast_math, num_groups);
             break;
         default:
             ARM_COMPUTE_RETURN_ERROR_MSG("Unsupported convolution method");
@@ -36,14 +36,19 @@ class GraphContext;
 struct ExecutionWorkload;
 class Tensor;
 class INode;
+class CalibrationTable;
+struct NodeExecutionTime;
+struct ExecutionBudget;
+struct StartupProfile;
 
 namespace detail
 {
 /** Validates all nodes
  *
- * @param[in] g Graph to validate
+ * @param[in]     g       Graph to validate
+ * @param[in,out] profile (Optional) Startup profile to record per-node validation times into
  */
-void validate_all_nodes(Graph &g);
+void validate_all_nodes(Graph &g, StartupProfile *profile = nullptr);
 /** Configures all nodes of a graph
  *
  * @param[in] g Graph to configure
@@ -74,10 +79,25 @@ void allocate_all_tensors(Graph &g);
  * @param[in, out] g          Graph to configure the nodes
  * @param[in]      ctx        Graph context to use
  * @param[in]      node_order The order to configure the nodes
+ * @param[in, out] profile    (Optional) Startup profile to record per-node configuration times into
  *
  * @return The execution workload
  */
-ExecutionWorkload configure_all_nodes(Graph &g, GraphContext &ctx, const std::vector<NodeID> &node_order);
+ExecutionWorkload configure_all_nodes(Graph &g, GraphContext &ctx, const std::vector<NodeID> &node_order, StartupProfile *profile = nullptr);
+/** Reorder the workload's tasks so that sibling consumers of one tensor run back-to-back
+ *
+ * Tasks are rescheduled, preserving dependencies, so that tasks whose inputs were produced
+ * earliest run first. Consumers sharing a producer thereby execute consecutively right after
+ * it, while the shared tensor is still cache-resident, instead of being separated by the full
+ * depth of the preceding sibling's branch. Workloads with a single consumer per tensor keep
+ * their original order.
+ *
+ * Must run before @ref configure_transition_manager, so the lifetime analysis sees the final
+ * execution order.
+ *
+ * @param[in, out] workload Workload whose tasks to reorder
+ */
+void group_sibling_consumer_tasks(ExecutionWorkload &workload);
 /** Release the memory of all unused const nodes
  *
  * @param[in] g Graph to release the memory from
@@ -93,6 +113,14 @@ void call_tensor_accessor(Tensor *tensor);
  * @param[in] g Graph containing the const nodes
  */
 void call_all_const_node_accessors(Graph &g);
+/** Re-points identical const tensors at a single shared copy held by the process-level store
+ *
+ * Only dense NEON const tensors participate; tensors whose contents already exist in the
+ * @ref ConstTensorStore release their own allocation and import the stored buffer instead.
+ *
+ * @param[in] g Graph containing the const nodes
+ */
+void deduplicate_const_tensors(Graph &g);
 /** Call all input node accessors
  *
  * @param[in] workload Workload to execute
@@ -109,14 +137,52 @@ bool call_all_input_node_accessors(ExecutionWorkload &workload);
 bool call_all_output_node_accessors(ExecutionWorkload &workload);
 /** Prepares all tasks for execution
  *
- * @param[in] workload Workload to prepare
+ * @param[in]     workload Workload to prepare
+ * @param[in,out] profile  (Optional) Startup profile to record per-node preparation times into
  */
-void prepare_all_tasks(ExecutionWorkload &workload);
+void prepare_all_tasks(ExecutionWorkload &workload, StartupProfile *profile = nullptr);
 /** Executes all tasks of a workload
  *
  * @param[in] workload Workload to execute
  */
 void call_all_tasks(ExecutionWorkload &workload);
+/** Executes all tasks of a workload, recording per-tensor value statistics after each task
+ *
+ * Tasks run sequentially so that every intermediate tensor can be profiled before
+ * cross-layer memory reuse overwrites it.
+ *
+ * @param[in]      workload Workload to execute
+ * @param[in,out]  table    Calibration table to accumulate the statistics into
+ */
+void call_all_tasks_and_collect_statistics(ExecutionWorkload &workload, CalibrationTable &table);
+/** Executes all tasks of a workload, accumulating the wall time of each task into its node's entry
+ *
+ * @param[in]     workload Workload to execute
+ * @param[in,out] timings  Per-node execution times to accumulate into
+ */
+void call_all_tasks_and_time(ExecutionWorkload &workload, std::map<NodeID, NodeExecutionTime> &timings);
+/** Executes all tasks of a workload under a per-frame time budget
+ *
+ * Tasks run sequentially and timed; before each one the frame's projected finish time is
+ * estimated from the elapsed time plus the smoothed measured times of the remaining tasks.
+ * When the projection overruns the budget, the budget's degradation hook is consulted for
+ * each remaining task and may skip it for this frame. The first frame primes the per-task
+ * times and is never degraded.
+ *
+ * @param[in]     workload Workload to execute
+ * @param[in,out] budget   Budget to enforce, accumulates the per-task times and degradation counters
+ */
+void call_all_tasks_with_budget(ExecutionWorkload &workload, ExecutionBudget &budget);
+/** Executes a two-stage pipelined workload until its accessors stop requesting frames
+ *
+ * Each iteration first copies the boundary tensors of the frame in flight across the cut,
+ * then runs the late stage of that frame concurrently with the early stage of the next one.
+ * The input and output accessors are driven internally, shifted by the one-frame latency
+ * the pipeline introduces.
+ *
+ * @param[in] workload Workload to execute. Its pipeline stages have to be populated.
+ */
+void execute_workload_pipelined(ExecutionWorkload &workload);
 } // namespace detail
 } // namespace graph
 } // namespace arm_compute
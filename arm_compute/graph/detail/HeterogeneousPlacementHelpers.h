@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_GRAPH_DETAIL_HETEROGENEOUS_PLACEMENT_HELPERS_H
+#define ARM_COMPUTE_GRAPH_DETAIL_HETEROGENEOUS_PLACEMENT_HELPERS_H
+
+#include "arm_compute/graph/Types.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+class IFunction;
+
+namespace graph
+{
+// Forward declarations
+class Graph;
+class INode;
+
+namespace detail
+{
+/** Estimate the cost of a node in operation equivalents from its output and weights shapes
+ *
+ * The absolute values are coarse and only meaningful relative to each other.
+ *
+ * @param[in] node Node to estimate
+ *
+ * @return Estimated cost of the node
+ */
+double estimate_node_cost(const INode &node);
+
+/** Split a graph across two targets by estimated cost
+ *
+ * Assigns each node the target that minimizes its estimated finish time under a simple
+ * per-node cost model, accounting for a per-byte penalty on every edge that crosses a
+ * target boundary. A @ref TransitionLayerNode is inserted on each crossing edge and all
+ * tensor targets are re-stamped, so every function only sees tensors of its own target.
+ *
+ * @note Has to run after the targets are forced on the graph and before the tensors are configured.
+ *
+ * @param[in] g         Graph to place
+ * @param[in] primary   Target the graph was requested on
+ * @param[in] secondary Second supported target to offload part of the graph to
+ *
+ * @return True if any node was placed on the secondary target
+ */
+bool place_nodes_heterogeneously(Graph &g, Target primary, Target secondary);
+
+/** Split the heaviest convolutions in two along the output height so both devices can cooperate on them
+ *
+ * Each selected convolution is replaced by two half-height convolutions that read their own
+ * input row range (including the halo rows the kernel footprint needs) and a height-axis
+ * concatenation that reassembles the output. The halves are independent, so the subsequent
+ * @ref place_nodes_heterogeneously pass can schedule them on the NEON and CL backends
+ * concurrently; the concatenation acts as the merge barrier.
+ *
+ * Only unit-stride, non-dilated, non-grouped convolutions above a cost threshold are split.
+ *
+ * @note Has to run before @ref place_nodes_heterogeneously and before the tensors are configured.
+ *
+ * @param[in] g Graph to process
+ *
+ * @return Number of convolutions that were split
+ */
+unsigned int split_heavy_nodes_cooperatively(Graph &g);
+
+/** Create the host-side copy function of a @ref TransitionLayerNode
+ *
+ * The function maps the input and output tensor handles and copies the contents across,
+ * synchronizing with the producing backend through the blocking map.
+ *
+ * @param[in] node Transition node to create the function for
+ *
+ * @return The transition function
+ */
+std::unique_ptr<arm_compute::IFunction> create_transition_function(INode &node);
+} // namespace detail
+} // namespace graph
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_GRAPH_DETAIL_HETEROGENEOUS_PLACEMENT_HELPERS_H */
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_GRAPH_DETAIL_PIPELINE_HELPERS_H
+#define ARM_COMPUTE_GRAPH_DETAIL_PIPELINE_HELPERS_H
+
+#include "arm_compute/graph/Types.h"
+
+#include <map>
+
+namespace arm_compute
+{
+namespace graph
+{
+// Forward declarations
+class Graph;
+
+namespace detail
+{
+/** Stage index of the boundary copy tasks of a pipelined workload */
+constexpr unsigned int PipelineBoundaryStage = 2;
+
+/** Cut a graph into two pipeline stages of similar estimated cost
+ *
+ * The cut is placed on the topological order where the cumulative estimated cost reaches
+ * half of the total. Every non-constant edge that crosses the cut gets a
+ * @ref TransitionLayerNode, so the late stage reads a private copy of the boundary tensors
+ * and the early stage of the next frame can overwrite the originals concurrently.
+ *
+ * @note Has to run after target assignment and before the tensors are configured.
+ *
+ * @param[in] g Graph to cut
+ *
+ * @return Stage index per node: 0 for the early stage, 1 for the late stage and
+ *         @ref PipelineBoundaryStage for the inserted boundary copies. Empty if no
+ *         worthwhile cut exists.
+ */
+std::map<NodeID, unsigned int> partition_graph_for_pipelining(Graph &g);
+} // namespace detail
+} // namespace graph
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_GRAPH_DETAIL_PIPELINE_HELPERS_H */
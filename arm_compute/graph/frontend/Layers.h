@@ -345,6 +345,7 @@ public:
      * @param[in] num_groups         (Optional) Number of groups. Default: 1.
      * @param[in] weights_quant_info (Optional) Weights quantization information
      * @param[in] out_quant_info     (Optional) Output quantization info
+     * @param[in] dilation           (Optional) Dilation, in elements, across x and y. Default: 1
      */
     ConvolutionLayer(unsigned int           conv_width,
                      unsigned int           conv_height,
@@ -354,7 +355,8 @@ public:
                      PadStrideInfo          conv_info,
                      unsigned int           num_groups         = 1,
                      const QuantizationInfo weights_quant_info = QuantizationInfo(),
-                     const QuantizationInfo out_quant_info     = QuantizationInfo())
+                     const QuantizationInfo out_quant_info     = QuantizationInfo(),
+                     const Size2D           dilation           = Size2D(1U, 1U))
         : _conv_width(conv_width),
           _conv_height(conv_height),
           _ofm(ofm),
@@ -363,7 +365,8 @@ public:
           _weights(std::move(weights)),
           _bias(std::move(bias)),
           _weights_quant_info(std::move(weights_quant_info)),
-          _out_quant_info(std::move(out_quant_info))
+          _out_quant_info(std::move(out_quant_info)),
+          _dilation(dilation)
     {
     }
 
@@ -374,7 +377,8 @@ public:
         return GraphBuilder::add_convolution_node(s.graph(), common_params, input,
                                                   Size2D(_conv_width, _conv_height), _ofm, _conv_info, _num_groups,
                                                   s.hints().convolution_method_hint, s.hints().fast_math_hint,
-                                                  std::move(_weights), std::move(_bias), std::move(_weights_quant_info), std::move(_out_quant_info));
+                                                  std::move(_weights), std::move(_bias), std::move(_weights_quant_info), std::move(_out_quant_info),
+                                                  _dilation);
     }
 
 private:
@@ -387,6 +391,7 @@ private:
     ITensorAccessorUPtr    _bias;
     const QuantizationInfo _weights_quant_info;
     const QuantizationInfo _out_quant_info;
+    const Size2D           _dilation;
 };
 
 /** Deconvolution Layer */
@@ -1308,6 +1313,59 @@ private:
     int                                     _axis;
 };
 
+/** Streaming Convolution Layer */
+class StreamingConvolutionLayer final : public ILayer
+{
+public:
+    /** Construct a streaming convolution layer.
+     *
+     * The layer's input carries only the new frames entering the sliding window each step,
+     * while its output holds the convolution of the full window. NEON only.
+     *
+     * @param[in] conv_width   Convolution width.
+     * @param[in] conv_height  Convolution height.
+     * @param[in] ofm          Output feature map.
+     * @param[in] weights      Accessor to get kernel weights from.
+     * @param[in] bias         Accessor to get kernel bias from.
+     * @param[in] conv_info    Padding and stride information. Padding along x is not supported.
+     * @param[in] window_width Width of the sliding window, in elements, along the time axis.
+     */
+    StreamingConvolutionLayer(unsigned int        conv_width,
+                              unsigned int        conv_height,
+                              unsigned int        ofm,
+                              ITensorAccessorUPtr weights,
+                              ITensorAccessorUPtr bias,
+                              PadStrideInfo       conv_info,
+                              unsigned int        window_width)
+        : _conv_width(conv_width),
+          _conv_height(conv_height),
+          _ofm(ofm),
+          _conv_info(std::move(conv_info)),
+          _window_width(window_width),
+          _weights(std::move(weights)),
+          _bias(std::move(bias))
+    {
+    }
+
+    NodeID create_layer(IStream &s) override
+    {
+        NodeIdxPair input         = { s.tail_node(), 0 };
+        NodeParams  common_params = { name(), s.hints().target_hint };
+        return GraphBuilder::add_streaming_convolution_node(s.graph(), common_params, input,
+                                                            Size2D(_conv_width, _conv_height), _ofm, _conv_info, _window_width,
+                                                            s.hints().fast_math_hint, std::move(_weights), std::move(_bias));
+    }
+
+private:
+    unsigned int        _conv_width;
+    unsigned int        _conv_height;
+    unsigned int        _ofm;
+    const PadStrideInfo _conv_info;
+    unsigned int        _window_width;
+    ITensorAccessorUPtr _weights;
+    ITensorAccessorUPtr _bias;
+};
+
 /** Upsample Layer */
 class UpsampleLayer final : public ILayer
 {
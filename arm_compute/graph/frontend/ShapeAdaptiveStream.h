@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_GRAPH_SHAPE_ADAPTIVE_STREAM_H
+#define ARM_COMPUTE_GRAPH_SHAPE_ADAPTIVE_STREAM_H
+
+#include "arm_compute/graph/frontend/IStream.h"
+#include "arm_compute/graph/frontend/IStreamOperators.h"
+#include "arm_compute/graph/frontend/Types.h"
+
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/GraphContext.h"
+#include "arm_compute/graph/GraphManager.h"
+
+#include <condition_variable>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace frontend
+{
+// Forward Declarations
+class ILayer;
+
+/** Stream frontend class for graphs whose input shape varies between runs
+ *
+ * Tensor shapes are fixed at finalize time, so a single graph cannot serve inputs of
+ * varying size. Instead of rebuilding and re-finalizing the whole stream per shape,
+ * this class keeps a small LRU cache of finalized workloads, one per concrete input
+ * shape, and builds a missing entry on demand through a user provided builder function.
+ *
+ * The transformed weights are shared across all cached entries: every entry is
+ * finalized against the same weights managers, whose content-based deduplication
+ * resolves the reshaped weights of identical layers to a single allocation. Activation
+ * memory is per entry, bounded by the cache capacity.
+ */
+class ShapeAdaptiveStream final : public IStream
+{
+public:
+    /** Builder function type
+     *
+     * Called to construct the stream for a concrete input shape. The builder has to add
+     * every layer of the graph, including the input layer, using the shape it is given.
+     */
+    using Builder = std::function<void(IStream &stream, const TensorShape &input_shape)>;
+
+    /** Constructor
+     *
+     * @param[in] id                Stream id. Cached entries use consecutive graph ids starting from this one.
+     * @param[in] name              Stream name
+     * @param[in] builder           Function that builds the stream for a concrete input shape
+     * @param[in] max_cached_shapes (Optional) Maximum number of shapes to keep finalized workloads for.
+     *                              When exceeded, the least recently used entry is released.
+     */
+    ShapeAdaptiveStream(size_t id, std::string name, Builder builder, size_t max_cached_shapes = 4);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    ShapeAdaptiveStream(const ShapeAdaptiveStream &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    ShapeAdaptiveStream &operator=(const ShapeAdaptiveStream &) = delete;
+    /** Destructor. Stops the pre-configuration worker, if one was started. */
+    ~ShapeAdaptiveStream();
+    /** Sets the execution target and configuration used to finalize the cached entries
+     *
+     * Unlike @ref Stream::finalize no graph is finalized here; entries are built and
+     * finalized lazily on the first @ref run with their shape.
+     *
+     * @param[in] target Execution target
+     * @param[in] config (Optional) Graph configuration to use
+     */
+    void finalize(Target target, const GraphConfig &config);
+    /** Executes the stream for a concrete input shape
+     *
+     * Reuses the cached workload for the shape if one exists, otherwise builds and
+     * finalizes one first.
+     *
+     * @param[in] input_shape Shape of the input to execute for
+     */
+    void run(const TensorShape &input_shape);
+    /** Queues a shape for background pre-configuration
+     *
+     * A worker thread builds and finalizes the workload for the shape ahead of need, so a
+     * later @ref run with it finds a cached entry instead of paying configure and prepare
+     * on the calling thread. Shapes already cached or queued are ignored. The first call
+     * starts the worker; building serializes with the cache-miss path of @ref run, while
+     * execution of an already cached shape proceeds concurrently.
+     *
+     * @note The builder function is invoked on the worker thread and has to be safe to
+     *       call from there.
+     *
+     * @param[in] input_shape Shape to pre-configure a workload for
+     */
+    void prefetch(const TensorShape &input_shape);
+    /** Returns the number of shapes a finalized workload is currently cached for
+     *
+     * @return Number of cached shapes
+     */
+    size_t num_cached_shapes() const;
+
+    // Inherited overridden methods
+    void add_layer(ILayer &layer) override;
+    Graph       &graph() override;
+    const Graph &graph() const override;
+
+private:
+    /** Cached workload of one concrete input shape */
+    struct CacheEntry
+    {
+        //Important: the context must be declared *before* the graph as the graph resources
+        //are allocated from it and have to be released first (same ordering as in Stream).
+        TensorShape                   shape = {}; /**< Input shape the entry was built for */
+        std::unique_ptr<GraphContext> ctx   = {}; /**< Graph context of the entry */
+        std::unique_ptr<Graph>        graph = {}; /**< Graph of the entry */
+    };
+
+    /** Returns the cached graph for a given input shape or nullptr, refreshing its LRU position
+     *
+     * Must be called with @ref _mtx held.
+     *
+     * @param[in] input_shape Input shape to look up
+     *
+     * @return Finalized graph for the shape if cached else nullptr
+     */
+    Graph *find_graph(const TensorShape &input_shape);
+    /** Builds and finalizes the graph for a given input shape, evicting the LRU entry if needed
+     *
+     * Must be called with @ref _mtx held and the shape not cached.
+     *
+     * @param[in] input_shape Input shape to build the graph for
+     *
+     * @return Finalized graph for the shape
+     */
+    Graph &build_graph(const TensorShape &input_shape);
+    /** Entry point of the background pre-configuration worker */
+    void prefetch_worker();
+
+    std::string _name;              /**< Stream name */
+    size_t      _next_graph_id;     /**< Graph id to use for the next cached entry */
+    Builder     _builder;           /**< Builder constructing the stream for a concrete shape */
+    size_t      _max_cached_shapes; /**< Capacity of the workload cache */
+    Target      _target;            /**< Execution target to finalize entries for */
+    GraphConfig _config;            /**< Graph configuration to finalize entries with */
+    bool        _finalized;         /**< True if finalize has been called */
+    std::map<Target, std::shared_ptr<arm_compute::IWeightsManager>> _shared_weights; /**< Weights managers shared by all cached entries */
+    std::list<CacheEntry> _cache;             /**< Cached entries, most recently used first */
+    GraphManager          _manager;           /**< Graph manager */
+    Graph                *_current = nullptr; /**< Graph currently being built or run */
+    mutable std::mutex      _mtx{};             /**< Mutex guarding the cache, build state and prefetch queue */
+    std::condition_variable _cv{};              /**< Signals the worker that shapes were queued or stop was requested */
+    std::list<TensorShape>  _prefetch_queue{};  /**< Shapes queued for background pre-configuration */
+    std::thread             _worker{};          /**< Background pre-configuration worker; started by the first prefetch() */
+    bool                    _stop_worker{ false }; /**< True once the destructor asked the worker to exit */
+};
+} // namespace frontend
+} // namespace graph
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_GRAPH_SHAPE_ADAPTIVE_STREAM_H */
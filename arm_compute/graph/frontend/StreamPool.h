@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_GRAPH_STREAM_POOL_H
+#define ARM_COMPUTE_GRAPH_STREAM_POOL_H
+
+#include "arm_compute/graph/frontend/IStream.h"
+#include "arm_compute/graph/frontend/IStreamOperators.h"
+#include "arm_compute/graph/frontend/Types.h"
+
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/GraphContext.h"
+#include "arm_compute/graph/GraphManager.h"
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace frontend
+{
+// Forward Declarations
+class ILayer;
+
+/** Stream frontend class holding multiple execution replicas of one graph
+ *
+ * Serving parallel requests by instantiating the stream once per request duplicates
+ * every weight and every transformed weights buffer. A stream pool instead builds a
+ * fixed number of replicas of the same graph against one shared set of weights
+ * managers: each replica keeps its own context, memory pools and configured kernels,
+ * while the content-based deduplication of the weights managers resolves the
+ * transformed weights of corresponding layers to a single allocation. Original weight
+ * tensors are released per replica after preparation as usual, so in steady state the
+ * weights are held once for the whole pool.
+ *
+ * Distinct replicas can be run from different threads, as their workloads and
+ * activation memory are fully independent. Note however that the backend schedulers
+ * are process wide singletons; concurrent dispatch requires the configured scheduler
+ * to support it.
+ */
+class StreamPool final : public IStream
+{
+public:
+    /** Builder function type
+     *
+     * Called once per replica to construct the stream, including its input and output layers.
+     */
+    using Builder = std::function<void(IStream &stream)>;
+
+    /** Constructor
+     *
+     * @param[in] id           Stream id. Replicas use consecutive graph ids starting from this one.
+     * @param[in] name         Stream name
+     * @param[in] builder      Function that builds the stream of one replica
+     * @param[in] num_replicas Number of execution replicas to create
+     */
+    StreamPool(size_t id, std::string name, Builder builder, size_t num_replicas);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    StreamPool(const StreamPool &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    StreamPool &operator=(const StreamPool &) = delete;
+    /** Builds and finalizes all replicas for an execution target
+     *
+     * The weights managers created while finalizing the first replica are shared with
+     * every subsequent one, which is what enables the cross-replica weights reuse.
+     *
+     * @param[in] target Execution target
+     * @param[in] config (Optional) Graph configuration to use
+     */
+    void finalize(Target target, const GraphConfig &config);
+    /** Executes one replica of the stream
+     *
+     * @param[in] replica_index Index of the replica to execute
+     */
+    void run(size_t replica_index);
+    /** Returns the number of replicas of the pool
+     *
+     * @return Number of replicas
+     */
+    size_t num_replicas() const;
+
+    // Inherited overridden methods
+    void add_layer(ILayer &layer) override;
+    Graph       &graph() override;
+    const Graph &graph() const override;
+
+private:
+    /** Execution state of one replica */
+    struct Replica
+    {
+        //Important: the context must be declared *before* the graph as the graph resources
+        //are allocated from it and have to be released first (same ordering as in Stream).
+        std::unique_ptr<GraphContext> ctx   = {}; /**< Graph context of the replica */
+        std::unique_ptr<Graph>        graph = {}; /**< Graph of the replica */
+    };
+
+    std::string _name;    /**< Stream name */
+    size_t      _id;      /**< Stream id */
+    Builder     _builder;      /**< Builder constructing the stream of one replica */
+    size_t      _num_replicas; /**< Number of replicas to create */
+    std::map<Target, std::shared_ptr<arm_compute::IWeightsManager>> _shared_weights; /**< Weights managers shared by all replicas */
+    std::vector<Replica> _replicas;          /**< Execution replicas */
+    GraphManager         _manager;           /**< Graph manager */
+    Graph               *_current = nullptr; /**< Graph currently being built */
+};
+} // namespace frontend
+} // namespace graph
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_GRAPH_STREAM_POOL_H */
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_GRAPH_ACTIVATION_RECOMPUTE_MUTATOR_H
+#define ARM_COMPUTE_GRAPH_ACTIVATION_RECOMPUTE_MUTATOR_H
+
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/IGraphMutator.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Mutation pass to recompute long-lived activations instead of keeping them resident
+ *
+ * An activation consumed both near its producer and again much later (the skip-connection
+ * pattern) has to stay allocated across the whole span, which dominates peak transition
+ * memory in long residual networks. For every such far edge the pass clones the chain of
+ * nodes producing the tensor and rewires the far consumer to the clone, so the original
+ * dies at its near consumers and the recomputed copy lives only next to the far consumer.
+ * The lifetime analysis of the memory managers then shortens both ranges on its own,
+ * trading the FLOPs of the cloned chain for peak memory.
+ *
+ * Chains are cloned through activation, convolution, eltwise and pooling nodes up to a
+ * configurable depth; constants and inputs are shared with the original chain. Edges
+ * whose chain cannot be cloned within the depth budget are left untouched.
+ */
+class ActivationRecomputeMutator final : public IGraphMutator
+{
+public:
+    /** Constructor
+     *
+     * @param[in] span_threshold Minimum topological distance between producer and consumer for an edge to be recomputed
+     * @param[in] max_depth      Maximum number of nodes cloned per recompute chain
+     */
+    ActivationRecomputeMutator(unsigned int span_threshold, unsigned int max_depth);
+
+    // Inherited methods overridden
+    virtual void mutate(Graph &g) override;
+    MutationType type() const override;
+    const char *name() override;
+
+private:
+    unsigned int _span_threshold;
+    unsigned int _max_depth;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_GRAPH_ACTIVATION_RECOMPUTE_MUTATOR_H */
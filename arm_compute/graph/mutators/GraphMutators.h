@@ -24,9 +24,13 @@
 #ifndef ARM_COMPUTE_GRAPH_GRAPH_MUTATORS_H
 #define ARM_COMPUTE_GRAPH_GRAPH_MUTATORS_H
 
+#include "arm_compute/graph/mutators/ActivationRecomputeMutator.h"
+#include "arm_compute/graph/mutators/Bfloat16Mutator.h"
+#include "arm_compute/graph/mutators/ConstantFoldingMutator.h"
 #include "arm_compute/graph/mutators/DepthConcatSubTensorMutator.h"
 #include "arm_compute/graph/mutators/GroupedConvolutionMutator.h"
 #include "arm_compute/graph/mutators/InPlaceOperationMutator.h"
+#include "arm_compute/graph/mutators/LayoutOptimizationMutator.h"
 #include "arm_compute/graph/mutators/NodeExecutionMethodMutator.h"
 #include "arm_compute/graph/mutators/NodeFusionMutator.h"
 #include "arm_compute/graph/mutators/SplitLayerSubTensorMutator.h"
@@ -41,12 +41,14 @@ public:
      * @param[in] method         (Optional) Convolution method to use
      * @param[in] fast_math_hint (Optional) Fast math hint
      * @param[in] out_quant_info (Optional) Output quantization info
+     * @param[in] dilation       (Optional) Dilation, in elements, across x and y (Defaults to 1)
      */
     ConvolutionLayerNode(PadStrideInfo     info,
                          unsigned int      num_groups     = 1,
                          ConvolutionMethod method         = ConvolutionMethod::Default,
                          FastMathHint      fast_math_hint = FastMathHint::Disabled,
-                         QuantizationInfo  out_quant_info = QuantizationInfo());
+                         QuantizationInfo  out_quant_info = QuantizationInfo(),
+                         Size2D            dilation       = Size2D(1U, 1U));
     /** Sets the convolution layer method to use
      *
      * @param[in] method Method to use for convolution
@@ -75,11 +77,21 @@ public:
      * @return Convolution information
      */
     PadStrideInfo convolution_info() const;
+    /** Sets the convolution layer info
+     *
+     * @param[in] info Convolution layer info
+     */
+    void set_convolution_info(PadStrideInfo info);
     /** Number of groups in convolution accessor
      *
      * @return Number of groups in convolution
      */
     unsigned int num_groups() const;
+    /** Dilation accessor
+     *
+     * @return Dilation, in elements, across x and y
+     */
+    Size2D dilation() const;
     /** Returns fused activation
      *
      * @return Fused activation
@@ -95,12 +107,14 @@ public:
      * @param[in] input_descriptor   Input descriptor
      * @param[in] weights_descriptor Weights descriptor
      * @param[in] info               Convolution operation attributes
+     * @param[in] dilation           (Optional) Dilation, in elements, across x and y (Defaults to 1)
      *
      * @return Output descriptor
      */
     static TensorDescriptor compute_output_descriptor(const TensorDescriptor &input_descriptor,
                                                       const TensorDescriptor &weights_descriptor,
-                                                      const PadStrideInfo    &info);
+                                                      const PadStrideInfo    &info,
+                                                      const Size2D           &dilation = Size2D(1U, 1U));
 
     // Inherited overridden methods:
     NodeType         type() const override;
@@ -118,6 +132,7 @@ private:
     FastMathHint        _fast_math_hint;
     QuantizationInfo    _out_quant_info;
     ActivationLayerInfo _fused_activation;
+    Size2D              _dilation;
 };
 } // namespace graph
 } // namespace arm_compute
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_GRAPH_DEPTH_CONVERT_LAYER_NODE_H
+#define ARM_COMPUTE_GRAPH_DEPTH_CONVERT_LAYER_NODE_H
+
+#include "arm_compute/graph/INode.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Depth Convert Layer node
+ *
+ * Depth convert layer changes the element data type of its input, e.g. at the
+ * boundaries of a BFLOAT16 subgraph.
+ */
+class DepthConvertLayerNode final : public INode
+{
+public:
+    /** Constructor
+     *
+     * @param[in] data_type Data type to convert the input to
+     * @param[in] policy    (Optional) Policy to use for the conversion. Defaults to @ref ConvertPolicy::SATURATE
+     */
+    DepthConvertLayerNode(DataType data_type, ConvertPolicy policy = ConvertPolicy::SATURATE);
+    /** Output data type accessor
+     *
+     * @return Data type the input is converted to
+     */
+    DataType data_type() const;
+    /** Conversion policy accessor
+     *
+     * @return Policy used for the conversion
+     */
+    ConvertPolicy policy() const;
+
+    // Inherited overridden methods:
+    NodeType         type() const override;
+    bool             forward_descriptors() override;
+    TensorDescriptor configure_output(size_t idx) const override;
+    void accept(INodeVisitor &v) override;
+
+private:
+    DataType      _data_type;
+    ConvertPolicy _policy;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_GRAPH_DEPTH_CONVERT_LAYER_NODE_H */
@@ -68,6 +68,11 @@ public:
      * @return Convolution information
      */
     PadStrideInfo convolution_info() const;
+    /** Sets the convolution layer info
+     *
+     * @param[in] info Convolution layer info
+     */
+    void set_convolution_info(PadStrideInfo info);
     /** Returns fused activation
      *
      * @return Fused activation
@@ -38,6 +38,7 @@ class ConcatenateLayerNode;
 class ConstNode;
 class ConvolutionLayerNode;
 class DeconvolutionLayerNode;
+class DepthConvertLayerNode;
 class DepthwiseConvolutionLayerNode;
 class DequantizationLayerNode;
 class DetectionOutputLayerNode;
@@ -68,6 +69,8 @@ class SoftmaxLayerNode;
 class SliceLayerNode;
 class SplitLayerNode;
 class StackLayerNode;
+class StreamingConvolutionLayerNode;
+class TransitionLayerNode;
 class UpsampleLayerNode;
 class YOLOLayerNode;
 } // namespace graph
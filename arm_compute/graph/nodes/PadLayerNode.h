@@ -58,6 +58,9 @@ public:
     TensorDescriptor configure_output(size_t idx) const override;
     void accept(INodeVisitor &v) override;
 
+public:
+    static constexpr NodeType node_type = NodeType::PadLayer;
+
 private:
     PaddingList _padding;
     PixelValue  _pad_value;
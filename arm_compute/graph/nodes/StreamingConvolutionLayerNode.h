@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_GRAPH_STREAMING_CONVOLUTION_LAYER_NODE_H
+#define ARM_COMPUTE_GRAPH_STREAMING_CONVOLUTION_LAYER_NODE_H
+
+#include "arm_compute/graph/INode.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Streaming Convolution Layer node
+ *
+ * Convolution over a sliding window of a streamed signal. The node's input carries only the
+ * new frames entering the window each step; the backend function keeps the window and the
+ * previous result as internal state and recomputes only the output columns the new frames
+ * influence. Only supported by the NEON backend. @see NEStreamingConvolutionLayer
+ */
+class StreamingConvolutionLayerNode final : public INode
+{
+public:
+    /** Constructor
+     *
+     * @param[in] info           Convolution layer attributes
+     * @param[in] window_width   Width of the sliding window, in elements, along the time axis
+     * @param[in] fast_math_hint (Optional) Fast math hint
+     */
+    StreamingConvolutionLayerNode(PadStrideInfo info, unsigned int window_width, FastMathHint fast_math_hint = FastMathHint::Disabled);
+    /** Convolution metadata accessor
+     *
+     * @return Convolution information
+     */
+    PadStrideInfo convolution_info() const;
+    /** Sliding window width accessor
+     *
+     * @return Width of the sliding window along the time axis
+     */
+    unsigned int window_width() const;
+    /** Fast math hint accessor
+     *
+     * @return Fast math hint to be used by the node
+     */
+    FastMathHint fast_math_hint() const;
+    /** Computes streaming convolution output descriptor
+     *
+     * @param[in] input_descriptor   Step input descriptor, holding only the new frames of the window
+     * @param[in] weights_descriptor Weights descriptor
+     * @param[in] info               Convolution operation attributes
+     * @param[in] window_width       Width of the sliding window along the time axis
+     *
+     * @return Output descriptor
+     */
+    static TensorDescriptor compute_output_descriptor(const TensorDescriptor &input_descriptor,
+                                                      const TensorDescriptor &weights_descriptor,
+                                                      const PadStrideInfo    &info,
+                                                      unsigned int            window_width);
+
+    // Inherited overridden methods:
+    NodeType         type() const override;
+    bool             forward_descriptors() override;
+    TensorDescriptor configure_output(size_t idx) const override;
+    void accept(INodeVisitor &v) override;
+
+private:
+    PadStrideInfo _info;
+    unsigned int  _window_width;
+    FastMathHint  _fast_math_hint;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_GRAPH_STREAMING_CONVOLUTION_LAYER_NODE_H */
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_GRAPH_MEMORYPLANPRINTER_H
+#define ARM_COMPUTE_GRAPH_MEMORYPLANPRINTER_H
+
+#include "arm_compute/graph/Types.h"
+
+#include <ostream>
+
+namespace arm_compute
+{
+namespace graph
+{
+// Forward declarations
+class Graph;
+class GraphContext;
+
+/** Memory and shape plan printer
+ *
+ * Prints the per-layer output shapes and operation estimates computable after
+ * configuration, followed by the memory requirements the lifetime managers
+ * computed for each target. Intended for graphs finalized under
+ * @ref GraphConfig::use_dry_run, where the plan is available without any
+ * memory having been allocated, but works on fully finalized graphs too.
+ */
+class MemoryPlanPrinter final
+{
+public:
+    /** Print the memory plan
+     *
+     * @param[in]  g   Graph to report on
+     * @param[in]  ctx Graph context holding the memory managers
+     * @param[out] os  Output stream to print to
+     */
+    void print(const Graph &g, GraphContext &ctx, std::ostream &os) const;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_GRAPH_MEMORYPLANPRINTER_H */
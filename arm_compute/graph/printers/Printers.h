@@ -25,5 +25,8 @@
 #define ARM_COMPUTE_GRAPH_PRINTERS_H
 
 #include "arm_compute/graph/printers/DotGraphPrinter.h"
+#include "arm_compute/graph/printers/MemoryPlanPrinter.h"
+#include "arm_compute/graph/printers/RooflinePrinter.h"
+#include "arm_compute/graph/printers/StartupProfilePrinter.h"
 
 #endif /* ARM_COMPUTE_GRAPH_PRINTERS_H */
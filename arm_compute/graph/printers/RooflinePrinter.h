@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_GRAPH_ROOFLINEPRINTER_H
+#define ARM_COMPUTE_GRAPH_ROOFLINEPRINTER_H
+
+#include "arm_compute/graph/Types.h"
+#include "arm_compute/graph/Workload.h"
+
+#include <map>
+#include <ostream>
+
+namespace arm_compute
+{
+namespace graph
+{
+// Forward declarations
+class Graph;
+
+/** Per-layer roofline report printer
+ *
+ * Combines the arithmetic intensity computable statically from each node's
+ * tensor shapes with the execution times collected by @ref GraphManager under
+ * @ref GraphConfig::use_node_time_profiling, and prints one line per executed
+ * node: operation and byte counts, attained against attainable throughput and
+ * a memory/compute bound classification against the given machine peaks.
+ */
+class RooflinePrinter final
+{
+public:
+    /** Constructor
+     *
+     * @param[in] peak_gflops Peak compute throughput of the target in GFLOP/s (GOP/s for quantized graphs)
+     * @param[in] peak_gbps   Peak memory bandwidth of the target in GB/s
+     */
+    RooflinePrinter(double peak_gflops, double peak_gbps);
+    /** Print the roofline table
+     *
+     * @param[in]  g       Graph to report on
+     * @param[in]  timings Per-node execution times collected by @ref GraphManager
+     * @param[out] os      Output stream to print to
+     */
+    void print(const Graph &g, const std::map<NodeID, NodeExecutionTime> &timings, std::ostream &os) const;
+
+private:
+    double _peak_gflops;
+    double _peak_gbps;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_GRAPH_ROOFLINEPRINTER_H */
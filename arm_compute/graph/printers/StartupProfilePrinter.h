@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_GRAPH_STARTUPPROFILEPRINTER_H
+#define ARM_COMPUTE_GRAPH_STARTUPPROFILEPRINTER_H
+
+#include "arm_compute/graph/Types.h"
+#include "arm_compute/graph/Workload.h"
+
+#include <ostream>
+
+namespace arm_compute
+{
+namespace graph
+{
+// Forward declarations
+class Graph;
+
+/** Startup phase report printer
+ *
+ * Prints the per-function validate/configure/prepare times collected by
+ * @ref GraphManager under @ref GraphConfig::use_startup_profiling, ordered by
+ * total time spent, followed by the graph-wide phase totals including tensor
+ * allocation.
+ */
+class StartupProfilePrinter final
+{
+public:
+    /** Print the startup phase report
+     *
+     * @param[in]  g       Graph to report on
+     * @param[in]  profile Startup profile collected by @ref GraphManager
+     * @param[out] os      Output stream to print to
+     */
+    void print(const Graph &g, const StartupProfile &profile, std::ostream &os) const;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_GRAPH_STARTUPPROFILEPRINTER_H */
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_BESTFITLIFETIMEMANAGER_H
+#define ARM_COMPUTE_BESTFITLIFETIMEMANAGER_H
+
+#include "arm_compute/runtime/ISimpleLifetimeManager.h"
+
+#include "arm_compute/runtime/Types.h"
+
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+// Forward declarations
+class IMemoryPool;
+
+/** Concrete class that tracks the lifetime of registered tensors and
+ *  packs them into blobs using a best-fit-decreasing strategy
+ *
+ * Unlike @ref BlobLifetimeManager, which pairs the i-th largest requirement of
+ * every group with the i-th blob, each group requirement picks the smallest
+ * existing blob it fits in and only grows a blob (or adds one) when nothing
+ * fits, which packs groups of dissimilar tensor sizes into fewer total bytes.
+ * Pass it to @ref MemoryManagerOnDemand to select this placement strategy.
+ */
+class BestFitLifetimeManager : public ISimpleLifetimeManager
+{
+public:
+    using info_type = std::vector<BlobInfo>;
+
+public:
+    /** Constructor */
+    BestFitLifetimeManager();
+    /** Prevent instances of this class to be copy constructed */
+    BestFitLifetimeManager(const BestFitLifetimeManager &) = delete;
+    /** Prevent instances of this class to be copied */
+    BestFitLifetimeManager &operator=(const BestFitLifetimeManager &) = delete;
+    /** Allow instances of this class to be move constructed */
+    BestFitLifetimeManager(BestFitLifetimeManager &&) = default;
+    /** Allow instances of this class to be moved */
+    BestFitLifetimeManager &operator=(BestFitLifetimeManager &&) = default;
+    /** Accessor to the pool internal configuration meta-data
+     *
+     * @return Lifetime manager internal configuration meta-data
+     */
+    const info_type &info() const;
+
+    // Inherited methods overridden:
+    std::unique_ptr<IMemoryPool> create_pool(IAllocator *allocator) override;
+    MappingType mapping_type() const override;
+
+private:
+    // Inherited methods overridden:
+    void update_blobs_and_mappings() override;
+
+private:
+    std::vector<BlobInfo> _blobs; /**< Memory blobs */
+};
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_BESTFITLIFETIMEMANAGER_H */
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_CLDOUBLEBUFFEREDTENSOR_H
+#define ARM_COMPUTE_CLDOUBLEBUFFEREDTENSOR_H
+
+#include "arm_compute/core/CL/OpenCL.h"
+#include "arm_compute/runtime/CL/CLTensor.h"
+
+namespace arm_compute
+{
+class TensorInfo;
+
+/** Pair of identically shaped @ref CLTensor objects used to overlap host I/O with device compute.
+ *
+ * While the compute tensor is consumed by kernels on the scheduler's queue, the transfer tensor can
+ * be mapped, filled (or read back) and unmapped on a separate command queue. Once both the transfer
+ * and the compute of the current iteration are done, @ref swap() exchanges the roles of the two
+ * tensors, so iteration N+1's input uploads while iteration N computes:
+ *
+ *     cl::Event mapped = pair.map_transfer_async(transfer_queue);
+ *     mapped.wait();
+ *     // ... fill pair.transfer_tensor() on the host ...
+ *     pair.unmap_transfer_async(transfer_queue);
+ *     // ... run kernels on pair.compute_tensor() ...
+ *     pair.swap();
+ *
+ * @note Overlap requires @p transfer_queue to be a different command queue than the one the kernels
+ *       run on; with a single in-order queue the transfers still serialize with the compute.
+ */
+class CLDoubleBufferedTensor
+{
+public:
+    /** Constructor
+     *
+     * @param[in] ctx (Optional) Pointer to a @ref CLRuntimeContext.
+     *                If nullptr is passed in, the legacy api using the singletons will be used.
+     */
+    CLDoubleBufferedTensor(IRuntimeContext *ctx = nullptr);
+    /** Initialize both tensors with the given metadata
+     *
+     * @param[in] info Tensor metadata to use for both tensors of the pair.
+     */
+    void init(const TensorInfo &info);
+    /** Allocate the backing memory of both tensors */
+    void allocate();
+    /** Tensor currently designated for device compute
+     *
+     * @return Reference to the compute tensor.
+     */
+    CLTensor &compute_tensor();
+    /** Tensor currently designated for host transfers
+     *
+     * @return Reference to the transfer tensor.
+     */
+    CLTensor &transfer_tensor();
+    /** Enqueue a non-blocking map of the transfer tensor on the given queue
+     *
+     * @param[in,out] q The CL command queue to use for the transfer.
+     *
+     * @return An event that completes once the mapping is ready to use.
+     */
+    cl::Event map_transfer_async(cl::CommandQueue &q);
+    /** Enqueue an unmap of the transfer tensor on the given queue
+     *
+     * The returned event is also remembered so that the next @ref swap() can wait for the
+     * transfer to complete before exchanging the tensors.
+     *
+     * @param[in,out] q The CL command queue to use for the transfer.
+     *
+     * @return An event that completes once the transfer back to the device has finished.
+     */
+    cl::Event unmap_transfer_async(cl::CommandQueue &q);
+    /** Exchange the roles of the compute and transfer tensors
+     *
+     * Waits for the pending transfer (if any) so the new compute tensor is ready for the device.
+     */
+    void swap();
+
+private:
+    CLTensor  _tensors[2];        /**< Tensor pair */
+    size_t    _compute_index;     /**< Index of the tensor currently used for compute */
+    cl::Event _pending_transfer;  /**< Event of the last enqueued transfer unmap */
+};
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_CLDOUBLEBUFFEREDTENSOR_H */
@@ -42,6 +42,18 @@ class ICLKernel;
  *         a value telling why the function failed.
  */
 std::tuple<cl::Context, cl::Device, cl_int> create_opencl_context_and_device();
+/** This function creates an OpenCL context spanning every device exposed by the first platform.
+ *
+ * Sharing one context between the devices (e.g. a Mali GPU and a CL-capable NPU on the same board)
+ * allows buffers and events to cross device queues without host round trips.
+ *
+ * @note In debug builds, the function will automatically enable cl_arm_printf if the driver/device supports it.
+ *
+ * @return A std::tuple where the first element is the opencl context, the second element is the list of
+ *         opencl devices in the context and the third one an error code. The error code will be CL_SUCCESS
+ *         upon successful creation, otherwise a value telling why the function failed.
+ */
+std::tuple<cl::Context, std::vector<cl::Device>, cl_int> create_opencl_multi_device_context();
 /** Schedules a kernel using the context if not nullptr else uses the legacy scheduling flow.
  *
  * @param[in] ctx    Context to use.
@@ -110,11 +110,26 @@ public:
      * @param[in] ctx    Runtime context
      */
     CLBufferMemoryRegion(const cl::Buffer &buffer, CLCoreRuntimeContext *ctx);
+    /** Destructor */
+    ~CLBufferMemoryRegion();
 
     // Inherited methods overridden :
     void *ptr() final;
     void *map(cl::CommandQueue &q, bool blocking) final;
     void unmap(cl::CommandQueue &q) final;
+    /** Extract a sub-region backed by an OpenCL sub-buffer at the given offset
+     *
+     * @note The offset has to respect the base address alignment of the device.
+     *
+     * @param[in] offset Offset into this region
+     * @param[in] size   Size of the sub-region
+     *
+     * @return A sub-buffer backed memory region on success else nullptr
+     */
+    std::unique_ptr<IMemoryRegion> extract_subregion(size_t offset, size_t size) final;
+
+private:
+    bool _owned{ false }; /**< True if the CL buffer was allocated by this region */
 };
 
 /** OpenCL SVM memory region interface */
@@ -182,5 +197,30 @@ public:
     void *map(cl::CommandQueue &q, bool blocking) final;
     void unmap(cl::CommandQueue &q) final;
 };
+
+/** OpenCL memory region implementation over imported caller-owned fine-grain coherent SVM memory
+ *
+ * The region does not take ownership of the memory: it is never freed and map/unmap are no-ops,
+ * so host and device access the same allocation without copies.
+ */
+class CLImportedSVMMemoryRegion final : public ICLMemoryRegion
+{
+public:
+    /** Constructor
+     *
+     * @param[in] ptr  Host pointer to fine-grain coherent SVM memory allocated by the caller
+     * @param[in] size Region size
+     * @param[in] ctx  Runtime context
+     */
+    CLImportedSVMMemoryRegion(void *ptr, size_t size, CLCoreRuntimeContext *ctx);
+
+    // Inherited methods overridden :
+    void *ptr() final;
+    void *map(cl::CommandQueue &q, bool blocking) final;
+    void unmap(cl::CommandQueue &q) final;
+
+private:
+    void *_ptr;
+};
 } // namespace arm_compute
 #endif /* ARM_COMPUTE_RUNTIME_CL_CL_MEMORY_REGION_H */
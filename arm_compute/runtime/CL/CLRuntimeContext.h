@@ -28,6 +28,7 @@
 #include "arm_compute/core/CL/CLKernelLibrary.h"
 #include "arm_compute/core/CL/OpenCL.h"
 #include "arm_compute/runtime/CL/CLScheduler.h"
+#include "arm_compute/runtime/CL/CLStagingBufferPool.h"
 #include "arm_compute/runtime/CL/CLTuner.h"
 #include "arm_compute/runtime/IScheduler.h"
 #include "arm_compute/runtime/RuntimeContext.h"
@@ -48,6 +49,38 @@ public:
     CLRuntimeContext &operator=(const CLRuntimeContext &) = delete;
     /** CPU Scheduler setter */
     void set_gpu_scheduler(CLScheduler *scheduler);
+    /** Number of OpenCL devices available to this context
+     *
+     * All devices share one OpenCL context, so buffers and events can cross their queues.
+     *
+     * @return Number of devices. At least 1; more when the platform exposes further
+     *         CL-capable devices (e.g. an NPU next to the GPU).
+     */
+    size_t num_devices() const;
+    /** Scheduler bound to the queue of the given device
+     *
+     * Each device owns its queue and its tuner, so kernels are tuned per device.
+     *
+     * @param[in] device_index Index of the device. Index 0 is the primary device and returns
+     *                         the same scheduler as the parameterless overload.
+     *
+     * @return The scheduler of the requested device.
+     */
+    CLScheduler *gpu_scheduler(size_t device_index);
+    /** Make the consumer device's queue wait for all work enqueued so far on the producer device's queue.
+     *
+     * Inserts an event in the producer queue and a barrier on it in the consumer queue, so the
+     * hand-over of intermediate results between devices is synchronized on-device without a host round trip.
+     *
+     * @param[in] producer_device_index Index of the device producing the data.
+     * @param[in] consumer_device_index Index of the device consuming the data.
+     */
+    void synchronize_queues(size_t producer_device_index, size_t consumer_device_index);
+    /** Pool of pinned staging buffers for host<->device transfers, created on first use
+     *
+     * @return Reference to the context's staging buffer pool.
+     */
+    CLStagingBufferPool &staging_pool();
 
     // Inherited overridden methods
     CLScheduler          *gpu_scheduler();
@@ -55,11 +88,14 @@ public:
     CLCoreRuntimeContext *core_runtime_context();
 
 private:
-    std::unique_ptr<CLScheduler> _gpu_owned_scheduler{ nullptr };
-    CLScheduler                 *_gpu_scheduler{ nullptr };
-    CLTuner                      _tuner{ false };
-    CLSymbols                    _symbols{};
-    CLCoreRuntimeContext         _core_context{};
+    std::unique_ptr<CLScheduler>              _gpu_owned_scheduler{ nullptr };
+    CLScheduler                              *_gpu_scheduler{ nullptr };
+    CLTuner                                   _tuner{ false };
+    CLSymbols                                 _symbols{};
+    CLCoreRuntimeContext                      _core_context{};
+    std::vector<std::unique_ptr<CLTuner>>     _device_tuners{};
+    std::vector<std::unique_ptr<CLScheduler>> _device_schedulers{};
+    std::unique_ptr<CLStagingBufferPool>      _staging_pool{ nullptr };
 };
 } // namespace arm_compute
 #endif /*ARM_COMPUTE_CLRUNTIME_CONTEXT_H */
@@ -32,14 +32,49 @@
 #include "arm_compute/core/experimental/Types.h"
 #include "arm_compute/runtime/CL/ICLTuner.h"
 
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <map>
+#include <string>
+#include <vector>
+
 namespace arm_compute
 {
 class ICLKernel;
 class ICLTuner;
+
+/** Scheduling priority of a command queue relative to the other queues on the device */
+enum class CLQueuePriority
+{
+    DEFAULT, /**< Driver default priority */
+    HIGH,    /**< Schedule before lower-priority queues */
+    MEDIUM,  /**< Schedule at medium priority */
+    LOW      /**< Schedule after higher-priority queues */
+};
+
+/** Throttle hint of a command queue, trading queue throughput for energy and thermal headroom */
+enum class CLQueueThrottle
+{
+    DEFAULT, /**< Driver default throttling */
+    HIGH,    /**< Run at full throughput */
+    MEDIUM,  /**< Run at medium throughput */
+    LOW      /**< Minimise the energy consumed by the queue */
+};
+
 /** Provides global access to a CL context and command queue. */
 class CLScheduler final
 {
 public:
+    /** GPU execution time of a kernel accumulated across its enqueues */
+    struct KernelTiming
+    {
+        uint64_t     total_ns{ 0 };                                   /**< Accumulated GPU execution time in nanoseconds */
+        uint64_t     min_ns{ std::numeric_limits<uint64_t>::max() };  /**< Fastest single execution in nanoseconds */
+        uint64_t     max_ns{ 0 };                                     /**< Slowest single execution in nanoseconds */
+        unsigned int count{ 0 };                                      /**< Number of executions folded into the entry */
+    };
+
     /** Constructor */
     CLScheduler();
     /** Prevent instances of this class from being copied (As this class contains pointers) */
@@ -133,6 +168,120 @@ public:
      */
     void set_tuner(ICLTuner *tuner);
 
+    /** Enable or disable out-of-order kernel execution.
+     *
+     * When enabled, and if the device supports it, kernels are enqueued on an out-of-order command
+     * queue and ordered with event dependencies derived from the tensors they access, so independent
+     * kernels can overlap on the device. Kernels scheduled without their tensors are conservatively
+     * ordered after every command enqueued before them. The flush/finish policy is unchanged.
+     *
+     * @param[in] enable True to execute kernels out of order when the device supports it
+     */
+    void set_out_of_order_execution(bool enable);
+
+    /** Out-of-order execution status.
+     *
+     * @return True if kernels are enqueued on an out-of-order command queue.
+     */
+    bool out_of_order_execution() const;
+
+    /** Enable or disable job chaining.
+     *
+     * When enabled, the per-kernel flush requests issued by functions are ignored and the command
+     * queue is flushed once every @p burst_size enqueued kernels instead, cutting the host-side
+     * driver overhead for workloads that enqueue many small kernels per run (e.g. large graphs).
+     * A @ref sync waits for every enqueued kernel regardless of the pending burst.
+     *
+     * @param[in] enable     True to flush the queue in bursts instead of per kernel
+     * @param[in] burst_size (Optional) Number of enqueued kernels after which the queue is flushed. Defaults to 16.
+     */
+    void set_job_chaining(bool enable, unsigned int burst_size = 16);
+
+    /** Job chaining status.
+     *
+     * @return True if the queue is flushed in bursts instead of per kernel.
+     */
+    bool job_chaining() const;
+
+    /** Set the scheduling priority of the associated command queue.
+     *
+     * The hint is forwarded to the cl_khr_priority_hints extension where the device exposes it and
+     * is a no-op otherwise. Lowering the priority lets concurrent queues on the same device (e.g. a
+     * UI render queue) be scheduled ahead of inference.
+     *
+     * @param[in] priority Scheduling priority of the queue
+     */
+    void set_queue_priority(CLQueuePriority priority);
+
+    /** Scheduling priority of the associated command queue.
+     *
+     * @return The requested queue priority.
+     */
+    CLQueuePriority queue_priority() const;
+
+    /** Set the throttle hint of the associated command queue.
+     *
+     * The hint is forwarded to the cl_khr_throttle_hints extension where the device exposes it and
+     * is a no-op otherwise. Lower throttle values trade queue throughput for energy, leaving thermal
+     * and power headroom to the other users of the device.
+     *
+     * @param[in] throttle Throttle hint of the queue
+     */
+    void set_queue_throttle(CLQueueThrottle throttle);
+
+    /** Throttle hint of the associated command queue.
+     *
+     * @return The requested queue throttle hint.
+     */
+    CLQueueThrottle queue_throttle() const;
+
+    /** Enable or disable frame-budget mode.
+     *
+     * When enabled, the command stream is split into batches of @p yield_batch kernels, each
+     * submitted with its own flush, instead of building a single large job chain. Smaller
+     * submissions give the driver scheduling points where concurrent work on the same device
+     * (e.g. UI rendering) can be interleaved, at the cost of some extra host-side overhead.
+     * Takes precedence over job chaining.
+     *
+     * @param[in] enable      True to split the command stream into small submissions
+     * @param[in] yield_batch (Optional) Number of enqueued kernels per submission. Defaults to 4.
+     */
+    void set_frame_budget_mode(bool enable, unsigned int yield_batch = 4);
+
+    /** Frame-budget mode status.
+     *
+     * @return True if the command stream is split into small submissions.
+     */
+    bool frame_budget_mode() const;
+
+    /** Enable or disable per-kernel GPU time collection.
+     *
+     * When enabled, kernels are enqueued on a profiling command queue and the profiling event of
+     * every kernel enqueue is retained and folded into a report of accumulated GPU execution time
+     * per kernel, queryable through @ref kernel_timings. Events are processed in batches, off the
+     * enqueue path, to keep the host-side overhead low.
+     *
+     * @param[in] enable True to collect the GPU execution time of every enqueued kernel
+     */
+    void set_kernel_timing(bool enable);
+
+    /** Kernel timing status.
+     *
+     * @return True if per-kernel GPU times are being collected.
+     */
+    bool kernel_timing() const;
+
+    /** Per-kernel GPU execution times collected so far.
+     *
+     * Waits for any profiling event still pending before folding it into the report.
+     *
+     * @return Aggregated GPU execution times indexed by kernel function name
+     */
+    std::map<std::string, KernelTiming> kernel_timings();
+
+    /** Drops the per-kernel GPU times collected so far. */
+    void clear_kernel_timings();
+
     /** Blocks until all commands in the associated command queue have finished. */
     void sync();
 
@@ -151,7 +300,36 @@ public:
     bool is_initialised() const;
 
 private:
+    /** Pending events of the kernels accessing a buffer on the out-of-order queue */
+    struct BufferDependency
+    {
+        cl::Event              last_write{}; /**< Event of the last kernel writing the buffer */
+        std::vector<cl::Event> readers{};    /**< Events of the kernels reading the buffer since the last write */
+    };
+
     void enqueue_common(ICLKernel &kernel, ITensorPack &tensors, bool flush);
+    /** Recreate the command queue preserving its properties, with the configured priority and throttle hints */
+    void recreate_queue_with_hints();
+    /** Run a kernel on the out-of-order queue, ordered with event dependencies derived from @p tensors
+     *
+     * @param[in] kernel  Kernel to execute.
+     * @param[in] tensors Tensors the kernel operates on. If empty, the kernel is ordered after every command enqueued before it.
+     */
+    void enqueue_out_of_order(ICLKernel &kernel, ITensorPack &tensors);
+
+    /** Profiling event of a kernel enqueue awaiting aggregation */
+    struct PendingProfilingEvent
+    {
+        cl::Event   event{}; /**< Profiling event of the enqueue */
+        std::string name{};  /**< Kernel function name */
+    };
+
+    /** Fold the retained profiling events into the per-kernel report
+     *
+     * @param[in] wait If true, wait for every retained event; otherwise only completed events are folded and the rest stay pending.
+     */
+    void process_profiling_events(bool wait);
+
     /** Flag to ensure symbols initialisation is happening before Scheduler creation */
     static std::once_flag _initialize_symbols;
 
@@ -161,6 +339,20 @@ private:
     bool                      _is_initialised;
     ICLTuner                 *_cl_tuner;
     std::unique_ptr<ICLTuner> _cl_default_static_tuner;
+    std::map<cl_mem, BufferDependency> _buffer_dependencies;
+    cl::Event                          _untracked_event;
+    bool                               _out_of_order;
+    bool                               _job_chaining;
+    unsigned int                       _job_chaining_burst;
+    unsigned int                       _pending_enqueues;
+    CLQueuePriority                    _queue_priority;
+    CLQueueThrottle                    _queue_throttle;
+    bool                               _frame_budget;
+    unsigned int                       _frame_budget_batch;
+    std::function<decltype(clEnqueueNDRangeKernel)> _real_enqueue_ndrange;
+    std::vector<PendingProfilingEvent>              _pending_profiling_events;
+    std::map<std::string, KernelTiming>             _kernel_timings;
+    bool                                            _kernel_timing;
 };
 } // namespace arm_compute
 #endif /* ARM_COMPUTE_CLSCHEDULER_H */
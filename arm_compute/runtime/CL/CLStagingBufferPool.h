@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_CLSTAGINGBUFFERPOOL_H
+#define ARM_COMPUTE_CLSTAGINGBUFFERPOOL_H
+
+#include "arm_compute/core/CL/OpenCL.h"
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace arm_compute
+{
+// Forward declarations
+class CLRuntimeContext;
+
+/** Pool of pinned staging buffers for host<->device transfers.
+ *
+ * Mapping a regular (non-SVM) buffer makes the driver stage the data through
+ * internal bounce memory on every transfer. This pool keeps a small set of
+ * persistent CL_MEM_ALLOC_HOST_PTR buffers, mapped once at creation, and
+ * routes transfers through them: the host side copies into (or out of) the
+ * pinned mapping and the device side moves the data with a single DMA-backed
+ * read/write. The buffers are recycled across transfers, so steady-state
+ * uploads allocate nothing.
+ *
+ * Transfers are blocking: when upload()/download() returns, the caller's
+ * memory has been fully consumed/filled and the staging buffer is back in
+ * the pool.
+ */
+class CLStagingBufferPool final
+{
+public:
+    /** Constructor
+     *
+     * @param[in] ctx (Optional) Runtime context supplying the queue and CL context to use.
+     *                If nullptr, the legacy singletons are used instead.
+     */
+    CLStagingBufferPool(CLRuntimeContext *ctx = nullptr);
+    /** Destructor: unmaps and releases the pooled buffers */
+    ~CLStagingBufferPool();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLStagingBufferPool(const CLStagingBufferPool &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLStagingBufferPool &operator=(const CLStagingBufferPool &) = delete;
+
+    /** Copy host memory into a device buffer through a pinned staging buffer
+     *
+     * @param[out] dst  Device buffer to write to
+     * @param[in]  src  Host memory to read from
+     * @param[in]  size Number of bytes to transfer
+     */
+    void upload(const cl::Buffer &dst, const void *src, size_t size);
+    /** Copy a device buffer into host memory through a pinned staging buffer
+     *
+     * @param[out] dst  Host memory to write to
+     * @param[in]  src  Device buffer to read from
+     * @param[in]  size Number of bytes to transfer
+     */
+    void download(void *dst, const cl::Buffer &src, size_t size);
+
+private:
+    /** One pinned buffer with its persistent zero-copy mapping */
+    struct StagingBuffer
+    {
+        cl::Buffer buffer{};            /**< CL_MEM_ALLOC_HOST_PTR buffer */
+        size_t     size{ 0 };           /**< Allocated size in bytes */
+        void      *mapping{ nullptr };  /**< Persistent host mapping of the buffer */
+    };
+
+    /** Take a pinned buffer of at least the given size from the pool, creating one if needed */
+    StagingBuffer acquire(size_t size);
+    /** Return a pinned buffer to the pool, dropping it if the pool is full */
+    void release(StagingBuffer &&staging);
+    /** Queue transfers are issued on */
+    cl::CommandQueue &queue();
+    /** Context staging buffers are created in */
+    cl::Context &context();
+
+    CLRuntimeContext          *_ctx;
+    std::vector<StagingBuffer> _free{};
+    std::mutex                 _mutex{};
+};
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_CLSTAGINGBUFFERPOOL_H */
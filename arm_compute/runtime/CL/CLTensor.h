@@ -81,6 +81,24 @@ public:
      */
     void unmap();
     using ICLTensor::unmap;
+    /** Copy host memory into the tensor's buffer through the pinned staging buffer pool.
+     *
+     * Faster than map/memcpy/unmap for non-SVM allocations, as the driver doesn't
+     * have to stage the data through internal bounce memory. The host data must
+     * match the tensor's buffer layout, padding included. Blocking.
+     *
+     * @param[in] src  Host memory to read from.
+     * @param[in] size (Optional) Number of bytes to copy. If 0, the tensor's total size is copied.
+     */
+    void copy_from_host(const void *src, size_t size = 0);
+    /** Copy the tensor's buffer into host memory through the pinned staging buffer pool.
+     *
+     * The host memory receives the tensor's buffer layout, padding included. Blocking.
+     *
+     * @param[out] dst  Host memory to write to.
+     * @param[in]  size (Optional) Number of bytes to copy. If 0, the tensor's total size is copied.
+     */
+    void copy_to_host(void *dst, size_t size = 0) const;
 
     // Inherited methods overridden:
     TensorInfo       *info() const override;
@@ -121,6 +121,43 @@ public:
      * @return An error status
      */
     Status import_memory(cl::Buffer buffer);
+    /** Import caller-owned fine-grain coherent SVM memory as a tensor's backing memory
+     *
+     * The tensor accesses the memory zero-copy: map/unmap become no-ops and kernels read and write
+     * the caller's allocation directly.
+     *
+     * @warning memory must be fine-grain coherent SVM memory allocated under the same context that ACL uses.
+     * @warning memory is expected to be aligned with the device requirements.
+     * @warning tensor shouldn't be memory managed.
+     * @warning ownership of memory is not transferred.
+     * @warning memory must be writable in case of in-place operations
+     * @warning padding should be accounted by the client code.
+     * @note The memory must be at least as large as the total_size reported by ITensorInfo.
+     *
+     * @param[in] memory Host pointer to the SVM memory to be used as backing memory
+     *
+     * @return An error status
+     */
+    Status import_memory(void *memory);
+    /** Import a dma-buf as the tensor's backing memory (zero-copy)
+     *
+     * The buffer is wrapped through the cl_arm_import_memory extension, so kernels access the
+     * external allocation (e.g. a camera ISP frame) directly without a host map and copy.
+     *
+     * @warning Requires an OpenCL driver exposing the cl_arm_import_memory extension.
+     * @warning The dma-buf must stay valid for the lifetime of the import.
+     * @warning tensor shouldn't be memory managed.
+     * @warning ownership of the file descriptor is not transferred; the import holds its own reference to the underlying buffer.
+     * @warning memory must be writable in case of in-place operations
+     * @warning padding should be accounted by the client code.
+     * @note The size must be at least as large as the total_size reported by ITensorInfo.
+     *
+     * @param[in] fd   dma-buf file descriptor to import
+     * @param[in] size Size of the dma-buf in bytes
+     *
+     * @return An error status
+     */
+    Status import_dmabuf(int fd, size_t size);
     /** Associates the tensor with a memory group
      *
      * @param[in] associated_memory_group Memory group to associate the tensor with
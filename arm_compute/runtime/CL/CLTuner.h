@@ -27,13 +27,25 @@
 #include "arm_compute/core/CL/OpenCL.h"
 #include "arm_compute/runtime/CL/CLTunerTypes.h"
 #include "arm_compute/runtime/CL/ICLTuner.h"
+#include "arm_compute/runtime/CL/tuners/CLLWSList.h"
 
+#include <cstdint>
+#include <limits>
+#include <memory>
 #include <unordered_map>
 
 namespace arm_compute
 {
 class ICLKernel;
 
+/** Version tag stored alongside tuning parameters in the binary tuner file.
+ *
+ * Bump this value when kernel implementation changes invalidate previously tuned
+ * local workgroup sizes: partitions written with a different version are skipped
+ * on load instead of being misapplied.
+ */
+constexpr uint32_t cl_tuner_data_version = 1;
+
 /** Basic implementation of the OpenCL tuner interface */
 class CLTuner : public ICLTuner
 {
@@ -59,6 +71,22 @@ public:
      */
     bool tune_new_kernels() const;
 
+    /** Setter for the incremental tuning option
+     *
+     * When enabled, a kernel which is not in the LWS table is not tuned with a single blocking sweep:
+     * each run of the kernel benchmarks only a few LWS candidates and the best value found so far is
+     * swapped in, so the first inferences stay responsive while the sweep completes over several runs.
+     * Until the sweep completes the kernel runs with the static heuristic of the GPU target.
+     *
+     * @param[in] tune_incrementally Spread the tuning sweep of new kernels over multiple runs ?
+     */
+    void set_tune_incrementally(bool tune_incrementally);
+    /** Are tuning sweeps of new kernels spread over multiple runs ?
+     *
+     * @return True if incremental tuning is enabled.
+     */
+    bool tune_incrementally() const;
+
     /** Set OpenCL tuner mode
      *
      * @param[in] mode Indicates how exhaustive the search for the optimal LWS should be while tuning. Default is Exhaustive mode
@@ -102,12 +130,22 @@ public:
     std::function<decltype(clEnqueueNDRangeKernel)> real_clEnqueueNDRangeKernel;
 
     /** Load the LWS table from file
+     *
+     * The format is detected from the file content: binary tuner files ("ACLTUNE1")
+     * are memory-mapped and only the partition matching the active device and
+     * @ref cl_tuner_data_version is parsed, anything else is read as the legacy
+     * 'kernel_id;lws[0];lws[1];lws[2]' CSV format.
      *
      * @param[in] filename Load the LWS table from this file.(Must exist)
      */
     void load_from_file(const std::string &filename);
 
     /** Save the content of the LWS table to file
+     *
+     * Unless @p filename ends in ".csv" (legacy format), the table is written as a
+     * binary tuner file partitioned by device: partitions of other devices already
+     * present in the file are preserved, so one file can accumulate tuning
+     * parameters for a whole device farm.
      *
      * @param[in] filename Save the LWS table to this file. (Content will be overwritten)
      */
@@ -125,6 +163,15 @@ public:
     bool kernel_event_is_set() const;
 
 private:
+    /** State of a partially completed incremental tuning sweep */
+    struct IncrementalState
+    {
+        std::unique_ptr<cl_tuner::ICLLWSList> lws_list{ nullptr };                                /**< Candidate LWS values for the kernel */
+        size_t                                next_candidate{ 0 };                                /**< Index of the next candidate to benchmark */
+        cl_ulong                              best_time{ std::numeric_limits<cl_ulong>::max() }; /**< Execution time of the best LWS found so far */
+        cl::NDRange                           best_lws{};                                        /**< Best LWS found so far */
+    };
+
     /** Find optimal LWS using brute-force approach
      *
      * @param[in]     kernel  OpenCL kernel to be tuned with LWS
@@ -134,9 +181,50 @@ private:
      */
     cl::NDRange find_optimal_lws(ICLKernel &kernel, ITensorPack &tensors);
 
-    std::unordered_map<std::string, cl::NDRange> _lws_table;
+    /** Benchmark the next few LWS candidates of the sweep for the given kernel
+     *
+     * The sweep state is kept across calls; once the last candidate has been benchmarked the best
+     * LWS is inserted in the table and the state is dropped.
+     *
+     * @param[in]     kernel    OpenCL kernel to be tuned with LWS
+     * @param[in,out] tensors   Tensors for the kernel to operate on
+     * @param[in]     config_id Configuration id of the kernel
+     */
+    void tune_kernel_incremental(ICLKernel &kernel, ITensorPack &tensors, const std::string &config_id);
+
+    /** Run the kernel once on the profiling queue and return its execution time
+     *
+     * @note The OpenCL enqueue interceptor must be in place when this function is called
+     *
+     * @param[in]     kernel         OpenCL kernel to profile
+     * @param[in,out] tensors        Tensors for the kernel to operate on
+     * @param[in]     queue_profiler Queue with profiling enabled to run the kernel on
+     *
+     * @return The kernel execution time in nanoseconds
+     */
+    cl_ulong time_kernel(ICLKernel &kernel, ITensorPack &tensors, cl::CommandQueue &queue_profiler);
+
+    /** Find the LWS of the closest already-tuned entry with the same kernel signature
+     *
+     * The configuration id is decomposed into its non-numeric signature (the shape class) and its
+     * numeric shape tokens; among the tuned entries sharing the signature, the one closest in
+     * log-shape space provides the LWS. This gives near-tuned performance for unseen shapes
+     * without running a tuning sweep.
+     *
+     * @param[in]  config_id Configuration id of the kernel to look up
+     * @param[out] lws       Local workgroup size of the closest tuned entry
+     *
+     * @return True if a tuned entry with the same signature was found
+     */
+    bool find_similar_lws(const std::string &config_id, cl::NDRange &lws) const;
+
+    std::unordered_map<std::string, cl::NDRange>      _lws_table;
+    std::unordered_map<std::string, cl::NDRange>      _similar_lws_table;
+    std::unordered_map<std::string, IncrementalState> _tuning_states;
+    std::unique_ptr<ICLTuner>                         _static_tuner;
     cl::Event   _kernel_event;
     bool        _tune_new_kernels;
+    bool        _tune_incrementally;
     CLTunerMode _tuner_mode;
 };
 } // namespace arm_compute
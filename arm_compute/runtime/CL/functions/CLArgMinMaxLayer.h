@@ -85,13 +85,11 @@ public:
     void run() override;
 
 private:
-    MemoryGroup                         _memory_group;
-    std::vector<CLTensor>               _results_vector;
-    CLTensor                            _not_reshaped_output;
-    std::vector<CLArgMinMaxLayerKernel> _reduction_kernels_vector;
-    CLReshapeLayer                      _reshape;
-    unsigned int                        _num_of_stages;
-    unsigned int                        _reduction_axis;
+    MemoryGroup            _memory_group;
+    CLTensor               _not_reshaped_output;
+    CLArgMinMaxLayerKernel _reduction_kernel;
+    CLReshapeLayer         _reshape;
+    unsigned int           _reduction_axis;
 };
 } // namespace arm_compute
 #endif /* ARM_COMPUTE_CLARGMINMAXLAYER_H */
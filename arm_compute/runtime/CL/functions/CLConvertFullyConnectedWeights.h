@@ -99,6 +99,19 @@ public:
     {
         return _uid;
     }
+
+    //Inherited method override
+    uint64_t parameters_hash() override
+    {
+        // The converted output depends on the original input shape and layout, which do
+        // not fit in the uid bits
+        uint64_t hash = parameters_hash_seed;
+        for(size_t i = 0; i < _original_input_shape.num_dimensions(); ++i)
+        {
+            hash = combine_hash(hash, _original_input_shape[i]);
+        }
+        return combine_hash(hash, static_cast<uint64_t>(_data_layout));
+    }
     /** Configures the @ref CLConvertFullyConnectedWeights function
      *
      * @param[in] input                Source weights tensor info to convert.  Data type supported: All.
@@ -118,6 +131,8 @@ public:
      */
     void configure(const CLCompileContext &compile_context, const ICLTensor *input, const TensorShape &original_input_shape, DataLayout data_layout)
     {
+        _original_input_shape = original_input_shape;
+        _data_layout          = data_layout;
         _func.configure(compile_context, input, &_output, original_input_shape, data_layout);
     }
 
@@ -125,6 +140,8 @@ private:
     static constexpr uint32_t      _uid = 0x5;
     CLTensor                       _output{};
     CLConvertFullyConnectedWeights _func{};
+    TensorShape                    _original_input_shape{};
+    DataLayout                     _data_layout{ DataLayout::UNKNOWN };
 };
 } // namespace weights_transformations
 } // namespace arm_compute
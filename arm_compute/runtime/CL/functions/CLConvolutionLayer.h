@@ -71,8 +71,12 @@ namespace arm_compute
 class CLConvolutionLayer : public IFunction
 {
 public:
-    /** Default constructor */
-    CLConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    /** Default constructor
+     *
+     * @param[in] memory_manager  (Optional) Memory manager.
+     * @param[in] weights_manager (Optional) Weights manager.
+     */
+    CLConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager = nullptr, IWeightsManager *weights_manager = nullptr);
     /** Set the input and output tensors.
      *
      * @param[in]  input            Source tensor. 3 lower dimensions represent a single input [width, height, IFM],
@@ -167,6 +171,7 @@ public:
 
 private:
     std::shared_ptr<IMemoryManager> _memory_manager;
+    IWeightsManager                *_weights_manager;
     std::unique_ptr<IFunction>      _function;
 };
 }
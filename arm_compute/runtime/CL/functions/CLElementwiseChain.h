@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_CLELEMENTWISECHAIN_H
+#define ARM_COMPUTE_CLELEMENTWISECHAIN_H
+
+#include "arm_compute/core/CL/kernels/CLElementwiseChainKernel.h"
+#include "arm_compute/runtime/CL/ICLSimpleFunction.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+class ICLTensor;
+
+/** Basic function to run @ref CLElementwiseChainKernel
+ *
+ * Runs a chain of elementwise operations (e.g. Add->Mul->Sigmoid) as a single generated kernel,
+ * avoiding a global-memory round trip per operation.
+ */
+class CLElementwiseChain : public ICLSimpleFunction
+{
+public:
+    /** Initialise the kernel's inputs and output
+     *
+     * @param[in]  inputs   Input tensors. All tensors must have the same shape and data type. Data types supported: F16/F32.
+     * @param[out] output   Output tensor. Data type supported: same as @p inputs
+     * @param[in]  ops      Chain of operations to perform, one less than the number of inputs
+     * @param[in]  act_info (Optional) Activation to apply to the result of the chain. Only RELU, LOGISTIC and TANH are supported.
+     */
+    void configure(const std::vector<const ICLTensor *> &inputs, ICLTensor *output, const std::vector<ElementwiseChainOp> &ops, const ActivationLayerInfo &act_info = ActivationLayerInfo());
+    /** Static function to check if given info will lead to a valid configuration of @ref CLElementwiseChainKernel
+     *
+     * @param[in] inputs   Input tensor infos. All tensors must have the same shape and data type. Data types supported: F16/F32.
+     * @param[in] output   Output tensor info. Data type supported: same as @p inputs
+     * @param[in] ops      Chain of operations to perform, one less than the number of inputs
+     * @param[in] act_info (Optional) Activation to apply to the result of the chain. Only RELU, LOGISTIC and TANH are supported.
+     *
+     * @return a status
+     */
+    static Status validate(const std::vector<const ITensorInfo *> &inputs, const ITensorInfo *output, const std::vector<ElementwiseChainOp> &ops,
+                           const ActivationLayerInfo &act_info = ActivationLayerInfo());
+};
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_CLELEMENTWISECHAIN_H */
@@ -72,6 +72,20 @@ public:
         return _uid;
     }
 
+    //Inherited method override
+    uint64_t parameters_hash() override
+    {
+        // The reshaped output depends on the full RHS block geometry, which does not fit
+        // in the uid bits
+        uint64_t hash = parameters_hash_seed;
+        hash          = combine_hash(hash, _info.n0);
+        hash          = combine_hash(hash, _info.k0);
+        hash          = combine_hash(hash, _info.h0);
+        hash          = combine_hash(hash, static_cast<uint64_t>(_info.transpose));
+        hash          = combine_hash(hash, static_cast<uint64_t>(_info.interleave));
+        return combine_hash(hash, static_cast<uint64_t>(_info.export_to_cl_image));
+    }
+
     /** Configures the @ref CLGEMMReshapeRHSMatrixKernel kernel
      *
      * @param[in] input Input tensor. Data types supported: All
@@ -90,6 +104,7 @@ public:
      */
     void configure(const CLCompileContext &compile_context, const ICLTensor *input, GEMMRHSMatrixInfo info)
     {
+        _info = info;
         _kernel.configure(compile_context, input, &_output, info);
     }
 
@@ -97,6 +112,7 @@ private:
     static constexpr uint32_t    _uid = 0x15;
     CLTensor                     _output{};
     CLGEMMReshapeRHSMatrixKernel _kernel{};
+    GEMMRHSMatrixInfo            _info{};
 };
 } // namespace weights_transformations
 
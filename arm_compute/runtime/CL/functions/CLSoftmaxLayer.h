@@ -47,7 +47,8 @@ class ICLTensor;
  * @f[ out = (x - max(x) * beta) - log(\sum{e^{x - max(x) * beta}}) @f]
  *
  * This function runs the following kernels:
- * -# @ref CLLogits1DNormKernel
+ * -# @ref CLLogits1DFusedSoftmaxKernel if the configuration is eligible for the single-launch fused kernel
+ * -# @ref CLLogits1DMaxShiftExpSumKernel and @ref CLLogits1DNormKernel otherwise
  */
 template <bool IS_LOG = false>
 class CLSoftmaxLayerGeneric : public IFunction
@@ -116,6 +117,7 @@ private:
     MemoryGroup                    _memory_group;
     CLLogits1DMaxShiftExpSumKernel _max_shift_exp_sum_kernel;
     CLLogits1DNormKernel           _norm_kernel;
+    CLLogits1DFusedSoftmaxKernel   _fused_kernel;
     std::unique_ptr<IFunction>     _flatten_ptr;
     CLReshapeLayer                 _reshape;
     CLTensor                       _max;
@@ -124,6 +126,7 @@ private:
     CLTensor                       _input_flattened;
     CLTensor                       _output_flattened;
     bool                           _needs_flattening;
+    bool                           _run_fused;
 };
 
 using CLSoftmaxLayer    = CLSoftmaxLayerGeneric<false>;
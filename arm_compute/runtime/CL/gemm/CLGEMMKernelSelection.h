@@ -27,8 +27,10 @@
 #include "arm_compute/runtime/CL/ICLGEMMKernelSelection.h"
 #include "arm_compute/runtime/CL/gemm/CLGEMMKernelSelectionBifrost.h"
 #include "arm_compute/runtime/CL/gemm/CLGEMMKernelSelectionMidgard.h"
+#include "arm_compute/runtime/CL/gemm/CLGEMMKernelSelectionTable.h"
 #include "arm_compute/runtime/CL/gemm/CLGEMMKernelSelectionValhall.h"
 
+#include <cstdlib>
 #include <memory>
 
 namespace arm_compute
@@ -47,17 +49,31 @@ public:
      */
     static std::unique_ptr<ICLGEMMKernelSelection> create(GPUTarget gpu)
     {
+        std::unique_ptr<ICLGEMMKernelSelection> selection = nullptr;
         switch(get_arch_from_target(gpu))
         {
             case GPUTarget::MIDGARD:
-                return support::cpp14::make_unique<CLGEMMKernelSelectionMidgard>(gpu);
+                selection = support::cpp14::make_unique<CLGEMMKernelSelectionMidgard>(gpu);
+                break;
             case GPUTarget::BIFROST:
-                return support::cpp14::make_unique<CLGEMMKernelSelectionBifrost>(gpu);
+                selection = support::cpp14::make_unique<CLGEMMKernelSelectionBifrost>(gpu);
+                break;
             case GPUTarget::VALHALL:
-                return support::cpp14::make_unique<CLGEMMKernelSelectionValhall>(gpu);
+                selection = support::cpp14::make_unique<CLGEMMKernelSelectionValhall>(gpu);
+                break;
             default:
                 ARM_COMPUTE_ERROR("Not supported GPU target");
         }
+
+        // Override the heuristic with a selection table if one is provided, keeping the heuristic as fallback
+        const char *table_file = std::getenv("ARM_COMPUTE_CL_GEMM_SELECTION_FILE");
+        if(table_file != nullptr)
+        {
+            auto table = support::cpp14::make_unique<CLGEMMKernelSelectionTable>(gpu, std::move(selection));
+            table->load_from_file(table_file);
+            selection = std::move(table);
+        }
+        return selection;
     }
 };
 } // namespace cl_gemm
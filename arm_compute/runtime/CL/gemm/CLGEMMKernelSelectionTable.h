@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_CLGEMMKERNELSELECTIONTABLE_H
+#define ARM_COMPUTE_CLGEMMKERNELSELECTIONTABLE_H
+
+#include "arm_compute/runtime/CL/ICLGEMMKernelSelection.h"
+
+#include <map>
+#include <memory>
+#include <string>
+
+namespace arm_compute
+{
+namespace cl_gemm
+{
+/** Decision-table driven OpenCL GEMMKernel selection
+ *
+ * Selects the GEMM kernel type from a table loaded at runtime instead of the compiled-in
+ * heuristics, so per-device selections obtained from benchmark sweeps (e.g. with the gemm_tuner
+ * tools) can be shipped and updated without rebuilding the library. GEMM shapes without a table
+ * entry fall back to the architecture heuristic passed at construction time.
+ *
+ * The table file contains one entry per line:
+ *
+ *     # data_type m n k is_rhs_constant kernel_type
+ *     F32 8 576 64 1 reshaped_only_rhs
+ *
+ * Lines starting with '#' are ignored. Such a file can be generated from gemm_tuner benchmark
+ * results with examples/gemm_tuner/GemmSelectionTable.py
+ */
+class CLGEMMKernelSelectionTable final : public ICLGEMMKernelSelection
+{
+public:
+    /** Constructor
+     *
+     * @param[in] gpu      GPU target
+     * @param[in] fallback Selection heuristic to use for shapes not present in the table
+     */
+    CLGEMMKernelSelectionTable(GPUTarget gpu, std::unique_ptr<ICLGEMMKernelSelection> fallback);
+    /** Load the selection table from a file
+     *
+     * An error is thrown if the file cannot be opened or contains malformed entries.
+     *
+     * @param[in] filename Path to the selection table file.
+     */
+    void load_from_file(const std::string &filename);
+
+    // Inherited overridden method
+    CLGEMMKernelType select_kernel(const CLGEMMKernelSelectionParams &params) override;
+
+private:
+    std::map<std::string, CLGEMMKernelType> _table;    /**< Selection table keyed by GEMM shape and data type */
+    std::unique_ptr<ICLGEMMKernelSelection> _fallback; /**< Heuristic used for shapes not present in the table */
+};
+} // namespace cl_gemm
+} // namespace arm_compute
+#endif /*ARM_COMPUTE_CLGEMMKERNELSELECTIONTABLE_H */
@@ -47,12 +47,32 @@ public:
      */
     static CPPScheduler &get();
 
+    /** Scheduling priority of the workloads submitted by an application thread */
+    enum class Priority
+    {
+        NORMAL, /**< Default priority, cooperatively yields to pending HIGH priority requests */
+        HIGH    /**< Latency-critical priority, preempts NORMAL runs at the next workload boundary */
+    };
+
+    /** Set the scheduling priority of the kernels scheduled by the calling application thread
+     *
+     * While a HIGH priority request is waiting, NORMAL priority runs stop handing out
+     * further workloads at the next workload boundary, release the thread pool to the
+     * waiting request and resume their remaining workloads afterwards. The preemption
+     * latency is therefore bounded by the duration of one workload rather than by the
+     * duration of the whole kernel.
+     *
+     * @param[in] priority Priority to use for subsequent kernels scheduled by this thread.
+     */
+    static void set_priority(Priority priority);
+
     // Inherited functions overridden
     void set_num_threads(unsigned int num_threads) override;
     void set_num_threads_with_affinity(unsigned int num_threads, BindFunc func) override;
     unsigned int num_threads() const override;
     void schedule(ICPPKernel *kernel, const Hints &hints) override;
     void schedule_op(ICPPKernel *kernel, const Hints &hints, ITensorPack &tensors) override;
+    void warmup() override;
 
 protected:
     /** Will run the workloads in parallel using num_threads
@@ -62,6 +82,12 @@ protected:
     void run_workloads(std::vector<Workload> &workloads) override;
 
 private:
+    /** Will run the workloads in parallel using at most max_threads of the pool
+     *
+     * @param[in] workloads   Workloads to run
+     * @param[in] max_threads Upper bound on the number of threads used for this run
+     */
+    void run_workloads(std::vector<Workload> &workloads, unsigned int max_threads);
     void schedule_common(ICPPKernel *kernel, const Hints &hints, ITensorPack &tensors);
     struct Impl;
     std::unique_ptr<Impl> _impl;
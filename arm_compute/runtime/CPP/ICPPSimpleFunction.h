@@ -26,6 +26,7 @@
 
 #include "arm_compute/core/CPP/ICPPKernel.h"
 #include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IRuntimeContext.h"
 
 #include <memory>
 
@@ -35,14 +36,18 @@ namespace arm_compute
 class ICPPSimpleFunction : public IFunction
 {
 public:
-    /** Constructor */
-    ICPPSimpleFunction();
+    /** Constructor
+     *
+     * @param[in] ctx Runtime context to be used by the function
+     */
+    ICPPSimpleFunction(IRuntimeContext *ctx = nullptr);
 
     // Inherited methods overridden:
     void run() override final;
 
 protected:
     std::unique_ptr<ICPPKernel> _kernel; /**< Kernel to run */
+    IRuntimeContext            *_ctx;    /**< Context to use */
 };
 } // namespace arm_compute
 #endif /*ARM_COMPUTE_ICPPSIMPLEFUNCTION_H */
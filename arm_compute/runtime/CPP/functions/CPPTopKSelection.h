@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_CPPTOPKSELECTION_H
+#define ARM_COMPUTE_CPPTOPKSELECTION_H
+
+#include "arm_compute/runtime/CPP/ICPPSimpleFunction.h"
+
+#include "arm_compute/core/Types.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Basic function to run @ref CPPTopKSelectionKernel */
+class CPPTopKSelection : public ICPPSimpleFunction
+{
+public:
+    /** Set the input and outputs of the kernel.
+     *
+     * @param[in]  scores  A classes x batch_size tensor of scores. Data types supported: F16/S32/F32/QASYMM8/QASYMM8_SIGNED
+     * @param[out] values  Top @p k scores of each row, sorted in descending order. A k x batch_size tensor. Data types supported: same as @p scores
+     * @param[out] indices Class indices of the top @p k scores of each row. A k x batch_size tensor. Data types supported: U32
+     * @param[in]  k       Number of elements to select per row. Must not exceed the number of classes.
+     */
+    void configure(const ITensor *scores, ITensor *values, ITensor *indices, const unsigned int k);
+
+    /** Static function to check if given info will lead to a valid configuration of @ref CPPTopKSelectionKernel
+     *
+     * @param[in] scores  A classes x batch_size tensor info of scores. Data types supported: F16/S32/F32/QASYMM8/QASYMM8_SIGNED
+     * @param[in] values  Top @p k scores of each row, sorted in descending order. A k x batch_size tensor info. Data types supported: same as @p scores
+     * @param[in] indices Class indices of the top @p k scores of each row. A k x batch_size tensor info. Data types supported: U32
+     * @param[in] k       Number of elements to select per row. Must not exceed the number of classes.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *scores, const ITensorInfo *values, const ITensorInfo *indices, const unsigned int k);
+};
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_CPPTOPKSELECTION_H */
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_CONST_TENSOR_STORE_H
+#define ARM_COMPUTE_CONST_TENSOR_STORE_H
+
+#include "arm_compute/runtime/MemoryRegion.h"
+#include "support/Mutex.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <utility>
+
+namespace arm_compute
+{
+/** Process-level store of const tensor contents, deduplicated by hash
+ *
+ * Identical weight buffers (e.g. a backbone shared by several network variants) are
+ * stored once and handed out as shared read-only references. Complements the
+ * transformed-weights deduplication of @ref IWeightsManager, which shares the
+ * @ref ITransformWeights outputs but not the raw weights they were derived from.
+ *
+ * Buffers handed out stay valid until @ref clear is called, which must only happen once
+ * no tensor references them anymore.
+ */
+class ConstTensorStore final
+{
+public:
+    /** Access the process-level store
+     *
+     * @return The store
+     */
+    static ConstTensorStore &get();
+    /** Prevent instances of this class from being copied */
+    ConstTensorStore(const ConstTensorStore &) = delete;
+    /** Prevent instances of this class from being copied */
+    ConstTensorStore &operator=(const ConstTensorStore &) = delete;
+
+    /** Returns a shared buffer holding the given contents
+     *
+     * The first caller with given contents populates the store with a copy; subsequent
+     * callers with identical contents receive the stored copy. On the (theoretical) case
+     * of a hash collision with different contents the caller's own buffer is returned.
+     *
+     * @param[in] data Contents to deduplicate
+     * @param[in] size Size of the contents in bytes
+     *
+     * @return A buffer holding the contents, shared between all callers. Must not be written to.
+     */
+    const void *deduplicate(const void *data, size_t size);
+    /** Number of distinct buffers held by the store
+     *
+     * @return Number of buffers
+     */
+    size_t num_buffers() const;
+    /** Bytes saved by handing out already stored buffers
+     *
+     * @return Saved bytes
+     */
+    size_t bytes_saved() const;
+    /** Drops all stored buffers
+     *
+     * @pre No tensor may still reference a stored buffer
+     */
+    void clear();
+
+private:
+    /** Constructor */
+    ConstTensorStore() = default;
+
+    std::map<std::pair<uint64_t, size_t>, std::unique_ptr<MemoryRegion>> _store{}; /**< Stored buffers, keyed by (content hash, size) */
+    size_t                     _bytes_saved{ 0 };                                  /**< Bytes saved through sharing */
+    mutable arm_compute::Mutex _mtx{};                                             /**< Mutex guarding the store */
+};
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_CONST_TENSOR_STORE_H */
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_HUGE_PAGE_ALLOCATOR_H
+#define ARM_COMPUTE_HUGE_PAGE_ALLOCATOR_H
+
+#include "arm_compute/runtime/IAllocator.h"
+
+#include "arm_compute/runtime/IMemoryRegion.h"
+
+#include <cstddef>
+#include <map>
+#include <mutex>
+
+namespace arm_compute
+{
+/** Huge-page backed arena allocator implementation
+ *
+ * Backs each allocation with a single anonymous mapping of explicit huge pages
+ * (MAP_HUGETLB) and falls back to regular pages advised as transparent huge
+ * page candidates (MADV_HUGEPAGE) when no huge pages are reserved. As
+ * @ref OffsetMemoryPool places all managed tensors at offsets in one blob,
+ * populating a @ref MemoryManagerOnDemand with this allocator maps the whole
+ * working set with a handful of TLB entries, reducing dTLB pressure in
+ * convolution layers.
+ *
+ * Alignments larger than the huge page size are honoured by over-mapping and
+ * aligning the returned pointer within the mapping.
+ */
+class HugePageAllocator final : public IAllocator
+{
+public:
+    /** Constructor
+     *
+     * @param[in] huge_page_size (Optional) Huge page size in bytes the mappings are sized and
+     *                           aligned to. Defaults to 2MB, the common size on AArch64 Linux.
+     */
+    HugePageAllocator(size_t huge_page_size = 2 * 1024 * 1024);
+
+    // Inherited methods overridden:
+    void *allocate(size_t size, size_t alignment) override;
+    void free(void *ptr) override;
+    std::unique_ptr<IMemoryRegion> make_region(size_t size, size_t alignment) override;
+
+private:
+    /** Backing mapping of a live allocation, needed to unmap */
+    struct Mapping
+    {
+        void  *base{ nullptr };  /**< Base address of the mapping */
+        size_t mapped_bytes{ 0 }; /**< Size of the mapping */
+    };
+
+    size_t _huge_page_size;
+    std::map<void *, Mapping> _allocations; /**< Mapping of each live allocation, keyed by the aligned pointer handed out */
+    std::mutex                _allocations_mutex;
+};
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_HUGE_PAGE_ALLOCATOR_H */
@@ -24,6 +24,8 @@
 #ifndef ARM_COMPUTE_IFUNCTION_H
 #define ARM_COMPUTE_IFUNCTION_H
 
+#include <future>
+
 namespace arm_compute
 {
 /** Base class for all functions */
@@ -48,6 +50,26 @@ public:
      * @note Will call prepare() on first run if hasn't been done
      */
     virtual void run() = 0;
+    /** Enqueue the function for asynchronous execution
+     *
+     * The default implementation dispatches run() to an executor thread and returns
+     * immediately, which allows independent functions to be issued back-to-back and
+     * overlapped with host-side work (e.g. pre-processing of the next request).
+     *
+     * @note Functions sharing the same scheduler still serialize at kernel granularity.
+     * @note The caller must not reconfigure the function or modify its inputs until the
+     *       returned future becomes ready.
+     *
+     * @return A future that becomes ready once the function's kernels have executed.
+     *         Exceptions thrown during execution are rethrown by future::get().
+     */
+    virtual std::future<void> run_async()
+    {
+        return std::async(std::launch::async, [this]()
+        {
+            run();
+        });
+    }
     /** Prepare the function for executing
      *
      * Any one off pre-processing step required by the function is handled here
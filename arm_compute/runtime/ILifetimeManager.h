@@ -85,6 +85,15 @@ public:
      * @return Mapping type of the lifetime manager
      */
     virtual MappingType mapping_type() const = 0;
+    /** Reports the memory plan of the finalized groups
+     *
+     * Exposes the pool size, the high-water mark of concurrently live bytes and the
+     * placement and lifetime span of every managed object, so peak-memory questions can
+     * be answered without a debugger.
+     *
+     * @return Memory requirements report
+     */
+    virtual MemoryReport report() const = 0;
 };
 } // namespace arm_compute
 #endif /* ARM_COMPUTE_ILIFETIMEMANAGER_H */
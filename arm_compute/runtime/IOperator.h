@@ -57,6 +57,18 @@ public:
     /** Return the memory requirements required by the workspace
      */
     virtual MemoryRequirements workspace() const = 0;
+    /** Indicates whether the operator can run with a destination aliasing a source
+     *
+     * Operators reporting true accept packs where a destination is the same buffer as a
+     * source, as long as the alias is exact; partially overlapping tensors are never
+     * valid. Defaults to false.
+     *
+     * @return True if in-place execution is supported
+     */
+    virtual bool supports_in_place() const
+    {
+        return false;
+    }
 };
 } // namespace experimental
 } // namespace arm_compute
@@ -29,6 +29,7 @@ namespace arm_compute
 // Forward declarations
 class IScheduler;
 class IAssetManager;
+class OperatorKernelCache;
 struct DeviceProperties;
 
 /** Context interface */
@@ -56,6 +57,14 @@ public:
      * @return Device properties
      */
     virtual const DeviceProperties &properties() = 0;
+    /** Kernel cache accessor
+     *
+     * @note The kernel cache shares configured stateless kernels between operators
+     *       created against this context
+     *
+     * @return The kernel cache registered to the context. Nullptr if the context does not cache kernels
+     */
+    virtual OperatorKernelCache *kernel_cache() = 0;
 };
 } // namespace arm_compute
 #endif /*ARM_COMPUTE_IRUNTIME_CONTEXT_H */
@@ -181,6 +181,14 @@ public:
      */
     virtual void run_tagged_workloads(std::vector<Workload> &workloads, const char *tag);
 
+    /** Warm the scheduler up ahead of the first kernel dispatch
+     *
+     * Spawns, binds and parks the worker threads (including first-touch of their stacks)
+     * so the first inference doesn't pay the thread creation cost. The default
+     * implementation is a no-op for schedulers without a persistent pool.
+     */
+    virtual void warmup();
+
     /** Get CPU info.
      *
      * @return CPU info.
@@ -61,12 +61,9 @@ public:
     void start_lifetime(void *obj) override;
     void end_lifetime(void *obj, IMemory &obj_memory, size_t size, size_t alignment) override;
     bool are_all_finalized() const override;
+    MemoryReport report() const override;
 
-protected:
-    /** Update blobs and mappings */
-    virtual void update_blobs_and_mappings() = 0;
-
-protected:
+public:
     /** Element struct */
     struct Element
     {
@@ -79,8 +76,32 @@ protected:
         size_t   size;      /**< Element's size */
         size_t   alignment; /**< Alignment requirement */
         bool     status;    /**< Lifetime status */
+        size_t   start_serial{ 0 }; /**< Serial at which the lifetime started */
+        size_t   end_serial{ 0 };   /**< Serial at which the lifetime ended */
     };
 
+    /** Finalized elements of all groups, in lifetime-start order
+     *
+     * @return Finalized elements
+     */
+    std::vector<Element> finalized_elements() const;
+    /** Current value of the lifetime serial counter
+     *
+     * @return Lifetime serial
+     */
+    size_t lifetime_serial() const;
+    /** Releases all finalized groups, clearing their mappings
+     *
+     * Used when the registered lifetimes have been transferred to another manager and the
+     * groups must no longer acquire memory of their own.
+     */
+    void release_all_groups();
+
+protected:
+    /** Update blobs and mappings */
+    virtual void update_blobs_and_mappings() = 0;
+
+protected:
     /** Blob struct */
     struct Blob
     {
@@ -95,6 +116,7 @@ protected:
     std::list<Blob> _free_blobs;                                           /**< Free blobs */
     std::list<Blob> _occupied_blobs;                                       /**< Occupied blobs */
     std::map<IMemoryGroup *, std::map<void *, Element>> _finalized_groups; /**< A map that contains the finalized groups */
+    size_t _lifetime_serial;                                               /**< Monotonic serial stamping lifetime start/end events */
 };
 } // namespace arm_compute
 #endif /* ARM_COMPUTE_ISIMPLELIFETIMEMANAGER_H */
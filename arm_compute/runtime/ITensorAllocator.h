@@ -26,6 +26,7 @@
 
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/Types.h"
 
 #include <cstdint>
 
@@ -69,6 +70,19 @@ public:
      * @return Tensor buffer alignment
      */
     size_t alignment() const;
+    /** Set the page commitment policy applied on allocation
+     *
+     * @note Only honoured for memory the allocator owns; memory provided by a memory
+     *       group is committed by its pool's allocator instead.
+     *
+     * @param[in] policy Policy to apply
+     */
+    void set_allocation_policy(AllocationPolicy policy);
+    /** Return the page commitment policy applied on allocation
+     *
+     * @return Allocation policy
+     */
+    AllocationPolicy allocation_policy() const;
 
     /** Interface to be implemented by the child class to allocate the tensor.
      *
@@ -93,8 +107,9 @@ protected:
     virtual void unlock() = 0;
 
 private:
-    TensorInfo _info;      /**< Tensor's metadata. */
-    size_t     _alignment; /**< Tensor's alignment in bytes */
+    TensorInfo       _info;              /**< Tensor's metadata. */
+    size_t           _alignment;         /**< Tensor's alignment in bytes */
+    AllocationPolicy _allocation_policy; /**< Page commitment policy applied on allocation */
 };
 } // namespace arm_compute
 #endif /*ARM_COMPUTE_ITENSORALLOCATOR_H */
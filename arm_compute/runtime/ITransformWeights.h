@@ -25,6 +25,7 @@
 #define ARM_COMPUTE_ITRANSFORMWEIGHTS_H
 
 #include <atomic>
+#include <cstdint>
 
 namespace arm_compute
 {
@@ -90,10 +91,39 @@ public:
      * @return The computed unique id
      */
     virtual uint32_t uid() = 0;
+    /** Hash of the parameters the transformed output depends on, beyond the source contents
+     *
+     * Transforms parametrized beyond what fits in the @ref uid bits (e.g. a conversion's
+     * original input shape or a reshape geometry) mix those parameters into this hash, so
+     * that content deduplication and the transformed-weights cache can tell their outputs
+     * apart. Built with @ref combine_hash starting from @ref parameters_hash_seed.
+     *
+     * @return The parametrization hash; 0 when the transform is fully identified by its uid
+     */
+    virtual uint64_t parameters_hash()
+    {
+        return 0;
+    }
     /** Run the transformation function */
     virtual void run() = 0;
     /** Release transformed weights memory */
     virtual void release() = 0;
+    /** Allocate the transformed weights tensor without running the transformation
+     *
+     * Used when the transformed contents are restored from a cache instead of being computed,
+     * in which case @ref mark_as_run has to be called once the tensor has been filled.
+     *
+     * @return True if the backing memory was allocated and is host accessible
+     */
+    virtual bool allocate_only()
+    {
+        return false;
+    }
+    /** Mark the transformation as already run, e.g. after restoring the transformed contents from a cache */
+    void mark_as_run()
+    {
+        _reshape_run = true;
+    }
     /** Increase the object's refcount */
     void increase_refcount()
     {
@@ -119,6 +149,21 @@ public:
     }
 
 protected:
+    /** Seed of a transform parametrization hash (FNV-1a offset basis) */
+    static constexpr uint64_t parameters_hash_seed = 0xcbf29ce484222325ULL;
+
+    /** Mix a value into a transform parametrization hash (FNV-1a)
+     *
+     * @param[in] hash  Hash accumulated so far, seeded with @ref parameters_hash_seed
+     * @param[in] value Value to mix in
+     *
+     * @return The updated hash
+     */
+    static uint64_t combine_hash(uint64_t hash, uint64_t value)
+    {
+        return (hash ^ value) * 0x100000001b3ULL;
+    }
+
     std::atomic<int32_t> _num_refcount{ 0 };
     bool                 _reshape_run{ false };
 };
@@ -26,13 +26,22 @@
 #define ARM_COMPUTE_IWEIGHTSMANAGER_H
 
 #include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/utils/misc/MMappedFile.h"
 #include "arm_compute/runtime/ITransformWeights.h"
+#include "support/Mutex.h"
 
 #include <map>
+#include <string>
+#include <tuple>
+#include <utility>
 
 namespace arm_compute
 {
-/** Weights manager interface to handle weights transformations */
+/** Weights manager interface to handle weights transformations
+ *
+ * @note All public methods are thread-safe, so functions sharing one manager can run
+ *       their prepare stage concurrently.
+ */
 class IWeightsManager
 {
 public:
@@ -76,10 +85,49 @@ public:
      * @return True if the weights tensor is managed else false
      */
     bool are_weights_managed(const ITensor *weights);
+    /** Store the transformed weights computed so far to a cache file
+     *
+     * Only transformed tensors whose memory is host accessible are stored; device-side
+     * tensors (e.g. unmapped OpenCL buffers) are skipped.
+     *
+     * @param[in] filename File the transformed weights are written to
+     *
+     * @return True if the cache file was written successfully
+     */
+    bool save_transformed_weights(const std::string &filename);
+    /** Reload transformed weights from a cache file written by @ref save_transformed_weights
+     *
+     * The file is memory mapped and stays mapped while the manager is alive, so its pages are
+     * shared with the page cache and faulted in on demand. Subsequent @ref run calls whose
+     * source weights hash to a cached entry restore the transformed contents with a copy
+     * instead of running the reshape function.
+     *
+     * @note Not supported on bare metal targets.
+     *
+     * @param[in] filename File to reload the transformed weights from
+     *
+     * @return True if the cache file was mapped and parsed successfully
+     */
+    bool load_transformed_weights(const std::string &filename);
 
 private:
+    /** Key identifying a transformed-weights allocation by content rather than identity:
+     *  content hash, original size in bytes, transform uid, hash of the source tensor's
+     *  description (shape, data type, layout) and the transform's parametrization hash.
+     *  The description and parametrization components keep byte-identical buffers that are
+     *  interpreted differently (e.g. transposed shapes, different conversion parameters)
+     *  from sharing one transformed allocation. */
+    using ContentKey = std::tuple<uint64_t, size_t, uint32_t, uint64_t, uint64_t>;
+
+    mutable arm_compute::Mutex _mutex; /**< Protects the maps below against concurrent prepare calls */
+
     std::map<const ITensor *, std::vector<ITransformWeights *>> _managed_weights;
     std::map<const ITensor *, ITransformWeights *>              _managed_weights_parents;
+    std::map<ContentKey, ITensor *>                             _deduplicated_weights; /**< Shared pretransposed buffers for content-identical weights */
+    std::map<ContentKey, std::pair<const uint8_t *, size_t>>    _preloaded_weights;    /**< Transformed contents reloaded from a cache file, pointing into the mapping */
+#if !defined(BARE_METAL)
+    utils::mmap_io::MMappedFile _preloaded_file; /**< Mapping backing the preloaded transformed weights */
+#endif /* !defined(BARE_METAL) */
 };
 } // arm_compute
 #endif /*ARM_COMPUTE_IWEIGHTSMANAGER_H */
\ No newline at end of file
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_RUNTIME_KERNEL_PMU_PROFILER_H
+#define ARM_COMPUTE_RUNTIME_KERNEL_PMU_PROFILER_H
+
+#include "support/Mutex.h"
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+namespace arm_compute
+{
+/** Runtime-attachable PMU profiler
+ *
+ * Samples the cycle, instruction and cache-miss hardware counters of the
+ * executing thread around each scheduled kernel and aggregates the deltas per
+ * kernel name (or workload tag). Activated by setting the
+ * ARM_COMPUTE_PMU_FILE environment variable to the report path; the per-kernel
+ * table, including derived IPC and misses-per-kilo-instruction columns, is
+ * written when the process exits, or earlier through @ref dump(). When the
+ * variable is not set the only cost on the execution path is a boolean check.
+ *
+ * @note Counter attachment uses perf_event_open and is only available on Linux;
+ *       kernels whose counters cannot be opened report zero deltas.
+ */
+class KernelPMUProfiler final
+{
+public:
+    /** Hardware counter readings of one thread */
+    struct Sample
+    {
+        uint64_t cycles{ 0 };       /**< CPU cycles */
+        uint64_t instructions{ 0 }; /**< Retired instructions */
+        uint64_t cache_misses{ 0 }; /**< Last-level cache misses */
+    };
+    /** Aggregated counter deltas of one kernel */
+    struct Aggregate
+    {
+        uint64_t calls{ 0 };        /**< Number of recorded executions */
+        uint64_t cycles{ 0 };       /**< Accumulated CPU cycles */
+        uint64_t instructions{ 0 }; /**< Accumulated retired instructions */
+        uint64_t cache_misses{ 0 }; /**< Accumulated last-level cache misses */
+    };
+
+    /** Process-level profiler accessor
+     *
+     * @return Profiler instance
+     */
+    static KernelPMUProfiler &get();
+    /** True if the profiler has been activated through the environment */
+    static bool is_enabled();
+    /** Sample the counters of the calling thread ahead of a kernel execution */
+    void begin();
+    /** Sample the counters of the calling thread after a kernel execution and aggregate the delta
+     *
+     * @param[in] name Name of the kernel or workload tag to aggregate under
+     */
+    void end(const char *name);
+    /** Aggregated counter deltas keyed by kernel name */
+    std::map<std::string, Aggregate> aggregates() const;
+    /** Write the aggregated counters as a per-kernel report
+     *
+     * @param[in] filename File to write the report to
+     */
+    void dump(const std::string &filename) const;
+    /** Discard all aggregated counters */
+    void clear();
+
+private:
+    KernelPMUProfiler() = default;
+    ~KernelPMUProfiler();
+
+    mutable arm_compute::Mutex       _mutex{};
+    std::map<std::string, Aggregate> _aggregates{};
+};
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_RUNTIME_KERNEL_PMU_PROFILER_H */
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_RUNTIME_KERNEL_PROFILER_H
+#define ARM_COMPUTE_RUNTIME_KERNEL_PROFILER_H
+
+#include "arm_compute/core/TracePoint.h"
+#include "arm_compute/runtime/KernelPMUProfiler.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+/** Runtime-attachable kernel profiler
+ *
+ * Records per-kernel execution intervals (one strip per scheduler thread) into
+ * a preallocated lock-free ring buffer and dumps them as a chrome://tracing
+ * JSON timeline. The profiler is activated by setting the
+ * ARM_COMPUTE_TRACE_FILE environment variable to the dump path; the trace is
+ * written when the process exits, or earlier through @ref dump(). When the
+ * variable is not set the only cost on the execution path is a boolean check.
+ *
+ * @note Recorded names are stored as pointers and must outlive the profiler,
+ *       which holds for kernel names and tag string literals.
+ */
+class KernelProfiler final
+{
+public:
+    static constexpr unsigned int capacity = 1u << 18; /**< Number of event slots in the ring buffer; older events get overwritten */
+
+    /** One recorded kernel execution interval */
+    struct Event
+    {
+        const char *name{ nullptr };  /**< Name of the kernel or workload tag */
+        uint64_t    start_ns{ 0 };    /**< Start timestamp in nanoseconds */
+        uint64_t    end_ns{ 0 };      /**< End timestamp in nanoseconds */
+        int32_t     thread_id{ 0 };   /**< Scheduler thread the interval ran on */
+    };
+
+    /** Process-level profiler accessor
+     *
+     * @return Profiler instance
+     */
+    static KernelProfiler &get();
+    /** True if the profiler has been activated through the environment */
+    static bool is_enabled();
+    /** Current timestamp in nanoseconds */
+    static uint64_t now_ns()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+    /** Record a kernel execution interval
+     *
+     * Lock-free; safe to call concurrently from the scheduler threads.
+     *
+     * @param[in] name      Name of the kernel or workload tag. Has to outlive the profiler
+     * @param[in] start_ns  Start timestamp in nanoseconds
+     * @param[in] end_ns    End timestamp in nanoseconds
+     * @param[in] thread_id Scheduler thread the interval ran on
+     */
+    void record(const char *name, uint64_t start_ns, uint64_t end_ns, int32_t thread_id);
+    /** Write the recorded events as chrome://tracing JSON
+     *
+     * @param[in] filename File to write the timeline to
+     */
+    void dump(const std::string &filename) const;
+    /** Discard all recorded events */
+    void clear();
+
+private:
+    KernelProfiler();
+    ~KernelProfiler();
+
+    std::vector<Event>    _events;
+    std::atomic<uint64_t> _next;
+};
+
+/** Records the execution interval of the enclosing scope into the @ref KernelProfiler,
+ * its hardware counter deltas into the @ref KernelPMUProfiler and its enter/exit
+ * events into the @ref TraceLog
+ *
+ * Does nothing when all three are disabled.
+ */
+class ScopedKernelProfile final
+{
+public:
+    /** Constructor
+     *
+     * @param[in] name      Name of the kernel or workload tag. Has to outlive the profiler
+     * @param[in] thread_id Scheduler thread the scope runs on
+     */
+    ScopedKernelProfile(const char *name, int32_t thread_id)
+        : _name(name), _start_ns(0), _thread_id(thread_id), _trace_site(0), _pmu(KernelPMUProfiler::is_enabled()), _trace(TraceLog::is_enabled())
+    {
+        if(KernelProfiler::is_enabled())
+        {
+            _start_ns = KernelProfiler::now_ns();
+        }
+        if(_pmu)
+        {
+            KernelPMUProfiler::get().begin();
+        }
+        if(_trace)
+        {
+            _trace_site = TraceLog::get().register_site(_name);
+            TraceLog::get().record(_trace_site, TraceLog::EventType::Enter);
+        }
+    }
+    /** Destructor */
+    ~ScopedKernelProfile()
+    {
+        if(_trace)
+        {
+            TraceLog::get().record(_trace_site, TraceLog::EventType::Exit);
+        }
+        if(_pmu)
+        {
+            KernelPMUProfiler::get().end(_name);
+        }
+        if(_start_ns != 0)
+        {
+            KernelProfiler::get().record(_name, _start_ns, KernelProfiler::now_ns(), _thread_id);
+        }
+    }
+    ScopedKernelProfile(const ScopedKernelProfile &) = delete;
+    ScopedKernelProfile &operator=(const ScopedKernelProfile &) = delete;
+
+private:
+    const char *_name;
+    uint64_t    _start_ns;
+    int32_t     _thread_id;
+    uint16_t    _trace_site;
+    bool        _pmu;
+    bool        _trace;
+};
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_RUNTIME_KERNEL_PROFILER_H */
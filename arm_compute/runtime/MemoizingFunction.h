@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_MEMOIZING_FUNCTION_H
+#define ARM_COMPUTE_MEMOIZING_FUNCTION_H
+
+#include "arm_compute/core/Window.h"
+#include "arm_compute/runtime/IFunction.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+
+/** Function decorator that skips re-execution when the inputs did not change
+ *
+ * The contents of every registered input are hashed slice-by-slice along the outermost
+ * dimension on each run; when all hashes match the previous run the wrapped function is
+ * not executed and the outputs keep holding the previous result. Intended for streaming
+ * workloads that re-run a network on overlapping or intermittently changing inputs.
+ *
+ * When only some slices changed the function still re-runs in full — @ref IFunction has no
+ * windowed run entry point — but @ref dirty_window exposes the changed sub-range so callers
+ * with their own incremental stages (pre/post-processing, feature extraction) can restrict
+ * those to the dirty region.
+ *
+ * @note The outputs of the wrapped function must live in persistently allocated tensors:
+ *       memory managed by a lifetime manager is recycled between runs and would not retain
+ *       the previous result across a skipped execution.
+ */
+class MemoizingFunction final : public IFunction
+{
+public:
+    /** Default constructor */
+    MemoizingFunction();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    MemoizingFunction(const MemoizingFunction &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    MemoizingFunction &operator=(const MemoizingFunction &) = delete;
+    /** Default move constructor */
+    MemoizingFunction(MemoizingFunction &&) = default;
+    /** Default move assignment operator */
+    MemoizingFunction &operator=(MemoizingFunction &&) = default;
+    /** Default destructor */
+    ~MemoizingFunction();
+    /** Set the function to wrap and the inputs deciding whether it has to re-run
+     *
+     * @param[in] function Configured function to wrap. The decorator takes ownership.
+     * @param[in] inputs   Input tensors whose contents decide whether the function re-runs.
+     *                     Must be allocated and stay valid for the lifetime of the decorator.
+     */
+    void configure(std::unique_ptr<IFunction> function, std::vector<const ITensor *> inputs);
+    /** Invalidate the cached input hashes, forcing the next run to execute
+     *
+     * Call when an output was modified externally or an input aliasing another buffer changed.
+     */
+    void invalidate();
+    /** Window over the slices of an input that changed on the most recent run
+     *
+     * The window spans the input's shape with the outermost dimension restricted to the
+     * dirty interval; it is empty when the input did not change.
+     *
+     * @param[in] input_index Index of the input in the order passed to configure()
+     *
+     * @return The dirty window of the input
+     */
+    Window dirty_window(size_t input_index) const;
+    /** Number of run() calls skipped because no input changed
+     *
+     * @return Number of skipped runs
+     */
+    size_t num_skipped_runs() const;
+
+    // Inherited methods overridden:
+    void run() override;
+    void prepare() override;
+
+private:
+    std::unique_ptr<IFunction>         _function;      /**< Wrapped function */
+    std::vector<const ITensor *>       _inputs;        /**< Inputs deciding whether to re-run */
+    std::vector<std::vector<uint64_t>> _slice_hashes;  /**< Per-input content hashes of the previous run's slices */
+    std::vector<std::pair<size_t, size_t>> _dirty;     /**< Per-input [first, last) dirty slice interval of the last run */
+    size_t                             _num_skipped;   /**< Number of skipped runs */
+    bool                               _valid;         /**< False until a run populated the hashes */
+};
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_MEMOIZING_FUNCTION_H */
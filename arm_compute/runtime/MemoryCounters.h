@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_MEMORY_COUNTERS_H
+#define ARM_COMPUTE_MEMORY_COUNTERS_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace arm_compute
+{
+/** Process-level memory allocation and map/unmap traffic counters
+ *
+ * Populated by the CPU and OpenCL memory regions on every backing allocation,
+ * free, map and unmap. Snapshot the counters before and after a unit of work
+ * (e.g. one inference) to attribute the traffic it caused, or call @ref reset
+ * at the start of the unit and snapshot at its end. The number of live bytes
+ * survives a reset; the peak restarts from it.
+ */
+class MemoryCounters final
+{
+public:
+    /** Counter values at a point in time */
+    struct Snapshot
+    {
+        uint64_t num_allocations{ 0 }; /**< Number of backing allocations */
+        uint64_t num_frees{ 0 };       /**< Number of frees */
+        uint64_t allocated_bytes{ 0 }; /**< Bytes allocated */
+        uint64_t freed_bytes{ 0 };     /**< Bytes freed */
+        uint64_t live_bytes{ 0 };      /**< Bytes currently allocated */
+        uint64_t peak_bytes{ 0 };      /**< Highest number of live bytes observed */
+        uint64_t num_maps{ 0 };        /**< Number of map operations */
+        uint64_t num_unmaps{ 0 };      /**< Number of unmap operations */
+        uint64_t mapped_bytes{ 0 };    /**< Bytes mapped for CPU access */
+        uint64_t unmapped_bytes{ 0 };  /**< Bytes unmapped */
+    };
+
+    /** Access the process-level counters
+     *
+     * @return The counters
+     */
+    static MemoryCounters &get();
+    /** Prevent instances of this class from being copied */
+    MemoryCounters(const MemoryCounters &) = delete;
+    /** Prevent instances of this class from being copied */
+    MemoryCounters &operator=(const MemoryCounters &) = delete;
+
+    /** Records a backing allocation
+     *
+     * @param[in] size Size of the allocation in bytes
+     */
+    void record_allocation(size_t size);
+    /** Records the free of a backing allocation
+     *
+     * @param[in] size Size of the allocation in bytes
+     */
+    void record_free(size_t size);
+    /** Records a map operation
+     *
+     * @param[in] size Number of bytes made accessible to the CPU
+     */
+    void record_map(size_t size);
+    /** Records an unmap operation
+     *
+     * @param[in] size Number of bytes unmapped
+     */
+    void record_unmap(size_t size);
+
+    /** Current counter values
+     *
+     * @return A consistent-enough copy of the counters for reporting purposes
+     */
+    Snapshot snapshot() const;
+    /** Restarts the accounting period
+     *
+     * The traffic counters are zeroed; the live bytes are kept and the peak restarts from them.
+     */
+    void reset();
+
+private:
+    /** Default constructor */
+    MemoryCounters() = default;
+
+    std::atomic<uint64_t> _num_allocations{ 0 };
+    std::atomic<uint64_t> _num_frees{ 0 };
+    std::atomic<uint64_t> _allocated_bytes{ 0 };
+    std::atomic<uint64_t> _freed_bytes{ 0 };
+    std::atomic<uint64_t> _live_bytes{ 0 };
+    std::atomic<uint64_t> _peak_bytes{ 0 };
+    std::atomic<uint64_t> _num_maps{ 0 };
+    std::atomic<uint64_t> _num_unmaps{ 0 };
+    std::atomic<uint64_t> _mapped_bytes{ 0 };
+    std::atomic<uint64_t> _unmapped_bytes{ 0 };
+};
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_MEMORY_COUNTERS_H */
@@ -63,16 +63,27 @@ public:
     void            release() override;
     MemoryMappings &mappings() override;
 
+    /** Bytes requested by the objects managed by this group
+     *
+     * Accumulated as object lifetimes are finalized; the pool backing the group may
+     * allocate less thanks to the reuse the lifetime manager computes.
+     *
+     * @return Number of bytes managed by this group
+     */
+    size_t managed_bytes() const;
+
 private:
     std::shared_ptr<IMemoryManager> _memory_manager; /**< Memory manager to be used by the group */
     IMemoryPool                    *_pool;           /**< Memory pool that the group is scheduled with */
     MemoryMappings                  _mappings;       /**< Memory mappings of the group */
+    size_t                          _managed_bytes;  /**< Bytes requested by the managed objects */
 };
 
 inline MemoryGroup::MemoryGroup(std::shared_ptr<IMemoryManager> memory_manager) noexcept
     : _memory_manager(memory_manager),
       _pool(nullptr),
-      _mappings()
+      _mappings(),
+      _managed_bytes(0)
 {
 }
 
@@ -98,6 +109,7 @@ inline void MemoryGroup::finalize_memory(IMemoryManageable *obj, IMemory &obj_me
     if(_memory_manager)
     {
         ARM_COMPUTE_ERROR_ON(!_memory_manager->lifetime_manager());
+        _managed_bytes += size;
         _memory_manager->lifetime_manager()->end_lifetime(obj, obj_memory, size, alignment);
     }
 }
@@ -128,5 +140,10 @@ inline MemoryMappings &MemoryGroup::mappings()
 {
     return _mappings;
 }
+
+inline size_t MemoryGroup::managed_bytes() const
+{
+    return _managed_bytes;
+}
 } // arm_compute
 #endif /*ARM_COMPUTE_MEMORYGROUP_H */
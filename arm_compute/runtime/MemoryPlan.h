@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_MEMORY_PLAN_H
+#define ARM_COMPUTE_MEMORY_PLAN_H
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/runtime/Types.h"
+
+#include <string>
+
+namespace arm_compute
+{
+/** Saves a memory plan to a file as a deterministic text artifact
+ *
+ * Regions are written sorted by lifetime so that two runs with the same registration
+ * order produce byte-identical files, suitable for inspection and diffing between
+ * releases. The plan is the @ref MemoryReport a lifetime manager emits after finalize.
+ *
+ * @param[in] plan     Plan to save
+ * @param[in] filename File to write the plan to
+ *
+ * @return An error status
+ */
+Status save_memory_plan(const MemoryReport &plan, const std::string &filename);
+/** Loads a memory plan previously written by @ref save_memory_plan
+ *
+ * @param[out] plan     Plan to populate
+ * @param[in]  filename File to read the plan from
+ *
+ * @return An error status
+ */
+Status load_memory_plan(MemoryReport &plan, const std::string &filename);
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_MEMORY_PLAN_H */
@@ -27,6 +27,7 @@
 #include "arm_compute/runtime/IMemoryRegion.h"
 
 #include "arm_compute/core/Error.h"
+#include "arm_compute/runtime/MemoryCounters.h"
 #include "support/MemorySupport.h"
 
 #include <cstddef>
@@ -49,11 +50,13 @@ public:
         {
             // Allocate backing memory
             size_t space = size + alignment;
-            _mem         = std::shared_ptr<uint8_t>(new uint8_t[space](), [](uint8_t *ptr)
+            _mem         = std::shared_ptr<uint8_t>(new uint8_t[space](), [space](uint8_t *ptr)
             {
+                MemoryCounters::get().record_free(space);
                 delete[] ptr;
             });
             _ptr = _mem.get();
+            MemoryCounters::get().record_allocation(space);
 
             // Calculate alignment offset
             if(alignment != 0)
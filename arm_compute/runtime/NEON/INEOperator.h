@@ -28,9 +28,13 @@
 #include "arm_compute/core/NEON/INEKernel.h"
 #include "arm_compute/runtime/IOperator.h"
 #include "arm_compute/runtime/IRuntimeContext.h"
+#include "arm_compute/runtime/OperatorKernelCache.h"
 #include "arm_compute/runtime/Types.h"
+#include "support/MemorySupport.h"
 
+#include <future>
 #include <memory>
+#include <utility>
 
 namespace arm_compute
 {
@@ -59,8 +63,54 @@ public:
     void prepare(ITensorPack &constants) override;
     MemoryRequirements workspace() const override;
 
+    /** Enqueue the operator for asynchronous execution
+     *
+     * Dispatches run() to an executor thread and returns immediately so independent
+     * operators can be issued back-to-back and pipelined by the scheduler.
+     *
+     * @note The tensor pack and its backing memory must stay valid until the returned
+     *       future becomes ready.
+     *
+     * @param[in,out] tensors Tensor pack to operate on.
+     *
+     * @return A future that becomes ready once the operator's kernel has executed.
+     */
+    std::future<void> run_async(ITensorPack &tensors);
+
 protected:
-    std::unique_ptr<INEKernel> _kernel;
+    /** Fetch a kernel matching @p key from the context cache, or configure a new one and publish it
+     *
+     * Repeat configurations against a context resolve to the already configured instance,
+     * skipping the kernel construction and window calculation. Without a context (or a
+     * context without a cache) a fresh kernel is configured as before. Only kernels that
+     * keep no per-run state besides the configured window may go through this helper, as
+     * the instance may be shared with other operators.
+     *
+     * @param[in] key  Key describing the configuration
+     * @param[in] args Arguments to forward to the kernel's configure method
+     */
+    template <typename KernelType, typename... Args>
+    void create_kernel(const KernelCacheKey &key, Args &&... args)
+    {
+        OperatorKernelCache *cache = (_ctx != nullptr) ? _ctx->kernel_cache() : nullptr;
+        if(cache != nullptr)
+        {
+            _kernel = cache->find(key);
+            if(_kernel != nullptr)
+            {
+                return;
+            }
+        }
+        auto k = arm_compute::support::cpp14::make_unique<KernelType>();
+        k->configure(std::forward<Args>(args)...);
+        _kernel = std::move(k);
+        if(cache != nullptr)
+        {
+            cache->add(key, _kernel);
+        }
+    }
+
+    std::shared_ptr<INEKernel> _kernel;
     IRuntimeContext           *_ctx;
     MemoryRequirements         _workspace;
 };
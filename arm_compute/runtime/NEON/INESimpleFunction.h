@@ -27,6 +27,7 @@
 #include "arm_compute/core/NEON/INEKernel.h"
 #include "arm_compute/core/NEON/kernels/NEFillBorderKernel.h"
 #include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IRuntimeContext.h"
 
 #include <memory>
 
@@ -36,8 +37,11 @@ namespace arm_compute
 class INESimpleFunction : public IFunction
 {
 public:
-    /** Constructor */
-    INESimpleFunction();
+    /** Constructor
+     *
+     * @param[in] ctx Runtime context to be used by the function
+     */
+    INESimpleFunction(IRuntimeContext *ctx = nullptr);
 
     // Inherited methods overridden:
     void run() override final;
@@ -45,6 +49,7 @@ public:
 protected:
     std::unique_ptr<INEKernel> _kernel;         /**< Kernel to run */
     NEFillBorderKernel         _border_handler; /**< Kernel to handle image borders */
+    IRuntimeContext           *_ctx;            /**< Context to use */
 };
 }
 #endif /*ARM_COMPUTE_INESIMPLEFUNCTION_H */
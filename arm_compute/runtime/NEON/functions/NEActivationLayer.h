@@ -109,6 +109,9 @@ public:
      * @return a status
      */
     static Status validate(const ITensorInfo *input, const ITensorInfo *output, const ActivationLayerInfo &act_info);
+
+    // Inherited methods overridden:
+    bool supports_in_place() const override;
 };
 } // namespace experimental
 } // namespace arm_compute
@@ -83,9 +83,11 @@ public:
 
     // Inherited methods overridden:
     void run() override;
+    void prepare() override;
 
 private:
     NEBatchNormalizationLayerKernel _norm_kernel; /**< Batch normalization layer kernel */
+    bool                            _is_prepared; /**< True once the kernel coefficients have been folded */
 };
 }
 #endif /* ARM_COMPUTE_NEBATCHNORMALIZATIONLAYER_H */
@@ -68,6 +68,10 @@ public:
      * @note Input and output tensor dimensions preconditions defer depending on the concatenation axis.
      * @note Preconditions can be found respectively at @ref NEWidthConcatenateLayerKernel, @ref NEHeightConcatenateLayerKernel and @ref NEDepthConcatenateLayerKernel.
      *
+     * @note Inputs that are @ref SubTensor views of the region of @p output they map to are not copied:
+     *       configuring the producers of such inputs to write directly into the sub-tensors removes the
+     *       concatenation cost entirely. This applies to all supported axes.
+     *
      * @param[in,out] inputs_vector The vectors containing all the tensors to concatenate. Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
      * @param[out]    output        Output tensor. Data types supported: Same as @p input.
      * @param[in]     axis          Concatenation axis. Supported underlying concatenation axis are 0, 1, 2 and 3.
@@ -136,6 +140,7 @@ public:
 
 private:
     std::vector<std::unique_ptr<INEKernel>> _concat_kernels;
+    std::vector<unsigned int>               _dst_offsets;
     unsigned int                            _num_inputs;
     unsigned int                            _axis;
 };
@@ -85,6 +85,12 @@ public:
         _output.allocator()->free();
     }
 
+    bool allocate_only() override
+    {
+        _output.allocator()->allocate();
+        return _output.buffer() != nullptr;
+    }
+
     ITensor *get_weights() override
     {
         return &_output;
@@ -95,8 +101,22 @@ public:
         return _uid;
     }
 
+    uint64_t parameters_hash() override
+    {
+        // The converted output depends on the original input shape and layout, which do
+        // not fit in the uid bits
+        uint64_t hash = parameters_hash_seed;
+        for(size_t i = 0; i < _original_input_shape.num_dimensions(); ++i)
+        {
+            hash = combine_hash(hash, _original_input_shape[i]);
+        }
+        return combine_hash(hash, static_cast<uint64_t>(_data_layout));
+    }
+
     void configure(const ITensor *input, const TensorShape &original_input_shape, DataLayout data_layout)
     {
+        _original_input_shape = original_input_shape;
+        _data_layout          = data_layout;
         _func.configure(input, &_output, original_input_shape, data_layout);
     }
 
@@ -104,6 +124,8 @@ private:
     static constexpr uint32_t      _uid = 0x4;
     Tensor                         _output{};
     NEConvertFullyConnectedWeights _func{};
+    TensorShape                    _original_input_shape{};
+    DataLayout                     _data_layout{ DataLayout::UNKNOWN };
 };
 } // namespace weights_transformations
 } // namespace arm_compute
@@ -92,10 +92,14 @@ public:
 
     void run() override;
 
+    const ITensor      *_input;
+    const ITensor      *_boxes;
+    const ITensor      *_box_ind;
     ITensor            *_output;
     size_t              _num_boxes;
     InterpolationPolicy _method;
     float               _extrapolation_value;
+    bool                _fused_path;
 
     std::vector<std::unique_ptr<NECropKernel>> _crop;
     std::vector<std::unique_ptr<NEScale>>      _scale;
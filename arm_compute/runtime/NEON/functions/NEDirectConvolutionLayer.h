@@ -24,6 +24,7 @@
 #ifndef ARM_COMPUTE_NEDIRECTCONVOLUTIONLAYER_H
 #define ARM_COMPUTE_NEDIRECTCONVOLUTIONLAYER_H
 
+#include "arm_compute/core/NEON/kernels/NEDirectConvolutionLayer3x3QuantizedKernel.h"
 #include "arm_compute/core/NEON/kernels/NEDirectConvolutionLayerKernel.h"
 #include "arm_compute/core/NEON/kernels/NEDirectConvolutionLayerOutputStageKernel.h"
 #include "arm_compute/core/NEON/kernels/NEFillBorderKernel.h"
@@ -45,6 +46,11 @@ namespace arm_compute
  * -# @ref NEFillBorderKernel for the input
  * -# @ref NEDirectConvolutionLayerOutputStageKernel
  * -# @ref NEDirectConvolutionLayerKernel
+ *
+ * For quantized NHWC 3x3 convolutions the im2col-free path is used instead:
+ *
+ * -# @ref NEDirectConvolutionLayer3x3QuantizedKernel
+ * -# @ref NEDirectConvolutionLayerOutputStageKernel
  */
 class NEDirectConvolutionLayer : public IFunction
 {
@@ -57,13 +63,14 @@ public:
      *    1x1 convolution with stride_x = 1/2/3, stride_y = 1/2/3 data type = F16/F32
      *    3x3 convolution with stride_x = 1/2/3, stride_y = 1/2/3 data type = F16/F32
      *    5x5 convolution with stride_x = 1/2/3, stride_y = 1/2/3 data type = F32
+     *    3x3 convolution with stride_x = 1/2, stride_y = 1/2 data type = QASYMM8/QASYMM8_SIGNED, layout = NHWC
      *
-     * @param[in, out] input     Input tensor. Data types supported: F16/F32.
+     * @param[in, out] input     Input tensor. Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
      * @param[in]      weights   Set of kernels to convolve the input volume.
      *                           Supported sizes: 1x1, 3x3 and 5x5.
      *                           The 3rd dimension must be the same as the input's volume 3rd dimension.
      *                           Data type supported: Same as @p input.
-     * @param[in]      bias      Set of biases. Can be nullptr. Data type supported: Same as @p input.
+     * @param[in]      bias      Set of biases. Can be nullptr. Data type supported: Same as @p input, S32 when @p input is quantized.
      * @param[out]     output    Output tensor.
      *                           The 3rd dimensions must be equal to the 4th dimension of the @p kernels tensor. Data types supported: Same as @p input.
      * @param[in]      conv_info Contains padding and stride information described in @ref PadStrideInfo.
@@ -76,13 +83,14 @@ public:
      *    1x1 convolution with stride_x = 1/2/3, stride_y = 1/2/3 data type = F16/F32
      *    3x3 convolution with stride_x = 1/2/3, stride_y = 1/2/3 data type = F16/F32
      *    5x5 convolution with stride_x = 1/2/3, stride_y = 1/2/3 data type = F32
+     *    3x3 convolution with stride_x = 1/2, stride_y = 1/2 data type = QASYMM8/QASYMM8_SIGNED, layout = NHWC
      *
-     * @param[in] input     Input tensor. Data types supported: F16/F32.
+     * @param[in] input     Input tensor. Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
      * @param[in] weights   Set of kernels to convolve the input volume.
      *                      Supported sizes: 1x1, 3x3 and 5x5.
      *                      The 3rd dimension must be the same as the input's volume 3rd dimension.
      *                      Data type supported: Same as @p input.
-     * @param[in] bias      Set of biases. Can be nullptr. Data type supported: Same as @p input.
+     * @param[in] bias      Set of biases. Can be nullptr. Data type supported: Same as @p input, S32 when @p input is quantized.
      * @param[in] output    Output tensor.
      *                      The 3rd dimensions must be equal to the 4th dimension of the @p kernels tensor. Data types supported: Same as @p input.
      * @param[in] conv_info Contains padding and stride information described in @ref PadStrideInfo.
@@ -97,15 +105,17 @@ public:
     void run() override;
 
 private:
-    MemoryGroup                               _memory_group;
-    NEDirectConvolutionLayerOutputStageKernel _output_stage_kernel;
-    NEDirectConvolutionLayerKernel            _conv_kernel;
-    NEFillBorderKernel                        _input_border_handler;
-    NEActivationLayer                         _activationlayer_function;
-    Tensor                                    _accumulator;
-    bool                                      _has_bias;
-    bool                                      _is_activationlayer_enabled;
-    unsigned int                              _dim_split;
+    MemoryGroup                                _memory_group;
+    NEDirectConvolutionLayerOutputStageKernel  _output_stage_kernel;
+    NEDirectConvolutionLayerKernel             _conv_kernel;
+    NEDirectConvolutionLayer3x3QuantizedKernel _conv_kernel_quantized;
+    NEFillBorderKernel                         _input_border_handler;
+    NEActivationLayer                          _activationlayer_function;
+    Tensor                                     _accumulator;
+    bool                                       _has_bias;
+    bool                                       _is_activationlayer_enabled;
+    bool                                       _is_quantized;
+    unsigned int                               _dim_split;
 };
 }
 #endif /* ARM_COMPUTE_NEDIRECTCONVOLUTIONLAYER_H */
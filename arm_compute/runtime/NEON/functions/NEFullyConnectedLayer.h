@@ -79,6 +79,12 @@ public:
         _output.allocator()->free();
     }
 
+    bool allocate_only() override
+    {
+        _output.allocator()->allocate();
+        return _output.buffer() != nullptr;
+    }
+
     ITensor *get_weights() override
     {
         return &_output;
@@ -128,8 +134,8 @@ public:
      * @param[in]  weights Weights tensor. The weights must be 2 dimensional.
      *                     If this function is called after a Convolution Layer, the (transposed) weights will have as many rows as the product of the first 3 input's dimensions.
      *                     If it is called after another FullyConnected Layer, the (transposed) weights will have as many rows as the input's first dimension.
-     *                     Data type supported: Same as @p input.
-     * @param[in]  biases  Bias tensor. Can be nullptr. Data type supported: Same as @p weights, S32 if @p weights is QASYMM8/QASYMM8_SIGNED.
+     *                     Data type supported: Same as @p input or QSYMM8_PER_CHANNEL if @p input is QASYMM8/QASYMM8_SIGNED.
+     * @param[in]  biases  Bias tensor. Can be nullptr. Data type supported: Same as @p weights, S32 if @p weights is QASYMM8/QASYMM8_SIGNED/QSYMM8_PER_CHANNEL.
      * @param[out] output  Destination tensor. Its shape should be equal to the output of a matrix multiplication between:
      *                     - The output of im2col on the input and the (transposed) 2D weights, if the function is called after a Convolution Layer
      *                     - The input tensor and the (transposed) 2D weights, if the function is called after another FullyConnected Layer.
@@ -144,8 +150,8 @@ public:
      * @param[in] weights Weights tensor info. The weights must be 2 dimensional.
      *                    If this function is called after a Convolution Layer, the (transposed) weights will have as many rows as the product of the first 3 input's dimensions.
      *                    If it is called after another FullyConnected Layer, the (transposed) weights will have as many rows as the input's first dimension.
-     *                    Data type supported: Same as @p input.
-     * @param[in] biases  Bias tensor. Can be nullptr. Data type supported: Same as @p weights, S32 if @p weights is QASYMM8/QASYMM8_SIGNED.
+     *                    Data type supported: Same as @p input or QSYMM8_PER_CHANNEL if @p input is QASYMM8/QASYMM8_SIGNED.
+     * @param[in] biases  Bias tensor. Can be nullptr. Data type supported: Same as @p weights, S32 if @p weights is QASYMM8/QASYMM8_SIGNED/QSYMM8_PER_CHANNEL.
      * @param[in] output  Destination tensor info. Its shape should be equal to the output of a matrix multiplication between:
      *                    - The output of im2col on the input and the (transposed) 2D weights, if the function is called after a Convolution Layer
      *                    - The input tensor and the (transposed) 2D weights, if the function is called after another FullyConnected Layer.
@@ -120,6 +120,7 @@ private:
     Tensor         _tmp_d;
     const ITensor *_original_b;
     bool           _run_vector_matrix_multiplication;
+    bool           _run_interleave;
     bool           _run_alpha_scale;
     bool           _run_addition;
     bool           _run_bias_addition;
@@ -24,6 +24,7 @@
 #ifndef ARM_COMPUTE_NEGEMMASSEMBLYDISPATCH_H
 #define ARM_COMPUTE_NEGEMMASSEMBLYDISPATCH_H
 
+#include "arm_compute/core/Size2D.h"
 #include "arm_compute/runtime/IFunction.h"
 #include "arm_compute/runtime/IMemoryManager.h"
 #include "arm_compute/runtime/IWeightsManager.h"
@@ -71,6 +72,36 @@ public:
      */
     void configure(const ITensor *a, const ITensor *b, const ITensor *c, ITensor *d, const GEMMInfo &gemm_info);
 
+    /** If supported, create a function that computes a convolution as a single GEMM directly over the NHWC input.
+     *
+     * The assembly kernels are fed through a table of input-row offsets built once at prepare time,
+     * so no im2col matrix is ever materialized. Check the configuration is supported with
+     * @ref is_indirect_convolution_supported() before calling; the function is left unconfigured otherwise.
+     *
+     * @param[in]  a           Input tensor (NHWC). Data type supported: F32.
+     * @param[in]  b           Reshaped weights matrix as produced by @ref NEConvolutionLayerReshapeWeights.
+     * @param[in]  c           Bias tensor (can be nullptr). Data type supported: same as @p a.
+     * @param[out] d           Output tensor (NHWC). Data type supported: same as @p a.
+     * @param[in]  conv_info   Padding and stride information.
+     * @param[in]  kernel_dims Spatial dimensions of the convolution kernel.
+     * @param[in]  gemm_info   GEMM meta-data
+     */
+    void configure_indirect_convolution(const ITensor *a, const ITensor *b, const ITensor *c, ITensor *d,
+                                        const PadStrideInfo &conv_info, const Size2D &kernel_dims, const GEMMInfo &gemm_info);
+
+    /** Indicates whether the indirect convolution path can be used for the given parameters.
+     *
+     * @param[in] input     Input tensor info.
+     * @param[in] weights   Weights tensor info (not reshaped).
+     * @param[in] conv_info Padding and stride information.
+     * @param[in] dilation  Kernel dilation.
+     * @param[in] act_info  Activation to be fused.
+     *
+     * @return True if @ref configure_indirect_convolution() supports this configuration
+     */
+    static bool is_indirect_convolution_supported(const ITensorInfo *input, const ITensorInfo *weights,
+                                                  const PadStrideInfo &conv_info, const Size2D &dilation, const ActivationLayerInfo &act_info);
+
     /** Indicates whether or not this function can be used to process the given parameters.
      *
      * @param[in] a         Input tensor info (Matrix A)
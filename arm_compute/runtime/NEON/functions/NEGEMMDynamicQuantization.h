@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_NEGEMMDYNAMICQUANTIZATION_H
+#define ARM_COMPUTE_NEGEMMDYNAMICQUANTIZATION_H
+
+#include "arm_compute/runtime/IFunction.h"
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMMLowpMatrixMultiplyCore.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Basic function to execute a float GEMM on dynamically quantized activations.
+ *
+ * The weights are quantized offline while the activations stay in F32 and are quantized per run:
+ * the activation range is measured with a vectorized abs-max pass, a symmetric per-tensor scale is
+ * derived from it, the activations are quantized to QASYMM8_SIGNED and multiplied with the int8
+ * weights through @ref NEGEMMLowpMatrixMultiplyCore, and the int32 result is dequantized back to
+ * F32 (adding the optional bias) with the product of the two scales.
+ *
+ * Because the activation quantization is symmetric both matrix offsets are zero, so no offset
+ * contribution kernels run and the runtime scale never enters the int8 datapath.
+ *
+ * This is intended for workloads without calibration data, e.g. transformer-style models where
+ * only the weights are available in int8.
+ *
+ * This function calls the following NEON functions/kernels:
+ *
+ * -# @ref NEGEMMLowpMatrixMultiplyCore
+ */
+class NEGEMMDynamicQuantization : public IFunction
+{
+public:
+    /** Constructor */
+    NEGEMMDynamicQuantization(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGEMMDynamicQuantization(const NEGEMMDynamicQuantization &) = delete;
+    /** Default move constructor */
+    NEGEMMDynamicQuantization(NEGEMMDynamicQuantization &&) = default;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGEMMDynamicQuantization &operator=(const NEGEMMDynamicQuantization &) = delete;
+    /** Default move assignment operator */
+    NEGEMMDynamicQuantization &operator=(NEGEMMDynamicQuantization &&) = default;
+    /** Initialise the function's inputs and output
+     *
+     * @param[in]  a      First input tensor (Matrix A). Data type supported: F32
+     * @param[in]  b      Second input tensor (Matrix B), quantized offline with a symmetric per-tensor scale. Data types supported: QASYMM8_SIGNED/QSYMM8 with a zero offset
+     * @param[in]  bias   Bias tensor, added after the dequantization. Can be nullptr. Data type supported: F32
+     * @param[out] output Output tensor. Data type supported: F32
+     */
+    void configure(const ITensor *a, const ITensor *b, const ITensor *bias, ITensor *output);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEGEMMDynamicQuantization
+     *
+     * @param[in] a      First input tensor info (Matrix A). Data type supported: F32
+     * @param[in] b      Second input tensor info (Matrix B), quantized offline with a symmetric per-tensor scale. Data types supported: QASYMM8_SIGNED/QSYMM8 with a zero offset
+     * @param[in] bias   Bias tensor info, added after the dequantization. Can be nullptr. Data type supported: F32
+     * @param[in] output Output tensor info. Data type supported: F32
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *bias, const ITensorInfo *output);
+
+    // Inherited methods overridden:
+    void run() override;
+    void prepare() override;
+
+private:
+    MemoryGroup                  _memory_group;
+    NEGEMMLowpMatrixMultiplyCore _mm;
+    Tensor                       _quantized_a;
+    Tensor                       _mm_result_s32;
+    const ITensor               *_a;
+    const ITensor               *_bias;
+    ITensor                     *_output;
+    float                        _b_scale;
+};
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_NEGEMMDYNAMICQUANTIZATION_H */
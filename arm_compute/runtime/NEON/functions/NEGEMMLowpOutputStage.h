@@ -250,6 +250,9 @@ public:
      * @return a status
      */
     static Status validate(const ITensorInfo *input, const ITensorInfo *bias, const ITensorInfo *output, const GEMMLowpOutputStageInfo &info);
+
+private:
+    GEMMLowpOutputStageInfo _info{}; /**< Output stage metadata with any fused activation folded into the bounds; kept alive for the kernel */
 };
 } // namespace arm_compute
 #endif /*ARM_COMPUTE_NEGEMMLOWPOUTPUTSTAGE_H */
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_NEINCREMENTALMINMAXMEAN_H
+#define ARM_COMPUTE_NEINCREMENTALMINMAXMEAN_H
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/IFunction.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace arm_compute
+{
+class ITensor;
+using IImage = ITensor;
+
+/** Function to maintain the minimum, maximum and mean of an image across frames,
+ * refreshed incrementally from a list of dirty regions.
+ *
+ * The image is covered by a grid of tiles, each carrying its own min/max/sum
+ * aggregate. A full pass (see @ref NEIncrementalMinMaxMean::run) evaluates every
+ * tile; subsequent frames that only changed in known regions (e.g. reported by a
+ * motion estimation stage) can instead call @ref NEIncrementalMinMaxMean::update,
+ * which re-evaluates just the tiles the dirty regions overlap and re-combines the
+ * per-tile aggregates. Keeping aggregates per tile is what makes shrinking
+ * extrema safe: when the previous minimum or maximum is overwritten inside a
+ * dirty region, only that tile needs re-reading, not the whole frame.
+ */
+class NEIncrementalMinMaxMean : public IFunction
+{
+public:
+    /** Default constructor */
+    NEIncrementalMinMaxMean();
+    /** Initialise the function's source and outputs.
+     *
+     * @param[in]  input     Input image. Data types supported: U8/S16/F32.
+     * @param[out] min       Minimum value of image. Data types supported: S32 if input type is U8/S16, F32 if input type is F32.
+     * @param[out] max       Maximum value of image. Data types supported: S32 if input type is U8/S16, F32 if input type is F32.
+     * @param[out] mean      Mean value of image.
+     * @param[in]  tile_size (Optional) Side, in pixels, of the square aggregation tiles. Smaller tiles make updates
+     *                       sparser but increase the per-frame combine cost. Defaults to 64.
+     */
+    void configure(const IImage *input, void *min, void *max, float *mean, unsigned int tile_size = 64);
+    /** Re-evaluate only the tiles overlapped by the given dirty regions and refresh the outputs.
+     *
+     * Regions exceeding the image bounds are clamped. A full pass must have been
+     * run at least once before the first update.
+     *
+     * @param[in] dirty_regions Regions of the image whose content changed since the last evaluation.
+     */
+    void update(const std::vector<Rectangle> &dirty_regions);
+
+    // Inherited methods overridden:
+    void run() override;
+
+private:
+    /** Per-tile aggregate, combined into the frame-wide outputs after each refresh. */
+    struct TileStats
+    {
+        float  min{ 0.f };  /**< Minimum value within the tile */
+        float  max{ 0.f };  /**< Maximum value within the tile */
+        double sum{ 0.0 };  /**< Sum of the tile's pixels */
+    };
+
+    /** Re-evaluate the aggregates of the given inclusive tile coordinate range. */
+    void evaluate_tiles(unsigned int tile_x0, unsigned int tile_y0, unsigned int tile_x1, unsigned int tile_y1);
+    /** Evaluate one tile covering the given pixel range. */
+    template <typename T>
+    void evaluate_tile(TileStats &tile, unsigned int x0, unsigned int y0, unsigned int x1, unsigned int y1);
+    /** Combine all tile aggregates and write the min/max/mean outputs. */
+    void reduce_tiles();
+
+    const IImage          *_input;     /**< Source image */
+    void                  *_min;       /**< Minimum value */
+    void                  *_max;       /**< Maximum value */
+    float                 *_mean;      /**< Mean value */
+    unsigned int           _tile_size; /**< Side of the square aggregation tiles */
+    unsigned int           _tiles_x;   /**< Number of tile columns */
+    unsigned int           _tiles_y;   /**< Number of tile rows */
+    std::vector<TileStats> _tiles;     /**< Per-tile aggregates, row major */
+};
+} // namespace arm_compute
+#endif /*ARM_COMPUTE_NEINCREMENTALMINMAXMEAN_H */
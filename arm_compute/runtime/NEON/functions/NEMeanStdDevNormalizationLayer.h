@@ -42,18 +42,24 @@ public:
      * @param[in, out] input   Input tensor with 2 dimensions. Data types supported: F16/F32.
      * @param[out]     output  (Optional) Destination tensor. It can be nullptr in case of in-place computation. Data type supported: same as @p input
      * @param[in]      epsilon (Optional) Small float to avoid division by zero in case of zero standard deviation. Defaults to 1e-8.
+     * @param[in]      gamma   (Optional) Scale tensor applied to the normalized values in the same pass, as in layer normalization.
+     *                         1D tensor with the same size as the first dimension of @p input. Data type supported: same as @p input
+     * @param[in]      beta    (Optional) Shift tensor applied after the scale in the same pass.
+     *                         1D tensor with the same size as the first dimension of @p input. Data type supported: same as @p input
      */
-    void configure(ITensor *input, ITensor *output = nullptr, float epsilon = 1e-8f);
+    void configure(ITensor *input, ITensor *output = nullptr, float epsilon = 1e-8f, const ITensor *gamma = nullptr, const ITensor *beta = nullptr);
     /** Static function to check if given info will lead to a valid configuration of @ref NEMeanStdDevNormalizationKernel
      *
      * @param[in] input   Source tensor info with 2 dimensions. In case of @p output tensor info = nullptr,
      *                    this tensor will store the result of the normalization. Data types supported: F16/F32.
      * @param[in] output  (Optional) Destination tensor info. It can be nullptr in case of in-place computation. Data type supported: same as @p input
      * @param[in] epsilon (Optional) Small float to avoid division by zero in case of zero standard deviation. Defaults to 1e-8.
+     * @param[in] gamma   (Optional) Scale tensor info. 1D tensor with the same size as the first dimension of @p input. Data type supported: same as @p input
+     * @param[in] beta    (Optional) Shift tensor info. 1D tensor with the same size as the first dimension of @p input. Data type supported: same as @p input
      *
      * @return a status
      */
-    static Status validate(const ITensorInfo *input, const ITensorInfo *output = nullptr, float epsilon = 1e-8f);
+    static Status validate(const ITensorInfo *input, const ITensorInfo *output = nullptr, float epsilon = 1e-8f, const ITensorInfo *gamma = nullptr, const ITensorInfo *beta = nullptr);
 };
 } // namespace arm_compute
 #endif /*ARM_COMPUTE_NEMEANSTDDEVNORMALIZATIONLAYER_H */
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_NEMULTICHANNELTABLELOOKUP_H
+#define ARM_COMPUTE_NEMULTICHANNELTABLELOOKUP_H
+
+#include "arm_compute/runtime/NEON/INESimpleFunctionNoBorder.h"
+
+namespace arm_compute
+{
+class ITensor;
+class ILut;
+
+/** Basic function to run @ref NEMultiChannelTableLookupKernel */
+class NEMultiChannelTableLookup : public INESimpleFunctionNoBorder
+{
+public:
+    /** Initialise the kernel's inputs and output
+     *
+     * Applies one 256-entry U8 LUT per colour channel to an interleaved RGB/RGBA image in a
+     * single pass, replacing the NEChannelExtract/NETableLookup/NEChannelCombine sequence.
+     * For RGBA8888 the alpha channel is copied through unchanged.
+     *
+     * @param[in]  input  First tensor input. Formats supported: RGB888/RGBA8888
+     * @param[in]  lut_r  Lookup table applied to the first channel. Must hold 256 U8 elements.
+     * @param[in]  lut_g  Lookup table applied to the second channel. Must hold 256 U8 elements.
+     * @param[in]  lut_b  Lookup table applied to the third channel. Must hold 256 U8 elements.
+     * @param[out] output Output tensor. Format supported: same as @p input
+     */
+    void configure(const ITensor *input, const ILut *lut_r, const ILut *lut_g, const ILut *lut_b, ITensor *output);
+};
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_NEMULTICHANNELTABLELOOKUP_H */
@@ -102,6 +102,9 @@ public:
      */
     static Status validate(const ITensorInfo *input1, const ITensorInfo *input2, const ITensorInfo *output, float scale, ConvertPolicy overflow_policy, RoundingPolicy rounding_policy,
                            const ActivationLayerInfo &act_info = ActivationLayerInfo());
+
+    // Inherited methods overridden:
+    bool supports_in_place() const override;
 };
 
 /** Basic function to run @ref NEComplexPixelWiseMultiplicationKernel. */
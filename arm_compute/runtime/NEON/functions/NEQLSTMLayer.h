@@ -35,9 +35,12 @@
 #include "arm_compute/runtime/NEON/functions/NEGEMMLowpOutputStage.h"
 #include "arm_compute/runtime/NEON/functions/NEPixelWiseMultiplication.h"
 #include "arm_compute/runtime/NEON/functions/NETranspose.h"
+#include "arm_compute/runtime/SubTensor.h"
 
 #include "arm_compute/runtime/common/LSTMParams.h"
 
+#include <memory>
+
 namespace arm_compute
 {
 // Forward declarations
@@ -204,6 +207,21 @@ private:
                       Tensor *outstage_res, float gemmlowp_scale,
                       const TensorInfo &mm_res_info, const TensorInfo &outstage_tensor_info);
 
+    /** Internal method to configure the output stage of a gate on its slice of the fused matrix-multiplication result.
+     *
+     * @param[in] outstage             Output stage function to use.
+     * @param[in] gemmlowp_info        GEMMLowp metadata to be used by the output stage.
+     * @param[in] mm_res               Gate's view on the fused matrix multiplication result.
+     * @param[in] bias                 Bias tensor to be added by the output stage.
+     * @param[in] outstage_res         Tensor to be used for storing the result of the output stage.
+     * @param[in] gemmlowp_scale       Real multiplier to be used computing multiplier and shift for requantization.
+     * @param[in] outstage_tensor_info Tensor info to be used to initialize output stage result tensor.
+     *
+     */
+    void configure_gate_outstage(NEGEMMLowpOutputStage &outstage, GEMMLowpOutputStageInfo &gemmlowp_info,
+                                 const ITensor *mm_res, const ITensor *bias, Tensor *outstage_res,
+                                 float gemmlowp_scale, const TensorInfo &outstage_tensor_info);
+
     MemoryGroup _memory_group{};
 
     /** A small internel kernel do the copy between two tensors */
@@ -255,8 +273,8 @@ private:
     NEGEMMLowpMatrixAReductionKernel _recurrent_to_output_reduction{};
     NEGEMMLowpMatrixAReductionKernel _projection_reduction{};
     NEArithmeticAddition             _projection_bias_add{};
-    NEGEMMLowpMatrixMultiplyCore     _mm_input_to_forget{};
-    NEGEMMLowpMatrixMultiplyCore     _mm_recurrent_to_forget{};
+    NEGEMMLowpMatrixMultiplyCore     _mm_input_gates{};
+    NEGEMMLowpMatrixMultiplyCore     _mm_recurrent_gates{};
     NEPixelWiseMultiplication        _pixelwise_mul_cell_to_forget{};
     NEGEMMLowpOutputStage            _input_to_forget_outstage{};
     NEGEMMLowpOutputStage            _recurrent_to_forget_outstage{};
@@ -264,16 +282,12 @@ private:
     NEArithmeticAddition             _accumulate_input_recurrent_forget{};
     NEArithmeticAddition             _accumulate_cell_forget{};
     NEActivationLayer                _forget_gate_sigmoid{};
-    NEGEMMLowpMatrixMultiplyCore     _mm_input_to_cell{};
     NEGEMMLowpOutputStage            _input_to_cell_outstage{};
-    NEGEMMLowpMatrixMultiplyCore     _mm_recurrent_to_cell{};
     NEGEMMLowpOutputStage            _recurrent_to_cell_outstage{};
     NEArithmeticAddition             _accumulate_input_recurrent_modulation{};
     NEActivationLayer                _cell_gate_tanh{};
     NEArithmeticSubtraction          _input_gate_sub{};
-    NEGEMMLowpMatrixMultiplyCore     _mm_input_to_input{};
     NEGEMMLowpOutputStage            _input_to_input_outstage{};
-    NEGEMMLowpMatrixMultiplyCore     _mm_recurrent_to_input{};
     NEGEMMLowpOutputStage            _recurrent_to_input_outstage{};
     NEArithmeticAddition             _accumulate_input_recurrent_input{};
     NEPixelWiseMultiplication        _pixelwise_mul_cell_to_input{};
@@ -284,9 +298,7 @@ private:
     NEPixelWiseMultiplication        _pixelwise_mul_input_cell{};
     NEArithmeticAddition             _add_forget_cell{};
     NEActivationLayer                _cell_clip{};
-    NEGEMMLowpMatrixMultiplyCore     _mm_input_to_output{};
     NEGEMMLowpOutputStage            _input_to_output_outstage{};
-    NEGEMMLowpMatrixMultiplyCore     _mm_recurrent_to_output{};
     NEGEMMLowpOutputStage            _recurrent_to_output_outstage{};
     NEArithmeticAddition             _accumulate_input_recurrent_output{};
     NEPixelWiseMultiplication        _pixelwise_mul_cell_to_output{};
@@ -381,6 +393,18 @@ private:
     }
 
     // Temporary tensors
+    Tensor _input_weights_fused{ nullptr };
+    Tensor _recurrent_weights_fused{ nullptr };
+    Tensor _mm_input_gates_res{ nullptr };
+    Tensor _mm_recurrent_gates_res{ nullptr };
+    std::unique_ptr<SubTensor> _mm_input_to_forget_slice{};
+    std::unique_ptr<SubTensor> _mm_recurrent_to_forget_slice{};
+    std::unique_ptr<SubTensor> _mm_input_to_cell_slice{};
+    std::unique_ptr<SubTensor> _mm_recurrent_to_cell_slice{};
+    std::unique_ptr<SubTensor> _mm_input_to_input_slice{};
+    std::unique_ptr<SubTensor> _mm_recurrent_to_input_slice{};
+    std::unique_ptr<SubTensor> _mm_input_to_output_slice{};
+    std::unique_ptr<SubTensor> _mm_recurrent_to_output_slice{};
     Tensor _input_to_forget_weights_transposed{ nullptr };
     Tensor _input_to_cell_weights_transposed{ nullptr };
     Tensor _input_to_output_weights_transposed{ nullptr };
@@ -400,29 +424,21 @@ private:
     Tensor _recurrent_to_output_eff_bias{ nullptr };
     Tensor _projection_reduction_res{ nullptr };
     Tensor _projection_eff_bias{ nullptr };
-    Tensor _mm_input_to_forget_res{ nullptr };
-    Tensor _mm_recurrent_to_forget_res{ nullptr };
     Tensor _mul_cell_to_forget_res{ nullptr };
     Tensor _input_to_forget_outstage_res{ nullptr };
     Tensor _cell_to_forget_outstage_res{ nullptr };
     Tensor _recurrent_to_forget_outstage_res{ nullptr };
     Tensor _forget_gate{ nullptr };
-    Tensor _mm_input_to_cell_res{ nullptr };
     Tensor _input_to_cell_outstage_res{ nullptr };
-    Tensor _mm_recurrent_to_cell_res{ nullptr };
     Tensor _recurrent_to_cell_outstage_res{ nullptr };
     Tensor _cell_gate{ nullptr };
     Tensor _mul_input_cell_res{ nullptr };
-    Tensor _mm_input_to_input_res{ nullptr };
     Tensor _input_to_input_outstage_res{ nullptr };
-    Tensor _mm_recurrent_to_input_res{ nullptr };
     Tensor _mul_cell_to_input_res{ nullptr };
     Tensor _cell_to_input_outstage_res{ nullptr };
     Tensor _recurrent_to_input_outstage_res{ nullptr };
     Tensor _input_gate{ nullptr };
-    Tensor _mm_input_to_output_res{ nullptr };
     Tensor _input_to_output_outstage_res{ nullptr };
-    Tensor _mm_recurrent_to_output_res{ nullptr };
     Tensor _mul_cell_to_output_res{ nullptr };
     Tensor _cell_to_output_outstage_res{ nullptr };
     Tensor _recurrent_to_output_outstage_res{ nullptr };
@@ -24,7 +24,9 @@
 #ifndef ARM_COMPUTE_NEROIALIGNLAYER_H
 #define ARM_COMPUTE_NEROIALIGNLAYER_H
 
-#include "arm_compute/runtime/NEON/INESimpleFunction.h"
+#include "arm_compute/runtime/IFunction.h"
+
+#include "arm_compute/core/NEON/kernels/NEROIAlignLayerKernel.h"
 
 namespace arm_compute
 {
@@ -36,9 +38,11 @@ class ITensor;
  * -# @ref NEROIAlignLayerKernel
  *
  */
-class NEROIAlignLayer : public INESimpleFunction
+class NEROIAlignLayer : public IFunction
 {
 public:
+    /** Constructor */
+    NEROIAlignLayer();
     /** Set the input and output tensors.
      *
      * @param[in]  input     Source tensor. Data types supported: QASYMM8/F16/F32.
@@ -70,6 +74,12 @@ public:
      * @return a Status
      */
     static Status validate(const ITensorInfo *input, const ITensorInfo *rois, ITensorInfo *output, const ROIPoolingLayerInfo &pool_info);
+
+    // Inherited methods overridden:
+    void run() override;
+
+private:
+    NEROIAlignLayerKernel _roi_align_kernel;
 };
 } // namespace arm_compute
 #endif /* ARM_COMPUTE_NEROIALIGNLAYER_H */
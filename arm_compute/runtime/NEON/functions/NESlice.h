@@ -93,6 +93,8 @@ public:
      * @note Start indices must be non-negative. 0 <= starts[i]
      * @note End coordinates can be negative, which represents the number of elements before the end of that dimension.
      * @note End indices are not inclusive unless negative.
+     * @note If the slice selects a contiguous block of the input and @p output has not been allocated
+     *       its own memory, @p output becomes a zero-copy view of @p input on the first run.
      *
      * @param[in]  input  Source tensor. Data type supported: All
      * @param[out] output Destination tensor. Data type supported: Same as @p input
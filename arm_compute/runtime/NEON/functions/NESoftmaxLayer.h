@@ -28,6 +28,7 @@
 #include "arm_compute/core/NEON/kernels/NESoftmaxLayerKernel.h"
 #include "arm_compute/runtime/IFunction.h"
 #include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/NEON/INEOperator.h"
 #include "arm_compute/runtime/NEON/functions/NEFlattenLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEReshapeLayer.h"
 #include "arm_compute/runtime/Tensor.h"
@@ -45,9 +46,10 @@ class ITensor;
  * @f[ out = (x - max(x) * beta) - log(\sum{e^{x - max(x) * beta}}) @f]
  *
  * This function runs the following kernels:
- * -# @ref NEFillBorderKernel
- * -# @ref NELogits1DMaxKernel
- * -# @ref NELogits1DSoftmaxKernel
+ * -# @ref NELogits1DOnlineSoftmaxKernel (if the data type is F16/F32)
+ * -# @ref NEFillBorderKernel (if the data type is quantized)
+ * -# @ref NELogits1DMaxKernel (if the data type is quantized)
+ * -# @ref NELogits1DSoftmaxKernel (if the data type is quantized)
  */
 template <bool IS_LOG = false>
 class NESoftmaxLayerGeneric : public IFunction
@@ -101,21 +103,58 @@ private:
      */
     void configure_reshape_input_kernel(const ITensor *input, const ITensor *output, int32_t axis);
 
-    MemoryGroup                     _memory_group;
-    NELogits1DMaxKernel             _max_kernel;
-    NELogits1DSoftmaxKernel<IS_LOG> _softmax_kernel;
-    std::unique_ptr<IFunction>      _flat_or_reshape_ptr;
-    NEFillBorderKernel              _fill_border_kernel;
-    NEReshapeLayer                  _reshape;
-    Tensor                          _max;
-    Tensor                          _tmp;
-    Tensor                          _input_flattened;
-    Tensor                          _output_flattened;
-    bool                            _needs_flattening;
+    MemoryGroup                           _memory_group;
+    NELogits1DMaxKernel                   _max_kernel;
+    NELogits1DSoftmaxKernel<IS_LOG>       _softmax_kernel;
+    NELogits1DOnlineSoftmaxKernel<IS_LOG> _online_softmax_kernel;
+    std::unique_ptr<IFunction>            _flat_or_reshape_ptr;
+    NEFillBorderKernel                    _fill_border_kernel;
+    NEReshapeLayer                        _reshape;
+    Tensor                                _max;
+    Tensor                                _tmp;
+    Tensor                                _input_flattened;
+    Tensor                                _output_flattened;
+    bool                                  _needs_flattening;
+    bool                                  _use_online_softmax;
 };
 
 using NESoftmaxLayer    = NESoftmaxLayerGeneric<false>;
 using NELogSoftmaxLayer = NESoftmaxLayerGeneric<true>;
 
+namespace experimental
+{
+/** Basic function to run @ref NELogits1DOnlineSoftmaxKernel
+ *
+ * The operator keeps no tensor pointers: the tensors to operate on are supplied per run
+ * through the tensor pack, so one configured instance can serve many concurrent tensor
+ * sets. Only the single-pass float path is exposed; the quantized softmax needs the max
+ * and exponentials workspace tensors of @ref NESoftmaxLayerGeneric.
+ */
+template <bool IS_LOG = false>
+class NESoftmaxGeneric : public INEOperator
+{
+public:
+    /** Initialise the kernel's inputs and outputs
+     *
+     * @param[in]  input  Source tensor info. Data types supported: F16/F32.
+     * @param[out] output Destination tensor info. Data types supported: same as @p input.
+     * @param[in]  beta   (Optional) A scaling factor for the exponent.
+     */
+    void configure(const ITensorInfo *input, ITensorInfo *output, float beta = 1.0f);
+
+    /** Static function to check if given info will lead to a valid configuration of @ref NESoftmaxGeneric
+     *
+     * @param[in] input  Source tensor info. Data types supported: F16/F32.
+     * @param[in] output Destination tensor info. Data types supported: same as @p input.
+     * @param[in] beta   (Optional) A scaling factor for the exponent.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *output, float beta = 1.0f);
+};
+
+using NESoftmax    = NESoftmaxGeneric<false>;
+using NELogSoftmax = NESoftmaxGeneric<true>;
+} // namespace experimental
 } // namespace arm_compute
 #endif /* ARM_COMPUTE_NESOFTMAXLAYER_H */
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_NESPARSETRANSITION_H
+#define ARM_COMPUTE_NESPARSETRANSITION_H
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/INESimpleFunctionNoBorder.h"
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+
+/** Basic function to run @ref NESparseCompressKernel.
+ *
+ * Opt-in compressed transition format for high-sparsity activations: the dense tensor is turned
+ * into a presence bitmap plus a packed stream of its non-zero values, cutting the DDR traffic of
+ * a 60-90% sparse transition to a fraction of the dense footprint. The reported non-zero count
+ * lets callers profile the sparsity actually observed and decide whether compressing a given
+ * transition pays off.
+ */
+class NESparseCompress : public INESimpleFunctionNoBorder
+{
+public:
+    /** Initialise the kernel's inputs and outputs
+     *
+     * @param[in]  input    Source tensor. Data type supported: F32
+     * @param[out] bitmap   Presence bitmap, one bit per element of @p input. Data type supported: U8
+     * @param[out] nonzeros Packed non-zero values. Data type supported: same as @p input
+     * @param[out] nnz      Number of non-zero values written to @p nonzeros. Data type supported: U32
+     */
+    void configure(const ITensor *input, ITensor *bitmap, ITensor *nonzeros, ITensor *nnz);
+
+    /** Static function to check if given info will lead to a valid configuration of @ref NESparseCompress
+     *
+     * @param[in] input    Source tensor info. Data type supported: F32
+     * @param[in] bitmap   Presence bitmap info. Data type supported: U8
+     * @param[in] nonzeros Packed non-zero values info. Data type supported: same as @p input
+     * @param[in] nnz      Non-zero count info. Data type supported: U32
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *bitmap, const ITensorInfo *nonzeros, const ITensorInfo *nnz);
+};
+
+/** Basic function to run @ref NESparseDecompressKernel */
+class NESparseDecompress : public INESimpleFunctionNoBorder
+{
+public:
+    /** Initialise the kernel's inputs and outputs
+     *
+     * @param[in]  bitmap   Presence bitmap, one bit per element of @p output. Data type supported: U8
+     * @param[in]  nonzeros Packed non-zero values. Data type supported: F32
+     * @param[out] output   Destination tensor, must carry the dense shape. Data type supported: same as @p nonzeros
+     */
+    void configure(const ITensor *bitmap, const ITensor *nonzeros, ITensor *output);
+
+    /** Static function to check if given info will lead to a valid configuration of @ref NESparseDecompress
+     *
+     * @param[in] bitmap   Presence bitmap info. Data type supported: U8
+     * @param[in] nonzeros Packed non-zero values info. Data type supported: F32
+     * @param[in] output   Destination tensor info. Data type supported: same as @p nonzeros
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *bitmap, const ITensorInfo *nonzeros, const ITensorInfo *output);
+};
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_NESPARSETRANSITION_H */
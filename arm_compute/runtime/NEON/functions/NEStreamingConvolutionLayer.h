@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_NESTREAMINGCONVOLUTIONLAYER_H
+#define ARM_COMPUTE_NESTREAMINGCONVOLUTIONLAYER_H
+
+#include "arm_compute/runtime/IFunction.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+#include "arm_compute/runtime/IWeightsManager.h"
+#include "arm_compute/runtime/NEON/functions/NEConvolutionLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+/** Basic function to run a convolution over a sliding window of a streamed signal, recomputing only what the new samples changed.
+ *
+ * Intended for streaming audio models that run a convolution over a sliding spectrogram window: every step only
+ * @p hop new frames enter the window, yet a stateless convolution recomputes all of it. This function keeps the
+ * window and the previous result as internal state. Each call to @ref run() receives only the new frames, shifts
+ * the cached window and output left along the time axis (the x dimension) and convolves just the tail region that
+ * the new frames influence, cutting the per-step work by roughly the window/hop ratio.
+ *
+ * The first call after configuration (or after @ref reset()) primes the state: the window is filled with zeros
+ * (the quantization offset for quantized types) before the new frames enter, and the whole window is convolved once.
+ *
+ * Restrictions:
+ * -# NCHW layout, with time along the x dimension.
+ * -# No padding along x: with padding, the values under the window edges would change as the window slides.
+ * -# The hop (the x dimension of the step input) must be a multiple of the x stride, and the window width must
+ *    place the last kernel position exactly at the window edge, so cached output columns stay aligned as they shift.
+ */
+class NEStreamingConvolutionLayer : public IFunction
+{
+public:
+    /** Constructor
+     *
+     * @param[in] memory_manager  (Optional) Memory manager.
+     * @param[in] weights_manager (Optional) Weights manager.
+     */
+    NEStreamingConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager = nullptr, IWeightsManager *weights_manager = nullptr);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEStreamingConvolutionLayer(const NEStreamingConvolutionLayer &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEStreamingConvolutionLayer &operator=(const NEStreamingConvolutionLayer &) = delete;
+    /** Set the input and output tensors.
+     *
+     * @param[in]  input            Step input tensor holding only the new frames of the window, [hop, height, IFM].
+     *                              Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
+     * @param[in]  weights          Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data type supported: Same as @p input.
+     * @param[in]  biases           Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM].
+     *                              Data type supported: Should match @p input data type, except for input of QASYMM8/QASYMM8_SIGNED type where biases should be of S32 type.
+     * @param[out] output           Destination tensor holding the convolution of the full window, [out_width, out_height, OFM].
+     *                              Data types supported: Same as @p input.
+     * @param[in]  conv_info        Contains padding and stride information described in @ref PadStrideInfo. Padding along x is not supported.
+     * @param[in]  window_width     Width of the sliding window, in elements, along the time axis.
+     * @param[in]  act_info         (Optional) Activation layer information in case of a fused activation. Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU supported.
+     * @param[in]  enable_fast_math (Optional) Enable fast math computation. In case this flag were set, the function could dispatch the fastest implementation
+     *                              available which may introduce a drop of accuracy as well. Default is false
+     */
+    void configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, unsigned int window_width,
+                   const ActivationLayerInfo &act_info = ActivationLayerInfo(), bool enable_fast_math = false);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEStreamingConvolutionLayer
+     *
+     * @param[in] input            Step input tensor info holding only the new frames of the window, [hop, height, IFM].
+     *                             Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
+     * @param[in] weights          Weights tensor info. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data type supported: Same as @p input.
+     * @param[in] biases           Biases tensor info. Shared biases supported. Biases are 1D tensor with dimensions [OFM].
+     *                             Data type supported: Should match @p input data type, except for input of QASYMM8/QASYMM8_SIGNED type where biases should be of S32 type.
+     * @param[in] output           Destination tensor info holding the convolution of the full window, [out_width, out_height, OFM].
+     *                             Data types supported: Same as @p input.
+     * @param[in] conv_info        Contains padding and stride information described in @ref PadStrideInfo. Padding along x is not supported.
+     * @param[in] window_width     Width of the sliding window, in elements, along the time axis.
+     * @param[in] act_info         (Optional) Activation layer information in case of a fused activation. Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU supported.
+     * @param[in] enable_fast_math (Optional) Enable fast math computation. In case this flag were set, the function could dispatch the fastest implementation
+     *                             available which may introduce a drop of accuracy as well. Default is false
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info, unsigned int window_width,
+                           const ActivationLayerInfo &act_info = ActivationLayerInfo(), bool enable_fast_math = false);
+    /** Discard the cached window and output, so the next call to @ref run() primes the state again */
+    void reset();
+
+    // Inherited methods overridden:
+    void run() override;
+    void prepare() override;
+
+private:
+    NEConvolutionLayer _full_conv;   /**< Full-window convolution, runs once to prime the state */
+    NEConvolutionLayer _tail_conv;   /**< Tail convolution covering only the output columns the new frames influence */
+    Tensor             _window;      /**< Sliding input window state */
+    Tensor             _tail_input;  /**< Rightmost columns of the window the tail convolution reads */
+    Tensor             _tail_output; /**< New output columns produced by the tail convolution */
+    const ITensor     *_input;
+    ITensor           *_output;
+    unsigned int       _hop;      /**< New input columns entering the window per step */
+    unsigned int       _new_cols; /**< Output columns recomputed per step */
+    bool               _primed;   /**< True once the full window has been convolved */
+};
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_NESTREAMINGCONVOLUTIONLAYER_H */
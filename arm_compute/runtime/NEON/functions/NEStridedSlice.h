@@ -96,6 +96,8 @@ public:
     /** Configure kernel
      *
      * @note Supported tensor rank: up to 4
+     * @note If the slice is unit-stride, selects a contiguous block of the input and @p output has not
+     *       been allocated its own memory, @p output becomes a zero-copy view of @p input on the first run.
      *
      * @param[in]  input            Source tensor. Data type supported: All
      * @param[out] output           Destination tensor. Data type supported: Same as @p input
@@ -41,6 +41,63 @@ namespace arm_compute
 {
 // Forward declarations
 class ITensor;
+class INEWinogradLayerTransformWeightsKernel;
+
+namespace weights_transformations
+{
+/** Basic function to manage the Winograd weight transform, i.e. the HWIO permutation followed by a @ref INEWinogradLayerTransformWeightsKernel */
+class NEWinogradLayerTransformWeightsManaged : public ITransformWeights
+{
+public:
+    /** Configures the permutation and the weight transform kernel
+     *
+     * @param[in] weights             Weights tensor, as passed to the layer. Data types supported: F16/F32.
+     * @param[in] transform_kernel    Weight transform kernel to run. Configured against the internal tensors; the caller keeps ownership.
+     * @param[in] permutation_vector  Permutation re-ordering the weights into HWIO
+     * @param[in] storage_info        Tensor info of the transformed weight storage
+     * @param[in] storage_alignment   Alignment of the transformed weight storage
+     * @param[in] matrix_stride       Stride between the transformed weight matrices
+     * @param[in] num_output_channels Number of output channels of the convolution
+     * @param[in] num_input_channels  Number of input channels of the convolution
+     * @param[in] output_tile         Winograd output tile size, part of the transform's identity
+     * @param[in] kernel_size         Convolution kernel size, part of the transform's identity
+     */
+    void configure(const ITensor *weights, INEWinogradLayerTransformWeightsKernel *transform_kernel, const PermutationVector &permutation_vector,
+                   const TensorInfo &storage_info, size_t storage_alignment, int matrix_stride, int num_output_channels, int num_input_channels,
+                   const Size2D &output_tile, const Size2D &kernel_size);
+
+    // Inherited methods overridden:
+    void run() override;
+
+    void release() override
+    {
+        _output.allocator()->free();
+    }
+
+    ITensor *get_weights() override
+    {
+        return &_output;
+    }
+
+    bool allocate_only() override
+    {
+        _output.allocator()->allocate();
+        return _output.buffer() != nullptr;
+    }
+
+    uint32_t uid() override
+    {
+        return _uid;
+    }
+
+private:
+    uint32_t                                _uid{ 0x9 };
+    Tensor                                  _output{};
+    Tensor                                  _hwio{};
+    CPPPermute                              _permute{};
+    INEWinogradLayerTransformWeightsKernel *_kernel{ nullptr };
+};
+} // namespace weights_transformations
 
 /** Basic function to simulate a convolution layer. This function calls the following NEON kernels:
  * -# @ref NEWinogradLayerTransformWeightsKernel (executed only once in the first call to the run() method )
@@ -55,7 +112,7 @@ class NEWinogradConvolutionLayer : public IFunction
 {
 public:
     /** Constructor */
-    NEWinogradConvolutionLayer(const std::shared_ptr<IMemoryManager> &memory_manager = nullptr);
+    NEWinogradConvolutionLayer(const std::shared_ptr<IMemoryManager> &memory_manager = nullptr, IWeightsManager *weights_manager = nullptr);
 
     /** Set the input and output tensors.
      *
@@ -106,6 +163,7 @@ public:
 
 private:
     MemoryGroup                _memory_group;
+    IWeightsManager           *_weights_manager;
     NEGEMM                     _gemm_function;
     std::unique_ptr<INEKernel> _transform_input_kernel;
     std::unique_ptr<INEKernel> _transform_output_kernel;
@@ -115,6 +173,7 @@ private:
     CPPPermute     _permute_input;
     CPPPermute     _permute_weights;
     CPPPermute     _permute_output;
+    weights_transformations::NEWinogradLayerTransformWeightsManaged _transform_weights_managed;
     Tensor         _input_transformed;
     Tensor         _output_transformed;
     Tensor         _input_workspace;
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_NUMA_AWARE_ALLOCATOR_H
+#define ARM_COMPUTE_NUMA_AWARE_ALLOCATOR_H
+
+#include "arm_compute/runtime/IAllocator.h"
+
+#include "arm_compute/runtime/IMemoryRegion.h"
+
+#include <cstddef>
+#include <map>
+#include <mutex>
+
+namespace arm_compute
+{
+class IScheduler;
+
+/** NUMA- and cluster-aware allocator implementation
+ *
+ * Backs allocations with anonymous pages and places them by first-touching
+ * them from the scheduler's worker threads: as the workers carry the core
+ * binding requested through @ref IScheduler::set_num_threads_with_affinity,
+ * pages end up on the node/cluster of the thread that will process them
+ * instead of the node that happened to fault them first.
+ *
+ * Can be passed to @ref MemoryManagerOnDemand::populate so that pooled tensor
+ * memory is NUMA-placed too.
+ */
+class NumaAwareAllocator final : public IAllocator
+{
+public:
+    /** Page placement policy */
+    enum class PlacementPolicy
+    {
+        FirstTouch, /**< Each worker touches the contiguous strip of pages it will process */
+        Interleave  /**< Pages are touched round-robin across the workers */
+    };
+
+    /** Constructor
+     *
+     * @param[in] policy    (Optional) Page placement policy. Defaults to first-touch.
+     * @param[in] scheduler (Optional) Scheduler whose (bound) workers perform the first touch.
+     *                      Defaults to the global scheduler.
+     */
+    NumaAwareAllocator(PlacementPolicy policy = PlacementPolicy::FirstTouch, IScheduler *scheduler = nullptr);
+
+    // Inherited methods overridden:
+    void *allocate(size_t size, size_t alignment) override;
+    void free(void *ptr) override;
+    std::unique_ptr<IMemoryRegion> make_region(size_t size, size_t alignment) override;
+
+private:
+    PlacementPolicy _policy;
+    IScheduler     *_scheduler;
+    std::map<void *, size_t> _allocations; /**< Size of each live allocation, needed to unmap */
+    std::mutex               _allocations_mutex;
+};
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_NUMA_AWARE_ALLOCATOR_H */
@@ -59,6 +59,17 @@ public:
      * @return Lifetime manager internal configuration meta-data
      */
     const info_type &info() const;
+    /** Imports a previously exported memory plan to skip the offset calculation
+     *
+     * Plan regions are matched to registered objects by their lifetime interval, which is
+     * deterministic for a given registration order. Groups whose objects are not fully
+     * covered by the plan fall back to the on-line calculation. Importing a plan also
+     * fixes the blob size upfront, which allows placing the whole arena in a specific
+     * memory before any lifetime is registered.
+     *
+     * @param[in] plan Plan to import. Must use @ref MappingType::OFFSETS.
+     */
+    void import_plan(const MemoryReport &plan);
 
     // Inherited methods overridden:
     std::unique_ptr<IMemoryPool> create_pool(IAllocator *allocator) override;
@@ -68,8 +79,16 @@ private:
     // Inherited methods overridden:
     void update_blobs_and_mappings() override;
 
+    /** Attempts to map the finalizing group from the imported plan
+     *
+     * @return True if every bound element was matched and mapped from the plan
+     */
+    bool update_mappings_from_plan();
+
 private:
-    BlobInfo _blob; /**< Memory blob size */
+    BlobInfo                            _blob;             /**< Memory blob size */
+    std::map<size_t, MemoryRegionReport> _imported_regions; /**< Imported plan regions, keyed by lifetime start */
+    size_t                              _imported_total;   /**< Total bytes of the imported plan */
 };
 } // namespace arm_compute
 #endif /* ARM_COMPUTE_OFFSETLIFETIMEMANAGER_H */
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_OPERATOR_KERNEL_CACHE_H
+#define ARM_COMPUTE_OPERATOR_KERNEL_CACHE_H
+
+#include "support/Mutex.h"
+
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+
+namespace arm_compute
+{
+// Forward declarations
+class Coordinates;
+class ICPPKernel;
+class ITensorInfo;
+
+/** Key identifying one stateless kernel configuration
+ *
+ * Serializes the kernel type name, the descriptors of the tensors taking part in the
+ * configuration and the scalar operator parameters into a byte string. Configurations
+ * serializing to the same bytes produce interchangeable kernels, so lookups compare the
+ * full key and never alias distinct configurations.
+ */
+class KernelCacheKey final
+{
+public:
+    /** Constructor
+     *
+     * @param[in] kernel_name Name of the kernel type being configured
+     */
+    explicit KernelCacheKey(const char *kernel_name);
+    /** Append the descriptor of a tensor taking part in the configuration
+     *
+     * Shape, strides, element offset, data type, layout and quantization parameters are
+     * captured as the configured window and selected micro-kernel may depend on any of them.
+     *
+     * @param[in] info Tensor info to append. Nullptr is captured as a distinct marker
+     *
+     * @return Reference to this key, for chaining
+     */
+    KernelCacheKey &add_tensor_info(const ITensorInfo *info);
+    /** Append a coordinates-like operator parameter
+     *
+     * @param[in] coords Coordinates to append
+     *
+     * @return Reference to this key, for chaining
+     */
+    KernelCacheKey &add_coordinates(const Coordinates &coords);
+    /** Append a scalar operator parameter
+     *
+     * @param[in] value Value to append. Must be trivially copyable
+     *
+     * @return Reference to this key, for chaining
+     */
+    template <typename T>
+    KernelCacheKey &add_value(T value)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "Kernel cache key parameters must be trivially copyable");
+        append(&value, sizeof(value));
+        return *this;
+    }
+    /** Serialized key accessor
+     *
+     * @return The serialized key bytes
+     */
+    const std::string &bytes() const;
+
+private:
+    /** Append a raw byte range to the key */
+    void append(const void *data, size_t size);
+
+    std::string _bytes;
+};
+
+/** Cache of configured stateless operator kernels, owned by a runtime context
+ *
+ * Kernels dispatched through the @ref ITensorPack run interface keep no tensor pointers,
+ * so one configured instance can back every operator with an identical configuration.
+ * Repeat configurations then cost a hash lookup instead of a kernel construction,
+ * validation and window calculation. Thread-safe.
+ */
+class OperatorKernelCache final
+{
+public:
+    /** Look up a configured kernel
+     *
+     * @param[in] key Key of the configuration
+     *
+     * @return The cached kernel, or nullptr if the configuration has not been seen
+     */
+    std::shared_ptr<ICPPKernel> find(const KernelCacheKey &key);
+    /** Publish a configured kernel
+     *
+     * @param[in] key    Key of the configuration
+     * @param[in] kernel Configured kernel to share. Must hold no per-run state
+     */
+    void add(const KernelCacheKey &key, std::shared_ptr<ICPPKernel> kernel);
+    /** Number of cached kernels
+     *
+     * @return Number of distinct configurations held
+     */
+    size_t size() const;
+
+private:
+    mutable Mutex _mutex{};
+    std::unordered_map<std::string, std::shared_ptr<ICPPKernel>> _kernels{};
+};
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_OPERATOR_KERNEL_CACHE_H */
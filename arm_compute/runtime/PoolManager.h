@@ -31,6 +31,7 @@
 #include "support/Mutex.h"
 #include "support/Semaphore.h"
 
+#include <chrono>
 #include <cstddef>
 #include <list>
 #include <memory>
@@ -43,6 +44,17 @@ class PoolManager : public IPoolManager
 public:
     /** Default Constructor */
     PoolManager();
+    /** Enables elastic pool growth
+     *
+     * On exhaustion @ref lock_pool duplicates an existing pool instead of blocking, up to
+     * @p max_pools in total, trading transient memory for bounded tail latency. Surplus
+     * pools beyond the registered ones are destroyed again when they are unlocked and the
+     * manager has not been exhausted for @p idle_release.
+     *
+     * @param[in] max_pools    Maximum number of pools the manager may grow to. 0 disables growth.
+     * @param[in] idle_release (Optional) Idle period after which surplus pools are released. Defaults to 1s.
+     */
+    void set_elastic_growth(size_t max_pools, std::chrono::milliseconds idle_release = std::chrono::milliseconds(1000));
     /** Prevent instances of this class to be copy constructed */
     PoolManager(const PoolManager &) = delete;
     /** Prevent instances of this class to be copied */
@@ -65,6 +77,10 @@ private:
     std::list<std::unique_ptr<IMemoryPool>> _occupied_pools; /**< List of occupied pools */
     std::unique_ptr<arm_compute::Semaphore> _sem;            /**< Semaphore to control the queues */
     mutable arm_compute::Mutex              _mtx;            /**< Mutex to control access to the queues */
+    size_t                                  _max_pools;      /**< Elastic growth cap, 0 if growth is disabled */
+    size_t                                  _base_pools;     /**< Number of pools registered through register_pool */
+    std::chrono::milliseconds               _idle_release;   /**< Idle period after which surplus pools are released */
+    std::chrono::steady_clock::time_point   _last_exhausted; /**< Last time a pool was requested while none was free */
 };
 } // arm_compute
 #endif /*ARM_COMPUTE_POOLMANAGER_H */
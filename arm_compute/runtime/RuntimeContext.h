@@ -26,6 +26,7 @@
 
 #include "arm_compute/runtime/DeviceProperties.h"
 #include "arm_compute/runtime/IRuntimeContext.h"
+#include "arm_compute/runtime/OperatorKernelCache.h"
 
 #include <memory>
 
@@ -54,11 +55,13 @@ public:
     IScheduler             *scheduler() override;
     IAssetManager          *asset_manager() override;
     const DeviceProperties &properties() override;
+    OperatorKernelCache    *kernel_cache() override;
 
 private:
     std::unique_ptr<IScheduler> _owned_scheduler{ nullptr };
     IScheduler                 *_scheduler{ nullptr };
     DeviceProperties            _device_props{};
+    OperatorKernelCache         _kernel_cache{};
 };
 } // namespace arm_compute
 #endif /*ARM_COMPUTE_RUNTIME_CONTEXT_H */
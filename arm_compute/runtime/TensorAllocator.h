@@ -100,6 +100,11 @@ public:
      * @warning memory must be writable in case of in-place operations
      * @note buffer alignment will be checked to be compliant with alignment reported by ITensorInfo.
      *
+     * Alignment contract: the pointer must satisfy the alignment reported by this allocator
+     * (@ref ITensorAllocator::alignment), which is at most the size of a cache line. Buffers
+     * delivered by external producers as dma-buf file descriptors can therefore be imported
+     * zero-copy by passing their mmap'ed address, as dma-buf mappings are page aligned.
+     *
      * @param[in] memory Raw memory pointer to be used as backing memory
      *
      * @return An error status
@@ -27,9 +27,18 @@
 #include "arm_compute/runtime/IMemory.h"
 
 #include <map>
+#include <vector>
 
 namespace arm_compute
 {
+/** Page commitment policy applied when allocating backing memory */
+enum class AllocationPolicy
+{
+    Lazy,     /**< Pages are faulted in on first access */
+    Prefault, /**< Pages are touched at allocation time, trading startup time for deterministic first-access latency */
+    Pinned    /**< Pages are touched and locked in memory at allocation time */
+};
+
 /** Mapping type */
 enum class MappingType
 {
@@ -58,5 +67,30 @@ struct BlobInfo
     size_t alignment; /**< Blob alignment */
     size_t owners;    /**< Number of owners in parallel of the blob */
 };
+
+/** Placement and lifetime meta-data of a single managed object, for introspection */
+struct MemoryRegionReport
+{
+    size_t group_id{ 0 };       /**< Ordinal of the memory group the object belongs to */
+    size_t placement{ 0 };      /**< Blob index (blob mappings) or byte offset in the pool (offset mappings) */
+    size_t size{ 0 };           /**< Object size in bytes */
+    size_t alignment{ 0 };      /**< Alignment requirement of the object in bytes */
+    size_t lifetime_start{ 0 }; /**< Serial at which the object's lifetime started */
+    size_t lifetime_end{ 0 };   /**< Serial at which the object's lifetime ended */
+};
+
+/** Memory requirements report of a lifetime manager, for introspection
+ *
+ * Describes the memory plan of one pool; multiply @p total_bytes by
+ * @ref IPoolManager::num_pools for the footprint of a multi-pool setup.
+ */
+struct MemoryReport
+{
+    MappingType mapping_type{ MappingType::BLOBS }; /**< Mapping granularity of the placements */
+    size_t      total_bytes{ 0 };                   /**< Bytes a pool created from the current state occupies */
+    size_t      peak_bytes{ 0 };                    /**< High-water mark of concurrently live object bytes within a group */
+    std::vector<size_t>             blob_sizes{};   /**< Per-blob sizes (blob mappings only) */
+    std::vector<MemoryRegionReport> regions{};      /**< Per-object placements and lifetime spans */
+};
 } // namespace arm_compute
 #endif /* ARM_COMPUTE_RUNTIME_TYPES_H */
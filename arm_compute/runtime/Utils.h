@@ -47,6 +47,15 @@ const std::string &string_from_scheduler_type(Scheduler::Type t);
  */
 void schedule_kernel_on_ctx(IRuntimeContext *ctx, ICPPKernel *kernel, const IScheduler::Hints &hints);
 
+/** Schedules a kernel operating on a tensor pack using the context if not nullptr else uses the legacy scheduling flow.
+ *
+ * @param[in]     ctx     Context to use.
+ * @param[in]     kernel  Kernel to schedule.
+ * @param[in]     hints   Hints to use.
+ * @param[in,out] tensors Tensor pack to operate on.
+ */
+void schedule_op_on_ctx(IRuntimeContext *ctx, ICPPKernel *kernel, const IScheduler::Hints &hints, ITensorPack &tensors);
+
 /** Calculate number of stages for parallel implementations
  *
  * @param[in] input_x_dimension input tensor x dimension
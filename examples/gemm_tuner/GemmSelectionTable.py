@@ -0,0 +1,99 @@
+# Copyright (c) 2020 ARM Limited.
+#
+# SPDX-License-Identifier: MIT
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to
+# deal in the Software without restriction, including without limitation the
+# rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+# sell copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+#!/usr/bin/python3
+
+"""Convert the gemm_type_selection.json produced by GemmTuner.py into a runtime
+GEMM kernel selection table.
+
+The output file can be loaded by the library at runtime by pointing the
+ARM_COMPUTE_CL_GEMM_SELECTION_FILE environment variable at it, which overrides
+the compiled-in selection heuristics for the benchmarked shapes (see
+CLGEMMKernelSelectionTable).
+
+Usage:
+    python3 GemmSelectionTable.py -i heuristics/gemm_type_selection.json -o gemm_selection_table.txt
+"""
+
+import argparse
+import json
+
+# Maps GemmTuner.py strategy names to runtime kernel type names
+STRATEGY_TO_KERNEL_TYPE = {
+    "Native": "native",
+    "ReshapedOnlyRHS": "reshaped_only_rhs",
+    "Reshaped": "reshaped",
+}
+
+
+def convert(in_path, out_path):
+    with open(in_path) as in_fp:
+        type_selection = json.load(in_fp)
+
+    lines = ["# data_type m n k is_rhs_constant kernel_type"]
+    for gemm_param, strategy in sorted(type_selection.items()):
+        # GEMMParam keys are "M,N,K,B,data_type"; B is not part of the runtime
+        # selection parameters, so entries differing only in B must agree
+        m, n, k, _, data_type = gemm_param.split(",")
+        kernel_type = STRATEGY_TO_KERNEL_TYPE[strategy]
+        # The tuned strategies all assume a constant rhs matrix
+        lines.append(" ".join([data_type, m, n, k, "1", kernel_type]))
+
+    # Drop duplicate entries caused by folding away the batch size
+    entries = {}
+    conflicts = set()
+    for line in lines[1:]:
+        key = tuple(line.split()[:5])
+        if key in entries and entries[key] != line:
+            conflicts.add(" ".join(key))
+        entries[key] = line
+    if conflicts:
+        print(
+            "Warning: conflicting kernel types for {} (batch sizes disagree); keeping the last entry".format(
+                ", ".join(sorted(conflicts))
+            )
+        )
+
+    with open(out_path, "w") as out_fp:
+        out_fp.write("\n".join([lines[0]] + sorted(entries.values())) + "\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument(
+        "-i",
+        "--input",
+        required=True,
+        help="Path to the gemm_type_selection.json produced by GemmTuner.py",
+    )
+    parser.add_argument(
+        "-o",
+        "--output",
+        required=True,
+        help="Path to the runtime selection table file to write",
+    )
+    args = parser.parse_args()
+    convert(args.input, args.output)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph.h"
+#ifdef ARM_COMPUTE_CL
+#include "arm_compute/runtime/CL/Utils.h"
+#endif /* ARM_COMPUTE_CL */
+#include "support/ToolchainSupport.h"
+#include "utils/GraphUtils.h"
+#include "utils/Utils.h"
+
+#include <fstream>
+#include <sstream>
+#include <string>
+
+using namespace arm_compute;
+using namespace arm_compute::utils;
+using namespace arm_compute::graph::frontend;
+using namespace arm_compute::graph_utils;
+
+/** Offline CL kernel cache provisioning tool.
+ *
+ * Reads a graph description, lets the CL backend configure every layer exactly as it would at
+ * deployment (selecting the same kernel variants and build options through CLKernelLibrary),
+ * compiles all programs and emits the binary cache. Running the resulting cache file through
+ * restore_program_cache_from_file() on the field device (or passing --enable-cl-cache to the
+ * graph examples) removes all CL compilation from the first inference.
+ *
+ * The graph description is a text file with one layer per line, '#' starting a comment:
+ *
+ *     input      WIDTH HEIGHT CHANNELS [BATCHES]
+ *     conv       KERNEL_W KERNEL_H OFM STRIDE_X STRIDE_Y PAD_X PAD_Y
+ *     depthwise  KERNEL_W KERNEL_H STRIDE_X STRIDE_Y PAD_X PAD_Y
+ *     pool       max|avg SIZE STRIDE PAD
+ *     fc         OUTPUTS
+ *     activation relu|logistic|tanh
+ *     softmax
+ *
+ * Usage: graph_cl_cache_provisioner <graph_description> [cache_file]
+ */
+class GraphCLCacheProvisionerExample : public Example
+{
+public:
+    GraphCLCacheProvisionerExample()
+        : graph(0, "CLCacheProvisioner")
+    {
+    }
+    bool do_setup(int argc, char **argv) override
+    {
+#ifndef ARM_COMPUTE_CL
+        ARM_COMPUTE_UNUSED(argc, argv);
+        std::cout << "The provisioner needs a build with OpenCL support (opencl=1)" << std::endl;
+        return false;
+#else  /* ARM_COMPUTE_CL */
+        if(argc < 2)
+        {
+            std::cout << "Usage: " << argv[0] << " <graph_description> [cache_file]" << std::endl;
+            return false;
+        }
+        const std::string description_file = argv[1];
+        const std::string cache_file       = (argc > 2) ? argv[2] : "cache.bin";
+
+        std::ifstream description(description_file);
+        if(!description.is_open())
+        {
+            std::cout << "Cannot open graph description " << description_file << std::endl;
+            return false;
+        }
+
+        graph << graph::Target::CL;
+
+        std::string  line;
+        unsigned int line_no = 0;
+        bool         has_input = false;
+        while(std::getline(description, line))
+        {
+            ++line_no;
+            const size_t comment = line.find('#');
+            if(comment != std::string::npos)
+            {
+                line.erase(comment);
+            }
+            std::istringstream stream(line);
+            std::string        layer;
+            if(!(stream >> layer))
+            {
+                continue;
+            }
+            if(!parse_layer(stream, layer, has_input))
+            {
+                std::cout << "Malformed '" << layer << "' entry at " << description_file << ":" << line_no << std::endl;
+                return false;
+            }
+        }
+        if(!has_input)
+        {
+            std::cout << "The graph description contains no input layer" << std::endl;
+            return false;
+        }
+
+        graph << OutputLayer(arm_compute::support::cpp14::make_unique<DummyAccessor>(0));
+
+        // Finalizing configures every function of the graph, which compiles through CLKernelLibrary
+        // the exact kernel variants and build options the CL backend selects for these shapes
+        graph::GraphConfig config;
+        graph.finalize(graph::Target::CL, config);
+
+        save_program_cache_to_file(cache_file);
+        std::cout << "Saved compiled CL programs to " << cache_file << std::endl;
+
+        return true;
+#endif /* ARM_COMPUTE_CL */
+    }
+    void do_run() override
+    {
+        // Provisioning only: all the work happens at configure time, nothing to execute
+    }
+
+private:
+    /** Append the layer described by @p stream to the graph. Returns false on a parse error. */
+    bool parse_layer(std::istringstream &stream, const std::string &layer, bool &has_input)
+    {
+        if(layer == "input")
+        {
+            unsigned int width = 0, height = 0, channels = 0, batches = 1;
+            if(!(stream >> width >> height >> channels))
+            {
+                return false;
+            }
+            stream >> batches;
+            const graph::TensorDescriptor input_descriptor(TensorShape(width, height, channels, batches), DataType::F32);
+            graph << InputLayer(input_descriptor, arm_compute::support::cpp14::make_unique<DummyAccessor>());
+            has_input = true;
+        }
+        else if(layer == "conv")
+        {
+            unsigned int kernel_w = 0, kernel_h = 0, ofm = 0, stride_x = 0, stride_y = 0, pad_x = 0, pad_y = 0;
+            if(!(stream >> kernel_w >> kernel_h >> ofm >> stride_x >> stride_y >> pad_x >> pad_y))
+            {
+                return false;
+            }
+            graph << ConvolutionLayer(kernel_w, kernel_h, ofm,
+                                      get_weights_accessor("", ""), get_weights_accessor("", ""),
+                                      PadStrideInfo(stride_x, stride_y, pad_x, pad_y));
+        }
+        else if(layer == "depthwise")
+        {
+            unsigned int kernel_w = 0, kernel_h = 0, stride_x = 0, stride_y = 0, pad_x = 0, pad_y = 0;
+            if(!(stream >> kernel_w >> kernel_h >> stride_x >> stride_y >> pad_x >> pad_y))
+            {
+                return false;
+            }
+            graph << DepthwiseConvolutionLayer(kernel_w, kernel_h,
+                                               get_weights_accessor("", ""), get_weights_accessor("", ""),
+                                               PadStrideInfo(stride_x, stride_y, pad_x, pad_y));
+        }
+        else if(layer == "pool")
+        {
+            std::string  type;
+            unsigned int size = 0, stride = 0, pad = 0;
+            if(!(stream >> type >> size >> stride >> pad) || (type != "max" && type != "avg"))
+            {
+                return false;
+            }
+            const PoolingType pool_type = (type == "max") ? PoolingType::MAX : PoolingType::AVG;
+            graph << PoolingLayer(PoolingLayerInfo(pool_type, size, DataLayout::NCHW, PadStrideInfo(stride, stride, pad, pad)));
+        }
+        else if(layer == "fc")
+        {
+            unsigned int outputs = 0;
+            if(!(stream >> outputs))
+            {
+                return false;
+            }
+            graph << FullyConnectedLayer(outputs, get_weights_accessor("", ""), get_weights_accessor("", ""));
+        }
+        else if(layer == "activation")
+        {
+            std::string type;
+            if(!(stream >> type))
+            {
+                return false;
+            }
+            ActivationLayerInfo act_info;
+            if(type == "relu")
+            {
+                act_info = ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU);
+            }
+            else if(type == "logistic")
+            {
+                act_info = ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LOGISTIC);
+            }
+            else if(type == "tanh")
+            {
+                act_info = ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::TANH, 1.f, 1.f);
+            }
+            else
+            {
+                return false;
+            }
+            graph << ActivationLayer(act_info);
+        }
+        else if(layer == "softmax")
+        {
+            graph << SoftmaxLayer();
+        }
+        else
+        {
+            return false;
+        }
+        return true;
+    }
+
+    Stream graph;
+};
+
+/** Main program for the CL cache provisioner
+ *
+ * @param[in] argc Number of arguments
+ * @param[in] argv Arguments ( [optional] Path to the graph description, [optional] Path of the cache file to emit )
+ */
+int main(int argc, char **argv)
+{
+    return arm_compute::utils::run_example<GraphCLCacheProvisionerExample>(argc, argv);
+}
@@ -0,0 +1,298 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/** Standalone microbenchmark for the arm_gemm strategies.
+ *
+ * Instantiates every GemmImplementation compatible with each problem in a
+ * M/N/K/batch/thread sweep directly, without going through NEGEMM or any
+ * function-level overhead, and reports the achieved GFLOPS (GOPS for the
+ * integer types) per strategy. Intended for validating new kernels and
+ * comparing strategy selection on each silicon revision.
+ */
+#include "arm_compute/core/Window.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "src/core/NEON/kernels/assembly/NEGEMMAssemblyWrapperKernel.h"
+#include "src/core/NEON/kernels/assembly/arm_gemm.hpp"
+#include "utils/Utils.h"
+#include "utils/command_line/CommandLineOptions.h"
+#include "utils/command_line/CommandLineParser.h"
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace arm_compute;
+using namespace utils;
+
+namespace
+{
+/** Parse a comma separated list of positive integers */
+std::vector<unsigned int> parse_list(const std::string &arg)
+{
+    std::vector<unsigned int> values;
+    std::stringstream         stream(arg);
+    std::string               token;
+    while(std::getline(stream, token, ','))
+    {
+        if(!token.empty())
+        {
+            values.push_back(static_cast<unsigned int>(std::stoul(token)));
+        }
+    }
+    return values;
+}
+
+/** Sweep configuration parsed from the command line */
+struct SweepConfig
+{
+    std::vector<unsigned int> m_values{};
+    std::vector<unsigned int> n_values{};
+    std::vector<unsigned int> k_values{};
+    std::vector<unsigned int> batch_values{};
+    std::vector<unsigned int> thread_values{};
+    unsigned int              iterations{ 10 };
+    std::string               type{ "fp32" };
+};
+
+/** Scheduling hint for an assembly kernel, mirroring NEGEMMAssemblyDispatch */
+IScheduler::Hints scheduling_hint_for(arm_gemm::GemmMethod method)
+{
+    constexpr int granule_threshold = 200;
+    switch(method)
+    {
+        case arm_gemm::GemmMethod::GEMM_INTERLEAVED:
+            return IScheduler::Hints(Window::DimX, IScheduler::StrategyHint::DYNAMIC, granule_threshold);
+        case arm_gemm::GemmMethod::GEMM_INTERLEAVED_2D:
+        case arm_gemm::GemmMethod::QUANTIZE_WRAPPER_2D:
+        case arm_gemm::GemmMethod::GEMM_HYBRID_QUANTIZED:
+            return IScheduler::Hints(IScheduler::split_dimensions_all, IScheduler::StrategyHint::STATIC, granule_threshold);
+        default:
+            return IScheduler::Hints(Window::DimX);
+    }
+}
+
+/** Run one strategy on one problem and report its best-iteration throughput */
+template <typename TypeInput, typename TypeOutput>
+void benchmark_strategy(const arm_gemm::KernelDescription &desc, const SweepConfig &config,
+                        unsigned int m, unsigned int n, unsigned int k, unsigned int batches, unsigned int threads)
+{
+    NEScheduler::get().set_num_threads(threads);
+
+    // Pin the sweep to this strategy
+    arm_gemm::GemmConfig cfg(desc.method);
+    cfg.filter = desc.name;
+
+    const arm_gemm::GemmArgs args(&NEScheduler::get().cpu_info(), m, n, k, batches, 1 /* nmulti */,
+                                  arm_gemm::Activation(), static_cast<int>(threads), false /* fast_mode */, false /* wide_accumulate */, &cfg);
+
+    auto gemm = arm_gemm::gemm<TypeInput, TypeOutput>(args, arm_gemm::Nothing());
+    if(gemm == nullptr)
+    {
+        return;
+    }
+
+    const int lda            = k;
+    const int batch_stride_a = m * k;
+    const int multi_stride_a = m * k * batches;
+    const int ldb            = n;
+    const int multi_stride_b = k * n;
+    const int ldc            = n;
+    const int batch_stride_c = m * n;
+    const int multi_stride_c = m * n * batches;
+
+    std::vector<TypeInput>  a(static_cast<size_t>(m) * k * batches, TypeInput(1));
+    std::vector<TypeInput>  b(static_cast<size_t>(k) * n, TypeInput(1));
+    std::vector<TypeOutput> c(static_cast<size_t>(m) * n * batches, TypeOutput(0));
+
+    gemm->set_arrays(a.data(), lda, batch_stride_a, multi_stride_a,
+                     b.data(), ldb, multi_stride_b,
+                     c.data(), ldc, batch_stride_c, multi_stride_c,
+                     nullptr, 0);
+
+    std::vector<uint8_t> workspace(gemm->get_working_size());
+    if(!workspace.empty())
+    {
+        gemm->set_working_space(workspace.data());
+        const unsigned int window_size = gemm->get_window_size().total_size();
+        if(window_size < threads)
+        {
+            gemm->set_nthreads(window_size);
+        }
+    }
+
+    std::vector<uint8_t> pretransposed_b(gemm->B_pretranspose_required() ? gemm->get_B_pretransposed_array_size() : 0);
+    if(gemm->B_pretranspose_required())
+    {
+        gemm->pretranspose_B_array(pretransposed_b.data(), b.data(), ldb, multi_stride_b);
+    }
+
+    NEGEMMAssemblyWrapperKernel<TypeInput, TypeOutput> kernel;
+    kernel.configure(gemm.get(), desc.name);
+
+    const IScheduler::Hints hint = scheduling_hint_for(desc.method);
+
+    // Warmup run, then keep the best iteration to reduce scheduling noise
+    NEScheduler::get().schedule(&kernel, hint);
+
+    double best_s = std::numeric_limits<double>::max();
+    for(unsigned int i = 0; i < config.iterations; ++i)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        NEScheduler::get().schedule(&kernel, hint);
+        const auto end = std::chrono::steady_clock::now();
+        best_s         = std::min(best_s, std::chrono::duration<double>(end - start).count());
+    }
+
+    const double ops    = 2.0 * m * n * k * batches;
+    const double gflops = ops / best_s * 1e-9;
+
+    std::cout << config.type << " "
+              << desc.name << (desc.is_default ? "*" : "") << " "
+              << m << " " << n << " " << k << " " << batches << " " << threads << " "
+              << std::fixed << std::setprecision(1) << best_s * 1e6 << " "
+              << std::setprecision(2) << gflops << "\n";
+}
+
+/** Sweep the shape grid over all compatible strategies of one type combination */
+template <typename TypeInput, typename TypeOutput>
+void run_sweep(const SweepConfig &config)
+{
+    for(const unsigned int threads : config.thread_values)
+    {
+        for(const unsigned int batches : config.batch_values)
+        {
+            for(const unsigned int m : config.m_values)
+            {
+                for(const unsigned int n : config.n_values)
+                {
+                    for(const unsigned int k : config.k_values)
+                    {
+                        const arm_gemm::GemmArgs args(&NEScheduler::get().cpu_info(), m, n, k, batches, 1,
+                                                      arm_gemm::Activation(), static_cast<int>(threads), false);
+
+                        for(const auto &desc : arm_gemm::get_compatible_kernels<TypeInput, TypeOutput>(args, arm_gemm::Nothing()))
+                        {
+                            benchmark_strategy<TypeInput, TypeOutput>(desc, config, m, n, k, batches, threads);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+} // namespace
+
+class NEONArmGemmBenchmarkExample : public Example
+{
+public:
+    bool do_setup(int argc, char **argv) override
+    {
+        CommandLineParser parser;
+
+        auto help = parser.add_option<ToggleOption>("help");
+        help->set_help("Show this message");
+        auto type = parser.add_option<SimpleOption<std::string>>("type", "fp32");
+        type->set_help("Type combination to benchmark (fp32, u8u32)");
+        auto m_list = parser.add_option<SimpleOption<std::string>>("m", "128,256,512,1024");
+        m_list->set_help("Comma separated list of M sizes to sweep");
+        auto n_list = parser.add_option<SimpleOption<std::string>>("n", "128,256,512,1024");
+        n_list->set_help("Comma separated list of N sizes to sweep");
+        auto k_list = parser.add_option<SimpleOption<std::string>>("k", "128,256,512,1024");
+        k_list->set_help("Comma separated list of K sizes to sweep");
+        auto batch_list = parser.add_option<SimpleOption<std::string>>("batches", "1");
+        batch_list->set_help("Comma separated list of batch counts to sweep");
+        auto thread_list = parser.add_option<SimpleOption<std::string>>("threads", "1");
+        thread_list->set_help("Comma separated list of thread counts to sweep");
+        auto iterations = parser.add_option<SimpleOption<unsigned int>>("iterations", 10);
+        iterations->set_help("Number of timed iterations per strategy and shape");
+
+        parser.parse(argc, argv);
+
+        if(help->is_set() && help->value())
+        {
+            parser.print_help(argv[0]);
+            return false;
+        }
+
+        _config.type          = type->value();
+        _config.m_values      = parse_list(m_list->value());
+        _config.n_values      = parse_list(n_list->value());
+        _config.k_values      = parse_list(k_list->value());
+        _config.batch_values  = parse_list(batch_list->value());
+        _config.thread_values = parse_list(thread_list->value());
+        _config.iterations    = iterations->value();
+
+#ifdef __aarch64__
+        if(_config.type != "fp32" && _config.type != "u8u32")
+#else  /* __aarch64__ */
+        // The u8u32 strategies are only built for AArch64
+        if(_config.type != "fp32")
+#endif /* __aarch64__ */
+        {
+            std::cerr << "Unsupported type combination '" << _config.type << "'\n";
+            return false;
+        }
+        if(_config.m_values.empty() || _config.n_values.empty() || _config.k_values.empty() || _config.batch_values.empty() || _config.thread_values.empty())
+        {
+            std::cerr << "Empty sweep grid\n";
+            return false;
+        }
+
+        return true;
+    }
+
+    void do_run() override
+    {
+        std::cout << "type strategy m n k batches threads best_us gflops\n";
+
+        if(_config.type == "fp32")
+        {
+            run_sweep<float, float>(_config);
+        }
+#ifdef __aarch64__
+        else
+        {
+            run_sweep<uint8_t, uint32_t>(_config);
+        }
+#endif /* __aarch64__ */
+    }
+
+private:
+    SweepConfig _config{};
+};
+
+/** Main program for the arm_gemm strategy microbenchmark
+ *
+ * @param[in] argc Number of arguments
+ * @param[in] argv Arguments
+ */
+int main(int argc, char **argv)
+{
+    return utils::run_example<NEONArmGemmBenchmarkExample>(argc, argv);
+}
@@ -0,0 +1,131 @@
+#!/usr/bin/env python
+# Copyright (c) 2020 Arm Limited.
+#
+# SPDX-License-Identifier: MIT
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to
+# deal in the Software without restriction, including without limitation the
+# rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+# sell copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+"""Runs the benchmark_graph_* binaries as one suite and merges their results.
+
+The binaries are built by the 'benchmark_graph' SCons target: every graph
+example wrapped in the instrumented benchmark harness. Each network runs with
+synthetic weights (no --data argument), so no external model files are needed,
+and is swept over the requested thread counts, execution targets and data
+types. Each run is measured with the wall clock and per-kernel scheduler
+timers and its JSON report is folded into a single machine-readable document:
+
+    {"device": ..., "runs": [{"network": ..., "target": ..., "type": ...,
+                              "threads": ..., "results": <framework JSON>}]}
+
+Example:
+    scons benchmark_graph
+    python scripts/benchmark_graph.py --binary-dir build/tests \\
+        --threads 1,2,4 --targets neon,cl --types f32,f16 --out results.json
+"""
+import argparse
+import glob
+import json
+import os
+import platform
+import subprocess
+import sys
+import tempfile
+
+INSTRUMENTS = "wall_clock_timer_ms,scheduler_timer_ms"
+
+
+def find_networks(binary_dir):
+    """Returns the benchmark graph binaries found in binary_dir, sorted by name."""
+    pattern = os.path.join(binary_dir, "benchmark_graph_*")
+    return sorted(path for path in glob.glob(pattern) if os.access(path, os.X_OK))
+
+
+def run_one(binary, target, data_type, threads, iterations, json_file):
+    """Runs one network configuration, writing the framework report to json_file."""
+    example_args = "--target={},--type={},--threads={}".format(target, data_type, threads)
+    cmd = [
+        binary,
+        "--instruments={}".format(INSTRUMENTS),
+        "--iterations={}".format(iterations),
+        "--json-file={}".format(json_file),
+        "--example_args={}".format(example_args),
+    ]
+    return subprocess.call(cmd, stdout=subprocess.PIPE, stderr=subprocess.PIPE)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--binary-dir", default=".", help="Directory holding the benchmark_graph_* binaries")
+    parser.add_argument("--networks", default="", help="Comma-separated network names to run (default: all found)")
+    parser.add_argument("--threads", default="1", help="Comma-separated thread counts to sweep (default: 1)")
+    parser.add_argument("--targets", default="neon", help="Comma-separated execution targets to sweep: neon,cl,gc (default: neon)")
+    parser.add_argument("--types", default="f32", help="Comma-separated data types to sweep: f32,f16,qasymm8 (default: f32)")
+    parser.add_argument("--iterations", type=int, default=10, help="Iterations per configuration (default: 10)")
+    parser.add_argument("--out", default="benchmark_graph.json", help="Output file (default: benchmark_graph.json)")
+    args = parser.parse_args()
+
+    networks = find_networks(args.binary_dir)
+    if args.networks:
+        wanted = set(args.networks.split(","))
+        networks = [n for n in networks if os.path.basename(n).replace("benchmark_", "") in wanted or os.path.basename(n) in wanted]
+    if not networks:
+        sys.stderr.write("No benchmark_graph_* binaries found in '{}'\n".format(args.binary_dir))
+        return 1
+
+    report = {
+        "device": {"machine": platform.machine(), "node": platform.node()},
+        "instruments": INSTRUMENTS,
+        "iterations": args.iterations,
+        "runs": [],
+    }
+    failures = 0
+    for binary in networks:
+        network = os.path.basename(binary).replace("benchmark_", "")
+        for target in args.targets.split(","):
+            for data_type in args.types.split(","):
+                for threads in args.threads.split(","):
+                    fd, json_file = tempfile.mkstemp(suffix=".json")
+                    os.close(fd)
+                    try:
+                        retval = run_one(binary, target, data_type, threads, args.iterations, json_file)
+                        run = {
+                            "network": network,
+                            "target": target,
+                            "type": data_type,
+                            "threads": int(threads),
+                            "retval": retval,
+                        }
+                        if retval == 0:
+                            with open(json_file) as results:
+                                run["results"] = json.load(results)
+                        else:
+                            failures += 1
+                        report["runs"].append(run)
+                        status = "OK" if retval == 0 else "FAILED"
+                        print("{} {} target={} type={} threads={}".format(status, network, target, data_type, threads))
+                    finally:
+                        os.remove(json_file)
+
+    with open(args.out, "w") as out:
+        json.dump(report, out, indent=2)
+    print("Wrote {} runs to {}".format(len(report["runs"]), args.out))
+    return 0 if failures == 0 else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,122 @@
+#!/usr/bin/env python
+# Copyright (c) 2020 Arm Limited.
+#
+# SPDX-License-Identifier: MIT
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to
+# deal in the Software without restriction, including without limitation the
+# rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+# sell copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+"""Packs numpy weight files into compressed weight containers (.aclz).
+
+The container ("ACLZWGT1") carries the tensor metadata followed by the raw
+tensor data split into fixed-size blocks, each LZ4-compressed (or stored when
+compression does not pay off or the lz4 module is unavailable). The graph
+CompressedWeightLoader streams the blocks and decompresses them directly into
+the tensor buffer, so the device never writes a decompressed temporary.
+
+Containers are placed next to their source as <name>.npy.aclz, which is where
+get_weights_accessor looks for them.
+
+Example:
+    python scripts/compress_weights.py /path/to/model/cnn_data
+"""
+import argparse
+import os
+import struct
+import sys
+
+import numpy as np
+
+try:
+    import lz4.block
+
+    HAVE_LZ4 = True
+except ImportError:
+    HAVE_LZ4 = False
+
+MAGIC = b"ACLZWGT1"
+CODEC_STORE = 0
+CODEC_LZ4 = 1
+STORED_BLOCK_FLAG = 0x80000000
+
+
+def pack_file(npy_path, block_size):
+    """Writes npy_path + '.aclz' and returns (original_bytes, container_bytes)."""
+    arr = np.load(npy_path)
+    data = arr.tobytes("C")
+    codec = CODEC_LZ4 if HAVE_LZ4 else CODEC_STORE
+
+    num_blocks = (len(data) + block_size - 1) // block_size if data else 0
+    out_path = npy_path + ".aclz"
+    with open(out_path, "wb") as out:
+        out.write(MAGIC)
+        out.write(struct.pack("<BB", codec, 1 if np.isfortran(arr) else 0))
+        typestr = arr.dtype.str.encode()
+        out.write(struct.pack("<H", len(typestr)))
+        out.write(typestr)
+        out.write(struct.pack("<I", arr.ndim))
+        for dim in arr.shape:
+            out.write(struct.pack("<Q", dim))
+        out.write(struct.pack("<II", block_size, num_blocks))
+        out.write(struct.pack("<Q", len(data)))
+
+        for start in range(0, len(data), block_size):
+            block = data[start:start + block_size]
+            if codec == CODEC_LZ4:
+                compressed = lz4.block.compress(block, store_size=False)
+                if len(compressed) < len(block):
+                    out.write(struct.pack("<I", len(compressed)))
+                    out.write(compressed)
+                    continue
+                # Incompressible block: store it raw
+                out.write(struct.pack("<I", len(block) | STORED_BLOCK_FLAG))
+            else:
+                out.write(struct.pack("<I", len(block)))
+            out.write(block)
+    return len(data), os.path.getsize(out_path)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("paths", nargs="+", help="Numpy files or directories to pack")
+    parser.add_argument("--block-size", type=int, default=256 * 1024, help="Uncompressed bytes per block (default: 256 KiB)")
+    args = parser.parse_args()
+
+    if not HAVE_LZ4:
+        sys.stderr.write("Warning: python lz4 module not found, blocks will be stored uncompressed\n")
+
+    files = []
+    for path in args.paths:
+        if os.path.isdir(path):
+            for root, _, names in os.walk(path):
+                files += [os.path.join(root, name) for name in names if name.endswith(".npy")]
+        else:
+            files.append(path)
+
+    total_in = total_out = 0
+    for npy_path in sorted(files):
+        original, container = pack_file(npy_path, args.block_size)
+        total_in += original
+        total_out += container
+        print("{}: {} -> {} bytes".format(npy_path, original, container))
+    if total_in:
+        print("Total: {} -> {} bytes ({:.1f}%)".format(total_in, total_out, 100.0 * total_out / total_in))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -27,8 +27,13 @@
 #include "arm_compute/core/CL/CLHelpers.h"
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Utils.h"
+#include "arm_compute/core/utils/misc/MMappedFile.h"
 #include "support/StringSupport.h"
 
+#include <fstream>
+#include <functional>
+#include <sstream>
+
 namespace arm_compute
 {
 CLBuildOptions::CLBuildOptions()
@@ -137,12 +142,12 @@ Kernel::Kernel(std::string name, const cl::Program &program)
 {
 }
 CLCompileContext::CLCompileContext()
-    : _context(), _device(), _programs_map(), _built_programs_map()
+    : _context(), _device(), _binary_cache_path(), _programs_map(), _built_programs_map()
 {
 }
 
 CLCompileContext::CLCompileContext(cl::Context context, const cl::Device &device)
-    : _context(), _device(), _programs_map(), _built_programs_map()
+    : _context(), _device(), _binary_cache_path(), _programs_map(), _built_programs_map()
 {
     _context = std::move(context);
     _device  = CLDevice(device);
@@ -163,11 +168,33 @@ Kernel CLCompileContext::create_kernel(const std::string &kernel_name, const std
     }
     else
     {
+        std::string cache_filename;
+#if !defined(BARE_METAL)
+        if(!_binary_cache_path.empty())
+        {
+            cache_filename = binary_cache_filename(built_program_name);
+            if(load_binary_from_cache(cache_filename, cl_program))
+            {
+                // Add built program to internal map
+                _built_programs_map.emplace(built_program_name, cl_program);
+
+                return Kernel(kernel_name, cl_program);
+            }
+        }
+#endif /* !defined(BARE_METAL) */
+
         Program program = load_program(program_name, program_source, is_binary);
 
         // Build program
         cl_program = program.build(build_options);
 
+#if !defined(BARE_METAL)
+        if(!cache_filename.empty())
+        {
+            save_binary_to_cache(cache_filename, cl_program);
+        }
+#endif /* !defined(BARE_METAL) */
+
         // Add built program to internal map
         _built_programs_map.emplace(built_program_name, cl_program);
     }
@@ -301,6 +328,72 @@ void CLCompileContext::clear_programs_cache()
     _built_programs_map.clear();
 }
 
+void CLCompileContext::set_binary_cache_path(std::string path)
+{
+    _binary_cache_path = std::move(path);
+}
+
+const std::string &CLCompileContext::binary_cache_path() const
+{
+    return _binary_cache_path;
+}
+
+#if !defined(BARE_METAL)
+std::string CLCompileContext::binary_cache_filename(const std::string &built_program_name) const
+{
+    // Key the entry on the device and the driver as well, so that entries written by a previous
+    // driver are simply never hit again
+    const std::string device_name    = _device.cl_device().getInfo<CL_DEVICE_NAME>();
+    const std::string driver_version = _device.cl_device().getInfo<CL_DRIVER_VERSION>();
+    const size_t      key            = std::hash<std::string>{}(device_name + "_" + driver_version + "_" + built_program_name);
+
+    std::stringstream filename;
+    filename << _binary_cache_path << "/acl_" << std::hex << key << ".bin";
+
+    return filename.str();
+}
+
+bool CLCompileContext::load_binary_from_cache(const std::string &cache_filename, cl::Program &program) const
+{
+    // Check for the entry first as mapping would create an empty file
+    std::ifstream cache_entry(cache_filename, std::ios::binary);
+    if(!cache_entry.is_open())
+    {
+        return false;
+    }
+    cache_entry.close();
+
+    // Map the binary instead of reading it so that its pages are shared with the page cache
+    utils::mmap_io::MMappedFile mapped_binary(cache_filename, 0, 0);
+    if(!mapped_binary.is_mapped() || mapped_binary.file_size() == 0)
+    {
+        return false;
+    }
+
+    const unsigned char  *data = mapped_binary.data();
+    cl::Program::Binaries binaries{ std::vector<unsigned char>(data, data + mapped_binary.file_size()) };
+    program = cl::Program(_context, { _device.cl_device() }, binaries);
+
+    return Program::build(program);
+}
+
+void CLCompileContext::save_binary_to_cache(const std::string &cache_filename, const cl::Program &program) const
+{
+    const std::vector<std::vector<unsigned char>> binaries = program.getInfo<CL_PROGRAM_BINARIES>();
+    if(binaries.size() != 1 || binaries[0].empty())
+    {
+        return;
+    }
+
+    // The cache is best-effort: failing to store an entry only means the program is rebuilt next time
+    std::ofstream cache_entry(cache_filename, std::ios::binary);
+    if(cache_entry.is_open())
+    {
+        cache_entry.write(reinterpret_cast<const char *>(binaries[0].data()), binaries[0].size());
+    }
+}
+#endif /* !defined(BARE_METAL) */
+
 const std::map<std::string, cl::Program> &CLCompileContext::get_built_programs() const
 {
     return _built_programs_map;
@@ -45,6 +45,7 @@ const std::map<std::string, std::string> CLKernelLibrary::_kernel_program_map =
     { "activation_layer_quant", "activation_layer_quant.cl" },
     { "activation_layer_quant_f32", "activation_layer_quant.cl" },
     { "arg_min_max_x", "arg_min_max.cl" },
+    { "arg_min_max_x_coop", "arg_min_max.cl" },
     { "arg_min_max_y", "arg_min_max.cl" },
     { "arg_min_max_z", "arg_min_max.cl" },
     { "arg_min_max_w", "arg_min_max.cl" },
@@ -114,11 +115,13 @@ const std::map<std::string, std::string> CLKernelLibrary::_kernel_program_map =
     { "copy_to_keypoint", "fast_corners.cl" },
     { "crop_tensor", "crop_tensor.cl" },
     { "deconvolution_reshape", "deconvolution_layer.cl" },
+    { "deconvolution_reshape_overlap", "deconvolution_layer.cl" },
     { "deconvolution_upsample", "deconvolution_layer.cl" },
     { "depthwise_convolution_3x3", "depthwise_convolution.cl" },
     { "depthwise_convolution_3x3_f16", "depthwise_convolution.cl" },
     { "depthwise_convolution_3x3_nhwc", "depthwise_convolution.cl" },
     { "depthwise_convolution_3x3_nhwc_stride1", "depthwise_convolution.cl" },
+    { "depthwise_convolution_3x3_nhwc_stride1_small", "depthwise_convolution.cl" },
     { "dwc_MxN_native_fp_nhwc", "depthwise_convolution.cl" },
     { "dwc_MxN_native_quantized8_nhwc", "depthwise_convolution_quantized.cl" },
     { "dwc_3x3_native_quantized8_nchw", "depthwise_convolution_quantized.cl" },
@@ -337,7 +340,7 @@ const std::map<std::string, std::string> CLKernelLibrary::_kernel_program_map =
     { "quantization_layer", "quantization_layer.cl" },
     { "range", "range.cl" },
     { "range_quantized", "range.cl" },
-    { "reduction_operation_x", "reduction_operation.cl" },
+    { "reduction_operation_x_coop", "reduction_operation.cl" },
     { "reduction_operation_non_parallel_x", "reduction_operation.cl" },
     { "reduction_operation_y", "reduction_operation.cl" },
     { "reduction_operation_z", "reduction_operation.cl" },
@@ -376,6 +379,7 @@ const std::map<std::string, std::string> CLKernelLibrary::_kernel_program_map =
     { "sobel_separable1x5", "sobel_filter.cl" },
     { "sobel_separable7x1", "sobel_filter.cl" },
     { "sobel_separable1x7", "sobel_filter.cl" },
+    { "softmax_layer_fused", "softmax_layer.cl" },
     { "softmax_layer_norm", "softmax_layer.cl" },
     { "softmax_layer_norm_quantized", "softmax_layer_quantized.cl" },
     { "softmax_layer_max_shift_exp_sum_quantized_serial", "softmax_layer_quantized.cl" },
@@ -1126,6 +1130,16 @@ cl_uint CLKernelLibrary::get_num_compute_units()
     return _compile_context.get_num_compute_units();
 }
 
+void CLKernelLibrary::set_binary_cache_path(std::string path)
+{
+    _compile_context.set_binary_cache_path(std::move(path));
+}
+
+const std::string &CLKernelLibrary::binary_cache_path()
+{
+    return _compile_context.binary_cache_path();
+}
+
 CLCompileContext &CLKernelLibrary::get_compile_context()
 {
     return _compile_context;
@@ -33,6 +33,7 @@
 #include "arm_compute/core/Window.h"
 
 #include <cstddef>
+#include <cstring>
 
 using namespace arm_compute;
 
@@ -102,15 +103,16 @@ void ICLKernel::add_tensor_argument(unsigned &idx, const ICLTensor *tensor, cons
     }
 
     unsigned int idx_start = idx;
-    _kernel.setArg(idx++, tensor->cl_buffer());
+    const cl_mem buffer    = tensor->cl_buffer().get();
+    set_argument(idx++, buffer);
 
     for(unsigned int d = 0; d < dimension_size; ++d)
     {
-        _kernel.setArg<cl_uint>(idx++, strides[d]);
-        _kernel.setArg<cl_uint>(idx++, strides[d] * window[d].step());
+        set_argument<cl_uint>(idx++, strides[d]);
+        set_argument<cl_uint>(idx++, strides[d] * window[d].step());
     }
 
-    _kernel.setArg<cl_uint>(idx++, offset_first_element);
+    set_argument<cl_uint>(idx++, offset_first_element);
 
     ARM_COMPUTE_ERROR_ON_MSG_VAR(idx_start + num_arguments_per_tensor<dimension_size>() != idx,
                                  "add_%dD_tensor_argument() is supposed to add exactly %d arguments to the kernel", dimension_size, num_arguments_per_tensor<dimension_size>());
@@ -124,6 +126,23 @@ template void ICLKernel::add_tensor_argument<3>(unsigned &idx, const ICLTensor *
 template void ICLKernel::add_tensor_argument<4>(unsigned &idx, const ICLTensor *tensor, const Window &window);
 #endif /* DOXYGEN_SKIP_THIS */
 
+void ICLKernel::set_arg_cached(unsigned int index, size_t size, const void *value)
+{
+    if(index >= _cached_args.size())
+    {
+        _cached_args.resize(index + 1);
+    }
+
+    std::vector<uint8_t> &cached_value = _cached_args[index];
+    if(cached_value.size() == size && std::memcmp(cached_value.data(), value, size) == 0)
+    {
+        return;
+    }
+
+    cached_value.assign(static_cast<const uint8_t *>(value), static_cast<const uint8_t *>(value) + size);
+    _kernel.setArg(index, size, value);
+}
+
 void ICLKernel::set_target(cl::Device &device)
 {
     _target = get_target_from_device(device);
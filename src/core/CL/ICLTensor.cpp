@@ -23,10 +23,32 @@
  */
 #include "arm_compute/core/CL/ICLTensor.h"
 
+#include "arm_compute/core/CL/OpenCL.h"
+
 #include <cstring>
 
 using namespace arm_compute;
 
+namespace
+{
+/** Enqueue a marker on the given queue and return the corresponding event
+ *
+ * As the queue is in-order, the event completes once all previously enqueued commands have finished.
+ *
+ * @param[in,out] q The CL command queue to enqueue the marker on.
+ *
+ * @return An event for the enqueued marker.
+ */
+cl::Event enqueue_marker(cl::CommandQueue &q)
+{
+    cl_event marker = nullptr;
+    clEnqueueMarker(q(), &marker);
+    cl::Event event;
+    event = marker;
+    return event;
+}
+} // namespace
+
 ICLTensor::ICLTensor()
     : _mapping(nullptr)
 {
@@ -43,6 +65,19 @@ void ICLTensor::unmap(cl::CommandQueue &q)
     _mapping = nullptr;
 }
 
+cl::Event ICLTensor::map_async(cl::CommandQueue &q)
+{
+    _mapping = do_map(q, false);
+    return enqueue_marker(q);
+}
+
+cl::Event ICLTensor::unmap_async(cl::CommandQueue &q)
+{
+    do_unmap(q);
+    _mapping = nullptr;
+    return enqueue_marker(q);
+}
+
 void ICLTensor::clear(cl::CommandQueue &q)
 {
     this->map(q);
@@ -287,6 +287,93 @@ __kernel void arg_min_max_x(
         }
     }
 }
+
+/** This kernel performs a single-launch work-group co-operative reduction on x-axis.
+ *
+ * One work-group reduces a whole row: each work-item accumulates its private best value
+ * and index over a grid-stride loop and the partial results are then combined with a
+ * local-memory tree. Ties are broken towards the lowest index.
+ *
+ * @note The data type must be passed at compile time using -DDATA_TYPE: e.g. -DDATA_TYPE=float
+ * @note The data type of the output must be passed at compile time using -DDATA_TYPE_OUTPUT: e.g. -DDATA_TYPE_OUTPUT=uint
+ * @note The arg_max flag must be passed at compile time using -DARG_MAX if we want to compute the ArgMax
+ * @note The arg_min flag must be passed at compile time using -DARG_MIN if we want to compute the ArgMin
+ * @note The width size must be passed at compile time using -DWIDTH e.g. -DWIDTH=128
+ *
+ * @param[in] src_ptr                           Pointer to the source tensor. Supported data types: QASYMM8/QASYMM8_SIGNED/S32/F16/F32
+ * @param[in] src_stride_x                      Stride of the source tensor in X dimension (in bytes)
+ * @param[in] src_step_x                        src_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in] src_stride_y                      Stride of the source tensor in Y dimension (in bytes)
+ * @param[in] src_step_y                        src_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in] src_offset_first_element_in_bytes The offset of the first element in the source tensor
+ * @param[in] dst_ptr                           Pointer to the destination tensor. Supported data types: U32/S32
+ * @param[in] dst_stride_x                      Stride of the destination tensor in X dimension (in bytes)
+ * @param[in] dst_step_x                        dst_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in] dst_stride_y                      Stride of the destination tensor in Y dimension (in bytes)
+ * @param[in] dst_step_y                        dst_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in] dst_offset_first_element_in_bytes The offset of the first element in the destination tensor
+ * @param[in] local_values                      Local buffer for storing the partial reduction values
+ * @param[in] local_indices                     Local buffer for storing the partial reduction indices
+ */
+__kernel void arg_min_max_x_coop(
+    IMAGE_DECLARATION(src),
+    IMAGE_DECLARATION(dst),
+    __local DATA_TYPE *local_values,
+    __local DATA_TYPE_OUTPUT *local_indices)
+{
+    const uint lid   = get_local_id(0);
+    const uint lsize = get_local_size(0);
+    const uint y_idx = get_global_id(1);
+
+    const __global DATA_TYPE *src_in_row = (const __global DATA_TYPE *)(src_ptr + src_offset_first_element_in_bytes + y_idx * src_step_y);
+
+    // Grid-stride accumulation of the private best value and index. Strictly monotonic
+    // comparisons keep the lowest index on ties as the index only grows within a lane.
+    DATA_TYPE        best_val = src_in_row[lid];
+    DATA_TYPE_OUTPUT best_idx = (DATA_TYPE_OUTPUT)lid;
+    for(uint x = lid + lsize; x < WIDTH; x += lsize)
+    {
+        DATA_TYPE val = src_in_row[x];
+#if defined(ARG_MAX)
+        if(val > best_val)
+#else  // defined(ARG_MIN)
+        if(val < best_val)
+#endif // defined(ARG_MAX) || defined(ARG_MIN)
+        {
+            best_val = val;
+            best_idx = (DATA_TYPE_OUTPUT)x;
+        }
+    }
+
+    local_values[lid]  = best_val;
+    local_indices[lid] = best_idx;
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    // Perform parallel reduction (the local size is a power of two)
+    for(uint i = lsize >> 1; i > 0; i >>= 1)
+    {
+        if(lid < i)
+        {
+            DATA_TYPE        other_val = local_values[lid + i];
+            DATA_TYPE_OUTPUT other_idx = local_indices[lid + i];
+#if defined(ARG_MAX)
+            if((other_val > local_values[lid]) || ((other_val == local_values[lid]) && (other_idx < local_indices[lid])))
+#else  // defined(ARG_MIN)
+            if((other_val < local_values[lid]) || ((other_val == local_values[lid]) && (other_idx < local_indices[lid])))
+#endif // defined(ARG_MAX) || defined(ARG_MIN)
+            {
+                local_values[lid]  = other_val;
+                local_indices[lid] = other_idx;
+            }
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+
+    if(lid == 0)
+    {
+        *((__global DATA_TYPE_OUTPUT *)(dst_ptr + dst_offset_first_element_in_bytes + y_idx * dst_step_y)) = local_indices[0];
+    }
+}
 #endif // defined(WIDTH)
 
 #if defined(HEIGHT)
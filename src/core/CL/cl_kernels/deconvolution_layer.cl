@@ -127,4 +127,101 @@ __kernel void deconvolution_reshape(
 
 #undef FILTER_AREA
 }
+
+#if defined(STRIDE_X) && defined(STRIDE_Y)
+/** This kernel gathers the deconvolution output tensor from the result of a @ref CLGEMM operation between the deconvolution
+ * input and the deconvolution filter, for filters larger than the stride. The patches scattered by neighbouring input pixels
+ * then overlap, so each work item computes one output element by summing every filter tap that contributes to it, instead of
+ * writing each GEMM element to a distinct location like deconvolution_reshape does.
+ *
+ * @note Data type should be given as a preprocessor argument using -DDATA_TYPE=type, e.g., -DDATA_TYPE=F32
+ * @note The width of the filter should be given as a preprocessor argument using -DFILTER_WIDTH=width, e.g., -DFILTER_WIDTH=4
+ * @note The height of the filter should be given as a preprocessor argument using -DFILTER_HEIGHT=height, e.g., -DFILTER_HEIGHT=4
+ * @note The width of the input should be given as a preprocessor argument using -DSRC_WIDTH=width, e.g., -DSRC_WIDTH=10
+ * @note The height of the input should be given as a preprocessor argument using -DSRC_HEIGHT=width, e.g., -DSRC_HEIGHT=10
+ * @note The horizontal stride should be given as a preprocessor argument using -DSTRIDE_X=stride, e.g., -DSTRIDE_X=2
+ * @note The vertical stride should be given as a preprocessor argument using -DSTRIDE_Y=stride, e.g., -DSTRIDE_Y=2
+ * @note The output data layout is NCHW if the preprocessor argument NUM_FILTERS is defined, NHWC if NUM_FILTERS is not defined
+ *
+ * @param[in]  src_ptr                            Pointer to the source image. Supported data types: QASYMM8/QASYMM8_SIGNED/F16/F32
+ * @param[in]  src_stride_x                       Stride of the source image in X dimension (in bytes)
+ * @param[in]  src_step_x                         src_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  src_stride_y                       Stride of the source image in Y dimension (in bytes)
+ * @param[in]  src_step_y                         src_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  src_stride_z                       Stride of the source tensor in Z dimension (in bytes)
+ * @param[in]  src_step_z                         src_stride_z * number of elements along Z processed per workitem(in bytes)
+ * @param[in]  src_offset_first_element_in_bytes  The offset of the first element in the source image
+ * @param[out] dst_ptr                            Pointer to the destination image. Supported data types: same as @p src_ptr
+ * @param[in]  dst_stride_x                       Stride of the destination image in X dimension (in bytes)
+ * @param[in]  dst_step_x                         dst_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  dst_stride_y                       Stride of the destination image in Y dimension (in bytes)
+ * @param[in]  dst_step_y                         dst_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  dst_stride_z                       Stride of the source tensor in Z dimension (in bytes)
+ * @param[in]  dst_step_z                         dst_stride_z * number of elements along Z processed per workitem(in bytes)
+ * @param[in]  dst_offset_first_element_in_bytes  The offset of the first element in the destination image
+ * @param[in]  bias_ptr                           (Optional) Pointer to the biases vector. Supported data types: F16/F32/S32
+ * @param[in]  bias_stride_x                      (Optional) Stride of the biases vector in X dimension (in bytes)
+ * @param[in]  bias_step_x                        (Optional) biases_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  bias_offset_first_element_in_bytes (Optional) The offset of the first element in the biases vector
+ */
+__kernel void deconvolution_reshape_overlap(
+    TENSOR3D_DECLARATION(src),
+    TENSOR3D_DECLARATION(dst)
+#if defined(ADD_BIAS)
+    ,
+    VECTOR_DECLARATION(bias)
+#endif // defined(ADD_BIAS)
+)
+{
+#define FILTER_AREA ((FILTER_WIDTH) * (FILTER_HEIGHT))
+#define SCATTERED_HEIGHT (((SRC_HEIGHT) - 1) * (STRIDE_Y) + (FILTER_HEIGHT))
+
+    Tensor3D src = CONVERT_TO_TENSOR3D_STRUCT_NO_STEP(src);
+    Tensor3D dst = CONVERT_TO_TENSOR3D_STRUCT(dst);
+
+#if defined(NUM_FILTERS)
+    const int x_out  = get_global_id(0);
+    const int y_out  = get_global_id(1);
+    const int filter = get_global_id(2) % (NUM_FILTERS);
+    const int batch  = get_global_id(2) / (NUM_FILTERS);
+#else  // defined(NUM_FILTERS)
+    const int filter = get_global_id(0);
+    const int x_out  = get_global_id(1);
+    const int y_out  = get_global_id(2) % (SCATTERED_HEIGHT);
+    const int batch  = get_global_id(2) / (SCATTERED_HEIGHT);
+#endif // defined(NUM_FILTERS)
+
+    DATA_TYPE acc = (DATA_TYPE)0;
+    for(int y_k = 0; y_k < (FILTER_HEIGHT); ++y_k)
+    {
+        const int y_rel = y_out - y_k;
+        if(y_rel < 0 || (y_rel % (STRIDE_Y)) != 0 || y_rel >= (SRC_HEIGHT) * (STRIDE_Y))
+        {
+            continue;
+        }
+        const int y_in = y_rel / (STRIDE_Y);
+        for(int x_k = 0; x_k < (FILTER_WIDTH); ++x_k)
+        {
+            const int x_rel = x_out - x_k;
+            if(x_rel < 0 || (x_rel % (STRIDE_X)) != 0 || x_rel >= (SRC_WIDTH) * (STRIDE_X))
+            {
+                continue;
+            }
+            const int x_in = x_rel / (STRIDE_X);
+            acc += *((__global DATA_TYPE *)tensor3D_offset(&src, x_k + (FILTER_WIDTH)*y_k + FILTER_AREA * filter, x_in, y_in + (SRC_HEIGHT)*batch));
+        }
+    }
+
+#if defined(ADD_BIAS)
+    Vector bias = CONVERT_TO_VECTOR_STRUCT_NO_STEP(bias);
+    acc += *((__global DATA_TYPE *)vector_offset(&bias, filter));
+#endif // defined(ADD_BIAS)
+
+    // Store result
+    *((__global DATA_TYPE *)dst.ptr) = acc;
+
+#undef FILTER_AREA
+#undef SCATTERED_HEIGHT
+}
+#endif // defined(STRIDE_X) && defined(STRIDE_Y)
 #endif // defined(FILTER_WIDTH) && defined(FILTER_HEIGHT) && defined(SRC_WIDTH) && defined(SRC_HEIGHT) && defined(DATA_TYPE)
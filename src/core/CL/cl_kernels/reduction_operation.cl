@@ -37,129 +37,91 @@
 #endif // defined(WIDTH)
 #endif // defined(FLOAT_DATA_TYPE)
 
-/** Calculate square sum of a vector
- *
- * @param[in] input Pointer to the first pixel.
- *
- * @return square sum of vector.
- */
-inline DATA_TYPE square_sum(__global const DATA_TYPE *input)
-{
-    VEC_DATA_TYPE(DATA_TYPE, 16)
-    in = vload16(0, input);
-
-    in *= in;
-
-    in.s01234567 += in.s89ABCDEF;
-    in.s0123 += in.s4567;
-    in.s01 += in.s23;
-
-    return (in.s0 + in.s1);
-}
-
-/** Calculate sum of a vector
- *
- * @param[in] input Pointer to the first pixel.
- *
- * @return sum of vector.
- */
-inline DATA_TYPE sum(__global const DATA_TYPE *input)
-{
-    VEC_DATA_TYPE(DATA_TYPE, 16)
-    in = vload16(0, input);
-
-    in.s01234567 += in.s89ABCDEF;
-    in.s0123 += in.s4567;
-    in.s01 += in.s23;
-
-    return (in.s0 + in.s1);
-}
-
-/** Calculate product of a vector
+#if defined(WIDTH)
+#if defined(PARALLEL)
+/** This kernel performs a single-launch work-group co-operative reduction on x-axis.
  *
- * @param[in] input Pointer to the first pixel.
- *
- * @return product of vector.
- */
-inline DATA_TYPE product(__global const DATA_TYPE *input)
-{
-    VEC_DATA_TYPE(DATA_TYPE, 16)
-    in = vload16(0, input);
-
-    in.s01234567 *= in.s89ABCDEF;
-    in.s0123 *= in.s4567;
-    in.s01 *= in.s23;
-
-    return (in.s0 * in.s1);
-}
-#if defined(OPERATION)
-/** This kernel performs parallel reduction given an operation on x-axis.
+ * One work-group reduces a whole row: each work-item accumulates a private partial
+ * result over a grid-stride loop and the partial results are then combined with a
+ * local-memory tree.
  *
  * @note The data type must be passed at compile time using -DDATA_TYPE: e.g. -DDATA_TYPE=float
- * @note The operation we want to perform must be passed at compile time using -DOPERATION e.g. -DOPERATION=square_sum
+ * @note The square sum flag must be passed at compile time using -DSUM_SQUARE if we want to compute the sum of squares
  * @note The mean flag must be passed at compile time using -DMEAN if we want to compute the mean value
  * @note The product flag must be passed at compile time using -DPROD if we want to compute the product, otherwise sum will be used
- * @note The width size must be passed at compile time using -DWIDTH e.g. -DWIDTH=128 if we want to compute the mean value
+ * @note The width size must be passed at compile time using -DWIDTH e.g. -DWIDTH=128
  *
- * @param[in] src_ptr                                   Pointer to the source tensor. Supported data types: F16/F32
- * @param[in] src_stride_x                              Stride of the source tensor in X dimension (in bytes)
- * @param[in] src_step_x                                src_stride_x * number of elements along X processed per workitem(in bytes)
- * @param[in] src_stride_y                              Stride of the source tensor in Y dimension (in bytes)
- * @param[in] src_step_y                                src_stride_y * number of elements along Y processed per workitem(in bytes)
- * @param[in] src_offset_first_element_in_bytes         The offset of the first element in the source tensor
- * @param[in] partial_res_ptr                           The local buffer to hold partial result values. Supported data types: same as @p src_ptr
- * @param[in] partial_res_stride_x                      Stride of the output tensor in X dimension (in bytes)
- * @param[in] partial_res_step_x                        partial_res_stride_x * number of elements along X processed per workitem(in bytes)
- * @param[in] partial_res_stride_y                      Stride of the output tensor in Y dimension (in bytes)
- * @param[in] partial_res_step_y                        partial_res_stride_y * number of elements along Y processed per workitem(in bytes)
- * @param[in] partial_res_offset_first_element_in_bytes The offset of the first element in the source tensor
- * @param[in] local_results                             Local buffer for storing the partial result
+ * @param[in] src_ptr                              Pointer to the source tensor. Supported data types: S32/F16/F32
+ * @param[in] src_stride_x                         Stride of the source tensor in X dimension (in bytes)
+ * @param[in] src_step_x                           src_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in] src_stride_y                         Stride of the source tensor in Y dimension (in bytes)
+ * @param[in] src_step_y                           src_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in] src_offset_first_element_in_bytes    The offset of the first element in the source tensor
+ * @param[in] output_ptr                           Pointer to the destination tensor. Supported data types: same as @p src_ptr
+ * @param[in] output_stride_x                      Stride of the output tensor in X dimension (in bytes)
+ * @param[in] output_step_x                        output_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in] output_stride_y                      Stride of the output tensor in Y dimension (in bytes)
+ * @param[in] output_step_y                        output_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in] output_offset_first_element_in_bytes The offset of the first element in the destination tensor
+ * @param[in] local_results                        Local buffer for storing the partial results
  */
-__kernel void reduction_operation_x(
+__kernel void reduction_operation_x_coop(
     IMAGE_DECLARATION(src),
-    IMAGE_DECLARATION(partial_res),
+    IMAGE_DECLARATION(output),
     __local DATA_TYPE *local_results)
 {
-    Image src         = CONVERT_TO_IMAGE_STRUCT(src);
-    Image partial_res = CONVERT_TO_IMAGE_STRUCT(partial_res);
+    const uint lid   = get_local_id(0);
+    const uint lsize = get_local_size(0);
+    const uint y_idx = get_global_id(1);
 
-    unsigned int lsize = get_local_size(0);
-    unsigned int lid   = get_local_id(0);
+    const __global DATA_TYPE *src_in_row = (const __global DATA_TYPE *)(src_ptr + src_offset_first_element_in_bytes + y_idx * src_step_y);
+
+#if defined(PROD)
+    DATA_TYPE res = (DATA_TYPE)1;
+#else  // !defined(PROD)
+    DATA_TYPE res = (DATA_TYPE)0;
+#endif // defined(PROD)
 
-    for(unsigned int y = 0; y < get_local_size(1); ++y)
+    // Grid-stride accumulation of the private partial result
+    for(uint x = lid; x < WIDTH; x += lsize)
     {
-        local_results[lid] = OPERATION((__global DATA_TYPE *)offset(&src, 0, y));
-        barrier(CLK_LOCAL_MEM_FENCE);
+        DATA_TYPE in = src_in_row[x];
+#if defined(SUM_SQUARE)
+        in *= in;
+#endif // defined(SUM_SQUARE)
+#if defined(PROD)
+        res *= in;
+#else  // !defined(PROD)
+        res += in;
+#endif // defined(PROD)
+    }
+
+    local_results[lid] = res;
+    barrier(CLK_LOCAL_MEM_FENCE);
 
-        // Perform parallel reduction
-        for(unsigned int i = lsize >> 1; i > 0; i >>= 1)
+    // Perform parallel reduction (the local size is a power of two)
+    for(uint i = lsize >> 1; i > 0; i >>= 1)
+    {
+        if(lid < i)
         {
-            if(lid < i)
-            {
 #if defined(PROD)
-                local_results[lid] *= local_results[lid + i];
+            local_results[lid] *= local_results[lid + i];
 #else  // !defined(PROD)
-                local_results[lid] += local_results[lid + i];
+            local_results[lid] += local_results[lid + i];
 #endif // defined(PROD)
-            }
-            barrier(CLK_LOCAL_MEM_FENCE);
         }
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
 
-        if(lid == 0)
-        {
-#if defined(MEAN) && defined(WIDTH)
-            if(y == get_local_size(1) - 1)
-            {
-                local_results[0] /= WIDTH;
-            }
-#endif // defined(MEAN) && defined(WIDTH)
-            ((__global DATA_TYPE *)offset(&partial_res, get_group_id(0), y))[0] = local_results[0];
-        }
+    if(lid == 0)
+    {
+#if defined(MEAN)
+        local_results[0] /= WIDTH;
+#endif // defined(MEAN)
+        *((__global DATA_TYPE *)(output_ptr + output_offset_first_element_in_bytes + y_idx * output_step_y)) = local_results[0];
     }
 }
-#endif // defined(OPERATION)
-
-#if defined(WIDTH)
+#endif // defined(PARALLEL)
 /** This kernel performs reduction on x-axis. (Non parallel)
  *
  * @note The data type must be passed at compile time using -DDATA_TYPE: e.g. -DDATA_TYPE=float
@@ -282,6 +282,117 @@ __kernel void softmax_layer_max_shift_exp_sum_serial(
     *((__global DATA_TYPE *)sum.ptr) = sum1D.s0;
 }
 
+#if defined(WIDTH)
+/** Computes a full softmax (or log softmax) row in a single launch.
+ *
+ * One work-group processes a whole row: the maximum and the sum of exponentials are computed with
+ * grid-stride private accumulations combined by local-memory trees, and the shifted exponentials are
+ * staged in the destination tensor between the passes so that no intermediate global tensors are needed.
+ *
+ * @note Datatype must be given as a preprocessor argument using -DDATA_TYPE=type. e.g. -DDATA_TYPE=short
+ * @note The width size must be passed at compile time using -DWIDTH e.g. -DWIDTH=128
+ * @note Beta can be optionally passed at compile time using -DBETA (by default, it is 1.0).
+ *
+ * @param[in]  src_ptr                           Pointer to the source tensor slice. Supported data types: F16/F32
+ * @param[in]  src_stride_x                      Stride of the source tensor in X dimension (in bytes)
+ * @param[in]  src_step_x                        src_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  src_stride_y                      Stride of the source tensor in Y dimension (in bytes)
+ * @param[in]  src_step_y                        src_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  src_stride_z                      Stride of the source tensor in Z dimension (in bytes)
+ * @param[in]  src_step_z                        src_stride_z * number of elements along Z processed per workitem(in bytes)
+ * @param[in]  src_offset_first_element_in_bytes The offset of the first element in the source tensor
+ * @param[out] dst_ptr                           Pointer to the destination tensor slice. Supported data types: same as @p src_ptr
+ * @param[in]  dst_stride_x                      Stride of the destination tensor in X dimension (in bytes)
+ * @param[in]  dst_step_x                        dst_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  dst_stride_y                      Stride of the destination tensor in Y dimension (in bytes)
+ * @param[in]  dst_step_y                        dst_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  dst_stride_z                      Stride of the destination tensor in Z dimension (in bytes)
+ * @param[in]  dst_step_z                        dst_stride_z * number of elements along Z processed per workitem(in bytes)
+ * @param[in]  dst_offset_first_element_in_bytes The offset of the first element in the destination tensor
+ * @param[in]  local_results                     Local buffer for storing the partial results
+ */
+__kernel void softmax_layer_fused(
+    TENSOR3D_DECLARATION(src),
+    TENSOR3D_DECLARATION(dst),
+    __local DATA_TYPE *local_results)
+{
+    const uint lid   = get_local_id(0);
+    const uint lsize = get_local_size(0);
+
+    const __global DATA_TYPE *src_row = (const __global DATA_TYPE *)(src_ptr + src_offset_first_element_in_bytes + get_global_id(1) * src_stride_y + get_global_id(2) * src_stride_z);
+    __global DATA_TYPE *dst_row       = (__global DATA_TYPE *)(dst_ptr + dst_offset_first_element_in_bytes + get_global_id(1) * dst_stride_y + get_global_id(2) * dst_stride_z);
+
+    // Calculate max of row
+    DATA_TYPE max_val = MINVAL;
+    for(uint x = lid; x < WIDTH; x += lsize)
+    {
+        max_val = MAX_OP(src_row[x], max_val, DATA_TYPE, 1);
+    }
+
+    local_results[lid] = max_val;
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    // Perform parallel max reduction (the local size is a power of two)
+    for(uint i = lsize >> 1; i > 0; i >>= 1)
+    {
+        if(lid < i)
+        {
+            local_results[lid] = MAX_OP(local_results[lid + i], local_results[lid], DATA_TYPE, 1);
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+    max_val = local_results[0];
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    // Shift values, exp and sum
+    DATA_TYPE sum_val = 0;
+    for(uint x = lid; x < WIDTH; x += lsize)
+    {
+        DATA_TYPE data = SUB_OP(src_row[x], max_val, DATA_TYPE, 1);
+#ifdef BETA
+        data = MUL_OP(data, (DATA_TYPE)BETA, DATA_TYPE, 1);
+#endif /* BETA */
+#ifdef LOG_SOFTMAX
+        dst_row[x] = data;
+        data       = EXP_OP(data, DATA_TYPE, 1);
+#else  /* LOG_SOFTMAX */
+        data       = EXP_OP(data, DATA_TYPE, 1);
+        dst_row[x] = data;
+#endif /* LOG_SOFTMAX */
+        sum_val = ADD_OP(sum_val, data, DATA_TYPE, 1);
+    }
+
+    local_results[lid] = sum_val;
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    // Perform parallel sum reduction
+    for(uint i = lsize >> 1; i > 0; i >>= 1)
+    {
+        if(lid < i)
+        {
+            local_results[lid] = ADD_OP(local_results[lid + i], local_results[lid], DATA_TYPE, 1);
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+    sum_val = local_results[0];
+
+    // Normalize: each work-item revisits the elements it stored itself, so no global fence is required
+#ifdef LOG_SOFTMAX
+    const DATA_TYPE log_sum = log(sum_val);
+    for(uint x = lid; x < WIDTH; x += lsize)
+    {
+        dst_row[x] = SUB_OP(dst_row[x], log_sum, DATA_TYPE, 1);
+    }
+#else  /* LOG_SOFTMAX */
+    const DATA_TYPE inv_sum = DIV_OP((DATA_TYPE)1, sum_val, DATA_TYPE, 1);
+    for(uint x = lid; x < WIDTH; x += lsize)
+    {
+        dst_row[x] = MUL_OP(dst_row[x], inv_sum, DATA_TYPE, 1);
+    }
+#endif /* LOG_SOFTMAX */
+}
+#endif /* defined(WIDTH) */
+
 /** Identifies the maximum value across the 1st dimension and shifts the values of the input tensor by this maximum value,
  * then gets the exponent of each element as sums all elements across each row.
  *
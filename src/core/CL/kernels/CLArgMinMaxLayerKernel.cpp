@@ -42,6 +42,17 @@ namespace
 {
 constexpr unsigned int vector_size = 16;
 
+unsigned int cooperative_local_size(unsigned int width)
+{
+    // Largest power of two that fits both the row and the local-memory tree cap
+    unsigned int lws = 1;
+    while(((lws << 1) <= width) && ((lws << 1) <= 128U))
+    {
+        lws <<= 1;
+    }
+    return lws;
+}
+
 Status validate_arguments(const ITensorInfo *input, const ITensorInfo *prev_output, const ITensorInfo *output, unsigned int axis, ReductionOperation op)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output);
@@ -83,11 +94,18 @@ std::tuple<Status, Window> validate_and_configure_window(ITensorInfo *input, ITe
     {
         case 0:
         {
-            ITensorInfo           *input_tensor_access = prev_output != nullptr ? prev_output : input;
-            AccessWindowStatic     input_access(input_tensor_access, 0, 0, static_cast<int>(input_tensor_access->dimension(0)), 1);
-            AccessWindowHorizontal output_access(output, 0, 1);
-            window_changed = update_window_and_padding(win, input_access, output_access);
-            output_access.set_valid_region(win, ValidRegion(Coordinates(), output->tensor_shape()));
+            if(prev_output == nullptr)
+            {
+                // One work-group co-operates on a whole row reading single elements, so no padding is required
+                win.set(Window::DimX, Window::Dimension(0, cooperative_local_size(input->dimension(0)), 1));
+            }
+            else
+            {
+                AccessWindowStatic     input_access(prev_output, 0, 0, static_cast<int>(prev_output->dimension(0)), 1);
+                AccessWindowHorizontal output_access(output, 0, 1);
+                window_changed = update_window_and_padding(win, input_access, output_access);
+                output_access.set_valid_region(win, ValidRegion(Coordinates(), output->tensor_shape()));
+            }
         }
         break;
         case 1:
@@ -149,11 +167,22 @@ void CLArgMinMaxLayerKernel::configure(const CLCompileContext &compile_context,
     {
         case 0:
         {
-            const ICLTensor *input_for_width = prev_output != nullptr ? _prev_output : _input;
-            build_opts.add_option("-DWIDTH=" + support::cpp11::to_string(input_for_width->info()->dimension(0)));
+            if(prev_output == nullptr)
+            {
+                // Single-launch work-group co-operative reduction: one work-group per row,
+                // sized to the largest power of two fitting the row
+                build_opts.add_option("-DWIDTH=" + support::cpp11::to_string(input->info()->dimension(0)));
 
-            kernel_axis_name = "x";
-            lws_hint         = create_lws_hint_parallel_implementations(input_for_width->info()->dimension(0), vector_size);
+                kernel_axis_name = "x_coop";
+                lws_hint         = cl::NDRange(cooperative_local_size(input->info()->dimension(0)));
+            }
+            else
+            {
+                build_opts.add_option("-DWIDTH=" + support::cpp11::to_string(_prev_output->info()->dimension(0)));
+
+                kernel_axis_name = "x";
+                lws_hint         = create_lws_hint_parallel_implementations(_prev_output->info()->dimension(0), vector_size);
+            }
         }
         break;
         case 1:
@@ -202,12 +231,19 @@ void CLArgMinMaxLayerKernel::run(const Window &window, cl::CommandQueue &queue)
             Window in_slice  = window.first_slice_window_2D();
             Window out_slice = out_window.first_slice_window_2D();
 
-            // Reshape window
-            const unsigned int num_tensors = _prev_output != nullptr ? 3 : 2;
-
-            // Set local sums buffer
-            unsigned int local_res_size = lws_hint()[0] * _output->info()->element_size();
-            _kernel.setArg(num_arguments_per_2D_tensor() * num_tensors, local_res_size, nullptr);
+            if(_prev_output == nullptr)
+            {
+                // Set local values and indices buffers of the co-operative reduction
+                const unsigned int local_args_idx = num_arguments_per_2D_tensor() * 2;
+                _kernel.setArg(local_args_idx, lws_hint()[0] * _input->info()->element_size(), nullptr);
+                _kernel.setArg(local_args_idx + 1, lws_hint()[0] * _output->info()->element_size(), nullptr);
+            }
+            else
+            {
+                // Set local sums buffer
+                unsigned int local_res_size = lws_hint()[0] * _output->info()->element_size();
+                _kernel.setArg(num_arguments_per_2D_tensor() * 3, local_res_size, nullptr);
+            }
             do
             {
                 unsigned int idx = 0;
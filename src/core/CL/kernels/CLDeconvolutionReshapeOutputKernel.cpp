@@ -48,8 +48,8 @@ Status validate_arguments(const ITensorInfo *input, const ITensorInfo *bias, con
 
     const bool is_qasymm = is_data_type_quantized_asymmetric(input_info->data_type());
 
-    ARM_COMPUTE_RETURN_ERROR_ON(weights_info->dimension(idx_w) != deconv_info.stride().first);
-    ARM_COMPUTE_RETURN_ERROR_ON(weights_info->dimension(idx_h) != deconv_info.stride().second);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights_info->dimension(idx_w) < deconv_info.stride().first);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights_info->dimension(idx_h) < deconv_info.stride().second);
 
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32, DataType::F16, DataType::QASYMM8, DataType::QASYMM8_SIGNED, DataType::S32);
     if(!is_qasymm)
@@ -101,7 +101,11 @@ std::pair<Status, Window> validate_and_configure_window(const ITensorInfo *input
 
     auto_init_if_empty(*output, input->clone()->set_tensor_shape(output_shape).set_data_layout(data_layout).set_quantization_info(input->quantization_info()));
 
-    Window win = calculate_max_window(*input);
+    // When the filter is larger than the stride, the patches written by neighbouring input pixels overlap and each
+    // output element accumulates several GEMM elements: parallelize over the output instead of the input
+    const bool overlap = weights_info->dimension(idx_w) != deconv_info.stride().first || weights_info->dimension(idx_h) != deconv_info.stride().second;
+
+    Window win = overlap ? calculate_max_window(*output) : calculate_max_window(*input);
 
     return std::make_pair(Status{}, win);
 }
@@ -140,11 +144,14 @@ void CLDeconvolutionReshapeOutputKernel::configure(const CLCompileContext &compi
     _add_bias = (bias != nullptr);
     _bias     = bias;
 
-    const int filter_w = weights_info->dimension(idx_w);
-    const int filter_h = weights_info->dimension(idx_h);
-    const int filter_b = weights_info->dimension(idx_b);
-    const int img_w    = input_info->dimension(idx_w);
-    const int img_h    = input_info->dimension(idx_h);
+    const int  filter_w = weights_info->dimension(idx_w);
+    const int  filter_h = weights_info->dimension(idx_h);
+    const int  filter_b = weights_info->dimension(idx_b);
+    const int  img_w    = input_info->dimension(idx_w);
+    const int  img_h    = input_info->dimension(idx_h);
+    const int  stride_x = deconv_info.stride().first;
+    const int  stride_y = deconv_info.stride().second;
+    const bool overlap  = filter_w != stride_x || filter_h != stride_y;
 
     CLBuildOptions build_opts;
     build_opts.add_option("-DDATA_TYPE=" + get_cl_type_from_data_type(input->info()->data_type()));
@@ -152,10 +159,12 @@ void CLDeconvolutionReshapeOutputKernel::configure(const CLCompileContext &compi
     build_opts.add_option("-DFILTER_HEIGHT=" + support::cpp11::to_string(filter_h));
     build_opts.add_option("-DSRC_WIDTH=" + support::cpp11::to_string(img_w));
     build_opts.add_option("-DSRC_HEIGHT=" + support::cpp11::to_string(img_h));
+    build_opts.add_option_if(overlap, "-DSTRIDE_X=" + support::cpp11::to_string(stride_x));
+    build_opts.add_option_if(overlap, "-DSTRIDE_Y=" + support::cpp11::to_string(stride_y));
     build_opts.add_option_if(data_layout == DataLayout::NCHW, "-DNUM_FILTERS=" + support::cpp11::to_string(filter_b));
     build_opts.add_option_if(_add_bias, "-DADD_BIAS");
 
-    _kernel = create_kernel(compile_context, "deconvolution_reshape", build_opts.options());
+    _kernel = create_kernel(compile_context, overlap ? "deconvolution_reshape_overlap" : "deconvolution_reshape", build_opts.options());
     ICLKernel::configure_internal(win_config.second);
 
     // Set config_id for enabling LWS tuning
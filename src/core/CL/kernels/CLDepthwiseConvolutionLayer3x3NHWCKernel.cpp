@@ -135,8 +135,9 @@ std::pair<Status, Window> validate_and_configure_window(ITensorInfo *input, ITen
 
     const bool is_qasymm              = is_data_type_quantized_asymmetric(input->data_type());
     const bool is_stride_1_dilation_1 = ((conv_info.stride().first == conv_info.stride().second) && (conv_info.stride().first == 1) && dilation.x() == 1 && dilation.y() == 1);
+    const bool is_small_spatial       = is_stride_1_dilation_1 && !is_qasymm && ((output->dimension(1) * output->dimension(2)) <= 64);
 
-    const unsigned int num_rows_processed_per_iteration = is_stride_1_dilation_1 ? 2 : 1;
+    const unsigned int num_rows_processed_per_iteration = (is_stride_1_dilation_1 && !is_small_spatial) ? 2 : 1;
     const unsigned int num_elems_accessed_per_iteration = is_qasymm ? 4 : (8 / input->element_size());
     const unsigned int num_rows_read_per_iteration      = num_rows_processed_per_iteration + 2;
     const unsigned int num_rows_written_per_iteration   = std::ceil(num_rows_processed_per_iteration / static_cast<float>(conv_info.stride().first));
@@ -240,6 +241,16 @@ void CLDepthwiseConvolutionLayer3x3NHWCKernel::configure(const CLCompileContext
         _num_planes_processed_per_iteration = 1;
     }
 
+    // On small spatial sizes (e.g. the late 7x7 stages of MobileNet-like networks) the default mapping leaves the
+    // shader cores underoccupied and the launch overhead dominates. In this case each work-item walks a whole
+    // output column with the filter weights kept register-resident across all the output rows
+    const bool is_small_spatial = is_stride_1_dilation_1 && !_is_quantized && ((output->info()->dimension(1) * output->info()->dimension(2)) <= 64);
+    if(is_small_spatial)
+    {
+        _num_rows_processed_per_iteration   = 1;
+        _num_planes_processed_per_iteration = output->info()->dimension(2);
+    }
+
     _border_size = BorderSize(_is_quantized && is_stride_1 ? 0 : conv_info.pad_left(), 0, std::max(std::max(conv_info.pad_right(), conv_info.pad_bottom()), conv_info.pad_top()), 0);
 
     const unsigned int num_elems_accessed_per_iteration = _is_quantized ? 4 : (8 / input->info()->element_size());
@@ -307,6 +318,7 @@ void CLDepthwiseConvolutionLayer3x3NHWCKernel::configure(const CLCompileContext
         build_opts.add_option("-DNUM_ROWS_PROCESSED=" + support::cpp11::to_string(_num_rows_processed_per_iteration));
         build_opts.add_option("-DNUM_PLANES_PROCESSED=" + support::cpp11::to_string(_num_planes_processed_per_iteration));
         build_opts.add_option("-DDST_DIM_2=" + support::cpp11::to_string(_output->info()->dimension(2)));
+        build_opts.add_option_if(is_small_spatial, "-DSMALL_SPATIAL");
     }
     else
     {
@@ -329,6 +341,7 @@ void CLDepthwiseConvolutionLayer3x3NHWCKernel::configure(const CLCompileContext
     {
         kernel_name = std::string("depthwise_convolution_3x3_nhwc");
         kernel_name += (is_stride_1_dilation_1 ? "_stride1" : "");
+        kernel_name += (is_small_spatial ? "_small" : "");
     }
 
     build_opts.add_option_if(input->info()->data_type() == DataType::F16, "-DIS_F16");
@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/CL/kernels/CLElementwiseChainKernel.h"
+
+#include "arm_compute/core/CL/CLHelpers.h"
+#include "arm_compute/core/CL/CLKernelLibrary.h"
+#include "arm_compute/core/CL/CLValidate.h"
+#include "arm_compute/core/CL/ICLTensor.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Utils.h"
+#include "support/StringSupport.h"
+
+#include <sstream>
+
+namespace arm_compute
+{
+namespace
+{
+std::string op_name(ElementwiseChainOp op)
+{
+    switch(op)
+    {
+        case ElementwiseChainOp::ADD:
+            return "add";
+        case ElementwiseChainOp::SUB:
+            return "sub";
+        case ElementwiseChainOp::MUL:
+            return "mul";
+        case ElementwiseChainOp::MIN:
+            return "min";
+        case ElementwiseChainOp::MAX:
+            return "max";
+        default:
+            ARM_COMPUTE_ERROR("Unsupported chain operation");
+    }
+}
+
+std::string act_name(const ActivationLayerInfo &act_info)
+{
+    switch(act_info.activation())
+    {
+        case ActivationLayerInfo::ActivationFunction::RELU:
+            return "relu";
+        case ActivationLayerInfo::ActivationFunction::LOGISTIC:
+            return "logistic";
+        case ActivationLayerInfo::ActivationFunction::TANH:
+            return "tanh";
+        default:
+            ARM_COMPUTE_ERROR("Unsupported fused activation");
+    }
+}
+
+/** Generate the OpenCL source of the fused chain kernel
+ *
+ * The source is self contained: the tensors are addressed with the same argument layout as
+ * TENSOR3D_DECLARATION so that add_3D_tensor_argument can be used unchanged.
+ */
+std::string generate_chain_source(const std::vector<ElementwiseChainOp> &ops, const ActivationLayerInfo &act_info, DataType data_type, unsigned int vec_size)
+{
+    const size_t      num_inputs = ops.size() + 1;
+    const std::string type       = get_cl_type_from_data_type(data_type);
+    const std::string vec_type   = type + support::cpp11::to_string(vec_size);
+    const std::string vec_n      = support::cpp11::to_string(vec_size);
+
+    std::ostringstream src;
+
+    if(data_type == DataType::F16)
+    {
+        src << "#pragma OPENCL EXTENSION cl_khr_fp16 : enable\n";
+    }
+
+    src << "#define TENSOR3D_DECLARATION(name) \\\n"
+        << "    __global uchar *name##_ptr, uint name##_stride_x, uint name##_step_x, uint name##_stride_y, uint name##_step_y, uint name##_stride_z, uint name##_step_z, uint name##_offset_first_element_in_bytes\n"
+        << "\n"
+        << "__kernel void fused_elementwise_chain(\n";
+    for(size_t i = 0; i < num_inputs; ++i)
+    {
+        src << "    TENSOR3D_DECLARATION(in" << i << "),\n";
+    }
+    src << "    TENSOR3D_DECLARATION(out))\n"
+        << "{\n"
+        << "    const int x = get_global_id(0);\n"
+        << "    const int y = get_global_id(1);\n"
+        << "    const int z = get_global_id(2);\n";
+
+    // Load the first input as accumulator and fold in one input per operation
+    for(size_t i = 0; i < num_inputs; ++i)
+    {
+        src << "    " << vec_type << " " << (i == 0 ? "acc" : "v" + support::cpp11::to_string(i))
+            << " = vload" << vec_n << "(0, (__global " << type << " *)(in" << i << "_ptr + in" << i << "_offset_first_element_in_bytes + x * in" << i << "_step_x + y * in" << i << "_step_y + z * in" << i
+            << "_step_z));\n";
+
+        if(i == 0)
+        {
+            continue;
+        }
+        const std::string v = "v" + support::cpp11::to_string(i);
+        switch(ops[i - 1])
+        {
+            case ElementwiseChainOp::ADD:
+                src << "    acc += " << v << ";\n";
+                break;
+            case ElementwiseChainOp::SUB:
+                src << "    acc -= " << v << ";\n";
+                break;
+            case ElementwiseChainOp::MUL:
+                src << "    acc *= " << v << ";\n";
+                break;
+            case ElementwiseChainOp::MIN:
+                src << "    acc = fmin(acc, " << v << ");\n";
+                break;
+            case ElementwiseChainOp::MAX:
+                src << "    acc = fmax(acc, " << v << ");\n";
+                break;
+            default:
+                ARM_COMPUTE_ERROR("Unsupported chain operation");
+        }
+    }
+
+    if(act_info.enabled())
+    {
+        switch(act_info.activation())
+        {
+            case ActivationLayerInfo::ActivationFunction::RELU:
+                src << "    acc = fmax(acc, (" << vec_type << ")0.0f);\n";
+                break;
+            case ActivationLayerInfo::ActivationFunction::LOGISTIC:
+                src << "    acc = ((" << vec_type << ")1.0f) / ((" << vec_type << ")1.0f + exp(-acc));\n";
+                break;
+            case ActivationLayerInfo::ActivationFunction::TANH:
+                src << "    acc = ((" << vec_type << ")" << float_to_string_with_full_precision(act_info.a()) << ") * tanh(((" << vec_type << ")" << float_to_string_with_full_precision(act_info.b())
+                    << ") * acc);\n";
+                break;
+            default:
+                ARM_COMPUTE_ERROR("Unsupported fused activation");
+        }
+    }
+
+    src << "    vstore" << vec_n << "(acc, 0, (__global " << type << " *)(out_ptr + out_offset_first_element_in_bytes + x * out_step_x + y * out_step_y + z * out_step_z));\n"
+        << "}\n";
+
+    return src.str();
+}
+
+Status validate_arguments(const std::vector<const ITensorInfo *> &inputs, const ITensorInfo *output, const std::vector<ElementwiseChainOp> &ops, const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(output);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(ops.empty(), "The chain must contain at least one operation");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(inputs.size() != ops.size() + 1, "The chain needs one more input than operations");
+
+    const ITensorInfo *first = inputs[0];
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(first);
+    ARM_COMPUTE_RETURN_ERROR_ON_F16_UNSUPPORTED(first);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(first, 1, DataType::F16, DataType::F32);
+
+    for(const auto *input : inputs)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(first, input);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(first, input);
+    }
+
+    if(act_info.enabled())
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(act_info.activation() != ActivationLayerInfo::ActivationFunction::RELU
+                                        && act_info.activation() != ActivationLayerInfo::ActivationFunction::LOGISTIC
+                                        && act_info.activation() != ActivationLayerInfo::ActivationFunction::TANH,
+                                        "Unsupported fused activation");
+    }
+
+    if(output->total_size() > 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(first, output);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(first, output);
+    }
+
+    return Status{};
+}
+
+std::pair<Status, Window> validate_and_configure_window(const std::vector<ITensorInfo *> &inputs, ITensorInfo &output, unsigned int num_elems_processed_per_iteration)
+{
+    Window win = calculate_max_window(output, Steps(num_elems_processed_per_iteration));
+
+    AccessWindowHorizontal output_access(&output, 0, num_elems_processed_per_iteration);
+    bool                   window_changed = update_window_and_padding(win, output_access);
+    for(auto *input : inputs)
+    {
+        AccessWindowHorizontal input_access(input, 0, num_elems_processed_per_iteration);
+        window_changed = update_window_and_padding(win, input_access) || window_changed;
+    }
+    output.set_valid_region(ValidRegion(Coordinates(), output.tensor_shape()));
+
+    ARM_COMPUTE_UNUSED(window_changed);
+    return std::make_pair(Status{}, win);
+}
+} // namespace
+
+CLElementwiseChainKernel::CLElementwiseChainKernel()
+    : _inputs(), _output(nullptr)
+{
+}
+
+void CLElementwiseChainKernel::configure(const std::vector<const ICLTensor *> &inputs, ICLTensor *output, const std::vector<ElementwiseChainOp> &ops, const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(output);
+
+    std::vector<ITensorInfo *> input_infos;
+    for(const auto *input : inputs)
+    {
+        ARM_COMPUTE_ERROR_ON_NULLPTR(input);
+        input_infos.push_back(input->info());
+    }
+
+    // Output auto initialization if not yet initialized
+    auto_init_if_empty(*output->info(), *inputs[0]->info());
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(std::vector<const ITensorInfo *>(input_infos.begin(), input_infos.end()), output->info(), ops, act_info));
+
+    _inputs = inputs;
+    _output = output;
+
+    const DataType     data_type = inputs[0]->info()->data_type();
+    const unsigned int vec_size  = 16 / inputs[0]->info()->element_size();
+
+    // The program name encodes the chain, as each chain has its own generated source
+    std::string program_name = "fused_elementwise_chain";
+    for(auto op : ops)
+    {
+        program_name += "_" + op_name(op);
+    }
+    if(act_info.enabled())
+    {
+        program_name += "_" + act_name(act_info);
+    }
+    program_name += "_" + lower_string(string_from_data_type(data_type));
+
+    // Generate and compile the fused kernel
+    const std::string source = generate_chain_source(ops, act_info, data_type, vec_size);
+    _kernel                  = static_cast<cl::Kernel>(CLKernelLibrary::get().get_compile_context().create_kernel("fused_elementwise_chain", program_name, source,
+                                                                                                                  CLKernelLibrary::get().get_kernel_path(), {}, false));
+
+    // Configure kernel window
+    auto win_config = validate_and_configure_window(input_infos, *output->info(), vec_size);
+    ARM_COMPUTE_ERROR_THROW_ON(win_config.first);
+    ICLKernel::configure_internal(win_config.second);
+
+    // Set config_id for enabling LWS tuning
+    _config_id = program_name;
+    _config_id += "_";
+    _config_id += support::cpp11::to_string(output->info()->dimension(0));
+    _config_id += "_";
+    _config_id += support::cpp11::to_string(output->info()->dimension(1));
+}
+
+Status CLElementwiseChainKernel::validate(const std::vector<const ITensorInfo *> &inputs, const ITensorInfo *output, const std::vector<ElementwiseChainOp> &ops, const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(inputs, output, ops, act_info));
+    return Status{};
+}
+
+void CLElementwiseChainKernel::run(const Window &window, cl::CommandQueue &queue)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICLKernel::window(), window);
+
+    Window collapsed = window.collapse_if_possible(ICLKernel::window(), Window::DimZ);
+    Window slice     = collapsed.first_slice_window_3D();
+
+    do
+    {
+        unsigned int idx = 0;
+        for(const auto *input : _inputs)
+        {
+            add_3D_tensor_argument(idx, input, slice);
+        }
+        add_3D_tensor_argument(idx, _output, slice);
+        enqueue(queue, *this, slice, lws_hint());
+    }
+    while(collapsed.slide_window_slice_3D(slice));
+}
+} // namespace arm_compute
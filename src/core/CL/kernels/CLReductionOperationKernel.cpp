@@ -23,7 +23,6 @@
  */
 #include "arm_compute/core/CL/kernels/CLReductionOperationKernel.h"
 
-#include "arm_compute/core/AccessWindowStatic.h"
 #include "arm_compute/core/CL/CLHelpers.h"
 #include "arm_compute/core/CL/CLKernelLibrary.h"
 #include "arm_compute/core/CL/CLValidate.h"
@@ -41,11 +40,20 @@ namespace arm_compute
 {
 namespace
 {
-// OpenCL kernel requires input width to be a power of 2 for x-axis.
-constexpr unsigned int border_val = 64;
+unsigned int cooperative_local_size(unsigned int width)
+{
+    // Largest power of two that fits both the row and the local-memory tree cap
+    unsigned int lws = 1;
+    while(((lws << 1) <= width) && ((lws << 1) <= 128U))
+    {
+        lws <<= 1;
+    }
+    return lws;
+}
 
 Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, unsigned int axis, ReductionOperation op, unsigned int width)
 {
+    ARM_COMPUTE_UNUSED(width);
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output);
     ARM_COMPUTE_RETURN_ERROR_ON_F16_UNSUPPORTED(input);
     if(input->num_channels() == 1)
@@ -59,7 +67,6 @@ Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, u
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(op == ReductionOperation::SUM_SQUARE && input->data_type() == DataType::QASYMM8, "Not supported reduction operation for QASYMM8");
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(axis >= TensorShape::num_max_dimensions, "Reduction axis greater than max number of dimensions");
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(axis > 3, "Unsupported reduction axis");
-    ARM_COMPUTE_RETURN_ERROR_ON((op == ReductionOperation::MEAN_SUM) && (axis == 0) && (width == 0) && (input->data_type() != DataType::QASYMM8) && (input->data_type() != DataType::QASYMM8_SIGNED));
     ARM_COMPUTE_RETURN_ERROR_ON_MSG((op == ReductionOperation::ARG_IDX_MAX) || (op == ReductionOperation::ARG_IDX_MIN), "Not supported reduction operation, use CLArgMinMaxLayer");
 
     if(output->total_size() != 0)
@@ -89,11 +96,8 @@ std::tuple<Status, Window> validate_and_configure_window(ITensorInfo *input, ITe
         {
             if(!is_serial_op)
             {
-                const unsigned int     border_width = ((input->dimension(0) % border_val) != 0) ? border_val - input->dimension(0) % border_val : 0;
-                AccessWindowStatic     input_access(input, 0, 0, input->dimension(0) + border_width, 1);
-                AccessWindowHorizontal output_access(output, 0, 1);
-                window_changed = update_window_and_padding(win, input_access, output_access);
-                output_access.set_valid_region(win, ValidRegion(Coordinates(), output->tensor_shape()));
+                // One work-group co-operates on a whole row reading single elements, so no padding is required
+                win.set(Window::DimX, Window::Dimension(0, cooperative_local_size(input->dimension(0)), 1));
             }
         }
         break;
@@ -170,25 +174,6 @@ void CLReductionOperationKernel::configure(const CLCompileContext &compile_conte
     build_opts.add_option_if(is_data_type_quantized(data_type), "-DOFFSET=" + support::cpp11::to_string(input->info()->quantization_info().uniform().offset));
     build_opts.add_option_if(is_data_type_quantized(data_type), "-DSCALE=" + float_to_string_with_full_precision(input->info()->quantization_info().uniform().scale));
 
-    switch(op)
-    {
-        case ReductionOperation::SUM_SQUARE:
-            build_opts.add_option(("-DOPERATION=square_sum"));
-            break;
-        case ReductionOperation::SUM:
-        case ReductionOperation::MEAN_SUM:
-            build_opts.add_option(("-DOPERATION=sum"));
-            break;
-        case ReductionOperation::MIN:
-        case ReductionOperation::MAX:
-            break;
-        case ReductionOperation::PROD:
-            build_opts.add_option(("-DOPERATION=product"));
-            break;
-        default:
-            ARM_COMPUTE_ERROR("Unsupported reduction operation");
-    }
-
     // Create kernel
     cl::NDRange lws_hint = CLKernelLibrary::get().default_ndrange();
     std::string kernel_axis_name;
@@ -206,13 +191,13 @@ void CLReductionOperationKernel::configure(const CLCompileContext &compile_conte
             }
             else
             {
-                build_opts.add_option_if(op == ReductionOperation::MEAN_SUM, "-DWIDTH=" + support::cpp11::to_string(width));
-                const unsigned int width_leftover = input->info()->dimension(0) % border_val;
-                const unsigned int border_width   = (width_leftover != 0) ? border_val - width_leftover : 0;
-                kernel_axis_name                  = "x";
+                // Single-launch work-group co-operative reduction: one work-group per row,
+                // sized to the largest power of two fitting the row
+                build_opts.add_option("-DWIDTH=" + support::cpp11::to_string(input->info()->dimension(0)));
+                build_opts.add_option("-DPARALLEL");
+                kernel_axis_name = "x_coop";
 
-                lws_hint     = create_lws_hint_parallel_implementations(input->info()->dimension(0), border_val);
-                _border_size = BorderSize(0, border_width, 0, 0);
+                lws_hint = cl::NDRange(cooperative_local_size(input->info()->dimension(0)));
             }
         }
         break;
@@ -292,10 +277,6 @@ void CLReductionOperationKernel::run(const Window &window, cl::CommandQueue &que
                 Window in_slice  = window.first_slice_window_2D();
                 Window out_slice = out_window.first_slice_window_2D();
 
-                // Reshape window
-                const unsigned int border_width = ((in_slice.x().end() % border_val) != 0) ? border_val - in_slice.x().end() % border_val : 0;
-                in_slice.set(Window::DimX, Window::Dimension(in_slice.x().start(), in_slice.x().end() + border_width, in_slice.x().step()));
-
                 // Set local sums buffer
                 unsigned int local_res_size = lws_hint()[0] * _input->info()->element_size();
                 _kernel.setArg(num_arguments_per_2D_tensor() * 2, local_res_size, nullptr);
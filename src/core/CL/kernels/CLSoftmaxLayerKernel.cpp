@@ -44,6 +44,17 @@ using namespace arm_compute;
 
 namespace
 {
+unsigned int cooperative_local_size(unsigned int width)
+{
+    // Largest power of two that fits both the row and the local-memory tree cap
+    unsigned int lws = 1;
+    while(((lws << 1) <= width) && ((lws << 1) <= 128U))
+    {
+        lws <<= 1;
+    }
+    return lws;
+}
+
 /** Calculates softmax parameters from the quantized input scale and scaling factor for the exponent and places them as build options.
  *
  * Prepares these build options:
@@ -153,6 +164,23 @@ Status validate_arguments_1DNorm(const ITensorInfo *input, const ITensorInfo *su
     return Status{};
 }
 
+Status validate_arguments_1DFused(const ITensorInfo *input, const ITensorInfo *output, const SoftmaxKernelInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_F16_UNSUPPORTED(input);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(output);
+    ARM_COMPUTE_RETURN_ERROR_ON(!CLLogits1DFusedSoftmaxKernel::is_fused_supported(input, info));
+
+    // Checks performed when output is configured
+    if(output->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(input, output);
+    }
+
+    return Status{};
+}
+
 // Window validation
 
 std::pair<Status, Window> validate_and_configure_window_1DMaxShiftExpSum(ITensorInfo *input, ITensorInfo *max, ITensorInfo *output, ITensorInfo *sum)
@@ -205,6 +233,18 @@ std::pair<Status, Window> validate_and_configure_window_1DNorm(ITensorInfo *inpu
     return std::make_pair(err, win);
 }
 
+std::pair<Status, Window> validate_and_configure_window_1DFused(ITensorInfo *input, ITensorInfo *output)
+{
+    // Output auto initialization if not yet initialized
+    auto_init_if_empty(*output, *input->clone());
+
+    // One work-group co-operates on a whole row reading single elements, so no padding is required
+    Window win = calculate_max_window(*input);
+    win.set(Window::DimX, Window::Dimension(0, cooperative_local_size(input->dimension(0)), 1));
+
+    return std::make_pair(Status{}, win);
+}
+
 } // namespace
 
 /**< Grid size (obtained through auto-tuning) */
@@ -425,3 +465,91 @@ void CLLogits1DNormKernel::run(const Window &window, cl::CommandQueue &queue)
     }
     while(window_collapsed.slide_window_slice_3D(slice));
 }
+
+/**< Maximum row width handled by the single-launch fused kernel (obtained through benchmarking) */
+const unsigned int CLLogits1DFusedSoftmaxKernel::_max_fused_width = 1024;
+
+CLLogits1DFusedSoftmaxKernel::CLLogits1DFusedSoftmaxKernel()
+    : _input(nullptr), _output(nullptr)
+{
+}
+
+void CLLogits1DFusedSoftmaxKernel::configure(const ICLTensor *input, ICLTensor *output, const SoftmaxKernelInfo &info)
+{
+    configure(CLKernelLibrary::get().get_compile_context(), input, output, info);
+}
+
+void CLLogits1DFusedSoftmaxKernel::configure(const CLCompileContext &compile_context, const ICLTensor *input, ICLTensor *output, const SoftmaxKernelInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
+
+    // Output auto initialization if not yet initialized
+    auto_init_if_empty(*output->info(), *input->info()->clone());
+
+    // Perform validation step
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments_1DFused(input->info(), output->info(), info));
+
+    _input  = input;
+    _output = output;
+
+    const DataType dt    = input->info()->data_type();
+    const size_t   width = input->info()->dimension(0);
+    const float    beta  = info.beta;
+
+    // Set build options
+    CLBuildOptions build_opts;
+    build_opts.add_option("-DDATA_TYPE=" + get_cl_type_from_data_type(dt));
+    build_opts.add_option("-DWIDTH=" + support::cpp11::to_string(width));
+    build_opts.add_option_if(dt == DataType::F16, "-DUSE_F16");
+    build_opts.add_option_if(beta != 1.0f, "-DBETA=" + float_to_string_with_full_precision(beta));
+    build_opts.add_option_if(info.is_log, "-DLOG_SOFTMAX");
+
+    // Create kernel
+    _kernel = create_kernel(compile_context, "softmax_layer_fused", build_opts.options());
+
+    // One work-group co-operates on a whole row, sized to the largest power of two fitting the row
+    const cl::NDRange lws_hint = cl::NDRange(cooperative_local_size(width));
+
+    // Configure window
+    auto win_config = validate_and_configure_window_1DFused(input->info(), output->info());
+    ARM_COMPUTE_ERROR_THROW_ON(win_config.first);
+    ICLKernel::configure_internal(win_config.second, lws_hint);
+}
+
+Status CLLogits1DFusedSoftmaxKernel::validate(const ITensorInfo *input, const ITensorInfo *output, const SoftmaxKernelInfo &info)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments_1DFused(input, output, info));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_and_configure_window_1DFused(input->clone().get(), output->clone().get()).first);
+
+    return Status{};
+}
+
+bool CLLogits1DFusedSoftmaxKernel::is_fused_supported(const ITensorInfo *input, const SoftmaxKernelInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+
+    return is_data_type_float(input->data_type()) && (input->dimension(0) <= _max_fused_width);
+}
+
+void CLLogits1DFusedSoftmaxKernel::run(const Window &window, cl::CommandQueue &queue)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(IKernel::window(), window);
+
+    Window window_collapsed = window.collapse_if_possible(ICLKernel::window(), Window::DimZ);
+    Window slice            = window_collapsed.first_slice_window_3D();
+
+    // Set the local partial results buffer
+    const unsigned int local_res_size = lws_hint()[0] * _input->info()->element_size();
+    _kernel.setArg(2 * num_arguments_per_3D_tensor(), local_res_size, nullptr);
+
+    do
+    {
+        unsigned int idx = 0;
+        // Set inputs
+        add_3D_tensor_argument(idx, _input, slice);
+        add_3D_tensor_argument(idx, _output, slice);
+        enqueue(queue, *this, slice, lws_hint());
+    }
+    while(window_collapsed.slide_window_slice_3D(slice));
+}
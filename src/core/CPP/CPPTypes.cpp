@@ -42,6 +42,31 @@ void CPUInfo::set_dotprod(const bool dotprod)
     _dotprod = dotprod;
 }
 
+void CPUInfo::set_sve(const bool sve)
+{
+    _sve = sve;
+}
+
+void CPUInfo::set_sve2(const bool sve2)
+{
+    _sve2 = sve2;
+}
+
+void CPUInfo::set_i8mm(const bool i8mm)
+{
+    _i8mm = i8mm;
+}
+
+void CPUInfo::set_bf16(const bool bf16)
+{
+    _bf16 = bf16;
+}
+
+void CPUInfo::set_fhm(const bool fhm)
+{
+    _fhm = fhm;
+}
+
 void CPUInfo::set_cpu_model(unsigned int cpuid, CPUModel model)
 {
     ARM_COMPUTE_ERROR_ON(cpuid >= _percpu.size());
@@ -65,6 +90,31 @@ bool CPUInfo::has_dotprod() const
     return _dotprod;
 }
 
+bool CPUInfo::has_sve() const
+{
+    return _sve;
+}
+
+bool CPUInfo::has_sve2() const
+{
+    return _sve2;
+}
+
+bool CPUInfo::has_i8mm() const
+{
+    return _i8mm;
+}
+
+bool CPUInfo::has_bf16() const
+{
+    return _bf16;
+}
+
+bool CPUInfo::has_fhm() const
+{
+    return _fhm;
+}
+
 CPUModel CPUInfo::get_cpu_model(unsigned int cpuid) const
 {
     if(cpuid < _percpu.size())
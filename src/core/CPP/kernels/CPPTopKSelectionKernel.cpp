@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/CPP/kernels/CPPTopKSelectionKernel.h"
+#include "arm_compute/core/Coordinates.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace arm_compute
+{
+namespace
+{
+Status validate_arguments(const ITensorInfo *scores, const ITensorInfo *values, const ITensorInfo *indices, const unsigned int k)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(scores, 1, DataType::QASYMM8, DataType::QASYMM8_SIGNED, DataType::S32, DataType::F16, DataType::F32);
+
+    ARM_COMPUTE_RETURN_ERROR_ON(scores->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(k == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON(k > scores->dimension(0));
+
+    // Validate configured outputs
+    if(values->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(scores, values);
+        ARM_COMPUTE_RETURN_ERROR_ON(values->dimension(0) != k);
+        ARM_COMPUTE_RETURN_ERROR_ON(values->dimension(1) != scores->dimension(1));
+    }
+    if(indices->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(indices, 1, DataType::U32);
+        ARM_COMPUTE_RETURN_ERROR_ON(indices->dimension(0) != k);
+        ARM_COMPUTE_RETURN_ERROR_ON(indices->dimension(1) != scores->dimension(1));
+    }
+
+    return Status{};
+}
+} // namespace
+
+template <typename T>
+void CPPTopKSelectionKernel::run_topk(const Window &window)
+{
+    using ScoreIndexPair = std::pair<T, uint32_t>;
+
+    // Orders the heap as a min-heap on the score so that the root is the weakest
+    // candidate; ties rank the earlier class index higher.
+    const auto comp = [](const ScoreIndexPair & a, const ScoreIndexPair & b)
+    {
+        return (a.first > b.first) || (a.first == b.first && a.second < b.second);
+    };
+
+    std::vector<ScoreIndexPair> heap;
+    heap.reserve(_k);
+
+    for(int row = window.x().start(); row < window.x().end(); ++row)
+    {
+        heap.clear();
+
+        for(unsigned int j = 0; j < _num_classes; ++j)
+        {
+            const T current_score = *reinterpret_cast<const T *>(_scores->ptr_to_element(Coordinates{ j, row }));
+            if(heap.size() < _k)
+            {
+                heap.emplace_back(current_score, j);
+                std::push_heap(heap.begin(), heap.end(), comp);
+            }
+            else if(current_score > heap.front().first)
+            {
+                std::pop_heap(heap.begin(), heap.end(), comp);
+                heap.back() = ScoreIndexPair(current_score, j);
+                std::push_heap(heap.begin(), heap.end(), comp);
+            }
+        }
+
+        // Sorting the min-heap with its own comparator yields descending scores
+        std::sort_heap(heap.begin(), heap.end(), comp);
+
+        for(unsigned int j = 0; j < _k; ++j)
+        {
+            *reinterpret_cast<T *>(_values->ptr_to_element(Coordinates{ j, row }))          = heap[j].first;
+            *reinterpret_cast<uint32_t *>(_indices->ptr_to_element(Coordinates{ j, row })) = heap[j].second;
+        }
+    }
+}
+
+CPPTopKSelectionKernel::CPPTopKSelectionKernel()
+    : _scores(nullptr), _values(nullptr), _indices(nullptr), _k(), _num_classes()
+{
+}
+
+void CPPTopKSelectionKernel::configure(const ITensor *scores, ITensor *values, ITensor *indices, const unsigned int k)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(scores, values, indices);
+
+    // Perform validation step
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(scores->info(), values->info(), indices->info(), k));
+
+    const TensorShape output_shape(k, scores->info()->dimension(1));
+    auto_init_if_empty(*values->info(), scores->info()->clone()->set_tensor_shape(output_shape));
+    auto_init_if_empty(*indices->info(), output_shape, 1, DataType::U32);
+
+    _scores  = scores;
+    _values  = values;
+    _indices = indices;
+
+    _k           = k;
+    _num_classes = scores->info()->dimension(0);
+
+    // Each row is selected independently, schedule the batch rows across threads
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, scores->info()->dimension(1), 1));
+    ICPPKernel::configure(win);
+}
+
+Status CPPTopKSelectionKernel::validate(const ITensorInfo *scores, const ITensorInfo *values, const ITensorInfo *indices, const unsigned int k)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(scores, values, indices);
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(scores, values, indices, k));
+    return Status{};
+}
+
+bool CPPTopKSelectionKernel::is_parallelisable() const
+{
+    return true;
+}
+
+void CPPTopKSelectionKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    switch(_scores->info()->data_type())
+    {
+        case DataType::F32:
+            run_topk<float>(window);
+            break;
+        case DataType::F16:
+            run_topk<half>(window);
+            break;
+        case DataType::S32:
+            run_topk<int>(window);
+            break;
+        case DataType::QASYMM8:
+            run_topk<uint8_t>(window);
+            break;
+        case DataType::QASYMM8_SIGNED:
+            run_topk<int8_t>(window);
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Not supported");
+    }
+}
+} // namespace arm_compute
@@ -27,9 +27,11 @@
 #include "arm_compute/core/Utils.h"
 
 #include <fstream>
+#include <functional>
 #include <iomanip>
 #include <iostream>
 #include <regex>
+#include <sstream>
 #include <utility>
 #include <vector>
 
@@ -327,7 +329,7 @@ const std::map<std::string, std::string> GCKernelLibrary::_program_source_map =
 };
 
 GCKernelLibrary::GCKernelLibrary()
-    : _display(EGL_NO_DISPLAY), _context(EGL_NO_CONTEXT), _frame_buffer(0), _tex_rt(0), _shader_path("./"), _programs_map(), _built_programs_map()
+    : _display(EGL_NO_DISPLAY), _context(EGL_NO_CONTEXT), _frame_buffer(0), _tex_rt(0), _shader_path("./"), _binary_cache_path(), _programs_map(), _built_programs_map()
 {
 }
 
@@ -389,15 +391,31 @@ GCKernel GCKernelLibrary::create_kernel(const std::string &shader_name, const St
     }
     else
     {
-        GCProgram program = load_program(program_name);
+        std::string cache_filename;
+        GLuint      gles_program = 0;
+        bool        from_cache   = false;
 
-        std::string source_name = _shader_path + shader_program_it->second;
+        if(!_binary_cache_path.empty())
+        {
+            cache_filename = binary_cache_filename(built_program_name);
+            from_cache     = load_binary_from_cache(cache_filename, gles_program);
+        }
+
+        if(!from_cache)
+        {
+            GCProgram program = load_program(program_name);
 
-        // load shader
-        GLuint shader = program.compile_shader(build_options);
+            // load shader
+            GLuint shader = program.compile_shader(build_options);
 
-        // Build program
-        GLuint gles_program = program.link_program(shader);
+            // Build program
+            gles_program = program.link_program(shader);
+
+            if(!cache_filename.empty())
+            {
+                save_binary_to_cache(cache_filename, gles_program);
+            }
+        }
 
         // Create GCKernel
         kernel = GCKernel(shader_name, gles_program);
@@ -414,6 +432,97 @@ GCKernel GCKernelLibrary::create_kernel(const std::string &shader_name, const St
     return kernel;
 }
 
+void GCKernelLibrary::set_binary_cache_path(std::string path)
+{
+    _binary_cache_path = std::move(path);
+}
+
+const std::string &GCKernelLibrary::binary_cache_path() const
+{
+    return _binary_cache_path;
+}
+
+std::string GCKernelLibrary::binary_cache_filename(const std::string &built_program_name) const
+{
+    // Key the entry on the renderer and the driver as well, so that entries written by a previous
+    // driver are simply never hit again
+    const GLubyte *renderer = ARM_COMPUTE_GL_CHECK(glGetString(GL_RENDERER));
+    const GLubyte *version  = ARM_COMPUTE_GL_CHECK(glGetString(GL_VERSION));
+
+    const std::string device_name    = (renderer != nullptr) ? reinterpret_cast<const char *>(renderer) : "";
+    const std::string driver_version = (version != nullptr) ? reinterpret_cast<const char *>(version) : "";
+    const size_t      key            = std::hash<std::string> {}(device_name + "_" + driver_version + "_" + built_program_name);
+
+    std::stringstream filename;
+    filename << _binary_cache_path << "/acl_gc_" << std::hex << key << ".bin";
+
+    return filename.str();
+}
+
+bool GCKernelLibrary::load_binary_from_cache(const std::string &cache_filename, GLuint &gles_program) const
+{
+    std::ifstream cache_entry(cache_filename, std::ios::binary);
+    if(!cache_entry.is_open())
+    {
+        return false;
+    }
+
+    // The entry starts with the driver-specific binary format followed by the binary itself
+    GLenum binary_format = 0;
+    cache_entry.read(reinterpret_cast<char *>(&binary_format), sizeof(binary_format));
+    std::vector<char> binary((std::istreambuf_iterator<char>(cache_entry)), std::istreambuf_iterator<char>());
+    if(binary.empty())
+    {
+        return false;
+    }
+
+    GLuint program = ARM_COMPUTE_GL_CHECK(glCreateProgram());
+
+    // Not wrapped in ARM_COMPUTE_GL_CHECK: a rejected binary is expected for stale entries and
+    // handled by falling back to compiling from source
+    glProgramBinary(program, binary_format, binary.data(), binary.size());
+
+    GLint rvalue = 0;
+    ARM_COMPUTE_GL_CHECK(glGetProgramiv(program, GL_LINK_STATUS, &rvalue));
+    if(rvalue == 0)
+    {
+        ARM_COMPUTE_GL_CHECK(glDeleteProgram(program));
+        return false;
+    }
+
+    ARM_COMPUTE_GL_CHECK(glUseProgram(program));
+    gles_program = program;
+
+    return true;
+}
+
+void GCKernelLibrary::save_binary_to_cache(const std::string &cache_filename, GLuint gles_program) const
+{
+    GLint binary_length = 0;
+    ARM_COMPUTE_GL_CHECK(glGetProgramiv(gles_program, GL_PROGRAM_BINARY_LENGTH, &binary_length));
+    if(binary_length <= 0)
+    {
+        return;
+    }
+
+    std::vector<char> binary(binary_length);
+    GLenum            binary_format = 0;
+    GLsizei           length        = 0;
+    ARM_COMPUTE_GL_CHECK(glGetProgramBinary(gles_program, binary_length, &length, &binary_format, binary.data()));
+    if(length <= 0)
+    {
+        return;
+    }
+
+    // The cache is best-effort: failing to store an entry only means the shader is recompiled next time
+    std::ofstream cache_entry(cache_filename, std::ios::binary);
+    if(cache_entry.is_open())
+    {
+        cache_entry.write(reinterpret_cast<const char *>(&binary_format), sizeof(binary_format));
+        cache_entry.write(binary.data(), length);
+    }
+}
+
 std::string GCKernelLibrary::preprocess_shader(const std::string &shader_source) const
 {
     enum class ParserStage
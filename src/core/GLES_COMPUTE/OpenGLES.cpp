@@ -60,6 +60,8 @@ using glDeleteBuffers_func           = void GL_APIENTRY (*)(GLsizei n, const GLu
 using glDispatchCompute_func         = void GL_APIENTRY (*)(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z);
 using glFlush_func                   = void      GL_APIENTRY (*)();
 using glGenBuffers_func              = void GL_APIENTRY (*)(GLsizei n, GLuint *buffers);
+using glGetProgramBinary_func        = void GL_APIENTRY (*)(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary);
+using glProgramBinary_func           = void GL_APIENTRY (*)(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length);
 using glGetProgramResourceIndex_func = GLuint GL_APIENTRY (*)(GLuint program, GLenum programInterface, const GLchar *name);
 using glGetUniformLocation_func      = GLint GL_APIENTRY (*)(GLuint program, const GLchar *name);
 using glMapBufferRange_func          = void *GL_APIENTRY (*)(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access);
@@ -422,6 +424,32 @@ void GL_APIENTRY glGetProgramiv(GLuint program, GLenum pname, GLint *params)
     }
 }
 
+void GL_APIENTRY glGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary)
+{
+    auto func = GLESSymbols::get().glGetProgramBinary;
+    if(func != nullptr)
+    {
+        return func(program, bufSize, length, binaryFormat, binary);
+    }
+    else
+    {
+        return;
+    }
+}
+
+void GL_APIENTRY glProgramBinary(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length)
+{
+    auto func = GLESSymbols::get().glProgramBinary;
+    if(func != nullptr)
+    {
+        return func(program, binaryFormat, binary, length);
+    }
+    else
+    {
+        return;
+    }
+}
+
 void GL_APIENTRY glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
 {
     auto func = GLESSymbols::get().glGetShaderInfoLog;
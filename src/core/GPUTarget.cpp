@@ -35,6 +35,10 @@ arm_compute::GPUTarget get_valhall_target(const std::string &version)
     {
         return arm_compute::GPUTarget::G77;
     }
+    else if(version.find("G78") != std::string::npos)
+    {
+        return arm_compute::GPUTarget::G78;
+    }
     else if(version.find("TBOX") != std::string::npos)
     {
         return arm_compute::GPUTarget::TBOX;
@@ -131,6 +135,7 @@ const std::string &string_from_target(GPUTarget target)
         { GPUTarget::G52LIT, "g52lit" },
         { GPUTarget::G76, "g76" },
         { GPUTarget::G77, "g77" },
+        { GPUTarget::G78, "g78" },
         { GPUTarget::TBOX, "tbox" },
         { GPUTarget::TODX, "todx" }
     };
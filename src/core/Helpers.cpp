@@ -23,6 +23,10 @@
  */
 #include "arm_compute/core/Helpers.h"
 
+#include "arm_compute/core/CPP/CPPTypes.h"
+
+#include <cmath>
+
 using namespace arm_compute;
 
 Window arm_compute::calculate_max_window(const ValidRegion &valid_region, const Steps &steps, bool skip_border, BorderSize border_size)
@@ -255,4 +259,37 @@ ValidRegion arm_compute::calculate_valid_region_scale(const ITensorInfo &src_inf
     valid_region.shape.set(idx_height, std::min<size_t>(valid_end_out_y - valid_start_out_y, dst_shape[idx_height]));
 
     return valid_region;
-}
\ No newline at end of file
+}
+WindowTiling arm_compute::calculate_cache_tiling(const Window &window, size_t bytes_per_element, const CPUInfo &cpu_info,
+                                                 size_t inner_dim, size_t outer_dim)
+{
+    WindowTiling tiling{};
+    tiling.inner_dim = inner_dim;
+    tiling.outer_dim = outer_dim;
+
+    if(bytes_per_element == 0)
+    {
+        return tiling;
+    }
+
+    // Target half of each cache level: a square tile is read once and written once,
+    // and the other half is left to streams the tiling does not model
+    const auto tile_side = [bytes_per_element](size_t cache_size)
+    {
+        return static_cast<size_t>(std::sqrt(static_cast<double>(std::max<size_t>(cache_size, 1)) / (2 * bytes_per_element)));
+    };
+
+    const size_t inner_step = std::max<size_t>(window[inner_dim].step(), 1);
+    const size_t outer_step = std::max<size_t>(window[outer_dim].step(), 1);
+
+    const size_t inner_size = ceil_to_multiple(std::max(tile_side(cpu_info.get_L1_cache_size()), inner_step), inner_step);
+    const size_t outer_size = ceil_to_multiple(std::max(tile_side(cpu_info.get_L2_cache_size()), outer_step), outer_step);
+
+    // A tile that already covers the whole dimension adds a loop level for nothing
+    const size_t inner_extent = window[inner_dim].end() - window[inner_dim].start();
+    const size_t outer_extent = window[outer_dim].end() - window[outer_dim].start();
+    tiling.inner_size         = (inner_size < inner_extent) ? inner_size : 0;
+    tiling.outer_size         = (outer_size < outer_extent) ? outer_size : 0;
+
+    return tiling;
+}
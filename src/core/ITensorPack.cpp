@@ -62,4 +62,14 @@ bool ITensorPack::empty() const
 {
     return _pack.empty();
 }
+
+ITensorPack::const_iterator ITensorPack::begin() const
+{
+    return _pack.begin();
+}
+
+ITensorPack::const_iterator ITensorPack::end() const
+{
+    return _pack.end();
+}
 } // namespace arm_compute
\ No newline at end of file
@@ -36,6 +36,10 @@
 #include <arm_neon.h>
 #include <set>
 
+#if defined(__ARM_FEATURE_SVE)
+#include <arm_sve.h>
+#endif /* defined(__ARM_FEATURE_SVE) */
+
 namespace arm_compute
 {
 namespace
@@ -108,10 +112,57 @@ std::pair<Status, Window> validate_and_configure_window(const ITensorInfo *input
 
     return std::make_pair(Status{}, win);
 }
+
+#ifdef __aarch64__
+void init_activation_lut(const ActivationLayerInfo &act_info, const UniformQuantizationInfo &qi_in, const UniformQuantizationInfo &qi_out, bool is_signed, std::array<uint8_t, 256> &lut)
+{
+    const float a = act_info.a();
+    const float b = act_info.b();
+
+    // Map every possible 8-bit input value to its activation result. The table is indexed by the
+    // raw byte pattern so signed and unsigned tensors share the same gather code.
+    for(unsigned int i = 0; i < lut.size(); ++i)
+    {
+        const float x = is_signed ? dequantize_qasymm8_signed(static_cast<qasymm8_signed_t>(i), qi_in) : dequantize_qasymm8(static_cast<qasymm8_t>(i), qi_in);
+        float       fx = 0.f;
+        switch(act_info.activation())
+        {
+            case ActivationLayerInfo::ActivationFunction::RELU:
+                fx = std::max(0.f, x);
+                break;
+            case ActivationLayerInfo::ActivationFunction::BOUNDED_RELU:
+                fx = std::min(a, std::max(0.f, x));
+                break;
+            case ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU:
+                fx = std::min(a, std::max(b, x));
+                break;
+            case ActivationLayerInfo::ActivationFunction::LOGISTIC:
+                fx = 1.f / (1.f + std::exp(-x));
+                break;
+            case ActivationLayerInfo::ActivationFunction::TANH:
+                fx = a * std::tanh(b * x);
+                break;
+            case ActivationLayerInfo::ActivationFunction::HARD_SWISH:
+                fx = x * ((std::min(std::max((x + 3.f), 0.0f), 6.0f)) * 0.166666667f);
+                break;
+            case ActivationLayerInfo::ActivationFunction::IDENTITY:
+                fx = x;
+                break;
+            default:
+                ARM_COMPUTE_ERROR("Unsupported activation function");
+        }
+        lut[i] = is_signed ? static_cast<uint8_t>(quantize_qasymm8_signed(fx, qi_out)) : quantize_qasymm8(fx, qi_out);
+    }
+}
+#endif /* __aarch64__ */
 } // namespace
 
 NEActivationLayerKernel::NEActivationLayerKernel()
-    : _func(nullptr), _act_info()
+#if defined(__ARM_FEATURE_SVE)
+    : _func(nullptr), _func_sve(nullptr), _act_info(), _lut()
+#else  /* defined(__ARM_FEATURE_SVE) */
+    : _func(nullptr), _act_info(), _lut()
+#endif /* defined(__ARM_FEATURE_SVE) */
 {
 }
 
@@ -129,109 +180,200 @@ void NEActivationLayerKernel::configure(const ITensorInfo *input, ITensorInfo *o
 
     ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input, output, activation_info));
 
+    // Configure kernel window. This also auto-initializes the output so that its
+    // quantization info is available when building the quantized lookup tables below.
+    auto win_config = validate_and_configure_window(input, output);
+    ARM_COMPUTE_ERROR_THROW_ON(win_config.first);
+    ICPPKernel::configure(win_config.second);
+
+    // The dispatch tables are indexed by the dense ActivationFunction enumeration and hold the
+    // compile-time specialized instantiation for each (activation, type) pair; combinations the
+    // data type does not support stay nullptr and are rejected by the validation above
+
     // Activation functions : FP32
-    static std::map<ActivationFunction, ActivationFunctionExecutorPtr> act_map_f32 =
+    static constexpr ActivationFunctionExecutorPtr act_table_f32[] =
     {
-        { ActivationFunction::ABS, &NEActivationLayerKernel::activation<ActivationFunction::ABS, float> },
-        { ActivationFunction::LINEAR, &NEActivationLayerKernel::activation<ActivationFunction::LINEAR, float> },
-        { ActivationFunction::LOGISTIC, &NEActivationLayerKernel::activation<ActivationFunction::LOGISTIC, float> },
-        { ActivationFunction::RELU, &NEActivationLayerKernel::activation<ActivationFunction::RELU, float> },
-        { ActivationFunction::BOUNDED_RELU, &NEActivationLayerKernel::activation<ActivationFunction::BOUNDED_RELU, float> },
-        { ActivationFunction::LU_BOUNDED_RELU, &NEActivationLayerKernel::activation<ActivationFunction::LU_BOUNDED_RELU, float> },
-        { ActivationFunction::LEAKY_RELU, &NEActivationLayerKernel::activation<ActivationFunction::LEAKY_RELU, float> },
-        { ActivationFunction::SOFT_RELU, &NEActivationLayerKernel::activation<ActivationFunction::SOFT_RELU, float> },
-        { ActivationFunction::ELU, &NEActivationLayerKernel::activation<ActivationFunction::ELU, float> },
-        { ActivationFunction::SQRT, &NEActivationLayerKernel::activation<ActivationFunction::SQRT, float> },
-        { ActivationFunction::SQUARE, &NEActivationLayerKernel::activation<ActivationFunction::SQUARE, float> },
-        { ActivationFunction::TANH, &NEActivationLayerKernel::activation<ActivationFunction::TANH, float> },
-        { ActivationFunction::IDENTITY, &NEActivationLayerKernel::activation<ActivationFunction::IDENTITY, float> },
-        { ActivationFunction::HARD_SWISH, &NEActivationLayerKernel::activation<ActivationFunction::HARD_SWISH, float> },
+        &NEActivationLayerKernel::activation<ActivationFunction::LOGISTIC, float>,        /* LOGISTIC */
+        &NEActivationLayerKernel::activation<ActivationFunction::TANH, float>,            /* TANH */
+        &NEActivationLayerKernel::activation<ActivationFunction::RELU, float>,            /* RELU */
+        &NEActivationLayerKernel::activation<ActivationFunction::BOUNDED_RELU, float>,    /* BOUNDED_RELU */
+        &NEActivationLayerKernel::activation<ActivationFunction::LU_BOUNDED_RELU, float>, /* LU_BOUNDED_RELU */
+        &NEActivationLayerKernel::activation<ActivationFunction::LEAKY_RELU, float>,      /* LEAKY_RELU */
+        &NEActivationLayerKernel::activation<ActivationFunction::SOFT_RELU, float>,       /* SOFT_RELU */
+        &NEActivationLayerKernel::activation<ActivationFunction::ELU, float>,             /* ELU */
+        &NEActivationLayerKernel::activation<ActivationFunction::ABS, float>,             /* ABS */
+        &NEActivationLayerKernel::activation<ActivationFunction::SQUARE, float>,          /* SQUARE */
+        &NEActivationLayerKernel::activation<ActivationFunction::SQRT, float>,            /* SQRT */
+        &NEActivationLayerKernel::activation<ActivationFunction::LINEAR, float>,          /* LINEAR */
+        &NEActivationLayerKernel::activation<ActivationFunction::IDENTITY, float>,        /* IDENTITY */
+        &NEActivationLayerKernel::activation<ActivationFunction::HARD_SWISH, float>,      /* HARD_SWISH */
+    };
 
+#if defined(__ARM_FEATURE_SVE)
+    // Activation functions : FP32, scalable vectors. Only the non-transcendental activations have
+    // an SVE variant; the rest stay nullptr so run_op() keeps the NEON path with its table-based
+    // polynomial approximations.
+    static constexpr ActivationFunctionExecutorPtr act_table_f32_sve[] =
+    {
+        nullptr,                                                                       /* LOGISTIC */
+        nullptr,                                                                       /* TANH */
+        &NEActivationLayerKernel::activation_sve<ActivationFunction::RELU>,            /* RELU */
+        &NEActivationLayerKernel::activation_sve<ActivationFunction::BOUNDED_RELU>,    /* BOUNDED_RELU */
+        &NEActivationLayerKernel::activation_sve<ActivationFunction::LU_BOUNDED_RELU>, /* LU_BOUNDED_RELU */
+        &NEActivationLayerKernel::activation_sve<ActivationFunction::LEAKY_RELU>,      /* LEAKY_RELU */
+        nullptr,                                                                       /* SOFT_RELU */
+        nullptr,                                                                       /* ELU */
+        &NEActivationLayerKernel::activation_sve<ActivationFunction::ABS>,             /* ABS */
+        &NEActivationLayerKernel::activation_sve<ActivationFunction::SQUARE>,          /* SQUARE */
+        &NEActivationLayerKernel::activation_sve<ActivationFunction::SQRT>,            /* SQRT */
+        &NEActivationLayerKernel::activation_sve<ActivationFunction::LINEAR>,          /* LINEAR */
+        &NEActivationLayerKernel::activation_sve<ActivationFunction::IDENTITY>,        /* IDENTITY */
+        &NEActivationLayerKernel::activation_sve<ActivationFunction::HARD_SWISH>,      /* HARD_SWISH */
     };
+#endif /* defined(__ARM_FEATURE_SVE) */
 
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
     // Activation functions : FP16
-    static std::map<ActivationFunction, ActivationFunctionExecutorPtr> act_map_f16 =
+    static constexpr ActivationFunctionExecutorPtr act_table_f16[] =
     {
-        { ActivationFunction::ABS, &NEActivationLayerKernel::activation<ActivationFunction::ABS, float16_t> },
-        { ActivationFunction::LINEAR, &NEActivationLayerKernel::activation<ActivationFunction::LINEAR, float16_t> },
-        { ActivationFunction::LOGISTIC, &NEActivationLayerKernel::activation<ActivationFunction::LOGISTIC, float16_t> },
-        { ActivationFunction::RELU, &NEActivationLayerKernel::activation<ActivationFunction::RELU, float16_t> },
-        { ActivationFunction::BOUNDED_RELU, &NEActivationLayerKernel::activation<ActivationFunction::BOUNDED_RELU, float16_t> },
-        { ActivationFunction::LU_BOUNDED_RELU, &NEActivationLayerKernel::activation<ActivationFunction::LU_BOUNDED_RELU, float16_t> },
-        { ActivationFunction::LEAKY_RELU, &NEActivationLayerKernel::activation<ActivationFunction::LEAKY_RELU, float16_t> },
-        { ActivationFunction::SOFT_RELU, &NEActivationLayerKernel::activation<ActivationFunction::SOFT_RELU, float16_t> },
-        { ActivationFunction::ELU, &NEActivationLayerKernel::activation<ActivationFunction::ELU, float16_t> },
-        { ActivationFunction::SQRT, &NEActivationLayerKernel::activation<ActivationFunction::SQRT, float16_t> },
-        { ActivationFunction::SQUARE, &NEActivationLayerKernel::activation<ActivationFunction::SQUARE, float16_t> },
-        { ActivationFunction::TANH, &NEActivationLayerKernel::activation<ActivationFunction::TANH, float16_t> },
-        { ActivationFunction::IDENTITY, &NEActivationLayerKernel::activation<ActivationFunction::IDENTITY, float16_t> },
-        { ActivationFunction::HARD_SWISH, &NEActivationLayerKernel::activation<ActivationFunction::HARD_SWISH, float16_t> },
-
+        &NEActivationLayerKernel::activation<ActivationFunction::LOGISTIC, float16_t>,        /* LOGISTIC */
+        &NEActivationLayerKernel::activation<ActivationFunction::TANH, float16_t>,            /* TANH */
+        &NEActivationLayerKernel::activation<ActivationFunction::RELU, float16_t>,            /* RELU */
+        &NEActivationLayerKernel::activation<ActivationFunction::BOUNDED_RELU, float16_t>,    /* BOUNDED_RELU */
+        &NEActivationLayerKernel::activation<ActivationFunction::LU_BOUNDED_RELU, float16_t>, /* LU_BOUNDED_RELU */
+        &NEActivationLayerKernel::activation<ActivationFunction::LEAKY_RELU, float16_t>,      /* LEAKY_RELU */
+        &NEActivationLayerKernel::activation<ActivationFunction::SOFT_RELU, float16_t>,       /* SOFT_RELU */
+        &NEActivationLayerKernel::activation<ActivationFunction::ELU, float16_t>,             /* ELU */
+        &NEActivationLayerKernel::activation<ActivationFunction::ABS, float16_t>,             /* ABS */
+        &NEActivationLayerKernel::activation<ActivationFunction::SQUARE, float16_t>,          /* SQUARE */
+        &NEActivationLayerKernel::activation<ActivationFunction::SQRT, float16_t>,            /* SQRT */
+        &NEActivationLayerKernel::activation<ActivationFunction::LINEAR, float16_t>,          /* LINEAR */
+        &NEActivationLayerKernel::activation<ActivationFunction::IDENTITY, float16_t>,        /* IDENTITY */
+        &NEActivationLayerKernel::activation<ActivationFunction::HARD_SWISH, float16_t>,      /* HARD_SWISH */
     };
 #endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC*/
 
+#ifndef __aarch64__
     // Activation functions : QASYMM8_SIGNED
-    static std::map<ActivationFunction, ActivationFunctionExecutorPtr> act_map_qasymm8_signed =
+    static constexpr ActivationFunctionExecutorPtr act_table_qasymm8_signed[] =
     {
-        { ActivationFunction::LOGISTIC, &NEActivationLayerKernel::activation<ActivationFunction::LOGISTIC, qasymm8_signed_t> },
-        { ActivationFunction::BOUNDED_RELU, &NEActivationLayerKernel::activation<ActivationFunction::BOUNDED_RELU, qasymm8_signed_t> },
-        { ActivationFunction::LU_BOUNDED_RELU, &NEActivationLayerKernel::activation<ActivationFunction::LU_BOUNDED_RELU, qasymm8_signed_t> },
-        { ActivationFunction::RELU, &NEActivationLayerKernel::activation<ActivationFunction::RELU, qasymm8_signed_t> },
-        { ActivationFunction::TANH, &NEActivationLayerKernel::activation<ActivationFunction::TANH, qasymm8_signed_t> },
-        { ActivationFunction::IDENTITY, &NEActivationLayerKernel::activation<ActivationFunction::IDENTITY, qasymm8_signed_t> },
-        { ActivationFunction::HARD_SWISH, &NEActivationLayerKernel::activation<ActivationFunction::HARD_SWISH, qasymm8_signed_t> },
-
+        &NEActivationLayerKernel::activation<ActivationFunction::LOGISTIC, qasymm8_signed_t>,        /* LOGISTIC */
+        &NEActivationLayerKernel::activation<ActivationFunction::TANH, qasymm8_signed_t>,            /* TANH */
+        &NEActivationLayerKernel::activation<ActivationFunction::RELU, qasymm8_signed_t>,            /* RELU */
+        &NEActivationLayerKernel::activation<ActivationFunction::BOUNDED_RELU, qasymm8_signed_t>,    /* BOUNDED_RELU */
+        &NEActivationLayerKernel::activation<ActivationFunction::LU_BOUNDED_RELU, qasymm8_signed_t>, /* LU_BOUNDED_RELU */
+        nullptr,                                                                                     /* LEAKY_RELU */
+        nullptr,                                                                                     /* SOFT_RELU */
+        nullptr,                                                                                     /* ELU */
+        nullptr,                                                                                     /* ABS */
+        nullptr,                                                                                     /* SQUARE */
+        nullptr,                                                                                     /* SQRT */
+        nullptr,                                                                                     /* LINEAR */
+        &NEActivationLayerKernel::activation<ActivationFunction::IDENTITY, qasymm8_signed_t>,        /* IDENTITY */
+        &NEActivationLayerKernel::activation<ActivationFunction::HARD_SWISH, qasymm8_signed_t>,      /* HARD_SWISH */
     };
 
     // Activation functions : QASYMM8
-    static std::map<ActivationFunction, ActivationFunctionExecutorPtr> act_map_qasymm8 =
+    static constexpr ActivationFunctionExecutorPtr act_table_qasymm8[] =
     {
-        { ActivationFunction::LOGISTIC, &NEActivationLayerKernel::activation<ActivationFunction::LOGISTIC, qasymm8_t> },
-        { ActivationFunction::BOUNDED_RELU, &NEActivationLayerKernel::activation<ActivationFunction::BOUNDED_RELU, qasymm8_t> },
-        { ActivationFunction::LU_BOUNDED_RELU, &NEActivationLayerKernel::activation<ActivationFunction::LU_BOUNDED_RELU, qasymm8_t> },
-        { ActivationFunction::RELU, &NEActivationLayerKernel::activation<ActivationFunction::RELU, qasymm8_t> },
-        { ActivationFunction::TANH, &NEActivationLayerKernel::activation<ActivationFunction::TANH, qasymm8_t> },
-        { ActivationFunction::IDENTITY, &NEActivationLayerKernel::activation<ActivationFunction::IDENTITY, qasymm8_t> },
-        { ActivationFunction::HARD_SWISH, &NEActivationLayerKernel::activation<ActivationFunction::HARD_SWISH, qasymm8_t> },
-
+        &NEActivationLayerKernel::activation<ActivationFunction::LOGISTIC, qasymm8_t>,        /* LOGISTIC */
+        &NEActivationLayerKernel::activation<ActivationFunction::TANH, qasymm8_t>,            /* TANH */
+        &NEActivationLayerKernel::activation<ActivationFunction::RELU, qasymm8_t>,            /* RELU */
+        &NEActivationLayerKernel::activation<ActivationFunction::BOUNDED_RELU, qasymm8_t>,    /* BOUNDED_RELU */
+        &NEActivationLayerKernel::activation<ActivationFunction::LU_BOUNDED_RELU, qasymm8_t>, /* LU_BOUNDED_RELU */
+        nullptr,                                                                              /* LEAKY_RELU */
+        nullptr,                                                                              /* SOFT_RELU */
+        nullptr,                                                                              /* ELU */
+        nullptr,                                                                              /* ABS */
+        nullptr,                                                                              /* SQUARE */
+        nullptr,                                                                              /* SQRT */
+        nullptr,                                                                              /* LINEAR */
+        &NEActivationLayerKernel::activation<ActivationFunction::IDENTITY, qasymm8_t>,        /* IDENTITY */
+        &NEActivationLayerKernel::activation<ActivationFunction::HARD_SWISH, qasymm8_t>,      /* HARD_SWISH */
     };
+#endif /* __aarch64__ */
 
     // Activation functions : QSYMM16
-    static std::map<ActivationFunction, ActivationFunctionExecutorPtr> act_map_qsymm16 =
+    static constexpr ActivationFunctionExecutorPtr act_table_qsymm16[] =
     {
-        { ActivationFunction::LOGISTIC, &NEActivationLayerKernel::activation<ActivationFunction::LOGISTIC, qsymm16_t> },
-        { ActivationFunction::TANH, &NEActivationLayerKernel::activation<ActivationFunction::TANH, qsymm16_t> },
-
+        &NEActivationLayerKernel::activation<ActivationFunction::LOGISTIC, qsymm16_t>, /* LOGISTIC */
+        &NEActivationLayerKernel::activation<ActivationFunction::TANH, qsymm16_t>,     /* TANH */
+        nullptr,                                                                       /* RELU */
+        nullptr,                                                                       /* BOUNDED_RELU */
+        nullptr,                                                                       /* LU_BOUNDED_RELU */
+        nullptr,                                                                       /* LEAKY_RELU */
+        nullptr,                                                                       /* SOFT_RELU */
+        nullptr,                                                                       /* ELU */
+        nullptr,                                                                       /* ABS */
+        nullptr,                                                                       /* SQUARE */
+        nullptr,                                                                       /* SQRT */
+        nullptr,                                                                       /* LINEAR */
+        nullptr,                                                                       /* IDENTITY */
+        nullptr,                                                                       /* HARD_SWISH */
     };
 
+    const auto act_idx = static_cast<size_t>(activation_info.activation());
+
     switch(input->data_type())
     {
+#ifdef __aarch64__
+        case DataType::QASYMM8_SIGNED:
+        case DataType::QASYMM8:
+            if(activation_info.enabled())
+            {
+                const QuantizationInfo &oq_info = (output != nullptr) ? output->quantization_info() : input->quantization_info();
+                init_activation_lut(activation_info, input->quantization_info().uniform(), oq_info.uniform(), input->data_type() == DataType::QASYMM8_SIGNED, _lut);
+            }
+            _func = &NEActivationLayerKernel::activation_lut;
+            break;
+#else  /* __aarch64__ */
         case DataType::QASYMM8_SIGNED:
-            _func = act_map_qasymm8_signed[activation_info.activation()];
+            _func = act_table_qasymm8_signed[act_idx];
             break;
         case DataType::QASYMM8:
-            _func = act_map_qasymm8[activation_info.activation()];
+            _func = act_table_qasymm8[act_idx];
             break;
+#endif /* __aarch64__ */
         case DataType::QSYMM16:
-            _func = act_map_qsymm16[activation_info.activation()];
+            _func = act_table_qsymm16[act_idx];
             break;
         case DataType::F32:
-            _func = act_map_f32[activation_info.activation()];
+            _func = act_table_f32[act_idx];
+#if defined(__ARM_FEATURE_SVE)
+            _func_sve = act_table_f32_sve[act_idx];
+#endif /* defined(__ARM_FEATURE_SVE) */
+            // The exponential-bound activations can trade the table-based polynomial of
+            // the transcendentals for the reduced-precision variants when the layer has
+            // opted into fast math; the other activations have no approximation to relax.
+            if(activation_info.fast_math())
+            {
+                switch(activation_info.activation())
+                {
+                    case ActivationFunction::LOGISTIC:
+                        _func = &NEActivationLayerKernel::activation_fast<ActivationFunction::LOGISTIC, float>;
+                        break;
+                    case ActivationFunction::TANH:
+                        _func = &NEActivationLayerKernel::activation_fast<ActivationFunction::TANH, float>;
+                        break;
+                    case ActivationFunction::SOFT_RELU:
+                        _func = &NEActivationLayerKernel::activation_fast<ActivationFunction::SOFT_RELU, float>;
+                        break;
+                    case ActivationFunction::ELU:
+                        _func = &NEActivationLayerKernel::activation_fast<ActivationFunction::ELU, float>;
+                        break;
+                    default:
+                        break;
+                }
+            }
             break;
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
         case DataType::F16:
-            _func = act_map_f16[activation_info.activation()];
+            _func = act_table_f16[act_idx];
             break;
 #endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
         default:
             ARM_COMPUTE_ERROR("Unsupported data type.");
     }
-
-    // Configure kernel window
-    auto win_config = validate_and_configure_window(input, output);
-    ARM_COMPUTE_ERROR_THROW_ON(win_config.first);
-    ICPPKernel::configure(win_config.second);
 }
 
 template <ActivationLayerInfo::ActivationFunction F, typename T>
@@ -388,6 +530,167 @@ NEActivationLayerKernel::activation(const ITensor *src, ITensor *dst, const Wind
     input, output);
 }
 
+template <ActivationLayerInfo::ActivationFunction F, typename T>
+typename std::enable_if<std::is_same<T, float>::value, void>::type
+NEActivationLayerKernel::activation_fast(const ITensor *src, ITensor *dst, const Window &window)
+{
+    constexpr int  window_step_x  = 4;
+    const auto     window_start_x = static_cast<int>(window.x().start());
+    const auto     window_end_x   = static_cast<int>(window.x().end());
+
+    Window win_collapsed = window.collapse_if_possible(window, Window::DimZ);
+    win_collapsed.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator input(src, win_collapsed);
+    Iterator output(dst, win_collapsed);
+
+    const float32x4_t const_0 = vdupq_n_f32(0.f);
+    const float32x4_t const_1 = vdupq_n_f32(1.f);
+    const float32x4_t va      = vdupq_n_f32(_act_info.a());
+    const float32x4_t vb      = vdupq_n_f32(_act_info.b());
+    const float       a       = _act_info.a();
+    const float       b       = _act_info.b();
+    execute_window_loop(win_collapsed, [&](const Coordinates &)
+    {
+        const auto input_ptr  = reinterpret_cast<const float *>(input.ptr());
+        const auto output_ptr = reinterpret_cast<float *>(output.ptr());
+
+        float32x4_t tmp;
+
+        // Compute S elements per iteration
+        int x = window_start_x;
+        for(; x <= (window_end_x - window_step_x); x += window_step_x)
+        {
+            const float32x4_t vin = vld1q_f32(input_ptr + x);
+            switch(F)
+            {
+                case ActivationFunction::LOGISTIC:
+                    tmp = vinvq_f32(vaddq_f32(const_1, vexpq_fast_f32(vnegq_f32(vin))));
+                    break;
+                case ActivationFunction::TANH:
+                    tmp = vmulq_f32(va, vtanhq_fast_f32(vmulq_f32(vb, vin)));
+                    break;
+                case ActivationFunction::SOFT_RELU:
+                    tmp = vlogq_f32(vaddq_f32(const_1, vexpq_fast_f32(vin)));
+                    break;
+                case ActivationFunction::ELU:
+                    tmp = vbslq_f32(vcgeq_f32(vin, const_0), vin, vmulq_f32(va, vsubq_f32(vexpq_fast_f32(vin), const_1)));
+                    break;
+                default:
+                    ARM_COMPUTE_ERROR("Unsupported fast math activation function");
+            }
+            vst1q_f32(output_ptr + x, tmp);
+        }
+
+        // Compute left-over elements at full precision; the tail is too short to matter
+        for(; x < window_end_x; ++x)
+        {
+            const float in = *(input_ptr + x);
+            float       res;
+            switch(F)
+            {
+                case ActivationFunction::LOGISTIC:
+                    res = 1.f / (1.f + std::exp(-in));
+                    break;
+                case ActivationFunction::TANH:
+                    res = a * std::tanh(b * in);
+                    break;
+                case ActivationFunction::SOFT_RELU:
+                    res = std::log(1.f + std::exp(in));
+                    break;
+                case ActivationFunction::ELU:
+                    res = (in >= 0) ? in : a * (std::exp(in) - 1);
+                    break;
+                default:
+                    ARM_COMPUTE_ERROR("Unsupported fast math activation function");
+            }
+            *(output_ptr + x) = res;
+        }
+    },
+    input, output);
+}
+
+#if defined(__ARM_FEATURE_SVE)
+template <ActivationLayerInfo::ActivationFunction F>
+void NEActivationLayerKernel::activation_sve(const ITensor *src, ITensor *dst, const Window &window)
+{
+    const auto window_start_x = static_cast<int64_t>(window.x().start());
+    const auto window_end_x   = static_cast<int64_t>(window.x().end());
+
+    Window win_collapsed = window.collapse_if_possible(window, Window::DimZ);
+    win_collapsed.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator input(src, win_collapsed);
+    Iterator output(dst, win_collapsed);
+
+    // A small delta added to the input to prevent NAN values caused by zeros in inputs to SQRT
+    const svfloat32_t delta       = svdup_n_f32(1e-24f);
+    const svfloat32_t const_0     = svdup_n_f32(0.f);
+    const svfloat32_t const_6     = svdup_n_f32(6.f);
+    const svfloat32_t const_3     = svdup_n_f32(3.f);
+    const svfloat32_t const_inv_6 = svdup_n_f32(0.166666667f);
+
+    const svfloat32_t va = svdup_n_f32(_act_info.a());
+    const svfloat32_t vb = svdup_n_f32(_act_info.b());
+    execute_window_loop(win_collapsed, [&](const Coordinates &)
+    {
+        const auto input_ptr  = reinterpret_cast<const float *>(input.ptr());
+        const auto output_ptr = reinterpret_cast<float *>(output.ptr());
+
+        // Vector-length agnostic loop: the governing predicate absorbs the row tail,
+        // so there is no leftover scalar loop
+        int64_t  x  = window_start_x;
+        svbool_t pg = svwhilelt_b32(x, window_end_x);
+        do
+        {
+            const svfloat32_t vin = svld1_f32(pg, input_ptr + x);
+            svfloat32_t       tmp;
+            switch(F)
+            {
+                case ActivationFunction::ABS:
+                    tmp = svabs_f32_z(pg, vin);
+                    break;
+                case ActivationFunction::LINEAR:
+                    tmp = svmla_f32_z(pg, vb, va, vin);
+                    break;
+                case ActivationFunction::RELU:
+                    tmp = svmax_f32_z(pg, const_0, vin);
+                    break;
+                case ActivationFunction::BOUNDED_RELU:
+                    tmp = svmin_f32_z(pg, va, svmax_f32_z(pg, const_0, vin));
+                    break;
+                case ActivationFunction::LU_BOUNDED_RELU:
+                    tmp = svmin_f32_z(pg, va, svmax_f32_z(pg, vb, vin));
+                    break;
+                case ActivationFunction::LEAKY_RELU:
+                    tmp = svsel_f32(svcmpgt_f32(pg, vin, const_0), vin, svmul_f32_z(pg, va, vin));
+                    break;
+                case ActivationFunction::SQRT:
+                    tmp = svsqrt_f32_z(pg, svadd_f32_z(pg, vin, delta));
+                    break;
+                case ActivationFunction::SQUARE:
+                    tmp = svmul_f32_z(pg, vin, vin);
+                    break;
+                case ActivationFunction::IDENTITY:
+                    tmp = vin;
+                    break;
+                case ActivationFunction::HARD_SWISH:
+                    tmp = svmul_f32_z(pg, vin, svmul_f32_z(pg, const_inv_6, svmin_f32_z(pg, const_6, svmax_f32_z(pg, const_0, svadd_f32_z(pg, vin, const_3)))));
+                    break;
+                default:
+                    ARM_COMPUTE_ERROR("Unsupported activation function");
+            }
+            svst1_f32(pg, output_ptr + x, tmp);
+
+            x += svcntw();
+            pg = svwhilelt_b32(x, window_end_x);
+        }
+        while(svptest_any(svptrue_b32(), pg));
+    },
+    input, output);
+}
+#endif /* defined(__ARM_FEATURE_SVE) */
+
 template <ActivationLayerInfo::ActivationFunction F, typename T>
 typename std::enable_if<std::is_same<T, qasymm8_t>::value, void>::type NEActivationLayerKernel::activation(const ITensor *src, ITensor *dst, const Window &window)
 {
@@ -841,6 +1144,62 @@ typename std::enable_if<std::is_same<T, qsymm16_t>::value, void>::type NEActivat
     input, output);
 }
 
+void NEActivationLayerKernel::activation_lut(const ITensor *src, ITensor *dst, const Window &window)
+{
+    const int  window_step_x  = 16;
+    const auto window_start_x = static_cast<int>(window.x().start());
+    const auto window_end_x   = static_cast<int>(window.x().end());
+
+    Window win_collapsed = window.collapse_if_possible(window, Window::DimZ);
+    win_collapsed.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator input(src, win_collapsed);
+    Iterator output(dst, win_collapsed);
+
+    const uint8_t *lut = _lut.data();
+
+#ifdef __aarch64__
+    // Split the 256-entry table into four 64-byte TBL tables
+    const uint8x16x4_t lut0 = { { vld1q_u8(lut + 0), vld1q_u8(lut + 16), vld1q_u8(lut + 32), vld1q_u8(lut + 48) } };
+    const uint8x16x4_t lut1 = { { vld1q_u8(lut + 64), vld1q_u8(lut + 80), vld1q_u8(lut + 96), vld1q_u8(lut + 112) } };
+    const uint8x16x4_t lut2 = { { vld1q_u8(lut + 128), vld1q_u8(lut + 144), vld1q_u8(lut + 160), vld1q_u8(lut + 176) } };
+    const uint8x16x4_t lut3 = { { vld1q_u8(lut + 192), vld1q_u8(lut + 208), vld1q_u8(lut + 224), vld1q_u8(lut + 240) } };
+    const uint8x16_t   voffset = vdupq_n_u8(64);
+#else  /* __aarch64__ */
+    ARM_COMPUTE_UNUSED(window_step_x);
+#endif /* __aarch64__ */
+
+    execute_window_loop(win_collapsed, [&](const Coordinates &)
+    {
+        const auto input_ptr  = reinterpret_cast<const uint8_t *>(input.ptr());
+        const auto output_ptr = reinterpret_cast<uint8_t *>(output.ptr());
+
+        int x = window_start_x;
+#ifdef __aarch64__
+        // Gather 16 results per iteration; out-of-range TBX lanes keep the previous table's result
+        for(; x <= (window_end_x - window_step_x); x += window_step_x)
+        {
+            uint8x16_t idx = vld1q_u8(input_ptr + x);
+            uint8x16_t out = vqtbl4q_u8(lut0, idx);
+            idx            = vsubq_u8(idx, voffset);
+            out            = vqtbx4q_u8(out, lut1, idx);
+            idx            = vsubq_u8(idx, voffset);
+            out            = vqtbx4q_u8(out, lut2, idx);
+            idx            = vsubq_u8(idx, voffset);
+            out            = vqtbx4q_u8(out, lut3, idx);
+            vst1q_u8(output_ptr + x, out);
+        }
+#endif /* __aarch64__ */
+
+        // Compute left-over elements
+        for(; x < window_end_x; ++x)
+        {
+            output_ptr[x] = lut[input_ptr[x]];
+        }
+    },
+    input, output);
+}
+
 Status NEActivationLayerKernel::validate(const ITensorInfo *input, const ITensorInfo *output, const ActivationLayerInfo &act_info)
 {
     ARM_COMPUTE_UNUSED(act_info);
@@ -865,8 +1224,17 @@ void NEActivationLayerKernel::run_op(ITensorPack &tensors, const Window &window,
 
     ARM_COMPUTE_ERROR_ON(tensors.empty());
 
-    (this->*_func)(tensors.get_const_tensor(TensorType::ACL_SRC),
-                   tensors.get_tensor(TensorType::ACL_DST),
-                   window);
+    ActivationFunctionExecutorPtr func = _func;
+#if defined(__ARM_FEATURE_SVE)
+    // Prefer the scalable-vector variant when the core implements SVE
+    if(_func_sve != nullptr && info.cpu_info != nullptr && info.cpu_info->has_sve())
+    {
+        func = _func_sve;
+    }
+#endif /* defined(__ARM_FEATURE_SVE) */
+
+    (this->*func)(tensors.get_const_tensor(TensorType::ACL_SRC),
+                  tensors.get_tensor(TensorType::ACL_DST),
+                  window);
 }
 } // namespace arm_compute
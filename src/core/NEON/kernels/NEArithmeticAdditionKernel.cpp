@@ -27,12 +27,19 @@
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/NESymm.h"
 #include "arm_compute/core/NEON/wrapper/wrapper.h"
 #include "arm_compute/core/Validate.h"
+#include "arm_compute/core/utils/misc/Utility.h"
+#include "arm_compute/core/utils/quantization/AsymmHelpers.h"
 
 #include <map>
 #include <string>
 
+#if defined(__ARM_FEATURE_SVE)
+#include <arm_sve.h>
+#endif /* defined(__ARM_FEATURE_SVE) */
+
 namespace arm_compute
 {
 namespace
@@ -135,6 +142,93 @@ void add_same(const ITensor *in1, const ITensor *in2, ITensor *out, const Conver
     }
 }
 
+#if defined(__ARM_FEATURE_SVE)
+void add_same_sve_f32(const ITensor *in1, const ITensor *in2, ITensor *out, const ConvertPolicy policy, const Window &window)
+{
+    ARM_COMPUTE_UNUSED(policy); // Floating-point addition does not saturate
+
+    // Create input windows
+    Window input1_win = window.broadcast_if_dimension_le_one(in1->info()->tensor_shape());
+    Window input2_win = window.broadcast_if_dimension_le_one(in2->info()->tensor_shape());
+
+    // Clear X Dimension on execution window as we handle manually
+    Window win = window;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    const auto window_start_x        = static_cast<int64_t>(window.x().start());
+    const auto window_end_x          = static_cast<int64_t>(window.x().end());
+    const bool is_broadcast_across_x = (input1_win.x().step() == 0) || (input2_win.x().step() == 0);
+
+    if(is_broadcast_across_x)
+    {
+        const bool     is_broadcast_input_2 = input2_win.x().step() == 0;
+        Window         broadcast_win        = is_broadcast_input_2 ? input2_win : input1_win;
+        Window         non_broadcast_win    = !is_broadcast_input_2 ? input2_win : input1_win;
+        const ITensor *broadcast_tensor     = is_broadcast_input_2 ? in2 : in1;
+        const ITensor *non_broadcast_tensor = !is_broadcast_input_2 ? in2 : in1;
+
+        // Clear X Dimension on execution window as we handle manually
+        non_broadcast_win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+        Iterator broadcast_input(broadcast_tensor, broadcast_win);
+        Iterator non_broadcast_input(non_broadcast_tensor, non_broadcast_win);
+        Iterator output(out, win);
+
+        execute_window_loop(win, [&](const Coordinates &)
+        {
+            const auto non_broadcast_input_ptr = reinterpret_cast<const float *>(non_broadcast_input.ptr());
+            const auto output_ptr              = reinterpret_cast<float *>(output.ptr());
+
+            const svfloat32_t broadcast_value_vec = svdup_n_f32(*reinterpret_cast<const float *>(broadcast_input.ptr()));
+
+            // Vector-length agnostic loop: the governing predicate absorbs the row tail,
+            // so there is no leftover scalar loop
+            int64_t  x  = window_start_x;
+            svbool_t pg = svwhilelt_b32(x, window_end_x);
+            do
+            {
+                const svfloat32_t non_broadcast_v = svld1_f32(pg, non_broadcast_input_ptr + x);
+                svst1_f32(pg, output_ptr + x, svadd_f32_z(pg, broadcast_value_vec, non_broadcast_v));
+                x += svcntw();
+                pg = svwhilelt_b32(x, window_end_x);
+            }
+            while(svptest_any(svptrue_b32(), pg));
+        },
+        broadcast_input, non_broadcast_input, output);
+    }
+    else
+    {
+        // Clear X Dimension on execution window as we handle manually
+        input1_win.set(Window::DimX, Window::Dimension(0, 1, 1));
+        input2_win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+        Iterator input1(in1, input1_win);
+        Iterator input2(in2, input2_win);
+        Iterator output(out, win);
+
+        execute_window_loop(win, [&](const Coordinates &)
+        {
+            const auto input1_ptr = reinterpret_cast<const float *>(input1.ptr());
+            const auto input2_ptr = reinterpret_cast<const float *>(input2.ptr());
+            const auto output_ptr = reinterpret_cast<float *>(output.ptr());
+
+            int64_t  x  = window_start_x;
+            svbool_t pg = svwhilelt_b32(x, window_end_x);
+            do
+            {
+                const svfloat32_t val1 = svld1_f32(pg, input1_ptr + x);
+                const svfloat32_t val2 = svld1_f32(pg, input2_ptr + x);
+                svst1_f32(pg, output_ptr + x, svadd_f32_z(pg, val1, val2));
+                x += svcntw();
+                pg = svwhilelt_b32(x, window_end_x);
+            }
+            while(svptest_any(svptrue_b32(), pg));
+        },
+        input1, input2, output);
+    }
+}
+#endif /* defined(__ARM_FEATURE_SVE) */
+
 void add_QASYMM8_QASYMM8_QASYMM8(const ITensor *in1, const ITensor *in2, ITensor *out, ConvertPolicy policy, const Window &window)
 {
     ARM_COMPUTE_UNUSED(policy);
@@ -541,19 +635,59 @@ void add_QSYMM16_QSYMM16_QSYMM16(const ITensor *in1, const ITensor *in2, ITensor
     const UniformQuantizationInfo iq2_info = in2->info()->quantization_info().uniform();
     const UniformQuantizationInfo oq_info  = out->info()->quantization_info().uniform();
 
-    const float32x4_t vscale1    = vdupq_n_f32(iq1_info.scale);
-    const float32x4_t vscale2    = vdupq_n_f32(iq2_info.scale);
-    const float32x4_t invvscaleo = vdupq_n_f32(1.f / oq_info.scale);
+    // Rescale both operands to the output scale with fixed-point multipliers, so the sum never leaves the integer domain
+    int32_t qmul1  = 0;
+    int32_t qmul2  = 0;
+    int32_t shift1 = 0;
+    int32_t shift2 = 0;
+    quantization::calculate_quantized_multiplier(iq1_info.scale / oq_info.scale, &qmul1, &shift1);
+    quantization::calculate_quantized_multiplier(iq2_info.scale / oq_info.scale, &qmul2, &shift2);
+    shift1 *= -1;
+    shift2 *= -1;
+
+    if(!is_broadcast_across_x && (iq1_info.scale == oq_info.scale) && (iq2_info.scale == oq_info.scale))
+    {
+        // All scales match, e.g. the cell state updates of quantized LSTM cells: plain saturating add
+        input1_win.set(Window::DimX, Window::Dimension(0, 1, 1));
+        input2_win.set(Window::DimX, Window::Dimension(0, 1, 1));
 
-    if(is_broadcast_across_x)
+        Iterator input1(in1, input1_win);
+        Iterator input2(in2, input2_win);
+        Iterator output(out, win);
+
+        execute_window_loop(win, [&](const Coordinates &)
+        {
+            const auto input1_ptr = reinterpret_cast<const int16_t *>(input1.ptr());
+            const auto input2_ptr = reinterpret_cast<const int16_t *>(input2.ptr());
+            const auto output_ptr = reinterpret_cast<int16_t *>(output.ptr());
+
+            // Compute S elements per iteration
+            int x = window_start_x;
+            for(; x <= (window_end_x - window_step_x); x += window_step_x)
+            {
+                vst1q_s16(output_ptr + x, vqaddq_s16(vld1q_s16(input1_ptr + x), vld1q_s16(input2_ptr + x)));
+            }
+
+            // Compute left-over elements
+            for(; x < window_end_x; ++x)
+            {
+                const int32_t res = static_cast<int32_t>(*(input1_ptr + x)) + static_cast<int32_t>(*(input2_ptr + x));
+                *(output_ptr + x) = static_cast<int16_t>(utility::clamp<int32_t, int16_t>(res));
+            }
+        },
+        input1, input2, output);
+    }
+    else if(is_broadcast_across_x)
     {
-        const bool                    is_broadcast_input_2 = input2_win.x().step() == 0;
-        Window                        broadcast_win        = is_broadcast_input_2 ? input2_win : input1_win;
-        Window                        non_broadcast_win    = !is_broadcast_input_2 ? input2_win : input1_win;
-        const ITensor                *broadcast_tensor     = is_broadcast_input_2 ? in2 : in1;
-        const ITensor                *non_broadcast_tensor = !is_broadcast_input_2 ? in2 : in1;
-        const UniformQuantizationInfo broadcast_qinfo      = broadcast_tensor->info()->quantization_info().uniform();
-        const UniformQuantizationInfo non_broadcast_qinfo  = non_broadcast_tensor->info()->quantization_info().uniform();
+        const bool     is_broadcast_input_2 = input2_win.x().step() == 0;
+        Window         broadcast_win        = is_broadcast_input_2 ? input2_win : input1_win;
+        Window         non_broadcast_win    = !is_broadcast_input_2 ? input2_win : input1_win;
+        const ITensor *broadcast_tensor     = is_broadcast_input_2 ? in2 : in1;
+        const ITensor *non_broadcast_tensor = !is_broadcast_input_2 ? in2 : in1;
+        const int32_t  qmul_nb              = is_broadcast_input_2 ? qmul1 : qmul2;
+        const int32_t  shift_nb             = is_broadcast_input_2 ? shift1 : shift2;
+        const int32_t  qmul_b               = is_broadcast_input_2 ? qmul2 : qmul1;
+        const int32_t  shift_b              = is_broadcast_input_2 ? shift2 : shift1;
 
         // Clear X Dimension on execution window as we handle manually
         non_broadcast_win.set(Window::DimX, Window::Dimension(0, 1, 1));
@@ -567,53 +701,34 @@ void add_QSYMM16_QSYMM16_QSYMM16(const ITensor *in1, const ITensor *in2, ITensor
             const auto non_broadcast_input_ptr = reinterpret_cast<const int16_t *>(non_broadcast_input.ptr());
             const auto output_ptr              = reinterpret_cast<int16_t *>(output.ptr());
 
-            const int16_t   broadcast_value     = *reinterpret_cast<const int16_t *>(broadcast_input.ptr());
-            const int16x8_t broadcast_value_vec = vdupq_n_s16(broadcast_value);
-
-            const float32x4x2_t bf =
-            {
-                {
-                    vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(broadcast_value_vec))), vscale2),
-                    vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(broadcast_value_vec))), vscale2),
-                }
-            };
-            const float bfs = static_cast<int32_t>(broadcast_value) * broadcast_qinfo.scale;
+            const int16_t   broadcast_value = *reinterpret_cast<const int16_t *>(broadcast_input.ptr());
+            const int32_t   bs              = quantization::multiply_by_quantized_multiplier(broadcast_value, qmul_b, shift_b);
+            const int32x4_t bs_vec          = vdupq_n_s32(bs);
 
             // Compute S elements per iteration
             int x = window_start_x;
             for(; x <= (window_end_x - window_step_x); x += window_step_x)
             {
-                const int16x8_t     a = vld1q_s16(non_broadcast_input_ptr + x);
-                const float32x4x2_t af =
-                {
-                    {
-                        vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(a))), vscale1),
-                        vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(a))), vscale1),
-                    }
-                };
+                const int16x8_t a = vld1q_s16(non_broadcast_input_ptr + x);
 
-                const int32x4x4_t rf =
+                int32x4x2_t a32 =
                 {
                     {
-#ifdef __aarch64__
-                        vcvtnq_s32_f32(vmulq_f32(vaddq_f32(af.val[0], bf.val[0]), invvscaleo)),
-                        vcvtnq_s32_f32(vmulq_f32(vaddq_f32(af.val[1], bf.val[1]), invvscaleo)),
-#else  //__aarch64__
-                        vcvtq_s32_f32(vmulq_f32(vaddq_f32(af.val[0], bf.val[0]), invvscaleo)),
-                        vcvtq_s32_f32(vmulq_f32(vaddq_f32(af.val[1], bf.val[1]), invvscaleo)),
-#endif //__aarch64__
+                        vmovl_s16(vget_low_s16(a)),
+                        vmovl_s16(vget_high_s16(a)),
                     }
                 };
+                a32 = multiply_by_quantized_multiplier_2row(a32, qmul_nb, shift_nb);
 
-                const int16x8_t pa = vcombine_s16(vqmovn_s32(rf.val[0]), vqmovn_s32(rf.val[1]));
-                vst1q_s16(output_ptr + x, pa);
+                const int16x8_t res = vcombine_s16(vqmovn_s32(vqaddq_s32(a32.val[0], bs_vec)), vqmovn_s32(vqaddq_s32(a32.val[1], bs_vec)));
+                vst1q_s16(output_ptr + x, res);
             }
 
             // Compute left-over elements
             for(; x < window_end_x; ++x)
             {
-                const float afs   = static_cast<int32_t>(*(non_broadcast_input_ptr + x)) * non_broadcast_qinfo.scale;
-                *(output_ptr + x) = quantize_qsymm16((afs + bfs), oq_info);
+                const int32_t as  = quantization::multiply_by_quantized_multiplier(*(non_broadcast_input_ptr + x), qmul_nb, shift_nb);
+                *(output_ptr + x) = static_cast<int16_t>(utility::clamp<int32_t, int16_t>(as + bs));
             }
         },
         broadcast_input, non_broadcast_input, output);
@@ -641,45 +756,33 @@ void add_QSYMM16_QSYMM16_QSYMM16(const ITensor *in1, const ITensor *in2, ITensor
                 const int16x8_t a = vld1q_s16(input1_ptr + x);
                 const int16x8_t b = vld1q_s16(input2_ptr + x);
 
-                const float32x4x2_t af =
+                int32x4x2_t a32 =
                 {
                     {
-                        vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(a))), vscale1),
-                        vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(a))), vscale1),
+                        vmovl_s16(vget_low_s16(a)),
+                        vmovl_s16(vget_high_s16(a)),
                     }
                 };
-
-                const float32x4x2_t bf =
+                int32x4x2_t b32 =
                 {
                     {
-                        vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(b))), vscale2),
-                        vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(b))), vscale2),
+                        vmovl_s16(vget_low_s16(b)),
+                        vmovl_s16(vget_high_s16(b)),
                     }
                 };
+                a32 = multiply_by_quantized_multiplier_2row(a32, qmul1, shift1);
+                b32 = multiply_by_quantized_multiplier_2row(b32, qmul2, shift2);
 
-                const int32x4x2_t rf =
-                {
-                    {
-#ifdef __aarch64__
-                        vcvtnq_s32_f32(vmulq_f32(vaddq_f32(af.val[0], bf.val[0]), invvscaleo)),
-                        vcvtnq_s32_f32(vmulq_f32(vaddq_f32(af.val[1], bf.val[1]), invvscaleo)),
-#else  //__aarch64__
-                        vcvtq_s32_f32(vmulq_f32(vaddq_f32(af.val[0], bf.val[0]), invvscaleo)),
-                        vcvtq_s32_f32(vmulq_f32(vaddq_f32(af.val[1], bf.val[1]), invvscaleo)),
-#endif //__aarch64__
-                    }
-                };
-
-                const int16x8_t pa = vcombine_s16(vqmovn_s32(rf.val[0]), vqmovn_s32(rf.val[1]));
-                vst1q_s16(output_ptr + x, pa);
+                const int16x8_t res = vcombine_s16(vqmovn_s32(vqaddq_s32(a32.val[0], b32.val[0])), vqmovn_s32(vqaddq_s32(a32.val[1], b32.val[1])));
+                vst1q_s16(output_ptr + x, res);
             }
 
             // Compute left-over elements
             for(; x < window_end_x; ++x)
             {
-                const float afs   = static_cast<int32_t>((*(input1_ptr + x))) * iq1_info.scale;
-                const float bfs   = static_cast<int32_t>((*(input2_ptr + x))) * iq2_info.scale;
-                *(output_ptr + x) = quantize_qsymm16((afs + bfs), out->info()->quantization_info());
+                const int32_t as  = quantization::multiply_by_quantized_multiplier(*(input1_ptr + x), qmul1, shift1);
+                const int32_t bs  = quantization::multiply_by_quantized_multiplier(*(input2_ptr + x), qmul2, shift2);
+                *(output_ptr + x) = static_cast<int16_t>(utility::clamp<int32_t, int16_t>(as + bs));
             }
         },
         input1, input2, output);
@@ -915,7 +1018,11 @@ std::pair<Status, Window> validate_and_configure_window(const ITensorInfo &input
 } // namespace
 
 NEArithmeticAdditionKernel::NEArithmeticAdditionKernel()
+#if defined(__ARM_FEATURE_SVE)
+    : _func(nullptr), _func_sve(nullptr), _policy()
+#else  /* defined(__ARM_FEATURE_SVE) */
     : _func(nullptr), _policy()
+#endif /* defined(__ARM_FEATURE_SVE) */
 {
 }
 
@@ -971,6 +1078,14 @@ void NEArithmeticAdditionKernel::configure(const ITensorInfo *input1, const ITen
         _func = it->second;
     }
 
+#if defined(__ARM_FEATURE_SVE)
+    // FP32 same-type addition has a scalable-vector variant; every other combination keeps the NEON path
+    if(_func == &add_same<float>)
+    {
+        _func_sve = &add_same_sve_f32;
+    }
+#endif /* defined(__ARM_FEATURE_SVE) */
+
     INEKernel::configure(win_config.second);
 }
 
@@ -989,11 +1104,20 @@ void NEArithmeticAdditionKernel::run_op(ITensorPack &tensors, const Window &wind
     ARM_COMPUTE_UNUSED(info);
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    AddFunction *func = _func;
+#if defined(__ARM_FEATURE_SVE)
+    // Prefer the scalable-vector variant when the core implements SVE
+    if(_func_sve != nullptr && info.cpu_info != nullptr && info.cpu_info->has_sve())
+    {
+        func = _func_sve;
+    }
+#endif /* defined(__ARM_FEATURE_SVE) */
+
     // Dispatch kernel
-    (*_func)(tensors.get_const_tensor(TensorType::ACL_SRC_0),
-             tensors.get_const_tensor(TensorType::ACL_SRC_1),
-             tensors.get_tensor(TensorType::ACL_DST),
-             _policy,
-             window);
+    (*func)(tensors.get_const_tensor(TensorType::ACL_SRC_0),
+            tensors.get_const_tensor(TensorType::ACL_SRC_1),
+            tensors.get_tensor(TensorType::ACL_DST),
+            _policy,
+            window);
 }
 } // namespace arm_compute
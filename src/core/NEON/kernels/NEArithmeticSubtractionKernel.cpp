@@ -27,6 +27,8 @@
 #include "arm_compute/core/NEON/NEAsymm.h"
 #include "arm_compute/core/NEON/NESymm.h"
 #include "arm_compute/core/NEON/wrapper/wrapper.h"
+#include "arm_compute/core/utils/misc/Utility.h"
+#include "arm_compute/core/utils/quantization/AsymmHelpers.h"
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Validate.h"
 
@@ -376,19 +378,59 @@ void sub_QSYMM16_QSYMM16_QSYMM16(const ITensor *in1, const ITensor *in2, ITensor
     const UniformQuantizationInfo iq2_info = in2->info()->quantization_info().uniform();
     const UniformQuantizationInfo oq_info  = out->info()->quantization_info().uniform();
 
-    const float32x4_t vscale1    = vdupq_n_f32(iq1_info.scale);
-    const float32x4_t vscale2    = vdupq_n_f32(iq2_info.scale);
-    const float32x4_t invvscaleo = vdupq_n_f32(1.f / oq_info.scale);
+    // Rescale both operands to the output scale with fixed-point multipliers, so the difference never leaves the integer domain
+    int32_t qmul1  = 0;
+    int32_t qmul2  = 0;
+    int32_t shift1 = 0;
+    int32_t shift2 = 0;
+    quantization::calculate_quantized_multiplier(iq1_info.scale / oq_info.scale, &qmul1, &shift1);
+    quantization::calculate_quantized_multiplier(iq2_info.scale / oq_info.scale, &qmul2, &shift2);
+    shift1 *= -1;
+    shift2 *= -1;
+
+    if(!is_broadcast_across_x && (iq1_info.scale == oq_info.scale) && (iq2_info.scale == oq_info.scale))
+    {
+        // All scales match, e.g. the gate updates of quantized LSTM cells: plain saturating subtract
+        input1_win.set(Window::DimX, Window::Dimension(0, 1, 1));
+        input2_win.set(Window::DimX, Window::Dimension(0, 1, 1));
 
-    if(is_broadcast_across_x)
+        Iterator input1(in1, input1_win);
+        Iterator input2(in2, input2_win);
+        Iterator output(out, win);
+
+        execute_window_loop(win, [&](const Coordinates &)
+        {
+            const auto input1_ptr = reinterpret_cast<const int16_t *>(input1.ptr());
+            const auto input2_ptr = reinterpret_cast<const int16_t *>(input2.ptr());
+            const auto output_ptr = reinterpret_cast<int16_t *>(output.ptr());
+
+            // Compute S elements per iteration
+            int x = window_start_x;
+            for(; x <= (window_end_x - window_step_x); x += window_step_x)
+            {
+                vst1q_s16(output_ptr + x, vqsubq_s16(vld1q_s16(input1_ptr + x), vld1q_s16(input2_ptr + x)));
+            }
+
+            // Compute left-over elements
+            for(; x < window_end_x; ++x)
+            {
+                const int32_t res = static_cast<int32_t>(*(input1_ptr + x)) - static_cast<int32_t>(*(input2_ptr + x));
+                *(output_ptr + x) = static_cast<int16_t>(utility::clamp<int32_t, int16_t>(res));
+            }
+        },
+        input1, input2, output);
+    }
+    else if(is_broadcast_across_x)
     {
-        const bool                    is_broadcast_input_2 = input2_win.x().step() == 0;
-        Window                        broadcast_win        = is_broadcast_input_2 ? input2_win : input1_win;
-        Window                        non_broadcast_win    = !is_broadcast_input_2 ? input2_win : input1_win;
-        const ITensor                *broadcast_tensor     = is_broadcast_input_2 ? in2 : in1;
-        const ITensor                *non_broadcast_tensor = !is_broadcast_input_2 ? in2 : in1;
-        const UniformQuantizationInfo broadcast_qinfo      = broadcast_tensor->info()->quantization_info().uniform();
-        const UniformQuantizationInfo non_broadcast_qinfo  = non_broadcast_tensor->info()->quantization_info().uniform();
+        const bool     is_broadcast_input_2 = input2_win.x().step() == 0;
+        Window         broadcast_win        = is_broadcast_input_2 ? input2_win : input1_win;
+        Window         non_broadcast_win    = !is_broadcast_input_2 ? input2_win : input1_win;
+        const ITensor *broadcast_tensor     = is_broadcast_input_2 ? in2 : in1;
+        const ITensor *non_broadcast_tensor = !is_broadcast_input_2 ? in2 : in1;
+        const int32_t  qmul_nb              = is_broadcast_input_2 ? qmul1 : qmul2;
+        const int32_t  shift_nb             = is_broadcast_input_2 ? shift1 : shift2;
+        const int32_t  qmul_b               = is_broadcast_input_2 ? qmul2 : qmul1;
+        const int32_t  shift_b              = is_broadcast_input_2 ? shift2 : shift1;
 
         // Clear X Dimension on execution window as we handle manually
         non_broadcast_win.set(Window::DimX, Window::Dimension(0, 1, 1));
@@ -402,53 +444,43 @@ void sub_QSYMM16_QSYMM16_QSYMM16(const ITensor *in1, const ITensor *in2, ITensor
             const auto non_broadcast_input_ptr = reinterpret_cast<const int16_t *>(non_broadcast_input.ptr());
             const auto output_ptr              = reinterpret_cast<int16_t *>(output.ptr());
 
-            const int16_t   broadcast_value     = *reinterpret_cast<const int16_t *>(broadcast_input.ptr());
-            const int16x8_t broadcast_value_vec = vdupq_n_s16(broadcast_value);
-
-            const float32x4x2_t bf =
-            {
-                {
-                    vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(broadcast_value_vec))), vscale2),
-                    vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(broadcast_value_vec))), vscale2),
-                }
-            };
-            const float bfs = static_cast<int32_t>(broadcast_value) * broadcast_qinfo.scale;
+            const int16_t   broadcast_value = *reinterpret_cast<const int16_t *>(broadcast_input.ptr());
+            const int32_t   bs              = quantization::multiply_by_quantized_multiplier(broadcast_value, qmul_b, shift_b);
+            const int32x4_t bs_vec          = vdupq_n_s32(bs);
 
             // Compute S elements per iteration
             int x = window_start_x;
             for(; x <= (window_end_x - window_step_x); x += window_step_x)
             {
-                const int16x8_t     a = vld1q_s16(non_broadcast_input_ptr + x);
-                const float32x4x2_t af =
+                const int16x8_t a = vld1q_s16(non_broadcast_input_ptr + x);
+
+                int32x4x2_t a32 =
                 {
                     {
-                        vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(a))), vscale1),
-                        vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(a))), vscale1),
+                        vmovl_s16(vget_low_s16(a)),
+                        vmovl_s16(vget_high_s16(a)),
                     }
                 };
+                a32 = multiply_by_quantized_multiplier_2row(a32, qmul_nb, shift_nb);
 
-                const int32x4x4_t rf =
+                const int32x4x2_t rf =
                 {
                     {
-#ifdef __aarch64__
-                        vcvtnq_s32_f32(vmulq_f32(is_broadcast_input_2 ? vsubq_f32(bf.val[0], af.val[0]) : vsubq_f32(af.val[0], bf.val[0]), invvscaleo)),
-                        vcvtnq_s32_f32(vmulq_f32(is_broadcast_input_2 ? vsubq_f32(bf.val[1], af.val[1]) : vsubq_f32(af.val[1], bf.val[1]), invvscaleo)),
-#else  //__aarch64__
-                        vcvtq_s32_f32(vmulq_f32(is_broadcast_input_2 ? vsubq_f32(bf.val[0], af.val[0]) : vsubq_f32(af.val[0], bf.val[0]), invvscaleo)),
-                        vcvtq_s32_f32(vmulq_f32(is_broadcast_input_2 ? vsubq_f32(bf.val[1], af.val[1]) : vsubq_f32(af.val[1], bf.val[1]), invvscaleo)),
-#endif //__aarch64__
+                        is_broadcast_input_2 ? vqsubq_s32(a32.val[0], bs_vec) : vqsubq_s32(bs_vec, a32.val[0]),
+                        is_broadcast_input_2 ? vqsubq_s32(a32.val[1], bs_vec) : vqsubq_s32(bs_vec, a32.val[1]),
                     }
                 };
 
-                const int16x8_t pa = vcombine_s16(vqmovn_s32(rf.val[0]), vqmovn_s32(rf.val[1]));
-                vst1q_s16(output_ptr + x, pa);
+                const int16x8_t res = vcombine_s16(vqmovn_s32(rf.val[0]), vqmovn_s32(rf.val[1]));
+                vst1q_s16(output_ptr + x, res);
             }
 
             // Compute left-over elements
             for(; x < window_end_x; ++x)
             {
-                const float afs   = static_cast<int32_t>(*(non_broadcast_input_ptr + x)) * non_broadcast_qinfo.scale;
-                *(output_ptr + x) = quantize_qsymm16(is_broadcast_input_2 ? (bfs - afs) : (afs - bfs), oq_info);
+                const int32_t as  = quantization::multiply_by_quantized_multiplier(*(non_broadcast_input_ptr + x), qmul_nb, shift_nb);
+                const int32_t res = is_broadcast_input_2 ? (as - bs) : (bs - as);
+                *(output_ptr + x) = static_cast<int16_t>(utility::clamp<int32_t, int16_t>(res));
             }
         },
         broadcast_input, non_broadcast_input, output);
@@ -476,51 +508,38 @@ void sub_QSYMM16_QSYMM16_QSYMM16(const ITensor *in1, const ITensor *in2, ITensor
                 const int16x8_t a = vld1q_s16(input1_ptr + x);
                 const int16x8_t b = vld1q_s16(input2_ptr + x);
 
-                const float32x4x2_t af =
+                int32x4x2_t a32 =
                 {
                     {
-                        vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(a))), vscale1),
-                        vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(a))), vscale1),
+                        vmovl_s16(vget_low_s16(a)),
+                        vmovl_s16(vget_high_s16(a)),
                     }
                 };
-
-                const float32x4x2_t bf =
+                int32x4x2_t b32 =
                 {
                     {
-                        vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(b))), vscale2),
-                        vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(b))), vscale2),
+                        vmovl_s16(vget_low_s16(b)),
+                        vmovl_s16(vget_high_s16(b)),
                     }
                 };
+                a32 = multiply_by_quantized_multiplier_2row(a32, qmul1, shift1);
+                b32 = multiply_by_quantized_multiplier_2row(b32, qmul2, shift2);
 
-                const int32x4x2_t rf =
-                {
-                    {
-#ifdef __aarch64__
-                        vcvtnq_s32_f32(vmulq_f32(vsubq_f32(af.val[0], bf.val[0]), invvscaleo)),
-                        vcvtnq_s32_f32(vmulq_f32(vsubq_f32(af.val[1], bf.val[1]), invvscaleo)),
-#else  //__aarch64__
-                        vcvtq_s32_f32(vmulq_f32(vsubq_f32(af.val[0], bf.val[0]), invvscaleo)),
-                        vcvtq_s32_f32(vmulq_f32(vsubq_f32(af.val[1], bf.val[1]), invvscaleo)),
-#endif //__aarch64__
-                    }
-                };
-
-                const int16x8_t pa = vcombine_s16(vqmovn_s32(rf.val[0]), vqmovn_s32(rf.val[1]));
-                vst1q_s16(output_ptr + x, pa);
+                const int16x8_t res = vcombine_s16(vqmovn_s32(vqsubq_s32(a32.val[0], b32.val[0])), vqmovn_s32(vqsubq_s32(a32.val[1], b32.val[1])));
+                vst1q_s16(output_ptr + x, res);
             }
 
             // Compute left-over elements
             for(; x < window_end_x; ++x)
             {
-                const float afs   = static_cast<int32_t>((*(input1_ptr + x))) * iq1_info.scale;
-                const float bfs   = static_cast<int32_t>((*(input2_ptr + x))) * iq2_info.scale;
-                *(output_ptr + x) = quantize_qsymm16((afs - bfs), out->info()->quantization_info());
+                const int32_t as  = quantization::multiply_by_quantized_multiplier(*(input1_ptr + x), qmul1, shift1);
+                const int32_t bs  = quantization::multiply_by_quantized_multiplier(*(input2_ptr + x), qmul2, shift2);
+                *(output_ptr + x) = static_cast<int16_t>(utility::clamp<int32_t, int16_t>(as - bs));
             }
         },
         input1, input2, output);
     }
 }
-
 void sub_S16_U8_S16_impl(const ITensor *in1, const ITensor *in2, ITensor *out, const Window &window, bool is_sat, bool is_swapped)
 {
     // Create input windows
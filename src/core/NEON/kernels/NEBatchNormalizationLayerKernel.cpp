@@ -35,6 +35,7 @@
 
 #include "arm_compute/core/NEON/wrapper/wrapper.h"
 
+#include <cmath>
 #include <map>
 
 namespace arm_compute
@@ -292,6 +293,165 @@ void NEBatchNormalizationLayerKernel::batch_normalization_nhwc(const Window &win
     input, output);
 }
 
+template <typename T, bool fused_activation, typename F>
+void NEBatchNormalizationLayerKernel::batch_normalization_folded_nchw(const Window &window)
+{
+    /** NEON vector tag type. */
+    using ExactTagType = typename wrapper::traits::neon_bitvector_tag_t<T, wrapper::traits::BitWidth::W128>;
+
+    const int  window_step_x  = 16 / sizeof(T);
+    const auto window_start_x = static_cast<int>(window.x().start());
+    const auto window_end_x   = static_cast<int>(window.x().end());
+
+    Window win_to_use = window;
+    win_to_use.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator input(_input, win_to_use);
+    Iterator output(_output, win_to_use);
+
+    F activation_functor(_act_info);
+
+    const auto folded_scale = reinterpret_cast<const T *>(_folded_scale.data());
+    const auto folded_shift = reinterpret_cast<const T *>(_folded_shift.data());
+
+    // Hold information about the current feature map we are iterating.
+    // Only construct the coefficient vectors once per feature map.
+    int slice = -1;
+
+    T    scale     = static_cast<T>(1);
+    T    shift     = static_cast<T>(0);
+    auto scale_vec = wrapper::vdup_n(scale, ExactTagType{});
+    auto shift_vec = wrapper::vdup_n(shift, ExactTagType{});
+    execute_window_loop(win_to_use, [&](const Coordinates & id)
+    {
+        const auto input_ptr  = reinterpret_cast<const T *>(input.ptr());
+        const auto output_ptr = reinterpret_cast<T *>(output.ptr());
+
+        if(slice != id.z())
+        {
+            scale     = folded_scale[id.z()];
+            shift     = folded_shift[id.z()];
+            scale_vec = wrapper::vdup_n(scale, ExactTagType{});
+            shift_vec = wrapper::vdup_n(shift, ExactTagType{});
+            slice     = id.z();
+        }
+
+        // Perform core calculations using vector operations
+        int x = window_start_x;
+        for(; x <= (window_end_x - window_step_x); x += window_step_x)
+        {
+            auto res = wrapper::vmla(shift_vec, wrapper::vloadq(input_ptr + x), scale_vec);
+
+            // Perform fused activation
+            if(fused_activation)
+            {
+                activation_functor(res);
+            }
+
+            // Store results
+            wrapper::vstore(output_ptr + x, res);
+        }
+
+        // Compute left-over elements
+        for(; x < window_end_x; ++x)
+        {
+            T res = shift + input_ptr[x] * scale;
+
+            // Perform fused activation
+            if(fused_activation)
+            {
+                activation_functor(res);
+            }
+
+            // Store results
+            *(output_ptr + x) = res;
+        }
+    },
+    input, output);
+}
+
+template <typename T, bool fused_activation, typename F>
+void NEBatchNormalizationLayerKernel::batch_normalization_folded_nhwc(const Window &window)
+{
+    const int  window_step_x  = 16 / sizeof(T);
+    const auto window_start_x = static_cast<int>(window.x().start());
+    const auto window_end_x   = static_cast<int>(window.x().end());
+
+    Window win_collapsed = window.collapse_if_possible(window, Window::DimZ);
+    win_collapsed.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator input(_input, win_collapsed);
+    Iterator output(_output, win_collapsed);
+
+    F activation_functor(_act_info);
+
+    const auto folded_scale = reinterpret_cast<const T *>(_folded_scale.data());
+    const auto folded_shift = reinterpret_cast<const T *>(_folded_shift.data());
+
+    execute_window_loop(win_collapsed, [&](const Coordinates &)
+    {
+        const auto input_ptr  = reinterpret_cast<const T *>(input.ptr());
+        const auto output_ptr = reinterpret_cast<T *>(output.ptr());
+
+        // Perform core calculations using vector operations
+        int x = window_start_x;
+        for(; x <= (window_end_x - window_step_x); x += window_step_x)
+        {
+            auto res = wrapper::vmla(wrapper::vloadq(folded_shift + x), wrapper::vloadq(input_ptr + x), wrapper::vloadq(folded_scale + x));
+
+            // Perform fused activation
+            if(fused_activation)
+            {
+                activation_functor(res);
+            }
+
+            // Store results
+            wrapper::vstore(output_ptr + x, res);
+        }
+
+        // Compute left-over elements
+        for(; x < window_end_x; ++x)
+        {
+            T res = folded_shift[x] + input_ptr[x] * folded_scale[x];
+
+            // Perform fused activation
+            if(fused_activation)
+            {
+                activation_functor(res);
+            }
+
+            // Store results
+            *(output_ptr + x) = res;
+        }
+    },
+    input, output);
+}
+
+template <typename T>
+void NEBatchNormalizationLayerKernel::fold_coefficients_typed()
+{
+    const size_t num_channels = _mean->info()->dimension(0);
+    _folded_scale.resize(num_channels * sizeof(T));
+    _folded_shift.resize(num_channels * sizeof(T));
+
+    const auto input_mean  = reinterpret_cast<const T *>(_mean->ptr_to_element(Coordinates(0, 0)));
+    const auto input_var   = reinterpret_cast<const T *>(_var->ptr_to_element(Coordinates(0, 0)));
+    const auto input_gamma = (_gamma != nullptr) ? reinterpret_cast<const T *>(_gamma->ptr_to_element(Coordinates(0, 0))) : nullptr;
+    const auto input_beta  = (_beta != nullptr) ? reinterpret_cast<const T *>(_beta->ptr_to_element(Coordinates(0, 0))) : nullptr;
+
+    const auto folded_scale = reinterpret_cast<T *>(_folded_scale.data());
+    const auto folded_shift = reinterpret_cast<T *>(_folded_shift.data());
+
+    for(size_t i = 0; i < num_channels; ++i)
+    {
+        const T gamma   = (input_gamma != nullptr) ? input_gamma[i] : static_cast<T>(1.f);
+        const T beta    = (input_beta != nullptr) ? input_beta[i] : static_cast<T>(0.f);
+        const T scale   = gamma / static_cast<T>(std::sqrt(static_cast<float>(input_var[i]) + _epsilon));
+        folded_scale[i] = scale;
+        folded_shift[i] = beta - scale * input_mean[i];
+    }
+}
+
 void NEBatchNormalizationLayerKernel::configure_non_fused()
 {
     const bool is_nhwc = _input->info()->data_layout() == DataLayout::NHWC;
@@ -362,8 +522,102 @@ void NEBatchNormalizationLayerKernel::configure_fused()
     }
 }
 
+void NEBatchNormalizationLayerKernel::configure_folded()
+{
+    // NCHW Folded Batched Normalization with activation functions : FP32
+    static std::map<ActivationLayerInfo::ActivationFunction, BatchNormFunctionPtr> bn_folded_map_f32_nchw =
+    {
+        { ActivationLayerInfo::ActivationFunction::RELU, &NEBatchNormalizationLayerKernel::batch_normalization_folded_nchw<float, true, detail::relu<float, 4>> },
+        { ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, &NEBatchNormalizationLayerKernel::batch_normalization_folded_nchw<float, true, detail::brelu<float, 4>> },
+        { ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, &NEBatchNormalizationLayerKernel::batch_normalization_folded_nchw<float, true, detail::lubrelu<float, 4>> }
+    };
+    // NHWC Folded Batched Normalization with activation functions : FP32
+    static std::map<ActivationLayerInfo::ActivationFunction, BatchNormFunctionPtr> bn_folded_map_f32_nhwc =
+    {
+        { ActivationLayerInfo::ActivationFunction::RELU, &NEBatchNormalizationLayerKernel::batch_normalization_folded_nhwc<float, true, detail::relu<float, 4>> },
+        { ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, &NEBatchNormalizationLayerKernel::batch_normalization_folded_nhwc<float, true, detail::brelu<float, 4>> },
+        { ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, &NEBatchNormalizationLayerKernel::batch_normalization_folded_nhwc<float, true, detail::lubrelu<float, 4>> }
+    };
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+    // NCHW Folded Batched Normalization with activation functions : FP16
+    static std::map<ActivationLayerInfo::ActivationFunction, BatchNormFunctionPtr> bn_folded_map_f16_nchw =
+    {
+        { ActivationLayerInfo::ActivationFunction::RELU, &NEBatchNormalizationLayerKernel::batch_normalization_folded_nchw<float16_t, true, detail::relu<float16_t, 8>> },
+        { ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, &NEBatchNormalizationLayerKernel::batch_normalization_folded_nchw<float16_t, true, detail::brelu<float16_t, 8>> },
+        { ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, &NEBatchNormalizationLayerKernel::batch_normalization_folded_nchw<float16_t, true, detail::lubrelu<float16_t, 8>> }
+    };
+    // NHWC Folded Batched Normalization with activation functions : FP16
+    static std::map<ActivationLayerInfo::ActivationFunction, BatchNormFunctionPtr> bn_folded_map_f16_nhwc =
+    {
+        { ActivationLayerInfo::ActivationFunction::RELU, &NEBatchNormalizationLayerKernel::batch_normalization_folded_nhwc<float16_t, true, detail::relu<float16_t, 8>> },
+        { ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, &NEBatchNormalizationLayerKernel::batch_normalization_folded_nhwc<float16_t, true, detail::brelu<float16_t, 8>> },
+        { ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, &NEBatchNormalizationLayerKernel::batch_normalization_folded_nhwc<float16_t, true, detail::lubrelu<float16_t, 8>> }
+    };
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+
+    const bool is_nhwc = _input->info()->data_layout() == DataLayout::NHWC;
+    switch(_input->info()->data_type())
+    {
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        case DataType::F16:
+            if(_act_info.enabled())
+            {
+                _func = (is_nhwc) ? bn_folded_map_f16_nhwc[_act_info.activation()] : bn_folded_map_f16_nchw[_act_info.activation()];
+            }
+            else
+            {
+                _func = (is_nhwc) ? &NEBatchNormalizationLayerKernel::batch_normalization_folded_nhwc<float16_t, false, detail::dummy<float16_t, 8>> :
+                        &NEBatchNormalizationLayerKernel::batch_normalization_folded_nchw<float16_t, false, detail::dummy<float16_t, 8>>;
+            }
+            break;
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        case DataType::F32:
+            if(_act_info.enabled())
+            {
+                _func = (is_nhwc) ? bn_folded_map_f32_nhwc[_act_info.activation()] : bn_folded_map_f32_nchw[_act_info.activation()];
+            }
+            else
+            {
+                _func = (is_nhwc) ? &NEBatchNormalizationLayerKernel::batch_normalization_folded_nhwc<float, false, detail::dummy<float, 4>> :
+                        &NEBatchNormalizationLayerKernel::batch_normalization_folded_nchw<float, false, detail::dummy<float, 4>>;
+            }
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Element size not supported");
+            break;
+    }
+}
+
+void NEBatchNormalizationLayerKernel::fold_coefficients()
+{
+    ARM_COMPUTE_ERROR_ON(_input == nullptr);
+    if(_folded)
+    {
+        return;
+    }
+
+    switch(_input->info()->data_type())
+    {
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        case DataType::F16:
+            fold_coefficients_typed<float16_t>();
+            break;
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        case DataType::F32:
+            fold_coefficients_typed<float>();
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Element size not supported");
+            break;
+    }
+
+    // Switch the kernel onto the multiply-add apply loops
+    configure_folded();
+    _folded = true;
+}
+
 NEBatchNormalizationLayerKernel::NEBatchNormalizationLayerKernel()
-    : _func(nullptr), _input(nullptr), _output(nullptr), _mean(nullptr), _var(nullptr), _gamma(nullptr), _beta(nullptr), _epsilon(), _act_info()
+    : _func(nullptr), _input(nullptr), _output(nullptr), _mean(nullptr), _var(nullptr), _gamma(nullptr), _beta(nullptr), _epsilon(), _act_info(), _folded_scale(), _folded_shift(), _folded(false)
 {
 }
 
@@ -40,11 +40,19 @@ using namespace misc::shape_calculator;
 
 namespace
 {
-Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, const Size2D &convolved_dims)
+Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, const Size2D &convolved_dims, const ITensorInfo *residual)
 {
     //Note: ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input) is not needed here as this kernel doesn't use NEON FP16 instructions.
     ARM_COMPUTE_RETURN_ERROR_ON(input->data_type() == DataType::UNKNOWN);
 
+    // The residual epilogue needs typed arithmetic, only plain float is supported
+    if(residual != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, residual);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(residual->tensor_shape(), compute_col2im_shape(*input, convolved_dims, false));
+    }
+
     // Validate configured output
     if(output->total_size() != 0)
     {
@@ -99,34 +107,76 @@ void NECol2ImKernel::run_col2im(const Window &window)
     in, out);
 }
 
+template <typename T>
+void NECol2ImKernel::run_col2im_residual(const Window &window)
+{
+    const int output_stride_x = _output->info()->strides_in_bytes().x();
+    const int output_stride_y = _output->info()->strides_in_bytes().y();
+    const int output_stride_z = _output->info()->strides_in_bytes().z();
+
+    const int residual_stride_x = _residual->info()->strides_in_bytes().x();
+    const int residual_stride_y = _residual->info()->strides_in_bytes().y();
+    const int residual_stride_z = _residual->info()->strides_in_bytes().z();
+
+    Window window_out(window);
+    window_out.set(Window::DimX, Window::Dimension(0, 0, 0));
+    window_out.set(Window::DimY, Window::Dimension(0, 0, 0));
+    window_out.set(Window::DimZ, Window::Dimension(0, 0, 0));
+
+    // Create iterators
+    Iterator in(_input, window);
+    Iterator out(_output, window_out);
+    Iterator res(_residual, window_out);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const int hidx    = id.y();
+        const int xd      = hidx % _convolved_dims.width;
+        const int yd      = hidx / _convolved_dims.width;
+        const int idx     = id.x() * output_stride_z + yd * output_stride_y + xd * output_stride_x;
+        const int idx_res = id.x() * residual_stride_z + yd * residual_stride_y + xd * residual_stride_x;
+
+        *(reinterpret_cast<T *>(out.ptr() + idx)) = *(reinterpret_cast<const T *>(in.ptr())) + *(reinterpret_cast<const T *>(res.ptr() + idx_res));
+    },
+    in, out, res);
+}
+
 NECol2ImKernel::NECol2ImKernel()
-    : _func(), _input(nullptr), _output(nullptr), _convolved_dims()
+    : _func(), _input(nullptr), _output(nullptr), _residual(nullptr), _convolved_dims()
 {
 }
 
-void NECol2ImKernel::configure(const ITensor *input, ITensor *output, const Size2D &convolved_dims)
+void NECol2ImKernel::configure(const ITensor *input, ITensor *output, const Size2D &convolved_dims, const ITensor *residual)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
-    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), output->info(), convolved_dims));
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), output->info(), convolved_dims, residual != nullptr ? residual->info() : nullptr));
 
     _input          = input;
     _output         = output;
+    _residual       = residual;
     _convolved_dims = convolved_dims;
 
-    switch(input->info()->element_size())
+    if(residual != nullptr)
+    {
+        _func = &NECol2ImKernel::run_col2im_residual<float>;
+    }
+    else
     {
-        case 1:
-            _func = &NECol2ImKernel::run_col2im<uint8_t>;
-            break;
-        case 2:
-            _func = &NECol2ImKernel::run_col2im<uint16_t>;
-            break;
-        case 4:
-            _func = &NECol2ImKernel::run_col2im<uint32_t>;
-            break;
-        default:
-            ARM_COMPUTE_ERROR("Element size not supported");
-            break;
+        switch(input->info()->element_size())
+        {
+            case 1:
+                _func = &NECol2ImKernel::run_col2im<uint8_t>;
+                break;
+            case 2:
+                _func = &NECol2ImKernel::run_col2im<uint16_t>;
+                break;
+            case 4:
+                _func = &NECol2ImKernel::run_col2im<uint32_t>;
+                break;
+            default:
+                ARM_COMPUTE_ERROR("Element size not supported");
+                break;
+        }
     }
 
     // Configure kernel window
@@ -135,9 +185,9 @@ void NECol2ImKernel::configure(const ITensor *input, ITensor *output, const Size
     INEKernel::configure(win_config.second);
 }
 
-Status NECol2ImKernel::validate(const ITensorInfo *input, const ITensorInfo *output, const Size2D &convolved_dims)
+Status NECol2ImKernel::validate(const ITensorInfo *input, const ITensorInfo *output, const Size2D &convolved_dims, const ITensorInfo *residual)
 {
-    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, output, convolved_dims));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, output, convolved_dims, residual));
     ARM_COMPUTE_RETURN_ON_ERROR(validate_and_configure_window(input->clone().get(), output->clone().get(), convolved_dims).first);
     return Status{};
 }
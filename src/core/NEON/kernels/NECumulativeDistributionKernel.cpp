@@ -32,6 +32,7 @@
 #include "arm_compute/core/Validate.h"
 
 #include <algorithm>
+#include <arm_neon.h>
 #include <cmath>
 #include <numeric>
 
@@ -104,7 +105,29 @@ void NECumulativeDistributionKernel::run(const Window &window, const ThreadInfo
     {
         const float diff = image_size - cd_min;
 
-        for(unsigned int x = 0; x < _histogram_size; ++x)
+        // Map 16 bins at a time: convert, rescale and round to nearest (the inputs are
+        // non-negative, so adding one half before truncation matches lround), then
+        // narrow back down to U8
+        const float32x4_t scale      = vdupq_n_f32(255.0f / diff);
+        const float32x4_t cd_min_vec = vdupq_n_f32(static_cast<float>(cd_min));
+        const float32x4_t half       = vdupq_n_f32(0.5f);
+
+        auto map_bins = [&](const uint32_t *cumsum_ptr)
+        {
+            const float32x4_t cumsum = vcvtq_f32_u32(vld1q_u32(cumsum_ptr));
+            return vcvtq_u32_f32(vaddq_f32(vmulq_f32(vsubq_f32(cumsum, cd_min_vec), scale), half));
+        };
+
+        unsigned int x = 0;
+        for(; x <= _histogram_size - 16; x += 16)
+        {
+            const uint16x8_t low  = vcombine_u16(vqmovn_u32(map_bins(cumulative_sum + x)), vqmovn_u32(map_bins(cumulative_sum + x + 4)));
+            const uint16x8_t high = vcombine_u16(vqmovn_u32(map_bins(cumulative_sum + x + 8)), vqmovn_u32(map_bins(cumulative_sum + x + 12)));
+            vst1q_u8(output + x, vcombine_u8(vqmovn_u16(low), vqmovn_u16(high)));
+        }
+
+        // Compute left-over bins
+        for(; x < _histogram_size; ++x)
         {
             output[x] = lround((cumulative_sum[x] - cd_min) / diff * 255.0f);
         }
@@ -46,6 +46,46 @@ void pad_vectors(std::vector<int> &mult, std::vector<int> &shift, int vec_size)
     }
 }
 
+/** Applies the per-channel output stage on a contiguous block of accumulators
+ *
+ * Multipliers and shifts are loaded once per four channels and applied with vector
+ * saturating-doubling-high-multiply and rounding shifts; both shift directions are
+ * computed and selected per lane, mirroring @ref finalize_quantization_symm. Channels
+ * beyond the last multiple of four are requantized through the scalar helpers.
+ */
+inline void output_stage_per_channel(int32_t *acc, const int32_t *out_mult, const int32_t *out_shift, int num_channels, int32_t output_qoffset)
+{
+    int i = 0;
+    for(; i <= num_channels - 4; i += 4)
+    {
+        const int32x4_t mult    = vld1q_s32(out_mult + i);
+        const int32x4_t shift   = vld1q_s32(out_shift + i);
+        int32x4_t       acc_s32 = vld1q_s32(acc + i);
+
+        const int32x4_t res_shift_gt0 = rounding_divide_by_exp2(saturating_doubling_high_mul(acc_s32, mult), vnegq_s32(shift));
+        const int32x4_t res_shift_lt0 = saturating_doubling_high_mul(vmulq_s32(acc_s32, vshlq_s32(vdupq_n_s32(1), vnegq_s32(shift))), mult);
+#ifdef __aarch64__
+        const uint32x4_t mask_lt0 = vcltzq_s32(shift);
+#else  //__aarch64__
+        const uint32x4_t mask_lt0 = vcltq_s32(shift, vdupq_n_s32(0));
+#endif //__aarch64__
+        acc_s32 = vbslq_s32(mask_lt0, res_shift_lt0, res_shift_gt0);
+        acc_s32 = vaddq_s32(acc_s32, vdupq_n_s32(output_qoffset));
+        vst1q_s32(acc + i, acc_s32);
+    }
+    for(; i < num_channels; ++i)
+    {
+        if(out_shift[i] < 0)
+        {
+            acc[i] = saturating_doubling_high_mul(acc[i] * (1 << (-out_shift[i])), out_mult[i]) + output_qoffset;
+        }
+        else
+        {
+            acc[i] = rounding_divide_by_exp2(saturating_doubling_high_mul(acc[i], out_mult[i]), out_shift[i]) + output_qoffset;
+        }
+    }
+}
+
 template <typename T, int S>
 void depthwise_loop_multiplier1_fp(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info,
                                    const Size2D &dilation, const Window &window, bool has_biases)
@@ -289,17 +329,14 @@ void depthwise_loop_multiplier1_quantized(const ITensor *input, const ITensor *w
             {
                 acc.at(i) += *reinterpret_cast<int32_t *>(biases_it.ptr() + i * sizeof(int32_t));
             }
+        }
 
-            const int out_mul   = output_multiplier.at(id.x() + i);
-            const int out_shift = output_shift.at(id.x() + i);
-            if(out_shift < 0)
-            {
-                acc.at(i) = saturating_doubling_high_mul(acc.at(i) * (1 << (-out_shift)), out_mul) + output_qoffset;
-            }
-            else
-            {
-                acc.at(i) = rounding_divide_by_exp2(saturating_doubling_high_mul(acc.at(i), out_mul), out_shift) + output_qoffset;
-            }
+        // Requantize the whole accumulator block against the channel block's multipliers
+        // and shifts; the vectors are padded to the vector size so the loads stay in bounds
+        output_stage_per_channel(acc.data(), output_multiplier.data() + id.x(), output_shift.data() + id.x(), S, output_qoffset);
+
+        for(int i = 0; i < S; ++i)
+        {
             out_vals[i] = static_cast<T>(utility::clamp<int32_t, T>(acc.at(i)));
         }
 
@@ -393,17 +430,14 @@ void depthwise_loop_generic_quantized(const ITensor *input, const ITensor *weigh
             {
                 acc.at(m) += *(reinterpret_cast<int32_t *>(biases_it.ptr() + m * sizeof(int32_t)));
             }
+        }
 
-            const int out_mul   = output_multiplier.at(id.x() + m);
-            const int out_shift = output_shift.at(id.x() + m);
-            if(out_shift < 0)
-            {
-                acc.at(m) = saturating_doubling_high_mul(acc.at(m) * (1 << (-out_shift)), out_mul) + output_qoffset;
-            }
-            else
-            {
-                acc.at(m) = rounding_divide_by_exp2(saturating_doubling_high_mul(acc.at(m), out_mul), out_shift) + output_qoffset;
-            }
+        // Requantize the whole accumulator block against the channel block's multipliers
+        // and shifts; the vectors are padded to the depth multiplier so the loads stay in bounds
+        output_stage_per_channel(acc.data(), output_multiplier.data() + id.x(), output_shift.data() + id.x(), static_cast<int>(depth_multiplier), output_qoffset);
+
+        for(size_t m = 0; m < depth_multiplier; ++m)
+        {
             *(reinterpret_cast<T *>(output_it.ptr() + m * sizeof(T))) = static_cast<T>(utility::clamp<int32_t, T>(acc.at(m)));
         }
     },
@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEDirectConvolutionLayer3x3QuantizedKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+
+#include <arm_neon.h>
+
+namespace arm_compute
+{
+namespace
+{
+Status validate_arguments(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *output, const PadStrideInfo &conv_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, weights, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QASYMM8, DataType::QASYMM8_SIGNED);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights);
+    ARM_COMPUTE_RETURN_ERROR_ON(input->data_layout() != DataLayout::NHWC);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(0) != input->dimension(0));
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(weights->dimension(1) != 3 || weights->dimension(2) != 3, "Only 3x3 kernels are supported");
+    ARM_COMPUTE_RETURN_ERROR_ON(conv_info.stride().first != conv_info.stride().second);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(conv_info.stride().first != 1 && conv_info.stride().first != 2, "Only unit and double strides are supported");
+
+    if(output->total_size() != 0)
+    {
+        const TensorShape output_shape = misc::shape_calculator::compute_deep_convolution_shape(*input, *weights, conv_info);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), output_shape);
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::S32);
+    }
+    return Status{};
+}
+
+inline int8x16_t vload16(const int8_t *ptr)
+{
+    return vld1q_s8(ptr);
+}
+
+inline uint8x16_t vload16(const uint8_t *ptr)
+{
+    return vld1q_u8(ptr);
+}
+
+/** Accumulates the 8-bit products of @p a and @p b into the four lanes of @p acc */
+inline int32x4_t vdot_accumulate(int32x4_t acc, int8x16_t a, int8x16_t b)
+{
+#if defined(__ARM_FEATURE_DOTPROD)
+    return vdotq_s32(acc, a, b);
+#else  // defined(__ARM_FEATURE_DOTPROD)
+    const int16x8_t lo = vmull_s8(vget_low_s8(a), vget_low_s8(b));
+    const int16x8_t hi = vmull_s8(vget_high_s8(a), vget_high_s8(b));
+    return vpadalq_s16(vpadalq_s16(acc, lo), hi);
+#endif // defined(__ARM_FEATURE_DOTPROD)
+}
+
+inline int32x4_t vdot_accumulate(int32x4_t acc, uint8x16_t a, uint8x16_t b)
+{
+#if defined(__ARM_FEATURE_DOTPROD)
+    return vreinterpretq_s32_u32(vdotq_u32(vreinterpretq_u32_s32(acc), a, b));
+#else  // defined(__ARM_FEATURE_DOTPROD)
+    const uint16x8_t lo = vmull_u8(vget_low_u8(a), vget_low_u8(b));
+    const uint16x8_t hi = vmull_u8(vget_high_u8(a), vget_high_u8(b));
+    return vreinterpretq_s32_u32(vpadalq_u16(vpadalq_u16(vreinterpretq_u32_s32(acc), lo), hi));
+#endif // defined(__ARM_FEATURE_DOTPROD)
+}
+
+/** Accumulates the 8-bit elements of @p a into the four lanes of @p acc */
+inline int32x4_t vsum_accumulate(int32x4_t acc, int8x16_t a)
+{
+    return vpadalq_s16(acc, vpaddlq_s8(a));
+}
+
+inline int32x4_t vsum_accumulate(int32x4_t acc, uint8x16_t a)
+{
+    return vreinterpretq_s32_u32(vpadalq_u16(vreinterpretq_u32_s32(acc), vpaddlq_u8(a)));
+}
+
+inline int32_t vhorizontal_sum(int32x4_t v)
+{
+    const int32x2_t sum = vpadd_s32(vget_low_s32(v), vget_high_s32(v));
+    return vget_lane_s32(vpadd_s32(sum, sum), 0);
+}
+} // namespace
+
+NEDirectConvolutionLayer3x3QuantizedKernel::NEDirectConvolutionLayer3x3QuantizedKernel()
+    : _input(nullptr), _weights(nullptr), _output(nullptr), _conv_info()
+{
+}
+
+void NEDirectConvolutionLayer3x3QuantizedKernel::configure(const ITensor *input, const ITensor *weights, ITensor *output, const PadStrideInfo &conv_info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
+
+    // Output auto inizialitation if not yet initialized
+    const TensorShape output_shape = misc::shape_calculator::compute_deep_convolution_shape(*input->info(), *weights->info(), conv_info);
+    auto_init_if_empty(*output->info(), output_shape, 1, DataType::S32, QuantizationInfo());
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), weights->info(), output->info(), conv_info));
+
+    _input     = input;
+    _weights   = weights;
+    _output    = output;
+    _conv_info = conv_info;
+
+    // The output channels are traversed inside the kernel, so the window only spans the output pixels
+    Window win = calculate_max_window(*output->info(), Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    INEKernel::configure(win);
+}
+
+Status NEDirectConvolutionLayer3x3QuantizedKernel::validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *output, const PadStrideInfo &conv_info)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, weights, output, conv_info));
+    return Status{};
+}
+
+template <typename T>
+void NEDirectConvolutionLayer3x3QuantizedKernel::convolve(const Window &window)
+{
+    const size_t input_stride_y  = _input->info()->strides_in_bytes().y();
+    const size_t input_stride_z  = _input->info()->strides_in_bytes().z();
+    const size_t input_stride_w  = _input->info()->strides_in_bytes()[3];
+    const size_t weights_stride_y = _weights->info()->strides_in_bytes().y();
+    const size_t weights_stride_z = _weights->info()->strides_in_bytes().z();
+    const size_t weights_stride_w = _weights->info()->strides_in_bytes()[3];
+
+    const int input_width    = _input->info()->dimension(1);
+    const int input_height   = _input->info()->dimension(2);
+    const int input_channels = _input->info()->dimension(0);
+    const int output_channels = _output->info()->dimension(0);
+
+    const int conv_stride = _conv_info.stride().first;
+    const int conv_pad_left = _conv_info.pad_left();
+    const int conv_pad_top  = _conv_info.pad_top();
+
+    const int32_t input_offset   = _input->info()->quantization_info().uniform().offset;
+    const int32_t weights_offset = _weights->info()->quantization_info().uniform().offset;
+
+    const uint8_t *input_base   = _input->buffer() + _input->info()->offset_first_element_in_bytes();
+    const uint8_t *weights_base = _weights->buffer() + _weights->info()->offset_first_element_in_bytes();
+
+    Iterator output_it(_output, window);
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        // Gather the filter taps that fall inside the input; the missing ones behave as zero-point padding
+        const T *in_ptrs[9];
+        size_t   tap_offsets[9];
+        int      num_taps = 0;
+        for(int ky = 0; ky < 3; ++ky)
+        {
+            const int in_y = id.z() * conv_stride - conv_pad_top + ky;
+            if(in_y < 0 || in_y >= input_height)
+            {
+                continue;
+            }
+            for(int kx = 0; kx < 3; ++kx)
+            {
+                const int in_x = id.y() * conv_stride - conv_pad_left + kx;
+                if(in_x < 0 || in_x >= input_width)
+                {
+                    continue;
+                }
+                in_ptrs[num_taps]     = reinterpret_cast<const T *>(input_base + in_x * input_stride_y + in_y * input_stride_z + id[3] * input_stride_w);
+                tap_offsets[num_taps] = kx * weights_stride_y + ky * weights_stride_z;
+                ++num_taps;
+            }
+        }
+        const int32_t offsets_contribution = num_taps * input_channels * input_offset * weights_offset;
+
+        auto out_ptr = reinterpret_cast<int32_t *>(output_it.ptr());
+        for(int oc = 0; oc < output_channels; ++oc)
+        {
+            const uint8_t *weights_oc = weights_base + oc * weights_stride_w;
+
+            int32x4_t vacc        = vdupq_n_s32(0);
+            int32x4_t vsum_input  = vdupq_n_s32(0);
+            int32x4_t vsum_weights = vdupq_n_s32(0);
+            int32_t   acc         = 0;
+            int32_t   sum_input   = 0;
+            int32_t   sum_weights = 0;
+
+            for(int tap = 0; tap < num_taps; ++tap)
+            {
+                const T *in_ptr = in_ptrs[tap];
+                const T *w_ptr  = reinterpret_cast<const T *>(weights_oc + tap_offsets[tap]);
+
+                int ic = 0;
+                for(; ic <= input_channels - 16; ic += 16)
+                {
+                    const auto vin = vload16(in_ptr + ic);
+                    const auto vw  = vload16(w_ptr + ic);
+                    vacc         = vdot_accumulate(vacc, vin, vw);
+                    vsum_input   = vsum_accumulate(vsum_input, vin);
+                    vsum_weights = vsum_accumulate(vsum_weights, vw);
+                }
+                for(; ic < input_channels; ++ic)
+                {
+                    acc += in_ptr[ic] * w_ptr[ic];
+                    sum_input += in_ptr[ic];
+                    sum_weights += w_ptr[ic];
+                }
+            }
+
+            acc += vhorizontal_sum(vacc);
+            sum_input += vhorizontal_sum(vsum_input);
+            sum_weights += vhorizontal_sum(vsum_weights);
+
+            // Fold the asymmetric offsets into the raw accumulator
+            out_ptr[oc] = acc - input_offset * sum_weights - weights_offset * sum_input + offsets_contribution;
+        }
+    },
+    output_it);
+}
+
+void NEDirectConvolutionLayer3x3QuantizedKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    switch(_input->info()->data_type())
+    {
+        case DataType::QASYMM8:
+            convolve<uint8_t>(window);
+            break;
+        case DataType::QASYMM8_SIGNED:
+            convolve<int8_t>(window);
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Data type not supported");
+    }
+}
+} // namespace arm_compute
@@ -1065,6 +1065,116 @@ public:
     }
 };
 
+template <unsigned int kernel_size, unsigned int stridex>
+inline void convolve_row1xN_nhwc(const float *row_ptr, const float *weights_ptr, size_t src_stride_y, size_t weights_stride_y,
+                                 float32x4_t &acc0, float32x4_t &acc1, float32x4_t &acc2, float32x4_t &acc3)
+{
+    // Accumulate 4 channels for each of the 4 output values along the same X spatial dimension.
+    // The loop bounds are compile-time constants, so the compiler fully unrolls the kernel taps
+    // and keeps one weights load per tap shared across the 4 output positions.
+    for(unsigned int i = 0; i < kernel_size; ++i)
+    {
+        const float32x4_t w = wrapper::vloadq(weights_ptr + i * weights_stride_y);
+
+        acc0 = wrapper::vmla(acc0, w, wrapper::vloadq(row_ptr + (0 * stridex + i) * src_stride_y));
+        acc1 = wrapper::vmla(acc1, w, wrapper::vloadq(row_ptr + (1 * stridex + i) * src_stride_y));
+        acc2 = wrapper::vmla(acc2, w, wrapper::vloadq(row_ptr + (2 * stridex + i) * src_stride_y));
+        acc3 = wrapper::vmla(acc3, w, wrapper::vloadq(row_ptr + (3 * stridex + i) * src_stride_y));
+    }
+}
+
+template <typename V, unsigned int kernel_size, unsigned int stridex>
+class convolver_nxn_nhwc
+{
+public:
+    static void convolve(const Window &window, unsigned int num_elems_read_per_iteration,
+                         const ITensor *input, const ITensor *weights, ITensor *output, const PadStrideInfo &conv_info)
+    {
+        // Declare useful types
+        using vector_type = typename V::type;
+        using scalar_type = typename V::scalar_type;
+        using tag_type    = typename V::tag_type;
+
+        // Scalar quantities
+        const int          element_size    = input->info()->element_size();
+        const int          input_width     = input->info()->dimension(0);
+        const int          input_depth     = input->info()->dimension(2);
+        const int          input_stride_y  = input->info()->strides_in_bytes().y() / element_size;
+        const int          input_stride_z  = input->info()->strides_in_bytes().z() / element_size;
+        const int          input_stride_w  = input->info()->strides_in_bytes()[3];
+        const int          output_stride_x = output->info()->strides_in_bytes().x();
+        const int          output_stride_y = output->info()->strides_in_bytes().y();
+        const int          kernel_stride_y = weights->info()->strides_in_bytes().y() / element_size;
+        const int          kernel_stride_z = weights->info()->strides_in_bytes().z() / element_size;
+        const unsigned int conv_stride_y   = std::get<1>(conv_info.stride());
+        const unsigned int conv_pad_top    = conv_info.pad_top();
+        const unsigned int conv_pad_left   = conv_info.pad_left();
+
+        // Setup input window for the input iterator
+        Window window_in = window;
+        window_in.set(Window::DimX, Window::Dimension(0, 0, 0));
+        window_in.set(Window::DimY, Window::Dimension(0, 0, 0));
+        window_in.set(Window::DimZ, Window::Dimension(0, 0, 0));
+
+        // Setup input window for the output iterator
+        Window window_out = window;
+        window_out.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+        // Setup input window for the weights iterator
+        Window window_k = calculate_max_window(*weights->info(), Steps());
+        window_k.set(Window::DimX, Window::Dimension(0, 1, 1));
+        window_k.set(Window::DimY, Window::Dimension(0, 1, 1));
+        window_k.set(Window::DimZ, Window::Dimension(0, 1, 1));
+        window_k.set(3, Window::Dimension(0, weights->info()->dimension(3), 1));
+
+        Iterator in(input, window_in);
+        Iterator out(output, window_out);
+        Iterator k(weights, window_k);
+
+        // max_offset is the offset for the last NOT valid value in the Z dimension (spatial dimension Y for NHWC);
+        // every out-of-range read (top/bottom padding) is clamped into the zero-filled tensor padding
+        const int64_t max_offset = input_stride_z * input_depth - (input->info()->padding().bottom + input->info()->padding().top) * input_stride_y;
+        execute_window_loop(window_k, [&](const Coordinates & id_k) // loop on the batch size
+        {
+            execute_window_loop(window_out, [&](const Coordinates & id)
+            {
+                const auto y_offset = int(id.y() * stridex - conv_pad_left) * input_stride_y;
+
+                // Buffer pointers
+                const scalar_type *in_ptr      = reinterpret_cast<scalar_type *>(input->buffer() + input->info()->offset_first_element_in_bytes() + id[3] * input_stride_w);
+                const scalar_type *weights_ptr = reinterpret_cast<scalar_type *>(k.ptr());
+                uint8_t           *out_ptr     = out.ptr() + id_k[3] * output_stride_x;
+
+                // Output elements
+                vector_type out0 = wrapper::vdup_n(scalar_type(0), tag_type());
+                vector_type out1 = wrapper::vdup_n(scalar_type(0), tag_type());
+                vector_type out2 = wrapper::vdup_n(scalar_type(0), tag_type());
+                vector_type out3 = wrapper::vdup_n(scalar_type(0), tag_type());
+
+                // Reduce along the feature maps
+                for(int x = 0; x < input_width; x += num_elems_read_per_iteration)
+                {
+                    for(unsigned int z = 0; z < kernel_size; ++z)
+                    {
+                        auto in_z   = static_cast<int64_t>(id.z() * conv_stride_y - conv_pad_top + z);
+                        in_z        = std::min(static_cast<unsigned int>(in_z), static_cast<unsigned int>(input_depth));
+                        auto offset = y_offset + in_z * input_stride_z;
+                        offset      = std::min(offset, max_offset);
+                        convolve_row1xN_nhwc<kernel_size, stridex>(in_ptr + offset + x, weights_ptr + z * kernel_stride_z + x, input_stride_y, kernel_stride_y, out0, out1, out2, out3);
+                    }
+                }
+
+                *(reinterpret_cast<scalar_type *>(out_ptr + 0 * output_stride_y)) = vreduce(out0);
+                *(reinterpret_cast<scalar_type *>(out_ptr + 1 * output_stride_y)) = vreduce(out1);
+                *(reinterpret_cast<scalar_type *>(out_ptr + 2 * output_stride_y)) = vreduce(out2);
+                *(reinterpret_cast<scalar_type *>(out_ptr + 3 * output_stride_y)) = vreduce(out3);
+            },
+            in, out);
+        },
+        k);
+    }
+};
+
 template <typename T1, typename T2>
 inline void convolve_1x1(const Window &window, unsigned int num_elems_read_per_iteration, unsigned int num_elems_written_per_iteration,
                          const ITensor *input, const ITensor *weights, ITensor *output, const PadStrideInfo &conv_info)
@@ -1184,6 +1294,41 @@ inline void convolve_9x9_nhwc(const Window &window, unsigned int num_elems_read_
     }
 }
 
+template <typename V, unsigned int kernel_size>
+inline void convolve_nxn_nhwc(const Window &window, unsigned int num_elems_read_per_iteration,
+                              const ITensor *input, const ITensor *weights, ITensor *output, const PadStrideInfo &conv_info)
+{
+    const unsigned int conv_stride_x = std::get<0>(conv_info.stride());
+    switch(conv_stride_x)
+    {
+        case 1:
+            convolver_nxn_nhwc<V, kernel_size, 1>::convolve(window, num_elems_read_per_iteration, input, weights, output, conv_info);
+            break;
+        case 2:
+            convolver_nxn_nhwc<V, kernel_size, 2>::convolve(window, num_elems_read_per_iteration, input, weights, output, conv_info);
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Not implemented");
+    }
+}
+
+/** Indicates whether an optimized NHWC convolver specialized on kernel size and stride exists for this configuration */
+inline bool nhwc_direct_conv_optimized(uint32_t kernel_size, const PadStrideInfo &conv_info)
+{
+    const unsigned int conv_stride_x = std::get<0>(conv_info.stride());
+    const unsigned int conv_stride_y = std::get<1>(conv_info.stride());
+
+    if(conv_stride_x != conv_stride_y)
+    {
+        return false;
+    }
+    if(kernel_size == 9)
+    {
+        return conv_stride_x == 1;
+    }
+    return (kernel_size == 3 || kernel_size == 5) && (conv_stride_x == 1 || conv_stride_x == 2);
+}
+
 Status validate_arguments(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *output, const PadStrideInfo &conv_info)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, weights, output);
@@ -1337,15 +1482,15 @@ std::pair<Status, Window> validate_and_configure_window(ITensorInfo *input, ITen
     }
     else
     {
-        if(kernel_size == 9)
+        if(nhwc_direct_conv_optimized(kernel_size, conv_info))
         {
             border_size.left = 0;
             border_size.top  = conv_info.pad_left();
 
             const int num_elems_read_per_iteration_x    = 4;
             const int num_elems_written_per_iteration_x = 1;
-            const int num_elems_read_per_iteration_y    = 12;
             const int num_elems_written_per_iteration_y = 4;
+            const int num_elems_read_per_iteration_y    = (num_elems_written_per_iteration_y - 1) * conv_stride_x + kernel_size;
 
             num_elems_read_per_iteration    = num_elems_read_per_iteration_x;
             num_elems_written_per_iteration = num_elems_written_per_iteration_x;
@@ -1537,17 +1682,29 @@ void NEDirectConvolutionLayerKernel::run(const Window &window, const ThreadInfo
     else
     {
         const int kernel_size = _weights->info()->dimension(get_data_layout_dimension_index(_weights->info()->data_layout(), DataLayoutDimension::WIDTH));
-        const int stride_x    = std::get<0>(_conv_info.stride());
-        const int stride_y    = std::get<1>(_conv_info.stride());
 
         switch(_input->info()->data_type())
         {
             case DataType::F32:
             {
-                if(kernel_size == 9 && stride_x == 1 && stride_y == 1)
+                if(nhwc_direct_conv_optimized(kernel_size, _conv_info))
                 {
                     using vtype = wrapper::traits::neon_vector<float, 4>;
-                    convolve_9x9_nhwc<vtype>(window, _num_elems_read_per_iteration, _input, _weights, _output, _conv_info);
+                    switch(kernel_size)
+                    {
+                        case 3:
+                            convolve_nxn_nhwc<vtype, 3>(window, _num_elems_read_per_iteration, _input, _weights, _output, _conv_info);
+                            break;
+                        case 5:
+                            convolve_nxn_nhwc<vtype, 5>(window, _num_elems_read_per_iteration, _input, _weights, _output, _conv_info);
+                            break;
+                        case 9:
+                            convolve_9x9_nhwc<vtype>(window, _num_elems_read_per_iteration, _input, _weights, _output, _conv_info);
+                            break;
+                        default:
+                            ARM_COMPUTE_ERROR("Not implemented");
+                            break;
+                    }
                 }
                 else
                 {
@@ -30,6 +30,7 @@
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/core/NEON/NEAsymm.h"
 #include "arm_compute/core/NEON/NEFixedPoint.h"
+#include "arm_compute/core/NEON/kernels/detail/NEActivationFunctionDetail.h"
 #include "arm_compute/core/NEON/wrapper/wrapper.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/core/Validate.h"
@@ -45,7 +46,8 @@ namespace arm_compute
 namespace
 {
 Status validate_arguments(const ITensorInfo *input, const ITensorInfo *bias, const ITensorInfo *output,
-                          const DirectConvolutionLayerOutputStageKernelInfo &info)
+                          const DirectConvolutionLayerOutputStageKernelInfo &info,
+                          const ITensorInfo *scale, const ITensorInfo *shift, const ActivationLayerInfo &act_info)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input);
     ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input);
@@ -59,6 +61,26 @@ Status validate_arguments(const ITensorInfo *input, const ITensorInfo *bias, con
         ARM_COMPUTE_RETURN_ERROR_ON(bias->num_dimensions() > 1);
     }
 
+    if((scale != nullptr) || (shift != nullptr))
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG((scale == nullptr) || (shift == nullptr), "Scale and shift must be provided together");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(!is_data_type_float(input->data_type()), "Scale and shift are only supported for floating point input");
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, scale, shift);
+        ARM_COMPUTE_RETURN_ERROR_ON(scale->dimension(0) != input->dimension(get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::CHANNEL)));
+        ARM_COMPUTE_RETURN_ERROR_ON(scale->num_dimensions() > 1);
+        ARM_COMPUTE_RETURN_ERROR_ON(shift->dimension(0) != scale->dimension(0));
+        ARM_COMPUTE_RETURN_ERROR_ON(shift->num_dimensions() > 1);
+    }
+
+    if(act_info.enabled())
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(!is_data_type_float(input->data_type()), "Fused activation is only supported for floating point input");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG((act_info.activation() != ActivationLayerInfo::ActivationFunction::RELU)
+                                        && (act_info.activation() != ActivationLayerInfo::ActivationFunction::BOUNDED_RELU)
+                                        && (act_info.activation() != ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU),
+                                        "Activation function not supported");
+    }
+
     if(input->data_type() == DataType::S32)
     {
         ARM_COMPUTE_RETURN_ERROR_ON_MSG(output == nullptr, "In-place computation not allowed for quantized output");
@@ -87,7 +109,8 @@ Status validate_arguments(const ITensorInfo *input, const ITensorInfo *bias, con
 }
 
 std::pair<Status, Window> validate_and_configure_window(ITensorInfo *input, ITensorInfo *bias, ITensorInfo *output,
-                                                        const DirectConvolutionLayerOutputStageKernelInfo &info)
+                                                        const DirectConvolutionLayerOutputStageKernelInfo &info,
+                                                        ITensorInfo *scale, ITensorInfo *shift)
 {
     ARM_COMPUTE_ERROR_ON(input->data_layout() == DataLayout::UNKNOWN);
 
@@ -154,14 +177,23 @@ std::pair<Status, Window> validate_and_configure_window(ITensorInfo *input, ITen
         input_access.set_valid_region(win, ValidRegion(Coordinates(), input->tensor_shape()));
     }
 
+    // For NHWC the scale and shift values are loaded as vectors along the channel dimension
+    if((scale != nullptr) && (shift != nullptr) && (input->data_layout() == DataLayout::NHWC))
+    {
+        AccessWindowHorizontal scale_access(scale, 0, num_elems_processed_per_iteration);
+        AccessWindowHorizontal shift_access(shift, 0, num_elems_processed_per_iteration);
+        window_changed = update_window_and_padding(win, scale_access, shift_access) || window_changed;
+    }
+
     Status err = (window_changed) ? ARM_COMPUTE_CREATE_ERROR(ErrorCode::RUNTIME_ERROR, "Insufficient Padding!") : Status{};
     return std::make_pair(err, win);
 }
 
-template <typename T, bool has_bias>
+template <typename T, bool has_bias, bool fused_activation, typename F>
 typename std::enable_if<arm_compute::utils::traits::is_floating_point<T>::value, void>::type
 output_stage_nchw(ITensor *input, const ITensor *bias, const Window &window, ITensor *output,
-                  int result_fixedpoint_multiplier, int result_shift, int result_offset_after_shift)
+                  int result_fixedpoint_multiplier, int result_shift, int result_offset_after_shift,
+                  const ITensor *scale, const ITensor *shift, const ActivationLayerInfo &act_info)
 {
     /** NEON vector tag type. */
     using ExactTagType = typename wrapper::traits::neon_bitvector_tag_t<T, wrapper::traits::BitWidth::W128>;
@@ -171,6 +203,11 @@ output_stage_nchw(ITensor *input, const ITensor *bias, const Window &window, ITe
     ARM_COMPUTE_UNUSED(result_shift);
     ARM_COMPUTE_UNUSED(result_offset_after_shift);
 
+    const auto scale_ptr = (scale != nullptr) ? reinterpret_cast<const T *>(scale->ptr_to_element(Coordinates(0))) : nullptr;
+    const auto shift_ptr = (shift != nullptr) ? reinterpret_cast<const T *>(shift->ptr_to_element(Coordinates(0))) : nullptr;
+
+    F activation_functor(act_info);
+
     Iterator in(input, window);
     Iterator out(output, window);
     execute_window_loop(window, [&](const Coordinates & id)
@@ -186,16 +223,31 @@ output_stage_nchw(ITensor *input, const ITensor *bias, const Window &window, ITe
             v_in          = wrapper::vadd(v_in, vb);
         }
 
+        // Apply the per-channel scale and shift
+        if(scale_ptr != nullptr)
+        {
+            const auto vscale = wrapper::vdup_n(scale_ptr[id.z()], ExactTagType{});
+            const auto vshift = wrapper::vdup_n(shift_ptr[id.z()], ExactTagType{});
+            v_in              = wrapper::vmla(vshift, v_in, vscale);
+        }
+
+        // Perform fused activation
+        if(fused_activation)
+        {
+            activation_functor(v_in);
+        }
+
         const auto out_ptr = reinterpret_cast<T *>(out.ptr());
         wrapper::vstore(out_ptr, v_in);
     },
     in, out);
 }
 
-template <typename T, bool has_bias>
+template <typename T, bool has_bias, bool fused_activation, typename F>
 typename std::enable_if<arm_compute::utils::traits::is_floating_point<T>::value, void>::type
 output_stage_nhwc(ITensor *input, const ITensor *bias, const Window &window, ITensor *output,
-                  int result_fixedpoint_multiplier, int result_shift, int result_offset_after_shift)
+                  int result_fixedpoint_multiplier, int result_shift, int result_offset_after_shift,
+                  const ITensor *scale, const ITensor *shift, const ActivationLayerInfo &act_info)
 {
     ARM_COMPUTE_UNUSED(result_fixedpoint_multiplier);
     ARM_COMPUTE_UNUSED(result_shift);
@@ -206,10 +258,15 @@ output_stage_nhwc(ITensor *input, const ITensor *bias, const Window &window, ITe
     window_bias.set(Window::DimZ, Window::Dimension(0, 0, 0));
     window_bias.set(3, Window::Dimension(0, 0, 0));
 
+    const auto scale_ptr = (scale != nullptr) ? reinterpret_cast<const T *>(scale->ptr_to_element(Coordinates(0))) : nullptr;
+    const auto shift_ptr = (shift != nullptr) ? reinterpret_cast<const T *>(shift->ptr_to_element(Coordinates(0))) : nullptr;
+
+    F activation_functor(act_info);
+
     Iterator in(input, window);
     Iterator bi(bias, window_bias);
     Iterator out(output, window);
-    execute_window_loop(window, [&](const Coordinates &)
+    execute_window_loop(window, [&](const Coordinates & id)
     {
         // Get bias and pointer to input
         const auto in_ptr = reinterpret_cast<const T *>(in.ptr());
@@ -222,6 +279,18 @@ output_stage_nhwc(ITensor *input, const ITensor *bias, const Window &window, ITe
             v_in                = wrapper::vadd(v_in, wrapper::vloadq(bias_ptr));
         }
 
+        // Apply the per-channel scale and shift
+        if(scale_ptr != nullptr)
+        {
+            v_in = wrapper::vmla(wrapper::vloadq(shift_ptr + id.x()), v_in, wrapper::vloadq(scale_ptr + id.x()));
+        }
+
+        // Perform fused activation
+        if(fused_activation)
+        {
+            activation_functor(v_in);
+        }
+
         const auto out_ptr = reinterpret_cast<T *>(out.ptr());
         wrapper::vstore(out_ptr, v_in);
 
@@ -232,11 +301,16 @@ output_stage_nhwc(ITensor *input, const ITensor *bias, const Window &window, ITe
 // Quantized case
 template < typename TOut, bool has_bias, typename std::enable_if < std::is_same<TOut, uint8_t>::value || std::is_same<TOut, int8_t>::value, int >::type = 0 >
 void output_stage_nchw(ITensor *input, const ITensor *bias, const Window &window, ITensor *output,
-                       int result_fixedpoint_multiplier, int result_shift, int result_offset_after_shift)
+                       int result_fixedpoint_multiplier, int result_shift, int result_offset_after_shift,
+                       const ITensor *scale, const ITensor *shift, const ActivationLayerInfo &act_info)
 {
     using VectorType = typename wrapper::traits::neon_bitvector_t<TOut, wrapper::traits::BitWidth::W128>;
     using TagType    = typename wrapper::traits::neon_bitvector_tag_t<TOut, wrapper::traits::BitWidth::W128>;
 
+    ARM_COMPUTE_UNUSED(scale);
+    ARM_COMPUTE_UNUSED(shift);
+    ARM_COMPUTE_UNUSED(act_info);
+
     const int32x4_t result_offset_after_shift_s32 = vdupq_n_s32(result_offset_after_shift);
 
     const VectorType min = wrapper::vdup_n(std::numeric_limits<TOut>::lowest(), TagType{});
@@ -281,11 +355,16 @@ void output_stage_nchw(ITensor *input, const ITensor *bias, const Window &window
 }
 template < typename TOut, bool has_bias, typename std::enable_if < std::is_same<TOut, uint8_t>::value || std::is_same<TOut, int8_t>::value, int >::type = 0 >
 void output_stage_nhwc(ITensor *input, const ITensor *bias, const Window &window, ITensor *output,
-                       int result_fixedpoint_multiplier, int result_shift, int result_offset_after_shift)
+                       int result_fixedpoint_multiplier, int result_shift, int result_offset_after_shift,
+                       const ITensor *scale, const ITensor *shift, const ActivationLayerInfo &act_info)
 {
     using VectorType = typename wrapper::traits::neon_bitvector_t<TOut, wrapper::traits::BitWidth::W128>;
     using TagType    = typename wrapper::traits::neon_bitvector_tag_t<TOut, wrapper::traits::BitWidth::W128>;
 
+    ARM_COMPUTE_UNUSED(scale);
+    ARM_COMPUTE_UNUSED(shift);
+    ARM_COMPUTE_UNUSED(act_info);
+
     const int32x4_t result_offset_after_shift_s32 = vdupq_n_s32(result_offset_after_shift);
 
     const VectorType min = wrapper::vdup_n(std::numeric_limits<TOut>::lowest(), TagType{});
@@ -330,42 +409,91 @@ void output_stage_nhwc(ITensor *input, const ITensor *bias, const Window &window
     },
     in, bi, out);
 }
+
+using OutputStageFunction = void(ITensor *input, const ITensor *bias, const Window &window, ITensor *output,
+                                 int result_fixedpoint_multiplier, int result_shift, int result_offset_after_shift,
+                                 const ITensor *scale, const ITensor *shift, const ActivationLayerInfo &act_info);
+
+template <typename T, int S>
+OutputStageFunction *get_output_stage_float(bool is_nchw, bool has_bias, const ActivationLayerInfo &act_info)
+{
+    if(!act_info.enabled())
+    {
+        if(is_nchw)
+        {
+            return (has_bias) ? &output_stage_nchw<T, true, false, detail::dummy<T, S>> : &output_stage_nchw<T, false, false, detail::dummy<T, S>>;
+        }
+        return (has_bias) ? &output_stage_nhwc<T, true, false, detail::dummy<T, S>> : &output_stage_nhwc<T, false, false, detail::dummy<T, S>>;
+    }
+
+    switch(act_info.activation())
+    {
+        case ActivationLayerInfo::ActivationFunction::RELU:
+            if(is_nchw)
+            {
+                return (has_bias) ? &output_stage_nchw<T, true, true, detail::relu<T, S>> : &output_stage_nchw<T, false, true, detail::relu<T, S>>;
+            }
+            return (has_bias) ? &output_stage_nhwc<T, true, true, detail::relu<T, S>> : &output_stage_nhwc<T, false, true, detail::relu<T, S>>;
+        case ActivationLayerInfo::ActivationFunction::BOUNDED_RELU:
+            if(is_nchw)
+            {
+                return (has_bias) ? &output_stage_nchw<T, true, true, detail::brelu<T, S>> : &output_stage_nchw<T, false, true, detail::brelu<T, S>>;
+            }
+            return (has_bias) ? &output_stage_nhwc<T, true, true, detail::brelu<T, S>> : &output_stage_nhwc<T, false, true, detail::brelu<T, S>>;
+        case ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU:
+            if(is_nchw)
+            {
+                return (has_bias) ? &output_stage_nchw<T, true, true, detail::lubrelu<T, S>> : &output_stage_nchw<T, false, true, detail::lubrelu<T, S>>;
+            }
+            return (has_bias) ? &output_stage_nhwc<T, true, true, detail::lubrelu<T, S>> : &output_stage_nhwc<T, false, true, detail::lubrelu<T, S>>;
+        default:
+            ARM_COMPUTE_ERROR("Activation function not supported");
+            return nullptr;
+    }
+}
 } // namespace
 
 NEDirectConvolutionLayerOutputStageKernel::NEDirectConvolutionLayerOutputStageKernel()
-    : _func(nullptr), _input(nullptr), _bias(nullptr), _output(nullptr), _result_fixedpoint_multiplier(0), _result_shift(0), _result_offset_after_shift(0)
+    : _func(nullptr), _input(nullptr), _bias(nullptr), _output(nullptr), _scale(nullptr), _shift(nullptr), _act_info(), _result_fixedpoint_multiplier(0), _result_shift(0), _result_offset_after_shift(0)
 {
 }
 
 void NEDirectConvolutionLayerOutputStageKernel::configure(ITensor *input, const ITensor *bias, ITensor *output,
-                                                          const DirectConvolutionLayerOutputStageKernelInfo &info)
+                                                          const DirectConvolutionLayerOutputStageKernelInfo &info,
+                                                          const ITensor *scale, const ITensor *shift, const ActivationLayerInfo &act_info)
 {
     // Perform validation step
     ARM_COMPUTE_ERROR_ON_NULLPTR(input);
-    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), (bias == nullptr) ? nullptr : bias->info(), (output == nullptr) ? nullptr : output->info(), info));
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), (bias == nullptr) ? nullptr : bias->info(), (output == nullptr) ? nullptr : output->info(), info,
+                                                  (scale == nullptr) ? nullptr : scale->info(), (shift == nullptr) ? nullptr : shift->info(), act_info));
 
     _func                         = nullptr;
     _bias                         = bias;
     _input                        = input;
     _output                       = (output != nullptr) ? output : input;
+    _scale                        = scale;
+    _shift                        = shift;
+    _act_info                     = act_info;
     _result_fixedpoint_multiplier = info.result_fixedpoint_multiplier;
     _result_shift                 = info.result_shift;
     _result_offset_after_shift    = info.result_offset_after_shift;
 
     // Configure kernel window
-    auto win_config = validate_and_configure_window(input->info(), (bias == nullptr) ? nullptr : bias->info(), (output == nullptr) ? nullptr : output->info(), info);
+    auto win_config = validate_and_configure_window(input->info(), (bias == nullptr) ? nullptr : bias->info(), (output == nullptr) ? nullptr : output->info(), info,
+                                                    (scale == nullptr) ? nullptr : scale->info(), (shift == nullptr) ? nullptr : shift->info());
     ARM_COMPUTE_ERROR_THROW_ON(win_config.first);
     INEKernel::configure(win_config.second);
 
     const bool has_bias          = bias != nullptr;
+    const bool is_nchw           = input->info()->data_layout() == DataLayout::NCHW;
     const bool is_qasymm8_signed = (output != nullptr) ? is_data_type_quantized_asymmetric_signed(output->info()->data_type()) : false;
 
     // Set appropriate function
-    if(input->info()->data_layout() == DataLayout::NCHW)
+    switch(input->info()->data_type())
     {
-        switch(input->info()->data_type())
+        case DataType::S32:
         {
-            case DataType::S32:
+            if(is_nchw)
             {
                 if(is_qasymm8_signed)
                 {
@@ -375,31 +503,8 @@ void NEDirectConvolutionLayerOutputStageKernel::configure(ITensor *input, const
                 {
                     _func = (has_bias) ? &output_stage_nchw<uint8_t, true> : &output_stage_nchw<uint8_t, false>;
                 }
-                break;
-            }
-#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
-            case DataType::F16:
-            {
-                _func = (has_bias) ? &output_stage_nchw<float16_t, true> : &output_stage_nchw<float16_t, false>;
-                break;
-            }
-#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
-            case DataType::F32:
-            {
-                _func = (has_bias) ? &output_stage_nchw<float, true> : &output_stage_nchw<float, false>;
-                break;
-            }
-            default:
-            {
-                ARM_COMPUTE_ERROR("Unsupported combination of types among the inputs.");
             }
-        }
-    }
-    else
-    {
-        switch(input->info()->data_type())
-        {
-            case DataType::S32:
+            else
             {
                 if(is_qasymm8_signed)
                 {
@@ -409,36 +514,39 @@ void NEDirectConvolutionLayerOutputStageKernel::configure(ITensor *input, const
                 {
                     _func = (has_bias) ? &output_stage_nhwc<uint8_t, true> : &output_stage_nhwc<uint8_t, false>;
                 }
-                break;
             }
+            break;
+        }
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
-            case DataType::F16:
-            {
-                _func = (has_bias) ? &output_stage_nhwc<float16_t, true> : &output_stage_nhwc<float16_t, false>;
-                break;
-            }
+        case DataType::F16:
+        {
+            _func = get_output_stage_float<float16_t, 8>(is_nchw, has_bias, act_info);
+            break;
+        }
 #endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
-            case DataType::F32:
-            {
-                _func = (has_bias) ? &output_stage_nhwc<float, true> : &output_stage_nhwc<float, false>;
-                break;
-            }
-            default:
-            {
-                ARM_COMPUTE_ERROR("Unsupported combination of types among the inputs.");
-            }
+        case DataType::F32:
+        {
+            _func = get_output_stage_float<float, 4>(is_nchw, has_bias, act_info);
+            break;
+        }
+        default:
+        {
+            ARM_COMPUTE_ERROR("Unsupported combination of types among the inputs.");
         }
     }
 }
 
 Status NEDirectConvolutionLayerOutputStageKernel::validate(const ITensorInfo *input, const ITensorInfo *bias, const ITensorInfo *output,
-                                                           const DirectConvolutionLayerOutputStageKernelInfo &info)
+                                                           const DirectConvolutionLayerOutputStageKernelInfo &info,
+                                                           const ITensorInfo *scale, const ITensorInfo *shift, const ActivationLayerInfo &act_info)
 {
-    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, bias, output, info));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, bias, output, info, scale, shift, act_info));
     ARM_COMPUTE_RETURN_ON_ERROR(validate_and_configure_window(input->clone().get(),
                                                               bias == nullptr ? nullptr : bias->clone().get(),
                                                               output == nullptr ? nullptr : output->clone().get(),
-                                                              info)
+                                                              info,
+                                                              scale == nullptr ? nullptr : scale->clone().get(),
+                                                              shift == nullptr ? nullptr : shift->clone().get())
                                 .first);
 
     return Status{};
@@ -451,6 +559,6 @@ void NEDirectConvolutionLayerOutputStageKernel::run(const Window &window, const
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
     ARM_COMPUTE_ERROR_ON(_func == nullptr);
 
-    (*_func)(_input, _bias, window, _output, _result_fixedpoint_multiplier, _result_shift, _result_offset_after_shift);
+    (*_func)(_input, _bias, window, _output, _result_fixedpoint_multiplier, _result_shift, _result_offset_after_shift, _scale, _shift, _act_info);
 }
 } // namespace arm_compute
@@ -31,7 +31,10 @@
 #include "arm_compute/core/NEON/wrapper/wrapper.h"
 
 #include <arm_neon.h>
-#include <map>
+
+#if defined(__ARM_FEATURE_SVE)
+#include <arm_sve.h>
+#endif /* defined(__ARM_FEATURE_SVE) */
 
 namespace arm_compute
 {
@@ -1054,69 +1057,166 @@ void elementwise_comp_op_quantized_signed(const ITensor *in1, const ITensor *in2
                                       &elementwise_comp_op_quantized_signed_loop<op>);
 }
 
-std::function<void(const ITensor *, const ITensor *, ITensor *, const Window &)>
-configure_func(const ITensorInfo *input1, const ITensorInfo *input2, ITensorInfo *output,
-               std::map<std::string, NEElementwiseOperationKernel::ElementwiseFunction *> map_function)
+#if defined(__ARM_FEATURE_SVE)
+template <ArithmeticOperation op>
+inline svfloat32_t elementwise_arithm_op_sve(svbool_t pg, const svfloat32_t &a, const svfloat32_t &b)
 {
-    std::string function_to_call("op_");
-    function_to_call += string_from_data_type(input1->data_type()) + "_";
-    function_to_call += string_from_data_type(input2->data_type()) + "_";
-    function_to_call += string_from_data_type(output->data_type());
+    svfloat32_t res = svdup_n_f32(0.f);
 
-    auto it = map_function.find(function_to_call);
-
-    if(it != map_function.end())
+    switch(op)
     {
-        auto func = it->second;
-        return [func](const ITensor * input1, const ITensor * input2, ITensor * output, const Window & window)
+        case ArithmeticOperation::MAX:
+            res = svmax_f32_z(pg, a, b);
+            break;
+        case ArithmeticOperation::MIN:
+            res = svmin_f32_z(pg, a, b);
+            break;
+        case ArithmeticOperation::SQUARED_DIFF:
         {
-            func(input1, input2, output, window);
-        };
+            const svfloat32_t tmp = svsub_f32_z(pg, a, b);
+            res                   = svmul_f32_z(pg, tmp, tmp);
+            break;
+        }
+        case ArithmeticOperation::PRELU:
+            res = svsel_f32(svcmpgt_f32(pg, a, svdup_n_f32(0.f)), a, svmul_f32_z(pg, a, b));
+            break;
+        case ArithmeticOperation::DIV:
+            res = svdiv_f32_z(pg, a, b);
+            break;
+        default:
+            ARM_COMPUTE_ERROR("NOT_SUPPORTED!");
     }
-    return nullptr;
+
+    return res;
 }
 
 template <ArithmeticOperation op>
-std::function<void(const ITensor *, const ITensor *, ITensor *, const Window &)>
-configure_arithm_func(const ITensorInfo *input1, const ITensorInfo *input2, ITensorInfo *output)
+inline int elementwise_arithm_op_sve_loop(int window_start_x, int window_end_x, int window_step_x,
+                                          const float *input1_ptr, const float *input2_ptr, float *output_ptr)
 {
-    static std::map<std::string, NEElementwiseOperationKernel::ElementwiseFunction *> map_function =
+    ARM_COMPUTE_UNUSED(window_step_x);
+    int64_t  x  = window_start_x;
+    svbool_t pg = svwhilelt_b32(x, static_cast<int64_t>(window_end_x));
+    do
     {
-        { "op_F32_F32_F32", &elementwise_arithm_op<op, typename wrapper::traits::neon_vector<float, 4>> },
-        { "op_S16_S16_S16", &elementwise_arithm_op<op, typename wrapper::traits::neon_vector<int16_t, 8>> },
-        { "op_S32_S32_S32", &elementwise_arithm_op<op, typename wrapper::traits::neon_vector<int32_t, 4>> },
-        { "op_QASYMM8_QASYMM8_QASYMM8", &elementwise_arithm_op_quantized<op> },
-        { "op_QASYMM8_SIGNED_QASYMM8_SIGNED_QASYMM8_SIGNED", &elementwise_arithm_op_quantized_signed<op> }
-    };
+        const svfloat32_t a = svld1_f32(pg, input1_ptr + x);
+        const svfloat32_t b = svld1_f32(pg, input2_ptr + x);
+        svst1_f32(pg, output_ptr + x, elementwise_arithm_op_sve<op>(pg, a, b));
+        x += svcntw();
+        pg = svwhilelt_b32(x, static_cast<int64_t>(window_end_x));
+    }
+    while(svptest_any(svptrue_b32(), pg));
+    // The governing predicate absorbed the row tail, so nothing is left for the scalar loop
+    return window_end_x;
+}
+
+template <ArithmeticOperation op>
+inline int elementwise_arithm_op_sve_broadcast_loop(int window_start_x, int window_end_x, int window_step_x,
+                                                    const float *non_broadcast_input_ptr, const float &broadcast_value, float *output_ptr, const bool reorder)
+{
+    ARM_COMPUTE_UNUSED(window_step_x);
+    const svfloat32_t broadcast_vector = svdup_n_f32(broadcast_value);
+
+    int64_t  x  = window_start_x;
+    svbool_t pg = svwhilelt_b32(x, static_cast<int64_t>(window_end_x));
+    do
+    {
+        const svfloat32_t a = svld1_f32(pg, non_broadcast_input_ptr + x);
+        svst1_f32(pg, output_ptr + x, elementwise_arithm_op_sve<op>(pg, reorder ? broadcast_vector : a, reorder ? a : broadcast_vector));
+        x += svcntw();
+        pg = svwhilelt_b32(x, static_cast<int64_t>(window_end_x));
+    }
+    while(svptest_any(svptrue_b32(), pg));
+    return window_end_x;
+}
+
+template <ArithmeticOperation op>
+void elementwise_arithm_op_sve_f32(const ITensor *in1, const ITensor *in2, ITensor *out, const Window &window)
+{
+    elementwise_op<float, float, typename wrapper::traits::neon_vector<float, 4>>(in1, in2, out, window,
+                                                                                  &elementwise_arithm_op_scalar<op, float>,
+                                                                                  &elementwise_arithm_op_sve_broadcast_loop<op>,
+                                                                                  &elementwise_arithm_op_sve_loop<op>);
+}
+#endif /* defined(__ARM_FEATURE_SVE) */
+
+// The (operation, type) pairs are resolved at compile time into fully specialized instantiations,
+// so configuration reduces to picking a plain function pointer with no type erasure involved
+
+template <ArithmeticOperation op>
+NEElementwiseOperationKernel::ElementwiseFunction *configure_arithm_func(const ITensorInfo *input1, const ITensorInfo *input2, ITensorInfo *output)
+{
+    ARM_COMPUTE_UNUSED(input2, output);
+
+    switch(input1->data_type())
+    {
+        case DataType::F32:
+            return &elementwise_arithm_op<op, typename wrapper::traits::neon_vector<float, 4>>;
+        case DataType::S16:
+            return &elementwise_arithm_op<op, typename wrapper::traits::neon_vector<int16_t, 8>>;
+        case DataType::S32:
+            return &elementwise_arithm_op<op, typename wrapper::traits::neon_vector<int32_t, 4>>;
+        case DataType::QASYMM8:
+            return &elementwise_arithm_op_quantized<op>;
+        case DataType::QASYMM8_SIGNED:
+            return &elementwise_arithm_op_quantized_signed<op>;
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
-    map_function["op_F16_F16_F16"] = &elementwise_arithm_op<op, typename wrapper::traits::neon_vector<float16_t, 8>>;
+        case DataType::F16:
+            return &elementwise_arithm_op<op, typename wrapper::traits::neon_vector<float16_t, 8>>;
 #endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+        default:
+            return nullptr;
+    }
+}
 
-    return configure_func(input1, input2, output, map_function);
+#if defined(__ARM_FEATURE_SVE)
+template <ArithmeticOperation op>
+NEElementwiseOperationKernel::ElementwiseFunction *configure_arithm_func_sve(const ITensorInfo *input1, const ITensorInfo *input2, ITensorInfo *output)
+{
+    ARM_COMPUTE_UNUSED(input2, output);
+
+    // Only FP32 has scalable-vector loops; the remaining types keep the NEON path
+    if(input1->data_type() == DataType::F32)
+    {
+        return &elementwise_arithm_op_sve_f32<op>;
+    }
+    return nullptr;
 }
+#endif /* defined(__ARM_FEATURE_SVE) */
 
 template <ComparisonOperation op>
-std::function<void(const ITensor *input1, const ITensor *input2, ITensor *output, const Window &window)>
-configure_comp_func(const ITensorInfo *input1, const ITensorInfo *input2, ITensorInfo *output)
+NEElementwiseOperationKernel::ElementwiseFunction *configure_comp_func(const ITensorInfo *input1, const ITensorInfo *input2, ITensorInfo *output)
 {
-    static std::map<std::string, NEElementwiseOperationKernel::ElementwiseFunction *> map_function =
+    ARM_COMPUTE_UNUSED(input2, output);
+
+    switch(input1->data_type())
     {
-        { "op_F32_F32_U8", &elementwise_comp_op_32<op, float, float32x4_t> },
-        { "op_S16_S16_U8", &elementwise_comp_op_16<op, int16_t, int16x8_t> },
-        { "op_S32_S32_U8", &elementwise_comp_op_32<op, int32_t, int32x4_t> },
-        { "op_QASYMM8_SIGNED_QASYMM8_SIGNED_U8", &elementwise_comp_op_quantized_signed<op> },
-        { "op_QASYMM8_QASYMM8_U8", &elementwise_comp_op_quantized<op> }
-    };
+        case DataType::F32:
+            return &elementwise_comp_op_32<op, float, float32x4_t>;
+        case DataType::S16:
+            return &elementwise_comp_op_16<op, int16_t, int16x8_t>;
+        case DataType::S32:
+            return &elementwise_comp_op_32<op, int32_t, int32x4_t>;
+        case DataType::QASYMM8:
+            return &elementwise_comp_op_quantized<op>;
+        case DataType::QASYMM8_SIGNED:
+            return &elementwise_comp_op_quantized_signed<op>;
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
-    map_function["op_F16_F16_U8"] = &elementwise_comp_op_16<op, float16_t, float16x8_t>;
+        case DataType::F16:
+            return &elementwise_comp_op_16<op, float16_t, float16x8_t>;
 #endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
-
-    return configure_func(input1, input2, output, map_function);
+        default:
+            return nullptr;
+    }
 }
 } // namespace
 
 NEElementwiseOperationKernel::NEElementwiseOperationKernel()
+#if defined(__ARM_FEATURE_SVE)
+    : _function(nullptr), _sve_function(nullptr), _input1(nullptr), _input2(nullptr), _output(nullptr)
+#else  /* defined(__ARM_FEATURE_SVE) */
     : _function(nullptr), _input1(nullptr), _input2(nullptr), _output(nullptr)
+#endif /* defined(__ARM_FEATURE_SVE) */
 {
 }
 
@@ -1163,9 +1263,19 @@ void NEElementwiseOperationKernel::run_op(ITensorPack &tensors, const Window &wi
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
     ARM_COMPUTE_ERROR_ON(_function == nullptr);
-    _function(tensors.get_const_tensor(TensorType::ACL_SRC_0),
-              tensors.get_const_tensor(TensorType::ACL_SRC_1),
-              tensors.get_tensor(TensorType::ACL_DST), window);
+
+    ElementwiseFunction *function = _function;
+#if defined(__ARM_FEATURE_SVE)
+    // Prefer the scalable-vector variant when the core implements SVE
+    if(_sve_function != nullptr && info.cpu_info != nullptr && info.cpu_info->has_sve())
+    {
+        function = _sve_function;
+    }
+#endif /* defined(__ARM_FEATURE_SVE) */
+
+    function(tensors.get_const_tensor(TensorType::ACL_SRC_0),
+             tensors.get_const_tensor(TensorType::ACL_SRC_1),
+             tensors.get_tensor(TensorType::ACL_DST), window);
 }
 
 /** Arithmetic operators (min, max, squared_diff) */
@@ -1177,15 +1287,27 @@ void NEArithmeticOperationKernel::configure(ArithmeticOperation op, const ITenso
     {
         case ArithmeticOperation::MAX:
             _function = configure_arithm_func<ArithmeticOperation::MAX>(input1, input2, output);
+#if defined(__ARM_FEATURE_SVE)
+            _sve_function = configure_arithm_func_sve<ArithmeticOperation::MAX>(input1, input2, output);
+#endif /* defined(__ARM_FEATURE_SVE) */
             break;
         case ArithmeticOperation::MIN:
             _function = configure_arithm_func<ArithmeticOperation::MIN>(input1, input2, output);
+#if defined(__ARM_FEATURE_SVE)
+            _sve_function = configure_arithm_func_sve<ArithmeticOperation::MIN>(input1, input2, output);
+#endif /* defined(__ARM_FEATURE_SVE) */
             break;
         case ArithmeticOperation::SQUARED_DIFF:
             _function = configure_arithm_func<ArithmeticOperation::SQUARED_DIFF>(input1, input2, output);
+#if defined(__ARM_FEATURE_SVE)
+            _sve_function = configure_arithm_func_sve<ArithmeticOperation::SQUARED_DIFF>(input1, input2, output);
+#endif /* defined(__ARM_FEATURE_SVE) */
             break;
         case ArithmeticOperation::PRELU:
             _function = configure_arithm_func<ArithmeticOperation::PRELU>(input1, input2, output);
+#if defined(__ARM_FEATURE_SVE)
+            _sve_function = configure_arithm_func_sve<ArithmeticOperation::PRELU>(input1, input2, output);
+#endif /* defined(__ARM_FEATURE_SVE) */
             break;
         default:
             ARM_COMPUTE_ERROR("NOT_SUPPORTED!");
@@ -1217,6 +1339,9 @@ void NEDivisionOperationKernel::configure(const ITensorInfo *input1, const ITens
     ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(*input1, *input2, *output));
     configure_common(input1, input2, output);
     _function = configure_arithm_func<ArithmeticOperation::DIV>(input1, input2, output);
+#if defined(__ARM_FEATURE_SVE)
+    _sve_function = configure_arithm_func_sve<ArithmeticOperation::DIV>(input1, input2, output);
+#endif /* defined(__ARM_FEATURE_SVE) */
 }
 
 Status NEDivisionOperationKernel::validate_arguments(const ITensorInfo &input1, const ITensorInfo &input2, const ITensorInfo &output)
@@ -33,6 +33,8 @@
 #include "arm_compute/core/Window.h"
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
 
+#include <arm_neon.h>
+
 namespace arm_compute
 {
 namespace
@@ -130,6 +132,54 @@ void NEGatherKernel::gather_n_axis(const Window &window, const ThreadInfo &info)
     output_it);
 }
 
+template <typename U>
+void NEGatherKernel::gather_1_axis_row(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+
+    // Validate that the indices are not negative
+    validate_indices<U>(_indices);
+
+    const size_t row_size    = _input->info()->dimension(0) * _input->info()->element_size();
+    const size_t in_stride_y = _input->info()->strides_in_bytes()[1];
+    const size_t in_stride_z = _input->info()->strides_in_bytes()[2];
+    const size_t in_stride_w = _input->info()->strides_in_bytes()[3];
+
+    const uint8_t *const in_base     = _input->buffer() + _input->info()->offset_first_element_in_bytes();
+    const auto           indices_ptr = reinterpret_cast<const U *>(_indices->buffer() + _indices->info()->offset_first_element_in_bytes());
+
+    const int indices_end = window.y().end();
+
+    Window output_window{ window };
+    output_window.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator output_it(_output, output_window);
+    execute_window_loop(output_window, [&](const Coordinates & id)
+    {
+        const uint8_t *const in_row = in_base + indices_ptr[id[1]] * in_stride_y + id[2] * in_stride_z + id[3] * in_stride_w;
+
+        // Prefetch the next indexed row while the current one is being copied
+        if(id[1] + 1 < indices_end)
+        {
+            __builtin_prefetch(in_base + indices_ptr[id[1] + 1] * in_stride_y + id[2] * in_stride_z + id[3] * in_stride_w);
+        }
+
+        uint8_t *const out_row = output_it.ptr();
+
+        size_t x = 0;
+        for(; x + 32 <= row_size; x += 32)
+        {
+            vst1q_u8(out_row + x, vld1q_u8(in_row + x));
+            vst1q_u8(out_row + x + 16, vld1q_u8(in_row + x + 16));
+        }
+        for(; x < row_size; ++x)
+        {
+            out_row[x] = in_row[x];
+        }
+    },
+    output_it);
+}
+
 void NEGatherKernel::configure(const ITensor *input, const ITensor *indices, ITensor *output, int axis)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, output, indices);
@@ -161,6 +211,22 @@ void NEGatherKernel::configure(const ITensor *input, const ITensor *indices, ITe
                 break;
         }
     }
+    else if(1 == _axis)
+    {
+        // The gathered rows are contiguous in memory, copy them with wide vectors and prefetch
+        switch(_indices->info()->data_type())
+        {
+            case DataType::U32:
+                _func = &NEGatherKernel::gather_1_axis_row<uint32_t>;
+                break;
+            case DataType::S32:
+                _func = &NEGatherKernel::gather_1_axis_row<int32_t>;
+                break;
+            default:
+                ARM_COMPUTE_ERROR("Not supported");
+                break;
+        }
+    }
     else
     {
         switch(_indices->info()->data_type())
@@ -131,7 +131,9 @@ void NEHistogramKernel::histogram_fixed_U8(Window win, const ThreadInfo &info)
     ARM_COMPUTE_UNUSED(info);
     ARM_COMPUTE_ERROR_ON(_output->buffer() == nullptr);
 
-    std::array<uint32_t, _max_range_size> local_hist{ { 0 } };
+    // Four interleaved private copies: runs of equal pixels (flat image regions) would
+    // otherwise hammer a single counter, serializing on the store-to-load dependency
+    std::array<uint32_t, 4 * _max_range_size> local_hist{ { 0 } };
 
     const int x_start = win.x().start();
     const int x_end   = win.x().end();
@@ -153,14 +155,14 @@ void NEHistogramKernel::histogram_fixed_U8(Window win, const ThreadInfo &info)
         {
             const uint8x8_t pixels = vld1_u8(input.ptr() + x);
 
-            ++local_hist[vget_lane_u8(pixels, 0)];
-            ++local_hist[vget_lane_u8(pixels, 1)];
-            ++local_hist[vget_lane_u8(pixels, 2)];
-            ++local_hist[vget_lane_u8(pixels, 3)];
-            ++local_hist[vget_lane_u8(pixels, 4)];
-            ++local_hist[vget_lane_u8(pixels, 5)];
-            ++local_hist[vget_lane_u8(pixels, 6)];
-            ++local_hist[vget_lane_u8(pixels, 7)];
+            ++local_hist[0 * _max_range_size + vget_lane_u8(pixels, 0)];
+            ++local_hist[1 * _max_range_size + vget_lane_u8(pixels, 1)];
+            ++local_hist[2 * _max_range_size + vget_lane_u8(pixels, 2)];
+            ++local_hist[3 * _max_range_size + vget_lane_u8(pixels, 3)];
+            ++local_hist[0 * _max_range_size + vget_lane_u8(pixels, 4)];
+            ++local_hist[1 * _max_range_size + vget_lane_u8(pixels, 5)];
+            ++local_hist[2 * _max_range_size + vget_lane_u8(pixels, 6)];
+            ++local_hist[3 * _max_range_size + vget_lane_u8(pixels, 7)];
         }
 
         // Process leftover pixels
@@ -171,6 +173,16 @@ void NEHistogramKernel::histogram_fixed_U8(Window win, const ThreadInfo &info)
     },
     input);
 
+    // Fold the private copies into the first one
+    for(unsigned int b = 0; b < _max_range_size; b += 4)
+    {
+        uint32x4_t sum = vld1q_u32(local_hist.data() + b);
+        sum            = vaddq_u32(sum, vld1q_u32(local_hist.data() + 1 * _max_range_size + b));
+        sum            = vaddq_u32(sum, vld1q_u32(local_hist.data() + 2 * _max_range_size + b));
+        sum            = vaddq_u32(sum, vld1q_u32(local_hist.data() + 3 * _max_range_size + b));
+        vst1q_u32(local_hist.data() + b, sum);
+    }
+
     // Merge histograms
     merge_histogram(_output->buffer(), local_hist.data(), _max_range_size);
 }
@@ -35,18 +35,33 @@
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
 
 #include <arm_neon.h>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <tuple>
+#include <vector>
 
 using namespace arm_compute;
 using namespace misc::shape_calculator;
 
 namespace
 {
+TensorShape compute_output_shape(const ITensorInfo *input, const Size2D &kernel_dims, const PadStrideInfo &conv_info,
+                                 bool has_bias, const Size2D &dilation, bool interleave_output)
+{
+    TensorShape output_shape = compute_im2col_conv_shape(input, kernel_dims, conv_info, has_bias, dilation, false);
+    if(interleave_output)
+    {
+        // Same layout as @ref NEGEMMInterleave4x4Kernel would produce from the column matrix
+        output_shape.set(0, output_shape[0] * 4);
+        output_shape.set(1, std::ceil(output_shape[1] / 4.0f));
+    }
+    return output_shape;
+}
+
 Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, const Size2D &kernel_dims, const PadStrideInfo &conv_info,
-                          bool has_bias, const Size2D &dilation, unsigned int num_groups)
+                          bool has_bias, const Size2D &dilation, unsigned int num_groups, bool interleave_output)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input);
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QASYMM8, DataType::QASYMM8_SIGNED, DataType::BFLOAT16, DataType::F16, DataType::F32);
@@ -56,7 +71,7 @@ Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, c
 
     if(output->total_size() > 0)
     {
-        TensorInfo expected_output = output->clone()->set_tensor_shape(compute_im2col_conv_shape(input, kernel_dims, conv_info, has_bias, dilation, false));
+        TensorInfo expected_output = output->clone()->set_tensor_shape(compute_output_shape(input, kernel_dims, conv_info, has_bias, dilation, interleave_output));
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(&expected_output, output);
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_QUANTIZATION_INFO(input, output);
@@ -66,7 +81,7 @@ Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, c
 }
 
 std::pair<Status, Window> validate_and_configure_window(ITensorInfo *input, ITensorInfo *output, const Size2D &kernel_dims, const PadStrideInfo &conv_info,
-                                                        bool has_bias, const Size2D &dilation)
+                                                        bool has_bias, const Size2D &dilation, bool interleave_output)
 {
     const unsigned int width_idx   = get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::WIDTH);
     const unsigned int height_idx  = get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::HEIGHT);
@@ -77,7 +92,7 @@ std::pair<Status, Window> validate_and_configure_window(ITensorInfo *input, ITen
                                                                              conv_info, dilation);
 
     // Output tensor auto initialization if not yet initialized
-    auto_init_if_empty(*output, input->clone()->set_tensor_shape(compute_im2col_conv_shape(input, kernel_dims, conv_info, has_bias, dilation, false)));
+    auto_init_if_empty(*output, input->clone()->set_tensor_shape(compute_output_shape(input, kernel_dims, conv_info, has_bias, dilation, interleave_output)));
 
     Window win = calculate_max_window(*input, Steps());
     win.set(width_idx, Window::Dimension(0, convolved_dims.first, 1));
@@ -291,6 +306,15 @@ void NEIm2ColKernel::run_im2col(const Window &window)
     Iterator in(_input, window_in_out);
     Iterator out(_output, window_in_out);
 
+    // In fused mode each row is linearized into a cache-resident buffer first and then
+    // scattered into its interleaved position, so the column matrix is written only once
+    std::vector<T> row_buffer;
+    const int      row_elems = _output->info()->dimension(0) / (_interleave_output ? 4 : 1);
+    if(_interleave_output)
+    {
+        row_buffer.resize(row_elems);
+    }
+
     execute_window_loop(window, [&](const Coordinates & id)
     {
         const int start_w = id[width_idx] * stride_x - pad_left;
@@ -298,7 +322,8 @@ void NEIm2ColKernel::run_im2col(const Window &window)
 
         // Get pointers
         const uint8_t *const input_ptr  = in.ptr();
-        auto                 output_ptr = reinterpret_cast<T *>(out.ptr() + (id[width_idx] + id[height_idx] * _convolved_dims.first) * _output->info()->strides_in_bytes().y());
+        auto                 output_ptr = _interleave_output ? row_buffer.data() : reinterpret_cast<T *>(out.ptr() + (id[width_idx] + id[height_idx] * _convolved_dims.first) *
+                                                                                                        _output->info()->strides_in_bytes().y());
 
         // Linearize volume
         if(is_nchw)
@@ -338,20 +363,32 @@ void NEIm2ColKernel::run_im2col(const Window &window)
                                                _dilation.x(),
                                                _dilation.y());
         }
+
+        if(_interleave_output)
+        {
+            // Scatter the linearized row into the 4x4 interleaved block layout consumed by NEGEMMMatrixMultiplyKernel
+            const int row       = id[width_idx] + id[height_idx] * _convolved_dims.first;
+            T *const  out_block = reinterpret_cast<T *>(out.ptr() + (row / 4) * _output->info()->strides_in_bytes().y()) + (row % 4);
+            for(int e = 0; e < row_elems; ++e)
+            {
+                out_block[e * 4] = row_buffer[e];
+            }
+        }
     },
     in, out);
 }
 
 NEIm2ColKernel::NEIm2ColKernel()
-    : _func(), _input(nullptr), _output(nullptr), _convolved_dims(), _conv_info(), _kernel_width(0), _kernel_height(0), _has_bias(false), _dilation(1U, 1U), _data_layout(DataLayout::UNKNOWN)
+    : _func(), _input(nullptr), _output(nullptr), _convolved_dims(), _conv_info(), _kernel_width(0), _kernel_height(0), _has_bias(false), _dilation(1U, 1U), _data_layout(DataLayout::UNKNOWN),
+      _interleave_output(false)
 {
 }
 
 void NEIm2ColKernel::configure(const ITensor *input, ITensor *output, const Size2D &kernel_dims, const PadStrideInfo &conv_info,
-                               bool has_bias, const Size2D &dilation, unsigned int num_groups)
+                               bool has_bias, const Size2D &dilation, unsigned int num_groups, bool interleave_output)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
-    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), output->info(), kernel_dims, conv_info, has_bias, dilation, num_groups));
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), output->info(), kernel_dims, conv_info, has_bias, dilation, num_groups, interleave_output));
     ARM_COMPUTE_UNUSED(num_groups);
 
     _data_layout                  = input->info()->data_layout();
@@ -367,7 +404,8 @@ void NEIm2ColKernel::configure(const ITensor *input, ITensor *output, const Size
     _convolved_dims = scaled_dimensions(input->info()->dimension(width_idx), input->info()->dimension(height_idx),
                                         _kernel_width, _kernel_height,
                                         _conv_info, _dilation);
-    _has_bias = has_bias;
+    _has_bias          = has_bias;
+    _interleave_output = interleave_output;
 
     if(_data_layout == DataLayout::NCHW)
     {
@@ -425,16 +463,16 @@ void NEIm2ColKernel::configure(const ITensor *input, ITensor *output, const Size
     }
 
     // Configure kernel window
-    auto win_config = validate_and_configure_window(input->info(), output->info(), kernel_dims, conv_info, has_bias, dilation);
+    auto win_config = validate_and_configure_window(input->info(), output->info(), kernel_dims, conv_info, has_bias, dilation, interleave_output);
     ARM_COMPUTE_ERROR_THROW_ON(win_config.first);
     INEKernel::configure(win_config.second);
 }
 
 Status NEIm2ColKernel::validate(const ITensorInfo *input, const ITensorInfo *output, const Size2D &kernel_dims, const PadStrideInfo &conv_info,
-                                bool has_bias, const Size2D &dilation, unsigned int num_groups)
+                                bool has_bias, const Size2D &dilation, unsigned int num_groups, bool interleave_output)
 {
-    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, output, kernel_dims, conv_info, has_bias, dilation, num_groups));
-    ARM_COMPUTE_RETURN_ON_ERROR(validate_and_configure_window(input->clone().get(), output->clone().get(), kernel_dims, conv_info, has_bias, dilation).first);
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, output, kernel_dims, conv_info, has_bias, dilation, num_groups, interleave_output));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_and_configure_window(input->clone().get(), output->clone().get(), kernel_dims, conv_info, has_bias, dilation, interleave_output).first);
     return Status{};
 }
 
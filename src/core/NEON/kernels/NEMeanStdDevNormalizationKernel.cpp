@@ -36,7 +36,7 @@ namespace arm_compute
 {
 namespace
 {
-Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, float epsilon)
+Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, float epsilon, const ITensorInfo *gamma, const ITensorInfo *beta)
 {
     ARM_COMPUTE_UNUSED(epsilon);
     ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input);
@@ -44,6 +44,17 @@ Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, f
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(input->num_dimensions() > 2, "Input tensor cannot have more than 2 dimensions");
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F16, DataType::F32);
 
+    // Checks performed when the fused scale/shift epilogue is used
+    for(const ITensorInfo *epilogue : { gamma, beta })
+    {
+        if(epilogue != nullptr)
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, epilogue);
+            ARM_COMPUTE_RETURN_ERROR_ON(epilogue->num_dimensions() > 1);
+            ARM_COMPUTE_RETURN_ERROR_ON(epilogue->dimension(0) != input->dimension(0));
+        }
+    }
+
     // Checks performed when output is configured
     if((output != nullptr) && (output->total_size() != 0))
     {
@@ -90,6 +101,10 @@ void NEMeanStdDevNormalizationKernel::mean_stddev_normalization(const Window &wi
     Iterator input(_input, win);
     Iterator output(_output, win);
 
+    // The scale/shift tensors are 1D and indexed by x only, hence accessed directly
+    const auto gamma_ptr = (_gamma != nullptr) ? reinterpret_cast<const ScalarType *>(_gamma->buffer() + _gamma->info()->offset_first_element_in_bytes()) : nullptr;
+    const auto beta_ptr  = (_beta != nullptr) ? reinterpret_cast<const ScalarType *>(_beta->buffer() + _beta->info()->offset_first_element_in_bytes()) : nullptr;
+
     execute_window_loop(win, [&](const Coordinates &)
     {
         int  x       = window_start_x;
@@ -131,35 +146,63 @@ void NEMeanStdDevNormalizationKernel::mean_stddev_normalization(const Window &wi
 
         auto mean_vec       = wrapper::vdup_n(mean, ExactTagType{});
         auto stddev_inv_vec = wrapper::vdup_n(stddev_inv, ExactTagType{});
-        for(x = window_start_x; x <= (window_end_x - window_step_x); x += window_step_x)
+        if(gamma_ptr == nullptr && beta_ptr == nullptr)
         {
-            auto data = wrapper::vloadq(in_ptr + x);
-            auto res  = wrapper::vmul(wrapper::vsub(data, mean_vec), stddev_inv_vec);
-            // Store results
-            wrapper::vstore(out_ptr + x, res);
+            for(x = window_start_x; x <= (window_end_x - window_step_x); x += window_step_x)
+            {
+                auto data = wrapper::vloadq(in_ptr + x);
+                auto res  = wrapper::vmul(wrapper::vsub(data, mean_vec), stddev_inv_vec);
+                // Store results
+                wrapper::vstore(out_ptr + x, res);
+            }
+            for(; x < window_end_x; ++x)
+            {
+                *(out_ptr + x) = (*(in_ptr + x) - mean) * stddev_inv;
+            }
         }
-        for(; x < window_end_x; ++x)
+        else
         {
-            *(out_ptr + x) = (*(in_ptr + x) - mean) * stddev_inv;
+            // Apply the scale/shift epilogue in the same write pass
+            const auto one_vec  = wrapper::vdup_n(static_cast<ScalarType>(1.f), ExactTagType{});
+            const auto zero_vec = wrapper::vdup_n(static_cast<ScalarType>(0.f), ExactTagType{});
+            for(x = window_start_x; x <= (window_end_x - window_step_x); x += window_step_x)
+            {
+                auto data      = wrapper::vloadq(in_ptr + x);
+                auto norm      = wrapper::vmul(wrapper::vsub(data, mean_vec), stddev_inv_vec);
+                auto gamma_vec = (gamma_ptr != nullptr) ? wrapper::vloadq(gamma_ptr + x) : one_vec;
+                auto beta_vec  = (beta_ptr != nullptr) ? wrapper::vloadq(beta_ptr + x) : zero_vec;
+                // Store results
+                wrapper::vstore(out_ptr + x, wrapper::vmla(beta_vec, norm, gamma_vec));
+            }
+            for(; x < window_end_x; ++x)
+            {
+                const ScalarType norm = (*(in_ptr + x) - mean) * stddev_inv;
+                const ScalarType g    = (gamma_ptr != nullptr) ? *(gamma_ptr + x) : static_cast<ScalarType>(1.f);
+                const ScalarType b    = (beta_ptr != nullptr) ? *(beta_ptr + x) : static_cast<ScalarType>(0.f);
+                *(out_ptr + x)        = norm * g + b;
+            }
         }
     },
     input, output);
 }
 
 NEMeanStdDevNormalizationKernel::NEMeanStdDevNormalizationKernel()
-    : _input(nullptr), _output(nullptr), _epsilon(1e-8f), _func(nullptr)
+    : _input(nullptr), _output(nullptr), _epsilon(1e-8f), _gamma(nullptr), _beta(nullptr), _func(nullptr)
 {
 }
 
-void NEMeanStdDevNormalizationKernel::configure(ITensor *input, ITensor *output, float epsilon)
+void NEMeanStdDevNormalizationKernel::configure(ITensor *input, ITensor *output, float epsilon, const ITensor *gamma, const ITensor *beta)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input);
 
-    ARM_COMPUTE_ERROR_THROW_ON(NEMeanStdDevNormalizationKernel::validate(input->info(), (output != nullptr) ? output->info() : nullptr, epsilon));
+    ARM_COMPUTE_ERROR_THROW_ON(NEMeanStdDevNormalizationKernel::validate(input->info(), (output != nullptr) ? output->info() : nullptr, epsilon,
+                                                                         (gamma != nullptr) ? gamma->info() : nullptr, (beta != nullptr) ? beta->info() : nullptr));
 
     _input   = input;
     _output  = (output == nullptr) ? input : output;
     _epsilon = epsilon;
+    _gamma   = gamma;
+    _beta    = beta;
 
     // Configure kernel window
     auto win_config = validate_and_configure_window(input->info(), (output == nullptr) ? nullptr : output->info());
@@ -184,9 +227,9 @@ void NEMeanStdDevNormalizationKernel::configure(ITensor *input, ITensor *output,
     }
 }
 
-Status NEMeanStdDevNormalizationKernel::validate(const ITensorInfo *input, const ITensorInfo *output, float epsilon)
+Status NEMeanStdDevNormalizationKernel::validate(const ITensorInfo *input, const ITensorInfo *output, float epsilon, const ITensorInfo *gamma, const ITensorInfo *beta)
 {
-    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, output, epsilon));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, output, epsilon, gamma, beta));
     ARM_COMPUTE_RETURN_ON_ERROR(validate_and_configure_window(input->clone().get(), (output != nullptr) ? output->clone().get() : nullptr).first);
     return Status{};
 }
@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEMultiChannelTableLookupKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ILut.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+
+#include <arm_neon.h>
+#include <cstdint>
+
+using namespace arm_compute;
+
+namespace
+{
+constexpr unsigned int num_elems_processed_per_iteration = 16;
+constexpr size_t       lut_num_elements                  = 256;
+
+#ifdef __aarch64__
+/** 256-entry table held as four 64-byte TBL tables */
+struct TblLut
+{
+    uint8x16x4_t table[4];
+};
+
+inline void load_tbl_lut(TblLut &tbl, const uint8_t *lut)
+{
+    for(unsigned int i = 0; i < 4; ++i)
+    {
+        tbl.table[i].val[0] = vld1q_u8(lut + i * 64);
+        tbl.table[i].val[1] = vld1q_u8(lut + i * 64 + 16);
+        tbl.table[i].val[2] = vld1q_u8(lut + i * 64 + 32);
+        tbl.table[i].val[3] = vld1q_u8(lut + i * 64 + 48);
+    }
+}
+
+/** Look up 16 bytes in a 256-entry table.
+ *
+ * TBL returns zero for out-of-range indices, so the four 64-entry sub-tables can be
+ * combined with OR while the index vector is shifted down by 64 between lookups.
+ */
+inline uint8x16_t tbl_lookup_256(const TblLut &tbl, uint8x16_t idx)
+{
+    const uint8x16_t c64 = vdupq_n_u8(64);
+    uint8x16_t       res = vqtbl4q_u8(tbl.table[0], idx);
+    idx                  = vsubq_u8(idx, c64);
+    res                  = vorrq_u8(res, vqtbl4q_u8(tbl.table[1], idx));
+    idx                  = vsubq_u8(idx, c64);
+    res                  = vorrq_u8(res, vqtbl4q_u8(tbl.table[2], idx));
+    idx                  = vsubq_u8(idx, c64);
+    res                  = vorrq_u8(res, vqtbl4q_u8(tbl.table[3], idx));
+    return res;
+}
+#endif /* __aarch64__ */
+} // namespace
+
+NEMultiChannelTableLookupKernel::NEMultiChannelTableLookupKernel()
+    : _func(nullptr), _lut{ nullptr, nullptr, nullptr }
+{
+}
+
+void NEMultiChannelTableLookupKernel::lut_rgb(const Window &window)
+{
+    const uint8_t *const lut_r = _lut[0]->buffer();
+    const uint8_t *const lut_g = _lut[1]->buffer();
+    const uint8_t *const lut_b = _lut[2]->buffer();
+
+    ARM_COMPUTE_ERROR_ON(lut_r == nullptr || lut_g == nullptr || lut_b == nullptr);
+
+    Iterator input(_input, window);
+    Iterator output(_output, window);
+
+#ifdef __aarch64__
+    TblLut tbl_r;
+    TblLut tbl_g;
+    TblLut tbl_b;
+    load_tbl_lut(tbl_r, lut_r);
+    load_tbl_lut(tbl_g, lut_g);
+    load_tbl_lut(tbl_b, lut_b);
+
+    execute_window_loop(window, [&](const Coordinates &)
+    {
+        const uint8x16x3_t pixels = vld3q_u8(input.ptr());
+        uint8x16x3_t       out;
+        out.val[0] = tbl_lookup_256(tbl_r, pixels.val[0]);
+        out.val[1] = tbl_lookup_256(tbl_g, pixels.val[1]);
+        out.val[2] = tbl_lookup_256(tbl_b, pixels.val[2]);
+        vst3q_u8(output.ptr(), out);
+    },
+    input, output);
+#else  /* __aarch64__ */
+    execute_window_loop(window, [&](const Coordinates &)
+    {
+        const uint8_t *input_ptr  = input.ptr();
+        uint8_t       *output_ptr = output.ptr();
+
+        for(unsigned int i = 0; i < num_elems_processed_per_iteration; ++i, input_ptr += 3, output_ptr += 3)
+        {
+            output_ptr[0] = lut_r[input_ptr[0]];
+            output_ptr[1] = lut_g[input_ptr[1]];
+            output_ptr[2] = lut_b[input_ptr[2]];
+        }
+    },
+    input, output);
+#endif /* __aarch64__ */
+}
+
+void NEMultiChannelTableLookupKernel::lut_rgba(const Window &window)
+{
+    const uint8_t *const lut_r = _lut[0]->buffer();
+    const uint8_t *const lut_g = _lut[1]->buffer();
+    const uint8_t *const lut_b = _lut[2]->buffer();
+
+    ARM_COMPUTE_ERROR_ON(lut_r == nullptr || lut_g == nullptr || lut_b == nullptr);
+
+    Iterator input(_input, window);
+    Iterator output(_output, window);
+
+#ifdef __aarch64__
+    TblLut tbl_r;
+    TblLut tbl_g;
+    TblLut tbl_b;
+    load_tbl_lut(tbl_r, lut_r);
+    load_tbl_lut(tbl_g, lut_g);
+    load_tbl_lut(tbl_b, lut_b);
+
+    execute_window_loop(window, [&](const Coordinates &)
+    {
+        const uint8x16x4_t pixels = vld4q_u8(input.ptr());
+        uint8x16x4_t       out;
+        out.val[0] = tbl_lookup_256(tbl_r, pixels.val[0]);
+        out.val[1] = tbl_lookup_256(tbl_g, pixels.val[1]);
+        out.val[2] = tbl_lookup_256(tbl_b, pixels.val[2]);
+        out.val[3] = pixels.val[3];
+        vst4q_u8(output.ptr(), out);
+    },
+    input, output);
+#else  /* __aarch64__ */
+    execute_window_loop(window, [&](const Coordinates &)
+    {
+        const uint8_t *input_ptr  = input.ptr();
+        uint8_t       *output_ptr = output.ptr();
+
+        for(unsigned int i = 0; i < num_elems_processed_per_iteration; ++i, input_ptr += 4, output_ptr += 4)
+        {
+            output_ptr[0] = lut_r[input_ptr[0]];
+            output_ptr[1] = lut_g[input_ptr[1]];
+            output_ptr[2] = lut_b[input_ptr[2]];
+            output_ptr[3] = input_ptr[3];
+        }
+    },
+    input, output);
+#endif /* __aarch64__ */
+}
+
+void NEMultiChannelTableLookupKernel::configure(const ITensor *input, const ILut *lut_r, const ILut *lut_g, const ILut *lut_b, ITensor *output)
+{
+    ARM_COMPUTE_ERROR_ON(input == nullptr);
+    ARM_COMPUTE_ERROR_ON(output == nullptr);
+    ARM_COMPUTE_ERROR_ON_FORMAT_NOT_IN(input, Format::RGB888, Format::RGBA8888);
+    ARM_COMPUTE_ERROR_ON_FORMAT_NOT_IN(output, Format::RGB888, Format::RGBA8888);
+    ARM_COMPUTE_ERROR_ON(input->info()->format() != output->info()->format());
+
+    const ILut *luts[] = { lut_r, lut_g, lut_b };
+    for(const ILut *lut : luts)
+    {
+        ARM_COMPUTE_ERROR_ON(lut == nullptr);
+        ARM_COMPUTE_ERROR_ON(lut->type() != DataType::U8);
+        ARM_COMPUTE_ERROR_ON(lut->num_elements() != lut_num_elements);
+    }
+
+    _lut[0] = lut_r;
+    _lut[1] = lut_g;
+    _lut[2] = lut_b;
+
+    if(input->info()->format() == Format::RGB888)
+    {
+        _func = &NEMultiChannelTableLookupKernel::lut_rgb;
+    }
+    else
+    {
+        _func = &NEMultiChannelTableLookupKernel::lut_rgba;
+    }
+
+    INESimpleKernel::configure(input, output, num_elems_processed_per_iteration);
+}
+
+void NEMultiChannelTableLookupKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INESimpleKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_func == nullptr);
+    (this->*_func)(window);
+}
@@ -109,7 +109,7 @@ Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, c
 } // namespace
 
 template <typename T>
-void NEPermuteKernel::run_permute(const Window &window)
+void NEPermuteKernel::run_permute(const Window &window, const ThreadInfo &info)
 {
     const DataLayout input_layout = _input->info()->data_layout();
 
@@ -220,12 +220,25 @@ void NEPermuteKernel::run_permute(const Window &window)
         Strides perm_strides = strides;
         permute_strides(perm_strides, _perm);
         const int perm_stride_3 = _input->info()->num_dimensions() >= 4 ? perm_strides[3] : 0;
-        execute_window_loop(window, [&](const Coordinates & id)
+
+        // The element-wise fallback reads rows but scatters its writes across the output,
+        // which thrashes the caches on large tensors: execute the window in cache-sized
+        // tiles so the set of concurrently touched output lines stays bounded
+        static const CPUInfo default_cpu_info{};
+        const CPUInfo     &cpu_info = (info.cpu_info != nullptr) ? *info.cpu_info : default_cpu_info;
+        const WindowTiling tiling   = calculate_cache_tiling(window, sizeof(T), cpu_info);
+
+        execute_window_loop_tiled(window, tiling, [&](const Window & tile)
         {
-            const int idx                             = id[0] * perm_strides[0] + id[1] * perm_strides[1] + id[2] * perm_strides[2] + id[3] * perm_stride_3;
-            *(reinterpret_cast<T *>(out.ptr() + idx)) = *(reinterpret_cast<const T *>(in.ptr()));
-        },
-        in, out);
+            Iterator tile_in(_input, tile);
+            Iterator tile_out(_output, window_out);
+            execute_window_loop(tile, [&](const Coordinates & id)
+            {
+                const int idx                                  = id[0] * perm_strides[0] + id[1] * perm_strides[1] + id[2] * perm_strides[2] + id[3] * perm_stride_3;
+                *(reinterpret_cast<T *>(tile_out.ptr() + idx)) = *(reinterpret_cast<const T *>(tile_in.ptr()));
+            },
+            tile_in, tile_out);
+        });
     }
 }
 
@@ -283,12 +296,11 @@ Status NEPermuteKernel::validate(const ITensorInfo *input, const ITensorInfo *ou
 
 void NEPermuteKernel::run(const Window &window, const ThreadInfo &info)
 {
-    ARM_COMPUTE_UNUSED(info);
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICPPKernel::window(), window);
 
     if(_func != nullptr)
     {
-        (this->*_func)(window);
+        (this->*_func)(window, info);
     }
 }
@@ -28,6 +28,7 @@
 #include "arm_compute/core/NEON/NESymm.h"
 #include "arm_compute/core/NEON/wrapper/wrapper.h"
 #include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/utils/quantization/AsymmHelpers.h"
 
 #include <arm_neon.h>
 
@@ -308,7 +309,12 @@ void mul_saturate_QSYMM16_QSYMM16_QSYMM16(const ITensor *in1, const ITensor *in2
     const auto window_start_x = static_cast<int>(window.x().start());
     const auto window_end_x   = static_cast<int>(window.x().end());
 
-    const UniformQuantizationInfo tmp_qua_info = { output_qua_info.scale / scale, output_qua_info.offset };
+    // Rescale the raw int32 products to the output scale with a fixed-point multiplier
+    const float real_multiplier = (input1_qua_info.scale * input2_qua_info.scale * scale) / output_qua_info.scale;
+    int32_t     qmul            = 0;
+    int32_t     qshift          = 0;
+    quantization::calculate_quantized_multiplier(real_multiplier, &qmul, &qshift);
+    qshift *= -1;
 
     execute_window_loop(win, [&](const Coordinates &)
     {
@@ -335,35 +341,34 @@ void mul_saturate_QSYMM16_QSYMM16_QSYMM16(const ITensor *in1, const ITensor *in2
                 }
             };
 
-            // Dequantize inputs
-            const float32x4x4_t in1_f32x4x4 = vdequantize(input1_q, input1_qua_info);
-            const float32x4x4_t in2_f32x4x4 = vdequantize(input2_q, input2_qua_info);
-
-            const float32x4x4_t out_f32x4x4 =
+            // Raw products fit in 32 bits and get rescaled in the integer domain
+            int32x4x2_t lo =
             {
-                vmulq_f32(in1_f32x4x4.val[0], in2_f32x4x4.val[0]),
-                vmulq_f32(in1_f32x4x4.val[1], in2_f32x4x4.val[1]),
-                vmulq_f32(in1_f32x4x4.val[2], in2_f32x4x4.val[2]),
-                vmulq_f32(in1_f32x4x4.val[3], in2_f32x4x4.val[3]),
+                {
+                    vmull_s16(vget_low_s16(input1_q.val[0]), vget_low_s16(input2_q.val[0])),
+                    vmull_s16(vget_high_s16(input1_q.val[0]), vget_high_s16(input2_q.val[0])),
+                }
             };
+            int32x4x2_t hi =
+            {
+                {
+                    vmull_s16(vget_low_s16(input1_q.val[1]), vget_low_s16(input2_q.val[1])),
+                    vmull_s16(vget_high_s16(input1_q.val[1]), vget_high_s16(input2_q.val[1])),
+                }
+            };
+            lo = multiply_by_quantized_multiplier_2row(lo, qmul, qshift);
+            hi = multiply_by_quantized_multiplier_2row(hi, qmul, qshift);
 
-            const qsymm16x8x2_t result = vquantize_qsymm16(out_f32x4x4, tmp_qua_info);
-            vst1q_s16(output_ptr + x, result.val[0]);
-            vst1q_s16(output_ptr + x + 8, result.val[1]);
+            vst1q_s16(output_ptr + x, vcombine_s16(vqmovn_s32(lo.val[0]), vqmovn_s32(lo.val[1])));
+            vst1q_s16(output_ptr + x + 8, vcombine_s16(vqmovn_s32(hi.val[0]), vqmovn_s32(hi.val[1])));
         }
 
         // Compute left-over elements
         for(; x < window_end_x; ++x)
         {
-            // Dequantize inputs
-            float tmp_in1 = static_cast<float>(*(input1_ptr + x)) * input1_qua_info.scale;
-            float tmp_in2 = static_cast<float>(*(input2_ptr + x)) * input2_qua_info.scale;
-            float tmp_f   = tmp_in1 * tmp_in2;
-
-            // Quantize output, lrintf() has same rounding mode as vcombine_s16
-            int32_t   tmp     = lrintf(tmp_f / tmp_qua_info.scale);
-            qsymm16_t tmp_qua = static_cast<qsymm16_t>(tmp > SHRT_MAX) ? SHRT_MAX : ((tmp < SHRT_MIN) ? SHRT_MIN : tmp);
-            *(output_ptr + x) = tmp_qua;
+            const int32_t product = static_cast<int32_t>(*(input1_ptr + x)) * static_cast<int32_t>(*(input2_ptr + x));
+            const int32_t tmp     = quantization::multiply_by_quantized_multiplier(product, qmul, qshift);
+            *(output_ptr + x)     = static_cast<qsymm16_t>((tmp > SHRT_MAX) ? SHRT_MAX : ((tmp < SHRT_MIN) ? SHRT_MIN : tmp));
         }
     },
     input1, input2, output);
@@ -651,7 +651,14 @@ void NEPoolingLayerKernel::configure(const ITensor *input, ITensor *output, cons
     }
     else if(data_type == DataType::F32)
     {
-        if(_is_square)
+        // A pool region covering the whole plane with zero padding reduces to a flat per-channel reduction
+        const bool is_global = is_nchw && pool_size.x() == input->info()->dimension(0) && pool_size.y() == input->info()->dimension(1)
+                               && pad_stride_info.pad_left() == 0 && pad_stride_info.pad_top() == 0 && pad_stride_info.pad_right() == 0 && pad_stride_info.pad_bottom() == 0;
+        if(is_global)
+        {
+            _func = &NEPoolingLayerKernel::pooling_global_f32_nchw;
+        }
+        else if(_is_square)
         {
             switch(pool_size.x())
             {
@@ -1673,6 +1680,126 @@ void NEPoolingLayerKernel::poolingMxN_f32_nchw(const Window &window_input, const
     input, output);
 }
 
+void NEPoolingLayerKernel::pooling_global_f32_nchw(const Window &window_input, const Window &window, PoolingType pooling_type, bool exclude_padding)
+{
+    // The pool region covers the whole plane and the padding is zero, so both inclusive and
+    // exclusive averages divide by the full plane size and no boundary checks are needed
+    ARM_COMPUTE_UNUSED(exclude_padding);
+
+    Iterator input(_input, window_input);
+    Iterator output(_output, window);
+
+    const int    input_width    = _input->info()->dimension(0);
+    const int    input_height   = _input->info()->dimension(1);
+    const size_t input_stride_y = _input->info()->strides_in_bytes().y();
+
+    // When the rows are not padded the whole plane can be reduced as a single flat array
+    const bool is_contiguous = (input_stride_y == input_width * sizeof(float));
+    const int  num_rows      = is_contiguous ? 1 : input_height;
+    const int  row_length    = is_contiguous ? input_width * input_height : input_width;
+
+    execute_window_loop(window, [&](const Coordinates &)
+    {
+        const auto plane = reinterpret_cast<const float *>(input.ptr());
+
+        float res = 0.0f;
+
+        if(pooling_type != PoolingType::MAX)
+        {
+            float32x4_t vres = vdupq_n_f32(0.0f);
+
+            for(int y = 0; y < num_rows; ++y)
+            {
+                const float *row = plane + y * (input_stride_y / sizeof(float));
+
+                int x = 0;
+                for(; x <= (row_length - 4); x += 4)
+                {
+                    const float32x4_t data = vld1q_f32(row + x);
+
+                    // Get power of 2 in case of l2 pooling and accumulate
+                    if(pooling_type == PoolingType::L2)
+                    {
+                        vres = vmlaq_f32(vres, data, data);
+                    }
+                    else
+                    {
+                        vres = vaddq_f32(vres, data);
+                    }
+                }
+
+                // Leftover for loop
+                for(; x < row_length; ++x)
+                {
+                    float data = row[x];
+
+                    // Get power of 2 in case of l2 pooling
+                    if(pooling_type == PoolingType::L2)
+                    {
+                        data *= data;
+                    }
+
+                    res += data;
+                }
+            }
+
+#if defined(__aarch64__)
+            // Reduction operation available on 64 bit architectures only
+            res += vaddvq_f32(vres);
+#else  // __aarch64__
+            // Reduction
+            float32x2_t tmp = vpadd_f32(vget_high_f32(vres), vget_low_f32(vres));
+            tmp             = vpadd_f32(tmp, tmp);
+
+            res += vget_lane_f32(tmp, 0);
+#endif // __aarch64__
+            // Divide by scale
+            res /= input_width * input_height;
+        }
+        else
+        {
+            float32x4_t vres = vdupq_n_f32(std::numeric_limits<float>::lowest());
+            res              = std::numeric_limits<float>::lowest();
+
+            for(int y = 0; y < num_rows; ++y)
+            {
+                const float *row = plane + y * (input_stride_y / sizeof(float));
+
+                int x = 0;
+                for(; x <= (row_length - 4); x += 4)
+                {
+                    vres = vmaxq_f32(vres, vld1q_f32(row + x));
+                }
+
+                // Leftover for loop
+                for(; x < row_length; ++x)
+                {
+                    res = std::max(res, row[x]);
+                }
+            }
+#if defined(__aarch64__)
+            // Reduction operation available on 64 bit architectures only
+            res = std::max(vmaxvq_f32(vres), res);
+#else  // __aarch64__
+            float32x2_t tmp = vpmax_f32(vget_high_f32(vres), vget_low_f32(vres));
+            tmp             = vpmax_f32(tmp, tmp);
+
+            res = std::max(res, vget_lane_f32(tmp, 0));
+#endif // __aarch64__
+        }
+
+        // Calculate square-root in case of l2 pooling
+        if(pooling_type == PoolingType::L2)
+        {
+            res = std::sqrt(res);
+        }
+
+        // Store result
+        *(reinterpret_cast<float *>(output.ptr())) = res;
+    },
+    input, output);
+}
+
 void NEPoolingLayerKernel::pooling2_f32_nchw(const Window &window_input, const Window &window, PoolingType pooling_type,
                                              bool exclude_padding)
 {
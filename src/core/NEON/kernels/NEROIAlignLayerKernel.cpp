@@ -88,11 +88,14 @@ void NEROIAlignLayerKernel::configure(const ITensor *input, const ITensor *rois,
     auto_init_if_empty((*output->info()), output_shape, 1, input->info()->data_type(), input->info()->quantization_info());
     output->info()->set_data_layout(input->info()->data_layout());
 
-    // Configure kernel window
-    const unsigned int num_rois = rois->info()->dimension(1);
+    // Configure kernel window: the second dimension spans the input channels so the
+    // scheduler can split the (roi, channel) product when the ROI count alone is too
+    // small to fill every core
+    const unsigned int num_rois  = rois->info()->dimension(1);
+    const unsigned int idx_depth = get_data_layout_dimension_index(input->info()->data_layout(), DataLayoutDimension::CHANNEL);
     Window             window;
     window.set(Window::DimX, Window::Dimension(0, num_rois));
-    window.set(Window::DimY, Window::Dimension(0, 1));
+    window.set(Window::DimY, Window::Dimension(0, input->info()->dimension(idx_depth)));
 
     Coordinates coord;
     coord.set_num_dimensions(output->info()->num_dimensions());
@@ -336,16 +339,16 @@ void NEROIAlignLayerKernel::internal_run(const Window &window, const ThreadInfo
 
     const int roi_list_start = window.x().start();
     const int roi_list_end   = window.x().end();
+    const int ch_start       = window.y().start();
+    const int ch_end         = window.y().end();
 
     const unsigned int idx_width  = get_data_layout_dimension_index(_input->info()->data_layout(), DataLayoutDimension::WIDTH);
     const unsigned int idx_height = get_data_layout_dimension_index(_input->info()->data_layout(), DataLayoutDimension::HEIGHT);
-    const unsigned int idx_depth  = get_data_layout_dimension_index(_input->info()->data_layout(), DataLayoutDimension::CHANNEL);
 
-    const int input_width   = _input->info()->dimension(idx_width);
-    const int input_height  = _input->info()->dimension(idx_height);
-    const int input_chanels = _input->info()->dimension(idx_depth);
-    const int pooled_w      = _pool_info.pooled_width();
-    const int pooled_h      = _pool_info.pooled_height();
+    const int input_width  = _input->info()->dimension(idx_width);
+    const int input_height = _input->info()->dimension(idx_height);
+    const int pooled_w     = _pool_info.pooled_width();
+    const int pooled_h     = _pool_info.pooled_height();
 
     const DataType data_type = _input->info()->data_type();
     const bool     is_qasymm = is_data_type_quantized_asymmetric(data_type);
@@ -378,8 +381,8 @@ void NEROIAlignLayerKernel::internal_run(const Window &window, const ThreadInfo
         float       bin_size_x   = roi_dims_x / _pool_info.pooled_width();
         float       bin_size_y   = roi_dims_y / _pool_info.pooled_height();
 
-        // Iterate through all feature maps
-        for(int ch = 0; ch < input_chanels; ++ch)
+        // Iterate through the feature maps of this sub-window
+        for(int ch = ch_start; ch < ch_end; ++ch)
         {
             // Iterate through all output pixels
             for(int py = 0; py < pooled_h; ++py)
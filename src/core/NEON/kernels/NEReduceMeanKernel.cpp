@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEReduceMeanKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <arm_neon.h>
+
+#include <algorithm>
+
+namespace arm_compute
+{
+namespace
+{
+TensorShape calculate_output_shape(const TensorShape &input_shape, const Coordinates &reduction_axis)
+{
+    TensorShape out_shape = input_shape;
+    out_shape.set(1, 1);
+    out_shape.set(2, 1);
+    if(reduction_axis.num_dimensions() == 3)
+    {
+        out_shape.set(3, 1);
+    }
+    return out_shape;
+}
+
+Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, const Coordinates &reduction_axis)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON(reduction_axis.num_dimensions() < 2 || reduction_axis.num_dimensions() > 3);
+
+    Coordinates axis_local = reduction_axis;
+    std::sort(axis_local.begin(), axis_local.begin() + reduction_axis.num_dimensions());
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(axis_local[0] != 1 || axis_local[1] != 2, "Only the axis sets {1,2} and {1,2,3} are supported");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(reduction_axis.num_dimensions() == 3 && axis_local[2] != 3, "Only the axis sets {1,2} and {1,2,3} are supported");
+    ARM_COMPUTE_RETURN_ERROR_ON(input->num_dimensions() < 3);
+
+    if(output->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+        const TensorInfo out_info = input->clone()->set_tensor_shape(calculate_output_shape(input->tensor_shape(), reduction_axis));
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(output, &out_info);
+    }
+
+    return Status{};
+}
+} // namespace
+
+NEReduceMeanKernel::NEReduceMeanKernel()
+    : _input(nullptr), _output(nullptr), _reduce_batch(false)
+{
+}
+
+void NEReduceMeanKernel::configure(const ITensor *input, ITensor *output, const Coordinates &reduction_axis)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
+
+    // Output auto initialization if not yet initialized
+    auto_init_if_empty(*output->info(), input->info()->clone()->set_tensor_shape(calculate_output_shape(input->info()->tensor_shape(), reduction_axis)));
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), output->info(), reduction_axis));
+
+    _input        = input;
+    _output       = output;
+    _reduce_batch = reduction_axis.num_dimensions() == 3;
+
+    // Configure kernel window
+    Window win = calculate_max_window(*output->info(), Steps());
+    output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+Status NEReduceMeanKernel::validate(const ITensorInfo *input, const ITensorInfo *output, const Coordinates &reduction_axis)
+{
+    return validate_arguments(input, output, reduction_axis);
+}
+
+void NEReduceMeanKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const int x_start = window.x().start();
+    const int x_end   = window.x().end();
+
+    const int width   = _input->info()->dimension(1);
+    const int height  = _input->info()->dimension(2);
+    const int batches = _reduce_batch ? _input->info()->dimension(3) : 1;
+
+    const size_t in_stride_y  = _input->info()->strides_in_bytes()[1];
+    const size_t in_stride_z  = _input->info()->strides_in_bytes()[2];
+    const size_t in_stride_w  = _input->info()->strides_in_bytes()[3];
+    const size_t out_stride_w = _output->info()->strides_in_bytes()[3];
+
+    const uint8_t *const in_buffer  = _input->buffer() + _input->info()->offset_first_element_in_bytes();
+    uint8_t *const       out_buffer = _output->buffer() + _output->info()->offset_first_element_in_bytes();
+
+    const float       scale  = 1.f / (static_cast<float>(width) * static_cast<float>(height) * static_cast<float>(batches));
+    const float32x4_t vscale = vdupq_n_f32(scale);
+
+    for(int b = window[3].start(); b < window[3].end(); ++b)
+    {
+        const uint8_t *const in_base = in_buffer + (_reduce_batch ? 0 : b) * in_stride_w;
+        const auto           out_ptr = reinterpret_cast<float *>(out_buffer + b * out_stride_w);
+
+        // The output row doubles as the accumulator, so a single pass over the input suffices
+        int x = x_start;
+        for(; x <= (x_end - 4); x += 4)
+        {
+            vst1q_f32(out_ptr + x, vdupq_n_f32(0.f));
+        }
+        for(; x < x_end; ++x)
+        {
+            out_ptr[x] = 0.f;
+        }
+
+        for(int n = 0; n < batches; ++n)
+        {
+            for(int z = 0; z < height; ++z)
+            {
+                for(int y = 0; y < width; ++y)
+                {
+                    const auto in_row = reinterpret_cast<const float *>(in_base + n * in_stride_w + z * in_stride_z + y * in_stride_y);
+
+                    x = x_start;
+                    for(; x <= (x_end - 4); x += 4)
+                    {
+                        vst1q_f32(out_ptr + x, vaddq_f32(vld1q_f32(out_ptr + x), vld1q_f32(in_row + x)));
+                    }
+                    for(; x < x_end; ++x)
+                    {
+                        out_ptr[x] += in_row[x];
+                    }
+                }
+            }
+        }
+
+        // Divide by the number of accumulated elements
+        x = x_start;
+        for(; x <= (x_end - 4); x += 4)
+        {
+            vst1q_f32(out_ptr + x, vmulq_f32(vld1q_f32(out_ptr + x), vscale));
+        }
+        for(; x < x_end; ++x)
+        {
+            out_ptr[x] *= scale;
+        }
+    }
+}
+} // namespace arm_compute
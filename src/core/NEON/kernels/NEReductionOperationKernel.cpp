@@ -558,6 +558,51 @@ struct RedOpX
     }
 };
 
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+/** Sum-family reductions on F16 widen each loaded vector once into a pair of F32
+ * accumulators: the bandwidth and lane count stay those of fp16 while long
+ * reductions keep F32 accuracy instead of drifting with the half-precision
+ * round-off of the running sum.
+ */
+struct RedOpX_fp16_sum
+{
+    inline void operator()(Iterator &input, Iterator &output, Window &in_slice, Window &out_slice, const TensorInfo &in_info, const ReductionOperation op)
+    {
+        ARM_COMPUTE_UNUSED(out_slice);
+
+        auto vec_res_value_lo = vdupq_n_f32(0.f);
+        auto vec_res_value_hi = vdupq_n_f32(0.f);
+
+        execute_window_loop(in_slice, [&](const Coordinates &)
+        {
+            const auto vec_elements = vld1q_f16(reinterpret_cast<const float16_t *>(input.ptr()));
+            auto       lo           = vcvt_f32_f16(vget_low_f16(vec_elements));
+            auto       hi           = vcvt_f32_f16(vget_high_f16(vec_elements));
+            if(op == ReductionOperation::SUM_SQUARE)
+            {
+                lo = vmulq_f32(lo, lo);
+                hi = vmulq_f32(hi, hi);
+            }
+            vec_res_value_lo = vaddq_f32(lo, vec_res_value_lo);
+            vec_res_value_hi = vaddq_f32(hi, vec_res_value_hi);
+        },
+        input);
+
+        const auto  sum       = vaddq_f32(vec_res_value_lo, vec_res_value_hi);
+        auto        carry_res = vpadd_f32(vget_high_f32(sum), vget_low_f32(sum));
+        carry_res             = vpadd_f32(carry_res, carry_res);
+        float res             = vget_lane_f32(carry_res, 0);
+
+        if(op == ReductionOperation::MEAN_SUM)
+        {
+            res /= in_info.dimension(0);
+        }
+
+        *(reinterpret_cast<float16_t *>(output.ptr())) = static_cast<float16_t>(res);
+    }
+};
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+
 template <typename T>
 struct RedOpX_quantized
 {
@@ -844,6 +889,48 @@ struct RedOpYZW
     }
 };
 
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+/** F16 counterpart of @ref RedOpYZW for the sum family, accumulating in a pair of F32 vectors. */
+struct RedOpYZW_fp16_sum
+{
+    inline void operator()(Iterator &input, Iterator &output, Window &in_slice, Window &out_slice, const TensorInfo &in_info, int axis, const ReductionOperation op)
+    {
+        ARM_COMPUTE_UNUSED(out_slice);
+
+        execute_window_loop(in_slice, [&](const Coordinates &)
+        {
+            auto vec_res_value_lo = vdupq_n_f32(0.f);
+            auto vec_res_value_hi = vdupq_n_f32(0.f);
+
+            for(unsigned int dim = 0; dim < in_info.dimension(axis); ++dim)
+            {
+                const auto in_ptr       = reinterpret_cast<const float16_t *>(input.ptr() + in_info.strides_in_bytes()[axis] * dim);
+                const auto vec_elements = vld1q_f16(in_ptr);
+                auto       lo           = vcvt_f32_f16(vget_low_f16(vec_elements));
+                auto       hi           = vcvt_f32_f16(vget_high_f16(vec_elements));
+                if(op == ReductionOperation::SUM_SQUARE)
+                {
+                    lo = vmulq_f32(lo, lo);
+                    hi = vmulq_f32(hi, hi);
+                }
+                vec_res_value_lo = vaddq_f32(lo, vec_res_value_lo);
+                vec_res_value_hi = vaddq_f32(hi, vec_res_value_hi);
+            }
+
+            if(op == ReductionOperation::MEAN_SUM)
+            {
+                const auto vec_width_inv = vinvq_f32(vdupq_n_f32(static_cast<float>(in_info.dimension(axis))));
+                vec_res_value_lo         = vmulq_f32(vec_res_value_lo, vec_width_inv);
+                vec_res_value_hi         = vmulq_f32(vec_res_value_hi, vec_width_inv);
+            }
+
+            vst1q_f16(reinterpret_cast<float16_t *>(output.ptr()), vcombine_f16(vcvt_f16_f32(vec_res_value_lo), vcvt_f16_f32(vec_res_value_hi)));
+        },
+        input, output);
+    }
+};
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+
 template <typename T, int S, int axis, ReductionOperation op>
 struct RedOpYZW_complex
 {
@@ -1087,6 +1174,14 @@ struct RedOpYZW_quantized
     }
 };
 
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+/** Check whether @p op belongs to the sum family, which on F16 goes through the F32-accumulating functors. */
+bool is_sum_family(ReductionOperation op)
+{
+    return op == ReductionOperation::SUM || op == ReductionOperation::SUM_SQUARE || op == ReductionOperation::MEAN_SUM;
+}
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+
 void reduce_op(const Window &window, const ITensor *input, ITensor *output, unsigned int axis, const ReductionOperation op)
 {
     const bool is_complex = (input->info()->num_channels() == 2);
@@ -1125,6 +1220,10 @@ void reduce_op(const Window &window, const ITensor *input, ITensor *output, unsi
                     return Reducer<RedOpX_quantized<int8_t>>::reduceX(window, input, output, RedOpX_quantized<int8_t>(), op);
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
                 case DataType::F16:
+                    if(is_sum_family(op))
+                    {
+                        return Reducer<RedOpX_fp16_sum>::reduceX(window, input, output, RedOpX_fp16_sum(), op);
+                    }
                     return Reducer<RedOpX<float16_t, 8>>::reduceX(window, input, output, RedOpX<float16_t, 8>(), op);
 #endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
                 case DataType::F32:
@@ -1143,6 +1242,10 @@ void reduce_op(const Window &window, const ITensor *input, ITensor *output, unsi
                     return Reducer<RedOpYZW_quantized<int8_t>>::reduceY(window, input, output, RedOpYZW_quantized<int8_t>(), op);
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
                 case DataType::F16:
+                    if(is_sum_family(op))
+                    {
+                        return Reducer<RedOpYZW_fp16_sum>::reduceY(window, input, output, RedOpYZW_fp16_sum(), op);
+                    }
                     return Reducer<RedOpYZW<float16_t, 8>>::reduceY(window, input, output, RedOpYZW<float16_t, 8>(), op);
 #endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
                 case DataType::F32:
@@ -1161,6 +1264,10 @@ void reduce_op(const Window &window, const ITensor *input, ITensor *output, unsi
                     return Reducer<RedOpYZW_quantized<int8_t>>::reduceZ(window, input, output, RedOpYZW_quantized<int8_t>(), op);
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
                 case DataType::F16:
+                    if(is_sum_family(op))
+                    {
+                        return Reducer<RedOpYZW_fp16_sum>::reduceZ(window, input, output, RedOpYZW_fp16_sum(), op);
+                    }
                     return Reducer<RedOpYZW<float16_t, 8>>::reduceZ(window, input, output, RedOpYZW<float16_t, 8>(), op);
 #endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
                 case DataType::F32:
@@ -1179,6 +1286,10 @@ void reduce_op(const Window &window, const ITensor *input, ITensor *output, unsi
                     return Reducer<RedOpYZW_quantized<int8_t>>::reduceW(window, input, output, RedOpYZW_quantized<int8_t>(), op);
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
                 case DataType::F16:
+                    if(is_sum_family(op))
+                    {
+                        return Reducer<RedOpYZW_fp16_sum>::reduceW(window, input, output, RedOpYZW_fp16_sum(), op);
+                    }
                     return Reducer<RedOpYZW<float16_t, 8>>::reduceW(window, input, output, RedOpYZW<float16_t, 8>(), op);
 #endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
                 case DataType::F32:
@@ -59,7 +59,11 @@ Status validate_arguments(const ITensorInfo *input, const ITensorInfo *dx, const
     ARM_COMPUTE_RETURN_ERROR_ON(output_width == 0);
     ARM_COMPUTE_RETURN_ERROR_ON(output_height == 0);
 
-    if(info.interpolation_policy == InterpolationPolicy::NEAREST_NEIGHBOR)
+    // Integer-factor NCHW upscaling replicates input pixels directly and does not consume the offsets table
+    const bool is_upscale_nchw = data_layout == DataLayout::NCHW
+                                 && arm_compute::scale_utils::is_integer_upscale(input->dimension(width_index), input->dimension(height_index), output_width, output_height, info.align_corners);
+
+    if(info.interpolation_policy == InterpolationPolicy::NEAREST_NEIGHBOR && !is_upscale_nchw)
     {
         ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(offsets, 1, DataType::S32);
     }
@@ -329,6 +333,104 @@ inline void scale_bilinear_nhwc_core(const ITensor *input, const ITensor *offset
     },
     in, out);
 }
+
+/** Store eight input elements, each replicated twice, as sixteen contiguous output elements */
+inline void store_replicated_x2(uint8_t *out, const uint8_t *in)
+{
+    const uint8x8_t   v = vld1_u8(in);
+    const uint8x8x2_t d = { { v, v } };
+    vst2_u8(out, d);
+}
+
+inline void store_replicated_x2(uint16_t *out, const uint16_t *in)
+{
+    const uint16x8_t   v = vld1q_u16(in);
+    const uint16x8x2_t d = { { v, v } };
+    vst2q_u16(out, d);
+}
+
+inline void store_replicated_x2(uint32_t *out, const uint32_t *in)
+{
+    const uint32x4_t   v0 = vld1q_u32(in);
+    const uint32x4_t   v1 = vld1q_u32(in + 4);
+    const uint32x4x2_t d0 = { { v0, v0 } };
+    const uint32x4x2_t d1 = { { v1, v1 } };
+    vst2q_u32(out, d0);
+    vst2q_u32(out + 8, d1);
+}
+
+/** Store eight input elements, each replicated four times, as thirty-two contiguous output elements */
+inline void store_replicated_x4(uint8_t *out, const uint8_t *in)
+{
+    const uint8x8_t   v = vld1_u8(in);
+    const uint8x8x4_t d = { { v, v, v, v } };
+    vst4_u8(out, d);
+}
+
+inline void store_replicated_x4(uint16_t *out, const uint16_t *in)
+{
+    const uint16x8_t   v = vld1q_u16(in);
+    const uint16x8x4_t d = { { v, v, v, v } };
+    vst4q_u16(out, d);
+}
+
+inline void store_replicated_x4(uint32_t *out, const uint32_t *in)
+{
+    const uint32x4_t   v0 = vld1q_u32(in);
+    const uint32x4_t   v1 = vld1q_u32(in + 4);
+    const uint32x4x4_t d0 = { { v0, v0, v0, v0 } };
+    const uint32x4x4_t d1 = { { v1, v1, v1, v1 } };
+    vst4q_u32(out, d0);
+    vst4q_u32(out + 16, d1);
+}
+
+template <typename T, int factor>
+inline void scale_nearest_upscale_nchw_core(const ITensor *input, ITensor *output, Window window, size_t input_stride)
+{
+    // Each vector iteration reads eight input elements and stores each of them replicated factor times
+    const int window_step_x  = 8 * factor;
+    const int window_start_x = static_cast<int>(window.x().start());
+    const int window_end_x   = static_cast<int>(window.x().end());
+    const int input_width    = static_cast<int>(input->info()->dimension(0));
+    const int output_width   = static_cast<int>(output->info()->dimension(0));
+
+    // Keep the vector loop within the output shape so that the input reads cannot cross the row end
+    const int window_end_x_vec = std::min(window_end_x, output_width) - window_step_x;
+
+    window.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    // Don't increment in X and Y direction for the input tensor
+    // A pointer to the start of this plane is needed as base for the replicated rows
+    Window win_in(window);
+    win_in.set(Window::DimY, Window::Dimension(0, 0, 0));
+
+    Iterator in(input, win_in);
+    Iterator out(output, window);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const auto in_row  = reinterpret_cast<const T *>(in.ptr() + (id.y() / factor) * input_stride);
+        const auto out_row = reinterpret_cast<T *>(out.ptr());
+
+        int x = window_start_x;
+        for(; x <= window_end_x_vec; x += window_step_x)
+        {
+            if(factor == 2)
+            {
+                store_replicated_x2(out_row + x, in_row + x / factor);
+            }
+            else
+            {
+                store_replicated_x4(out_row + x, in_row + x / factor);
+            }
+        }
+        for(; x < window_end_x; ++x)
+        {
+            out_row[x] = in_row[std::min(x / factor, input_width - 1)];
+        }
+    },
+    in, out);
+}
 } // namespace
 
 NEScaleKernel::NEScaleKernel()
@@ -394,7 +496,17 @@ void NEScaleKernel::configure(const ITensor *input, const ITensor *dx, const ITe
     {
         case InterpolationPolicy::NEAREST_NEIGHBOR:
         {
-            _func = (data_layout == DataLayout::NCHW) ? &NEScaleKernel::scale_nearest_nchw : &NEScaleKernel::scale_nhwc;
+            if(data_layout == DataLayout::NCHW
+               && arm_compute::scale_utils::is_integer_upscale(input->info()->dimension(idx_width), input->info()->dimension(idx_height),
+                                                               output->info()->dimension(idx_width), output->info()->dimension(idx_height), _align_corners))
+            {
+                // Pixel replication by an integer factor does not need the precomputed offsets
+                _func = &NEScaleKernel::scale_nearest_upscale_nchw;
+            }
+            else
+            {
+                _func = (data_layout == DataLayout::NCHW) ? &NEScaleKernel::scale_nearest_nchw : &NEScaleKernel::scale_nhwc;
+            }
             break;
         }
         case InterpolationPolicy::BILINEAR:
@@ -423,6 +535,49 @@ void NEScaleKernel::configure(const ITensor *input, const ITensor *dx, const ITe
     INEKernel::configure(win_config.second);
 }
 
+void NEScaleKernel::scale_nearest_upscale_nchw(const Window &window)
+{
+    const size_t input_stride = _input->info()->strides_in_bytes()[1];
+    const int    factor       = static_cast<int>(_output->info()->dimension(0) / _input->info()->dimension(0));
+
+    // Nearest interpolation copies input elements unchanged, so only the element size matters
+    switch(_input->info()->element_size())
+    {
+        case 1:
+            if(factor == 2)
+            {
+                scale_nearest_upscale_nchw_core<uint8_t, 2>(_input, _output, window, input_stride);
+            }
+            else
+            {
+                scale_nearest_upscale_nchw_core<uint8_t, 4>(_input, _output, window, input_stride);
+            }
+            break;
+        case 2:
+            if(factor == 2)
+            {
+                scale_nearest_upscale_nchw_core<uint16_t, 2>(_input, _output, window, input_stride);
+            }
+            else
+            {
+                scale_nearest_upscale_nchw_core<uint16_t, 4>(_input, _output, window, input_stride);
+            }
+            break;
+        case 4:
+            if(factor == 2)
+            {
+                scale_nearest_upscale_nchw_core<uint32_t, 2>(_input, _output, window, input_stride);
+            }
+            else
+            {
+                scale_nearest_upscale_nchw_core<uint32_t, 4>(_input, _output, window, input_stride);
+            }
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Element size not supported");
+    }
+}
+
 void NEScaleKernel::scale_nearest_nchw(const Window &window)
 {
     const size_t input_stride = _input->info()->strides_in_bytes()[1];
@@ -653,4 +653,246 @@ void NELogits1DSoftmaxKernel<IS_LOG>::run(const Window &window, const ThreadInfo
 template class NELogits1DSoftmaxKernel<true>;
 template class NELogits1DSoftmaxKernel<false>;
 
+namespace
+{
+Status validate_arguments_logits_online_softmax(const ITensorInfo &input, const ITensorInfo &output, const float beta)
+{
+    ARM_COMPUTE_UNUSED(beta);
+    // Check input
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(&input);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(&input, 1, DataType::F16, DataType::F32);
+
+    // Check output if configured
+    if(output.total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(&input, &output);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(&input, &output);
+    }
+
+    return Status{};
+}
+
+template <typename T, bool is_log = false>
+void logits_1d_online_softmax_float(const ITensor &in, ITensor &out, const float beta, const Window &window)
+{
+    const int start_x     = in.info()->valid_region().anchor.x();
+    const int input_width = in.info()->valid_region().shape.x();
+
+    /** NEON vector tag type. */
+    using ExactTagType = typename wrapper::traits::neon_bitvector_tag_t<T, wrapper::traits::BitWidth::W128>;
+
+    constexpr int vec_size    = 16 / sizeof(T);
+    const int     red_stages  = log2(vec_size / 2);
+    const auto    vec_beta    = wrapper::vdup_n(static_cast<T>(beta), ExactTagType{});
+
+    Window win{ window };
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    Iterator in_it(&in, win);
+    Iterator out_it(&out, win);
+
+    execute_window_loop(win, [&](const Coordinates &)
+    {
+        /* Get pointers */
+        const auto in_ptr  = reinterpret_cast<const T *>(in_it.ptr()) + start_x;
+        const auto out_ptr = reinterpret_cast<T *>(out_it.ptr()) + start_x;
+
+        T max_val{};
+        T sum{};
+        T sum_inversed{};
+
+        /* First pass: compute the maximum and the sum of exponentials together, rescaling
+         * the per-lane running sums whenever a lane sees a new maximum */
+        {
+            auto vec_max = wrapper::vdup_n(support::cpp11::lowest<T>(), ExactTagType{});
+            auto vec_sum = wrapper::vdup_n(static_cast<T>(0), ExactTagType{});
+
+            int x = 0;
+            for(; x <= (input_width - vec_size); x += vec_size)
+            {
+                const auto vec_elements = wrapper::vloadq(in_ptr + x);
+                const auto vec_max_new  = wrapper::vmax(vec_max, vec_elements);
+
+                vec_sum = wrapper::vmul(vec_sum, wrapper::vexpq(wrapper::vmul(wrapper::vsub(vec_max, vec_max_new), vec_beta)));
+                vec_sum = wrapper::vadd(vec_sum, wrapper::vexpq(wrapper::vmul(wrapper::vsub(vec_elements, vec_max_new), vec_beta)));
+                vec_max = vec_max_new;
+            }
+
+            const bool has_vec = (x > 0);
+
+            /* Reduce the per-lane maxima to the row maximum */
+            max_val = support::cpp11::lowest<T>();
+            if(has_vec)
+            {
+                auto carry_max = wrapper::vpmax(wrapper::vgethigh(vec_max), wrapper::vgetlow(vec_max));
+                for(int i = 0; i < red_stages; ++i)
+                {
+                    carry_max = wrapper::vpmax(carry_max, carry_max);
+                }
+                max_val = wrapper::vgetlane(carry_max, 0);
+            }
+
+            /* Fold the leftover elements into the row maximum */
+            for(int i = x; i < input_width; ++i)
+            {
+                max_val = *(in_ptr + i) > max_val ? *(in_ptr + i) : max_val;
+            }
+
+            /* Rescale the per-lane sums to the row maximum and reduce */
+            sum = static_cast<T>(0);
+            if(has_vec)
+            {
+                vec_sum      = wrapper::vmul(vec_sum, wrapper::vexpq(wrapper::vmul(wrapper::vsub(vec_max, wrapper::vdup_n(max_val, ExactTagType{})), vec_beta)));
+                auto sum_res = wrapper::vpadd(wrapper::vgethigh(vec_sum), wrapper::vgetlow(vec_sum));
+                for(int i = 0; i < red_stages; ++i)
+                {
+                    sum_res = wrapper::vpadd(sum_res, sum_res);
+                }
+                sum = wrapper::vgetlane(sum_res, 0);
+            }
+
+            /* Run remaining elements */
+            for(; x < input_width; ++x)
+            {
+                sum += std::exp((in_ptr[x] - max_val) * beta);
+            }
+
+            if(!is_log)
+            {
+                sum_inversed = T(1) / sum;
+            }
+            else
+            {
+                sum = static_cast<T>(std::log(sum));
+            }
+        }
+
+        /* Second pass: recompute the shifted exponentials and normalize */
+        {
+            const auto vec_max = wrapper::vdup_n(max_val, ExactTagType{});
+
+            int x = 0;
+            for(; x <= (input_width - vec_size); x += vec_size)
+            {
+                const auto vec_elements = wrapper::vmul(wrapper::vsub(wrapper::vloadq(in_ptr + x), vec_max), vec_beta);
+
+                auto normalized_value = wrapper::vdup_n(static_cast<T>(0), ExactTagType{});
+                if(is_log)
+                {
+                    normalized_value = wrapper::vsub(vec_elements, wrapper::vdup_n(static_cast<T>(sum), ExactTagType{}));
+                }
+                else
+                {
+                    normalized_value = wrapper::vmul(wrapper::vexpq(vec_elements), wrapper::vdup_n(static_cast<T>(sum_inversed), ExactTagType{}));
+                }
+                wrapper::vstore(out_ptr + x, normalized_value);
+            }
+            /* Run remaining elements */
+            for(; x < input_width; ++x)
+            {
+                if(is_log)
+                {
+                    out_ptr[x] = (in_ptr[x] - max_val) * beta - sum;
+                }
+                else
+                {
+                    out_ptr[x] = std::exp((in_ptr[x] - max_val) * beta) * sum_inversed;
+                }
+            }
+        }
+    },
+    in_it, out_it);
+}
+} // namespace
+
+template <bool IS_LOG>
+NELogits1DOnlineSoftmaxKernel<IS_LOG>::NELogits1DOnlineSoftmaxKernel()
+    : _func(nullptr), _input(nullptr), _output(nullptr), _beta(1.0f)
+{
+}
+
+template <bool IS_LOG>
+void NELogits1DOnlineSoftmaxKernel<IS_LOG>::configure(const ITensor *input, ITensor *output, const float beta)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
+
+    configure(input->info(), output->info(), beta);
+
+    _input  = input;
+    _output = output;
+}
+
+template <bool IS_LOG>
+void NELogits1DOnlineSoftmaxKernel<IS_LOG>::configure(const ITensorInfo *input, ITensorInfo *output, const float beta)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
+    // Perform validation step
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments_logits_online_softmax(*input, *output, beta));
+
+    // Output auto initialization if not yet initialized
+    auto_init_if_empty(*output, TensorInfo(*input).reset_padding());
+
+    // Configure kernel window
+    Window      win = calculate_max_window(*input, Steps());
+    Coordinates coord;
+    coord.set_num_dimensions(output->num_dimensions());
+    output->set_valid_region(ValidRegion(coord, output->tensor_shape()));
+
+    switch(input->data_type())
+    {
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        case DataType::F16:
+            _func = &logits_1d_online_softmax_float<float16_t, IS_LOG>;
+            break;
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+        case DataType::F32:
+            _func = &logits_1d_online_softmax_float<float, IS_LOG>;
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Unsupported data type.");
+            break;
+    }
+
+    _beta = beta;
+
+    INEKernel::configure(win);
+}
+
+template <bool IS_LOG>
+Status NELogits1DOnlineSoftmaxKernel<IS_LOG>::validate(const ITensorInfo *input, const ITensorInfo *output, const float beta)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments_logits_online_softmax(*input, *output, beta));
+
+    return Status{};
+}
+
+template <bool IS_LOG>
+void NELogits1DOnlineSoftmaxKernel<IS_LOG>::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_func == nullptr);
+
+    (*_func)(*_input, *_output, _beta, window);
+}
+
+template <bool IS_LOG>
+void NELogits1DOnlineSoftmaxKernel<IS_LOG>::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_func == nullptr);
+
+    const ITensor *src = tensors.get_const_tensor(TensorType::ACL_SRC);
+    ITensor       *dst = tensors.get_tensor(TensorType::ACL_DST);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst);
+
+    (*_func)(*src, *dst, _beta, window);
+}
+
+template class NELogits1DOnlineSoftmaxKernel<true>;
+template class NELogits1DOnlineSoftmaxKernel<false>;
+
 } // namespace arm_compute
@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NESparseCompressKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+namespace arm_compute
+{
+namespace
+{
+Status validate_arguments_compress(const ITensorInfo *input, const ITensorInfo *bitmap, const ITensorInfo *nonzeros, const ITensorInfo *nnz)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, bitmap, nonzeros, nnz);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+
+    const size_t num_elements = input->tensor_shape().total_size();
+
+    // Checks performed when the outputs are configured
+    if(bitmap->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(bitmap, 1, DataType::U8);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(bitmap->num_dimensions() > 1, "Bitmap must be a 1D tensor");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(bitmap->dimension(0) < (num_elements + 7) / 8, "Bitmap must hold one bit per input element");
+    }
+    if(nonzeros->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, nonzeros);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(nonzeros->num_dimensions() > 1, "Packed non-zeros must be a 1D tensor");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(nonzeros->dimension(0) < num_elements, "Packed non-zeros must be sized for the dense element count");
+    }
+    if(nnz->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(nnz, 1, DataType::U32);
+        ARM_COMPUTE_RETURN_ERROR_ON(nnz->tensor_shape().total_size() != 1);
+    }
+
+    return Status{};
+}
+
+Status validate_arguments_decompress(const ITensorInfo *bitmap, const ITensorInfo *nonzeros, const ITensorInfo *output)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(bitmap, nonzeros, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(bitmap, 1, DataType::U8);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(nonzeros, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(output->total_size() == 0, "Output must carry the dense shape");
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(nonzeros, output);
+
+    const size_t num_elements = output->tensor_shape().total_size();
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(bitmap->dimension(0) < (num_elements + 7) / 8, "Bitmap must hold one bit per output element");
+
+    return Status{};
+}
+} // namespace
+
+NESparseCompressKernel::NESparseCompressKernel()
+    : _input(nullptr), _bitmap(nullptr), _nonzeros(nullptr), _nnz(nullptr)
+{
+}
+
+void NESparseCompressKernel::configure(const ITensor *input, ITensor *bitmap, ITensor *nonzeros, ITensor *nnz)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, bitmap, nonzeros, nnz);
+
+    const size_t num_elements = input->info()->tensor_shape().total_size();
+
+    // Output auto inizialitation if not yet initialized
+    auto_init_if_empty(*bitmap->info(), TensorShape((num_elements + 7) / 8), 1, DataType::U8);
+    auto_init_if_empty(*nonzeros->info(), TensorShape(num_elements), 1, input->info()->data_type());
+    auto_init_if_empty(*nnz->info(), TensorShape(1U), 1, DataType::U32);
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments_compress(input->info(), bitmap->info(), nonzeros->info(), nnz->info()));
+
+    _input    = input;
+    _bitmap   = bitmap;
+    _nonzeros = nonzeros;
+    _nnz      = nnz;
+
+    // Configure kernel window
+    Window win = calculate_max_window(*input->info(), Steps());
+    INEKernel::configure(win);
+}
+
+Status NESparseCompressKernel::validate(const ITensorInfo *input, const ITensorInfo *bitmap, const ITensorInfo *nonzeros, const ITensorInfo *nnz)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments_compress(input, bitmap, nonzeros, nnz));
+    return Status{};
+}
+
+bool NESparseCompressKernel::is_parallelisable() const
+{
+    // The position of each packed value depends on the count of earlier non-zeros
+    return false;
+}
+
+void NESparseCompressKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const auto window_start_x = static_cast<int>(window.x().start());
+    const auto window_end_x   = static_cast<int>(window.x().end());
+
+    Window win_collapsed = window.collapse_if_possible(window, Window::DimZ);
+    win_collapsed.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator input(_input, win_collapsed);
+
+    uint8_t *bitmap_ptr = _bitmap->buffer() + _bitmap->info()->offset_first_element_in_bytes();
+    auto     values_ptr = reinterpret_cast<float *>(_nonzeros->buffer() + _nonzeros->info()->offset_first_element_in_bytes());
+
+    // Presence bits are emitted in tensor iteration order, LSB first within each byte
+    size_t   nnz      = 0;
+    size_t   bit_idx  = 0;
+    uint8_t  bit_acc  = 0;
+
+    execute_window_loop(win_collapsed, [&](const Coordinates &)
+    {
+        const auto input_ptr = reinterpret_cast<const float *>(input.ptr());
+
+        for(int x = window_start_x; x < window_end_x; ++x)
+        {
+            const float value = *(input_ptr + x);
+            if(value != 0.f)
+            {
+                bit_acc |= 1U << (bit_idx % 8);
+                values_ptr[nnz++] = value;
+            }
+            if((++bit_idx % 8) == 0)
+            {
+                bitmap_ptr[(bit_idx - 1) / 8] = bit_acc;
+                bit_acc                       = 0;
+            }
+        }
+    },
+    input);
+
+    // Flush the trailing partial byte
+    if((bit_idx % 8) != 0)
+    {
+        bitmap_ptr[bit_idx / 8] = bit_acc;
+    }
+
+    *reinterpret_cast<uint32_t *>(_nnz->buffer() + _nnz->info()->offset_first_element_in_bytes()) = static_cast<uint32_t>(nnz);
+}
+
+NESparseDecompressKernel::NESparseDecompressKernel()
+    : _bitmap(nullptr), _nonzeros(nullptr), _output(nullptr)
+{
+}
+
+void NESparseDecompressKernel::configure(const ITensor *bitmap, const ITensor *nonzeros, ITensor *output)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(bitmap, nonzeros, output);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments_decompress(bitmap->info(), nonzeros->info(), output->info()));
+
+    _bitmap   = bitmap;
+    _nonzeros = nonzeros;
+    _output   = output;
+
+    // Configure kernel window
+    Window win = calculate_max_window(*output->info(), Steps());
+    INEKernel::configure(win);
+}
+
+Status NESparseDecompressKernel::validate(const ITensorInfo *bitmap, const ITensorInfo *nonzeros, const ITensorInfo *output)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments_decompress(bitmap, nonzeros, output));
+    return Status{};
+}
+
+bool NESparseDecompressKernel::is_parallelisable() const
+{
+    // The packed value stream is consumed sequentially
+    return false;
+}
+
+void NESparseDecompressKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const auto window_start_x = static_cast<int>(window.x().start());
+    const auto window_end_x   = static_cast<int>(window.x().end());
+
+    Window win_collapsed = window.collapse_if_possible(window, Window::DimZ);
+    win_collapsed.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator output(_output, win_collapsed);
+
+    const uint8_t *bitmap_ptr = _bitmap->buffer() + _bitmap->info()->offset_first_element_in_bytes();
+    const auto     values_ptr = reinterpret_cast<const float *>(_nonzeros->buffer() + _nonzeros->info()->offset_first_element_in_bytes());
+
+    size_t nnz     = 0;
+    size_t bit_idx = 0;
+
+    execute_window_loop(win_collapsed, [&](const Coordinates &)
+    {
+        const auto output_ptr = reinterpret_cast<float *>(output.ptr());
+
+        for(int x = window_start_x; x < window_end_x; ++x)
+        {
+            const bool present = (bitmap_ptr[bit_idx / 8] >> (bit_idx % 8)) & 1U;
+            *(output_ptr + x)  = present ? values_ptr[nnz++] : 0.f;
+            ++bit_idx;
+        }
+    },
+    output);
+}
+} // namespace arm_compute
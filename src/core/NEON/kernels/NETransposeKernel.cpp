@@ -76,8 +76,8 @@ unsigned int num_elems_processed(size_t element_size)
     switch(element_size)
     {
         case 1:
-            return 8;
         case 2:
+            return 8;
         case 4:
             return 4;
         default:
@@ -228,8 +228,8 @@ void transpose_8bit_elements(const ITensor *in, ITensor *out, const Window &wind
 
 void transpose_16bit_elements(const ITensor *in, ITensor *out, const Window &window)
 {
-    const int    window_step_x            = 4;
-    const int    window_step_y            = 4;
+    const int    window_step_x            = 8;
+    const int    window_step_y            = 8;
     const int    window_start_x           = window.x().start();
     const int    window_end_x             = window.x().end();
     const int    window_start_y           = window.y().start();
@@ -268,50 +268,79 @@ void transpose_16bit_elements(const ITensor *in, ITensor *out, const Window &win
         Iterator input(in, window_in);
         execute_window_loop(window_in, [&](const Coordinates & id)
         {
-            // Compute 4x4 elements per iteration
+            // Compute 8x8 elements per iteration
             int x = window_start_x;
             for(; x <= (window_end_x - window_step_x); x += window_step_x)
             {
-                const uint16x4_t row0 = vld1_u16(reinterpret_cast<const uint16_t *>(input.ptr() + 0 * input_stride_in_bytes) + x);
-                const uint16x4_t row1 = vld1_u16(reinterpret_cast<const uint16_t *>(input.ptr() + 1 * input_stride_in_bytes) + x);
-                const uint16x4_t row2 = vld1_u16(reinterpret_cast<const uint16_t *>(input.ptr() + 2 * input_stride_in_bytes) + x);
-                const uint16x4_t row3 = vld1_u16(reinterpret_cast<const uint16_t *>(input.ptr() + 3 * input_stride_in_bytes) + x);
+                const uint16x8_t row0 = vld1q_u16(reinterpret_cast<const uint16_t *>(input.ptr() + 0 * input_stride_in_bytes) + x);
+                const uint16x8_t row1 = vld1q_u16(reinterpret_cast<const uint16_t *>(input.ptr() + 1 * input_stride_in_bytes) + x);
+                const uint16x8_t row2 = vld1q_u16(reinterpret_cast<const uint16_t *>(input.ptr() + 2 * input_stride_in_bytes) + x);
+                const uint16x8_t row3 = vld1q_u16(reinterpret_cast<const uint16_t *>(input.ptr() + 3 * input_stride_in_bytes) + x);
+                const uint16x8_t row4 = vld1q_u16(reinterpret_cast<const uint16_t *>(input.ptr() + 4 * input_stride_in_bytes) + x);
+                const uint16x8_t row5 = vld1q_u16(reinterpret_cast<const uint16_t *>(input.ptr() + 5 * input_stride_in_bytes) + x);
+                const uint16x8_t row6 = vld1q_u16(reinterpret_cast<const uint16_t *>(input.ptr() + 6 * input_stride_in_bytes) + x);
+                const uint16x8_t row7 = vld1q_u16(reinterpret_cast<const uint16_t *>(input.ptr() + 7 * input_stride_in_bytes) + x);
 
                 // Transpose 2x2
-                const uint16x4x2_t k0_u16 = vtrn_u16(row0, row1);
-                const uint16x4x2_t k1_u16 = vtrn_u16(row2, row3);
+                const uint16x8x2_t k0_u16 = vtrnq_u16(row0, row1);
+                const uint16x8x2_t k1_u16 = vtrnq_u16(row2, row3);
+                const uint16x8x2_t k2_u16 = vtrnq_u16(row4, row5);
+                const uint16x8x2_t k3_u16 = vtrnq_u16(row6, row7);
 
                 // Transpose 4x4
-                const uint32x2x2_t k0_u32 = vtrn_u32(vreinterpret_u32_u16(k0_u16.val[0]), vreinterpret_u32_u16(k1_u16.val[0]));
-                const uint32x2x2_t k1_u32 = vtrn_u32(vreinterpret_u32_u16(k0_u16.val[1]), vreinterpret_u32_u16(k1_u16.val[1]));
+                const uint32x4x2_t k0_u32 = vtrnq_u32(vreinterpretq_u32_u16(k0_u16.val[0]), vreinterpretq_u32_u16(k1_u16.val[0]));
+                const uint32x4x2_t k1_u32 = vtrnq_u32(vreinterpretq_u32_u16(k0_u16.val[1]), vreinterpretq_u32_u16(k1_u16.val[1]));
+                const uint32x4x2_t k2_u32 = vtrnq_u32(vreinterpretq_u32_u16(k2_u16.val[0]), vreinterpretq_u32_u16(k3_u16.val[0]));
+                const uint32x4x2_t k3_u32 = vtrnq_u32(vreinterpretq_u32_u16(k2_u16.val[1]), vreinterpretq_u32_u16(k3_u16.val[1]));
 
                 // Compute destination address
                 const size_t dst_offset_in_bytes = id.y() * sizeof(uint16_t) + x * output_stride_in_bytes;
 
-                vst1_u16(reinterpret_cast<uint16_t *>(output.ptr() + dst_offset_in_bytes + 0 * output_stride_in_bytes), vreinterpret_u16_u32(k0_u32.val[0]));
-                vst1_u16(reinterpret_cast<uint16_t *>(output.ptr() + dst_offset_in_bytes + 1 * output_stride_in_bytes), vreinterpret_u16_u32(k1_u32.val[0]));
-                vst1_u16(reinterpret_cast<uint16_t *>(output.ptr() + dst_offset_in_bytes + 2 * output_stride_in_bytes), vreinterpret_u16_u32(k0_u32.val[1]));
-                vst1_u16(reinterpret_cast<uint16_t *>(output.ptr() + dst_offset_in_bytes + 3 * output_stride_in_bytes), vreinterpret_u16_u32(k1_u32.val[1]));
+                // Transpose 8x8: swap the low/high halves of the 4x4 blocks and store
+                vst1q_u16(reinterpret_cast<uint16_t *>(output.ptr() + dst_offset_in_bytes + 0 * output_stride_in_bytes),
+                          vreinterpretq_u16_u32(vcombine_u32(vget_low_u32(k0_u32.val[0]), vget_low_u32(k2_u32.val[0]))));
+                vst1q_u16(reinterpret_cast<uint16_t *>(output.ptr() + dst_offset_in_bytes + 1 * output_stride_in_bytes),
+                          vreinterpretq_u16_u32(vcombine_u32(vget_low_u32(k1_u32.val[0]), vget_low_u32(k3_u32.val[0]))));
+                vst1q_u16(reinterpret_cast<uint16_t *>(output.ptr() + dst_offset_in_bytes + 2 * output_stride_in_bytes),
+                          vreinterpretq_u16_u32(vcombine_u32(vget_low_u32(k0_u32.val[1]), vget_low_u32(k2_u32.val[1]))));
+                vst1q_u16(reinterpret_cast<uint16_t *>(output.ptr() + dst_offset_in_bytes + 3 * output_stride_in_bytes),
+                          vreinterpretq_u16_u32(vcombine_u32(vget_low_u32(k1_u32.val[1]), vget_low_u32(k3_u32.val[1]))));
+                vst1q_u16(reinterpret_cast<uint16_t *>(output.ptr() + dst_offset_in_bytes + 4 * output_stride_in_bytes),
+                          vreinterpretq_u16_u32(vcombine_u32(vget_high_u32(k0_u32.val[0]), vget_high_u32(k2_u32.val[0]))));
+                vst1q_u16(reinterpret_cast<uint16_t *>(output.ptr() + dst_offset_in_bytes + 5 * output_stride_in_bytes),
+                          vreinterpretq_u16_u32(vcombine_u32(vget_high_u32(k1_u32.val[0]), vget_high_u32(k3_u32.val[0]))));
+                vst1q_u16(reinterpret_cast<uint16_t *>(output.ptr() + dst_offset_in_bytes + 6 * output_stride_in_bytes),
+                          vreinterpretq_u16_u32(vcombine_u32(vget_high_u32(k0_u32.val[1]), vget_high_u32(k2_u32.val[1]))));
+                vst1q_u16(reinterpret_cast<uint16_t *>(output.ptr() + dst_offset_in_bytes + 7 * output_stride_in_bytes),
+                          vreinterpretq_u16_u32(vcombine_u32(vget_high_u32(k1_u32.val[1]), vget_high_u32(k3_u32.val[1]))));
             }
 
-            // Compute left-over elements (1x4)
+            // Compute left-over elements (1x8)
             for(; x < window_end_x; ++x)
             {
                 const uint16_t val0 = *(reinterpret_cast<uint16_t *>(input.ptr() + 0 * input_stride_in_bytes) + x);
                 const uint16_t val1 = *(reinterpret_cast<uint16_t *>(input.ptr() + 1 * input_stride_in_bytes) + x);
                 const uint16_t val2 = *(reinterpret_cast<uint16_t *>(input.ptr() + 2 * input_stride_in_bytes) + x);
                 const uint16_t val3 = *(reinterpret_cast<uint16_t *>(input.ptr() + 3 * input_stride_in_bytes) + x);
-
-                uint16x4_t result = vdup_n_u16(0);
-                result            = vset_lane_u16(val0, result, 0);
-                result            = vset_lane_u16(val1, result, 1);
-                result            = vset_lane_u16(val2, result, 2);
-                result            = vset_lane_u16(val3, result, 3);
+                const uint16_t val4 = *(reinterpret_cast<uint16_t *>(input.ptr() + 4 * input_stride_in_bytes) + x);
+                const uint16_t val5 = *(reinterpret_cast<uint16_t *>(input.ptr() + 5 * input_stride_in_bytes) + x);
+                const uint16_t val6 = *(reinterpret_cast<uint16_t *>(input.ptr() + 6 * input_stride_in_bytes) + x);
+                const uint16_t val7 = *(reinterpret_cast<uint16_t *>(input.ptr() + 7 * input_stride_in_bytes) + x);
+
+                uint16x8_t result = vdupq_n_u16(0);
+                result            = vsetq_lane_u16(val0, result, 0);
+                result            = vsetq_lane_u16(val1, result, 1);
+                result            = vsetq_lane_u16(val2, result, 2);
+                result            = vsetq_lane_u16(val3, result, 3);
+                result            = vsetq_lane_u16(val4, result, 4);
+                result            = vsetq_lane_u16(val5, result, 5);
+                result            = vsetq_lane_u16(val6, result, 6);
+                result            = vsetq_lane_u16(val7, result, 7);
 
                 // Compute destination address
                 const size_t dst_offset_in_bytes = id.y() * sizeof(uint16_t) + x * output_stride_in_bytes;
 
-                vst1_u16(reinterpret_cast<uint16_t *>(output.ptr() + dst_offset_in_bytes), result);
+                vst1q_u16(reinterpret_cast<uint16_t *>(output.ptr() + dst_offset_in_bytes), result);
             }
         },
         input, output);
@@ -516,5 +545,16 @@ void NETransposeKernel::run(const Window &window, const ThreadInfo &info)
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
     ARM_COMPUTE_ERROR_ON(_func == nullptr);
 
-    (*_func)(_input, _output, window);
+    // Process the window in cache-sized tiles: every input column touches a different
+    // output row, so sweeping the full width keeps one cache line open per column and
+    // thrashes the caches on large matrices. Tiling the columns to the L1 and the rows
+    // to the L2 bounds the set of concurrently written output lines at both levels
+    static const CPUInfo default_cpu_info{};
+    const CPUInfo     &cpu_info = (info.cpu_info != nullptr) ? *info.cpu_info : default_cpu_info;
+    const WindowTiling tiling   = calculate_cache_tiling(window, _input->info()->element_size(), cpu_info);
+
+    execute_window_loop_tiled(window, tiling, [&](const Window & tile)
+    {
+        (*_func)(_input, _output, tile);
+    });
 }
@@ -274,6 +274,7 @@ template class NEWinogradLayerTransformWeightsKernel<float, 1, 2, 1, 7>;
 template class NEWinogradLayerTransformWeightsKernel<float, 2, 1, 7, 1>;
 
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+template class NEWinogradLayerTransformWeightsKernel<__fp16, 2, 2, 3, 3>;
 template class NEWinogradLayerTransformWeightsKernel<__fp16, 4, 4, 3, 3>;
 #endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
 
@@ -412,6 +413,7 @@ template class NEWinogradLayerTransformInputKernel<float, 1, 2, 1, 7>;
 template class NEWinogradLayerTransformInputKernel<float, 2, 1, 7, 1>;
 
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+template class NEWinogradLayerTransformInputKernel<__fp16, 2, 2, 3, 3>;
 template class NEWinogradLayerTransformInputKernel<__fp16, 4, 4, 3, 3>;
 #endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
 
@@ -544,6 +546,7 @@ template class NEWinogradLayerTransformOutputKernel<float, 1, 2, 1, 7>;
 template class NEWinogradLayerTransformOutputKernel<float, 2, 1, 7, 1>;
 
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+template class NEWinogradLayerTransformOutputKernel<__fp16, 2, 2, 3, 3>;
 template class NEWinogradLayerTransformOutputKernel<__fp16, 4, 4, 3, 3>;
 #endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
 } // namespace arm_compute
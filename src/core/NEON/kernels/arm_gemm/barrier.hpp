@@ -26,39 +26,54 @@
 #ifndef NO_MULTI_THREADING
 
 #include <atomic>
+#include <thread>
 
 namespace arm_gemm {
 
+/* Sense-reversing barrier: a single arrival counter plus a global sense word
+ * that the last arrival flips to release the waiters.  Compared to the
+ * previous two-counter scheme this needs one synchronization phase per pass
+ * instead of two, which matters for interleaved GEMMs with many K-block sync
+ * points.  Waiters spin for a configurable budget before starting to yield to
+ * the OS, so oversubscribed systems don't burn a core per waiter. */
 class barrier {
 private:
-    unsigned int        m_threads;
+    /* Default number of spin iterations before a waiter starts yielding. */
+    static constexpr unsigned int default_spin_budget = 10000;
 
-    std::atomic<unsigned int> m_waiters;
-    std::atomic<unsigned int> m_leavers;
+    unsigned int m_threads;
+    unsigned int m_spin_budget = default_spin_budget;
+
+    std::atomic<unsigned int> m_arrived;
+    std::atomic<unsigned int> m_sense;
 
 public:
-    barrier(unsigned int threads) : m_threads(threads), m_waiters(0), m_leavers(0) { }
+    barrier(unsigned int threads) : m_threads(threads), m_arrived(0), m_sense(0) { }
 
     /* This isn't safe if any thread is waiting... */
     void set_nthreads(unsigned int nthreads) {
         m_threads = nthreads;
     }
 
-    void arrive_and_wait() {
-        m_waiters++;
-
-        while (m_waiters != m_threads) {
-            ; /* spin */
-        }
+    /* Number of spin iterations before waiters fall back to yielding. */
+    void set_spin_budget(unsigned int budget) {
+        m_spin_budget = budget;
+    }
 
-        unsigned int v = m_leavers.fetch_add(1);
+    void arrive_and_wait() {
+        const unsigned int sense = m_sense.load(std::memory_order_relaxed);
 
-        if (v == (m_threads - 1)) {
-            m_waiters -= m_threads;
-            m_leavers = 0;
+        if (m_arrived.fetch_add(1, std::memory_order_acq_rel) == (m_threads - 1)) {
+            /* Last arrival: reset the counter and release everyone by flipping the sense. */
+            m_arrived.store(0, std::memory_order_relaxed);
+            m_sense.store(sense + 1, std::memory_order_release);
         } else {
-            while (m_leavers > 0) {
-                ; /* spin */
+            unsigned int spins = 0;
+
+            while (m_sense.load(std::memory_order_acquire) == sense) {
+                if (++spins > m_spin_budget) {
+                    std::this_thread::yield();
+                }
             }
         }
     }
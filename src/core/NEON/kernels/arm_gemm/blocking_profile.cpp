@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "blocking_profile.hpp"
+
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <tuple>
+
+namespace arm_gemm {
+
+struct BlockingProfileStore::impl {
+    typedef std::tuple<unsigned int, unsigned int, unsigned int, unsigned int> key_type;
+
+    struct entry {
+        unsigned int k_block;
+        unsigned int x_block;
+    };
+
+    std::mutex               lock;
+    std::map<key_type, entry> entries;
+    std::string              filename;
+    bool                     loaded = false;
+
+    void load_if_needed() {
+        if (loaded) {
+            return;
+        }
+        loaded = true;
+
+        const char *env = getenv("ARM_GEMM_BLOCK_PROFILE");
+        if (env == nullptr) {
+            return;
+        }
+        filename = env;
+
+        std::ifstream file(filename);
+        std::string   line;
+        while (std::getline(file, line)) {
+            std::istringstream ss(line);
+            unsigned int M, N, K, esize, k_block, x_block;
+
+            if (ss >> M >> N >> K >> esize >> k_block >> x_block) {
+                entries[std::make_tuple(M, N, K, esize)] = { k_block, x_block };
+            }
+        }
+    }
+
+    void save() {
+        if (filename.empty()) {
+            return;
+        }
+
+        std::ofstream file(filename, std::ios::trunc);
+        for (const auto &e : entries) {
+            file << std::get<0>(e.first) << " " << std::get<1>(e.first) << " "
+                 << std::get<2>(e.first) << " " << std::get<3>(e.first) << " "
+                 << e.second.k_block << " " << e.second.x_block << "\n";
+        }
+    }
+};
+
+BlockingProfileStore &BlockingProfileStore::get() {
+    static BlockingProfileStore store;
+    return store;
+}
+
+BlockingProfileStore::impl &BlockingProfileStore::state() {
+    static impl s;
+    return s;
+}
+
+bool BlockingProfileStore::lookup(unsigned int M, unsigned int N, unsigned int K, unsigned int esize,
+                                  unsigned int &k_block, unsigned int &x_block) {
+    impl &s = state();
+    std::lock_guard<std::mutex> guard(s.lock);
+
+    s.load_if_needed();
+
+    auto it = s.entries.find(std::make_tuple(M, N, K, esize));
+    if (it == s.entries.end()) {
+        return false;
+    }
+
+    k_block = it->second.k_block;
+    x_block = it->second.x_block;
+    return true;
+}
+
+void BlockingProfileStore::update(unsigned int M, unsigned int N, unsigned int K, unsigned int esize,
+                                  unsigned int k_block, unsigned int x_block) {
+    impl &s = state();
+    std::lock_guard<std::mutex> guard(s.lock);
+
+    s.load_if_needed();
+    s.entries[std::make_tuple(M, N, K, esize)] = { k_block, x_block };
+    s.save();
+}
+
+void tune_blocking(unsigned int M, unsigned int N, unsigned int K, unsigned int esize,
+                   unsigned int default_k_block, unsigned int default_x_block,
+                   unsigned int k_multiple, unsigned int x_multiple,
+                   const std::function<double(unsigned int k_block, unsigned int x_block)> &benchmark) {
+    /* Only shrink from the heuristic defaults: growing the blocks would need
+     * more working space than the operator has allocated. */
+    unsigned int best_k = default_k_block;
+    unsigned int best_x = default_x_block;
+    double       best_time = std::numeric_limits<double>::max();
+
+    for (unsigned int kd = 1; kd <= 4; kd *= 2) {
+        unsigned int k_block = default_k_block / kd;
+        k_block = std::max(k_block - (k_block % k_multiple), k_multiple);
+
+        for (unsigned int xd = 1; xd <= 4; xd *= 2) {
+            unsigned int x_block = default_x_block / xd;
+            x_block = std::max(x_block - (x_block % x_multiple), x_multiple);
+
+            const double t = benchmark(k_block, x_block);
+            if (t < best_time) {
+                best_time = t;
+                best_k    = k_block;
+                best_x    = x_block;
+            }
+        }
+    }
+
+    BlockingProfileStore::get().update(M, N, K, esize, best_k, best_x);
+}
+
+} // namespace arm_gemm
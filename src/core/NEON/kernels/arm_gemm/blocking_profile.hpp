@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include <functional>
+
+namespace arm_gemm {
+
+/* Persisted per-shape blocking profiles.
+ *
+ * The static cache heuristics in gemm_interleaved/gemm_hybrid pick reasonable
+ * blocking for square-ish problems but can leave performance on the table for
+ * the skinny shapes some models produce.  This store keeps a (M, N, K, element
+ * size) -> (inner block, outer block) map, loaded lazily from the file named
+ * by the ARM_GEMM_BLOCK_PROFILE environment variable and written back whenever
+ * a new winner is recorded.
+ *
+ * File format is one entry per line: "M N K esize k_block x_block".
+ */
+class BlockingProfileStore {
+public:
+    static BlockingProfileStore &get();
+
+    /* Look a shape up; returns true and fills in the blocks if a profile exists.
+     * The caller is responsible for rounding the returned values to the
+     * strategy's k_unroll / out_width multiples. */
+    bool lookup(unsigned int M, unsigned int N, unsigned int K, unsigned int esize,
+                unsigned int &k_block, unsigned int &x_block);
+
+    /* Record the winning blocking for a shape and persist the store. */
+    void update(unsigned int M, unsigned int N, unsigned int K, unsigned int esize,
+                unsigned int k_block, unsigned int x_block);
+
+private:
+    BlockingProfileStore() = default;
+
+    struct impl;
+    impl &state();
+};
+
+/* Sweep candidate blockings for a shape and persist the winner.
+ *
+ * Starting from the heuristic defaults, candidates at 1x, 1/2x and 1/4x of
+ * each block size are timed through the supplied benchmark callback (which
+ * should return the execution time of one GEMM pass with the given k_block /
+ * x_block, e.g. by configuring and running the operator).  The fastest
+ * combination is stored in the BlockingProfileStore so later runs pick it up
+ * at configure time.
+ */
+void tune_blocking(unsigned int M, unsigned int N, unsigned int K, unsigned int esize,
+                   unsigned int default_k_block, unsigned int default_x_block,
+                   unsigned int k_multiple, unsigned int x_multiple,
+                   const std::function<double(unsigned int k_block, unsigned int x_block)> &benchmark);
+
+} // namespace arm_gemm
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "decision_cache.hpp"
+
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <mutex>
+
+namespace arm_gemm {
+
+struct GemmDecisionCache::impl {
+    std::mutex                         lock;
+    std::map<std::string, std::string> entries;
+    std::string                        filename;
+    bool                               loaded = false;
+
+    void load_if_needed() {
+        if (loaded) {
+            return;
+        }
+        loaded = true;
+
+        const char *env = getenv("ARM_GEMM_DECISION_CACHE");
+        if (env == nullptr) {
+            return;
+        }
+        filename = env;
+
+        std::ifstream file(filename);
+        std::string   line;
+        while (std::getline(file, line)) {
+            const size_t sep = line.find('\t');
+
+            if (sep != std::string::npos && sep > 0) {
+                entries[line.substr(sep + 1)] = line.substr(0, sep);
+            }
+        }
+    }
+
+    void save() {
+        if (filename.empty()) {
+            return;
+        }
+
+        std::ofstream file(filename, std::ios::trunc);
+        for (const auto &e : entries) {
+            file << e.second << "\t" << e.first << "\n";
+        }
+    }
+};
+
+GemmDecisionCache &GemmDecisionCache::get() {
+    static GemmDecisionCache cache;
+    return cache;
+}
+
+GemmDecisionCache::impl &GemmDecisionCache::state() {
+    static impl s;
+    return s;
+}
+
+bool GemmDecisionCache::lookup(const std::string &key, std::string &name) {
+    impl &s = state();
+    std::lock_guard<std::mutex> guard(s.lock);
+
+    s.load_if_needed();
+
+    auto it = s.entries.find(key);
+    if (it == s.entries.end()) {
+        return false;
+    }
+
+    name = it->second;
+    return true;
+}
+
+void GemmDecisionCache::update(const std::string &key, const std::string &name) {
+    impl &s = state();
+    std::lock_guard<std::mutex> guard(s.lock);
+
+    s.load_if_needed();
+
+    auto it = s.entries.find(key);
+    if (it != s.entries.end() && it->second == name) {
+        return;
+    }
+
+    s.entries[key] = name;
+    s.save();
+}
+
+} // namespace arm_gemm
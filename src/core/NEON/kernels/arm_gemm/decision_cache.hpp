@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "bfloat.hpp"
+
+namespace arm_gemm {
+
+/* Process-wide cache of GEMM implementation decisions.
+ *
+ * find_implementation() walks the implementation list and evaluates the
+ * cycle-estimate heuristics on every configure; for graphs with hundreds of
+ * GEMM nodes this adds measurable startup cost even though the same (shape,
+ * type, CPU) keys recur.  This cache maps a textual decision key to the name
+ * of the previously chosen implementation so repeated configures (and, when
+ * the ARM_GEMM_DECISION_CACHE environment variable names a file, repeated
+ * process startups) skip heuristic evaluation entirely.
+ *
+ * File format is one entry per line: "<impl name>\t<key>".
+ */
+class GemmDecisionCache {
+public:
+    static GemmDecisionCache &get();
+
+    /* Look a decision key up; returns true and fills in the implementation name on a hit. */
+    bool lookup(const std::string &key, std::string &name);
+
+    /* Record the chosen implementation for a key; persists if a cache file is configured. */
+    void update(const std::string &key, const std::string &name);
+
+private:
+    GemmDecisionCache() = default;
+
+    struct impl;
+    impl &state();
+};
+
+/* Maps the template types used in the GEMM interface to stable names for decision keys.
+ * (RTTI-free so the library can be built with -fno-rtti.) */
+template<typename T> const char *decision_type_name();
+
+template<> inline const char *decision_type_name<float>()    { return "fp32"; }
+template<> inline const char *decision_type_name<int8_t>()   { return "s8"; }
+template<> inline const char *decision_type_name<uint8_t>()  { return "u8"; }
+template<> inline const char *decision_type_name<int16_t>()  { return "s16"; }
+template<> inline const char *decision_type_name<uint16_t>() { return "u16"; }
+template<> inline const char *decision_type_name<int32_t>()  { return "s32"; }
+template<> inline const char *decision_type_name<uint32_t>() { return "u32"; }
+template<> inline const char *decision_type_name<bfloat16>() { return "bf16"; }
+#if defined(__ARM_FP16_ARGS)
+template<> inline const char *decision_type_name<__fp16>()   { return "fp16"; }
+#endif
+
+} // namespace arm_gemm
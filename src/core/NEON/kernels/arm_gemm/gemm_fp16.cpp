@@ -42,18 +42,20 @@
 namespace arm_gemm {
 
 static const GemmImplementation<__fp16, __fp16> gemm_fp16_methods[] = {
+// fp16-accumulate kernels: skipped when wide accumulation is requested, which
+// falls selection through to the fp32-accumulate sgemm variants below.
 #if defined(__ARM_FEATURE_SVE)
 {
     GemmMethod::GEMM_HYBRID,
     "hybrid_fp16_mla_4VLx4",
-    [](const GemmArgs &args) { return (args._Ksize >= 8); },
+    [](const GemmArgs &args) { return (args._Ksize >= 8) && !args._wide_accumulate; },
     [](const GemmArgs &args) { return ((args._Ksize <= 256) && (args._Nsize <= 256)) || ((args._nmulti > 1) && ((args._Msize / args._maxthreads) < 8)); },
     [](const GemmArgs &args) { return new GemmHybrid<hybrid_fp16_mla_4VLx4, __fp16, __fp16>(args); }
 },
 {
     GemmMethod::GEMM_INTERLEAVED,
     "interleaved_fp16_mla_3VLx8",
-    [](const GemmArgs &args) { return (args._Ksize > 4); },
+    [](const GemmArgs &args) { return (args._Ksize > 4) && !args._wide_accumulate; },
     nullptr,
     [](const GemmArgs &args) { return new GemmInterleaved<interleaved_fp16_mla_3VLx8, __fp16, __fp16>(args); }
 },
@@ -64,9 +66,9 @@ static const GemmImplementation<__fp16, __fp16> gemm_fp16_methods[] = {
     GemmMethod::GEMM_INTERLEAVED_2D,
     "hgemm_24x8_2d",
 #ifndef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
-    [](const GemmArgs &args) { return args._ci->has_fp16(); },
+    [](const GemmArgs &args) { return args._ci->has_fp16() && !args._wide_accumulate; },
 #else
-    nullptr,
+    [](const GemmArgs &args) { return !args._wide_accumulate; },
 #endif
     [](const GemmArgs &args) { return args._maxthreads >= 8; },
     [](const GemmArgs &args) { return new GemmInterleavedPretransposed2d<hgemm_24x8, __fp16, __fp16>(args); }
@@ -75,9 +77,9 @@ static const GemmImplementation<__fp16, __fp16> gemm_fp16_methods[] = {
     GemmMethod::GEMM_INTERLEAVED,
     "hgemm_24x8_1d",
 #ifndef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
-    [](const GemmArgs &args) { return args._ci->has_fp16(); },
+    [](const GemmArgs &args) { return args._ci->has_fp16() && !args._wide_accumulate; },
 #else
-    nullptr,
+    [](const GemmArgs &args) { return !args._wide_accumulate; },
 #endif
     nullptr,
     [](const GemmArgs &args) { return new GemmInterleaved<hgemm_24x8, __fp16, __fp16>(args); }
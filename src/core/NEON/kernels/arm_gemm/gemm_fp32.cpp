@@ -25,13 +25,17 @@
 #include "gemm_common.hpp"
 #include "gemm_hybrid.hpp"
 #include "gemm_implementation.hpp"
+#include "gemm_indirect.hpp"
 #include "gemm_interleaved.hpp"
 #include "gemm_interleaved_pretransposed_2d.hpp"
+#include "gemm_sparse.hpp"
 #include "gemv_batched.hpp"
 #include "gemv_pretransposed.hpp"
 
 #include "kernels/a32_sgemm_8x6.hpp"
 #include "kernels/a64_hybrid_fp32_mla_16x4.hpp"
+#include "kernels/a64_interleaved_bf16fp32_dot_12x8.hpp"
+#include "kernels/a64_interleaved_bf16fp32_mmla_12x8.hpp"
 #include "kernels/a64_hybrid_fp32_mla_4x8.hpp"
 #include "kernels/a64_smallK_hybrid_fp32_mla_4x6.hpp"
 #include "kernels/a64_smallK_hybrid_fp32_mla_4x8.hpp"
@@ -39,6 +43,8 @@
 #include "kernels/a64_sgemv_pretransposed.hpp"
 
 #include "kernels/sve_hybrid_fp32_mla_4VLx4.hpp"
+#include "kernels/sve_interleaved_bf16fp32_dot_3VLx8.hpp"
+#include "kernels/sve_interleaved_bf16fp32_mmla_3VLx8.hpp"
 #include "kernels/sve_hybrid_fp32_mmla_4VLx4.hpp"
 #include "kernels/sve_interleaved_fp32_mla_3VLx8.hpp"
 #include "kernels/sve_interleaved_fp32_mmla_3VLx8.hpp"
@@ -63,6 +69,42 @@ static const GemmImplementation<float, float> gemm_fp32_methods[] =
     nullptr,
     [](const GemmArgs &args) { return new GemvPretransposed<sgemv_pretransposed, float, float>(args); }
 },
+
+// "Fast mode" methods: trade FP32 accuracy for throughput by converting the
+// operands to BFLOAT16 in the interleave step and using the BF16 inner
+// product instructions.  Only considered when explicitly requested.
+#ifdef V8P6_BF
+# ifdef __ARM_FEATURE_SVE
+{
+    GemmMethod::GEMM_INTERLEAVED,
+    "fast_interleaved_bf16fp32_mmla_3VLx8",
+    [](const GemmArgs &args) { return args._fast_mode && (args._Ksize>4); },
+    nullptr,
+    [](const GemmArgs &args) { return new GemmInterleaved<interleaved_bf16fp32_mmla_3VLx8, float, float>(args); }
+},
+{
+    GemmMethod::GEMM_INTERLEAVED,
+    "fast_interleaved_bf16fp32_dot_3VLx8",
+    [](const GemmArgs &args) { return args._fast_mode && (args._Ksize>2); },
+    nullptr,
+    [](const GemmArgs &args) { return new GemmInterleaved<interleaved_bf16fp32_dot_3VLx8, float, float>(args); }
+},
+# endif // __ARM_FEATURE_SVE
+{
+    GemmMethod::GEMM_INTERLEAVED,
+    "fast_interleaved_bf16fp32_mmla_12x8",
+    [](const GemmArgs &args) { return args._fast_mode && (args._Ksize>4); },
+    nullptr,
+    [](const GemmArgs &args) { return new GemmInterleaved<interleaved_bf16fp32_mmla_12x8, float, float>(args); }
+},
+{
+    GemmMethod::GEMM_INTERLEAVED,
+    "fast_interleaved_bf16fp32_dot_12x8",
+    [](const GemmArgs &args) { return args._fast_mode && (args._Ksize>2); },
+    nullptr,
+    [](const GemmArgs &args) { return new GemmInterleaved<interleaved_bf16fp32_dot_12x8, float, float>(args); }
+},
+#endif // V8P6_BF
 #if defined(__ARM_FEATURE_SVE) && defined(MMLA_FP32)
 {
     GemmMethod::GEMM_HYBRID,
@@ -137,6 +179,26 @@ GemmImplementation<float, float>::with_estimate(
     [](const GemmArgs &args) { return new GemmInterleaved<interleaved_fp32_mla_3VLx8, float, float>(args); }
 },
 #endif // __ARM_FEATURE_SVE
+
+// Indirect convolution: only valid when convolution parameters are
+// supplied, and only requested explicitly (via GemmConfig) by callers
+// which have them.
+#ifdef __ARM_FEATURE_SVE
+{
+    GemmMethod::GEMM_INDIRECT,
+    "indirect_fp32_mla_4VLx4",
+    [](const GemmArgs &args) { return (args._conv != nullptr) && (args._Ksize >= 4); },
+    [](const GemmArgs &) { return false; },
+    [](const GemmArgs &args) { return new GemmIndirect<hybrid_fp32_mla_4VLx4, float, float>(args); }
+},
+#endif // __ARM_FEATURE_SVE
+{
+    GemmMethod::GEMM_INDIRECT,
+    "indirect_fp32_mla_16x4",
+    [](const GemmArgs &args) { return (args._conv != nullptr) && (args._Ksize >= 4); },
+    [](const GemmArgs &) { return false; },
+    [](const GemmArgs &args) { return new GemmIndirect<hybrid_fp32_mla_16x4, float, float>(args); }
+},
 // Pretranposed, 2D split
 GemmImplementation<float, float>::with_estimate(
     GemmMethod::GEMM_INTERLEAVED_2D,
@@ -164,6 +226,17 @@ GemmImplementation<float, float>::with_estimate(
     [](const GemmArgs &args) { return new GemmInterleaved<sgemm_8x6, float, float>(args); }
 },
 #endif // __arm__
+
+// Block-sparse path for pruned weights.  The density of B isn't known at
+// selection time, so this is never recommended by the heuristics; callers
+// which have measured the density request it explicitly via GemmConfig.
+{
+    GemmMethod::GEMM_SPARSE,
+    "gemm_sparse_fp32",
+    nullptr,
+    [](const GemmArgs &) { return false; },
+    [](const GemmArgs &args) { return new GemmSparse<float, float>(args); }
+},
 {
     GemmMethod::DEFAULT,
     "",
@@ -28,6 +28,7 @@
 
 #include "arm_gemm.hpp"
 #include "bias_adder.hpp"
+#include "blocking_profile.hpp"
 #include "ndrange.hpp"
 #include "performance_parameters.hpp"
 #include "transform.hpp"
@@ -96,6 +97,12 @@ class GemmHybrid : public GemmCommon<To, Tr> {
         // And round UP to the K unroll level required.
         k_block = roundup(k_block, strategy::k_unroll());
 
+        // Allow a persisted per-shape tuning profile to override the heuristic.
+        unsigned int profile_k = 0, profile_x = 0;
+        if (BlockingProfileStore::get().lookup(args._Msize, args._Nsize, args._Ksize, sizeof(Toi), profile_k, profile_x) && profile_k) {
+            k_block = roundup(profile_k, strategy::k_unroll());
+        }
+
         return k_block;
     }
 
@@ -121,6 +128,12 @@ class GemmHybrid : public GemmCommon<To, Tr> {
         n_block = iceildiv(args._Nsize, numblocks);
         n_block = roundup(n_block, strategy::out_width());
 
+        // Allow a persisted per-shape tuning profile to override the heuristic.
+        unsigned int profile_k = 0, profile_x = 0;
+        if (BlockingProfileStore::get().lookup(args._Msize, args._Nsize, args._Ksize, sizeof(Toi), profile_k, profile_x) && profile_x) {
+            n_block = roundup(profile_x, strategy::out_width());
+        }
+
         return n_block;
     }
 
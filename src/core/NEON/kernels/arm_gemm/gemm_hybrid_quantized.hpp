@@ -32,6 +32,7 @@
 #include "utils.hpp"
 
 #include "mergeresults.hpp"
+#include "thread_arena.hpp"
 #include "transform.hpp"
 
 #ifdef CYCLE_PROFILING
@@ -64,14 +65,10 @@ class GemmHybridQuantized : public GemmCommon<To, Tr> {
     /* Pretransposed buffer. */
     const Toi *_B_transposed=nullptr;
 
-    const NDRange<4> _window_range;
-
     Requantize32  _qp;
     int32_t *row_bias = nullptr;
     int32_t *col_bias = nullptr;
 
-    void *working_space = nullptr;
-
     unsigned int _nthreads;
 
     unsigned int get_col_sum_size() const {
@@ -143,12 +140,14 @@ public:
                 _nbatches(args._nbatches), _nmulti(args._nmulti),
                 _k_block(compute_k_block(args)), _n_block(compute_n_block(args)),
                 _Mround(roundup(args._Msize, strategy::out_height())),
-                _window_range(iceildiv(args._Msize, strategy::out_height()), _nbatches, iceildiv(_Nsize, _n_block), _nmulti),
                 _qp (qp), _nthreads(args._maxthreads) { }
 
     // Interface implementation - Compulsory functions
+
+    /* Two-dimensional window: row blocks (across batches and multis) against
+     * N blocks, so the scheduler can split both ways on many-core targets. */
     ndrange_t get_window_size() const override {
-        return { _window_range.total_size() };
+        return { iceildiv(_Msize, strategy::out_height()) * _nbatches * _nmulti, iceildiv(_Nsize, _n_block) };
     }
 
     // This kernel can always be dynamically scheduled.
@@ -157,20 +156,28 @@ public:
     }
 
     // Execute
-    void execute(const ndcoord_t &work_range, const ndcoord_t &, int threadid) override {
+    void execute(const ndcoord_t &work_range, const ndcoord_t &, int) override {
 #ifdef CYCLE_PROFILING
         profiler prof;
 #endif
         strategy strat(_ci);
 
-        uintptr_t working_int = reinterpret_cast<uintptr_t>(working_space);
-
-        Tri *result_buffer = reinterpret_cast<Tri *>(working_int + (threadid * strategy::out_height() * _Nsize * sizeof(Tri)));
+        /* The intermediate result buffer is private to this thread, so take
+         * it from the thread-local scratch arena. */
+        Tri *result_buffer = reinterpret_cast<Tri *>(get_thread_scratch(strategy::out_height() * _Nsize * sizeof(Tri)));
 
         /* Make sure we've been set up correctly. */
         assert(_B_transposed);
         static_assert(std::is_same<To, Toi>::value, "gemm_native: Operand types must be the same.");
 
+        const unsigned int window_per_batch = iceildiv(_Msize, strategy::out_height());
+        const unsigned int window_per_multi = window_per_batch * _nbatches;
+
+        const auto m_win_start = work_range.get_position(0);
+        const auto m_win_end   = m_win_start + work_range.get_size(0);
+        const auto n_win_start = work_range.get_position(1);
+        const auto n_win_end   = n_win_start + work_range.get_size(1);
+
         /* For now, each work item implies all the K for a given output
          * pixel (so we don't need to synchronize access to the output
          * array).  So separate the loop over K blocks here.  */
@@ -178,19 +185,16 @@ public:
             unsigned int kmax   = std::min(k0 + _k_block, _Ksize);
             unsigned int kern_k = roundup(kmax-k0, strategy::k_unroll());
 
-            auto p = _window_range.iterator(work_range.get_position(0), work_range.get_position_end(0));
+            for (auto mw = m_win_start; mw < m_win_end; mw++) {
+              const unsigned int multi   = mw / window_per_multi;
+              const unsigned int batch   = (mw % window_per_multi) / window_per_batch;
+              const unsigned int m_block = mw % window_per_batch;
+              const unsigned int m_start = m_block * strategy::out_height();
+              const unsigned int m_end   = std::min(m_start + strategy::out_height(), _Msize);
 
-            if (p.done()) {
-                return;
-            }
-
-            do {
-                const unsigned int m_start = p.dim(0) * strategy::out_height();
-                const unsigned int m_end   = std::min((p.dim(0) + 1) * strategy::out_height(), _Msize);
-                const unsigned int batch   = p.dim(1);
-                const unsigned int n0      = p.dim(2) * _n_block;
+              for (auto nw = n_win_start; nw < n_win_end; nw++) {
+                const unsigned int n0      = nw * _n_block;
                 const unsigned int nmax    = std::min(n0 + _n_block, _Nsize);
-                const unsigned int multi   = p.dim(3);
 
                 int32_t local_row_sums[strategy::out_height()];
 
@@ -228,19 +232,11 @@ public:
                                         this->_Cptr + (multi * this->_C_multi_stride) + (batch * this->_C_batch_stride) + (m_start * this->_ldc) + n0, this->_ldc,
                                         local_row_sums, col_bias + (multi * _Nsize) + n0, n0);
                 }
-            } while (p.next_dim0());
+              }
+            }
         }
     }
 
-    // Working space needed for intermediate result buffers.
-    size_t get_working_size() const override {
-        return (_nthreads * strategy::out_height() * _Nsize * sizeof(Tri));
-    }
-
-    void set_working_space(void *buffer) override {
-        working_space = buffer;
-    }
-
     // Interface implementation - pretransposed
     bool B_is_pretransposed() const override {
         return true;
@@ -24,8 +24,12 @@
 
 #include "arm_gemm.hpp"
 
+#include "decision_cache.hpp"
+
 #include <cstdint>
 #include <functional>
+#include <sstream>
+#include <string>
 
 namespace arm_gemm {
 
@@ -149,11 +153,43 @@ const GemmImplementation<Top, Tret, OutputStage> *gemm_implementation_list();
  * this function returns false and doesn't touch the provided pointer
  * reference.
  */
+/* Build the textual key identifying a selection decision: types, shape and CPU. */
+template<typename Top, typename Tret>
+std::string decision_key(const GemmArgs &args) {
+    std::ostringstream key;
+
+    key << decision_type_name<Top>() << " " << decision_type_name<Tret>() << " "
+        << args._Msize << " " << args._Nsize << " " << args._Ksize << " "
+        << args._nbatches << " " << args._nmulti << " " << args._maxthreads << " "
+        << args._fast_mode << " " << args._wide_accumulate << " "
+        << static_cast<int>(args._act.type) << " "
+        << static_cast<int>(args._ci->get_cpu_model());
+
+    return key.str();
+}
+
 template<typename Top, typename Tret, class OutputStage>
 bool find_implementation(const GemmArgs &args, const OutputStage &os, const GemmImplementation<Top, Tret, OutputStage> * &impl) {
     auto gemms = gemm_implementation_list<Top, Tret, OutputStage>();
     const GemmConfig *cfg = args._cfg;
 
+    /* Consult the process-wide decision cache first; a hit skips the heuristic
+     * evaluation below.  Selections constrained via GemmConfig bypass the cache. */
+    std::string key;
+    if (cfg == nullptr) {
+        key = decision_key<Top, Tret>(args);
+
+        std::string cached_name;
+        if (GemmDecisionCache::get().lookup(key, cached_name)) {
+            for (const GemmImplementation<Top, Tret, OutputStage> *i = gemms; i->method != GemmMethod::DEFAULT; i++) {
+                if (cached_name.compare(i->name) == 0 && i->do_is_supported(args, os)) {
+                    impl = i;
+                    return true;
+                }
+            }
+        }
+    }
+
     const GemmImplementation<Top, Tret, OutputStage> *saved_impl = nullptr;
     uint64_t best_estimate = 0;
 
@@ -179,6 +215,9 @@ bool find_implementation(const GemmArgs &args, const OutputStage &os, const Gemm
         /* Short circuit - if the estimate is zero, return this one immediately. */
         if (estimate==0) {
             impl=i;
+            if (cfg == nullptr) {
+                GemmDecisionCache::get().update(key, i->name);
+            }
             return true;
         }
 
@@ -193,6 +232,9 @@ bool find_implementation(const GemmArgs &args, const OutputStage &os, const Gemm
     /* Return whichever method gave the best estimate. */
     if (saved_impl != nullptr) {
         impl = saved_impl;
+        if (cfg == nullptr) {
+            GemmDecisionCache::get().update(key, saved_impl->name);
+        }
         return true;
     }
 
@@ -0,0 +1,345 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <vector>
+
+#include "arm_gemm.hpp"
+#include "bias_adder.hpp"
+#include "ndrange.hpp"
+#include "thread_arena.hpp"
+#include "transform.hpp"
+#include "utils.hpp"
+
+#ifdef CYCLE_PROFILING
+#include "profiler.hpp"
+#endif
+
+namespace arm_gemm {
+
+/* Indirect convolution-as-GEMM.
+ *
+ * Computes a convolution directly over the NHWC input tensor, with no
+ * materialized im2col matrix.  A is the input itself (one row per input
+ * pixel, lda = channel stride); an offset table built once at
+ * construction maps each (output pixel, kernel point) pair to the input
+ * row it reads, or to padding.  At execute time a strip of out_height()
+ * A rows is gathered into thread-local scratch and fed to the hybrid
+ * kernel, so the "im2col" working set never exceeds one cache-resident
+ * block.
+ *
+ * B handling (pretranspose, blocking) matches GemmHybrid: the weights
+ * are presented as a K x N matrix with the K dimension ordered kernel
+ * point major, channel minor, as produced by the standard weights
+ * reshape.
+ */
+template<typename strategy, typename To, typename Tr>
+class GemmIndirect : public GemmCommon<To, Tr> {
+    typedef typename strategy::operand_type Toi;
+    typedef typename strategy::result_type Tri;
+
+    /* const properties set by constructor */
+    const CPUInfo * const _ci;
+
+    const unsigned int _Msize;
+    const unsigned int _Nsize;
+    const unsigned int _Ksize;
+
+    const unsigned int _nbatches;
+    const unsigned int _nmulti;
+
+    const Activation _act;
+
+    const ConvolutionParameters _conv;
+
+    const unsigned int _kernel_points;
+
+    /* Blocking info */
+    const unsigned int _k_block;
+    const unsigned int _n_block;
+
+    /* Pretransposed buffer. */
+    const Toi *_B_transposed=nullptr;
+
+    /* Per (output pixel, kernel point): input row index, or -1 for padding. */
+    std::vector<int32_t> _row_table;
+
+    const NDRange<4> _window_range;
+
+    static unsigned int compute_k_block(const GemmArgs &args) {
+        // Some kernels don't support accumulate mode - these can't do K blocking at all.
+        if (!strategy::supports_accumulate()) {
+            return args._Ksize;
+        }
+
+        if (args._cfg && args._cfg->inner_block_size) {
+            return args._cfg->inner_block_size;
+        }
+
+        const unsigned int L1_size = args._ci->get_L1_cache_size();
+
+        unsigned int k_block = (L1_size / 2) / (sizeof(Toi) * (std::max(strategy::out_width(), strategy::out_height())));
+
+        // Needs to be (at least a single) multiple of the K unroll level.
+        k_block /= strategy::k_unroll();
+        k_block = std::max(k_block, 1U) * strategy::k_unroll();
+
+        // Now tune to presented problem size; this is how many blocks we need.
+        unsigned int numk_blocks = iceildiv(args._Ksize, k_block);
+
+        // So divide the space equally into that many blocks.
+        k_block = iceildiv(args._Ksize, numk_blocks);
+
+        // And round UP to the K unroll level required.
+        k_block = roundup(k_block, strategy::k_unroll());
+
+        return k_block;
+    }
+
+    static unsigned int compute_n_block(const GemmArgs &args) {
+        if (args._cfg && args._cfg->outer_block_size) {
+            return args._cfg->outer_block_size;
+        }
+
+        const unsigned int k_block = compute_k_block(args);
+        const unsigned int L2_size = args._ci->get_L2_cache_size();
+
+        unsigned int n_block = (((L2_size * 9) / 10) - (k_block * sizeof(Toi) * (strategy::out_width() + strategy::out_height()))) /
+                                 (sizeof(Toi) * k_block);
+
+        // Needs to be (at least a single) multiple of the kernel output width.
+        n_block /= strategy::out_width();
+        n_block = std::max(n_block, 1U) * strategy::out_width();
+
+        // And tune to the presented problem size.
+        unsigned int numblocks = iceildiv(args._Nsize, n_block);
+        n_block = iceildiv(args._Nsize, numblocks);
+        n_block = roundup(n_block, strategy::out_width());
+
+        return n_block;
+    }
+
+    /* Build the output pixel -> input row table from the convolution
+     * geometry.  Offsets are row indices (not pointers) so the table is
+     * independent of the A base address and batch. */
+    void fill_row_table() {
+        _row_table.resize(static_cast<size_t>(_Msize) * _kernel_points);
+
+        for (long oy = 0; oy < _conv.output_height; oy++) {
+            for (long ox = 0; ox < _conv.output_width; ox++) {
+                int32_t *entry = _row_table.data() + (((oy * _conv.output_width) + ox) * _kernel_points);
+
+                for (long ky = 0; ky < _conv.kernel_height; ky++) {
+                    const long iy = (oy * _conv.output_stride_h) + ky - _conv.padding_top;
+
+                    for (long kx = 0; kx < _conv.kernel_width; kx++) {
+                        const long ix = (ox * _conv.output_stride_w) + kx - _conv.padding_left;
+
+                        if (ix < 0 || ix >= _conv.input_width || iy < 0 || iy >= _conv.input_height) {
+                            *entry++ = -1;
+                        } else {
+                            *entry++ = (iy * _conv.input_width) + ix;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    /* Gather the [k0, kmax) slice of im2col rows [m_start, m_end) into
+     * 'staged' (row major, row stride kmax-k0). */
+    void gather_a_block(To *staged, const To *a_base, unsigned int m_start, unsigned int m_end,
+                        unsigned int k0, unsigned int kmax) const {
+        const unsigned int channels = _conv.input_channels;
+
+        for (unsigned int m = m_start; m < m_end; m++) {
+            const int32_t *row_entry = _row_table.data() + (static_cast<size_t>(m) * _kernel_points);
+
+            for (unsigned int k = k0; k < kmax; ) {
+                const unsigned int point = k / channels;
+                const unsigned int c0    = k % channels;
+                const unsigned int c_len = std::min(channels - c0, kmax - k);
+
+                const int32_t row = row_entry[point];
+
+                if (row < 0) {
+                    memset(staged, 0, c_len * sizeof(To));
+                } else {
+                    memcpy(staged, a_base + (static_cast<size_t>(row) * this->_lda) + c0, c_len * sizeof(To));
+                }
+
+                staged += c_len;
+                k += c_len;
+            }
+        }
+    }
+
+public:
+    GemmIndirect(GemmIndirect &) = delete;
+    GemmIndirect & operator= (GemmIndirect &) = delete;
+
+    /* Constructor */
+    GemmIndirect(const GemmArgs &args)
+              : _ci(args._ci), _Msize(args._Msize), _Nsize(args._Nsize), _Ksize(args._Ksize),
+                _nbatches(args._nbatches), _nmulti(args._nmulti),
+                _act(args._act), _conv(*args._conv),
+                _kernel_points(args._conv->kernel_width * args._conv->kernel_height),
+                _k_block(compute_k_block(args)), _n_block(compute_n_block(args)),
+                _window_range(iceildiv(args._Msize, strategy::out_height()), _nbatches, iceildiv(_Nsize, _n_block), _nmulti) {
+        assert(_Msize == (_conv.output_width * _conv.output_height));
+        assert(_Ksize == (_kernel_points * _conv.input_channels));
+
+        fill_row_table();
+    }
+
+    // Interface implementation - Compulsory functions
+    ndrange_t get_window_size() const override {
+        return { _window_range.total_size() };
+    }
+
+    // This kernel can always be dynamically scheduled.
+    bool supports_dynamic_scheduling() const override {
+        return true;
+    }
+
+    // Execute
+    void execute(const ndcoord_t &work_range, const ndcoord_t &, int) override {
+#ifdef CYCLE_PROFILING
+        profiler prof;
+#endif
+        strategy strat(_ci);
+
+        /* Make sure we've been set up correctly. */
+        assert(_B_transposed);
+        static_assert(std::is_same<To, Toi>::value, "gemm_indirect: Operand types must be the same.");
+        static_assert(std::is_same<Tr, Tri>::value, "gemm_indirect: Result types must be the same.");
+
+        /* Thread-local staging buffer for one strip of gathered A rows. */
+        To *staged = reinterpret_cast<To *>(get_thread_scratch(strategy::out_height() * _k_block * sizeof(To)));
+
+        for (unsigned int k0=0; k0<_Ksize; k0+=_k_block) {
+            unsigned int kmax   = std::min(k0 + _k_block, _Ksize);
+
+            const bool first_pass = (k0 == 0);
+            const bool last_pass = (kmax == _Ksize);
+
+            auto p = _window_range.iterator(work_range.get_position(0), work_range.get_position_end(0));
+
+            if (p.done()) {
+                return;
+            }
+
+            do {
+                const unsigned int m_start = p.dim(0) * strategy::out_height();
+                const unsigned int m_end   = std::min(p.dim0_max() * strategy::out_height(), _Msize);
+                const unsigned int batch   = p.dim(1);
+                const unsigned int n0      = p.dim(2) * _n_block;
+                const unsigned int nmax    = std::min(n0 + _n_block, _Nsize);
+                const unsigned int multi   = p.dim(3);
+
+                const unsigned int kern_k = roundup(kmax-k0, strategy::k_unroll());
+
+                const Toi *b_panel = _B_transposed +
+                                     (multi * roundup(_Nsize, strategy::out_width()) * roundup(_Ksize, strategy::k_unroll())) +
+                                     (k0 * roundup(_Nsize, strategy::out_width())) +
+                                     (n0 * kern_k);
+
+                const To *a_base = this->_Aptr + (multi * this->_A_multi_stride) + (batch * this->_A_batch_stride);
+
+                /* Gather and compute one out_height() strip at a time so
+                 * the staging buffer stays cache resident regardless of
+                 * how many strips this work item covers. */
+                for (unsigned int m0 = m_start; m0 < m_end; m0 += strategy::out_height()) {
+                    const unsigned int mmax = std::min(m0 + strategy::out_height(), m_end);
+
+                    gather_a_block(staged, a_base, m0, mmax, k0, kmax);
+
+#ifdef CYCLE_PROFILING
+                    auto p = prof.ScopedProfiler(PROFILE_KERNEL, (unsigned long)(mmax - m0) * kern_k * roundup(nmax-n0, strategy::out_width()));
+#endif
+
+                    strat.kernel(staged, (kmax - k0),
+                                 b_panel,
+                                 this->_Cptr + (multi * this->_C_multi_stride) + (batch * this->_C_batch_stride) + (m0 * this->_ldc) + n0, this->_ldc,
+                                 (mmax - m0), (nmax - n0), kmax-k0,
+                                 (strategy::supports_bias() && first_pass && this->_bias) ? this->_bias + (multi * this->_bias_multi_stride) + n0 : nullptr,
+                                 last_pass ? _act : Activation(), !first_pass);
+
+                    // Add bias externally if needed
+                    if (!strategy::supports_bias() && this->_bias && first_pass) {
+                        bias_adder(this->_Cptr + (multi * this->_C_multi_stride) + (batch * this->_C_batch_stride) + (m0 * this->_ldc) + n0, this->_ldc,
+                                   this->_bias + (multi * this->_bias_multi_stride) + n0,
+                                   (mmax - m0), (nmax - n0));
+                    }
+                }
+            } while (p.next_dim1());
+        }
+    }
+
+    // Interface implementation - pretransposed
+    bool B_is_pretransposed() const override {
+        return true;
+    }
+
+    bool B_pretranspose_required() const override {
+        return (_B_transposed==nullptr);
+    }
+
+    size_t get_B_pretransposed_array_size() const override {
+        return roundup(_Nsize, strategy::out_width()) * roundup(_Ksize, strategy::k_unroll()) * _nmulti * sizeof(Toi);
+    }
+
+    void pretranspose_B_array(void *in_buffer, const To *B, const int ldb, const int B_multi_stride) override {
+        Toi *buffer = reinterpret_cast<Toi *>(in_buffer);
+        _B_transposed = buffer;
+        strategy strat(_ci);
+
+        for (unsigned int multi=0; multi<_nmulti; multi++) {
+            for (unsigned int k0=0; k0<_Ksize; k0+=_k_block) {
+                const unsigned int kmax = std::min(k0 + _k_block, _Ksize);
+                const unsigned int k_size = roundup(kmax-k0, strategy::k_unroll());
+
+                for (unsigned int x0=0; x0<_Nsize; x0+=_n_block) {
+                    const unsigned int xmax = std::min(x0+_n_block, _Nsize);
+
+                    const unsigned int size = roundup(xmax-x0, strategy::out_width()) * k_size;
+
+                    strat.transforms.PrepareB( buffer, B + (multi * B_multi_stride), ldb,
+                                               x0, xmax, k0, kmax);
+
+                    buffer += size;
+                }
+            }
+        }
+    }
+
+    void set_pretransposed_B_data(void *in_buffer) override {
+        _B_transposed = reinterpret_cast<Toi *>(in_buffer);
+    }
+};
+
+} // namespace arm_gemm
@@ -25,12 +25,15 @@
 
 #include <algorithm>
 #include <cassert>
+#include <type_traits>
 
 #include "arm_gemm.hpp"
 #include "utils.hpp"
 
+#include "blocking_profile.hpp"
 #include "mergeresults.hpp"
 #include "performance_parameters.hpp"
+#include "thread_arena.hpp"
 #include "transform.hpp"
 
 #ifdef CYCLE_PROFILING
@@ -48,6 +51,32 @@
 // larger matrices.
 namespace arm_gemm {
 
+namespace detail {
+
+/* Detect whether a strategy publishes per-model performance parameters. */
+template<typename T>
+struct has_performance_parameters {
+    template<typename U>
+    static std::true_type test(decltype(U::get_performance_parameters(nullptr)) *);
+    template<typename U>
+    static std::false_type test(...);
+    static constexpr bool value = decltype(test<T>(nullptr))::value;
+};
+
+template<typename strategy>
+typename std::enable_if<has_performance_parameters<strategy>::value, int>::type
+get_b_stream_prefetch_lines(const CPUInfo *ci) {
+    return strategy::get_performance_parameters(ci).b_stream_prefetch_lines;
+}
+
+template<typename strategy>
+typename std::enable_if<!has_performance_parameters<strategy>::value, int>::type
+get_b_stream_prefetch_lines(const CPUInfo *) {
+    return 0;
+}
+
+} // namespace detail
+
 template<typename strategy, typename To, typename Tr>
 class GemmInterleaved : public GemmCommon<To, Tr> {
     typedef typename strategy::operand_type Toi;
@@ -73,6 +102,9 @@ class GemmInterleaved : public GemmCommon<To, Tr> {
     unsigned int _x_block=0;
     unsigned int _Mround=0;
 
+    /* Cache lines of the next B panel to prefetch per kernel call (0=off) */
+    int _b_prefetch_lines=0;
+
     /* Working space, pretransposed buffer, buffer manager */
     const Toi *_B_transposed=nullptr;
     void *_working_space=nullptr;
@@ -185,7 +217,8 @@ public:
                     : _ci(args._ci), _Msize(args._Msize), _Nsize(args._Nsize), _Ksize(args._Ksize),
                       _nbatches(args._nbatches), _nmulti(args._nmulti),
                       _act(args._act), _maxthreads(args._maxthreads), _nthreads(args._maxthreads),
-                      _k_block(get_k_block_size(args)) {
+                      _k_block(get_k_block_size(args)),
+                      _b_prefetch_lines(detail::get_b_stream_prefetch_lines<strategy>(args._ci)) {
         const unsigned int L2_size = _ci->get_L2_cache_size();
 
         assert(_maxthreads > 0);
@@ -212,6 +245,16 @@ public:
             _x_block *= strategy::out_width();
         }
 
+        // Allow a persisted per-shape tuning profile to override the cache heuristics.
+        if (!(args._cfg && (args._cfg->inner_block_size || args._cfg->outer_block_size))) {
+            unsigned int profile_k = 0, profile_x = 0;
+
+            if (BlockingProfileStore::get().lookup(_Msize, _Nsize, _Ksize, sizeof(Toi), profile_k, profile_x)) {
+                _k_block = roundup(std::max(profile_k, 1u), strategy::k_unroll());
+                _x_block = roundup(std::max(profile_x, 1u), strategy::out_width());
+            }
+        }
+
         // Work out the rounded size of M - needed for some buffers.
         _Mround = iceildiv(_Msize, strategy::out_height());
         _Mround *= strategy::out_height();
@@ -234,7 +277,7 @@ public:
     }
 
     // Execute
-    void execute(const ndcoord_t &work_range, const ndcoord_t &, int threadid) override {
+    void execute(const ndcoord_t &work_range, const ndcoord_t &, int) override {
         const auto start = work_range.get_position(0);
         const auto end   = work_range.get_position_end(0);
 #ifdef CYCLE_PROFILING
@@ -258,12 +301,12 @@ public:
         assert(_working_space);
         int8_t *working_space_bytes = reinterpret_cast<int8_t *>(_working_space);
 
-        // Private buffers.  Treat working_space as an array of C buffers
-        // (one per thread) first, followed by the (window-divided) A
-        // buffer.
+        // The shared working space holds only the (window-divided) A
+        // buffer; the private C buffer comes from the thread-local scratch
+        // arena so it isn't duplicated across GEMM instances.
         // Set a_panel to the base of the A buffers - compute offsets into it based on M/batches later.
-        Toi * const a_panel = reinterpret_cast<Toi *>(working_space_bytes + (_maxthreads * get_c_working_size()));
-        Tri * const c_panel = reinterpret_cast<Tri *>(working_space_bytes + (threadid * get_c_working_size()));
+        Toi * const a_panel = reinterpret_cast<Toi *>(working_space_bytes);
+        Tri * const c_panel = reinterpret_cast<Tri *>(get_thread_scratch(get_c_working_size()));
 
         const Toi *b_panel;
         b_panel = _B_transposed;
@@ -297,6 +340,13 @@ public:
 
             int bblocks = iceildiv(current.xmax() - current.x0(), strategy::out_width());
 
+            /* Software pipeline for B streaming: walk a prefetch cursor over
+             * the next pretransposed B panel while the kernel consumes the
+             * current one, so in-order cores don't stall on DDR when the
+             * panel changes.  Prefetches never fault, so running past the end
+             * of the pretransposed buffer on the final panel is harmless. */
+            const char *b_prefetch_ptr = reinterpret_cast<const char *>(b_panel + (bblocks * strat.out_width() * kern_k));
+
             /* Do the actual work. */
             for (unsigned int batch = batch_0; batch <= batch_end; batch++) {
                 unsigned int first_m = (batch == batch_0)   ? m_0   : 0;
@@ -314,6 +364,10 @@ public:
 #ifdef CYCLE_PROFILING
                         auto p=prof.ScopedProfiler(PROFILE_KERNEL, (strategy::out_height() * bblocks * strategy::out_width() * kern_k));
 #endif
+                        for (int i=0; i<_b_prefetch_lines; i++) {
+                            __builtin_prefetch(b_prefetch_ptr, 0, 2);
+                            b_prefetch_ptr += 64;
+                        }
 
                         strat.kernel(a_ptr, b_panel, c_panel, 1, bblocks, kern_k);
 
@@ -342,8 +396,9 @@ public:
 
     // Interface implementation - working space
     size_t get_working_size() const override {
-        // In all cases, we need one A buffer plus a C buffer per thread.
-        size_t size = get_a_working_size() + (get_c_working_size() * _maxthreads);
+        // Just the shared A buffer; per-thread C buffers are taken from the
+        // thread-local scratch arena at execute time.
+        size_t size = get_a_working_size();
 
         size += 64; // Add on a cache line extra for alignment.
 
@@ -27,6 +27,7 @@
 #include "utils.hpp"
 
 #include "mergeresults.hpp"
+#include "thread_arena.hpp"
 #include "transform.hpp"
 
 #ifdef CYCLE_PROFILING
@@ -77,9 +78,8 @@ class GemmInterleavedPretransposed2d : public GemmCommon<To, Tr> {
     unsigned int _Nround_div=0;
     unsigned int _Nround=0;
 
-    /* Working space, pretransposed buffer */
+    /* Pretransposed buffer */
     const Toi *_B_transposed=nullptr;
-    void *_working_space=nullptr;
 
     /* We will need to walk through the blocks of B in a few contexts, so
      * factor that out.  */
@@ -171,10 +171,9 @@ class GemmInterleavedPretransposed2d : public GemmCommon<To, Tr> {
 
     // Internal execute function.
     // This supports both the "pretransposed" and "standard" interfaces via the template parameter.
-    void execute_pretranspose(unsigned int m_start, unsigned int m_end, unsigned int n_start, unsigned int n_end, int threadid, int, int) {
+    void execute_pretranspose(unsigned int m_start, unsigned int m_end, unsigned int n_start, unsigned int n_end, int, int, int) {
         /* Make sure we've been set up correctly. */
         assert(_B_transposed);
-        assert(_working_space);
         assert(this->_Aptr);
         assert(this->_Cptr);
 
@@ -197,13 +196,12 @@ class GemmInterleavedPretransposed2d : public GemmCommon<To, Tr> {
 
         blockwalker current(*this, n_0, n_max);
 
-        int8_t *working_space_bytes = reinterpret_cast<int8_t *>(_working_space);
+        /* Both panels are private to this thread, so take them from the
+         * thread-local scratch arena rather than a pre-carved workspace. */
+        int8_t *scratch = reinterpret_cast<int8_t *>(get_thread_scratch(get_c_working_size() + get_a_working_size()));
 
-        auto c_panel_start = working_space_bytes;
-        auto a_panel_start = c_panel_start + get_c_working_size() * _maxthreads;
-
-        auto c_panel = reinterpret_cast<Tri *>(c_panel_start + get_c_working_size() * threadid);
-        auto a_panel = reinterpret_cast<Toi *>(a_panel_start + get_a_working_size() * threadid);
+        auto c_panel = reinterpret_cast<Tri *>(scratch);
+        auto a_panel = reinterpret_cast<Toi *>(scratch + get_c_working_size());
 
         /* B^t is stored in interleaved panels separated by their K-block component
          * we want to store a pointer to the start of the current k-page
@@ -414,37 +412,6 @@ public:
         execute_pretranspose(m_start, m_end, n_start, n_end, threadid, m_threadid, n_threadid);
     }
 
-    std::size_t get_working_size() const override {
-        /* Because we do not know how schedular will break up
-         * the task, we need to ensure that alloc enough
-         * space to be able to handle the case where every thread
-         * is parallelised across B AND also every thrread is parallelised across A
-         *
-         * If we parallelise across A, then we only need one buffer of A and 64 buffers of B
-         * If we parallelise across B, then we only need 64 buffer of B and
-         */
-        return get_c_working_size() * _maxthreads
-             + get_a_working_size() * _maxthreads
-             + 64; //to account for cacheline alignment
-    }
-
-
-    void set_working_space(void *working_space) override {
-        // Make sure everything ends up cache line aligned
-        int8_t *working_space_bytes = reinterpret_cast<int8_t *>(working_space);
-        intptr_t working_space_int  = reinterpret_cast<intptr_t>(working_space);
-
-        size_t diff=0;
-
-        if (working_space_int & 0x3F) {
-            diff = 0x40 - (working_space_int & 0x3F);
-        }
-
-        working_space_bytes += diff;
-
-        _working_space = reinterpret_cast<void *>(working_space_bytes);
-    }
-
     // Interface implementation - pretransposed
     bool B_is_pretransposed() const override {
         return true;
@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <limits>
+
+#include "arm_gemm.hpp"
+#include "utils.hpp"
+
+#ifdef CYCLE_PROFILING
+#include "profiler.hpp"
+#endif
+
+namespace arm_gemm {
+
+/* Block-sparse GEMM for heavily pruned weights.
+ *
+ * The pretranspose step converts B into a BSR-style format: for each strip
+ * of 'block_dim' output columns, the K dimension is scanned in blocks of
+ * 'block_dim' rows and only blocks containing at least one non-zero value
+ * are stored (together with their K-block index).  Execution then visits
+ * only the stored blocks, so MACs scale with the density of B rather than
+ * its dense size.
+ *
+ * Note that get_B_pretransposed_array_size() is called before the weight
+ * values are available, so the buffer is sized for the dense worst case;
+ * the win is in skipped arithmetic, not memory.
+ */
+template<typename To, typename Tr>
+class GemmSparse : public GemmCommon<To, Tr> {
+    static constexpr unsigned int block_dim = 4;
+
+    const unsigned int _Msize;
+    const unsigned int _Nsize;
+    const unsigned int _Ksize;
+
+    const unsigned int _nbatches;
+    const unsigned int _nmulti;
+
+    const Activation _act;
+
+    const unsigned int _kblocks;
+    const unsigned int _nstrips;
+
+    /* Base of the pretransposed buffer; the BSR arrays live at fixed
+     * (worst case) offsets inside it. */
+    void *_B_pretransposed = nullptr;
+
+    size_t get_offsets_size() const {
+        return roundup<size_t>((_nmulti * _nstrips + 1) * sizeof(uint32_t), 64);
+    }
+
+    size_t get_indices_size() const {
+        return roundup<size_t>(_nmulti * _nstrips * _kblocks * sizeof(uint32_t), 64);
+    }
+
+    size_t get_values_size() const {
+        return _nmulti * _nstrips * _kblocks * block_dim * block_dim * sizeof(To);
+    }
+
+    uint32_t *offsets_ptr() const {
+        return reinterpret_cast<uint32_t *>(_B_pretransposed);
+    }
+
+    uint32_t *indices_ptr() const {
+        return reinterpret_cast<uint32_t *>(reinterpret_cast<uintptr_t>(_B_pretransposed) + get_offsets_size());
+    }
+
+    To *values_ptr() const {
+        return reinterpret_cast<To *>(reinterpret_cast<uintptr_t>(_B_pretransposed) + get_offsets_size() + get_indices_size());
+    }
+
+public:
+    GemmSparse(GemmSparse &) = delete;
+    GemmSparse & operator= (GemmSparse &) = delete;
+
+    GemmSparse(const GemmArgs &args)
+              : _Msize(args._Msize), _Nsize(args._Nsize), _Ksize(args._Ksize),
+                _nbatches(args._nbatches), _nmulti(args._nmulti), _act(args._act),
+                _kblocks(iceildiv(args._Ksize, block_dim)),
+                _nstrips(iceildiv(args._Nsize, block_dim)) { }
+
+    // Interface implementation - Compulsory functions
+    ndrange_t get_window_size() const override {
+        return { _nstrips * _nbatches * _nmulti };
+    }
+
+    bool supports_dynamic_scheduling() const override {
+        return true;
+    }
+
+    void execute(const ndcoord_t &work_range, const ndcoord_t &, int) override {
+#ifdef CYCLE_PROFILING
+        profiler prof;
+#endif
+        assert(_B_pretransposed);
+
+        Tr minval = - std::numeric_limits<Tr>::infinity();
+        Tr maxval =   std::numeric_limits<Tr>::infinity();
+
+        switch(_act.type) {
+            default:
+            case Activation::Type::None:
+                break;
+            case Activation::Type::BoundedReLU:
+                maxval = static_cast<Tr>(_act.param1);
+                minval = static_cast<Tr>(_act.param2);
+                break;
+            case Activation::Type::ReLU:
+                minval = static_cast<Tr>(0);
+                break;
+        }
+
+        const uint32_t *offsets = offsets_ptr();
+        const uint32_t *indices = indices_ptr();
+        const To       *values  = values_ptr();
+
+        const auto start = work_range.get_position(0);
+        const auto end   = start + work_range.get_size(0);
+
+        for (auto w = start; w < end; w++) {
+            const unsigned int multi = w / (_nstrips * _nbatches);
+            const unsigned int batch = (w % (_nstrips * _nbatches)) / _nstrips;
+            const unsigned int strip = w % _nstrips;
+
+            const unsigned int n0    = strip * block_dim;
+            const unsigned int ncols = std::min(n0 + block_dim, _Nsize) - n0;
+
+            const uint32_t first_block = offsets[multi * _nstrips + strip];
+            const uint32_t last_block  = offsets[multi * _nstrips + strip + 1];
+
+            const To *a_base = this->_Aptr + (multi * this->_A_multi_stride) + (batch * this->_A_batch_stride);
+            Tr       *c_base = this->_Cptr + (multi * this->_C_multi_stride) + (batch * this->_C_batch_stride) + n0;
+
+            for (unsigned int m = 0; m < _Msize; m++) {
+                const To *a_row = a_base + (m * this->_lda);
+
+                Tr acc[block_dim] = { };
+
+                for (uint32_t b = first_block; b < last_block; b++) {
+                    const unsigned int k0   = indices[b] * block_dim;
+                    const unsigned int klen = std::min(k0 + block_dim, _Ksize) - k0;
+                    const To *v = values + (b * block_dim * block_dim);
+
+                    for (unsigned int k = 0; k < klen; k++) {
+                        const Tr a_val = static_cast<Tr>(a_row[k0 + k]);
+
+                        for (unsigned int j = 0; j < block_dim; j++) {
+                            acc[j] += a_val * static_cast<Tr>(v[(k * block_dim) + j]);
+                        }
+                    }
+                }
+
+                Tr *c_row = c_base + (m * this->_ldc);
+
+                for (unsigned int j = 0; j < ncols; j++) {
+                    Tr v = acc[j];
+
+                    if (this->_bias) {
+                        v += this->_bias[(multi * this->_bias_multi_stride) + n0 + j];
+                    }
+
+                    c_row[j] = std::min(std::max(v, minval), maxval);
+                }
+            }
+        }
+    }
+
+    // Interface implementation - pretransposed
+    bool B_is_pretransposed() const override {
+        return true;
+    }
+
+    bool B_pretranspose_required() const override {
+        return (_B_pretransposed == nullptr);
+    }
+
+    size_t get_B_pretransposed_array_size() const override {
+        return get_offsets_size() + get_indices_size() + get_values_size();
+    }
+
+    void pretranspose_B_array(void *in_buffer, const To *B, const int ldb, const int B_multi_stride) override {
+        _B_pretransposed = in_buffer;
+
+        uint32_t *offsets = offsets_ptr();
+        uint32_t *indices = indices_ptr();
+        To       *values  = values_ptr();
+
+        uint32_t nblocks = 0;
+        offsets[0] = 0;
+
+        for (unsigned int multi = 0; multi < _nmulti; multi++) {
+            const To *b_multi = B + (multi * B_multi_stride);
+
+            for (unsigned int strip = 0; strip < _nstrips; strip++) {
+                const unsigned int n0    = strip * block_dim;
+                const unsigned int ncols = std::min(n0 + block_dim, _Nsize) - n0;
+
+                for (unsigned int kb = 0; kb < _kblocks; kb++) {
+                    const unsigned int k0   = kb * block_dim;
+                    const unsigned int klen = std::min(k0 + block_dim, _Ksize) - k0;
+
+                    To block[block_dim * block_dim] = { };
+                    bool nonzero = false;
+
+                    for (unsigned int k = 0; k < klen; k++) {
+                        for (unsigned int j = 0; j < ncols; j++) {
+                            const To v = b_multi[((k0 + k) * ldb) + n0 + j];
+
+                            block[(k * block_dim) + j] = v;
+                            nonzero |= (v != static_cast<To>(0));
+                        }
+                    }
+
+                    if (nonzero) {
+                        indices[nblocks] = kb;
+                        memcpy(values + (nblocks * block_dim * block_dim), block, sizeof(block));
+                        nblocks++;
+                    }
+                }
+
+                offsets[(multi * _nstrips) + strip + 1] = nblocks;
+            }
+        }
+    }
+
+    void set_pretransposed_B_data(void *in_buffer) override {
+        _B_pretransposed = in_buffer;
+    }
+};
+
+} // namespace arm_gemm
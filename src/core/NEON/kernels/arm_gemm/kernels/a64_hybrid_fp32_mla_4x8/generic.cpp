@@ -55,7 +55,8 @@ void a64_hybrid_fp32_mla_4x8(const float *A, int lda, const float *B, float *C,
             break;
         case Activation::Type::BoundedReLU:
             maxval = static_cast<float>(act.param1);
-            /* fall through */
+            minval = static_cast<float>(act.param2);
+            break;
         case Activation::Type::ReLU:
             minval = 0.0f;
             break;
@@ -68,12 +68,15 @@ public:
     StdTransformsFixed<operand_type, result_type, 8, 12> transforms = {};
 
     static PerformanceParameters get_performance_parameters(const CPUInfo *ci) {
+        // The in-order cores also get a B-panel streaming prefetch schedule:
+        // their hardware prefetchers don't hide the DDR latency of the next
+        // panel, so a few explicit lines per kernel call are a clear win.
         switch (ci->get_cpu_model()) {
             case CPUModel::A55r1:
-                return { 3.724, 1.416, 1.113 };
+                return { 3.724, 1.416, 1.113, 8 };
 
             case CPUModel::A53:
-                return { 2.777, 0.987, 0.898 };
+                return { 2.777, 0.987, 0.898, 8 };
 
             case CPUModel::A73:
                 return { 2.885, 1.429, 1.163 };
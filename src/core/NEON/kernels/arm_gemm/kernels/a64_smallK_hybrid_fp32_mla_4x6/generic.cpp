@@ -53,7 +53,8 @@ void a64_smallK_hybrid_fp32_mla_4x6(const float *A, int lda, const float *B, flo
             break;
         case Activation::Type::BoundedReLU:
             maxval = static_cast<float>(act.param1);
-            /* fall through */
+            minval = static_cast<float>(act.param2);
+            break;
         case Activation::Type::ReLU:
             minval = 0.0f;
             break;
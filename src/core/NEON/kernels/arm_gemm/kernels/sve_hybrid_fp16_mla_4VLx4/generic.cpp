@@ -55,7 +55,8 @@ void sve_hybrid_fp16_mla_4VLx4(const __fp16 *A, int lda, const __fp16 *B, __fp16
             break;
         case Activation::Type::BoundedReLU:
             maxval = static_cast<__fp16>(act.param1);
-            /* fall through */
+            minval = static_cast<__fp16>(act.param2);
+            break;
         case Activation::Type::ReLU:
             minval = 0.0f;
             break;
@@ -56,7 +56,8 @@ void sve_hybrid_fp32_mmla_4VLx4(const float *A, int lda, const float *B, float *
             break;
         case Activation::Type::BoundedReLU:
             maxval = static_cast<float>(act.param1);
-            /* fall through */
+            minval = static_cast<float>(act.param2);
+            break;
         case Activation::Type::ReLU:
             minval = 0.0f;
             break;
@@ -55,7 +55,8 @@ void sve_smallK_hybrid_fp32_mla_1VLx8(const float *A, int lda, const float *B, f
             break;
         case Activation::Type::BoundedReLU:
             maxval = static_cast<float>(act.param1);
-            /* fall through */
+            minval = static_cast<float>(act.param2);
+            break;
         case Activation::Type::ReLU:
             minval = 0.0f;
             break;
@@ -81,7 +81,7 @@ void MergeResults(Tout * out, const Tin * in, int ldc, int y0, int ymax, int x0,
                             break;
 
                         case Activation::Type::BoundedReLU:
-                            v = std::max(std::min(v, static_cast<Tout>(act.param1)), static_cast<Tout>(0));
+                            v = std::max(std::min(v, static_cast<Tout>(act.param1)), static_cast<Tout>(act.param2));
                             break;
                     }
 
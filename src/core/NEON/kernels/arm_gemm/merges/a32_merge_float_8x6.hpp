@@ -44,7 +44,8 @@ void MergeResults<8, 6, false>(float *out, const float *in, const int ldout, con
             break;
         case Activation::Type::BoundedReLU:
             maxval = static_cast<float>(act.param1);
-            /* fall through */
+            minval = static_cast<float>(act.param2);
+            break;
         case Activation::Type::ReLU:
             minval = 0.0f;
             break;
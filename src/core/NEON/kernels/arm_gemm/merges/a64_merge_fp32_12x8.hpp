@@ -40,7 +40,8 @@ void MergeResults<12, 8, false>(float *out, const float *in, const int ldout, co
             break;
         case Activation::Type::BoundedReLU:
             maxval = static_cast<float>(act.param1);
-            /* fall through */
+            minval = static_cast<float>(act.param2);
+            break;
         case Activation::Type::ReLU:
             minval = 0.0f;
             break;
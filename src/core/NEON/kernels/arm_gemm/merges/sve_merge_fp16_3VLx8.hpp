@@ -40,7 +40,8 @@ void MergeResults<3, 8, true>(__fp16 *out, const __fp16 *in, const int ldout, co
             break;
         case Activation::Type::BoundedReLU:
             maxval = static_cast<__fp16>(act.param1);
-            /* fall through */
+            minval = static_cast<__fp16>(act.param2);
+            break;
         case Activation::Type::ReLU:
             minval = 0.0f;
             break;
@@ -40,7 +40,8 @@ void MergeResults<3, 8, true>(float *out, const float *in, const int ldout, cons
             break;
         case Activation::Type::BoundedReLU:
             maxval = static_cast<float>(act.param1);
-            /* fall through */
+            minval = static_cast<float>(act.param2);
+            break;
         case Activation::Type::ReLU:
             minval = 0.0f;
             break;
@@ -30,8 +30,16 @@ struct PerformanceParameters {
     float	prepare_bytes_cycle = 0.0f;
     float	merge_bytes_cycle   = 0.0f;
 
+    /* Number of cache lines of the next pretransposed B panel to software
+     * prefetch per micro-kernel call while the current panel is being
+     * consumed.  Non-zero values enable B-panel streaming on in-order,
+     * bandwidth-limited cores; 0 (the default) leaves prefetching entirely
+     * to the schedules baked into the assembly kernels. */
+    int		b_stream_prefetch_lines = 0;
+
     PerformanceParameters(float k) : kernel_macs_cycle(k) { }
     PerformanceParameters(float k, float p, float m) : kernel_macs_cycle(k), prepare_bytes_cycle(p), merge_bytes_cycle(m) { }
+    PerformanceParameters(float k, float p, float m, int b) : kernel_macs_cycle(k), prepare_bytes_cycle(p), merge_bytes_cycle(m), b_stream_prefetch_lines(b) { }
 };
 
 } // namespace arm_gemm
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "thread_arena.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace arm_gemm {
+
+namespace {
+
+/* Keep scratch cache line aligned, as the pre-carved working space was. */
+constexpr size_t arena_alignment = 64;
+
+} // anonymous namespace
+
+void *get_thread_scratch(size_t size) {
+    static thread_local std::vector<uint8_t> arena;
+
+    const size_t needed = size + arena_alignment - 1;
+
+    /* Grow only - the arena is reused by every GEMM run on this thread. */
+    if (arena.size() < needed) {
+        arena.resize(needed);
+    }
+
+    uintptr_t ptr = reinterpret_cast<uintptr_t>(arena.data());
+    ptr = (ptr + arena_alignment - 1) & ~static_cast<uintptr_t>(arena_alignment - 1);
+
+    return reinterpret_cast<void *>(ptr);
+}
+
+} // namespace arm_gemm
@@ -25,6 +25,12 @@
 
 #include "utils.hpp"
 
+#include <type_traits>
+
+#ifdef __ARM_FEATURE_SVE
+#include <arm_sve.h>
+#endif
+
 namespace arm_gemm {
 
 /*
@@ -40,3 +40,4 @@
 #include "sve_interleave_8way_block4_16bit.hpp"
 #include "sve_interleave_8way_block4_8bit.hpp"
 #include "sve_interleave_8way_block8_8bit.hpp"
+#include "sve_transpose_interleave_vla.hpp"
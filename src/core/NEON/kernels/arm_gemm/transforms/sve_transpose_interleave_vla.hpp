@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#ifdef __ARM_FEATURE_SVE
+
+#include "utils.hpp"
+
+/*
+ * Vector-length-agnostic implementation of the transposed ("PrepareB")
+ * transforms used by the SVE kernels via StdTransformsSVE.
+ *
+ * The transposed transform with interleave <IntBy>xVL and block <BlockBy>
+ * reads, for each strip of output columns, <BlockBy> consecutive rows of B
+ * (which are contiguous along the column dimension) and emits them
+ * column-major in groups of <BlockBy>.  That is a predicated contiguous
+ * load of each row followed by a log2(BlockBy)-deep ZIP cascade, so one
+ * generic implementation covers every (IntBy, BlockBy) pair the kernels
+ * use at whatever vector length the hardware provides.  Tails in either
+ * dimension are handled by the governing predicate (zeroing loads), which
+ * also provides the zero padding the dense blocked format requires.
+ */
+namespace sve_vla {
+
+template<size_t Size> struct sized_element;
+template<> struct sized_element<1> { typedef uint8_t  type; };
+template<> struct sized_element<2> { typedef uint16_t type; };
+template<> struct sized_element<4> { typedef uint32_t type; };
+
+inline svbool_t whilelt_count(uint64_t count, const uint8_t *)  { return svwhilelt_b8_u64(0, count);  }
+inline svbool_t whilelt_count(uint64_t count, const uint16_t *) { return svwhilelt_b16_u64(0, count); }
+inline svbool_t whilelt_count(uint64_t count, const uint32_t *) { return svwhilelt_b32_u64(0, count); }
+
+inline svuint8_t  load(svbool_t pg, const uint8_t *ptr)  { return svld1_u8(pg, ptr);  }
+inline svuint16_t load(svbool_t pg, const uint16_t *ptr) { return svld1_u16(pg, ptr); }
+inline svuint32_t load(svbool_t pg, const uint32_t *ptr) { return svld1_u32(pg, ptr); }
+
+inline svuint8_t  zero(const uint8_t *)  { return svdup_n_u8(0);  }
+inline svuint16_t zero(const uint16_t *) { return svdup_n_u16(0); }
+inline svuint32_t zero(const uint32_t *) { return svdup_n_u32(0); }
+
+inline svuint8_t  zip1(svuint8_t a,  svuint8_t b)  { return svzip1_u8(a, b);  }
+inline svuint16_t zip1(svuint16_t a, svuint16_t b) { return svzip1_u16(a, b); }
+inline svuint32_t zip1(svuint32_t a, svuint32_t b) { return svzip1_u32(a, b); }
+
+inline void store(uint8_t *ptr, svuint8_t v)   { svst1_u8(svptrue_b8(), ptr, v);   }
+inline void store(uint16_t *ptr, svuint16_t v) { svst1_u16(svptrue_b16(), ptr, v); }
+inline void store(uint32_t *ptr, svuint32_t v) { svst1_u32(svptrue_b32(), ptr, v); }
+
+/* Load one block row, or zero if it is beyond the K tail. */
+template<typename E>
+inline auto load_row(svbool_t pg, const E *ptr, bool valid) -> decltype(load(pg, ptr)) {
+    if (valid) {
+        return load(pg, ptr);
+    } else {
+        return zero(ptr);
+    }
+}
+
+/* Emit one output vector: 'BlockBy' rows interleaved element-wise.  The
+ * governing predicate must cover at most VL/BlockBy lanes so the ZIP
+ * cascade fills exactly one vector. */
+template<typename E>
+inline void transpose_block(E *out, const E *in, long row_stride, unsigned int fill_rows, svbool_t pg,
+                            std::integral_constant<unsigned int, 1>) {
+    store(out, load_row(pg, in, fill_rows >= 1));
+}
+
+template<typename E>
+inline void transpose_block(E *out, const E *in, long row_stride, unsigned int fill_rows, svbool_t pg,
+                            std::integral_constant<unsigned int, 2>) {
+    auto v0 = load_row(pg, in, true);
+    auto v1 = load_row(pg, in + row_stride, fill_rows >= 2);
+
+    store(out, zip1(v0, v1));
+}
+
+template<typename E>
+inline void transpose_block(E *out, const E *in, long row_stride, unsigned int fill_rows, svbool_t pg,
+                            std::integral_constant<unsigned int, 4>) {
+    auto v0 = load_row(pg, in,                   true);
+    auto v1 = load_row(pg, in + row_stride,      fill_rows >= 2);
+    auto v2 = load_row(pg, in + (row_stride * 2), fill_rows >= 3);
+    auto v3 = load_row(pg, in + (row_stride * 3), fill_rows >= 4);
+
+    auto a0 = zip1(v0, v2);
+    auto a1 = zip1(v1, v3);
+
+    store(out, zip1(a0, a1));
+}
+
+template<typename E>
+inline void transpose_block(E *out, const E *in, long row_stride, unsigned int fill_rows, svbool_t pg,
+                            std::integral_constant<unsigned int, 8>) {
+    auto v0 = load_row(pg, in,                   true);
+    auto v1 = load_row(pg, in + row_stride,      fill_rows >= 2);
+    auto v2 = load_row(pg, in + (row_stride * 2), fill_rows >= 3);
+    auto v3 = load_row(pg, in + (row_stride * 3), fill_rows >= 4);
+    auto v4 = load_row(pg, in + (row_stride * 4), fill_rows >= 5);
+    auto v5 = load_row(pg, in + (row_stride * 5), fill_rows >= 6);
+    auto v6 = load_row(pg, in + (row_stride * 6), fill_rows >= 7);
+    auto v7 = load_row(pg, in + (row_stride * 7), fill_rows >= 8);
+
+    auto a0 = zip1(v0, v4);
+    auto a1 = zip1(v1, v5);
+    auto a2 = zip1(v2, v6);
+    auto a3 = zip1(v3, v7);
+
+    auto b0 = zip1(a0, a2);
+    auto b1 = zip1(a1, a3);
+
+    store(out, zip1(b0, b1));
+}
+
+} // namespace sve_vla
+
+template<unsigned int tIntBy, unsigned int BlockBy, size_t Size>
+struct TransformImpl<tIntBy, BlockBy, true, Size, Size, true> {
+    template <typename TOut, typename TIn>
+    static void Transform(TOut* out, const TIn* const in, const int stride,
+                          const int y0, const int ymax, const int x0, const int xmax) {
+        static_assert(BlockBy == 1 || BlockBy == 2 || BlockBy == 4 || BlockBy == 8,
+                      "Block size must be a power of two no greater than 8");
+
+        typedef typename sve_vla::sized_element<Size>::type E;
+
+        const E *inptr  = reinterpret_cast<const E *>(in);
+        E       *outptr = reinterpret_cast<E *>(out);
+
+        /* Each output vector covers VL/BlockBy 'y' values; a strip is tIntBy
+         * such vectors per block of BlockBy 'x' values. */
+        const long vl    = get_vector_length<E>();
+        const long chunk = vl / BlockBy;
+
+        for (long y_base = y0; y_base < ymax; y_base += (tIntBy * chunk)) {
+            for (long x_base = x0; x_base < xmax; x_base += BlockBy) {
+                const long x_left    = xmax - x_base;
+                const unsigned int fill_rows = (x_left < BlockBy) ? x_left : BlockBy;
+
+                for (unsigned int c = 0; c < tIntBy; c++) {
+                    const long y      = y_base + (c * chunk);
+                    const long y_left = ymax - y;
+                    const long active = (y_left < 0) ? 0 : ((y_left < chunk) ? y_left : chunk);
+
+                    const svbool_t pg = sve_vla::whilelt_count(static_cast<uint64_t>(active), inptr);
+
+                    sve_vla::transpose_block(outptr, inptr + (x_base * stride) + y, stride, fill_rows, pg,
+                                             std::integral_constant<unsigned int, BlockBy>());
+
+                    outptr += vl;
+                }
+            }
+        }
+    }
+};
+
+#endif // __ARM_FEATURE_SVE
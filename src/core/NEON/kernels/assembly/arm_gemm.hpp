@@ -43,7 +43,9 @@ enum class GemmMethod
     GEMM_INTERLEAVED_2D,
     QUANTIZE_WRAPPER,
     QUANTIZE_WRAPPER_2D,
-    GEMM_HYBRID_QUANTIZED
+    GEMM_HYBRID_QUANTIZED,
+    GEMM_SPARSE,
+    GEMM_INDIRECT
 };
 
 struct KernelDescription
@@ -97,24 +99,50 @@ struct Activation
     }
 };
 
+/* Describes a convolution to be computed directly over an NHWC input
+ * tensor, without a materialized im2col matrix.  The GEMM's A matrix is
+ * then the input tensor itself, with one "row" per input pixel, and the
+ * implementation gathers the rows each output pixel needs through a
+ * precomputed offset table. */
+struct ConvolutionParameters
+{
+    long input_width     = 0;
+    long input_height    = 0;
+    long input_channels  = 0;
+    long kernel_width    = 0;
+    long kernel_height   = 0;
+    long output_width    = 0;
+    long output_height   = 0;
+    long output_stride_w = 0;
+    long output_stride_h = 0;
+    long padding_top     = 0;
+    long padding_left    = 0;
+};
+
 struct GemmArgs
 {
 public:
-    const CPUInfo    *_ci;
-    unsigned int      _Msize;
-    unsigned int      _Nsize;
-    unsigned int      _Ksize;
-    unsigned int      _nbatches;
-    unsigned int      _nmulti;
-    Activation        _act;
-    int               _maxthreads;
-    const GemmConfig *_cfg;
+    const CPUInfo               *_ci;
+    unsigned int                 _Msize;
+    unsigned int                 _Nsize;
+    unsigned int                 _Ksize;
+    unsigned int                 _nbatches;
+    unsigned int                 _nmulti;
+    Activation                   _act;
+    int                          _maxthreads;
+    bool                         _fast_mode;
+    bool                         _wide_accumulate;
+    const GemmConfig            *_cfg;
+    const ConvolutionParameters *_conv;
 
     GemmArgs(const CPUInfo *ci, const unsigned int M, const unsigned int N,
              const unsigned int K, const unsigned int nbatches,
              const unsigned int nmulti, Activation act, const int maxthreads,
-             const GemmConfig *cfg = nullptr)
-        : _ci(ci), _Msize(M), _Nsize(N), _Ksize(K), _nbatches(nbatches), _nmulti(nmulti), _act(act), _maxthreads(maxthreads), _cfg(cfg)
+             const bool fast_mode = false, const bool wide_accumulate = false,
+             const GemmConfig *cfg = nullptr,
+             const ConvolutionParameters *conv = nullptr)
+        : _ci(ci), _Msize(M), _Nsize(N), _Ksize(K), _nbatches(nbatches), _nmulti(nmulti), _act(act), _maxthreads(maxthreads), _fast_mode(fast_mode), _wide_accumulate(wide_accumulate), _cfg(cfg),
+          _conv(conv)
     {
     }
 };
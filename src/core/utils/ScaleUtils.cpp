@@ -34,4 +34,19 @@ float arm_compute::scale_utils::calculate_resize_ratio(size_t input_size, size_t
     ARM_COMPUTE_ERROR_ON(out == 0);
 
     return static_cast<float>(in) / static_cast<float>(out);
+}
+
+bool arm_compute::scale_utils::is_integer_upscale(size_t input_width, size_t input_height, size_t output_width, size_t output_height, bool align_corners)
+{
+    // With aligned corners the sampling points do not follow a plain replication pattern
+    if(align_corners || input_width == 0 || input_height == 0)
+    {
+        return false;
+    }
+    if((output_width % input_width) != 0 || (output_height % input_height) != 0)
+    {
+        return false;
+    }
+    const size_t factor = output_width / input_width;
+    return (output_height / input_height) == factor && (factor == 2 || factor == 4);
 }
\ No newline at end of file
@@ -43,6 +43,21 @@ namespace scale_utils
  */
 float calculate_resize_ratio(size_t input_size, size_t output_size, bool align_corners = false);
 
+/** Returns if the scaling is a pure upscale by the same vector-friendly integer factor (2 or 4) on both axes
+ *
+ * In that case every input pixel maps to a whole block of output pixels, so nearest interpolation
+ * reduces to pixel replication and the precomputed offsets table is not needed.
+ *
+ * @param[in] input_width   The input width
+ * @param[in] input_height  The input height
+ * @param[in] output_width  The output width
+ * @param[in] output_height The output height
+ * @param[in] align_corners True if corners of input and output are aligned
+ *
+ * @return True if the scaling is an integer-factor upscale
+ */
+bool is_integer_upscale(size_t input_width, size_t input_height, size_t output_width, size_t output_height, bool align_corners);
+
 /** Returns if aligned corners are allowed for the given sampling policy
  *
  * @param[in] sampling_policy The sampling policy to consider
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/utils/helpers/pad_fold.h"
+
+#include "arm_compute/core/Helpers.h"
+
+#include <cstring>
+
+namespace arm_compute
+{
+namespace helpers
+{
+namespace pad_fold
+{
+bool is_foldable_conv_padding(const PaddingList &padding, PixelValue pad_value, DataType data_type, DataLayout data_layout)
+{
+    // The padding value must match the implicit zero of the convolution borders. Quantized
+    // types are excluded as their implicit zero is represented through the offset, while
+    // the pad inserts the raw value it is given.
+    const PixelValue zero_value = PixelValue();
+    if(std::memcmp(&pad_value.value, &zero_value.value, sizeof(pad_value.value)) != 0 || !is_data_type_float(data_type))
+    {
+        return false;
+    }
+
+    // Only padding on the spatial dimensions can be expressed as convolution padding
+    const size_t width_index  = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
+    const size_t height_index = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
+
+    for(size_t i = 0; i < padding.size(); ++i)
+    {
+        if(i != width_index && i != height_index && padding[i] != PaddingInfo(0, 0))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+PadStrideInfo fold_conv_padding(const PadStrideInfo &conv_info, const PaddingList &padding, DataLayout data_layout)
+{
+    const size_t width_index  = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
+    const size_t height_index = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
+
+    const PaddingInfo pad_w = width_index < padding.size() ? padding[width_index] : PaddingInfo(0, 0);
+    const PaddingInfo pad_h = height_index < padding.size() ? padding[height_index] : PaddingInfo(0, 0);
+
+    return PadStrideInfo(conv_info.stride().first,
+                         conv_info.stride().second,
+                         conv_info.pad_left() + pad_w.first,
+                         conv_info.pad_right() + pad_w.second,
+                         conv_info.pad_top() + pad_h.first,
+                         conv_info.pad_bottom() + pad_h.second,
+                         conv_info.round());
+}
+} // namespace pad_fold
+} // namespace helpers
+} // namespace arm_compute
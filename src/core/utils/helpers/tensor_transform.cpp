@@ -169,6 +169,56 @@ TensorShape compute_strided_slice_output_shape(TensorShape input_shape, Coordina
     return output_shape;
 }
 
+bool slice_is_contiguous_view(TensorShape input_shape, Coordinates starts, Coordinates ends, Coordinates strides,
+                              int32_t begin_mask, int32_t end_mask, int32_t shrink_axis_mask, Coordinates &view_start)
+{
+    // Shrinking an axis changes the output rank, which a view cannot express
+    if(shrink_axis_mask != 0)
+    {
+        return false;
+    }
+
+    Coordinates starts_abs{};
+    Coordinates ends_abs{};
+    Coordinates final_strides{};
+    std::tie(starts_abs, ends_abs, final_strides) = calculate_strided_slice_coords(input_shape, starts, ends, strides, begin_mask, end_mask, shrink_axis_mask);
+
+    const int num_dims = static_cast<int>(input_shape.num_dimensions());
+
+    // All strides must be unit for the selected elements to be adjacent
+    for(int i = 0; i < num_dims; ++i)
+    {
+        if(final_strides[i] != 1 || ends_abs[i] <= starts_abs[i])
+        {
+            return false;
+        }
+    }
+
+    // Find the outermost dimension that keeps more than one element
+    int outer_dim = -1;
+    for(int i = num_dims - 1; i >= 0; --i)
+    {
+        if(ends_abs[i] - starts_abs[i] > 1)
+        {
+            outer_dim = i;
+            break;
+        }
+    }
+
+    // Every dimension below it must cover the full input extent, otherwise the selected
+    // elements are interleaved with discarded ones
+    for(int i = 0; i < outer_dim; ++i)
+    {
+        if(starts_abs[i] != 0 || ends_abs[i] != static_cast<int>(input_shape[i]))
+        {
+            return false;
+        }
+    }
+
+    view_start = starts_abs;
+    return true;
+}
+
 int32_t construct_slice_end_mask(Coordinates ends)
 {
     // Create end mask
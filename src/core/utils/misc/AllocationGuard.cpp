@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/utils/misc/AllocationGuard.h"
+
+#if defined(ARM_COMPUTE_ALLOC_GUARD)
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+/** Innermost armed guard's scope of this thread, nullptr when none */
+thread_local const char *g_active_scope = nullptr;
+/** Process-wide count of allocations detected while a guard was armed */
+std::atomic<size_t> g_guarded_allocations{ 0 };
+
+/** Reports the allocation when a guard is armed on this thread */
+void report_if_guarded(size_t size)
+{
+    if(g_active_scope != nullptr)
+    {
+        // fprintf rather than iostreams: the stream operators can themselves
+        // allocate and recurse into this interception
+        std::fprintf(stderr, "arm_compute: %zu byte heap allocation during '%s'\n", size, g_active_scope);
+        ++g_guarded_allocations;
+    }
+}
+
+void *checked_allocate(size_t size)
+{
+    report_if_guarded(size);
+    void *ptr = std::malloc(size == 0 ? 1 : size);
+    if(ptr == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void *checked_allocate_nothrow(size_t size) noexcept
+{
+    report_if_guarded(size);
+    return std::malloc(size == 0 ? 1 : size);
+}
+} // namespace
+
+namespace arm_compute
+{
+namespace utils
+{
+ScopedAllocationGuard::ScopedAllocationGuard(const char *scope)
+    : _previous(g_active_scope)
+{
+    g_active_scope = scope;
+}
+
+ScopedAllocationGuard::~ScopedAllocationGuard()
+{
+    g_active_scope = _previous;
+}
+
+size_t guarded_allocation_count()
+{
+    return g_guarded_allocations.load();
+}
+} // namespace utils
+} // namespace arm_compute
+
+// Replace the global allocation functions of the process the library is linked
+// into, so every heap allocation flows through the interception. All forms are
+// replaced together so new and delete keep operating on the same heap.
+void *operator new(std::size_t size)
+{
+    return checked_allocate(size);
+}
+
+void *operator new[](std::size_t size)
+{
+    return checked_allocate(size);
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept
+{
+    return checked_allocate_nothrow(size);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept
+{
+    return checked_allocate_nothrow(size);
+}
+
+void operator delete(void *ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void *ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, const std::nothrow_t &) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void *ptr, const std::nothrow_t &) noexcept
+{
+    std::free(ptr);
+}
+
+#else /* defined(ARM_COMPUTE_ALLOC_GUARD) */
+
+namespace arm_compute
+{
+namespace utils
+{
+size_t guarded_allocation_count()
+{
+    return 0;
+}
+} // namespace utils
+} // namespace arm_compute
+
+#endif /* defined(ARM_COMPUTE_ALLOC_GUARD) */
@@ -23,6 +23,7 @@
  */
 #include "arm_compute/core/utils/quantization/AsymmHelpers.h"
 #include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/utils/quantization/QuantizationParamsCache.h"
 #include "support/ToolchainSupport.h"
 
 #include <cmath>
@@ -142,7 +143,7 @@ arm_compute::Status calculate_quantized_multipliers(const QuantizationInfo &iq_i
         const float multiplier       = i_scale * w_scales[i] / o_scale;
         int32_t     quant_multiplier = 0;
         int32_t     quant_shift      = 0;
-        ARM_COMPUTE_RETURN_ON_ERROR(calculate_quantized_multiplier(multiplier, &quant_multiplier, &quant_shift));
+        ARM_COMPUTE_RETURN_ON_ERROR(QuantizationParamsCache::get().quantized_multiplier(multiplier, &quant_multiplier, &quant_shift));
         quant_multipliers[i] = quant_multiplier;
         quant_shifts[i]      = quant_shift;
     }
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/utils/quantization/QuantizationParamsCache.h"
+
+#include "arm_compute/core/utils/quantization/AsymmHelpers.h"
+#include "support/MemorySupport.h"
+
+namespace arm_compute
+{
+namespace quantization
+{
+QuantizationParamsCache &QuantizationParamsCache::get()
+{
+    static QuantizationParamsCache cache;
+    return cache;
+}
+
+Status QuantizationParamsCache::quantized_multiplier(float multiplier, int32_t *quant_multiplier, int32_t *shift, bool ignore_epsilon)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON(quant_multiplier == nullptr);
+    ARM_COMPUTE_RETURN_ERROR_ON(shift == nullptr);
+
+    const MultiplierKey key = std::make_pair(multiplier, ignore_epsilon);
+
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mutex);
+    const auto                                  it = _multipliers.find(key);
+    if(it != _multipliers.end())
+    {
+        *quant_multiplier = it->second.first;
+        *shift            = it->second.second;
+        return Status{};
+    }
+
+    ARM_COMPUTE_RETURN_ON_ERROR(calculate_quantized_multiplier(multiplier, quant_multiplier, shift, ignore_epsilon));
+    _multipliers[key] = std::make_pair(*quant_multiplier, *shift);
+    return Status{};
+}
+
+const std::array<float, 256> &QuantizationParamsCache::dequantization_lut(const UniformQuantizationInfo &qinfo, bool is_signed)
+{
+    const LutKey key = std::make_tuple(qinfo.scale, qinfo.offset, 0.f, 0, is_signed);
+
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mutex);
+    auto                                       &entry = _dequant_luts[key];
+    if(entry == nullptr)
+    {
+        entry = support::cpp14::make_unique<std::array<float, 256>>();
+        for(int i = 0; i < 256; ++i)
+        {
+            (*entry)[i] = is_signed ? dequantize_qasymm8_signed(static_cast<int8_t>(i), qinfo) : dequantize_qasymm8(static_cast<uint8_t>(i), qinfo);
+        }
+    }
+    return *entry;
+}
+
+const std::array<uint8_t, 256> &QuantizationParamsCache::requantization_lut(const UniformQuantizationInfo &src_qinfo, const UniformQuantizationInfo &dst_qinfo, bool is_signed)
+{
+    const LutKey key = std::make_tuple(src_qinfo.scale, src_qinfo.offset, dst_qinfo.scale, dst_qinfo.offset, is_signed);
+
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mutex);
+    auto                                       &entry = _requant_luts[key];
+    if(entry == nullptr)
+    {
+        entry = support::cpp14::make_unique<std::array<uint8_t, 256>>();
+        for(int i = 0; i < 256; ++i)
+        {
+            if(is_signed)
+            {
+                (*entry)[i] = static_cast<uint8_t>(quantize_qasymm8_signed(dequantize_qasymm8_signed(static_cast<int8_t>(i), src_qinfo), dst_qinfo));
+            }
+            else
+            {
+                (*entry)[i] = quantize_qasymm8(dequantize_qasymm8(static_cast<uint8_t>(i), src_qinfo), dst_qinfo);
+            }
+        }
+    }
+    return *entry;
+}
+
+size_t QuantizationParamsCache::num_entries() const
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mutex);
+    return _multipliers.size() + _dequant_luts.size() + _requant_luts.size();
+}
+
+void QuantizationParamsCache::clear()
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mutex);
+    _multipliers.clear();
+    _dequant_luts.clear();
+    _requant_luts.clear();
+}
+} // namespace quantization
+} // namespace arm_compute
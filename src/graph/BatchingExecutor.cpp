@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/BatchingExecutor.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/GraphManager.h"
+#include "arm_compute/graph/ITensorHandle.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/Tensor.h"
+
+#include <cstring>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** Returns the handle of the single output tensor of the graph's only node of @p type, nullptr on error */
+ITensorHandle *get_single_io_handle(Graph &g, NodeType type)
+{
+    const std::vector<NodeID> &nids = g.nodes(type);
+    if(nids.size() != 1)
+    {
+        return nullptr;
+    }
+
+    INode *node = g.node(nids.front());
+    if(node == nullptr || node->num_outputs() != 1 || node->output(0) == nullptr)
+    {
+        return nullptr;
+    }
+
+    return node->output(0)->handle();
+}
+} // namespace
+
+BatchingExecutor::BatchingExecutor(GraphManager &manager, Graph &graph, unsigned int max_batch, std::chrono::microseconds latency_budget)
+    : _manager(manager), _graph(graph), _max_batch(max_batch), _latency_budget(latency_budget)
+{
+}
+
+BatchingExecutor::~BatchingExecutor()
+{
+    stop();
+}
+
+Status BatchingExecutor::start()
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(_started, "Batching executor is already started");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(_max_batch == 0, "Maximum batch size must be positive");
+
+    _input_handle  = get_single_io_handle(_graph, NodeType::Input);
+    _output_handle = get_single_io_handle(_graph, NodeType::Output);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(_input_handle == nullptr || _output_handle == nullptr,
+                                    "Batching executor expects a finalized graph with exactly one input and one output");
+
+    const ITensorInfo *input_info  = _input_handle->tensor().info();
+    const ITensorInfo *output_info = _output_handle->tensor().info();
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(input_info->dimension(3) != _max_batch || output_info->dimension(3) != _max_batch,
+                                    "Graph batch dimension must match the executor's maximum batch size");
+
+    _input_sample_stride  = input_info->strides_in_bytes()[3];
+    _output_sample_stride = output_info->strides_in_bytes()[3];
+
+    _stop    = false;
+    _started = true;
+    _worker  = std::thread(&BatchingExecutor::worker_loop, this);
+
+    return Status{};
+}
+
+void BatchingExecutor::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if(!_started)
+        {
+            return;
+        }
+        _stop = true;
+    }
+    _worker_cv.notify_all();
+    _done_cv.notify_all();
+
+    if(_worker.joinable())
+    {
+        _worker.join();
+    }
+
+    // Fail any requests that were still accumulating
+    std::lock_guard<std::mutex> lock(_mutex);
+    for(Request *req : _filling)
+    {
+        req->status = Status(ErrorCode::RUNTIME_ERROR, "Batching executor stopped before the request could run");
+        req->done   = true;
+    }
+    _filling.clear();
+    _started = false;
+    _done_cv.notify_all();
+}
+
+Status BatchingExecutor::enqueue(const void *input, size_t input_size, void *output, size_t output_size)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!_started, "Batching executor is not started");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(input_size != _input_sample_stride, "Input size must match the input tensor's batch stride");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(output_size != _output_sample_stride, "Output size must match the output tensor's batch stride");
+
+    Request req{ input, output, false, Status{} };
+
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    // Wait for a free slot in the accumulating batch
+    _done_cv.wait(lock, [this]
+    {
+        return _stop || (_filling.size() < _max_batch);
+    });
+    if(_stop)
+    {
+        return Status(ErrorCode::RUNTIME_ERROR, "Batching executor stopped before the request could run");
+    }
+
+    if(_filling.empty())
+    {
+        _oldest_request_time = std::chrono::steady_clock::now();
+    }
+    _filling.push_back(&req);
+    _worker_cv.notify_one();
+
+    // Wait for the request's batch to execute
+    _done_cv.wait(lock, [&req]
+    {
+        return req.done;
+    });
+
+    return req.status;
+}
+
+void BatchingExecutor::worker_loop()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    while(!_stop)
+    {
+        if(_filling.empty())
+        {
+            _worker_cv.wait(lock, [this]
+            {
+                return _stop || !_filling.empty();
+            });
+            continue;
+        }
+
+        // Give the batch until the oldest request's deadline to fill up
+        const auto deadline = _oldest_request_time + _latency_budget;
+        _worker_cv.wait_until(lock, deadline, [this]
+        {
+            return _stop || (_filling.size() >= _max_batch);
+        });
+        if(_stop)
+        {
+            break;
+        }
+
+        std::vector<Request *> batch;
+        batch.swap(_filling);
+        _done_cv.notify_all(); // Free slots are available again
+
+        lock.unlock();
+        execute_batch(batch);
+        lock.lock();
+
+        for(Request *req : batch)
+        {
+            req->done = true;
+        }
+        _done_cv.notify_all();
+    }
+}
+
+void BatchingExecutor::execute_batch(const std::vector<Request *> &batch)
+{
+    ARM_COMPUTE_LOG_GRAPH_INFO("Batching executor running a batch of " << batch.size() << " / " << _max_batch << std::endl);
+
+    // Gather the requests into the batch tensor, zero-filling unused slots
+    _input_handle->map(true);
+    uint8_t *input_base = _input_handle->tensor().buffer() + _input_handle->tensor().info()->offset_first_element_in_bytes();
+    for(unsigned int i = 0; i < _max_batch; ++i)
+    {
+        if(i < batch.size())
+        {
+            std::memcpy(input_base + i * _input_sample_stride, batch[i]->input, _input_sample_stride);
+        }
+        else
+        {
+            std::memset(input_base + i * _input_sample_stride, 0, _input_sample_stride);
+        }
+    }
+    _input_handle->unmap();
+
+    _manager.execute_graph(_graph);
+
+    // Scatter each request's slice of the batched output
+    _output_handle->map(true);
+    const uint8_t *output_base = _output_handle->tensor().buffer() + _output_handle->tensor().info()->offset_first_element_in_bytes();
+    for(unsigned int i = 0; i < batch.size(); ++i)
+    {
+        std::memcpy(batch[i]->output, output_base + i * _output_sample_stride, _output_sample_stride);
+    }
+    _output_handle->unmap();
+}
+} // namespace graph
+} // namespace arm_compute
@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/CalibrationStats.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/graph/INode.h"
+#include "arm_compute/graph/ITensorHandle.h"
+#include "arm_compute/graph/Tensor.h"
+
+#include "arm_compute/core/utils/misc/Utility.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace arm_compute
+{
+namespace graph
+{
+constexpr unsigned int TensorStatistics::num_bins;
+
+TensorStatistics::TensorStatistics()
+    : _min(std::numeric_limits<float>::max()), _max(std::numeric_limits<float>::lowest()), _count(0), _range(1.f), _histogram(num_bins, 0)
+{
+}
+
+void TensorStatistics::update(const ITensor &tensor)
+{
+    if(tensor.info()->data_type() != DataType::F32)
+    {
+        return;
+    }
+
+    Window window;
+    window.use_tensor_dimensions(tensor.info()->tensor_shape());
+
+    Iterator it(&tensor, window);
+    execute_window_loop(window, [&](const Coordinates &)
+    {
+        const float value = *reinterpret_cast<const float *>(it.ptr());
+        if(!std::isfinite(value))
+        {
+            return;
+        }
+
+        _min = std::min(_min, value);
+        _max = std::max(_max, value);
+        ++_count;
+
+        // Grow the histogram range by merging adjacent bins until the sample fits
+        const float abs_value = std::fabs(value);
+        while(abs_value >= _range)
+        {
+            for(unsigned int i = 0; i < num_bins / 2; ++i)
+            {
+                _histogram[i] = _histogram[2 * i] + _histogram[2 * i + 1];
+            }
+            std::fill(_histogram.begin() + num_bins / 2, _histogram.end(), 0);
+            _range *= 2.f;
+        }
+        ++_histogram[static_cast<unsigned int>(abs_value / _range * num_bins)];
+    },
+    it);
+}
+
+float TensorStatistics::minimum() const
+{
+    return _min;
+}
+
+float TensorStatistics::maximum() const
+{
+    return _max;
+}
+
+uint64_t TensorStatistics::num_samples() const
+{
+    return _count;
+}
+
+const std::vector<uint64_t> &TensorStatistics::histogram() const
+{
+    return _histogram;
+}
+
+float TensorStatistics::histogram_range() const
+{
+    return _range;
+}
+
+float TensorStatistics::clipped_abs_bound(float clipping_ratio) const
+{
+    const uint64_t required = static_cast<uint64_t>(std::ceil(clipping_ratio * static_cast<double>(_count)));
+    const float    bin_width = _range / num_bins;
+
+    uint64_t covered = 0;
+    for(unsigned int i = 0; i < num_bins; ++i)
+    {
+        covered += _histogram[i];
+        if(covered >= required)
+        {
+            return (i + 1) * bin_width;
+        }
+    }
+    return _range;
+}
+
+QuantizationInfo TensorStatistics::quantization_info(DataType data_type, float clipping_ratio) const
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_count == 0, "No samples have been accumulated");
+
+    float bound_min = _min;
+    float bound_max = _max;
+    if(clipping_ratio < 1.f)
+    {
+        const float bound = clipped_abs_bound(clipping_ratio);
+        bound_min         = std::max(bound_min, -bound);
+        bound_max         = std::min(bound_max, bound);
+    }
+    // The quantized range must represent zero exactly
+    bound_min = std::min(bound_min, 0.f);
+    bound_max = std::max(bound_max, 0.f);
+
+    switch(data_type)
+    {
+        case DataType::QASYMM8:
+        case DataType::QASYMM8_SIGNED:
+        {
+            const int32_t qmin   = (data_type == DataType::QASYMM8) ? 0 : -128;
+            const int32_t qmax   = (data_type == DataType::QASYMM8) ? 255 : 127;
+            const float   scale  = std::max(bound_max - bound_min, std::numeric_limits<float>::epsilon()) / (qmax - qmin);
+            const int32_t offset = arm_compute::utility::clamp<int32_t>(qmin - static_cast<int32_t>(std::lround(bound_min / scale)), qmin, qmax);
+            return QuantizationInfo(scale, offset);
+        }
+        case DataType::QSYMM8:
+        {
+            const float abs_max = std::max({ std::fabs(bound_min), std::fabs(bound_max), std::numeric_limits<float>::epsilon() });
+            return QuantizationInfo(abs_max / 127.f);
+        }
+        case DataType::QSYMM16:
+        {
+            const float abs_max = std::max({ std::fabs(bound_min), std::fabs(bound_max), std::numeric_limits<float>::epsilon() });
+            return QuantizationInfo(abs_max / 32767.f);
+        }
+        default:
+            ARM_COMPUTE_ERROR("Unsupported quantized data type");
+    }
+}
+
+void CalibrationTable::update(INode &node)
+{
+    for(unsigned int i = 0; i < node.num_outputs(); ++i)
+    {
+        Tensor *tensor = node.output(i);
+        if(tensor == nullptr || tensor->handle() == nullptr || tensor->desc().data_type != DataType::F32)
+        {
+            continue;
+        }
+
+        Entry &entry = _entries[tensor->id()];
+        if(entry.producer.empty())
+        {
+            entry.producer = node.name().empty() ? "node_" + std::to_string(node.id()) : node.name();
+            if(i > 0)
+            {
+                entry.producer += ":" + std::to_string(i);
+            }
+        }
+
+        tensor->handle()->map(true);
+        entry.stats.update(tensor->handle()->tensor());
+        tensor->handle()->unmap();
+    }
+}
+
+const TensorStatistics *CalibrationTable::statistics(TensorID id) const
+{
+    auto it = _entries.find(id);
+    return (it != _entries.end()) ? &it->second.stats : nullptr;
+}
+
+bool CalibrationTable::empty() const
+{
+    return _entries.empty();
+}
+
+std::map<std::string, QuantizationInfo> CalibrationTable::quantization_table(DataType data_type, float clipping_ratio) const
+{
+    std::map<std::string, QuantizationInfo> table;
+    for(const auto &entry : _entries)
+    {
+        table.emplace(entry.second.producer, entry.second.stats.quantization_info(data_type, clipping_ratio));
+    }
+    return table;
+}
+
+void CalibrationTable::save(std::ostream &stream, DataType data_type, float clipping_ratio) const
+{
+    for(const auto &entry : quantization_table(data_type, clipping_ratio))
+    {
+        const UniformQuantizationInfo qinfo = entry.second.uniform();
+        stream << entry.first << " " << qinfo.scale << " " << qinfo.offset << "\n";
+    }
+}
+} // namespace graph
+} // namespace arm_compute
@@ -32,7 +32,7 @@ namespace arm_compute
 namespace graph
 {
 GraphContext::GraphContext()
-    : _config(), _memory_managers(), _weights_managers()
+    : _config(), _runtime_ctx(nullptr), _memory_managers(), _weights_managers()
 {
 }
 
@@ -53,6 +53,16 @@ void GraphContext::set_config(const GraphConfig &config)
     _config = config;
 }
 
+void GraphContext::set_runtime_context(arm_compute::IRuntimeContext *ctx)
+{
+    _runtime_ctx = ctx;
+}
+
+arm_compute::IRuntimeContext *GraphContext::runtime_context() const
+{
+    return _runtime_ctx;
+}
+
 bool GraphContext::insert_memory_management_ctx(MemoryManagerContext &&memory_ctx)
 {
     Target target = memory_ctx.target;
@@ -101,13 +111,16 @@ std::map<Target, WeightsManagerContext> &GraphContext::weights_managers()
 
 void GraphContext::finalize()
 {
-    const size_t num_pools = 1;
+    // Pipelined execution runs two frames concurrently, so each stage needs its own pool
+    // of function scratch memory to lock at run time
+    const size_t num_pools = _config.use_pipelined_execution ? 2 : 1;
     for(auto &mm_obj : _memory_managers)
     {
         ARM_COMPUTE_ERROR_ON(!mm_obj.second.allocator);
 
-        // Finalize intra layer memory manager
-        if(mm_obj.second.intra_mm != nullptr)
+        // Finalize intra layer memory manager; when function scratch was folded into the
+        // cross-layer analysis the intra manager holds no lifetimes and needs no pool
+        if(mm_obj.second.intra_mm != nullptr && !mm_obj.second.intra_scratch_shared)
         {
             mm_obj.second.intra_mm->populate(*mm_obj.second.allocator, num_pools);
         }
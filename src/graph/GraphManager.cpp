@@ -31,13 +31,97 @@
 #include "arm_compute/graph/Utils.h"
 #include "arm_compute/graph/detail/CrossLayerMemoryManagerHelpers.h"
 #include "arm_compute/graph/detail/ExecutionHelpers.h"
+#include "arm_compute/graph/detail/HeterogeneousPlacementHelpers.h"
+#include "arm_compute/graph/detail/PipelineHelpers.h"
 
 #include "arm_compute/graph/algorithms/TopologicalSort.h"
 
+#include "support/Mutex.h"
+
+#include <chrono>
+#include <fstream>
+#include <set>
+#include <sstream>
+
 namespace arm_compute
 {
 namespace graph
 {
+namespace
+{
+/** Formats a topology hash as the cache file line representing it */
+std::string topology_hash_to_string(uint64_t hash)
+{
+    std::ostringstream ss;
+    ss << std::hex << hash;
+    return ss.str();
+}
+
+/** Checks if a topology hash is recorded in a cache file
+ *
+ * @param[in] filename Cache file to look into
+ * @param[in] hash     Topology hash to look for
+ *
+ * @return True if the hash is recorded
+ */
+bool topology_cache_contains(const std::string &filename, uint64_t hash)
+{
+    std::ifstream fs(filename, std::ios::in);
+    if(!fs.is_open())
+    {
+        return false;
+    }
+
+    const std::string hash_str = topology_hash_to_string(hash);
+    std::string       line;
+    while(std::getline(fs, line))
+    {
+        if(line == hash_str)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/** Records a topology hash in a cache file
+ *
+ * @param[in] filename Cache file to append to
+ * @param[in] hash     Topology hash to record
+ */
+void topology_cache_append(const std::string &filename, uint64_t hash)
+{
+    std::ofstream fs(filename, std::ios::out | std::ios::app);
+    if(fs.is_open())
+    {
+        fs << topology_hash_to_string(hash) << "\n";
+    }
+}
+
+/** Process-level registry of topology hashes validated in this process, used by the
+ *  deferred validation mode to skip re-validation of graphs seen before */
+std::set<uint64_t> &validated_topologies()
+{
+    static std::set<uint64_t> topologies;
+    return topologies;
+}
+arm_compute::Mutex validated_topologies_mutex;
+
+/** Checks if a topology hash validated earlier in this process */
+bool topology_validated_in_process(uint64_t hash)
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(validated_topologies_mutex);
+    return validated_topologies().find(hash) != validated_topologies().end();
+}
+
+/** Records a topology hash as validated in this process */
+void topology_record_in_process(uint64_t hash)
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(validated_topologies_mutex);
+    validated_topologies().insert(hash);
+}
+} // namespace
+
 GraphManager::GraphManager()
     : _workloads()
 {
@@ -46,9 +130,12 @@ GraphManager::GraphManager()
 void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &pm, Target target)
 {
     // Check if graph has been registered
-    if(_workloads.find(graph.id()) != std::end(_workloads))
     {
-        ARM_COMPUTE_ERROR("Graph is already registered!");
+        arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+        if(_workloads.find(graph.id()) != std::end(_workloads))
+        {
+            ARM_COMPUTE_ERROR("Graph is already registered!");
+        }
     }
 
     // Apply IR mutating passes
@@ -68,6 +155,35 @@ void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &
     // TODO (COMPMID-2014) : Setup all backends needed by the graph
     setup_requested_backend_context(ctx, forced_target);
 
+    // Split the graph across the CPU and GPU targets by estimated cost
+    if(ctx.config().use_heterogeneous_placement)
+    {
+        const Target secondary = (forced_target == Target::CL) ? Target::NEON : Target::CL;
+        if((forced_target == Target::NEON || forced_target == Target::CL) && is_target_supported(secondary))
+        {
+            // Cut the heaviest convolutions in two so the placement pass can run the halves on both devices
+            if(ctx.config().use_cooperative_split)
+            {
+                detail::split_heavy_nodes_cooperatively(graph);
+            }
+            if(detail::place_nodes_heterogeneously(graph, forced_target, secondary))
+            {
+                setup_requested_backend_context(ctx, secondary);
+            }
+        }
+        else
+        {
+            ARM_COMPUTE_LOG_GRAPH_INFO("Heterogeneous placement requested but no second target is available" << std::endl);
+        }
+    }
+
+    // Cut the graph into two stages for pipelined execution
+    std::map<NodeID, unsigned int> pipeline_stages;
+    if(ctx.config().use_pipelined_execution)
+    {
+        pipeline_stages = detail::partition_graph_for_pipelining(graph);
+    }
+
     // Configure all tensors
     detail::configure_all_tensors(graph);
 
@@ -77,57 +193,210 @@ void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &
     // Perform topological sort
     std::vector<NodeID> topological_sorted_nodes = dfs(graph);
 
+    // Skip backend validation when an identical topology already finalized successfully
+    // in an earlier process
+    uint64_t topology_hash       = 0;
+    bool     topology_was_cached = false;
+    if(!ctx.config().topology_cache_file.empty() || ctx.config().use_deferred_validation)
+    {
+        topology_hash = compute_topology_hash(graph);
+        if(!ctx.config().topology_cache_file.empty())
+        {
+            topology_was_cached = topology_cache_contains(ctx.config().topology_cache_file, topology_hash);
+        }
+        // Deferred validation also skips topologies already validated in this process,
+        // e.g. several instances of the same network finalizing one after another
+        if(!topology_was_cached && ctx.config().use_deferred_validation)
+        {
+            topology_was_cached = topology_validated_in_process(topology_hash);
+        }
+    }
+
+    // Attribute the startup phases when requested
+    StartupProfile *startup_profile = ctx.config().use_startup_profiling ? &_startup_profiles[graph.id()] : nullptr;
+
     // Validate all nodes
-    detail::validate_all_nodes(graph);
+    if(topology_was_cached)
+    {
+        ARM_COMPUTE_LOG_GRAPH_INFO("Skipping backend validation of topology with cached hash " << topology_hash_to_string(topology_hash) << std::endl);
+    }
+    else
+    {
+        detail::validate_all_nodes(graph, startup_profile);
+    }
 
     // Configure all nodes
-    auto workload = detail::configure_all_nodes(graph, ctx, topological_sorted_nodes);
+    auto workload = detail::configure_all_nodes(graph, ctx, topological_sorted_nodes, startup_profile);
     ARM_COMPUTE_ERROR_ON_MSG(workload.tasks.empty(), "Could not configure all nodes!");
 
+    // Run sibling consumers of one tensor back-to-back while it is still cache-resident.
+    // Runs before the transition manager so the lifetime analysis sees the final order;
+    // pipelined workloads keep their stage order instead
+    if(ctx.config().use_sibling_grouping && pipeline_stages.empty())
+    {
+        detail::group_sibling_consumer_tasks(workload);
+    }
+
+    // Tag each task with its pipeline stage
+    if(!pipeline_stages.empty())
+    {
+        workload.pipeline_stage.reserve(workload.tasks.size());
+        for(auto &task : workload.tasks)
+        {
+            const auto stage = pipeline_stages.find(task.node->id());
+            workload.pipeline_stage.push_back((stage != pipeline_stages.end()) ? stage->second : 0);
+        }
+    }
+
+    // A dry run stops after configuration: every function has configured against real
+    // tensor infos and registered its workspace lifetimes, which is all the planning
+    // reports need. Constant data loading, prepare and memory allocation are skipped
+    const bool dry_run = ctx.config().use_dry_run;
+
     // Allocate const tensors and call accessors
-    detail::allocate_const_tensors(graph);
-    detail::call_all_const_node_accessors(graph);
+    IWeightsManager *weights_manager  = nullptr;
+    bool             weights_restored = false;
+    if(!dry_run)
+    {
+        const auto const_allocation_start = std::chrono::steady_clock::now();
+        detail::allocate_const_tensors(graph);
+        if(startup_profile != nullptr)
+        {
+            startup_profile->allocation_total_ns += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - const_allocation_start).count();
+        }
+        detail::call_all_const_node_accessors(graph);
 
-    // Prepare graph
-    detail::prepare_all_tasks(workload);
+        // Share identical weight contents across graphs through the process-level store
+        if(ctx.config().use_shared_const_tensors)
+        {
+            detail::deduplicate_const_tensors(graph);
+        }
+
+        // Reload cached transformed weights, if any, so that prepare restores them instead of
+        // re-running the reshape functions on every process start
+        if(!ctx.config().weights_cache_file.empty())
+        {
+            WeightsManagerContext *wm_ctx = ctx.weights_management_ctx(forced_target);
+            weights_manager               = (wm_ctx != nullptr) ? wm_ctx->wm.get() : nullptr;
+        }
+        if(weights_manager != nullptr)
+        {
+            weights_restored = weights_manager->load_transformed_weights(ctx.config().weights_cache_file);
+        }
+
+        // Prepare graph
+        detail::prepare_all_tasks(workload, startup_profile);
+    }
+
+    // First finalize with a cache file configured: store the transformed weights for the next start
+    if(weights_manager != nullptr && !weights_restored)
+    {
+        weights_manager->save_transformed_weights(ctx.config().weights_cache_file);
+    }
 
     // Setup tensor memory (Allocate all tensors or setup transition manager)
-    if(ctx.config().use_transition_memory_manager)
+    // Cross-layer reuse would alias tensors of the two frames in flight, so pipelined
+    // workloads allocate every tensor instead
+    const auto allocation_start = std::chrono::steady_clock::now();
+    if(ctx.config().use_transition_memory_manager && pipeline_stages.empty())
     {
+        // Registers the transition tensor lifetimes without backing them: on a dry run the
+        // context pools are never populated, so this only completes the memory plan
         detail::configure_transition_manager(graph, ctx, workload);
     }
-    else
+    else if(!dry_run)
     {
         detail::allocate_all_tensors(graph);
     }
+    if(startup_profile != nullptr)
+    {
+        startup_profile->allocation_total_ns += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - allocation_start).count();
+    }
 
     // Finalize Graph context
-    ctx.finalize();
+    if(!dry_run)
+    {
+        ctx.finalize();
+    }
 
-    // Register graph
-    _workloads.insert(std::make_pair(graph.id(), std::move(workload)));
-    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Created workload for graph with ID : " << graph.id() << std::endl);
+    // Register graph; dry-run graphs hold no memory and cannot execute, so they stay
+    // unregistered and execution requests fail with the unregistered-graph error
+    if(!dry_run)
+    {
+        arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+        _workloads.insert(std::make_pair(graph.id(), std::move(workload)));
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Created workload for graph with ID : " << graph.id() << std::endl);
+    }
+    else
+    {
+        ARM_COMPUTE_LOG_GRAPH_INFO("Dry-run finalized graph with ID : " << graph.id() << std::endl);
+    }
+
+    // Record the topology so later processes and graphs can skip its validation
+    if(!ctx.config().topology_cache_file.empty() && !topology_was_cached)
+    {
+        topology_cache_append(ctx.config().topology_cache_file, topology_hash);
+    }
+    if(ctx.config().use_deferred_validation && !topology_was_cached)
+    {
+        topology_record_in_process(topology_hash);
+    }
 }
 
 void GraphManager::execute_graph(Graph &graph)
 {
-    // Check if graph is finalized
-    auto it = _workloads.find(graph.id());
-    ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_workloads), "Graph is not registered!");
+    // Check if graph is finalized. Map references stay valid while other graphs are
+    // registered concurrently, so the lock is only held for the lookup
+    ExecutionWorkload *workload = nullptr;
+    ExecutionBudget   *budget   = nullptr;
+    {
+        arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+        auto it = _workloads.find(graph.id());
+        ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_workloads), "Graph is not registered!");
+        workload = &it->second;
+
+        auto budget_it = _budgets.find(graph.id());
+        if(budget_it != std::end(_budgets))
+        {
+            budget = &budget_it->second;
+        }
+    }
+
+    // Pipelined workloads overlap consecutive frames and drive the accessors themselves
+    if(!workload->pipeline_stage.empty())
+    {
+        detail::execute_workload_pipelined(*workload);
+        return;
+    }
 
     while(true)
     {
         // Call input accessors
-        if(!detail::call_all_input_node_accessors(it->second))
+        if(!detail::call_all_input_node_accessors(*workload))
         {
             return;
         }
 
-        // Run graph
-        detail::call_all_tasks(it->second);
+        // Run graph, profiling every tensor when calibrating and every task when timing
+        if(workload->ctx->config().use_calibration)
+        {
+            detail::call_all_tasks_and_collect_statistics(*workload, _calibration_tables[graph.id()]);
+        }
+        else if(workload->ctx->config().use_node_time_profiling)
+        {
+            detail::call_all_tasks_and_time(*workload, _node_timings[graph.id()]);
+        }
+        else if(budget != nullptr)
+        {
+            detail::call_all_tasks_with_budget(*workload, *budget);
+        }
+        else
+        {
+            detail::call_all_tasks(*workload);
+        }
 
         // Call output accessors
-        if(!detail::call_all_output_node_accessors(it->second))
+        if(!detail::call_all_output_node_accessors(*workload))
         {
             return;
         }
@@ -136,10 +405,46 @@ void GraphManager::execute_graph(Graph &graph)
 
 void GraphManager::invalidate_graph(Graph &graph)
 {
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+
     auto it = _workloads.find(graph.id());
     ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_workloads), "Graph is not registered!");
 
     _workloads.erase(it);
 }
+
+const StartupProfile *GraphManager::startup_profile(const Graph &graph) const
+{
+    auto it = _startup_profiles.find(graph.id());
+    return (it != _startup_profiles.end()) ? &it->second : nullptr;
+}
+
+const CalibrationTable *GraphManager::calibration_table(const Graph &graph) const
+{
+    auto it = _calibration_tables.find(graph.id());
+    return (it != _calibration_tables.end()) ? &it->second : nullptr;
+}
+
+const std::map<NodeID, NodeExecutionTime> *GraphManager::node_timings(const Graph &graph) const
+{
+    auto it = _node_timings.find(graph.id());
+    return (it != _node_timings.end()) ? &it->second : nullptr;
+}
+
+void GraphManager::set_execution_budget(const Graph &graph, uint64_t budget_ns, DegradationHook hook)
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+    ARM_COMPUTE_ERROR_ON_MSG(_workloads.find(graph.id()) == std::end(_workloads), "Graph is not registered!");
+
+    ExecutionBudget &budget = _budgets[graph.id()];
+    budget.budget_ns        = budget_ns;
+    budget.hook             = std::move(hook);
+}
+
+const ExecutionBudget *GraphManager::execution_budget(const Graph &graph) const
+{
+    auto it = _budgets.find(graph.id());
+    return (it != _budgets.end()) ? &it->second : nullptr;
+}
 } // namespace graph
 } // namespace arm_compute
\ No newline at end of file
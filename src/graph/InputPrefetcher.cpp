@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/InputPrefetcher.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/ITensorAccessor.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/Tensor.h"
+#include "support/MemorySupport.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Accessor installed on a prefetched input tensor.
+ *
+ * Runs on the execution thread inside @ref GraphManager::execute_graph: waits for the stream's
+ * oldest staged frame, copies it into the backend tensor and frees the staging slot. Reports no
+ * more data once the original accessor has and the staged frames are drained.
+ */
+class InputPrefetcher::PrefetchAccessor final : public ITensorAccessor
+{
+public:
+    PrefetchAccessor(InputPrefetcher &prefetcher, size_t stream_idx)
+        : _prefetcher(prefetcher), _stream_idx(stream_idx)
+    {
+    }
+
+    // Inherited methods overridden:
+    bool access_tensor(ITensor &tensor) override
+    {
+        InputStream &stream = _prefetcher._streams[_stream_idx];
+
+        {
+            std::unique_lock<std::mutex> lock(_prefetcher._mutex);
+            _prefetcher._frame_ready.wait(lock, [&]
+            {
+                return _prefetcher._stop || _prefetcher._eos || stream.consumed < _prefetcher._produced;
+            });
+            if(_prefetcher._stop || stream.consumed >= _prefetcher._produced)
+            {
+                return false;
+            }
+        }
+
+        // Copy outside the lock: the slot cannot be restaged until it is marked consumed
+        tensor.copy_from(*stream.staging[stream.consumed % _prefetcher._depth]);
+
+        {
+            std::lock_guard<std::mutex> lock(_prefetcher._mutex);
+            ++stream.consumed;
+        }
+        _prefetcher._slot_free.notify_one();
+
+        return true;
+    }
+
+private:
+    InputPrefetcher &_prefetcher;
+    size_t           _stream_idx;
+};
+
+InputPrefetcher::InputPrefetcher(Graph &graph, unsigned int depth)
+    : _graph(graph), _depth(depth)
+{
+}
+
+InputPrefetcher::~InputPrefetcher()
+{
+    stop();
+}
+
+Status InputPrefetcher::start()
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(_started, "Input prefetcher is already started");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(_depth == 0, "Prefetch depth must be positive");
+
+    // Take over the accessor of every input node that has one
+    for(NodeID nid : _graph.nodes(NodeType::Input))
+    {
+        INode *node = _graph.node(nid);
+        if(node == nullptr || node->num_outputs() == 0 || node->output(0) == nullptr)
+        {
+            continue;
+        }
+
+        Tensor *tensor = node->output(0);
+        if(tensor->accessor() == nullptr || tensor->handle() == nullptr)
+        {
+            continue;
+        }
+
+        InputStream stream{};
+        stream.tensor   = tensor;
+        stream.accessor = tensor->extract_accessor();
+        for(unsigned int i = 0; i < _depth; ++i)
+        {
+            const TensorDescriptor &desc = tensor->desc();
+            TensorInfo              info(desc.shape, 1, desc.data_type, desc.quant_info);
+            info.set_data_layout(desc.layout);
+
+            auto staging = support::cpp14::make_unique<arm_compute::Tensor>();
+            staging->allocator()->init(info);
+            staging->allocator()->allocate();
+            stream.staging.emplace_back(std::move(staging));
+        }
+        _streams.emplace_back(std::move(stream));
+        tensor->set_accessor(support::cpp14::make_unique<PrefetchAccessor>(*this, _streams.size() - 1));
+    }
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(_streams.empty(), "Input prefetcher expects a finalized graph with at least one input accessor");
+
+    _produced = 0;
+    _eos      = false;
+    _stop     = false;
+    _started  = true;
+    _worker   = std::thread(&InputPrefetcher::worker_loop, this);
+
+    return Status{};
+}
+
+void InputPrefetcher::stop()
+{
+    if(!_started)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _slot_free.notify_all();
+    _frame_ready.notify_all();
+    if(_worker.joinable())
+    {
+        _worker.join();
+    }
+
+    // Hand the original accessors back so the graph stays usable without the prefetcher
+    for(auto &stream : _streams)
+    {
+        stream.tensor->set_accessor(std::move(stream.accessor));
+    }
+    _streams.clear();
+    _started = false;
+}
+
+uint64_t InputPrefetcher::oldest_consumed() const
+{
+    uint64_t oldest = _produced;
+    for(const auto &stream : _streams)
+    {
+        oldest = std::min(oldest, stream.consumed);
+    }
+    return oldest;
+}
+
+void InputPrefetcher::worker_loop()
+{
+    while(true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _slot_free.wait(lock, [this]
+            {
+                return _stop || (_produced - oldest_consumed()) < _depth;
+            });
+            if(_stop)
+            {
+                return;
+            }
+        }
+
+        // Stage the frame outside the lock: the accessors do the slow storage reads. The slot
+        // is not visible to execution until the frame counter moves, and cannot be consumed
+        // out from under us as it is not yet produced.
+        bool more = true;
+        for(auto &stream : _streams)
+        {
+            more = stream.accessor->access_tensor(*stream.staging[_produced % _depth]) && more;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if(more)
+            {
+                ++_produced;
+            }
+            else
+            {
+                // A partially staged frame is dropped: execution drains the complete ones and stops
+                _eos = true;
+            }
+        }
+        _frame_ready.notify_all();
+
+        if(!more)
+        {
+            ARM_COMPUTE_LOG_GRAPH_INFO("Input prefetcher reached end of stream after " << _produced << " frames\n");
+            return;
+        }
+    }
+}
+} // namespace graph
+} // namespace arm_compute
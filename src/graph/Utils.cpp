@@ -23,10 +23,13 @@
  */
 #include "arm_compute/graph/Utils.h"
 
+#include "arm_compute/core/Utils.h"
 #include "arm_compute/graph/GraphContext.h"
 #include "arm_compute/graph/backends/BackendRegistry.h"
 #include "arm_compute/graph/mutators/GraphMutators.h"
 
+#include <algorithm>
+
 namespace arm_compute
 {
 namespace graph
@@ -85,7 +88,24 @@ PassManager create_default_pass_manager(Target target, const GraphConfig &cfg)
     {
         pm.append(support::cpp14::make_unique<SyntheticDataTypeMutator>(), !is_target_gc);
     }
+    if(cfg.convert_to_bfloat16)
+    {
+        // BFLOAT16 storage is only backed by NEON kernels
+        pm.append(support::cpp14::make_unique<Bfloat16Mutator>(), target == Target::NEON);
+    }
+    if(cfg.use_layout_optimization)
+    {
+        // Layout heuristics are tuned against the NEON kernels; runs before constant
+        // folding so permutes inserted on const weights are folded away at finalize
+        pm.append(support::cpp14::make_unique<LayoutOptimizationMutator>(), target == Target::NEON);
+    }
+    pm.append(support::cpp14::make_unique<ConstantFoldingMutator>());
     pm.append(support::cpp14::make_unique<NodeFusionMutator>(), !is_target_gc);
+    if(cfg.use_activation_recompute)
+    {
+        // Runs after fusion so recompute chains clone the fused form of each node
+        pm.append(support::cpp14::make_unique<ActivationRecomputeMutator>(cfg.recompute_span_threshold, cfg.recompute_max_depth));
+    }
     pm.append(support::cpp14::make_unique<GroupedConvolutionMutator>());
     pm.append(support::cpp14::make_unique<InPlaceOperationMutator>(), !is_target_gc);
 
@@ -155,6 +175,61 @@ size_t get_dimension_idx(DataLayout data_layout, const DataLayoutDimension data_
     ARM_COMPUTE_ERROR("Data layout index not supported!");
 }
 
+uint64_t compute_topology_hash(const Graph &g)
+{
+    // FNV-1a accumulation over the topology description
+    uint64_t hash    = 0xcbf29ce484222325ULL;
+    auto     combine = [&hash](uint64_t value)
+    {
+        hash ^= value;
+        hash *= 0x100000001b3ULL;
+    };
+
+    for(auto &node : g.nodes())
+    {
+        if(node == nullptr)
+        {
+            continue;
+        }
+
+        combine(node->id());
+        combine(static_cast<uint64_t>(node->type()));
+        combine(static_cast<uint64_t>(node->assigned_target()));
+
+        // Output descriptors capture the shape-relevant node attributes
+        for(unsigned int i = 0; i < node->num_outputs(); ++i)
+        {
+            const Tensor *output = node->output(i);
+            if(output == nullptr)
+            {
+                continue;
+            }
+            const TensorDescriptor &desc = output->desc();
+            combine(static_cast<uint64_t>(desc.data_type));
+            combine(static_cast<uint64_t>(desc.layout));
+            combine(desc.shape.num_dimensions());
+            for(size_t d = 0; d < desc.shape.num_dimensions(); ++d)
+            {
+                combine(desc.shape[d]);
+            }
+        }
+
+        // Connectivity
+        for(unsigned int i = 0; i < node->input_edges().size(); ++i)
+        {
+            const Edge *input_edge = node->input_edge(i);
+            if(input_edge != nullptr)
+            {
+                combine(input_edge->producer_id());
+                combine(input_edge->producer_idx());
+                combine(i);
+            }
+        }
+    }
+
+    return hash;
+}
+
 std::vector<NodeIdxPair> get_driving_nodes(const INode &node)
 {
     std::vector<NodeIdxPair> driving_nodes;
@@ -175,6 +250,87 @@ std::vector<NodeIdxPair> get_driving_nodes(const INode &node)
     return driving_nodes;
 }
 
+namespace
+{
+/** Size of a tensor in bytes */
+uint64_t tensor_bytes(const Tensor *tensor)
+{
+    if(tensor == nullptr)
+    {
+        return 0;
+    }
+    const TensorDescriptor &desc = tensor->desc();
+    return static_cast<uint64_t>(desc.shape.total_size()) * data_size_from_type(desc.data_type);
+}
+} // namespace
+
+uint64_t estimate_node_ops(const INode &node)
+{
+    const Tensor *output = node.output(0);
+    if(output == nullptr)
+    {
+        return 0;
+    }
+    const uint64_t output_elements = output->desc().shape.total_size();
+
+    switch(node.type())
+    {
+        case NodeType::ConvolutionLayer:
+        case NodeType::FusedConvolutionBatchNormalizationLayer:
+        {
+            // MACs per output element: kernel spatial extent times input channels
+            const Tensor *weights = node.input(1);
+            if(weights == nullptr)
+            {
+                return output_elements;
+            }
+            const TensorShape &weights_shape = weights->desc().shape;
+            return 2 * output_elements * (weights_shape.total_size() / weights_shape[3]);
+        }
+        case NodeType::DepthwiseConvolutionLayer:
+        case NodeType::FusedDepthwiseConvolutionBatchNormalizationLayer:
+        {
+            // MACs per output element: kernel spatial extent
+            const Tensor *weights = node.input(1);
+            if(weights == nullptr)
+            {
+                return output_elements;
+            }
+            const uint64_t channels = get_dimension_size(output->desc(), DataLayoutDimension::CHANNEL);
+            return 2 * output_elements * (weights->desc().shape.total_size() / std::max<uint64_t>(channels, 1));
+        }
+        case NodeType::FullyConnectedLayer:
+        {
+            const Tensor *weights = node.input(1);
+            if(weights == nullptr)
+            {
+                return output_elements;
+            }
+            const uint64_t batches = (output->desc().shape.num_dimensions() > 1) ? output->desc().shape[1] : 1;
+            return 2 * static_cast<uint64_t>(weights->desc().shape.total_size()) * batches;
+        }
+        case NodeType::BatchNormalizationLayer:
+            // Scale and shift per element
+            return 2 * output_elements;
+        default:
+            return output_elements;
+    }
+}
+
+uint64_t estimate_node_bytes(const INode &node)
+{
+    uint64_t bytes = 0;
+    for(unsigned int i = 0; i < node.num_inputs(); ++i)
+    {
+        bytes += tensor_bytes(node.input(i));
+    }
+    for(unsigned int i = 0; i < node.num_outputs(); ++i)
+    {
+        bytes += tensor_bytes(node.output(i));
+    }
+    return bytes;
+}
+
 void configure_tensor(Tensor *tensor)
 {
     if(tensor != nullptr && tensor->handle() == nullptr)
@@ -35,6 +35,7 @@
 #include "arm_compute/graph/backends/NEON/NETensorHandle.h"
 
 #include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/utils/misc/Cast.h"
 #include "arm_compute/runtime/Allocator.h"
 #include "arm_compute/runtime/BlobLifetimeManager.h"
 #include "arm_compute/runtime/IWeightsManager.h"
@@ -56,7 +57,7 @@ namespace backends
 static detail::BackendRegistrar<NEDeviceBackend> NEDeviceBackend_registrar(Target::NEON);
 
 NEDeviceBackend::NEDeviceBackend()
-    : _allocator()
+    : _allocator(), _allocation_policy(AllocationPolicy::Lazy)
 {
 }
 
@@ -79,6 +80,9 @@ void NEDeviceBackend::setup_backend_context(GraphContext &ctx)
         Scheduler::get().set_num_threads(ctx.config().num_threads);
     }
 
+    // Page commitment policy for tensors created by this backend
+    _allocation_policy = ctx.config().allocation_policy;
+
     // Create function level memory manager
     if(ctx.memory_management_ctx(Target::NEON) == nullptr)
     {
@@ -123,7 +127,9 @@ std::unique_ptr<ITensorHandle> NEDeviceBackend::create_tensor(const Tensor &tens
     TensorInfo info(tensor_desc.shape, 1, tensor_desc.data_type, tensor_desc.quant_info);
     info.set_data_layout(tensor_desc.layout);
 
-    return support::cpp14::make_unique<NETensorHandle>(info);
+    auto handle = support::cpp14::make_unique<NETensorHandle>(info);
+    utils::cast::polymorphic_downcast<arm_compute::Tensor *>(&handle->tensor())->allocator()->set_allocation_policy(_allocation_policy);
+    return std::move(handle);
 }
 
 std::unique_ptr<ITensorHandle> NEDeviceBackend::create_subtensor(ITensorHandle *parent, TensorShape shape, Coordinates coords, bool extend_parent)
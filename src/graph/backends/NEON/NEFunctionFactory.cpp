@@ -87,6 +87,37 @@ struct NEFusedLayerTypes
 
 namespace detail
 {
+/** Creates an activation layer bound to the graph's runtime context, so that concurrent
+ * graphs schedule their kernels on their own scheduler instead of the singleton.
+ */
+std::unique_ptr<IFunction> create_activation_layer_ctx(ActivationLayerNode &node, GraphContext &ctx)
+{
+    validate_node<NETargetInfo>(node, 1 /* expected inputs */, 1 /* expected outputs */);
+
+    // Extract IO and info
+    NETargetInfo::TensorType *input    = get_backing_tensor<NETargetInfo>(node.input(0));
+    NETargetInfo::TensorType *output   = get_backing_tensor<NETargetInfo>(node.output(0));
+    const ActivationLayerInfo act_info = node.activation_info();
+
+    // Create and configure function
+    auto func = support::cpp14::make_unique<NEActivationLayer>(ctx.runtime_context());
+    func->configure(input, output, act_info);
+
+    // Log info
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated "
+                               << node.name()
+                               << " Type: " << node.type()
+                               << " Target: " << NETargetInfo::TargetType
+                               << " Data Type: " << input->info()->data_type()
+                               << " Shape: " << input->info()->tensor_shape()
+                               << " Activation function: " << act_info.activation()
+                               << " a: " << act_info.a()
+                               << " b: " << act_info.b()
+                               << std::endl);
+
+    return RETURN_UNIQUE_PTR(func);
+}
+
 template <>
 std::unique_ptr<IFunction> create_normalization_layer<NENormalizationLayer, NETargetInfo>(NormalizationLayerNode &node, GraphContext &ctx)
 {
@@ -116,6 +147,47 @@ std::unique_ptr<IFunction> create_normalization_layer<NENormalizationLayer, NETa
 
     return RETURN_UNIQUE_PTR(func);
 }
+
+/** Creates a streaming convolution layer. NEON only: the function keeps the sliding window
+ * and the previous result as internal state between runs.
+ */
+std::unique_ptr<IFunction> create_streaming_convolution_layer(StreamingConvolutionLayerNode &node, GraphContext &ctx)
+{
+    validate_node<NETargetInfo>(node, 3 /* expected inputs */, 1 /* expected outputs */);
+
+    // Extract IO and info
+    NETargetInfo::TensorType *input   = get_backing_tensor<NETargetInfo>(node.input(0));
+    NETargetInfo::TensorType *weights = get_backing_tensor<NETargetInfo>(node.input(1));
+    NETargetInfo::TensorType *biases  = get_backing_tensor<NETargetInfo>(node.input(2));
+    NETargetInfo::TensorType *output  = get_backing_tensor<NETargetInfo>(node.output(0));
+
+    if(is_data_type_quantized_asymmetric(input->info()->data_type()))
+    {
+        biases->info()->set_data_type(DataType::S32);
+    }
+
+    const PadStrideInfo conv_info    = node.convolution_info();
+    const unsigned int  window_width = node.window_width();
+    const bool          fast_math    = node.fast_math_hint() == FastMathHint::Enabled;
+
+    // Create and configure function (we assume that functions have been validated before creation)
+    auto func = support::cpp14::make_unique<NEStreamingConvolutionLayer>(get_memory_manager(ctx, NETargetInfo::TargetType), get_weights_manager(ctx, NETargetInfo::TargetType).get());
+    func->configure(input, weights, biases, output, conv_info, window_width, ActivationLayerInfo(), fast_math);
+
+    // Log info
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated "
+                               << node.name()
+                               << " Type: " << node.type()
+                               << " Target: " << NETargetInfo::TargetType
+                               << " Data Type: " << input->info()->data_type()
+                               << " Step input shape: " << input->info()->tensor_shape()
+                               << " Weights shape: " << weights->info()->tensor_shape()
+                               << " Output shape: " << output->info()->tensor_shape()
+                               << " Window width: " << window_width
+                               << std::endl);
+
+    return RETURN_UNIQUE_PTR(func);
+}
 } // namespace detail
 
 std::unique_ptr<IFunction> NEFunctionFactory::create(INode *node, GraphContext &ctx)
@@ -129,7 +201,7 @@ std::unique_ptr<IFunction> NEFunctionFactory::create(INode *node, GraphContext &
     switch(type)
     {
         case NodeType::ActivationLayer:
-            return detail::create_activation_layer<NEActivationLayer, NETargetInfo>(*polymorphic_downcast<ActivationLayerNode *>(node));
+            return detail::create_activation_layer_ctx(*polymorphic_downcast<ActivationLayerNode *>(node), ctx);
         case NodeType::BatchNormalizationLayer:
             return detail::create_batch_normalization_layer<NEBatchNormalizationLayer, NETargetInfo>(*polymorphic_downcast<BatchNormalizationLayerNode *>(node));
         case NodeType::ChannelShuffleLayer:
@@ -140,6 +212,8 @@ std::unique_ptr<IFunction> NEFunctionFactory::create(INode *node, GraphContext &
             return detail::create_deconvolution_layer<NEDeconvolutionLayer, NETargetInfo>(*polymorphic_downcast<DeconvolutionLayerNode *>(node), ctx);
         case NodeType::ConcatenateLayer:
             return detail::create_concatenate_layer<NEConcatenateLayer, NETargetInfo>(*polymorphic_downcast<ConcatenateLayerNode *>(node));
+        case NodeType::DepthConvertLayer:
+            return detail::create_depth_convert_layer<NEDepthConvertLayer, NETargetInfo>(*polymorphic_downcast<DepthConvertLayerNode *>(node));
         case NodeType::DepthwiseConvolutionLayer:
             return detail::create_depthwise_convolution_layer<NEDepthwiseConvolutionLayer, NETargetInfo>(*polymorphic_downcast<DepthwiseConvolutionLayerNode *>(node));
         case NodeType::DequantizationLayer:
@@ -182,10 +256,14 @@ std::unique_ptr<IFunction> NEFunctionFactory::create(INode *node, GraphContext &
             return detail::create_reshape_layer<NEReshapeLayer, NETargetInfo>(*polymorphic_downcast<ReshapeLayerNode *>(node));
         case NodeType::ResizeLayer:
             return detail::create_resize_layer<NEScale, NETargetInfo>(*polymorphic_downcast<ResizeLayerNode *>(node));
+        case NodeType::SliceLayer:
+            return detail::create_slice_layer<NESlice, NETargetInfo>(*polymorphic_downcast<SliceLayerNode *>(node));
         case NodeType::SoftmaxLayer:
             return detail::create_softmax_layer<NESoftmaxLayer, NETargetInfo>(*polymorphic_downcast<SoftmaxLayerNode *>(node), ctx);
         case NodeType::StackLayer:
             return detail::create_stack_layer<NEStackLayer, NETargetInfo>(*polymorphic_downcast<StackLayerNode *>(node));
+        case NodeType::StreamingConvolutionLayer:
+            return detail::create_streaming_convolution_layer(*polymorphic_downcast<StreamingConvolutionLayerNode *>(node), ctx);
         case NodeType::UpsampleLayer:
             return detail::create_upsample_layer<NEUpsampleLayer, NETargetInfo>(*polymorphic_downcast<UpsampleLayerNode *>(node), ctx);
         case NodeType::YOLOLayer:
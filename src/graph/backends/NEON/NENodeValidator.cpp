@@ -101,6 +101,16 @@ Status NENodeValidator::validate(INode *node)
             return ARM_COMPUTE_CREATE_ERROR(arm_compute::ErrorCode::RUNTIME_ERROR, "Unsupported operation : ROIAlignLayer");
         case NodeType::SliceLayer:
             return ARM_COMPUTE_CREATE_ERROR(arm_compute::ErrorCode::RUNTIME_ERROR, "Unsupported operation : SliceLayer");
+        case NodeType::StreamingConvolutionLayer:
+        {
+            auto      &conv_node = *polymorphic_downcast<StreamingConvolutionLayerNode *>(node);
+            const bool fast_math = conv_node.fast_math_hint() == FastMathHint::Enabled;
+            return NEStreamingConvolutionLayer::validate(detail::get_backing_tensor_info(conv_node.input(0)),
+                                                         detail::get_backing_tensor_info(conv_node.input(1)),
+                                                         detail::get_backing_tensor_info(conv_node.input(2)),
+                                                         detail::get_backing_tensor_info(conv_node.output(0)),
+                                                         conv_node.convolution_info(), conv_node.window_width(), ActivationLayerInfo(), fast_math);
+        }
         case NodeType::UpsampleLayer:
             return detail::validate_upsample_layer<NEUpsampleLayer>(*polymorphic_downcast<UpsampleLayerNode *>(node));
         case NodeType::YOLOLayer:
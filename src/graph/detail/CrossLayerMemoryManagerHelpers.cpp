@@ -34,6 +34,7 @@
 
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/core/utils/misc/Cast.h"
+#include "arm_compute/runtime/ISimpleLifetimeManager.h"
 
 #include <algorithm>
 #include <map>
@@ -181,10 +182,15 @@ void count_input_handles_per_target(const TaskHandles &task_handles, TargetHandl
 
 /** Calculates the lifetime of each tensor handle
  *
- * @param[in, out] tasks_handles Tensor handles for each task
- * @param[in]      hc            Data structure that keeps the handles reference count
+ * @param[in, out] tasks_handles    Tensor handles for each task
+ * @param[in]      hc               Data structure that keeps the handles reference count
+ * @param[in]      scratch_per_task Function scratch elements to register per task, can be nullptr
+ * @param[in]      lifetime_mgr     Lifetime manager to register the scratch elements with
+ * @param[in]      cross_group      Memory group the scratch elements are registered to
  */
-void configure_handle_lifetime(std::vector<TaskHandles> &tasks_handles, const HandleCounter &hc)
+void configure_handle_lifetime(std::vector<TaskHandles> &tasks_handles, const HandleCounter &hc,
+                               const std::vector<std::vector<ISimpleLifetimeManager::Element>> *scratch_per_task,
+                               ILifetimeManager *lifetime_mgr, IMemoryGroup *cross_group)
 {
     // Identify max number of tensors in flight
     HandleCounter tensors_in_flight;
@@ -208,12 +214,26 @@ void configure_handle_lifetime(std::vector<TaskHandles> &tasks_handles, const Ha
         }
     };
 
-    for(auto &task_handle : tasks_handles)
+    for(size_t i = 0; i < tasks_handles.size(); ++i)
     {
+        TaskHandles &task_handle = tasks_handles[i];
+
         // Marking all the input and output tensors of the task as in flight
         acquire(task_handle.input_handles);
         acquire(task_handle.output_handles);
 
+        // Function scratch lives exactly for the duration of its task: starting and ending
+        // its lifetime here lets it reuse blobs whose transition tensors are already dead
+        if(scratch_per_task != nullptr)
+        {
+            for(const auto &element : (*scratch_per_task)[i])
+            {
+                lifetime_mgr->register_group(cross_group);
+                lifetime_mgr->start_lifetime(element.id);
+                lifetime_mgr->end_lifetime(element.id, *element.handle, element.size, element.alignment);
+            }
+        }
+
         // Releasing the input tensors
         for(auto &input_handle : task_handle.input_handles)
         {
@@ -259,8 +279,48 @@ void configure_transition_manager(Graph &g, GraphContext &ctx, ExecutionWorkload
         {
             if(mm_ctx->cross_mm != nullptr && mm_ctx->cross_group != nullptr)
             {
+                // Fold the function-internal scratch of this target into the same lifetime
+                // analysis, so scratch of consecutive layers and dead transition intervals
+                // share memory instead of living in a separate pool
+                std::vector<std::vector<ISimpleLifetimeManager::Element>> scratch_per_task;
+                if(!workload.scratch_windows.empty() && mm_ctx->intra_mm != nullptr)
+                {
+                    auto *intra_lm = utils::cast::polymorphic_downcast<ISimpleLifetimeManager *>(mm_ctx->intra_mm->lifetime_manager());
+                    if(intra_lm->are_all_finalized())
+                    {
+                        const std::vector<ISimpleLifetimeManager::Element> elements = intra_lm->finalized_elements();
+                        scratch_per_task.resize(workload.tasks.size());
+                        for(size_t i = 0; i < workload.tasks.size(); ++i)
+                        {
+                            const INode *node = workload.tasks[i].node;
+                            if(node == nullptr || node->assigned_target() != hc.first)
+                            {
+                                continue;
+                            }
+                            auto window_it = workload.scratch_windows.find(node->id());
+                            if(window_it == std::end(workload.scratch_windows))
+                            {
+                                continue;
+                            }
+                            for(const auto &element : elements)
+                            {
+                                if(element.start_serial > window_it->second.first && element.start_serial <= window_it->second.second)
+                                {
+                                    scratch_per_task[i].push_back(element);
+                                }
+                            }
+                        }
+
+                        // The intra groups must no longer acquire memory of their own
+                        intra_lm->release_all_groups();
+                        mm_ctx->intra_scratch_shared = true;
+                    }
+                }
+
                 // Manage and allocate tensors
-                configure_handle_lifetime(tasks_handles, hc.second);
+                configure_handle_lifetime(tasks_handles, hc.second,
+                                          scratch_per_task.empty() ? nullptr : &scratch_per_task,
+                                          mm_ctx->cross_mm->lifetime_manager(), mm_ctx->cross_group.get());
             }
         }
     }
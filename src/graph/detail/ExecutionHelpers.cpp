@@ -23,12 +23,31 @@
  */
 #include "arm_compute/graph/detail/ExecutionHelpers.h"
 
+#include "arm_compute/graph/CalibrationStats.h"
 #include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/detail/HeterogeneousPlacementHelpers.h"
 #include "arm_compute/graph/GraphContext.h"
+#include "arm_compute/graph/Logger.h"
 #include "arm_compute/graph/GraphManager.h"
 #include "arm_compute/graph/Tensor.h"
 #include "arm_compute/graph/Utils.h"
 #include "arm_compute/graph/backends/BackendRegistry.h"
+#include "arm_compute/graph/backends/Utils.h"
+
+#include "arm_compute/core/utils/misc/AllocationGuard.h"
+#include "arm_compute/core/utils/misc/Cast.h"
+#include "arm_compute/runtime/ConstTensorStore.h"
+#include "arm_compute/runtime/ISimpleLifetimeManager.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <set>
+#include <thread>
 
 namespace arm_compute
 {
@@ -36,18 +55,220 @@ namespace graph
 {
 namespace detail
 {
-void validate_all_nodes(Graph &g)
+namespace
+{
+/** Collect the producing tasks of every task of a workload
+ *
+ * Dependencies are gathered walking the graph's input edges, passing through nodes that
+ * don't own a task (inputs, const, ...).
+ *
+ * @param[in] workload Workload whose task dependencies to collect
+ *
+ * @return Per-task sets of the task indices it depends on
+ */
+std::vector<std::set<unsigned int>> collect_task_dependencies(ExecutionWorkload &workload)
+{
+    const unsigned int num_tasks = workload.tasks.size();
+
+    // Map node ids to task indices
+    std::map<NodeID, unsigned int> task_of_node;
+    for(unsigned int i = 0; i < num_tasks; ++i)
+    {
+        if(workload.tasks[i].node != nullptr)
+        {
+            task_of_node[workload.tasks[i].node->id()] = i;
+        }
+    }
+
+    // Collect the tasks feeding a node, walking through nodes that don't own a task (inputs, const, ...)
+    std::function<void(const INode *, std::set<unsigned int> &)> collect_producers = [&](const INode * node, std::set<unsigned int> &deps)
+    {
+        for(EdgeID eid : node->input_edges())
+        {
+            const Edge *edge = workload.graph->edge(eid);
+            if(edge == nullptr || edge->producer() == nullptr)
+            {
+                continue;
+            }
+            auto it = task_of_node.find(edge->producer_id());
+            if(it != task_of_node.end())
+            {
+                deps.insert(it->second);
+            }
+            else
+            {
+                collect_producers(edge->producer(), deps);
+            }
+        }
+    };
+
+    std::vector<std::set<unsigned int>> dependencies(num_tasks);
+    for(unsigned int i = 0; i < num_tasks; ++i)
+    {
+        if(workload.tasks[i].node != nullptr)
+        {
+            collect_producers(workload.tasks[i].node, dependencies[i]);
+        }
+    }
+    return dependencies;
+}
+
+/** Fill in the node names labelling each task's allocation guard
+ *
+ * Resolved once and cached: @ref INode::name() returns by value and would itself
+ * allocate inside the guarded scope.
+ *
+ * @param[in,out] workload Workload whose task scopes to resolve
+ */
+void resolve_task_scopes(ExecutionWorkload &workload)
+{
+    TaskSchedule &schedule = workload.schedule;
+    if(schedule.scopes.size() == workload.tasks.size())
+    {
+        return;
+    }
+    schedule.scopes.resize(workload.tasks.size());
+    for(size_t i = 0; i < workload.tasks.size(); ++i)
+    {
+        const INode *node  = workload.tasks[i].node;
+        schedule.scopes[i] = (node != nullptr && !node->name().empty()) ? node->name() : "graph_task";
+    }
+}
+
+/** Execute the workload's tasks respecting data dependencies, running independent branches concurrently.
+ *
+ * Tasks become ready once all the tasks producing their inputs have completed; ready tasks are
+ * dispatched to a small pool of dispatcher threads. Each task still parallelises internally
+ * through the kernel scheduler, so the dispatcher pool is kept small.
+ *
+ * @param[in] workload Workload whose tasks to execute
+ */
+void call_tasks_parallel(ExecutionWorkload &workload)
+{
+    const unsigned int num_tasks = workload.tasks.size();
+
+    // Build the dispatch schedule on the first frame; subsequent frames only reset the
+    // mutable pending counts and the ready queue, reusing their storage
+    TaskSchedule &schedule = workload.schedule;
+    if(!schedule.valid)
+    {
+        const std::vector<std::set<unsigned int>> dependencies = collect_task_dependencies(workload);
+        schedule.successors.assign(num_tasks, {});
+        schedule.initial_pending.assign(num_tasks, 0);
+        schedule.initial_ready.clear();
+        for(unsigned int i = 0; i < num_tasks; ++i)
+        {
+            const std::set<unsigned int> &deps = dependencies[i];
+            schedule.initial_pending[i] = deps.size();
+            for(unsigned int d : deps)
+            {
+                schedule.successors[d].push_back(i);
+            }
+            if(deps.empty())
+            {
+                schedule.initial_ready.push_back(i);
+            }
+        }
+        schedule.pending.reserve(num_tasks);
+        schedule.ready.reserve(num_tasks);
+        schedule.valid = true;
+    }
+    resolve_task_scopes(workload);
+    schedule.pending.assign(std::begin(schedule.initial_pending), std::end(schedule.initial_pending));
+    schedule.ready.assign(std::begin(schedule.initial_ready), std::end(schedule.initial_ready));
+
+    std::vector<unsigned int> &num_pending = schedule.pending;
+    std::vector<unsigned int> &ready       = schedule.ready;
+
+    std::mutex              m;
+    std::condition_variable cv;
+    unsigned int            completed = 0;
+    std::exception_ptr      eptr      = nullptr;
+
+    auto worker = [&]()
+    {
+        std::unique_lock<std::mutex> lock(m);
+        while(true)
+        {
+            cv.wait(lock, [&]
+            {
+                return !ready.empty() || completed == num_tasks || eptr != nullptr;
+            });
+            if(ready.empty() || eptr != nullptr)
+            {
+                break;
+            }
+            const unsigned int idx = ready.back();
+            ready.pop_back();
+            lock.unlock();
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+            try
+            {
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+                utils::ScopedAllocationGuard alloc_guard(schedule.scopes[idx].c_str());
+                workload.tasks[idx]();
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+            }
+            catch(...)
+            {
+                lock.lock();
+                eptr = std::current_exception();
+                cv.notify_all();
+                break;
+            }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+            lock.lock();
+            ++completed;
+            for(unsigned int s : schedule.successors[idx])
+            {
+                if(--num_pending[s] == 0)
+                {
+                    ready.push_back(s);
+                }
+            }
+            cv.notify_all();
+        }
+    };
+
+    // The calling thread acts as one of the dispatchers
+    const unsigned int num_dispatchers = std::min(num_tasks, std::max(2u, std::thread::hardware_concurrency() / 2));
+    std::vector<std::thread> dispatchers;
+    for(unsigned int i = 1; i < num_dispatchers; ++i)
+    {
+        dispatchers.emplace_back(worker);
+    }
+    worker();
+    for(auto &t : dispatchers)
+    {
+        t.join();
+    }
+
+    if(eptr != nullptr)
+    {
+        std::rethrow_exception(eptr);
+    }
+}
+} // namespace
+void validate_all_nodes(Graph &g, StartupProfile *profile)
 {
     auto &nodes = g.nodes();
 
     // Create tasks
     for(auto &node : nodes)
     {
-        if(node != nullptr)
+        // Transition nodes are backend agnostic and are not created through a backend factory
+        if(node != nullptr && node->type() != NodeType::TransitionLayer)
         {
             Target                    assigned_target = node->assigned_target();
             backends::IDeviceBackend &backend         = backends::BackendRegistry::get().get_backend(assigned_target);
+            const auto                start           = std::chrono::steady_clock::now();
             Status                    status          = backend.validate_node(*node);
+            if(profile != nullptr)
+            {
+                const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+                profile->nodes[node->id()].validate_ns += elapsed.count();
+                profile->validate_total_ns += elapsed.count();
+            }
             ARM_COMPUTE_ERROR_ON_MSG(!bool(status), status.error_description().c_str());
         }
     }
@@ -130,7 +351,7 @@ void allocate_all_tensors(Graph &g)
     }
 }
 
-ExecutionWorkload configure_all_nodes(Graph &g, GraphContext &ctx, const std::vector<NodeID> &node_order)
+ExecutionWorkload configure_all_nodes(Graph &g, GraphContext &ctx, const std::vector<NodeID> &node_order, StartupProfile *profile)
 {
     ExecutionWorkload workload;
     workload.graph = &g;
@@ -139,15 +360,172 @@ ExecutionWorkload configure_all_nodes(Graph &g, GraphContext &ctx, const std::ve
     // Reserve memory for tasks
     workload.tasks.reserve(node_order.size());
 
-    // Create tasks
+    // Group the nodes to configure by assigned target. Nodes of distinct targets touch
+    // disjoint backend state (kernel library, memory and weights managers of the target),
+    // so their configuration can proceed concurrently. Nodes within one target have to
+    // stay sequential, as function configuration registers with the target's lifetime and
+    // weights managers in order.
+    std::map<Target, std::vector<NodeID>> nodes_per_target;
+    for(auto &node_id : node_order)
+    {
+        auto node = g.node(node_id);
+        if(node != nullptr && node->type() != NodeType::TransitionLayer)
+        {
+            nodes_per_target[node->assigned_target()].push_back(node_id);
+        }
+    }
+
+    // Function scratch only joins the cross-layer analysis when the managers involved are
+    // enabled and execution stays sequential; concurrent tasks would otherwise time-share
+    // scratch that the serial lifetime replay considers disjoint
+    const bool record_scratch_windows = ctx.config().use_shared_function_scratch && ctx.config().use_function_memory_manager
+                                        && ctx.config().use_transition_memory_manager && !ctx.config().use_parallel_dispatch && !ctx.config().use_pipelined_execution;
+
+    struct TargetConfigureResults
+    {
+        std::vector<std::pair<NodeID, std::unique_ptr<IFunction>>> functions       = {};
+        std::map<NodeID, std::pair<size_t, size_t>>                scratch_windows = {};
+        std::map<NodeID, uint64_t>                                 configure_ns    = {};
+    };
+
+    const bool record_configure_times = (profile != nullptr);
+
+    std::map<NodeID, std::unique_ptr<IFunction>> configured_functions;
+
+    auto record_configure_profile = [profile](const TargetConfigureResults &results)
+    {
+        if(profile == nullptr)
+        {
+            return;
+        }
+        for(const auto &time : results.configure_ns)
+        {
+            profile->nodes[time.first].configure_ns += time.second;
+            profile->configure_total_ns += time.second;
+        }
+    };
+
+    auto configure_target_nodes = [&g, &ctx, record_scratch_windows, record_configure_times](const std::vector<NodeID> &target_nodes)
+    {
+        TargetConfigureResults results;
+        results.functions.reserve(target_nodes.size());
+
+        // Bracket each configuration with the intra lifetime serial, so the scratch the
+        // function registers can later be attributed to its node
+        ISimpleLifetimeManager *intra_lm = nullptr;
+        if(record_scratch_windows && !target_nodes.empty())
+        {
+            auto mm  = backends::get_memory_manager(ctx, g.node(target_nodes.front())->assigned_target());
+            intra_lm = (mm != nullptr) ? utils::cast::polymorphic_downcast<ISimpleLifetimeManager *>(mm->lifetime_manager()) : nullptr;
+        }
+
+        for(auto &node_id : target_nodes)
+        {
+            INode                     *node    = g.node(node_id);
+            backends::IDeviceBackend &backend = backends::BackendRegistry::get().get_backend(node->assigned_target());
+            const size_t serial_before         = (intra_lm != nullptr) ? intra_lm->lifetime_serial() : 0;
+            const auto   start                 = std::chrono::steady_clock::now();
+            results.functions.emplace_back(node_id, backend.configure_node(*node, ctx));
+            if(record_configure_times)
+            {
+                results.configure_ns[node_id] = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+            }
+            if(intra_lm != nullptr)
+            {
+                results.scratch_windows[node_id] = std::make_pair(serial_before, intra_lm->lifetime_serial());
+            }
+        }
+        return results;
+    };
+
+    if(nodes_per_target.size() > 1)
+    {
+        // Configure the nodes of each secondary target on its own thread, keeping the
+        // first target on the calling thread
+        std::vector<std::thread>            worker_threads;
+        std::vector<TargetConfigureResults> worker_results(nodes_per_target.size() - 1);
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        std::vector<std::exception_ptr> worker_exceptions(nodes_per_target.size() - 1);
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+
+        auto   target_it  = std::next(nodes_per_target.begin());
+        size_t worker_idx = 0;
+        for(; target_it != nodes_per_target.end(); ++target_it, ++worker_idx)
+        {
+            const std::vector<NodeID> *target_nodes = &target_it->second;
+            worker_threads.emplace_back([&, worker_idx, target_nodes]()
+            {
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+                try
+                {
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+                    worker_results[worker_idx] = configure_target_nodes(*target_nodes);
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+                }
+                catch(...)
+                {
+                    worker_exceptions[worker_idx] = std::current_exception();
+                }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+            });
+        }
+
+        auto main_results = configure_target_nodes(nodes_per_target.begin()->second);
+
+        for(auto &thread : worker_threads)
+        {
+            thread.join();
+        }
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        for(auto &exception : worker_exceptions)
+        {
+            if(exception != nullptr)
+            {
+                std::rethrow_exception(exception);
+            }
+        }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+
+        for(auto &function : main_results.functions)
+        {
+            configured_functions[function.first] = std::move(function.second);
+        }
+        workload.scratch_windows.insert(std::begin(main_results.scratch_windows), std::end(main_results.scratch_windows));
+        record_configure_profile(main_results);
+        for(auto &results : worker_results)
+        {
+            for(auto &function : results.functions)
+            {
+                configured_functions[function.first] = std::move(function.second);
+            }
+            workload.scratch_windows.insert(std::begin(results.scratch_windows), std::end(results.scratch_windows));
+            record_configure_profile(results);
+        }
+    }
+    else if(!nodes_per_target.empty())
+    {
+        auto results = configure_target_nodes(nodes_per_target.begin()->second);
+        for(auto &function : results.functions)
+        {
+            configured_functions[function.first] = std::move(function.second);
+        }
+        workload.scratch_windows = std::move(results.scratch_windows);
+        record_configure_profile(results);
+    }
+
+    // Create tasks in execution order
     for(auto &node_id : node_order)
     {
         auto node = g.node(node_id);
         if(node != nullptr)
         {
-            Target                     assigned_target = node->assigned_target();
-            backends::IDeviceBackend &backend         = backends::BackendRegistry::get().get_backend(assigned_target);
-            std::unique_ptr<IFunction> func            = backend.configure_node(*node, ctx);
+            // Transition nodes copy across targets through host memory and bypass the backend factories
+            if(node->type() == NodeType::TransitionLayer)
+            {
+                workload.tasks.emplace_back(ExecutionTask(create_transition_function(*node), node));
+                continue;
+            }
+            std::unique_ptr<IFunction> func = std::move(configured_functions[node_id]);
             if(func != nullptr || is_utility_node(node))
             {
                 workload.tasks.emplace_back(ExecutionTask(std::move(func), node));
@@ -173,6 +551,75 @@ ExecutionWorkload configure_all_nodes(Graph &g, GraphContext &ctx, const std::ve
     return workload;
 }
 
+void group_sibling_consumer_tasks(ExecutionWorkload &workload)
+{
+    const unsigned int num_tasks = workload.tasks.size();
+    if(num_tasks < 2)
+    {
+        return;
+    }
+
+    const std::vector<std::set<unsigned int>> dependencies = collect_task_dependencies(workload);
+
+    // Greedy list scheduling: among the ready tasks always emit the one whose inputs were
+    // produced earliest, breaking ties by original position. Consumers sharing a producer all
+    // become ready at the producer's position and thus run consecutively right after it; a
+    // chain of tasks with a single consumer each keeps its original order.
+    std::vector<std::vector<unsigned int>> successors(num_tasks);
+    std::vector<unsigned int>              num_pending(num_tasks, 0);
+    for(unsigned int i = 0; i < num_tasks; ++i)
+    {
+        num_pending[i] = dependencies[i].size();
+        for(unsigned int d : dependencies[i])
+        {
+            successors[d].push_back(i);
+        }
+    }
+
+    // Ready tasks ordered by (position of the last produced input, original position).
+    // The first component is final once a task becomes ready, so the set order is stable.
+    std::set<std::pair<unsigned int, unsigned int>> ready;
+    std::vector<unsigned int>                       emitted_position(num_tasks, 0);
+    for(unsigned int i = 0; i < num_tasks; ++i)
+    {
+        if(num_pending[i] == 0)
+        {
+            ready.emplace(0, i);
+        }
+    }
+
+    std::vector<unsigned int> new_order;
+    new_order.reserve(num_tasks);
+    while(!ready.empty())
+    {
+        const unsigned int idx = ready.begin()->second;
+        ready.erase(ready.begin());
+        emitted_position[idx] = new_order.size();
+        new_order.push_back(idx);
+        for(unsigned int s : successors[idx])
+        {
+            if(--num_pending[s] == 0)
+            {
+                unsigned int last_input_position = 0;
+                for(unsigned int d : dependencies[s])
+                {
+                    last_input_position = std::max(last_input_position, emitted_position[d]);
+                }
+                ready.emplace(last_input_position, s);
+            }
+        }
+    }
+    ARM_COMPUTE_ERROR_ON_MSG(new_order.size() != num_tasks, "Could not reschedule all tasks!");
+
+    std::vector<ExecutionTask> reordered_tasks;
+    reordered_tasks.reserve(num_tasks);
+    for(unsigned int idx : new_order)
+    {
+        reordered_tasks.push_back(std::move(workload.tasks[idx]));
+    }
+    workload.tasks = std::move(reordered_tasks);
+}
+
 void release_unused_tensors(Graph &g)
 {
     for(auto &tensor : g.tensors())
@@ -194,11 +641,118 @@ void call_all_const_node_accessors(Graph &g)
 {
     auto &nodes = g.nodes();
 
+    // Host tensors are filled by plain reads and copies and can load concurrently;
+    // device tensors map and unmap a command queue and stay on the calling thread
+    std::vector<Tensor *> host_tensors;
+    std::vector<Tensor *> device_tensors;
     for(auto &node : nodes)
     {
         if(node != nullptr && node->type() == NodeType::Const)
         {
-            call_tensor_accessor(node->output(0));
+            Tensor *tensor = node->output(0);
+            if(tensor != nullptr && tensor->desc().target == Target::NEON)
+            {
+                host_tensors.push_back(tensor);
+            }
+            else
+            {
+                device_tensors.push_back(tensor);
+            }
+        }
+    }
+
+    if(host_tensors.size() > 1)
+    {
+        // Overlap the file I/O and copies of the weight loaders across threads, so the
+        // load is bound by storage bandwidth instead of a single read stream
+        std::atomic<unsigned int> next_tensor(0);
+        std::mutex                exception_mutex;
+        std::exception_ptr        eptr = nullptr;
+
+        auto worker = [&]()
+        {
+            for(unsigned int idx = next_tensor++; idx < host_tensors.size(); idx = next_tensor++)
+            {
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+                try
+                {
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+                    call_tensor_accessor(host_tensors[idx]);
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+                }
+                catch(...)
+                {
+                    std::lock_guard<std::mutex> lock(exception_mutex);
+                    if(eptr == nullptr)
+                    {
+                        eptr = std::current_exception();
+                    }
+                }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+            }
+        };
+
+        // The calling thread acts as one of the loaders
+        const unsigned int num_loaders = std::min<unsigned int>(host_tensors.size(), std::max(2u, std::thread::hardware_concurrency() / 2));
+        std::vector<std::thread> loaders;
+        for(unsigned int i = 1; i < num_loaders; ++i)
+        {
+            loaders.emplace_back(worker);
+        }
+        worker();
+        for(auto &t : loaders)
+        {
+            t.join();
+        }
+
+        if(eptr != nullptr)
+        {
+            std::rethrow_exception(eptr);
+        }
+    }
+    else if(!host_tensors.empty())
+    {
+        call_tensor_accessor(host_tensors.front());
+    }
+
+    for(auto *tensor : device_tensors)
+    {
+        call_tensor_accessor(tensor);
+    }
+}
+
+void deduplicate_const_tensors(Graph &g)
+{
+    for(auto &node : g.nodes())
+    {
+        if(node == nullptr || node->type() != NodeType::Const)
+        {
+            continue;
+        }
+
+        Tensor *tensor = node->output(0);
+        if(tensor == nullptr || tensor->desc().target != Target::NEON || tensor->handle() == nullptr)
+        {
+            continue;
+        }
+
+        // Only dense host tensors are shared: padded buffers hash their uninitialized
+        // border bytes and would never match
+        arm_compute::ITensor &backend_tensor = tensor->handle()->tensor();
+        uint8_t              *buffer         = backend_tensor.buffer();
+        const size_t          size           = backend_tensor.info()->total_size();
+        if(buffer == nullptr || size == 0 || backend_tensor.info()->has_padding())
+        {
+            continue;
+        }
+
+        const void *shared = ConstTensorStore::get().deduplicate(buffer, size);
+        if(shared != buffer)
+        {
+            auto *cpu_tensor = utils::cast::polymorphic_downcast<arm_compute::Tensor *>(&backend_tensor);
+            cpu_tensor->allocator()->free();
+            cpu_tensor->allocator()->import_memory(const_cast<void *>(shared));
+            ARM_COMPUTE_LOG_GRAPH_VERBOSE("Const tensor of node with ID : " << node->id() << " shares stored contents (" << size << " bytes)" << std::endl);
         }
     }
 }
@@ -214,14 +768,108 @@ bool call_all_input_node_accessors(ExecutionWorkload &workload)
     return is_valid;
 }
 
-void prepare_all_tasks(ExecutionWorkload &workload)
+void prepare_all_tasks(ExecutionWorkload &workload, StartupProfile *profile)
 {
     ARM_COMPUTE_ERROR_ON(workload.graph == nullptr);
-    for(auto &task : workload.tasks)
+
+    // Weight reshapes and pretransposes of different nodes are independent: host tasks
+    // run their prepare concurrently (kernel runs serialize inside the CPU scheduler and
+    // the weights manager is thread-safe). Device tasks stay on the calling thread as
+    // their prepare enqueues work on the shared command queue.
+    std::vector<size_t> host_tasks;
+    std::vector<size_t> device_tasks;
+    for(size_t i = 0; i < workload.tasks.size(); ++i)
+    {
+        auto &task = workload.tasks[i];
+        if(task.node != nullptr && task.node->assigned_target() == Target::NEON)
+        {
+            host_tasks.push_back(i);
+        }
+        else
+        {
+            device_tasks.push_back(i);
+        }
+    }
+
+    std::vector<uint64_t> elapsed_ns(workload.tasks.size(), 0);
+    auto                  prepare_task = [&](size_t idx)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        workload.tasks[idx].prepare();
+        elapsed_ns[idx] = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    if(host_tasks.size() > 1)
+    {
+        std::atomic<unsigned int> next_task(0);
+        std::mutex                exception_mutex;
+        std::exception_ptr        eptr = nullptr;
+
+        auto worker = [&]()
+        {
+            for(unsigned int idx = next_task++; idx < host_tasks.size(); idx = next_task++)
+            {
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+                try
+                {
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+                    prepare_task(host_tasks[idx]);
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+                }
+                catch(...)
+                {
+                    std::lock_guard<std::mutex> lock(exception_mutex);
+                    if(eptr == nullptr)
+                    {
+                        eptr = std::current_exception();
+                    }
+                }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+            }
+        };
+
+        // The calling thread acts as one of the workers
+        const unsigned int num_workers = std::min<unsigned int>(host_tasks.size(), std::max(2u, std::thread::hardware_concurrency() / 2));
+        std::vector<std::thread> workers;
+        for(unsigned int i = 1; i < num_workers; ++i)
+        {
+            workers.emplace_back(worker);
+        }
+        worker();
+        for(auto &t : workers)
+        {
+            t.join();
+        }
+
+        if(eptr != nullptr)
+        {
+            std::rethrow_exception(eptr);
+        }
+        release_unused_tensors(*workload.graph);
+    }
+    else if(!host_tasks.empty())
     {
-        task.prepare();
+        prepare_task(host_tasks.front());
         release_unused_tensors(*workload.graph);
     }
+
+    for(size_t idx : device_tasks)
+    {
+        prepare_task(idx);
+        release_unused_tensors(*workload.graph);
+    }
+
+    if(profile != nullptr)
+    {
+        for(size_t i = 0; i < workload.tasks.size(); ++i)
+        {
+            if(workload.tasks[i].node != nullptr)
+            {
+                profile->nodes[workload.tasks[i].node->id()].prepare_ns += elapsed_ns[i];
+                profile->prepare_total_ns += elapsed_ns[i];
+            }
+        }
+    }
 }
 
 void call_all_tasks(ExecutionWorkload &workload)
@@ -237,10 +885,270 @@ void call_all_tasks(ExecutionWorkload &workload)
         }
     }
 
-    // Execute tasks
+    // Execute tasks, concurrently across independent branches if requested. Each task runs
+    // under an allocation guard named after its node, so run-phase heap allocations are
+    // attributed in the guarded builds.
+    if(workload.ctx->config().use_parallel_dispatch)
+    {
+        call_tasks_parallel(workload);
+    }
+    else
+    {
+        resolve_task_scopes(workload);
+        for(size_t i = 0; i < workload.tasks.size(); ++i)
+        {
+            utils::ScopedAllocationGuard alloc_guard(workload.schedule.scopes[i].c_str());
+            workload.tasks[i]();
+        }
+    }
+
+    // Release memory for the transition buffers
+    for(auto &mm_ctx : workload.ctx->memory_managers())
+    {
+        if(mm_ctx.second.cross_group != nullptr)
+        {
+            mm_ctx.second.cross_group->release();
+        }
+    }
+}
+
+void call_all_tasks_and_collect_statistics(ExecutionWorkload &workload, CalibrationTable &table)
+{
+    ARM_COMPUTE_ERROR_ON(workload.ctx == nullptr);
+
+    // Acquire memory for the transition buffers
+    for(auto &mm_ctx : workload.ctx->memory_managers())
+    {
+        if(mm_ctx.second.cross_group != nullptr)
+        {
+            mm_ctx.second.cross_group->acquire();
+        }
+    }
+
+    // Execute sequentially and profile each node's outputs while they are still live
     for(auto &task : workload.tasks)
     {
         task();
+        table.update(*task.node);
+    }
+
+    // Release memory for the transition buffers
+    for(auto &mm_ctx : workload.ctx->memory_managers())
+    {
+        if(mm_ctx.second.cross_group != nullptr)
+        {
+            mm_ctx.second.cross_group->release();
+        }
+    }
+}
+
+void call_all_tasks_and_time(ExecutionWorkload &workload, std::map<NodeID, NodeExecutionTime> &timings)
+{
+    ARM_COMPUTE_ERROR_ON(workload.ctx == nullptr);
+
+    // Acquire memory for the transition buffers
+    for(auto &mm_ctx : workload.ctx->memory_managers())
+    {
+        if(mm_ctx.second.cross_group != nullptr)
+        {
+            mm_ctx.second.cross_group->acquire();
+        }
+    }
+
+    // Execute sequentially so each task's wall time is attributable to its node
+    for(auto &task : workload.tasks)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        task();
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+        NodeExecutionTime &timing = timings[task.node->id()];
+        timing.total_ns += elapsed.count();
+        ++timing.runs;
+    }
+
+    // Release memory for the transition buffers
+    for(auto &mm_ctx : workload.ctx->memory_managers())
+    {
+        if(mm_ctx.second.cross_group != nullptr)
+        {
+            mm_ctx.second.cross_group->release();
+        }
+    }
+}
+
+void call_all_tasks_with_budget(ExecutionWorkload &workload, ExecutionBudget &budget)
+{
+    ARM_COMPUTE_ERROR_ON(workload.ctx == nullptr);
+
+    // Acquire memory for the transition buffers
+    for(auto &mm_ctx : workload.ctx->memory_managers())
+    {
+        if(mm_ctx.second.cross_group != nullptr)
+        {
+            mm_ctx.second.cross_group->acquire();
+        }
+    }
+
+    const size_t num_tasks = workload.tasks.size();
+    const bool   primed    = !budget.avg_task_ns.empty();
+    budget.avg_task_ns.resize(num_tasks, 0);
+
+    // Remaining work from each task to the end, estimated from the smoothed measured times
+    std::vector<uint64_t> remaining_ns(num_tasks + 1, 0);
+    for(size_t i = num_tasks; i > 0; --i)
+    {
+        remaining_ns[i - 1] = remaining_ns[i] + budget.avg_task_ns[i - 1];
+    }
+
+    const auto frame_start   = std::chrono::steady_clock::now();
+    bool       frame_degraded = false;
+
+    for(size_t i = 0; i < num_tasks; ++i)
+    {
+        ExecutionTask &task = workload.tasks[i];
+
+        // Project the frame's finish time; on overrun let the hook shed the task. The priming
+        // frame has no measurements yet and always runs in full.
+        if(primed && budget.hook && task.node != nullptr)
+        {
+            const auto     elapsed_ns   = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - frame_start).count());
+            const uint64_t projected_ns = elapsed_ns + remaining_ns[i];
+            if(projected_ns > budget.budget_ns && budget.hook(*task.node, projected_ns - budget.budget_ns))
+            {
+                ARM_COMPUTE_LOG_GRAPH_INFO("Budget: skipping node " << task.node->name() << " (projected overrun " << (projected_ns - budget.budget_ns) << " ns)" << std::endl);
+                frame_degraded = true;
+                ++budget.skipped_tasks;
+                continue;
+            }
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        task();
+        const auto elapsed = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+
+        // Exponential smoothing keeps the estimates stable against scheduling noise while
+        // still tracking frequency or thermal drift
+        uint64_t &avg = budget.avg_task_ns[i];
+        avg           = (avg == 0) ? elapsed : (3 * avg + elapsed) / 4;
+    }
+
+    ++budget.frames;
+    if(frame_degraded)
+    {
+        ++budget.degraded;
+    }
+
+    // Release memory for the transition buffers
+    for(auto &mm_ctx : workload.ctx->memory_managers())
+    {
+        if(mm_ctx.second.cross_group != nullptr)
+        {
+            mm_ctx.second.cross_group->release();
+        }
+    }
+}
+
+void execute_workload_pipelined(ExecutionWorkload &workload)
+{
+    ARM_COMPUTE_ERROR_ON(workload.ctx == nullptr);
+    ARM_COMPUTE_ERROR_ON(workload.pipeline_stage.size() != workload.tasks.size());
+
+    // Split the task list into the stage groups
+    std::vector<unsigned int> early_tasks;
+    std::vector<unsigned int> late_tasks;
+    std::vector<unsigned int> boundary_tasks;
+    for(unsigned int i = 0; i < workload.tasks.size(); ++i)
+    {
+        switch(workload.pipeline_stage[i])
+        {
+            case 0:
+                early_tasks.push_back(i);
+                break;
+            case 1:
+                late_tasks.push_back(i);
+                break;
+            default:
+                boundary_tasks.push_back(i);
+                break;
+        }
+    }
+
+    // Acquire memory for the transition buffers once for the whole run: two frames are in
+    // flight at any time, so the buffers cannot be released between frames
+    for(auto &mm_ctx : workload.ctx->memory_managers())
+    {
+        if(mm_ctx.second.cross_group != nullptr)
+        {
+            mm_ctx.second.cross_group->acquire();
+        }
+    }
+
+    bool frame_in_flight = false;
+    while(true)
+    {
+        // Move the boundary tensors of the frame in flight across the cut before the input
+        // accessors and the early stage overwrite them
+        if(frame_in_flight)
+        {
+            for(unsigned int idx : boundary_tasks)
+            {
+                workload.tasks[idx]();
+            }
+        }
+
+        if(!call_all_input_node_accessors(workload))
+        {
+            // Drain the frame still in the pipeline
+            if(frame_in_flight)
+            {
+                for(unsigned int idx : late_tasks)
+                {
+                    workload.tasks[idx]();
+                }
+                call_all_output_node_accessors(workload);
+            }
+            break;
+        }
+
+        // Run the late stage of the previous frame concurrently with the early stage of this one
+        std::exception_ptr eptr = nullptr;
+        std::thread        early_thread([&]()
+        {
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+            try
+            {
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+                for(unsigned int idx : early_tasks)
+                {
+                    workload.tasks[idx]();
+                }
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+            }
+            catch(...)
+            {
+                eptr = std::current_exception();
+            }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+        });
+        if(frame_in_flight)
+        {
+            for(unsigned int idx : late_tasks)
+            {
+                workload.tasks[idx]();
+            }
+        }
+        early_thread.join();
+        if(eptr != nullptr)
+        {
+            std::rethrow_exception(eptr);
+        }
+
+        if(frame_in_flight && !call_all_output_node_accessors(workload))
+        {
+            break;
+        }
+        frame_in_flight = true;
     }
 
     // Release memory for the transition buffers
@@ -0,0 +1,498 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/detail/HeterogeneousPlacementHelpers.h"
+
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/Tensor.h"
+#include "arm_compute/graph/TypePrinter.h"
+#include "arm_compute/graph/Utils.h"
+#include "arm_compute/graph/algorithms/TopologicalSort.h"
+#include "arm_compute/graph/nodes/Nodes.h"
+#include "arm_compute/graph/nodes/TransitionLayerNode.h"
+#include "arm_compute/runtime/IFunction.h"
+
+#include "arm_compute/core/utils/misc/Cast.h"
+
+#include "support/MemorySupport.h"
+
+#include <algorithm>
+#include <map>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace detail
+{
+namespace
+{
+// Coarse cost model expressed in NEON-operation equivalents. The absolute values only matter
+// relative to each other: they steer which device a node lands on, not any real-time estimate.
+constexpr double cl_speedup_heavy          = 4.0;   /**< GPU advantage on compute-bound nodes */
+constexpr double cl_speedup_light          = 1.0;   /**< Memory-bound nodes gain nothing on the GPU */
+constexpr double cl_dispatch_overhead      = 2.0e5; /**< Fixed per-node kernel dispatch cost on CL */
+constexpr double transition_cost_per_byte  = 4.0;   /**< Host round-trip copy cost per boundary byte */
+constexpr double transition_fixed_cost     = 5.0e5; /**< Map/unmap and synchronization cost per boundary */
+constexpr double heavy_intensity_threshold = 16.0;  /**< Operations per output element above which a node counts as compute bound */
+} // namespace
+
+double estimate_node_cost(const INode &node)
+{
+    const Tensor *output = node.output(0);
+    if(output == nullptr)
+    {
+        return 0.0;
+    }
+    const double out_elems = output->desc().shape.total_size();
+
+    switch(node.type())
+    {
+        case NodeType::ConvolutionLayer:
+        case NodeType::DeconvolutionLayer:
+        case NodeType::DepthwiseConvolutionLayer:
+        case NodeType::FusedConvolutionBatchNormalizationLayer:
+        case NodeType::FusedDepthwiseConvolutionBatchNormalizationLayer:
+        {
+            const Tensor *weights = node.input(1);
+            if(weights == nullptr)
+            {
+                return out_elems;
+            }
+            // MACs = output elements * kernel volume * kernel depth
+            //      = output elements * weights elements / output feature maps
+            const double weights_elems = weights->desc().shape.total_size();
+            const double ofm           = std::max<double>(1.0, get_dimension_size(output->desc(), DataLayoutDimension::CHANNEL));
+            return out_elems * (weights_elems / ofm);
+        }
+        case NodeType::FullyConnectedLayer:
+        {
+            const Tensor *weights = node.input(1);
+            if(weights == nullptr)
+            {
+                return out_elems;
+            }
+            // MACs = weights elements * batch size
+            const double weights_elems = weights->desc().shape.total_size();
+            const double batches       = std::max<double>(1.0, out_elems / std::max<size_t>(1, output->desc().shape.x()));
+            return weights_elems * batches;
+        }
+        default:
+            // Element-wise and data movement nodes are memory bound: one operation per output element
+            return out_elems;
+    }
+}
+
+namespace
+{
+/** Cost of moving a tensor across the target boundary */
+double transition_cost(const Tensor *tensor)
+{
+    if(tensor == nullptr)
+    {
+        return transition_fixed_cost;
+    }
+    const double bytes = tensor->desc().shape.total_size() * data_size_from_type(tensor->desc().data_type);
+    return transition_fixed_cost + bytes * transition_cost_per_byte;
+}
+
+/** Estimated execution time of a node on a target under the cost model */
+double node_time_on_target(const INode &node, Target target, double cost)
+{
+    if(target != Target::CL)
+    {
+        return cost;
+    }
+    const Tensor *output    = node.output(0);
+    const double  out_elems = (output != nullptr) ? std::max<double>(1.0, output->desc().shape.total_size()) : 1.0;
+    const double  speedup   = (cost / out_elems >= heavy_intensity_threshold) ? cl_speedup_heavy : cl_speedup_light;
+    return cost / speedup + cl_dispatch_overhead;
+}
+
+bool is_placeable_node(const INode &node)
+{
+    switch(node.type())
+    {
+        case NodeType::Input:
+        case NodeType::Output:
+        case NodeType::Const:
+            return false;
+        default:
+            return true;
+    }
+}
+
+/** Host-side copy across a target boundary. The blocking maps synchronize with the producing
+ *  backend, so the copy always observes the completed producer output. */
+class CrossTargetTransitionFunction final : public IFunction
+{
+public:
+    CrossTargetTransitionFunction(ITensorHandle *src, ITensorHandle *dst)
+        : _src(src), _dst(dst)
+    {
+    }
+
+    // Inherited methods overridden:
+    void run() override
+    {
+        _src->map(true);
+        _dst->map(true);
+        _dst->tensor().copy_from(_src->tensor());
+        _src->unmap();
+        _dst->unmap();
+    }
+
+private:
+    ITensorHandle *_src;
+    ITensorHandle *_dst;
+};
+} // namespace
+
+bool place_nodes_heterogeneously(Graph &g, Target primary, Target secondary)
+{
+    // Schedule nodes greedily by earliest estimated finish time on two devices, charging a
+    // penalty on every input that has to cross the target boundary. Serial sections stay on
+    // the faster device; independent branches spill onto the other one.
+    const std::vector<NodeID> node_order = dfs(g);
+
+    std::vector<double>       finish_time(g.nodes().size(), 0.0);
+    std::map<Target, double>  device_available{ { primary, 0.0 }, { secondary, 0.0 } };
+    unsigned int              num_secondary = 0;
+
+    for(NodeID nid : node_order)
+    {
+        INode *node = g.node(nid);
+        if(node == nullptr || !is_placeable_node(*node))
+        {
+            continue;
+        }
+
+        const double cost        = estimate_node_cost(*node);
+        double       best_finish = 0.0;
+        Target       best_target = primary;
+
+        for(Target candidate : { primary, secondary })
+        {
+            double start = device_available[candidate];
+            for(EdgeID eid : node->input_edges())
+            {
+                const Edge *edge = g.edge(eid);
+                if(edge == nullptr || edge->producer() == nullptr || !is_placeable_node(*edge->producer()))
+                {
+                    continue;
+                }
+                double ready = finish_time[edge->producer_id()];
+                if(edge->producer()->assigned_target() != candidate)
+                {
+                    ready += transition_cost(edge->tensor());
+                }
+                start = std::max(start, ready);
+            }
+
+            const double finish = start + node_time_on_target(*node, candidate, cost);
+            if(candidate == primary || finish < best_finish)
+            {
+                best_finish = finish;
+                best_target = candidate;
+            }
+        }
+
+        node->set_assigned_target(best_target);
+        finish_time[nid]              = best_finish;
+        device_available[best_target] = best_finish;
+        if(best_target == secondary)
+        {
+            ++num_secondary;
+        }
+    }
+
+    if(num_secondary == 0)
+    {
+        return false;
+    }
+
+    // Pull inputs and constants onto the target of their consumers, and outputs onto the
+    // target of their producer, so no transition is spent on them
+    for(auto &node : g.nodes())
+    {
+        if(node == nullptr || is_placeable_node(*node))
+        {
+            continue;
+        }
+        std::map<Target, unsigned int> consumer_targets;
+        for(EdgeID eid : node->output_edges())
+        {
+            const Edge *edge = g.edge(eid);
+            if(edge != nullptr && edge->consumer() != nullptr)
+            {
+                ++consumer_targets[edge->consumer()->assigned_target()];
+            }
+        }
+        const Edge *producer_edge = node->input_edge(0);
+        if(!consumer_targets.empty())
+        {
+            const auto majority = std::max_element(consumer_targets.begin(), consumer_targets.end(),
+                                                   [](const std::pair<const Target, unsigned int> &a, const std::pair<const Target, unsigned int> &b)
+            {
+                return a.second < b.second;
+            });
+            node->set_assigned_target(majority->first);
+        }
+        else if(producer_edge != nullptr && producer_edge->producer() != nullptr)
+        {
+            node->set_assigned_target(producer_edge->producer()->assigned_target());
+        }
+    }
+
+    // Insert a transition node on every edge that still crosses the boundary. Snapshot the
+    // crossing edges first as the insertions add new edges to the graph.
+    struct BoundaryEdge
+    {
+        EdgeID eid;
+        NodeID producer;
+        size_t producer_idx;
+        NodeID consumer;
+        size_t consumer_idx;
+        Target dst_target;
+    };
+    std::vector<BoundaryEdge> boundary_edges;
+    for(auto &edge : g.edges())
+    {
+        if(edge != nullptr && edge->producer() != nullptr && edge->consumer() != nullptr
+           && edge->producer()->assigned_target() != edge->consumer()->assigned_target())
+        {
+            boundary_edges.push_back({ edge->id(), edge->producer_id(), edge->producer_idx(),
+                                       edge->consumer_id(), edge->consumer_idx(), edge->consumer()->assigned_target() });
+        }
+    }
+
+    for(const BoundaryEdge &boundary : boundary_edges)
+    {
+        const NodeID tid   = g.add_node<TransitionLayerNode>();
+        INode       *tnode = g.node(tid);
+        tnode->set_assigned_target(boundary.dst_target);
+        tnode->set_common_node_parameters(NodeParams{ g.node(boundary.producer)->name() + "_transition", boundary.dst_target });
+
+        g.remove_connection(boundary.eid);
+        g.add_connection(boundary.producer, boundary.producer_idx, tid, 0);
+        g.add_connection(tid, 0, boundary.consumer, boundary.consumer_idx);
+    }
+
+    // Re-stamp the tensor targets from their producing nodes so that each backend only
+    // creates handles for its own tensors
+    for(auto &node : g.nodes())
+    {
+        if(node == nullptr)
+        {
+            continue;
+        }
+        for(unsigned int i = 0; i < node->num_outputs(); ++i)
+        {
+            Tensor *tensor = node->output(i);
+            if(tensor != nullptr)
+            {
+                tensor->desc().target = node->assigned_target();
+            }
+        }
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_INFO("Heterogeneous placement: " << num_secondary << " nodes moved to " << secondary
+                               << ", " << boundary_edges.size() << " transitions inserted" << std::endl);
+
+    return true;
+}
+
+namespace
+{
+constexpr double cooperative_split_min_cost = 1.0e8; /**< Estimated operations above which a convolution is worth executing on both devices */
+
+bool split_convolution_node(Graph &g, NodeID nid)
+{
+    auto *conv = arm_compute::utils::cast::polymorphic_downcast<ConvolutionLayerNode *>(g.node(nid));
+
+    const Edge *input_edge   = conv->input_edge(0);
+    const Edge *weights_edge = conv->input_edge(1);
+    const Edge *bias_edge    = conv->input_edge(2);
+    if(input_edge == nullptr || input_edge->tensor() == nullptr || weights_edge == nullptr || weights_edge->tensor() == nullptr)
+    {
+        return false;
+    }
+
+    const PadStrideInfo conv_info = conv->convolution_info();
+    if(conv->num_groups() > 1 || conv->dilation() != Size2D(1U, 1U) || conv_info.stride().second != 1)
+    {
+        return false;
+    }
+
+    const TensorDescriptor &input_desc   = input_edge->tensor()->desc();
+    const TensorDescriptor &weights_desc = weights_edge->tensor()->desc();
+    const TensorDescriptor &output_desc  = conv->output(0)->desc();
+
+    const unsigned int idx_h = get_dimension_idx(input_desc.layout, DataLayoutDimension::HEIGHT);
+
+    const int hi = input_desc.shape[idx_h];
+    const int ho = output_desc.shape[idx_h];
+    const int kh = weights_desc.shape[idx_h];
+    const int pt = conv_info.pad_top();
+
+    const int m = ho / 2;
+    if(m < 1 || (ho - m) < 1)
+    {
+        return false;
+    }
+
+    // Input row ranges and paddings of the two halves; each half reads its own halo rows
+    const int top_end        = std::min(hi, m - 1 - pt + kh);
+    const int top_pad_bottom = (m - 1 - pt + kh) - top_end;
+    const int bot_start      = std::max(0, m - pt);
+    const int bot_pad_top    = std::max(0, pt - m);
+    const int bot_end        = std::min(hi, ho - 1 - pt + kh);
+    const int bot_pad_bottom = (ho - 1 - pt + kh) - bot_end;
+    if(top_end <= 0 || bot_start >= hi || top_pad_bottom < 0 || bot_pad_bottom < 0)
+    {
+        return false;
+    }
+
+    const PadStrideInfo top_info(conv_info.stride().first, 1, conv_info.pad_left(), conv_info.pad_right(), pt, top_pad_bottom, conv_info.round());
+    const PadStrideInfo bot_info(conv_info.stride().first, 1, conv_info.pad_left(), conv_info.pad_right(), bot_pad_top, bot_pad_bottom, conv_info.round());
+
+    // Slice coordinates covering the full extent of every dimension but the height
+    Coordinates starts_top, ends_top, starts_bot, ends_bot;
+    for(unsigned int d = 0; d < input_desc.shape.num_dimensions(); ++d)
+    {
+        starts_top.set(d, 0);
+        ends_top.set(d, input_desc.shape[d]);
+        starts_bot.set(d, 0);
+        ends_bot.set(d, input_desc.shape[d]);
+    }
+    ends_top.set(idx_h, top_end);
+    starts_bot.set(idx_h, bot_start);
+
+    // Snapshot the node context before the surgery
+    const NodeID input_id    = input_edge->producer_id();
+    const size_t input_idx   = input_edge->producer_idx();
+    const NodeID weights_id  = weights_edge->producer_id();
+    const size_t weights_idx = weights_edge->producer_idx();
+    const bool   has_bias    = (bias_edge != nullptr);
+    const NodeID bias_id     = has_bias ? bias_edge->producer_id() : EmptyNodeID;
+    const size_t bias_idx    = has_bias ? bias_edge->producer_idx() : 0;
+
+    const ConvolutionMethod   method         = conv->convolution_method();
+    const FastMathHint        fast_math_hint = conv->fast_math_hint();
+    const ActivationLayerInfo act_info       = conv->fused_activation();
+    const QuantizationInfo    out_qinfo      = output_desc.quant_info;
+    const Target              target         = conv->assigned_target();
+    const std::string         name           = conv->name();
+
+    std::vector<NodeIdxPair> driving_nodes = get_driving_nodes(*conv);
+    auto                     accessor      = conv->output(0)->extract_accessor();
+
+    g.remove_node(nid);
+
+    const NodeID slice_top_id = g.add_node<SliceLayerNode>(starts_top, ends_top);
+    const NodeID slice_bot_id = g.add_node<SliceLayerNode>(starts_bot, ends_bot);
+    const NodeID conv_top_id  = g.add_node<ConvolutionLayerNode>(top_info, 1, method, fast_math_hint, out_qinfo, Size2D(1U, 1U));
+    const NodeID conv_bot_id  = g.add_node<ConvolutionLayerNode>(bot_info, 1, method, fast_math_hint, out_qinfo, Size2D(1U, 1U));
+    const NodeID concat_id    = g.add_node<ConcatenateLayerNode>(2, descriptors::ConcatLayerDescriptor(DataLayoutDimension::HEIGHT, out_qinfo));
+
+    g.node(slice_top_id)->set_common_node_parameters(NodeParams{ name + "_slice_top", target });
+    g.node(slice_bot_id)->set_common_node_parameters(NodeParams{ name + "_slice_bottom", target });
+    g.node(conv_top_id)->set_common_node_parameters(NodeParams{ name + "_top", target });
+    g.node(conv_bot_id)->set_common_node_parameters(NodeParams{ name + "_bottom", target });
+    g.node(concat_id)->set_common_node_parameters(NodeParams{ name + "_concat", target });
+
+    arm_compute::utils::cast::polymorphic_downcast<ConvolutionLayerNode *>(g.node(conv_top_id))->set_fused_activation(act_info);
+    arm_compute::utils::cast::polymorphic_downcast<ConvolutionLayerNode *>(g.node(conv_bot_id))->set_fused_activation(act_info);
+
+    g.add_connection(input_id, input_idx, slice_top_id, 0);
+    g.add_connection(input_id, input_idx, slice_bot_id, 0);
+    g.add_connection(slice_top_id, 0, conv_top_id, 0);
+    g.add_connection(slice_bot_id, 0, conv_bot_id, 0);
+    g.add_connection(weights_id, weights_idx, conv_top_id, 1);
+    g.add_connection(weights_id, weights_idx, conv_bot_id, 1);
+    if(has_bias)
+    {
+        g.add_connection(bias_id, bias_idx, conv_top_id, 2);
+        g.add_connection(bias_id, bias_idx, conv_bot_id, 2);
+    }
+    g.add_connection(conv_top_id, 0, concat_id, 0);
+    g.add_connection(conv_bot_id, 0, concat_id, 1);
+
+    for(auto &driving_node : driving_nodes)
+    {
+        g.add_connection(concat_id, 0, driving_node.node_id, driving_node.index);
+    }
+    g.node(concat_id)->output(0)->set_accessor(std::move(accessor));
+
+    return true;
+}
+} // namespace
+
+unsigned int split_heavy_nodes_cooperatively(Graph &g)
+{
+    // Snapshot the candidates first, the surgery adds and removes nodes
+    std::vector<NodeID> candidates;
+    for(auto &node : g.nodes())
+    {
+        if(node == nullptr || node->type() != NodeType::ConvolutionLayer || node->output(0) == nullptr)
+        {
+            continue;
+        }
+        const double cost      = estimate_node_cost(*node);
+        const double out_elems = std::max<double>(1.0, node->output(0)->desc().shape.total_size());
+        if(cost >= cooperative_split_min_cost && (cost / out_elems) >= heavy_intensity_threshold)
+        {
+            candidates.push_back(node->id());
+        }
+    }
+
+    unsigned int num_split = 0;
+    for(NodeID nid : candidates)
+    {
+        if(split_convolution_node(g, nid))
+        {
+            ++num_split;
+        }
+    }
+
+    if(num_split != 0)
+    {
+        ARM_COMPUTE_LOG_GRAPH_INFO("Cooperative split: " << num_split << " convolutions split along the output height" << std::endl);
+    }
+    return num_split;
+}
+
+std::unique_ptr<arm_compute::IFunction> create_transition_function(INode &node)
+{
+    ARM_COMPUTE_ERROR_ON(node.type() != NodeType::TransitionLayer);
+    ARM_COMPUTE_ERROR_ON(node.input(0) == nullptr || node.output(0) == nullptr);
+    ARM_COMPUTE_ERROR_ON(node.input(0)->handle() == nullptr || node.output(0)->handle() == nullptr);
+
+    return support::cpp14::make_unique<CrossTargetTransitionFunction>(node.input(0)->handle(), node.output(0)->handle());
+}
+} // namespace detail
+} // namespace graph
+} // namespace arm_compute
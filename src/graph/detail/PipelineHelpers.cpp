@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/detail/PipelineHelpers.h"
+
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/algorithms/TopologicalSort.h"
+#include "arm_compute/graph/detail/HeterogeneousPlacementHelpers.h"
+#include "arm_compute/graph/nodes/TransitionLayerNode.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace detail
+{
+namespace
+{
+bool is_stageable_node(const INode &node)
+{
+    switch(node.type())
+    {
+        case NodeType::Input:
+        case NodeType::Output:
+        case NodeType::Const:
+            return false;
+        default:
+            return true;
+    }
+}
+} // namespace
+
+std::map<NodeID, unsigned int> partition_graph_for_pipelining(Graph &g)
+{
+    const std::vector<NodeID> node_order = dfs(g);
+
+    // Total estimated cost of the graph
+    double total_cost = 0.0;
+    for(NodeID nid : node_order)
+    {
+        const INode *node = g.node(nid);
+        if(node != nullptr && is_stageable_node(*node))
+        {
+            total_cost += estimate_node_cost(*node);
+        }
+    }
+    if(total_cost <= 0.0)
+    {
+        return {};
+    }
+
+    // Cut the topological order where the cumulative cost reaches half of the total. The
+    // prefix property of the order guarantees that no edge runs from the late stage back
+    // into the early one.
+    std::map<NodeID, unsigned int> stages;
+    double                         accumulated_cost = 0.0;
+    unsigned int                   num_late         = 0;
+    for(NodeID nid : node_order)
+    {
+        INode *node = g.node(nid);
+        if(node == nullptr || !is_stageable_node(*node))
+        {
+            continue;
+        }
+        const unsigned int stage = (accumulated_cost * 2.0 < total_cost) ? 0 : 1;
+        accumulated_cost += estimate_node_cost(*node);
+        stages[nid] = stage;
+        num_late += stage;
+    }
+    if(num_late == 0 || num_late == stages.size())
+    {
+        ARM_COMPUTE_LOG_GRAPH_INFO("Pipelined execution requested but no worthwhile cut exists" << std::endl);
+        return {};
+    }
+
+    // Inputs and constants belong to the earliest stage of their consumers, outputs to the late stage
+    for(auto &node : g.nodes())
+    {
+        if(node == nullptr || is_stageable_node(*node))
+        {
+            continue;
+        }
+        unsigned int stage = (node->type() == NodeType::Output) ? 1 : 0;
+        if(node->type() != NodeType::Output)
+        {
+            unsigned int min_consumer_stage = 1;
+            for(EdgeID eid : node->output_edges())
+            {
+                const Edge *edge = g.edge(eid);
+                if(edge != nullptr && edge->consumer() != nullptr && stages.find(edge->consumer_id()) != stages.end())
+                {
+                    min_consumer_stage = std::min(min_consumer_stage, stages[edge->consumer_id()]);
+                }
+            }
+            stage = min_consumer_stage;
+        }
+        stages[node->id()] = stage;
+    }
+
+    // Double-buffer the cut: every non-constant edge crossing into the late stage gets a
+    // transition copy, so the late stage reads a stable snapshot while the early stage of
+    // the next frame overwrites the original tensors
+    struct BoundaryEdge
+    {
+        EdgeID eid;
+        NodeID producer;
+        size_t producer_idx;
+        NodeID consumer;
+        size_t consumer_idx;
+        Target dst_target;
+    };
+    std::vector<BoundaryEdge> boundary_edges;
+    for(auto &edge : g.edges())
+    {
+        if(edge == nullptr || edge->producer() == nullptr || edge->consumer() == nullptr)
+        {
+            continue;
+        }
+        if(edge->producer()->type() == NodeType::Const)
+        {
+            continue;
+        }
+        const auto producer_stage = stages.find(edge->producer_id());
+        const auto consumer_stage = stages.find(edge->consumer_id());
+        if(producer_stage != stages.end() && consumer_stage != stages.end() && producer_stage->second < consumer_stage->second)
+        {
+            boundary_edges.push_back({ edge->id(), edge->producer_id(), edge->producer_idx(),
+                                       edge->consumer_id(), edge->consumer_idx(), edge->consumer()->assigned_target() });
+        }
+    }
+
+    for(const BoundaryEdge &boundary : boundary_edges)
+    {
+        const NodeID tid   = g.add_node<TransitionLayerNode>();
+        INode       *tnode = g.node(tid);
+        tnode->set_assigned_target(boundary.dst_target);
+        tnode->set_common_node_parameters(NodeParams{ g.node(boundary.producer)->name() + "_pipeline_boundary", boundary.dst_target });
+        stages[tid] = PipelineBoundaryStage;
+
+        g.remove_connection(boundary.eid);
+        g.add_connection(boundary.producer, boundary.producer_idx, tid, 0);
+        g.add_connection(tid, 0, boundary.consumer, boundary.consumer_idx);
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_INFO("Pipelined execution: " << (stages.size() - num_late - boundary_edges.size()) << " early nodes, "
+                               << num_late << " late nodes, " << boundary_edges.size() << " boundary copies" << std::endl);
+
+    return stages;
+}
+} // namespace detail
+} // namespace graph
+} // namespace arm_compute
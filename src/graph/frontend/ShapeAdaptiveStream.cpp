@@ -0,0 +1,293 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/frontend/ShapeAdaptiveStream.h"
+
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/PassManager.h"
+#include "arm_compute/graph/Utils.h"
+#include "arm_compute/graph/frontend/ILayer.h"
+#include "support/MemorySupport.h"
+#include "support/StringSupport.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace frontend
+{
+namespace
+{
+/** Formats a tensor shape as a compact string usable in a graph name */
+std::string shape_to_string(const TensorShape &shape)
+{
+    std::string str;
+    for(size_t d = 0; d < shape.num_dimensions(); ++d)
+    {
+        if(d != 0)
+        {
+            str += "x";
+        }
+        str += support::cpp11::to_string(shape[d]);
+    }
+    return str;
+}
+} // namespace
+
+ShapeAdaptiveStream::ShapeAdaptiveStream(size_t id, std::string name, Builder builder, size_t max_cached_shapes)
+    : _name(std::move(name)), _next_graph_id(id), _builder(std::move(builder)), _max_cached_shapes(max_cached_shapes),
+      _target(Target::UNSPECIFIED), _config(), _finalized(false), _shared_weights(), _cache(), _manager()
+{
+    ARM_COMPUTE_ERROR_ON_MSG(max_cached_shapes == 0, "Workload cache capacity has to be at least one!");
+}
+
+ShapeAdaptiveStream::~ShapeAdaptiveStream()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        _stop_worker = true;
+    }
+    _cv.notify_one();
+    if(_worker.joinable())
+    {
+        _worker.join();
+    }
+}
+
+void ShapeAdaptiveStream::finalize(Target target, const GraphConfig &config)
+{
+    _target    = target;
+    _config    = config;
+    _finalized = true;
+}
+
+void ShapeAdaptiveStream::run(const TensorShape &input_shape)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!_finalized, "finalize() has to be called before run()!");
+
+    // Lookup and build stay under the lock; execution proceeds without it so that the
+    // pre-configuration worker can keep building other shapes meanwhile
+    Graph *g = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        g = find_graph(input_shape);
+        if(g == nullptr)
+        {
+            g = &build_graph(input_shape);
+        }
+    }
+    _manager.execute_graph(*g);
+}
+
+void ShapeAdaptiveStream::prefetch(const TensorShape &input_shape)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!_finalized, "finalize() has to be called before prefetch()!");
+
+    std::lock_guard<std::mutex> lock(_mtx);
+
+    // Already cached or queued: nothing to do. The lookup does not refresh the LRU
+    // position, as anticipating a shape is not using it
+    for(const auto &entry : _cache)
+    {
+        if(entry.shape == input_shape)
+        {
+            return;
+        }
+    }
+    for(const auto &shape : _prefetch_queue)
+    {
+        if(shape == input_shape)
+        {
+            return;
+        }
+    }
+
+    _prefetch_queue.push_back(input_shape);
+    if(!_worker.joinable())
+    {
+        _worker = std::thread(&ShapeAdaptiveStream::prefetch_worker, this);
+    }
+    _cv.notify_one();
+}
+
+size_t ShapeAdaptiveStream::num_cached_shapes() const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    return _cache.size();
+}
+
+Graph *ShapeAdaptiveStream::find_graph(const TensorShape &input_shape)
+{
+    // Cache lookup; a hit moves the entry to the front to keep the list LRU ordered
+    for(auto it = _cache.begin(); it != _cache.end(); ++it)
+    {
+        if(it->shape == input_shape)
+        {
+            _cache.splice(_cache.begin(), _cache, it);
+            _current = _cache.front().graph.get();
+            return _current;
+        }
+    }
+    return nullptr;
+}
+
+Graph &ShapeAdaptiveStream::build_graph(const TensorShape &input_shape)
+{
+    // Evict the least recently used entry if the cache is full, skipping the entry that
+    // may be executing right now. Releasing the workload and the entry context frees the
+    // activation memory; the transformed weights stay alive in the shared weights managers.
+    if(_cache.size() >= _max_cached_shapes)
+    {
+        auto victim = _cache.end();
+        for(auto it = _cache.rbegin(); it != _cache.rend(); ++it)
+        {
+            if(it->graph.get() != _current)
+            {
+                victim = std::next(it).base();
+                break;
+            }
+        }
+        if(victim != _cache.end())
+        {
+            ARM_COMPUTE_LOG_GRAPH_INFO("Evicting cached workload for shape " << shape_to_string(victim->shape) << std::endl);
+            _manager.invalidate_graph(*victim->graph);
+            _cache.erase(victim);
+        }
+    }
+
+    CacheEntry entry;
+    entry.shape = input_shape;
+    entry.ctx   = support::cpp14::make_unique<GraphContext>();
+    entry.ctx->set_config(_config);
+
+    // Pre-insert the shared weights managers so that the backend setup does not create
+    // fresh ones and the entry resolves its transformed weights against the shared pool
+    for(auto &wm : _shared_weights)
+    {
+        WeightsManagerContext wm_ctx;
+        wm_ctx.target = wm.first;
+        wm_ctx.wm     = wm.second;
+        entry.ctx->insert_weights_management_ctx(std::move(wm_ctx));
+    }
+
+    entry.graph = support::cpp14::make_unique<Graph>(_next_graph_id++, _name + "_" + shape_to_string(input_shape));
+
+    // Build the stream for the concrete shape on a clean slate
+    _current   = entry.graph.get();
+    _hints     = StreamHints{};
+    _tail_node = EmptyNodeID;
+    _builder(*this, input_shape);
+
+    PassManager pm = create_default_pass_manager(_target, _config);
+    _manager.finalize_graph(*entry.graph, *entry.ctx, pm, _target);
+
+    // Capture any weights managers the backend setup created so that entries built
+    // later share them
+    for(auto &wm_ctx : entry.ctx->weights_managers())
+    {
+        if(wm_ctx.second.wm != nullptr && _shared_weights.find(wm_ctx.first) == std::end(_shared_weights))
+        {
+            _shared_weights[wm_ctx.first] = wm_ctx.second.wm;
+        }
+    }
+
+    _cache.push_front(std::move(entry));
+    return *_current;
+}
+
+void ShapeAdaptiveStream::prefetch_worker()
+{
+    std::unique_lock<std::mutex> lock(_mtx);
+    while(true)
+    {
+        _cv.wait(lock, [this]
+        {
+            return _stop_worker || !_prefetch_queue.empty();
+        });
+        if(_stop_worker)
+        {
+            return;
+        }
+
+        const TensorShape shape = _prefetch_queue.front();
+        _prefetch_queue.pop_front();
+
+        // The shape may have been built by a cache miss on the request thread meanwhile
+        bool cached = false;
+        for(const auto &entry : _cache)
+        {
+            if(entry.shape == shape)
+            {
+                cached = true;
+                break;
+            }
+        }
+        if(cached)
+        {
+            continue;
+        }
+
+        ARM_COMPUTE_LOG_GRAPH_INFO("Pre-configuring workload for shape " << shape_to_string(shape) << std::endl);
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        try
+        {
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+            build_graph(shape);
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        }
+        catch(const std::exception &e)
+        {
+            // A failed speculation must not take the stream down; the shape will be
+            // built on demand (and the error surfaced) if it actually arrives
+            ARM_COMPUTE_LOG_GRAPH_INFO("Pre-configuration for shape " << shape_to_string(shape) << " failed: " << e.what() << std::endl);
+            _current = nullptr;
+        }
+        catch(...)
+        {
+            ARM_COMPUTE_LOG_GRAPH_INFO("Pre-configuration for shape " << shape_to_string(shape) << " failed" << std::endl);
+            _current = nullptr;
+        }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+    }
+}
+
+void ShapeAdaptiveStream::add_layer(ILayer &layer)
+{
+    auto nid   = layer.create_layer(*this);
+    _tail_node = nid;
+}
+
+const Graph &ShapeAdaptiveStream::graph() const
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_current == nullptr, "No graph is active!");
+    return *_current;
+}
+
+Graph &ShapeAdaptiveStream::graph()
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_current == nullptr, "No graph is active!");
+    return *_current;
+}
+} // namespace frontend
+} // namespace graph
+} // namespace arm_compute
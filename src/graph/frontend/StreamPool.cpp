@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/frontend/StreamPool.h"
+
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/PassManager.h"
+#include "arm_compute/graph/Utils.h"
+#include "arm_compute/graph/frontend/ILayer.h"
+#include "support/MemorySupport.h"
+#include "support/StringSupport.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace frontend
+{
+StreamPool::StreamPool(size_t id, std::string name, Builder builder, size_t num_replicas)
+    : _name(std::move(name)), _id(id), _builder(std::move(builder)), _num_replicas(num_replicas), _shared_weights(), _replicas(), _manager()
+{
+    ARM_COMPUTE_ERROR_ON_MSG(num_replicas == 0, "Stream pool has to hold at least one replica!");
+}
+
+void StreamPool::finalize(Target target, const GraphConfig &config)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!_replicas.empty(), "Stream pool is already finalized!");
+
+    for(size_t i = 0; i < _num_replicas; ++i)
+    {
+        Replica replica;
+        replica.ctx = support::cpp14::make_unique<GraphContext>();
+        replica.ctx->set_config(config);
+
+        // Pre-insert the weights managers of the first replica so that the backend setup
+        // does not create fresh ones and the replica resolves its transformed weights
+        // against the shared pool
+        for(auto &wm : _shared_weights)
+        {
+            WeightsManagerContext wm_ctx;
+            wm_ctx.target = wm.first;
+            wm_ctx.wm     = wm.second;
+            replica.ctx->insert_weights_management_ctx(std::move(wm_ctx));
+        }
+
+        replica.graph = support::cpp14::make_unique<Graph>(_id + i, _name + "_replica" + support::cpp11::to_string(i));
+
+        // Build the replica stream on a clean slate
+        _current   = replica.graph.get();
+        _hints     = StreamHints{};
+        _tail_node = EmptyNodeID;
+        _builder(*this);
+
+        PassManager pm = create_default_pass_manager(target, config);
+        _manager.finalize_graph(*replica.graph, *replica.ctx, pm, target);
+
+        // Capture the weights managers the backend setup created for the first replica
+        for(auto &wm_ctx : replica.ctx->weights_managers())
+        {
+            if(wm_ctx.second.wm != nullptr && _shared_weights.find(wm_ctx.first) == std::end(_shared_weights))
+            {
+                _shared_weights[wm_ctx.first] = wm_ctx.second.wm;
+            }
+        }
+
+        _replicas.emplace_back(std::move(replica));
+    }
+}
+
+void StreamPool::run(size_t replica_index)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(replica_index >= _replicas.size(), "Replica index is out of bounds!");
+    _manager.execute_graph(*_replicas[replica_index].graph);
+}
+
+size_t StreamPool::num_replicas() const
+{
+    return _replicas.size();
+}
+
+void StreamPool::add_layer(ILayer &layer)
+{
+    auto nid   = layer.create_layer(*this);
+    _tail_node = nid;
+}
+
+const Graph &StreamPool::graph() const
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_current == nullptr, "No graph is active!");
+    return *_current;
+}
+
+Graph &StreamPool::graph()
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_current == nullptr, "No graph is active!");
+    return *_current;
+}
+} // namespace frontend
+} // namespace graph
+} // namespace arm_compute
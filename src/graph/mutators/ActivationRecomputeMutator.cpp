@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/ActivationRecomputeMutator.h"
+
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/algorithms/TopologicalSort.h"
+#include "arm_compute/graph/nodes/Nodes.h"
+
+#include "arm_compute/core/utils/misc/Cast.h"
+
+#include <map>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** Create a copy of @p node with identical parameters, without connections.
+ *
+ * @return The new node's ID, or EmptyNodeID if the node type is not supported.
+ */
+NodeID clone_node(Graph &g, INode *node)
+{
+    NodeID clone_id = EmptyNodeID;
+    switch(node->type())
+    {
+        case NodeType::ActivationLayer:
+        {
+            auto *act_node = arm_compute::utils::cast::polymorphic_downcast<ActivationLayerNode *>(node);
+            clone_id       = g.add_node<ActivationLayerNode>(act_node->activation_info(), act_node->output(0)->desc().quant_info);
+            break;
+        }
+        case NodeType::ConvolutionLayer:
+        {
+            auto *conv_node = arm_compute::utils::cast::polymorphic_downcast<ConvolutionLayerNode *>(node);
+            clone_id        = g.add_node<ConvolutionLayerNode>(conv_node->convolution_info(), conv_node->num_groups(), conv_node->convolution_method(),
+                                                               conv_node->fast_math_hint(), conv_node->output(0)->desc().quant_info, conv_node->dilation());
+            auto *clone = arm_compute::utils::cast::polymorphic_downcast<ConvolutionLayerNode *>(g.node(clone_id));
+            clone->set_fused_activation(conv_node->fused_activation());
+            break;
+        }
+        case NodeType::EltwiseLayer:
+        {
+            auto *eltwise_node = arm_compute::utils::cast::polymorphic_downcast<EltwiseLayerNode *>(node);
+            const descriptors::EltwiseLayerDescriptor descriptor(eltwise_node->eltwise_operation(), eltwise_node->output_quant_info(),
+                                                                 eltwise_node->convert_policy(), eltwise_node->rounding_policy(), eltwise_node->fused_activation());
+            clone_id = g.add_node<EltwiseLayerNode>(descriptor);
+            break;
+        }
+        case NodeType::PoolingLayer:
+        {
+            auto *pool_node = arm_compute::utils::cast::polymorphic_downcast<PoolingLayerNode *>(node);
+            clone_id        = g.add_node<PoolingLayerNode>(pool_node->pooling_info());
+            break;
+        }
+        default:
+            break;
+    }
+
+    if(clone_id != EmptyNodeID)
+    {
+        NodeParams params = node->common_node_params();
+        if(!params.name.empty())
+        {
+            params.name += "_recompute";
+        }
+        g.node(clone_id)->set_common_node_parameters(params);
+    }
+
+    return clone_id;
+}
+
+/** Clone the chain of nodes producing @p node's outputs, re-using constants and inputs.
+ *
+ * @p budget bounds the total number of cloned nodes; @p memo shares clones within one chain
+ * when a node feeds several cloned consumers.
+ *
+ * @return The ID of @p node's clone, or EmptyNodeID if the chain cannot be cloned within budget.
+ */
+NodeID clone_chain(Graph &g, INode *node, unsigned int &budget, std::map<NodeID, NodeID> &memo)
+{
+    const auto it = memo.find(node->id());
+    if(it != memo.end())
+    {
+        return it->second;
+    }
+    if(budget == 0)
+    {
+        return EmptyNodeID;
+    }
+    --budget;
+
+    // Resolve every input before creating the clone, so a failed sub-chain leaves no half-wired node
+    struct InputSource
+    {
+        NodeID       node_id;
+        unsigned int output_idx;
+    };
+    std::vector<InputSource> sources;
+    for(EdgeID input_eid : node->input_edges())
+    {
+        const Edge *input_edge = g.edge(input_eid);
+        if(input_edge == nullptr || input_edge->producer() == nullptr)
+        {
+            return EmptyNodeID;
+        }
+        INode *input_producer = input_edge->producer();
+        if(input_producer->type() == NodeType::Const || input_producer->type() == NodeType::Input)
+        {
+            sources.push_back({ input_producer->id(), input_edge->producer_idx() });
+        }
+        else
+        {
+            const NodeID sub_clone = clone_chain(g, input_producer, budget, memo);
+            if(sub_clone == EmptyNodeID)
+            {
+                return EmptyNodeID;
+            }
+            sources.push_back({ sub_clone, input_edge->producer_idx() });
+        }
+    }
+
+    const NodeID clone_id = clone_node(g, node);
+    if(clone_id == EmptyNodeID)
+    {
+        return EmptyNodeID;
+    }
+    for(size_t i = 0; i < sources.size(); ++i)
+    {
+        g.add_connection(sources[i].node_id, sources[i].output_idx, clone_id, i);
+    }
+    memo[node->id()] = clone_id;
+
+    return clone_id;
+}
+} // namespace
+
+ActivationRecomputeMutator::ActivationRecomputeMutator(unsigned int span_threshold, unsigned int max_depth)
+    : _span_threshold(span_threshold), _max_depth(max_depth)
+{
+}
+
+const char *ActivationRecomputeMutator::name()
+{
+    return "ActivationRecomputeMutator";
+}
+
+IGraphMutator::MutationType ActivationRecomputeMutator::type() const
+{
+    return IGraphMutator::MutationType::IR;
+}
+
+void ActivationRecomputeMutator::mutate(Graph &g)
+{
+    // Topological position of every node, used as the lifetime span metric
+    std::map<NodeID, unsigned int> order;
+    {
+        unsigned int position = 0;
+        for(NodeID nid : dfs(g))
+        {
+            order[nid] = position++;
+        }
+    }
+
+    // Snapshot the far edges before mutating: an edge qualifies when its span exceeds the
+    // threshold and the producer also has a near consumer, so the original tensor keeps a
+    // purpose and only the far use is redirected to the recomputed copy.
+    struct FarEdge
+    {
+        EdgeID       edge_id;
+        NodeID       producer_id;
+        unsigned int producer_idx;
+        NodeID       consumer_id;
+        unsigned int consumer_idx;
+    };
+    std::vector<FarEdge> far_edges;
+    for(const auto &edge : g.edges())
+    {
+        if(edge == nullptr || edge->producer() == nullptr || edge->consumer() == nullptr)
+        {
+            continue;
+        }
+        INode *producer = edge->producer();
+        INode *consumer = edge->consumer();
+        if(producer->type() == NodeType::Const || producer->type() == NodeType::Input || consumer->type() == NodeType::Output)
+        {
+            continue;
+        }
+        if(order.find(producer->id()) == order.end() || order.find(consumer->id()) == order.end())
+        {
+            continue;
+        }
+        const unsigned int producer_pos = order[producer->id()];
+        if(order[consumer->id()] < producer_pos + _span_threshold)
+        {
+            continue;
+        }
+        bool has_near_consumer = false;
+        for(EdgeID sibling_eid : producer->output_edges())
+        {
+            const Edge *sibling = g.edge(sibling_eid);
+            if(sibling != nullptr && sibling->consumer() != nullptr && sibling->id() != edge->id()
+               && order.find(sibling->consumer_id()) != order.end()
+               && order[sibling->consumer_id()] < producer_pos + _span_threshold)
+            {
+                has_near_consumer = true;
+                break;
+            }
+        }
+        if(has_near_consumer)
+        {
+            far_edges.push_back({ edge->id(), producer->id(), edge->producer_idx(), consumer->id(), edge->consumer_idx() });
+        }
+    }
+
+    for(const FarEdge &far_edge : far_edges)
+    {
+        // Clone per far edge rather than sharing clones across edges: a shared clone would
+        // itself span the distance between its consumers and become the next long-lived tensor
+        std::map<NodeID, NodeID> memo;
+        unsigned int             budget   = _max_depth;
+        const NodeID             clone_id = clone_chain(g, g.node(far_edge.producer_id), budget, memo);
+        if(clone_id == EmptyNodeID)
+        {
+            // Drop any sub-chain clones created before the failure so no orphan work is scheduled
+            for(const auto &cloned : memo)
+            {
+                g.remove_node(cloned.second);
+            }
+            continue;
+        }
+        g.remove_connection(far_edge.edge_id);
+        g.add_connection(clone_id, far_edge.producer_idx, far_edge.consumer_id, far_edge.consumer_idx);
+
+        ARM_COMPUTE_LOG_GRAPH_INFO("Recomputing activation of node " << far_edge.producer_id
+                                   << " for far consumer " << far_edge.consumer_id
+                                   << " (" << memo.size() << " nodes cloned)" << std::endl);
+    }
+}
+} // namespace graph
+} // namespace arm_compute
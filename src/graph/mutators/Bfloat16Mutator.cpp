@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/Bfloat16Mutator.h"
+
+#include "arm_compute/graph/ITensorAccessor.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/Utils.h"
+#include "arm_compute/graph/nodes/Nodes.h"
+
+#include "arm_compute/core/utils/misc/Cast.h"
+#include "arm_compute/runtime/NEON/functions/NEDepthConvertLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "support/MemorySupport.h"
+
+#include <utility>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** Accessor that stages the wrapped FP32 weights and narrows them to BFLOAT16 at finalize */
+class Bfloat16WeightsAccessor final : public graph::ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[in] accessor Accessor filling the original FP32 weights
+     */
+    explicit Bfloat16WeightsAccessor(std::unique_ptr<graph::ITensorAccessor> accessor)
+        : _accessor(std::move(accessor))
+    {
+    }
+
+    // Inherited methods overriden:
+    bool access_tensor(ITensor &tensor) override
+    {
+        if(_accessor == nullptr)
+        {
+            return false;
+        }
+
+        // Fill a staging FP32 tensor with the original accessor and narrow it into place
+        arm_compute::Tensor staging;
+        TensorInfo          staging_info(tensor.info()->tensor_shape(), 1, DataType::F32);
+        staging_info.set_data_layout(tensor.info()->data_layout());
+        staging.allocator()->init(staging_info);
+        staging.allocator()->allocate();
+
+        const bool retval = _accessor->access_tensor(staging);
+        if(retval)
+        {
+            NEDepthConvertLayer convert;
+            convert.configure(&staging, &tensor, ConvertPolicy::SATURATE, 0);
+            convert.run();
+        }
+        return retval;
+    }
+
+private:
+    std::unique_ptr<graph::ITensorAccessor> _accessor;
+};
+
+/** Check if a convolution node can run on BFLOAT16 storage
+ *
+ * @param[in] node Node to check
+ *
+ * @return True if the node can be converted else false
+ */
+bool is_convertible_convolution(ConvolutionLayerNode *node)
+{
+    if(node->num_groups() != 1)
+    {
+        return false;
+    }
+    if(node->convolution_method() != ConvolutionMethod::Default && node->convolution_method() != ConvolutionMethod::GEMM)
+    {
+        return false;
+    }
+
+    const Edge *input_edge   = node->input_edge(0);
+    const Edge *weights_edge = node->input_edge(1);
+    if(input_edge == nullptr || weights_edge == nullptr)
+    {
+        return false;
+    }
+    // The weights are narrowed in place at finalize, so they must come from a const node with an accessor
+    if(weights_edge->producer() == nullptr || weights_edge->producer()->type() != NodeType::Const)
+    {
+        return false;
+    }
+    Tensor *weights = node->input(1);
+    if(weights->accessor() == nullptr)
+    {
+        return false;
+    }
+    return node->input(0)->desc().data_type == DataType::F32 && weights->desc().data_type == DataType::F32;
+}
+} // namespace
+
+const char *Bfloat16Mutator::name()
+{
+    return "Bfloat16Mutator";
+}
+
+IGraphMutator::MutationType Bfloat16Mutator::type() const
+{
+    return IGraphMutator::MutationType::IR;
+}
+
+void Bfloat16Mutator::mutate(Graph &g)
+{
+    const std::vector<NodeID> conv_nodes_ids = g.nodes(NodeType::ConvolutionLayer);
+    for(const auto &node_id : conv_nodes_ids)
+    {
+        auto *node = arm_compute::utils::cast::polymorphic_downcast<ConvolutionLayerNode *>(g.node(node_id));
+        if(node == nullptr || !is_convertible_convolution(node))
+        {
+            continue;
+        }
+
+        // Narrow the constant weights to bf16 storage when the accessor runs at finalize
+        Tensor *weights             = node->input(1);
+        weights->desc().data_type   = DataType::BFLOAT16;
+        auto original_accessor      = weights->extract_accessor();
+        weights->set_accessor(support::cpp14::make_unique<Bfloat16WeightsAccessor>(std::move(original_accessor)));
+
+        // Insert a boundary conversion node on the activation input
+        Edge        *input_edge   = node->input_edge(0);
+        INode       *producer     = input_edge->producer();
+        const EdgeID producer_idx = input_edge->producer_idx();
+        const Target target       = node->assigned_target();
+        NodeParams   params       = node->common_node_params();
+        params.name               = params.name.empty() ? "" : params.name + "_input_bf16";
+
+        g.remove_connection(input_edge->id());
+
+        const NodeID convert_nid  = g.add_node<DepthConvertLayerNode>(DataType::BFLOAT16);
+        INode       *convert_node = g.node(convert_nid);
+        convert_node->set_common_node_parameters(params);
+        convert_node->set_assigned_target(target);
+
+        g.add_connection(producer->id(), producer_idx, convert_nid, 0);
+        g.add_connection(convert_nid, 0, node_id, 0);
+
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Converted node with ID : " << node->id() << " and Name: " << node->name() << " to BFLOAT16 storage" << std::endl);
+    }
+}
+} // namespace graph
+} // namespace arm_compute
@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/ConstantFoldingMutator.h"
+
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/ITensorAccessor.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/nodes/Nodes.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/utils/misc/Cast.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "support/MemorySupport.h"
+
+#include <cstring>
+#include <utility>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** Accessor wrapping a const tensor accessor with a folded shape transformation
+ *
+ * The original accessor fills a host staging tensor with the original descriptor and
+ * the contents are then copied into the target tensor: element order is preserved for
+ * reshapes and flattens, while permutes remap the coordinates through their
+ * permutation vector.
+ */
+class FoldedConstAccessor final : public ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[in] accessor Accessor of the original const node
+     * @param[in] src_desc Descriptor of the original const tensor
+     * @param[in] perm     Permutation to apply. Empty for order-preserving folds
+     */
+    FoldedConstAccessor(std::unique_ptr<ITensorAccessor> accessor, TensorDescriptor src_desc, PermutationVector perm)
+        : _accessor(std::move(accessor)), _src_desc(src_desc), _perm(perm)
+    {
+    }
+
+    // Inherited methods overridden:
+    bool access_tensor(ITensor &tensor) override
+    {
+        if(_accessor == nullptr)
+        {
+            return false;
+        }
+
+        // Fill a host staging tensor with the original const contents
+        TensorInfo src_info(_src_desc.shape, 1, _src_desc.data_type, _src_desc.quant_info);
+        src_info.set_data_layout(_src_desc.layout);
+        arm_compute::Tensor src;
+        src.allocator()->init(src_info);
+        src.allocator()->allocate();
+        if(!_accessor->access_tensor(src))
+        {
+            return false;
+        }
+
+        const TensorShape &src_shape    = src.info()->tensor_shape();
+        const TensorShape &dst_shape    = tensor.info()->tensor_shape();
+        const size_t       element_size = src.info()->element_size();
+        const size_t       num_elements = src_shape.total_size();
+        ARM_COMPUTE_ERROR_ON_MSG(dst_shape.total_size() != num_elements, "Folded const transformation changes the number of elements");
+
+        for(size_t i = 0; i < num_elements; ++i)
+        {
+            const Coordinates src_coords = index2coords(src_shape, i);
+            Coordinates       dst_coords;
+            if(_perm.num_dimensions() != 0)
+            {
+                // Output dimension d of a permute indexes input dimension perm[d]
+                dst_coords = src_coords;
+                for(unsigned int d = 0; d < _perm.num_dimensions(); ++d)
+                {
+                    dst_coords.set(d, src_coords[_perm[d]]);
+                }
+            }
+            else
+            {
+                dst_coords = index2coords(dst_shape, i);
+            }
+            std::memcpy(tensor.ptr_to_element(dst_coords), src.ptr_to_element(src_coords), element_size);
+        }
+        return true;
+    }
+
+private:
+    std::unique_ptr<ITensorAccessor> _accessor;
+    TensorDescriptor                 _src_desc;
+    PermutationVector                _perm;
+};
+
+/** Checks if a node applies a foldable shape transformation */
+bool is_foldable_transformation(NodeType type)
+{
+    return type == NodeType::ReshapeLayer || type == NodeType::FlattenLayer || type == NodeType::PermuteLayer;
+}
+} // namespace
+
+const char *ConstantFoldingMutator::name()
+{
+    return "ConstantFoldingMutator";
+}
+
+IGraphMutator::MutationType ConstantFoldingMutator::type() const
+{
+    return IGraphMutator::MutationType::IR;
+}
+
+void ConstantFoldingMutator::mutate(Graph &g)
+{
+    bool folded = true;
+    while(folded)
+    {
+        folded = false;
+        for(unsigned int nid = 0; nid < g.nodes().size(); ++nid)
+        {
+            INode *node = g.node(nid);
+            if(node == nullptr || !is_foldable_transformation(node->type()) || node->num_inputs() != 1)
+            {
+                continue;
+            }
+
+            // The producer must be a const node feeding this node only
+            Edge *input_edge = node->input_edge(0);
+            if(input_edge == nullptr || input_edge->producer() == nullptr)
+            {
+                continue;
+            }
+            INode *producer = input_edge->producer();
+            if(producer->type() != NodeType::Const || producer->output_edges().size() != 1)
+            {
+                continue;
+            }
+
+            Tensor *const_tensor = producer->output(0);
+            Tensor *out_tensor   = node->output(0);
+            if(const_tensor == nullptr || out_tensor == nullptr || const_tensor->accessor() == nullptr || out_tensor->accessor() != nullptr)
+            {
+                continue;
+            }
+
+            // Permutes remap the element order, reshapes and flattens preserve it
+            PermutationVector perm{};
+            if(node->type() == NodeType::PermuteLayer)
+            {
+                perm = utils::cast::polymorphic_downcast<PermuteLayerNode *>(node)->permutation_vector();
+            }
+
+            const TensorDescriptor src_desc = const_tensor->desc();
+            const TensorDescriptor dst_desc = out_tensor->desc();
+            auto                   accessor = support::cpp14::make_unique<FoldedConstAccessor>(const_tensor->extract_accessor(), src_desc, perm);
+
+            // Capture the consumers before removing the transformation node
+            std::vector<std::pair<NodeID, unsigned int>> consumers;
+            for(EdgeID eid : node->output_edges())
+            {
+                const Edge *edge = g.edge(eid);
+                if(edge != nullptr && edge->consumer() != nullptr)
+                {
+                    consumers.emplace_back(edge->consumer_id(), edge->consumer_idx());
+                }
+            }
+
+            const NodeParams params      = { node->name() + "_folded", node->assigned_target() };
+            const NodeID     producer_id = producer->id();
+            ARM_COMPUTE_LOG_GRAPH_VERBOSE("Folding const transformation node with ID : [" << node->id() << "] and Name: " << node->name() << std::endl);
+            g.remove_node(nid);
+            g.remove_node(producer_id);
+
+            const NodeID folded_id   = g.add_node<ConstNode>(dst_desc);
+            INode       *folded_node = g.node(folded_id);
+            folded_node->set_common_node_parameters(params);
+            folded_node->output(0)->set_accessor(std::move(accessor));
+            for(const auto &consumer : consumers)
+            {
+                g.add_connection(folded_id, 0, consumer.first, consumer.second);
+            }
+            folded = true;
+        }
+    }
+}
+} // namespace graph
+} // namespace arm_compute
@@ -43,7 +43,8 @@ namespace graph
 namespace
 {
 NodeID create_grouped_convolution(Graph &g, const NodeParams &params, NodeIdxPair input, NodeID weights, NodeID bias,
-                                  PadStrideInfo conv_info, ConvolutionMethod method, ActivationLayerInfo fused_act, FastMathHint fast_math_hint, unsigned int num_groups)
+                                  PadStrideInfo conv_info, ConvolutionMethod method, ActivationLayerInfo fused_act, FastMathHint fast_math_hint, unsigned int num_groups,
+                                  const Size2D &dilation)
 {
     bool has_bias = (bias != EmptyNodeID);
 
@@ -69,7 +70,7 @@ NodeID create_grouped_convolution(Graph &g, const NodeParams &params, NodeIdxPai
     for(unsigned int i = 0; i < num_groups; ++i)
     {
         NodeParams group_params = params;
-        NodeID     conv_nid     = g.add_node<ConvolutionLayerNode>(conv_info, 1, method, fast_math_hint);
+        NodeID     conv_nid     = g.add_node<ConvolutionLayerNode>(conv_info, 1, method, fast_math_hint, QuantizationInfo(), dilation);
         g.add_connection(input_split, i, conv_nid, 0);
         g.add_connection(weights_split, i, conv_nid, 1);
         if(has_bias)
@@ -144,6 +145,7 @@ void GroupedConvolutionMutator::mutate(Graph &g)
                 const ActivationLayerInfo fused_act_info  = conv_node->fused_activation();
                 const FastMathHint        fast_math_hint  = conv_node->fast_math_hint();
                 const unsigned int        num_groups      = conv_node->num_groups();
+                const Size2D              dilation        = conv_node->dilation();
                 const NodeParams          params          = conv_node->common_node_params();
                 const Target              assigned_target = conv_node->assigned_target();
 
@@ -165,7 +167,7 @@ void GroupedConvolutionMutator::mutate(Graph &g)
 
                 // Create grouped convolution node
                 NodeID grouped_conv_id = create_grouped_convolution(g, params, { input_id, 0 }, weights_id, bias_id,
-                                                                    conv_info, conv_method, fused_act_info, fast_math_hint, num_groups);
+                                                                    conv_info, conv_method, fused_act_info, fast_math_hint, num_groups, dilation);
 
                 // Remove convolution node
                 g.remove_node(node->id());
@@ -0,0 +1,309 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/LayoutOptimizationMutator.h"
+
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/algorithms/TopologicalSort.h"
+#include "arm_compute/graph/nodes/Nodes.h"
+
+#include "arm_compute/core/utils/misc/Cast.h"
+
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** Permutation mapping @p from onto @p to for rank-3+ activation tensors */
+PermutationVector permutation_between(DataLayout from, DataLayout to)
+{
+    ARM_COMPUTE_UNUSED(from);
+    return (to == DataLayout::NHWC) ? PermutationVector(2U, 0U, 1U) : PermutationVector(1U, 2U, 0U);
+}
+
+/** Check if a node computes the same result in either layout
+ *
+ * Only elementwise and window-local operators qualify: their backend functions accept
+ * any layout and the pass lets them inherit their producer's region.
+ */
+bool is_layout_agnostic(NodeType type)
+{
+    switch(type)
+    {
+        case NodeType::ActivationLayer:
+        case NodeType::BatchNormalizationLayer:
+        case NodeType::ConcatenateLayer:
+        case NodeType::EltwiseLayer:
+        case NodeType::NormalizationLayer:
+        case NodeType::PoolingLayer:
+        case NodeType::UnaryEltwiseLayer:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/** Check if a node's kernels prefer NHWC storage */
+bool prefers_nhwc(INode *node)
+{
+    if(node->type() == NodeType::DepthwiseConvolutionLayer)
+    {
+        return true;
+    }
+    if(node->type() == NodeType::ConvolutionLayer)
+    {
+        auto *conv_node = arm_compute::utils::cast::polymorphic_downcast<ConvolutionLayerNode *>(node);
+        return conv_node->num_groups() == 1 && (conv_node->convolution_method() == ConvolutionMethod::Default || conv_node->convolution_method() == ConvolutionMethod::GEMM);
+    }
+    return false;
+}
+
+/** Remove adjacent permute pairs whose composition is the identity
+ *
+ * @param[in, out] g Graph to transform
+ *
+ * @return Number of elided pairs
+ */
+unsigned int elide_inverse_permutes(Graph &g)
+{
+    unsigned int num_elided = 0;
+    bool         elided     = true;
+    while(elided)
+    {
+        elided = false;
+        for(unsigned int nid = 0; nid < g.nodes().size(); ++nid)
+        {
+            INode *first = g.node(nid);
+            if(first == nullptr || first->type() != NodeType::PermuteLayer || first->output_edges().size() != 1)
+            {
+                continue;
+            }
+            const Edge *mid_edge = g.edge(*first->output_edges().begin());
+            if(mid_edge == nullptr || mid_edge->consumer() == nullptr || mid_edge->consumer()->type() != NodeType::PermuteLayer)
+            {
+                continue;
+            }
+            INode *second = mid_edge->consumer();
+            if(first->output(0)->accessor() != nullptr || second->output(0)->accessor() != nullptr)
+            {
+                continue;
+            }
+
+            // Output dimension d of the pair reads input dimension p1[p2[d]]
+            const PermutationVector &p1 = arm_compute::utils::cast::polymorphic_downcast<PermuteLayerNode *>(first)->permutation_vector();
+            const PermutationVector &p2 = arm_compute::utils::cast::polymorphic_downcast<PermuteLayerNode *>(second)->permutation_vector();
+            if(p1.num_dimensions() != p2.num_dimensions())
+            {
+                continue;
+            }
+            bool is_identity = first->output(0)->desc().layout == second->input(0)->desc().layout && first->input(0)->desc().layout == second->output(0)->desc().layout;
+            for(unsigned int d = 0; d < p1.num_dimensions() && is_identity; ++d)
+            {
+                is_identity = (p1[p2[d]] == d);
+            }
+            if(!is_identity)
+            {
+                continue;
+            }
+
+            // Bypass the pair, reconnecting the consumers of the second permute to the original producer
+            const Edge *input_edge = first->input_edge(0);
+            if(input_edge == nullptr || input_edge->producer() == nullptr)
+            {
+                continue;
+            }
+            const NodeID       producer_id  = input_edge->producer_id();
+            const unsigned int producer_idx = input_edge->producer_idx();
+
+            std::vector<std::pair<NodeID, unsigned int>> consumers;
+            for(EdgeID eid : second->output_edges())
+            {
+                const Edge *edge = g.edge(eid);
+                if(edge != nullptr && edge->consumer() != nullptr)
+                {
+                    consumers.emplace_back(edge->consumer_id(), edge->consumer_idx());
+                }
+            }
+
+            ARM_COMPUTE_LOG_GRAPH_VERBOSE("Eliding inverse permute pair with IDs : [" << first->id() << ", " << second->id() << "]" << std::endl);
+            const NodeID second_id = second->id();
+            g.remove_node(second_id);
+            g.remove_node(nid);
+            for(const auto &consumer : consumers)
+            {
+                g.add_connection(producer_id, producer_idx, consumer.first, consumer.second);
+            }
+            ++num_elided;
+            elided = true;
+            break;
+        }
+    }
+    return num_elided;
+}
+} // namespace
+
+const char *LayoutOptimizationMutator::name()
+{
+    return "LayoutOptimizationMutator";
+}
+
+IGraphMutator::MutationType LayoutOptimizationMutator::type() const
+{
+    return IGraphMutator::MutationType::IR;
+}
+
+void LayoutOptimizationMutator::mutate(Graph &g)
+{
+    // Phase 1: assign a layout to every node in topological order. Convolutions pull
+    // their region to NHWC, layout-agnostic nodes follow their producer and everything
+    // else (reshapes, flattens, fully connected, pads, I/O) pins its original layout.
+    std::vector<DataLayout> assigned(g.nodes().size(), DataLayout::UNKNOWN);
+    unsigned int            num_anchors = 0;
+    for(NodeID nid : dfs(g))
+    {
+        INode *node = g.node(nid);
+        if(node == nullptr)
+        {
+            continue;
+        }
+
+        DataLayout layout = DataLayout::UNKNOWN;
+        if(prefers_nhwc(node))
+        {
+            layout = DataLayout::NHWC;
+            ++num_anchors;
+        }
+        else if(is_layout_agnostic(node->type()) && node->num_inputs() > 0 && node->input_edge(0) != nullptr && node->input_edge(0)->producer() != nullptr)
+        {
+            layout = assigned[node->input_edge(0)->producer_id()];
+        }
+        if(layout == DataLayout::UNKNOWN)
+        {
+            if(node->num_outputs() > 0 && node->output(0) != nullptr)
+            {
+                layout = node->output(0)->desc().layout;
+            }
+            else if(node->num_inputs() > 0 && node->input(0) != nullptr)
+            {
+                layout = node->input(0)->desc().layout;
+            }
+        }
+        assigned[nid] = layout;
+    }
+    if(num_anchors == 0)
+    {
+        return;
+    }
+
+    // Phase 2: snapshot the edges whose endpoints were assigned different layouts and
+    // break each of them with a permute node. Permutes are deduplicated per producer
+    // output so a tensor crossing into several consumers is converted once.
+    struct CrossingEdge
+    {
+        NodeID       producer_id;
+        unsigned int producer_idx;
+        NodeID       consumer_id;
+        unsigned int consumer_idx;
+        DataLayout   from;
+        DataLayout   to;
+    };
+    std::vector<CrossingEdge> crossings;
+    std::vector<EdgeID>       crossing_ids;
+    for(unsigned int eid = 0; eid < g.edges().size(); ++eid)
+    {
+        const Edge *edge = g.edge(eid);
+        if(edge == nullptr || edge->producer() == nullptr || edge->consumer() == nullptr || edge->tensor() == nullptr)
+        {
+            continue;
+        }
+        const DataLayout from = assigned[edge->producer_id()];
+        const DataLayout to   = assigned[edge->consumer_id()];
+        // Sub-3D tensors (biases, shapes) have no spatial storage order to convert
+        if(from == to || from == DataLayout::UNKNOWN || to == DataLayout::UNKNOWN || edge->tensor()->desc().shape.num_dimensions() < 3)
+        {
+            continue;
+        }
+        crossings.push_back(CrossingEdge{ edge->producer_id(), edge->producer_idx(), edge->consumer_id(), edge->consumer_idx(), from, to });
+        crossing_ids.push_back(eid);
+    }
+    if(crossings.empty())
+    {
+        return;
+    }
+
+    for(EdgeID eid : crossing_ids)
+    {
+        g.remove_connection(eid);
+    }
+
+    std::map<std::pair<std::pair<NodeID, unsigned int>, DataLayout>, NodeID> inserted_permutes;
+    for(const CrossingEdge &crossing : crossings)
+    {
+        const auto key         = std::make_pair(std::make_pair(crossing.producer_id, crossing.producer_idx), crossing.to);
+        auto       permute_it  = inserted_permutes.find(key);
+        NodeID     permute_nid = EmptyNodeID;
+        if(permute_it != inserted_permutes.end())
+        {
+            permute_nid = permute_it->second;
+        }
+        else
+        {
+            INode     *producer = g.node(crossing.producer_id);
+            NodeParams params   = producer->common_node_params();
+            params.name         = params.name.empty() ? "" : params.name + ((crossing.to == DataLayout::NHWC) ? "_nhwc" : "_nchw");
+
+            permute_nid           = g.add_node<PermuteLayerNode>(permutation_between(crossing.from, crossing.to), crossing.to);
+            INode *permute_node   = g.node(permute_nid);
+            permute_node->set_common_node_parameters(params);
+            g.add_connection(crossing.producer_id, crossing.producer_idx, permute_nid, 0);
+            inserted_permutes[key] = permute_nid;
+            ARM_COMPUTE_LOG_GRAPH_VERBOSE("Inserted layout conversion after node with ID : [" << crossing.producer_id << "] and Name: " << producer->name() << std::endl);
+        }
+        g.add_connection(permute_nid, 0, crossing.consumer_id, crossing.consumer_idx);
+    }
+
+    // Phase 3: re-forward the descriptors so every node downstream of a conversion sees
+    // the permuted shape and layout
+    for(NodeID nid : dfs(g))
+    {
+        INode *node = g.node(nid);
+        if(node != nullptr)
+        {
+            node->forward_descriptors();
+        }
+    }
+
+    // Phase 4: drop conversion pairs that cancel out, including ones already present in
+    // the input graph
+    const unsigned int num_elided = elide_inverse_permutes(g);
+
+    ARM_COMPUTE_LOG_GRAPH_INFO("Layout optimization: " << num_anchors << " NHWC anchor(s), "
+                               << inserted_permutes.size() << " conversion(s) inserted, " << num_elided << " pair(s) elided" << std::endl);
+}
+} // namespace graph
+} // namespace arm_compute
@@ -30,6 +30,7 @@
 #include "arm_compute/graph/nodes/FusedConvolutionBatchNormalizationNode.h"
 #include "arm_compute/graph/nodes/Nodes.h"
 
+#include "arm_compute/core/utils/helpers/pad_fold.h"
 #include "arm_compute/core/utils/misc/Cast.h"
 
 #include <set>
@@ -53,6 +54,12 @@ void fuse_convolution_with_batch_normalization(Graph &g, const Edge *output_edge
         return;
     }
 
+    // Not fusing dilated convolutions as the fused node does not carry dilation
+    if(conv_node->dilation() != Size2D(1U, 1U))
+    {
+        return;
+    }
+
     ARM_COMPUTE_LOG_GRAPH_VERBOSE("Fusing convolution node with ID : " << output_edge->producer_id()
                                   << " with BatchNormalization Layer node with ID : " << output_edge->consumer_id() << std::endl);
 
@@ -265,6 +272,124 @@ void fuse_node_with_activation(Graph &g, const Edge *output_edge, const std::set
     }
 }
 
+template <typename N>
+void fuse_pad_with_convolution(Graph &g, const Edge *output_edge)
+{
+    ARM_COMPUTE_ERROR_ON(output_edge == nullptr);
+
+    auto *pad_node  = arm_compute::utils::cast::polymorphic_downcast<PadLayerNode *>(output_edge->producer());
+    auto *conv_node = arm_compute::utils::cast::polymorphic_downcast<N *>(output_edge->consumer());
+
+    const Edge *input_edge = pad_node->input_edge(0);
+    if(input_edge == nullptr || input_edge->tensor() == nullptr)
+    {
+        return;
+    }
+
+    const DataLayout layout = input_edge->tensor()->desc().layout;
+    if(!helpers::pad_fold::is_foldable_conv_padding(pad_node->padding(), pad_node->pad_value(), input_edge->tensor()->desc().data_type, layout))
+    {
+        return;
+    }
+
+    // Prevent fusion if the pad output is observed by an accessor
+    if(pad_node->output(0)->accessor() != nullptr)
+    {
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Prevented fusion of pad with convolution due to the presence of an output accessor\n");
+        return;
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Fusing pad node with ID : " << output_edge->producer_id()
+                                  << " with convolution node with ID : " << output_edge->consumer_id() << std::endl);
+
+    // Absorb the padding into the convolution attributes
+    conv_node->set_convolution_info(helpers::pad_fold::fold_conv_padding(conv_node->convolution_info(), pad_node->padding(), layout));
+
+    // Bypass the pad node
+    const NodeID pad_input_id = input_edge->producer_id();
+    g.remove_node(pad_node->id());
+    g.add_connection(pad_input_id, 0, conv_node->id(), 0);
+}
+
+void elide_pass_through_node(Graph &g, INode *node)
+{
+    ARM_COMPUTE_ERROR_ON(node == nullptr);
+
+    // Prevent elision if the node output is observed by an accessor
+    if(node->output(0)->accessor() != nullptr)
+    {
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Prevented elision of node with ID : " << node->id() << " due to the presence of an output accessor\n");
+        return;
+    }
+
+    const Edge *input_edge = node->input_edge(0);
+    if(input_edge == nullptr)
+    {
+        return;
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Eliding no-op node with ID : " << node->id() << " and name : " << node->name() << std::endl);
+
+    const NodeID producer_id  = input_edge->producer_id();
+    const size_t producer_idx = input_edge->producer_idx();
+
+    std::vector<NodeIdxPair> driving_nodes = get_driving_nodes(*node);
+
+    g.remove_node(node->id());
+
+    for(auto &driving_node : driving_nodes)
+    {
+        g.add_connection(producer_id, producer_idx, driving_node.node_id, driving_node.index);
+    }
+}
+
+void elide_memory_layout_noops(Graph &g)
+{
+    for(auto &node : g.nodes())
+    {
+        if(!node || node->num_inputs() == 0 || node->input(0) == nullptr || node->output(0) == nullptr)
+        {
+            continue;
+        }
+
+        if(node->type() == NodeType::ReshapeLayer)
+        {
+            // A reshape to the shape of its input is a plain copy
+            if(node->input(0)->desc().shape == node->output(0)->desc().shape)
+            {
+                elide_pass_through_node(g, node.get());
+                continue;
+            }
+            // Of two back-to-back reshapes only the final shape matters
+            if(node->output_edges().size() == 1)
+            {
+                const auto output_edge = g.edge(*node->output_edges().begin());
+                if(output_edge != nullptr && output_edge->consumer() != nullptr && output_edge->consumer()->type() == NodeType::ReshapeLayer)
+                {
+                    elide_pass_through_node(g, node.get());
+                    continue;
+                }
+            }
+        }
+        else if(node->type() == NodeType::PermuteLayer)
+        {
+            auto *permute_node = arm_compute::utils::cast::polymorphic_downcast<PermuteLayerNode *>(node.get());
+
+            const PermutationVector &perm        = permute_node->permutation_vector();
+            bool                     is_identity = node->input(0)->desc().layout == node->output(0)->desc().layout;
+            for(unsigned int d = 0; d < perm.num_dimensions() && is_identity; ++d)
+            {
+                is_identity = (perm[d] == d);
+            }
+
+            if(is_identity)
+            {
+                elide_pass_through_node(g, node.get());
+            }
+        }
+    }
+}
+
 template <typename N1, typename N2, typename F, typename... Args>
 void fuse_layer(Graph &g, std::function<bool(INode &)> const &prec, const F fuse_fcn, Args &&... optional_arguments)
 {
@@ -328,6 +453,9 @@ void NodeFusionMutator::mutate(Graph &g)
     };
 
     // Fusion mutations
+    detail::elide_memory_layout_noops(g);
+    detail::fuse_layer<PadLayerNode, ConvolutionLayerNode>(g, empty_prec, detail::fuse_pad_with_convolution<ConvolutionLayerNode>);
+    detail::fuse_layer<PadLayerNode, DepthwiseConvolutionLayerNode>(g, empty_prec, detail::fuse_pad_with_convolution<DepthwiseConvolutionLayerNode>);
     detail::fuse_layer<BatchNormalizationLayerNode, ActivationLayerNode>(g, empty_prec, detail::fuse_node_with_activation<BatchNormalizationLayerNode>, supported_fused_activations_conv);
     detail::fuse_layer<ConvolutionLayerNode, ActivationLayerNode>(g, empty_prec, detail::fuse_node_with_activation<ConvolutionLayerNode>, supported_fused_activations_conv);
     detail::fuse_layer<DepthwiseConvolutionLayerNode, ActivationLayerNode>(g, qs8_prec, detail::fuse_node_with_activation<DepthwiseConvolutionLayerNode>, supported_fused_activations_conv);
@@ -36,8 +36,9 @@ ConvolutionLayerNode::ConvolutionLayerNode(PadStrideInfo     info,
                                            unsigned int      num_groups,
                                            ConvolutionMethod method,
                                            FastMathHint      fast_math_hint,
-                                           QuantizationInfo  out_quant_info)
-    : _info(std::move(info)), _num_groups(num_groups), _method(method), _fast_math_hint(fast_math_hint), _out_quant_info(std::move(out_quant_info)), _fused_activation()
+                                           QuantizationInfo  out_quant_info,
+                                           Size2D            dilation)
+    : _info(std::move(info)), _num_groups(num_groups), _method(method), _fast_math_hint(fast_math_hint), _out_quant_info(std::move(out_quant_info)), _fused_activation(), _dilation(dilation)
 {
     _input_edges.resize(3, EmptyEdgeID);
     _outputs.resize(1, NullTensorID);
@@ -68,11 +69,21 @@ PadStrideInfo ConvolutionLayerNode::convolution_info() const
     return _info;
 }
 
+void ConvolutionLayerNode::set_convolution_info(PadStrideInfo info)
+{
+    _info = std::move(info);
+}
+
 unsigned int ConvolutionLayerNode::num_groups() const
 {
     return _num_groups;
 }
 
+Size2D ConvolutionLayerNode::dilation() const
+{
+    return _dilation;
+}
+
 ActivationLayerInfo ConvolutionLayerNode::fused_activation() const
 {
     return _fused_activation;
@@ -85,7 +96,8 @@ void ConvolutionLayerNode::set_fused_activation(ActivationLayerInfo fused_activa
 
 TensorDescriptor ConvolutionLayerNode::compute_output_descriptor(const TensorDescriptor &input_descriptor,
                                                                  const TensorDescriptor &weights_descriptor,
-                                                                 const PadStrideInfo    &info)
+                                                                 const PadStrideInfo    &info,
+                                                                 const Size2D           &dilation)
 {
     unsigned int output_width  = 0;
     unsigned int output_height = 0;
@@ -95,7 +107,7 @@ TensorDescriptor ConvolutionLayerNode::compute_output_descriptor(const TensorDes
     const unsigned int kernel_width  = get_dimension_size(weights_descriptor, DataLayoutDimension::WIDTH);
     const unsigned int kernel_height = get_dimension_size(weights_descriptor, DataLayoutDimension::HEIGHT);
 
-    std::tie(output_width, output_height) = scaled_dimensions(input_width, input_height, kernel_width, kernel_height, info);
+    std::tie(output_width, output_height) = scaled_dimensions(input_width, input_height, kernel_width, kernel_height, info, dilation);
 
     const DataLayout data_layout       = input_descriptor.layout;
     TensorDescriptor output_descriptor = input_descriptor;
@@ -126,11 +138,16 @@ TensorDescriptor ConvolutionLayerNode::configure_output(size_t idx) const
 
     ARM_COMPUTE_ERROR_ON(src == nullptr || weights == nullptr);
 
-    TensorDescriptor output_info = compute_output_descriptor(src->desc(), weights->desc(), _info);
+    TensorDescriptor output_info = compute_output_descriptor(src->desc(), weights->desc(), _info, _dilation);
     if(!_out_quant_info.empty())
     {
         output_info.quant_info = _out_quant_info;
     }
+    // BFLOAT16 is a storage format only; the backend kernels accumulate and write out FP32
+    if(output_info.data_type == DataType::BFLOAT16)
+    {
+        output_info.data_type = DataType::F32;
+    }
 
     return output_info;
 }
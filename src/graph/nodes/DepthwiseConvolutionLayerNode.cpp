@@ -60,6 +60,11 @@ PadStrideInfo DepthwiseConvolutionLayerNode::convolution_info() const
     return _info;
 }
 
+void DepthwiseConvolutionLayerNode::set_convolution_info(PadStrideInfo info)
+{
+    _info = std::move(info);
+}
+
 ActivationLayerInfo DepthwiseConvolutionLayerNode::fused_activation() const
 {
     return _fused_activation;
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/printers/MemoryPlanPrinter.h"
+
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/GraphContext.h"
+#include "arm_compute/graph/Tensor.h"
+#include "arm_compute/graph/TypePrinter.h"
+#include "arm_compute/graph/Utils.h"
+#include "arm_compute/runtime/ILifetimeManager.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** Prints the memory requirements of one lifetime manager */
+void print_memory_report(const char *pool, Target target, const MemoryReport &report, std::ostream &os)
+{
+    os << pool << " " << target << " total_bytes " << report.total_bytes << " peak_bytes " << report.peak_bytes;
+    if(report.mapping_type == MappingType::BLOBS && !report.blob_sizes.empty())
+    {
+        os << " blobs";
+        for(const auto &blob_size : report.blob_sizes)
+        {
+            os << " " << blob_size;
+        }
+    }
+    os << "\n";
+}
+} // namespace
+
+void MemoryPlanPrinter::print(const Graph &g, GraphContext &ctx, std::ostream &os) const
+{
+    // Per-layer output shapes and work estimates
+    os << "name type shape bytes ops\n";
+    for(const auto &node : g.nodes())
+    {
+        if(node == nullptr || node->num_outputs() == 0)
+        {
+            continue;
+        }
+        const Tensor *output = node->output(0);
+        if(output == nullptr)
+        {
+            continue;
+        }
+        const TensorDescriptor &desc         = output->desc();
+        const uint64_t          output_bytes = static_cast<uint64_t>(desc.shape.total_size()) * data_size_from_type(desc.data_type);
+
+        os << (node->name().empty() ? "node_" + std::to_string(node->id()) : node->name()) << " "
+           << node->type() << " "
+           << desc.shape << " "
+           << output_bytes << " "
+           << estimate_node_ops(*node) << "\n";
+    }
+
+    // Memory requirements computed by the lifetime managers, per target; a dry-run
+    // finalize fills these in without any allocation having taken place
+    for(auto &mm_obj : ctx.memory_managers())
+    {
+        if(mm_obj.second.intra_mm != nullptr && mm_obj.second.intra_mm->lifetime_manager() != nullptr && !mm_obj.second.intra_scratch_shared)
+        {
+            print_memory_report("function_scratch", mm_obj.first, mm_obj.second.intra_mm->lifetime_manager()->report(), os);
+        }
+        if(mm_obj.second.cross_mm != nullptr && mm_obj.second.cross_mm->lifetime_manager() != nullptr)
+        {
+            print_memory_report("transition", mm_obj.first, mm_obj.second.cross_mm->lifetime_manager()->report(), os);
+        }
+    }
+}
+} // namespace graph
+} // namespace arm_compute
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/printers/RooflinePrinter.h"
+
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/TypePrinter.h"
+#include "arm_compute/graph/Utils.h"
+
+#include <algorithm>
+#include <iomanip>
+
+namespace arm_compute
+{
+namespace graph
+{
+RooflinePrinter::RooflinePrinter(double peak_gflops, double peak_gbps)
+    : _peak_gflops(peak_gflops), _peak_gbps(peak_gbps)
+{
+}
+
+void RooflinePrinter::print(const Graph &g, const std::map<NodeID, NodeExecutionTime> &timings, std::ostream &os) const
+{
+    const double machine_balance = _peak_gflops / _peak_gbps;
+
+    os << "name type gops gbytes intensity time_us attained_gflops attained_gbps roof_gflops efficiency bound\n";
+    os << std::fixed << std::setprecision(3);
+
+    for(const auto &node : g.nodes())
+    {
+        if(node == nullptr)
+        {
+            continue;
+        }
+        const auto timing_it = timings.find(node->id());
+        if(timing_it == timings.end() || timing_it->second.runs == 0)
+        {
+            continue;
+        }
+
+        const uint64_t ops       = estimate_node_ops(*node);
+        const uint64_t bytes     = estimate_node_bytes(*node);
+        const double   intensity = (bytes != 0) ? static_cast<double>(ops) / bytes : 0.0;
+        const double   time_s    = static_cast<double>(timing_it->second.total_ns) / timing_it->second.runs * 1e-9;
+
+        const double attained_gflops = (time_s > 0.0) ? ops / time_s * 1e-9 : 0.0;
+        const double attained_gbps   = (time_s > 0.0) ? bytes / time_s * 1e-9 : 0.0;
+        const double roof_gflops     = std::min(_peak_gflops, intensity * _peak_gbps);
+        const double efficiency      = (roof_gflops > 0.0) ? attained_gflops / roof_gflops : 0.0;
+
+        os << (node->name().empty() ? "node_" + std::to_string(node->id()) : node->name()) << " "
+           << node->type() << " "
+           << ops * 1e-9 << " "
+           << bytes * 1e-9 << " "
+           << intensity << " "
+           << time_s * 1e6 << " "
+           << attained_gflops << " "
+           << attained_gbps << " "
+           << roof_gflops << " "
+           << efficiency << " "
+           << ((intensity < machine_balance) ? "memory" : "compute") << "\n";
+    }
+}
+} // namespace graph
+} // namespace arm_compute
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/printers/StartupProfilePrinter.h"
+
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/TypePrinter.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+void StartupProfilePrinter::print(const Graph &g, const StartupProfile &profile, std::ostream &os) const
+{
+    struct Row
+    {
+        std::string     name{};
+        NodeType        type{ NodeType::Dummy };
+        NodeStartupTime time{};
+        uint64_t        total_ns{ 0 };
+    };
+
+    std::vector<Row> rows;
+    rows.reserve(profile.nodes.size());
+    for(const auto &entry : profile.nodes)
+    {
+        const INode *node = g.node(entry.first);
+        if(node == nullptr)
+        {
+            continue;
+        }
+        Row row;
+        row.name     = node->name().empty() ? "node_" + std::to_string(node->id()) : node->name();
+        row.type     = node->type();
+        row.time     = entry.second;
+        row.total_ns = entry.second.validate_ns + entry.second.configure_ns + entry.second.prepare_ns;
+        rows.push_back(std::move(row));
+    }
+
+    // Most expensive functions first
+    std::sort(rows.begin(), rows.end(), [](const Row & a, const Row & b)
+    {
+        return a.total_ns > b.total_ns;
+    });
+
+    os << "name type validate_us configure_us prepare_us total_us\n";
+    os << std::fixed << std::setprecision(1);
+    for(const auto &row : rows)
+    {
+        os << row.name << " "
+           << row.type << " "
+           << row.time.validate_ns / 1000.0 << " "
+           << row.time.configure_ns / 1000.0 << " "
+           << row.time.prepare_ns / 1000.0 << " "
+           << row.total_ns / 1000.0 << "\n";
+    }
+
+    const uint64_t total_ns = profile.validate_total_ns + profile.configure_total_ns + profile.allocation_total_ns + profile.prepare_total_ns;
+    os << "totals:"
+       << " validate " << profile.validate_total_ns / 1000.0 << " us,"
+       << " configure " << profile.configure_total_ns / 1000.0 << " us,"
+       << " allocation " << profile.allocation_total_ns / 1000.0 << " us,"
+       << " prepare " << profile.prepare_total_ns / 1000.0 << " us,"
+       << " startup " << total_ns / 1000.0 << " us\n";
+}
+} // namespace graph
+} // namespace arm_compute
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/BestFitLifetimeManager.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/runtime/BlobMemoryPool.h"
+#include "arm_compute/runtime/IAllocator.h"
+#include "arm_compute/runtime/IMemoryGroup.h"
+#include "support/MemorySupport.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace arm_compute
+{
+BestFitLifetimeManager::BestFitLifetimeManager()
+    : _blobs()
+{
+}
+
+const BestFitLifetimeManager::info_type &BestFitLifetimeManager::info() const
+{
+    return _blobs;
+}
+
+std::unique_ptr<IMemoryPool> BestFitLifetimeManager::create_pool(IAllocator *allocator)
+{
+    ARM_COMPUTE_ERROR_ON(allocator == nullptr);
+    return support::cpp14::make_unique<BlobMemoryPool>(allocator, _blobs);
+}
+
+MappingType BestFitLifetimeManager::mapping_type() const
+{
+    return MappingType::BLOBS;
+}
+
+void BestFitLifetimeManager::update_blobs_and_mappings()
+{
+    ARM_COMPUTE_ERROR_ON(!are_all_finalized());
+    ARM_COMPUTE_ERROR_ON(_active_group == nullptr);
+
+    // Sort free blobs requirements in descending order so the largest requirements pick first
+    _free_blobs.sort([](const Blob & ba, const Blob & bb)
+    {
+        return ba.max_size > bb.max_size;
+    });
+
+    // Place each of the group's requirements into a distinct blob: best-fit picks the
+    // smallest existing blob the requirement fits in, and when nothing fits the largest
+    // still-unused blob is grown, as that adds the fewest bytes
+    std::vector<bool> used(_blobs.size(), false);
+    auto             &group_mappings = _active_group->mappings();
+    for(auto &free_blob : _free_blobs)
+    {
+        int best_idx = -1;
+        for(size_t i = 0; i < _blobs.size(); ++i)
+        {
+            if(used[i] || _blobs[i].size < free_blob.max_size)
+            {
+                continue;
+            }
+            if(best_idx < 0 || _blobs[i].size < _blobs[best_idx].size)
+            {
+                best_idx = static_cast<int>(i);
+            }
+        }
+        if(best_idx < 0)
+        {
+            for(size_t i = 0; i < _blobs.size(); ++i)
+            {
+                if(!used[i] && (best_idx < 0 || _blobs[i].size > _blobs[best_idx].size))
+                {
+                    best_idx = static_cast<int>(i);
+                }
+            }
+        }
+        if(best_idx < 0)
+        {
+            _blobs.emplace_back();
+            used.push_back(false);
+            best_idx = static_cast<int>(_blobs.size() - 1);
+        }
+
+        used[best_idx] = true;
+        BlobInfo &blob = _blobs[best_idx];
+        blob.size      = std::max(blob.size, free_blob.max_size);
+        blob.alignment = std::max(blob.alignment, free_blob.max_alignment);
+        blob.owners    = std::max(blob.owners, free_blob.bound_elements.size());
+
+        for(auto &bound_element_id : free_blob.bound_elements)
+        {
+            ARM_COMPUTE_ERROR_ON(_active_elements.find(bound_element_id) == std::end(_active_elements));
+            Element &bound_element               = _active_elements[bound_element_id];
+            group_mappings[bound_element.handle] = best_idx;
+        }
+    }
+}
+} // namespace arm_compute
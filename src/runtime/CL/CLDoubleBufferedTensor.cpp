@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CL/CLDoubleBufferedTensor.h"
+
+#include "arm_compute/core/TensorInfo.h"
+
+namespace arm_compute
+{
+CLDoubleBufferedTensor::CLDoubleBufferedTensor(IRuntimeContext *ctx)
+    : _tensors{ CLTensor(ctx), CLTensor(ctx) }, _compute_index(0), _pending_transfer()
+{
+}
+
+void CLDoubleBufferedTensor::init(const TensorInfo &info)
+{
+    _tensors[0].allocator()->init(info);
+    _tensors[1].allocator()->init(info);
+}
+
+void CLDoubleBufferedTensor::allocate()
+{
+    _tensors[0].allocator()->allocate();
+    _tensors[1].allocator()->allocate();
+}
+
+CLTensor &CLDoubleBufferedTensor::compute_tensor()
+{
+    return _tensors[_compute_index];
+}
+
+CLTensor &CLDoubleBufferedTensor::transfer_tensor()
+{
+    return _tensors[1 - _compute_index];
+}
+
+cl::Event CLDoubleBufferedTensor::map_transfer_async(cl::CommandQueue &q)
+{
+    return transfer_tensor().map_async(q);
+}
+
+cl::Event CLDoubleBufferedTensor::unmap_transfer_async(cl::CommandQueue &q)
+{
+    _pending_transfer = transfer_tensor().unmap_async(q);
+    return _pending_transfer;
+}
+
+void CLDoubleBufferedTensor::swap()
+{
+    if(_pending_transfer() != nullptr)
+    {
+        _pending_transfer.wait();
+        _pending_transfer = cl::Event();
+    }
+    _compute_index = 1 - _compute_index;
+}
+} // namespace arm_compute
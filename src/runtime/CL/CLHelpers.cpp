@@ -105,6 +105,25 @@ create_opencl_context_and_device()
     return std::make_tuple(cl_context, device, err);
 }
 
+std::tuple<cl::Context, std::vector<cl::Device>, cl_int>
+create_opencl_multi_device_context()
+{
+    ARM_COMPUTE_ERROR_ON(!opencl_is_available());
+    std::vector<cl::Platform> platforms;
+    cl::Platform::get(&platforms);
+    ARM_COMPUTE_ERROR_ON_MSG(platforms.size() == 0, "Couldn't find any OpenCL platform");
+    cl::Platform            p = platforms[0];
+    std::vector<cl::Device> platform_devices;
+    p.getDevices(CL_DEVICE_TYPE_ALL, &platform_devices);
+    ARM_COMPUTE_ERROR_ON_MSG(platform_devices.size() == 0, "Couldn't find any OpenCL device");
+    cl_int err = CL_SUCCESS;
+    std::array<cl_context_properties, 7> properties = { 0, 0, 0, 0, 0, 0, 0 };
+    initialise_context_properties(p, platform_devices[0], properties);
+    cl::Context cl_context = cl::Context(platform_devices, properties.data(), nullptr, nullptr, &err);
+    ARM_COMPUTE_ERROR_ON_MSG(err != CL_SUCCESS, "Failed to create OpenCL context");
+    return std::make_tuple(cl_context, platform_devices, err);
+}
+
 void schedule_kernel_on_ctx(CLRuntimeContext *ctx, ICLKernel *kernel, bool flush)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(kernel);
@@ -26,6 +26,8 @@
 #include "arm_compute/core/CL/CLCoreRuntimeContext.h"
 #include "arm_compute/core/Error.h"
 #include "arm_compute/runtime/CL/CLScheduler.h"
+#include "arm_compute/runtime/MemoryCounters.h"
+#include "support/MemorySupport.h"
 
 namespace arm_compute
 {
@@ -64,7 +66,9 @@ CLBufferMemoryRegion::CLBufferMemoryRegion(CLCoreRuntimeContext *ctx, cl_mem_fla
 {
     if(_size != 0)
     {
-        _mem = cl::Buffer((ctx != nullptr) ? ctx->context() : CLScheduler::get().context(), flags, _size);
+        _mem   = cl::Buffer((ctx != nullptr) ? ctx->context() : CLScheduler::get().context(), flags, _size);
+        _owned = true;
+        MemoryCounters::get().record_allocation(_size);
     }
 }
 
@@ -74,6 +78,14 @@ CLBufferMemoryRegion::CLBufferMemoryRegion(const cl::Buffer &buffer, CLCoreRunti
     _mem = buffer;
 }
 
+CLBufferMemoryRegion::~CLBufferMemoryRegion()
+{
+    if(_owned)
+    {
+        MemoryCounters::get().record_free(_size);
+    }
+}
+
 void *CLBufferMemoryRegion::ptr()
 {
     return nullptr;
@@ -83,6 +95,7 @@ void *CLBufferMemoryRegion::map(cl::CommandQueue &q, bool blocking)
 {
     ARM_COMPUTE_ERROR_ON(_mem.get() == nullptr);
     _mapping = q.enqueueMapBuffer(_mem, blocking ? CL_TRUE : CL_FALSE, CL_MAP_READ | CL_MAP_WRITE, 0, _size);
+    MemoryCounters::get().record_map(_size);
     return _mapping;
 }
 
@@ -91,6 +104,30 @@ void CLBufferMemoryRegion::unmap(cl::CommandQueue &q)
     ARM_COMPUTE_ERROR_ON(_mem.get() == nullptr);
     q.enqueueUnmapMemObject(_mem, _mapping);
     _mapping = nullptr;
+    MemoryCounters::get().record_unmap(_size);
+}
+
+std::unique_ptr<IMemoryRegion> CLBufferMemoryRegion::extract_subregion(size_t offset, size_t size)
+{
+    if(_mem.get() == nullptr || size == 0 || (offset + size) > _size)
+    {
+        return nullptr;
+    }
+
+    cl_buffer_region region = { offset, size };
+    cl_int           err    = CL_SUCCESS;
+    const cl::Buffer sub_buffer = _mem.createSubBuffer(CL_MEM_READ_WRITE, CL_BUFFER_CREATE_TYPE_REGION, &region, &err);
+    if(err != CL_SUCCESS)
+    {
+        return nullptr;
+    }
+
+    // Keep the queue and context of the parent region; the sub-buffer holds a reference
+    // on the parent cl_mem for as long as it is alive
+    auto sub_region    = support::cpp14::make_unique<CLBufferMemoryRegion>(sub_buffer, nullptr);
+    sub_region->_queue = _queue;
+    sub_region->_ctx   = _ctx;
+    return std::move(sub_region);
 }
 
 ICLSVMMemoryRegion::ICLSVMMemoryRegion(CLCoreRuntimeContext *ctx, cl_mem_flags flags, size_t size, size_t alignment)
@@ -102,6 +139,7 @@ ICLSVMMemoryRegion::ICLSVMMemoryRegion(CLCoreRuntimeContext *ctx, cl_mem_flags f
         if(_ptr != nullptr)
         {
             _mem = cl::Buffer((ctx != nullptr) ? ctx->context() : CLScheduler::get().context(), CL_MEM_READ_WRITE | CL_MEM_USE_HOST_PTR, _size, _ptr);
+            MemoryCounters::get().record_allocation(_size);
         }
     }
 }
@@ -110,6 +148,7 @@ ICLSVMMemoryRegion::~ICLSVMMemoryRegion()
 {
     if(_ptr != nullptr)
     {
+        MemoryCounters::get().record_free(_size);
         try
         {
             clFinish(_queue.get());
@@ -137,6 +176,7 @@ void *CLCoarseSVMMemoryRegion::map(cl::CommandQueue &q, bool blocking)
     ARM_COMPUTE_ERROR_ON(_ptr == nullptr);
     clEnqueueSVMMap(q.get(), blocking ? CL_TRUE : CL_FALSE, CL_MAP_READ | CL_MAP_WRITE, _ptr, _size, 0, nullptr, nullptr);
     _mapping = _ptr;
+    MemoryCounters::get().record_map(_size);
     return _mapping;
 }
 
@@ -145,6 +185,7 @@ void CLCoarseSVMMemoryRegion::unmap(cl::CommandQueue &q)
     ARM_COMPUTE_ERROR_ON(_ptr == nullptr);
     clEnqueueSVMUnmap(q.get(), _ptr, 0, nullptr, nullptr);
     _mapping = nullptr;
+    MemoryCounters::get().record_unmap(_size);
 }
 
 CLFineSVMMemoryRegion::CLFineSVMMemoryRegion(CLCoreRuntimeContext *ctx, cl_mem_flags flags, size_t size, size_t alignment)
@@ -167,4 +208,36 @@ void CLFineSVMMemoryRegion::unmap(cl::CommandQueue &q)
     ARM_COMPUTE_UNUSED(q);
     _mapping = nullptr;
 }
+
+CLImportedSVMMemoryRegion::CLImportedSVMMemoryRegion(void *ptr, size_t size, CLCoreRuntimeContext *ctx)
+    : ICLMemoryRegion(ctx, size), _ptr(ptr)
+{
+    ARM_COMPUTE_ERROR_ON(ptr == nullptr);
+    if(_size != 0)
+    {
+        _mem = cl::Buffer((ctx != nullptr) ? ctx->context() : CLScheduler::get().context(), CL_MEM_READ_WRITE | CL_MEM_USE_HOST_PTR, _size, _ptr);
+    }
+}
+
+void *CLImportedSVMMemoryRegion::ptr()
+{
+    return _ptr;
+}
+
+void *CLImportedSVMMemoryRegion::map(cl::CommandQueue &q, bool blocking)
+{
+    // Fine-grain coherent memory needs no mapping, only completion of the in-flight kernels
+    if(blocking)
+    {
+        clFinish(q.get());
+    }
+    _mapping = _ptr;
+    return _mapping;
+}
+
+void CLImportedSVMMemoryRegion::unmap(cl::CommandQueue &q)
+{
+    ARM_COMPUTE_UNUSED(q);
+    _mapping = nullptr;
+}
 } // namespace arm_compute
@@ -32,15 +32,64 @@ CLRuntimeContext::CLRuntimeContext()
     : _gpu_owned_scheduler(support::cpp14::make_unique<CLScheduler>()), _gpu_scheduler(_gpu_owned_scheduler.get()), _symbols(), _core_context()
 {
     _symbols.load_default();
-    auto ctx_dev_err = create_opencl_context_and_device();
-    ARM_COMPUTE_ERROR_ON_MSG(std::get<2>(ctx_dev_err) != CL_SUCCESS, "Failed to create OpenCL context");
-    auto             ctx   = std::get<0>(ctx_dev_err);
-    auto             dev   = std::get<1>(ctx_dev_err);
-    cl::CommandQueue queue = cl::CommandQueue(ctx, dev);
-    _gpu_owned_scheduler->init(ctx, queue, dev, &_tuner);
+    auto ctx_devs_err = create_opencl_multi_device_context();
+    ARM_COMPUTE_ERROR_ON_MSG(std::get<2>(ctx_devs_err) != CL_SUCCESS, "Failed to create OpenCL context");
+    auto             ctx   = std::get<0>(ctx_devs_err);
+    auto             devs  = std::get<1>(ctx_devs_err);
+    cl::CommandQueue queue = cl::CommandQueue(ctx, devs[0]);
+    _gpu_owned_scheduler->init(ctx, queue, devs[0], &_tuner);
     const std::string cl_kernels_folder("./cl_kernels");
-    CLKernelLibrary::get().init(cl_kernels_folder, ctx, dev);
+    CLKernelLibrary::get().init(cl_kernels_folder, ctx, devs[0]);
     _core_context = CLCoreRuntimeContext(&CLKernelLibrary::get(), _gpu_owned_scheduler->context(), _gpu_owned_scheduler->queue());
+
+    // Give every further device of the platform its own queue, scheduler and tuner within the shared context
+    for(size_t i = 1; i < devs.size(); ++i)
+    {
+        _device_tuners.emplace_back(support::cpp14::make_unique<CLTuner>(false));
+        auto scheduler = support::cpp14::make_unique<CLScheduler>();
+        scheduler->init(ctx, cl::CommandQueue(ctx, devs[i]), devs[i], _device_tuners.back().get());
+        _device_schedulers.emplace_back(std::move(scheduler));
+    }
+}
+
+size_t CLRuntimeContext::num_devices() const
+{
+    return 1 + _device_schedulers.size();
+}
+
+CLScheduler *CLRuntimeContext::gpu_scheduler(size_t device_index)
+{
+    ARM_COMPUTE_ERROR_ON(device_index >= num_devices());
+    if(device_index == 0)
+    {
+        return _gpu_scheduler;
+    }
+    return _device_schedulers[device_index - 1].get();
+}
+
+void CLRuntimeContext::synchronize_queues(size_t producer_device_index, size_t consumer_device_index)
+{
+    ARM_COMPUTE_ERROR_ON(producer_device_index >= num_devices());
+    ARM_COMPUTE_ERROR_ON(consumer_device_index >= num_devices());
+    if(producer_device_index == consumer_device_index)
+    {
+        return;
+    }
+    cl::Event producer_done;
+    gpu_scheduler(producer_device_index)->queue().enqueueMarker(&producer_done);
+    const std::vector<cl::Event> wait_list = { producer_done };
+    gpu_scheduler(consumer_device_index)->queue().enqueueWaitForEvents(wait_list);
+    // Flush so the consumer's barrier becomes visible to the producer's in-flight work
+    gpu_scheduler(producer_device_index)->queue().flush();
+}
+
+CLStagingBufferPool &CLRuntimeContext::staging_pool()
+{
+    if(_staging_pool == nullptr)
+    {
+        _staging_pool = support::cpp14::make_unique<CLStagingBufferPool>(this);
+    }
+    return *_staging_pool;
 }
 
 CLKernelLibrary &CLRuntimeContext::kernel_library()
@@ -25,12 +25,23 @@
 
 #include "arm_compute/core/CL/CLKernelLibrary.h"
 #include "arm_compute/core/CL/ICLKernel.h"
+#include "arm_compute/core/CL/ICLTensor.h"
+#include "arm_compute/core/utils/misc/Cast.h"
 #include "arm_compute/runtime/CL/CLHelpers.h"
 #include "arm_compute/runtime/CL/CLTuner.h"
 #include "arm_compute/runtime/CL/tuners/Tuners.h"
 
+#include <algorithm>
+#include <cstdlib>
+
 namespace arm_compute
 {
+namespace
+{
+/** Number of retained profiling events after which the completed ones are folded into the report */
+constexpr size_t profiling_events_batch = 256;
+} // namespace
+
 cl::Context &CLScheduler::context()
 {
     ARM_COMPUTE_ERROR_ON(!_is_initialised);
@@ -64,9 +75,277 @@ void CLScheduler::set_tuner(ICLTuner *tuner)
     _cl_tuner = tuner;
 }
 
+void CLScheduler::set_out_of_order_execution(bool enable)
+{
+    ARM_COMPUTE_ERROR_ON(!_is_initialised);
+
+    if(enable == _out_of_order)
+    {
+        return;
+    }
+
+    // Drain the current queue and drop the dependency state before switching queues
+    sync();
+
+    const cl::Device &device = CLKernelLibrary::get().get_device();
+    cl_command_queue_properties props = _queue.getInfo<CL_QUEUE_PROPERTIES>();
+
+    if(enable)
+    {
+        // Keep the in-order queue if the device cannot execute out of order
+        const cl_command_queue_properties supported_props = device.getInfo<CL_DEVICE_QUEUE_PROPERTIES>();
+        if((supported_props & CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE) == 0)
+        {
+            return;
+        }
+        _queue = cl::CommandQueue(_context, device, props | CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE);
+    }
+    else
+    {
+        _queue = cl::CommandQueue(_context, device, props & ~static_cast<cl_command_queue_properties>(CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE));
+    }
+    _out_of_order = enable;
+}
+
+bool CLScheduler::out_of_order_execution() const
+{
+    return _out_of_order;
+}
+
+void CLScheduler::set_job_chaining(bool enable, unsigned int burst_size)
+{
+    ARM_COMPUTE_ERROR_ON(burst_size == 0);
+
+    // Flush whatever is pending before changing the policy
+    if(_pending_enqueues != 0)
+    {
+        _pending_enqueues = 0;
+        _queue.flush();
+    }
+
+    _job_chaining       = enable;
+    _job_chaining_burst = burst_size;
+}
+
+bool CLScheduler::job_chaining() const
+{
+    return _job_chaining;
+}
+
+void CLScheduler::set_queue_priority(CLQueuePriority priority)
+{
+    ARM_COMPUTE_ERROR_ON(!_is_initialised);
+
+    if(priority == _queue_priority)
+    {
+        return;
+    }
+
+    // Drain the current queue before switching queues
+    sync();
+
+    _queue_priority = priority;
+    recreate_queue_with_hints();
+}
+
+CLQueuePriority CLScheduler::queue_priority() const
+{
+    return _queue_priority;
+}
+
+void CLScheduler::set_queue_throttle(CLQueueThrottle throttle)
+{
+    ARM_COMPUTE_ERROR_ON(!_is_initialised);
+
+    if(throttle == _queue_throttle)
+    {
+        return;
+    }
+
+    // Drain the current queue before switching queues
+    sync();
+
+    _queue_throttle = throttle;
+    recreate_queue_with_hints();
+}
+
+CLQueueThrottle CLScheduler::queue_throttle() const
+{
+    return _queue_throttle;
+}
+
+void CLScheduler::recreate_queue_with_hints()
+{
+    const cl::Device &device          = CLKernelLibrary::get().get_device();
+    cl_command_queue_properties props = _queue.getInfo<CL_QUEUE_PROPERTIES>();
+
+    std::vector<cl_queue_properties> properties;
+    properties.push_back(CL_QUEUE_PROPERTIES);
+    properties.push_back(static_cast<cl_queue_properties>(props));
+
+    if((_queue_priority != CLQueuePriority::DEFAULT) && device_supports_extension(device, "cl_khr_priority_hints"))
+    {
+        properties.push_back(CL_QUEUE_PRIORITY_KHR);
+        properties.push_back((_queue_priority == CLQueuePriority::HIGH) ? CL_QUEUE_PRIORITY_HIGH_KHR : (_queue_priority == CLQueuePriority::MEDIUM) ? CL_QUEUE_PRIORITY_MED_KHR : CL_QUEUE_PRIORITY_LOW_KHR);
+    }
+    if((_queue_throttle != CLQueueThrottle::DEFAULT) && device_supports_extension(device, "cl_khr_throttle_hints"))
+    {
+        properties.push_back(CL_QUEUE_THROTTLE_KHR);
+        properties.push_back((_queue_throttle == CLQueueThrottle::HIGH) ? CL_QUEUE_THROTTLE_HIGH_KHR : (_queue_throttle == CLQueueThrottle::MEDIUM) ? CL_QUEUE_THROTTLE_MED_KHR : CL_QUEUE_THROTTLE_LOW_KHR);
+    }
+    properties.push_back(0);
+
+    // Property-list queue creation requires the OpenCL 2.0 entry point; keep the current queue
+    // when it is not exposed so the hints degrade to a no-op on older drivers
+    cl_int                 err   = CL_SUCCESS;
+    const cl_command_queue queue = clCreateCommandQueueWithProperties(_context(), device(), properties.data(), &err);
+    if((queue != nullptr) && (err == CL_SUCCESS))
+    {
+        _queue = cl::CommandQueue(queue);
+    }
+}
+
+void CLScheduler::set_frame_budget_mode(bool enable, unsigned int yield_batch)
+{
+    ARM_COMPUTE_ERROR_ON(yield_batch == 0);
+
+    // Flush whatever is pending before changing the policy
+    if(_pending_enqueues != 0)
+    {
+        _pending_enqueues = 0;
+        _queue.flush();
+    }
+
+    _frame_budget       = enable;
+    _frame_budget_batch = yield_batch;
+}
+
+bool CLScheduler::frame_budget_mode() const
+{
+    return _frame_budget;
+}
+
+void CLScheduler::set_kernel_timing(bool enable)
+{
+    ARM_COMPUTE_ERROR_ON(!_is_initialised);
+
+    if(enable == _kernel_timing)
+    {
+        return;
+    }
+
+    // Drain the queue and fold every outstanding profiling event before switching queues
+    sync();
+
+    const cl::Device &device          = CLKernelLibrary::get().get_device();
+    cl_command_queue_properties props = _queue.getInfo<CL_QUEUE_PROPERTIES>();
+
+    if(enable)
+    {
+        _queue = cl::CommandQueue(_context, device, props | CL_QUEUE_PROFILING_ENABLE);
+
+        // Intercept the kernel enqueues to retain their profiling events
+        _real_enqueue_ndrange = CLSymbols::get().clEnqueueNDRangeKernel_ptr;
+        auto interceptor      = [this](
+                                    cl_command_queue command_queue,
+                                    cl_kernel        kernel,
+                                    cl_uint          work_dim,
+                                    const size_t    *gwo,
+                                    const size_t    *gws,
+                                    const size_t    *lws,
+                                    cl_uint          num_events_in_wait_list,
+                                    const cl_event * event_wait_list,
+                                    cl_event *       event)
+        {
+            cl_event     tmp    = nullptr;
+            const cl_int retval = this->_real_enqueue_ndrange(command_queue, kernel, work_dim, gwo, gws, lws, num_events_in_wait_list, event_wait_list, &tmp);
+
+            PendingProfilingEvent pending;
+            pending.event = tmp;
+            pending.name  = cl::Kernel(kernel, true).getInfo<CL_KERNEL_FUNCTION_NAME>();
+            this->_pending_profiling_events.push_back(std::move(pending));
+
+            if(event != nullptr)
+            {
+                // Hand the caller its own reference to the intercepted event
+                clRetainEvent(tmp);
+                *event = tmp;
+            }
+            return retval;
+        };
+        CLSymbols::get().clEnqueueNDRangeKernel_ptr = interceptor;
+    }
+    else
+    {
+        CLSymbols::get().clEnqueueNDRangeKernel_ptr = _real_enqueue_ndrange;
+        _real_enqueue_ndrange                       = nullptr;
+        _queue = cl::CommandQueue(_context, device, props & ~static_cast<cl_command_queue_properties>(CL_QUEUE_PROFILING_ENABLE));
+    }
+    _kernel_timing = enable;
+}
+
+bool CLScheduler::kernel_timing() const
+{
+    return _kernel_timing;
+}
+
+std::map<std::string, CLScheduler::KernelTiming> CLScheduler::kernel_timings()
+{
+    if(!_pending_profiling_events.empty())
+    {
+        process_profiling_events(true);
+    }
+    return _kernel_timings;
+}
+
+void CLScheduler::clear_kernel_timings()
+{
+    _pending_profiling_events.clear();
+    _kernel_timings.clear();
+}
+
+void CLScheduler::process_profiling_events(bool wait)
+{
+    std::vector<PendingProfilingEvent> still_pending;
+    for(auto &pending : _pending_profiling_events)
+    {
+        if(wait)
+        {
+            pending.event.wait();
+        }
+        else if(pending.event.getInfo<CL_EVENT_COMMAND_EXECUTION_STATUS>() != CL_COMPLETE)
+        {
+            still_pending.push_back(std::move(pending));
+            continue;
+        }
+
+        const cl_ulong start = pending.event.getProfilingInfo<CL_PROFILING_COMMAND_START>();
+        const cl_ulong end   = pending.event.getProfilingInfo<CL_PROFILING_COMMAND_END>();
+        const uint64_t ns    = (end > start) ? (end - start) : 0;
+
+        KernelTiming &timing = _kernel_timings[pending.name];
+        timing.total_ns += ns;
+        timing.min_ns = std::min(timing.min_ns, ns);
+        timing.max_ns = std::max(timing.max_ns, ns);
+        ++timing.count;
+    }
+    _pending_profiling_events = std::move(still_pending);
+}
+
 void CLScheduler::sync()
 {
     _queue.finish();
+
+    // Every pending event has completed, the dependency state can be dropped
+    _pending_enqueues = 0;
+    _buffer_dependencies.clear();
+    _untracked_event = nullptr;
+
+    // Every retained profiling event has completed too and can be folded into the report
+    if(_kernel_timing)
+    {
+        process_profiling_events(false);
+    }
 }
 
 cl::Event CLScheduler::enqueue_sync_event()
@@ -92,7 +371,9 @@ bool CLScheduler::is_initialised() const
 std::once_flag CLScheduler::_initialize_symbols;
 
 CLScheduler::CLScheduler()
-    : _context(), _queue(), _target(GPUTarget::MIDGARD), _is_initialised(false), _cl_tuner(nullptr), _cl_default_static_tuner(nullptr)
+    : _context(), _queue(), _target(GPUTarget::MIDGARD), _is_initialised(false), _cl_tuner(nullptr), _cl_default_static_tuner(nullptr), _buffer_dependencies(), _untracked_event(), _out_of_order(false),
+      _job_chaining(false), _job_chaining_burst(16), _pending_enqueues(0), _queue_priority(CLQueuePriority::DEFAULT), _queue_throttle(CLQueueThrottle::DEFAULT), _frame_budget(false),
+      _frame_budget_batch(4), _real_enqueue_ndrange(nullptr), _pending_profiling_events(), _kernel_timings(), _kernel_timing(false)
 {
 }
 
@@ -149,6 +430,14 @@ void CLScheduler::init(cl::Context context, cl::CommandQueue queue, const cl::De
     _target         = get_target_from_device(device);
     _is_initialised = true;
     _cl_tuner       = cl_tuner;
+
+    // Maintain an on-disk program binary cache in the directory given by ARM_COMPUTE_CL_CACHE_DIR,
+    // unless a cache directory has already been set explicitly
+    const char *cache_dir = std::getenv("ARM_COMPUTE_CL_CACHE_DIR");
+    if(cache_dir != nullptr && CLKernelLibrary::get().binary_cache_path().empty())
+    {
+        CLKernelLibrary::get().set_binary_cache_path(cache_dir);
+    }
 }
 
 void CLScheduler::enqueue_common(ICLKernel &kernel, ITensorPack &tensors, bool flush)
@@ -166,14 +455,133 @@ void CLScheduler::enqueue_common(ICLKernel &kernel, ITensorPack &tensors, bool f
     }
 
     // Run kernel
-    inject_memory ? kernel.run_op(tensors, kernel.window(), _queue) : kernel.run(kernel.window(), _queue);
+    if(_out_of_order)
+    {
+        enqueue_out_of_order(kernel, tensors);
+    }
+    else
+    {
+        inject_memory ? kernel.run_op(tensors, kernel.window(), _queue) : kernel.run(kernel.window(), _queue);
+    }
 
-    if(flush)
+    // Fold completed profiling events in batches so the collection cost stays off the enqueue path
+    if(_kernel_timing && _pending_profiling_events.size() >= profiling_events_batch)
+    {
+        process_profiling_events(false);
+    }
+
+    if(_frame_budget)
+    {
+        // Split the command stream into small submissions so concurrent work on the device
+        // (e.g. UI rendering) finds scheduling points between them
+        if(++_pending_enqueues >= _frame_budget_batch)
+        {
+            _pending_enqueues = 0;
+            _queue.flush();
+        }
+    }
+    else if(_job_chaining)
+    {
+        // Accumulate kernels and flush in bursts to cut the per-kernel driver overhead
+        if(++_pending_enqueues >= _job_chaining_burst)
+        {
+            _pending_enqueues = 0;
+            _queue.flush();
+        }
+    }
+    else if(flush)
     {
         _queue.flush();
     }
 }
 
+void CLScheduler::enqueue_out_of_order(ICLKernel &kernel, ITensorPack &tensors)
+{
+    const bool inject_memory = !tensors.empty();
+
+    // Collect the events the kernel has to wait for from the buffers it accesses
+    std::vector<cl::Event> wait_events;
+    if(inject_memory)
+    {
+        if(_untracked_event() != nullptr)
+        {
+            wait_events.push_back(_untracked_event);
+        }
+        for(const auto &element : tensors)
+        {
+            const bool     is_write = element.second.tensor != nullptr;
+            const ITensor *tensor   = is_write ? element.second.tensor : element.second.ctensor;
+            const auto     cl_tensor = utils::cast::polymorphic_downcast<const ICLTensor *>(tensor);
+
+            const auto dependency = _buffer_dependencies.find(cl_tensor->cl_buffer().get());
+            if(dependency == _buffer_dependencies.end())
+            {
+                continue;
+            }
+            // Reads are ordered after the last write of the buffer, writes also after its pending reads
+            if(dependency->second.last_write() != nullptr)
+            {
+                wait_events.push_back(dependency->second.last_write);
+            }
+            if(is_write)
+            {
+                wait_events.insert(wait_events.end(), dependency->second.readers.begin(), dependency->second.readers.end());
+            }
+        }
+        if(!wait_events.empty())
+        {
+            // The header is pinned to OpenCL 1.1, the C symbol is reached through the dispatcher
+            std::vector<cl_event> wait_list;
+            wait_list.reserve(wait_events.size());
+            for(const auto &event : wait_events)
+            {
+                wait_list.push_back(event());
+            }
+            clEnqueueBarrierWithWaitList(_queue(), wait_list.size(), wait_list.data(), nullptr);
+        }
+    }
+    else
+    {
+        // Without tensor information the kernel is conservatively ordered after every command enqueued so far
+        clEnqueueBarrierWithWaitList(_queue(), 0, nullptr, nullptr);
+    }
+
+    inject_memory ? kernel.run_op(tensors, kernel.window(), _queue) : kernel.run(kernel.window(), _queue);
+
+    // Mark the completion of the kernel's commands
+    cl_event marker = nullptr;
+    clEnqueueMarkerWithWaitList(_queue(), 0, nullptr, &marker);
+    cl::Event kernel_done;
+    kernel_done = marker;
+
+    if(inject_memory)
+    {
+        for(const auto &element : tensors)
+        {
+            const bool     is_write = element.second.tensor != nullptr;
+            const ITensor *tensor   = is_write ? element.second.tensor : element.second.ctensor;
+            const auto     cl_tensor = utils::cast::polymorphic_downcast<const ICLTensor *>(tensor);
+
+            BufferDependency &dependency = _buffer_dependencies[cl_tensor->cl_buffer().get()];
+            if(is_write)
+            {
+                dependency.last_write = kernel_done;
+                dependency.readers.clear();
+            }
+            else
+            {
+                dependency.readers.push_back(kernel_done);
+            }
+        }
+    }
+    else
+    {
+        // The kernel might have touched any buffer: order everything enqueued later after it
+        _buffer_dependencies.clear();
+        _untracked_event = kernel_done;
+    }
+}
+
 void CLScheduler::enqueue(ICLKernel &kernel, bool flush)
 {
     ITensorPack pack;
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CL/CLStagingBufferPool.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/runtime/CL/CLRuntimeContext.h"
+#include "arm_compute/runtime/CL/CLScheduler.h"
+
+#include <cstring>
+
+namespace arm_compute
+{
+namespace
+{
+/** Upper bound on the number of idle buffers kept in the pool */
+constexpr size_t max_pooled_buffers = 8;
+/** Staging buffers are sized in multiples of this, so transfers of nearby sizes share a buffer */
+constexpr size_t size_granularity = 4096;
+} // namespace
+
+CLStagingBufferPool::CLStagingBufferPool(CLRuntimeContext *ctx)
+    : _ctx(ctx)
+{
+}
+
+CLStagingBufferPool::~CLStagingBufferPool()
+{
+    for(auto &staging : _free)
+    {
+        queue().enqueueUnmapMemObject(staging.buffer, staging.mapping);
+    }
+    if(!_free.empty())
+    {
+        queue().finish();
+    }
+}
+
+void CLStagingBufferPool::upload(const cl::Buffer &dst, const void *src, size_t size)
+{
+    ARM_COMPUTE_ERROR_ON(src == nullptr);
+
+    StagingBuffer staging = acquire(size);
+    std::memcpy(staging.mapping, src, size);
+    queue().enqueueWriteBuffer(dst, CL_TRUE, 0, size, staging.mapping);
+    release(std::move(staging));
+}
+
+void CLStagingBufferPool::download(void *dst, const cl::Buffer &src, size_t size)
+{
+    ARM_COMPUTE_ERROR_ON(dst == nullptr);
+
+    StagingBuffer staging = acquire(size);
+    queue().enqueueReadBuffer(src, CL_TRUE, 0, size, staging.mapping);
+    std::memcpy(dst, staging.mapping, size);
+    release(std::move(staging));
+}
+
+CLStagingBufferPool::StagingBuffer CLStagingBufferPool::acquire(size_t size)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        // Smallest pooled buffer that fits the transfer
+        auto best = _free.end();
+        for(auto it = _free.begin(); it != _free.end(); ++it)
+        {
+            if(it->size >= size && (best == _free.end() || it->size < best->size))
+            {
+                best = it;
+            }
+        }
+        if(best != _free.end())
+        {
+            StagingBuffer staging = std::move(*best);
+            _free.erase(best);
+            return staging;
+        }
+    }
+
+    StagingBuffer staging{};
+    staging.size    = ((size + size_granularity - 1) / size_granularity) * size_granularity;
+    staging.buffer  = cl::Buffer(context(), CL_MEM_ALLOC_HOST_PTR | CL_MEM_READ_WRITE, staging.size);
+    staging.mapping = queue().enqueueMapBuffer(staging.buffer, CL_TRUE, CL_MAP_READ | CL_MAP_WRITE, 0, staging.size);
+    return staging;
+}
+
+void CLStagingBufferPool::release(StagingBuffer &&staging)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if(_free.size() < max_pooled_buffers)
+        {
+            _free.emplace_back(std::move(staging));
+            return;
+        }
+    }
+    // Pool is full: unmap and let the buffer go
+    queue().enqueueUnmapMemObject(staging.buffer, staging.mapping);
+    queue().flush();
+}
+
+cl::CommandQueue &CLStagingBufferPool::queue()
+{
+    if(_ctx != nullptr)
+    {
+        return _ctx->gpu_scheduler()->queue();
+    }
+    return CLScheduler::get().queue();
+}
+
+cl::Context &CLStagingBufferPool::context()
+{
+    if(_ctx != nullptr)
+    {
+        return _ctx->gpu_scheduler()->context();
+    }
+    return CLScheduler::get().context();
+}
+} // namespace arm_compute
@@ -25,9 +25,20 @@
 
 #include "arm_compute/runtime/CL/CLRuntimeContext.h"
 #include "arm_compute/runtime/CL/CLScheduler.h"
+#include "arm_compute/runtime/CL/CLStagingBufferPool.h"
 
 namespace arm_compute
 {
+namespace
+{
+/** Staging pool shared by tensors created through the legacy singleton api. */
+CLStagingBufferPool &legacy_staging_pool()
+{
+    static CLStagingBufferPool pool(nullptr);
+    return pool;
+}
+} // namespace
+
 CLTensor::CLTensor(IRuntimeContext *ctx)
     : _allocator(this, static_cast<CLRuntimeContext *>(ctx)), _ctx(static_cast<CLRuntimeContext *>(ctx))
 {
@@ -73,6 +84,22 @@ void CLTensor::unmap()
     ICLTensor::unmap(_ctx == nullptr ? CLScheduler::get().queue() : _ctx->gpu_scheduler()->queue());
 }
 
+void CLTensor::copy_from_host(const void *src, size_t size)
+{
+    const size_t bytes = (size != 0) ? size : info()->total_size();
+    ARM_COMPUTE_ERROR_ON(bytes > info()->total_size());
+    CLStagingBufferPool &pool = (_ctx == nullptr) ? legacy_staging_pool() : _ctx->staging_pool();
+    pool.upload(cl_buffer(), src, bytes);
+}
+
+void CLTensor::copy_to_host(void *dst, size_t size) const
+{
+    const size_t bytes = (size != 0) ? size : info()->total_size();
+    ARM_COMPUTE_ERROR_ON(bytes > info()->total_size());
+    CLStagingBufferPool &pool = (_ctx == nullptr) ? legacy_staging_pool() : _ctx->staging_pool();
+    pool.download(dst, cl_buffer(), bytes);
+}
+
 uint8_t *CLTensor::do_map(cl::CommandQueue &q, bool blocking)
 {
     return _allocator.map(q, blocking);
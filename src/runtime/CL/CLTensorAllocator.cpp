@@ -23,6 +23,7 @@
  */
 #include "arm_compute/runtime/CL/CLTensorAllocator.h"
 
+#include "arm_compute/core/CL/CLKernelLibrary.h"
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/runtime/CL/CLRuntimeContext.h"
@@ -142,7 +143,10 @@ void CLTensorAllocator::allocate()
     }
     else
     {
-        _associated_memory_group->finalize_memory(_owner, _memory, info().total_size(), alignment());
+        // Offset based pools hand out sub-buffer views of one allocation, whose origins
+        // have to respect the base address alignment of the device
+        const size_t base_addr_align = CLKernelLibrary::get().get_device().getInfo<CL_DEVICE_MEM_BASE_ADDR_ALIGN>() / 8;
+        _associated_memory_group->finalize_memory(_owner, _memory, info().total_size(), std::max(alignment(), base_addr_align));
     }
 
     // Allocate and fill the quantization parameter arrays
@@ -185,6 +189,43 @@ Status CLTensorAllocator::import_memory(cl::Buffer buffer)
     return Status{};
 }
 
+Status CLTensorAllocator::import_memory(void *memory)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON(memory == nullptr);
+    ARM_COMPUTE_RETURN_ERROR_ON(_associated_memory_group != nullptr);
+
+    if(_ctx == nullptr)
+    {
+        auto legacy_ctx = CLCoreRuntimeContext(nullptr, CLScheduler::get().context(), CLScheduler::get().queue());
+        _memory.set_owned_region(support::cpp14::make_unique<CLImportedSVMMemoryRegion>(memory, info().total_size(), &legacy_ctx));
+    }
+    else
+    {
+        _memory.set_owned_region(support::cpp14::make_unique<CLImportedSVMMemoryRegion>(memory, info().total_size(), _ctx->core_runtime_context()));
+    }
+
+    info().set_is_resizable(false);
+    return Status{};
+}
+
+Status CLTensorAllocator::import_dmabuf(int fd, size_t size)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON(fd < 0);
+    ARM_COMPUTE_RETURN_ERROR_ON(size < info().total_size());
+    ARM_COMPUTE_RETURN_ERROR_ON(_associated_memory_group != nullptr);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(CLSymbols::get().clImportMemoryARM_ptr == nullptr, "The OpenCL driver does not expose clImportMemoryARM");
+
+    cl::Context context = (_ctx != nullptr) ? _ctx->core_runtime_context()->context() : CLScheduler::get().context();
+
+    const cl_import_properties_arm import_properties[] = { CL_IMPORT_TYPE_ARM, CL_IMPORT_TYPE_DMA_BUF_ARM, 0 };
+    cl_int                         err                 = CL_SUCCESS;
+    cl_mem                         imported            = clImportMemoryARM(context.get(), CL_MEM_READ_WRITE, import_properties, &fd, size, &err);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(err != CL_SUCCESS || imported == nullptr, "Failed to import the dma-buf into an OpenCL buffer");
+
+    // The import call hands over one reference, which the wrapper takes ownership of
+    return import_memory(cl::Buffer(imported, /* retainObject */ false));
+}
+
 void CLTensorAllocator::set_associated_memory_group(IMemoryGroup *associated_memory_group)
 {
     ARM_COMPUTE_ERROR_ON(associated_memory_group == nullptr);
@@ -24,22 +24,297 @@
 #include "arm_compute/runtime/CL/CLTuner.h"
 #include "arm_compute/runtime/CL/tuners/CLLWSList.h"
 
+#include "arm_compute/core/CL/CLKernelLibrary.h"
 #include "arm_compute/core/CL/ICLKernel.h"
 #include "arm_compute/core/Error.h"
 #include "arm_compute/runtime/CL/CLScheduler.h"
+#include "arm_compute/runtime/CL/tuners/Tuners.h"
 #include "support/StringSupport.h"
 
+#include <algorithm>
+#include <cctype>
 #include <cerrno>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <limits>
 #include <memory>
+#include <sstream>
 #include <string>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 namespace arm_compute
 {
+namespace
+{
+/* Number of LWS candidates benchmarked per kernel run in incremental tuning mode */
+constexpr size_t max_candidates_per_run = 3;
+
+/** Decompose a kernel configuration id into its non-numeric signature and its numeric shape tokens */
+void decompose_config_id(const std::string &config_id, std::string &signature, std::vector<float> &shape)
+{
+    std::istringstream ss(config_id);
+    std::string        token;
+    while(!std::getline(ss, token, '_').fail())
+    {
+        const bool is_numeric = !token.empty() && std::all_of(token.begin(), token.end(), [](char c)
+        {
+            return std::isdigit(static_cast<unsigned char>(c)) != 0;
+        });
+        if(is_numeric)
+        {
+            // Compare shapes in log space so that the match is relative rather than absolute
+            shape.push_back(std::log(1.f + support::cpp11::stoi(token)));
+            signature += "#_";
+        }
+        else
+        {
+            signature += token + "_";
+        }
+    }
+}
+
+/* Binary tuner file layout (all integers little-endian):
+ *
+ *   char[8]  magic "ACLTUNE1"
+ *   u32      file format version
+ *   u32      number of partitions
+ *   index, one record per partition:
+ *     u16 + bytes  device name
+ *     u32          tuning data version (@ref cl_tuner_data_version of the producer)
+ *     u32          number of entries
+ *     u64          partition offset from the start of the file
+ *     u64          partition size in bytes
+ *   partition data, one record per entry:
+ *     u16 + bytes  kernel configuration id
+ *     u32[3]       LWS (all zero encodes cl::NullRange)
+ *
+ * The index makes loads lazy: only the partition of the active device is parsed,
+ * partitions of other devices or of a different tuning data version stay untouched.
+ */
+constexpr char     tuner_file_magic[8] = { 'A', 'C', 'L', 'T', 'U', 'N', 'E', '1' };
+constexpr uint32_t tuner_file_version  = 1;
+
+/** Index record of one device partition in a binary tuner file */
+struct TunerFilePartition
+{
+    std::string          name{};         /**< Device name the entries were tuned on */
+    uint32_t             data_version{}; /**< Tuning data version the entries were produced with */
+    uint32_t             num_entries{};  /**< Number of LWS entries in the partition */
+    uint64_t             offset{};       /**< Partition offset from the start of the file */
+    uint64_t             size{};         /**< Partition size in bytes */
+    std::vector<uint8_t> data{};         /**< Raw partition bytes (only populated when rewriting the file) */
+};
+
+/** Read-only memory mapping of a tuner file. Invalid when the file cannot be opened */
+class MappedTunerFile final
+{
+public:
+    /** Map @p filename read-only */
+    explicit MappedTunerFile(const std::string &filename)
+    {
+        const int fd = open(filename.c_str(), O_RDONLY);
+        if(fd < 0)
+        {
+            return;
+        }
+        struct stat file_status;
+        if(fstat(fd, &file_status) == 0 && file_status.st_size > 0)
+        {
+            void *base = mmap(nullptr, file_status.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if(base != MAP_FAILED)
+            {
+                _data = static_cast<const uint8_t *>(base);
+                _size = file_status.st_size;
+            }
+        }
+        close(fd);
+    }
+    /** Prevent copies as the mapping is owned */
+    MappedTunerFile(const MappedTunerFile &) = delete;
+    MappedTunerFile &operator=(const MappedTunerFile &) = delete;
+    /** Release the mapping */
+    ~MappedTunerFile()
+    {
+        if(_data != nullptr)
+        {
+            munmap(const_cast<uint8_t *>(_data), _size);
+        }
+    }
+    /** Pointer to the mapped bytes */
+    const uint8_t *data() const
+    {
+        return _data;
+    }
+    /** Size of the mapping in bytes */
+    size_t size() const
+    {
+        return _size;
+    }
+    /** True if the file was mapped successfully */
+    bool valid() const
+    {
+        return _data != nullptr;
+    }
+
+private:
+    const uint8_t *_data{ nullptr };
+    size_t         _size{ 0 };
+};
+
+/** Bounds-checked little-endian cursor over a byte range */
+struct ByteReader
+{
+    const uint8_t *data; /**< Start of the readable range */
+    size_t         size; /**< Size of the readable range in bytes */
+    size_t         pos;  /**< Current read position */
+
+    /** Read one little-endian scalar */
+    template <typename T>
+    T read_le()
+    {
+        ARM_COMPUTE_ERROR_ON_MSG(pos + sizeof(T) > size, "Truncated tuning parameter file");
+        T value = 0;
+        for(size_t i = 0; i < sizeof(T); ++i)
+        {
+            value |= static_cast<T>(data[pos + i]) << (8 * i);
+        }
+        pos += sizeof(T);
+        return value;
+    }
+    /** Read @p len raw bytes as a string */
+    std::string read_string(size_t len)
+    {
+        ARM_COMPUTE_ERROR_ON_MSG(pos + len > size, "Truncated tuning parameter file");
+        std::string value(reinterpret_cast<const char *>(data + pos), len);
+        pos += len;
+        return value;
+    }
+};
+
+/** Append one little-endian scalar to a byte buffer */
+template <typename T>
+void append_le(std::vector<uint8_t> &out, T value)
+{
+    for(size_t i = 0; i < sizeof(T); ++i)
+    {
+        out.push_back(static_cast<uint8_t>(value >> (8 * i)));
+    }
+}
+
+/** True if the mapped file starts with the binary tuner file magic */
+bool has_tuner_file_magic(const MappedTunerFile &file)
+{
+    return file.valid() && file.size() >= sizeof(tuner_file_magic) && memcmp(file.data(), tuner_file_magic, sizeof(tuner_file_magic)) == 0;
+}
+
+/** Name of the device the scheduler runs on, used as partition key */
+std::string tuning_device_name()
+{
+    cl_int            err  = CL_SUCCESS;
+    const std::string name = CLKernelLibrary::get().get_device().getInfo<CL_DEVICE_NAME>(&err);
+    return (err == CL_SUCCESS && !name.empty()) ? name : std::string("unknown");
+}
+
+/** Parse the partition index that follows the header. Partition data is not touched */
+std::vector<TunerFilePartition> read_partition_index(ByteReader &reader)
+{
+    const uint32_t version = reader.read_le<uint32_t>();
+    ARM_COMPUTE_ERROR_ON_MSG_VAR(version != tuner_file_version, "Unsupported tuner file version %u", version);
+    const uint32_t num_partitions = reader.read_le<uint32_t>();
+
+    std::vector<TunerFilePartition> partitions;
+    partitions.reserve(num_partitions);
+    for(uint32_t p = 0; p < num_partitions; ++p)
+    {
+        TunerFilePartition partition;
+        partition.name         = reader.read_string(reader.read_le<uint16_t>());
+        partition.data_version = reader.read_le<uint32_t>();
+        partition.num_entries  = reader.read_le<uint32_t>();
+        partition.offset       = reader.read_le<uint64_t>();
+        partition.size         = reader.read_le<uint64_t>();
+        ARM_COMPUTE_ERROR_ON_MSG(partition.offset + partition.size > reader.size, "Truncated tuning parameter file");
+        partitions.emplace_back(std::move(partition));
+    }
+    return partitions;
+}
+
+/** Import the partition of the active device from a binary tuner file
+ *
+ * @return True if @p filename is a binary tuner file, false if the caller should fall back to the legacy CSV parser.
+ */
+bool load_binary_tuning_file(const std::string &filename, std::unordered_map<std::string, cl::NDRange> &table)
+{
+    MappedTunerFile file(filename);
+    if(!file.valid())
+    {
+        ARM_COMPUTE_ERROR_VAR("Failed to open '%s' (%s [%d])", filename.c_str(), strerror(errno), errno);
+    }
+    if(!has_tuner_file_magic(file))
+    {
+        return false;
+    }
+
+    ByteReader reader{ file.data(), file.size(), sizeof(tuner_file_magic) };
+    const auto partitions  = read_partition_index(reader);
+    const auto device_name = tuning_device_name();
+    for(const auto &partition : partitions)
+    {
+        // Entries tuned on another device or against a different tuning data version are skipped, not misapplied
+        if(partition.name != device_name || partition.data_version != cl_tuner_data_version)
+        {
+            continue;
+        }
+        ByteReader entries{ file.data(), static_cast<size_t>(partition.offset + partition.size), static_cast<size_t>(partition.offset) };
+        for(uint32_t e = 0; e < partition.num_entries; ++e)
+        {
+            const std::string kernel_id = entries.read_string(entries.read_le<uint16_t>());
+            cl::NDRange       lws(1, 1, 1);
+            for(int i = 0; i < 3; i++)
+            {
+                lws.get()[i] = entries.read_le<uint32_t>();
+            }
+            // If all dimensions are 0: reset to NullRange (i.e nullptr)
+            if(lws[0] == 0 && lws[1] == 0 && lws[2] == 0)
+            {
+                lws = cl::NullRange;
+            }
+            table[kernel_id] = lws;
+        }
+        break;
+    }
+    return true;
+}
+
+/** Read all partitions of an existing binary tuner file with their raw data, so a rewrite can preserve them.
+ * Leaves @p partitions empty when the file is missing or not a binary tuner file */
+void read_binary_partitions(const std::string &filename, std::vector<TunerFilePartition> &partitions)
+{
+    MappedTunerFile file(filename);
+    if(!has_tuner_file_magic(file))
+    {
+        return;
+    }
+    ByteReader reader{ file.data(), file.size(), sizeof(tuner_file_magic) };
+    partitions = read_partition_index(reader);
+    for(auto &partition : partitions)
+    {
+        partition.data.assign(file.data() + partition.offset, file.data() + partition.offset + partition.size);
+    }
+}
+} // namespace
+
 CLTuner::CLTuner(bool tune_new_kernels)
-    : real_clEnqueueNDRangeKernel(nullptr), _lws_table(), _kernel_event(), _tune_new_kernels(tune_new_kernels), _tuner_mode(CLTunerMode::NORMAL)
+    : real_clEnqueueNDRangeKernel(nullptr), _lws_table(), _similar_lws_table(), _tuning_states(), _static_tuner(nullptr), _kernel_event(), _tune_new_kernels(tune_new_kernels),
+      _tune_incrementally(false), _tuner_mode(CLTunerMode::NORMAL)
 {
 }
 
@@ -61,6 +336,15 @@ bool CLTuner::tune_new_kernels() const
     return _tune_new_kernels;
 }
 
+void CLTuner::set_tune_incrementally(bool tune_incrementally)
+{
+    _tune_incrementally = tune_incrementally;
+}
+bool CLTuner::tune_incrementally() const
+{
+    return _tune_incrementally;
+}
+
 void CLTuner::set_tuner_mode(CLTunerMode mode)
 {
     _tuner_mode = mode;
@@ -72,7 +356,19 @@ CLTunerMode CLTuner::get_tuner_mode() const
 
 void CLTuner::tune_kernel_static(ICLKernel &kernel)
 {
-    ARM_COMPUTE_UNUSED(kernel);
+    // In incremental mode the kernel runs with the static heuristic of the GPU target until its
+    // sweep completes, instead of paying for a full blocking sweep on the first run
+    if(_tune_incrementally)
+    {
+        if(_static_tuner == nullptr)
+        {
+            _static_tuner = tuners::TunerFactory::create_tuner(CLScheduler::get().target());
+        }
+        if(_static_tuner != nullptr)
+        {
+            _static_tuner->tune_kernel_static(kernel);
+        }
+    }
 }
 
 void CLTuner::tune_kernel_dynamic(ICLKernel &kernel)
@@ -95,14 +391,38 @@ void CLTuner::tune_kernel_dynamic(ICLKernel &kernel, ITensorPack &tensors)
         {
             if(_tune_new_kernels)
             {
-                // Find the optimal LWS for the kernel
-                cl::NDRange opt_lws = find_optimal_lws(kernel, tensors);
-
-                // Insert the optimal LWS in the table
-                add_lws_to_table(config_id, opt_lws);
-
-                // Set Local-Workgroup-Size
-                kernel.set_lws_hint(opt_lws);
+                if(_tune_incrementally)
+                {
+                    // Benchmark only a few candidates per run and swap in the best LWS found so far
+                    tune_kernel_incremental(kernel, tensors, config_id);
+                }
+                else
+                {
+                    // Find the optimal LWS for the kernel
+                    cl::NDRange opt_lws = find_optimal_lws(kernel, tensors);
+
+                    // Insert the optimal LWS in the table
+                    add_lws_to_table(config_id, opt_lws);
+
+                    // Set Local-Workgroup-Size
+                    kernel.set_lws_hint(opt_lws);
+                }
+            }
+            else
+            {
+                // Fall back to the closest tuned entry of the same shape class instead of running an in-production sweep
+                auto q = _similar_lws_table.find(config_id);
+                if(q == _similar_lws_table.end())
+                {
+                    cl::NDRange similar_lws = cl::NullRange;
+                    find_similar_lws(config_id, similar_lws);
+                    q = _similar_lws_table.emplace(config_id, similar_lws).first;
+                }
+                if(q->second.dimensions() != 0)
+                {
+                    // Set Local-Workgroup-Size
+                    kernel.set_lws_hint(q->second);
+                }
             }
         }
         else
@@ -116,6 +436,183 @@ void CLTuner::tune_kernel_dynamic(ICLKernel &kernel, ITensorPack &tensors)
 void CLTuner::add_lws_to_table(const std::string &kernel_id, cl::NDRange optimal_lws)
 {
     _lws_table.emplace(kernel_id, optimal_lws);
+
+    // The closest tuned entries might have changed
+    _similar_lws_table.clear();
+}
+
+bool CLTuner::find_similar_lws(const std::string &config_id, cl::NDRange &lws) const
+{
+    std::string        signature;
+    std::vector<float> shape;
+    decompose_config_id(config_id, signature, shape);
+
+    // Nothing to match on for ids without numeric tokens
+    if(shape.empty())
+    {
+        return false;
+    }
+
+    bool  found         = false;
+    float best_distance = std::numeric_limits<float>::max();
+
+    for(auto const &entry : _lws_table)
+    {
+        std::string        entry_signature;
+        std::vector<float> entry_shape;
+        decompose_config_id(entry.first, entry_signature, entry_shape);
+
+        // Only entries of the same shape class are comparable
+        if(entry_signature != signature)
+        {
+            continue;
+        }
+
+        float distance = 0.f;
+        for(size_t i = 0; i < shape.size(); ++i)
+        {
+            const float diff = shape[i] - entry_shape[i];
+            distance += diff * diff;
+        }
+
+        if(distance < best_distance)
+        {
+            best_distance = distance;
+            lws           = entry.second;
+            found         = true;
+        }
+    }
+
+    return found;
+}
+
+cl_ulong CLTuner::time_kernel(ICLKernel &kernel, ITensorPack &tensors, cl::CommandQueue &queue_profiler)
+{
+    // Run the kernel
+    const bool inject_memory = !tensors.empty();
+    inject_memory ? kernel.run_op(tensors, kernel.window(), queue_profiler) : kernel.run(kernel.window(), queue_profiler);
+
+    queue_profiler.finish();
+
+    const cl_ulong start = _kernel_event.getProfilingInfo<CL_PROFILING_COMMAND_START>();
+    const cl_ulong end   = _kernel_event.getProfilingInfo<CL_PROFILING_COMMAND_END>();
+    _kernel_event        = nullptr;
+
+    return end - start;
+}
+
+void CLTuner::tune_kernel_incremental(ICLKernel &kernel, ITensorPack &tensors, const std::string &config_id)
+{
+    auto state_it = _tuning_states.find(config_id);
+    if(state_it == _tuning_states.end())
+    {
+        IncrementalState state;
+        state.lws_list = cl_tuner::CLLWSListFactory::get_lws_list(_tuner_mode, ICLKernel::gws_from_window(kernel.window()));
+        state_it       = _tuning_states.emplace(config_id, std::move(state)).first;
+    }
+    IncrementalState &state = state_it->second;
+
+    // The kernel keeps running with its current hint (the static heuristic, then the best candidate
+    // found so far) until a faster one is measured
+    const cl::NDRange lws_on_entry = kernel.lws_hint();
+
+    // Profiling queue
+    cl::CommandQueue queue_profiler;
+
+    // Extract real OpenCL function to intercept
+    if(real_clEnqueueNDRangeKernel == nullptr)
+    {
+        real_clEnqueueNDRangeKernel = CLSymbols::get().clEnqueueNDRangeKernel_ptr;
+    }
+
+    // Get the default queue
+    cl::CommandQueue default_queue = CLScheduler::get().queue();
+
+    // Check if we can use the OpenCL timer with the default queue
+    cl_command_queue_properties props = default_queue.getInfo<CL_QUEUE_PROPERTIES>();
+
+    if((props & CL_QUEUE_PROFILING_ENABLE) == 0)
+    {
+        // Set the queue for profiling
+        queue_profiler = cl::CommandQueue(CLScheduler::get().context(), props | CL_QUEUE_PROFILING_ENABLE);
+    }
+    else
+    {
+        queue_profiler = default_queue;
+    }
+
+    // Start intercepting enqueues:
+    auto interceptor = [this](cl_command_queue command_queue, cl_kernel kernel, cl_uint work_dim, const size_t *gwo, const size_t *gws, const size_t *lws, cl_uint num_events_in_wait_list,
+                              const cl_event * event_wait_list, cl_event * event)
+    {
+        if(this->kernel_event_is_set())
+        {
+            // If the event is already set it means the kernel enqueue is sliced: given that we only time the first slice we can save time by skipping the other enqueues.
+            return CL_SUCCESS;
+        }
+        cl_event tmp;
+        cl_int   retval = this->real_clEnqueueNDRangeKernel(command_queue, kernel, work_dim, gwo, gws, lws, num_events_in_wait_list, event_wait_list, &tmp);
+
+        // Set OpenCL event
+        this->set_cl_kernel_event(tmp);
+
+        if(event != nullptr)
+        {
+            //return cl_event from the intercepted call
+            clRetainEvent(tmp);
+            *event = tmp;
+        }
+        return retval;
+    };
+    CLSymbols::get().clEnqueueNDRangeKernel_ptr = interceptor;
+
+    // The first run of the sweep times the hint the kernel would run with anyway, to be used as baseline
+    if(state.best_time == std::numeric_limits<cl_ulong>::max())
+    {
+        state.best_time = time_kernel(kernel, tensors, queue_profiler);
+    }
+
+    size_t num_benchmarked = 0;
+    while(num_benchmarked < max_candidates_per_run && state.next_candidate < state.lws_list->size())
+    {
+        cl::NDRange lws_test    = (*state.lws_list)[state.next_candidate++];
+        auto        x           = lws_test[0];
+        auto        y           = lws_test[1];
+        auto        z           = lws_test[2];
+        const bool  invalid_lws = (x * y * z > kernel.get_max_workgroup_size()) || (x == 1 && y == 1 && z == 1);
+
+        if(invalid_lws)
+        {
+            continue;
+        }
+
+        //Set the Local-Workgroup-Size
+        kernel.set_lws_hint(lws_test);
+
+        const cl_ulong diff = time_kernel(kernel, tensors, queue_profiler);
+        ++num_benchmarked;
+
+        // Check the execution time
+        if(diff < state.best_time)
+        {
+            state.best_time = diff;
+            state.best_lws  = cl::NDRange(x, y, z);
+        }
+    }
+
+    // Restore real function
+    CLSymbols::get().clEnqueueNDRangeKernel_ptr = real_clEnqueueNDRangeKernel;
+
+    // Swap in the best LWS found so far
+    const cl::NDRange best_lws = (state.best_lws.dimensions() != 0) ? state.best_lws : lws_on_entry;
+    kernel.set_lws_hint(best_lws);
+
+    if(state.next_candidate >= state.lws_list->size())
+    {
+        // The sweep is complete: record the winner and drop the sweep state
+        add_lws_to_table(config_id, best_lws);
+        _tuning_states.erase(state_it);
+    }
 }
 
 cl::NDRange CLTuner::find_optimal_lws(ICLKernel &kernel, ITensorPack &tensors)
@@ -173,15 +670,7 @@ cl::NDRange CLTuner::find_optimal_lws(ICLKernel &kernel, ITensorPack &tensors)
     cl::NDRange gws = ICLKernel::gws_from_window(kernel.window());
 
     // Run the kernel with default lws to be used as baseline
-    const bool inject_memory = !tensors.empty();
-    inject_memory ? kernel.run_op(tensors, kernel.window(), queue_profiler) : kernel.run(kernel.window(), queue_profiler);
-
-    queue_profiler.finish();
-
-    const cl_ulong start         = _kernel_event.getProfilingInfo<CL_PROFILING_COMMAND_START>();
-    const cl_ulong end           = _kernel_event.getProfilingInfo<CL_PROFILING_COMMAND_END>();
-    cl_ulong       min_exec_time = end - start;
-    _kernel_event                = nullptr;
+    cl_ulong min_exec_time = time_kernel(kernel, tensors, queue_profiler);
 
     cl::NDRange opt_lws = cl::NullRange;
 
@@ -204,14 +693,7 @@ cl::NDRange CLTuner::find_optimal_lws(ICLKernel &kernel, ITensorPack &tensors)
         kernel.set_lws_hint(lws_test);
 
         // Run the kernel
-        inject_memory ? kernel.run_op(tensors, kernel.window(), queue_profiler) : kernel.run(kernel.window(), queue_profiler);
-
-        queue_profiler.finish();
-
-        const cl_ulong start = _kernel_event.getProfilingInfo<CL_PROFILING_COMMAND_START>();
-        const cl_ulong end   = _kernel_event.getProfilingInfo<CL_PROFILING_COMMAND_END>();
-        const cl_ulong diff  = end - start;
-        _kernel_event        = nullptr;
+        const cl_ulong diff = time_kernel(kernel, tensors, queue_profiler);
 
         // Check the execution time
         if(diff < min_exec_time)
@@ -240,6 +722,17 @@ const std::unordered_map<std::string, cl::NDRange> &CLTuner::lws_table() const
 
 void CLTuner::load_from_file(const std::string &filename)
 {
+    std::unordered_map<std::string, cl::NDRange> table;
+    if(load_binary_tuning_file(filename, table))
+    {
+        for(auto const &entry : table)
+        {
+            add_lws_to_table(entry.first, entry.second);
+        }
+        return;
+    }
+
+    // Legacy CSV format
     std::ifstream fs;
     fs.exceptions(std::ifstream::badbit);
     fs.open(filename, std::ios::in);
@@ -279,13 +772,75 @@ void CLTuner::load_from_file(const std::string &filename)
 
 void CLTuner::save_to_file(const std::string &filename) const
 {
-    std::ofstream fs;
-    fs.exceptions(std::ifstream::failbit | std::ifstream::badbit);
-    fs.open(filename, std::ios::out);
+    const bool legacy_csv = filename.size() >= 4 && filename.compare(filename.size() - 4, 4, ".csv") == 0;
+    if(legacy_csv)
+    {
+        std::ofstream fs;
+        fs.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+        fs.open(filename, std::ios::out);
+        for(auto const &kernel_data : _lws_table)
+        {
+            fs << kernel_data.first << ";" << kernel_data.second[0] << ";" << kernel_data.second[1] << ";" << kernel_data.second[2] << std::endl;
+        }
+        fs.close();
+        return;
+    }
+
+    // Keep the partitions of the other devices already in the file and replace ours
+    std::vector<TunerFilePartition> partitions;
+    read_binary_partitions(filename, partitions);
+    const std::string device_name = tuning_device_name();
+    partitions.erase(std::remove_if(partitions.begin(), partitions.end(), [&device_name](const TunerFilePartition & partition)
+    {
+        return partition.name == device_name;
+    }),
+    partitions.end());
+
+    TunerFilePartition current;
+    current.name         = device_name;
+    current.data_version = cl_tuner_data_version;
+    current.num_entries  = _lws_table.size();
     for(auto const &kernel_data : _lws_table)
     {
-        fs << kernel_data.first << ";" << kernel_data.second[0] << ";" << kernel_data.second[1] << ";" << kernel_data.second[2] << std::endl;
+        ARM_COMPUTE_ERROR_ON(kernel_data.first.size() > std::numeric_limits<uint16_t>::max());
+        append_le<uint16_t>(current.data, kernel_data.first.size());
+        current.data.insert(current.data.end(), kernel_data.first.begin(), kernel_data.first.end());
+        for(int i = 0; i < 3; i++)
+        {
+            append_le<uint32_t>(current.data, kernel_data.second[i]);
+        }
+    }
+    partitions.emplace_back(std::move(current));
+
+    // Lay the partitions out after the header and index
+    uint64_t offset = sizeof(tuner_file_magic) + 2 * sizeof(uint32_t);
+    for(const auto &partition : partitions)
+    {
+        offset += sizeof(uint16_t) + partition.name.size() + 2 * sizeof(uint32_t) + 2 * sizeof(uint64_t);
+    }
+    std::vector<uint8_t> out;
+    out.insert(out.end(), tuner_file_magic, tuner_file_magic + sizeof(tuner_file_magic));
+    append_le<uint32_t>(out, tuner_file_version);
+    append_le<uint32_t>(out, partitions.size());
+    for(const auto &partition : partitions)
+    {
+        append_le<uint16_t>(out, partition.name.size());
+        out.insert(out.end(), partition.name.begin(), partition.name.end());
+        append_le<uint32_t>(out, partition.data_version);
+        append_le<uint32_t>(out, partition.num_entries);
+        append_le<uint64_t>(out, offset);
+        append_le<uint64_t>(out, partition.data.size());
+        offset += partition.data.size();
+    }
+    for(const auto &partition : partitions)
+    {
+        out.insert(out.end(), partition.data.begin(), partition.data.end());
     }
+
+    std::ofstream fs;
+    fs.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+    fs.open(filename, std::ios::out | std::ios::binary);
+    fs.write(reinterpret_cast<const char *>(out.data()), out.size());
     fs.close();
 }
 } // namespace arm_compute
@@ -110,7 +110,9 @@ DeconvolutionMethod CLDeconvolutionLayer::get_deconvolution_method(const ITensor
     const size_t idx_w = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
     const size_t idx_h = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
 
-    if(weights->dimension(idx_w) != deconv_info.stride().first || weights->dimension(idx_h) != deconv_info.stride().second)
+    // The GEMM-based path computes the output directly from the compact input and only needs the filter to cover the
+    // stride; a filter smaller than the stride leaves gaps that only the zero-stuffed direct path can express
+    if(weights->dimension(idx_w) < deconv_info.stride().first || weights->dimension(idx_h) < deconv_info.stride().second)
     {
         return DeconvolutionMethod::DIRECT;
     }
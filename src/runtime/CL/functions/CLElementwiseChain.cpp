@@ -21,33 +21,22 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
-#include "arm_compute/core/TracePoint.h"
+#include "arm_compute/runtime/CL/functions/CLElementwiseChain.h"
 
-#include "arm_compute/core/NEON/kernels/NELKTrackerKernel.h"
-#include "arm_compute/core/NEON/kernels/assembly/INEGEMMWrapperKernel.h"
-#include "arm_compute/core/NEON/kernels/convolution/common/convolution.hpp"
-#include "utils/TypePrinter.h"
-
-#include <memory>
+#include "arm_compute/core/CL/ICLTensor.h"
+#include "support/MemorySupport.h"
 
 namespace arm_compute
 {
-std::string to_string(const PaddingType &arg)
+void CLElementwiseChain::configure(const std::vector<const ICLTensor *> &inputs, ICLTensor *output, const std::vector<ElementwiseChainOp> &ops, const ActivationLayerInfo &act_info)
 {
-    return ((arg == PADDING_SAME) ? "PADDING_SAME" : "PADDING_VALID");
+    auto k = arm_compute::support::cpp14::make_unique<CLElementwiseChainKernel>();
+    k->configure(inputs, output, ops, act_info);
+    _kernel = std::move(k);
 }
 
-TRACE_TO_STRING(INELKInternalKeypointArray)
-TRACE_TO_STRING(std::unique_ptr<INEGEMMWrapperKernel>)
-
-CONST_PTR_CLASS(INELKInternalKeypointArray)
-CONST_PTR_CLASS(std::unique_ptr<INEGEMMWrapperKernel>)
-
-template <>
-TracePoint::Args &&operator<<(TracePoint::Args &&tp, const PaddingType &arg)
+Status CLElementwiseChain::validate(const std::vector<const ITensorInfo *> &inputs, const ITensorInfo *output, const std::vector<ElementwiseChainOp> &ops, const ActivationLayerInfo &act_info)
 {
-    tp.args.push_back("PaddingType(" + to_string(arg) + ")");
-    return std::move(tp);
+    return CLElementwiseChainKernel::validate(inputs, output, ops, act_info);
 }
-
 } // namespace arm_compute
@@ -225,6 +225,11 @@ void CLGEMMConvolutionLayer::configure(const CLCompileContext &compile_context,
     _skip_im2col      = (data_layout == DataLayout::NHWC && kernel_width == 1 && kernel_height == 1 && conv_info.stride().first == 1 && conv_info.stride().second == 1);
     _skip_col2im      = data_layout == DataLayout::NHWC;
 
+    if(_weights_manager)
+    {
+        _weights_manager->manage(weights);
+    }
+
     // Only for quantize there are few cases where we cannot fuse the activation function in GEMM
     _fuse_activation = true;
 
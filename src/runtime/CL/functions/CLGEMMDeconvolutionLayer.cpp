@@ -132,8 +132,8 @@ Status CLGEMMDeconvolutionLayer::validate(const ITensorInfo *input, const ITenso
     const size_t idx_h = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
     const size_t idx_b = get_data_layout_dimension_index(data_layout, DataLayoutDimension::BATCHES);
 
-    ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(idx_w) != deconv_info.stride().first);
-    ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(idx_h) != deconv_info.stride().second);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(idx_w) < deconv_info.stride().first);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(idx_h) < deconv_info.stride().second);
 
     TensorShape nhwc_weights_shape = weights->tensor_shape();
     TensorShape nhwc_input_shape   = input->tensor_shape();
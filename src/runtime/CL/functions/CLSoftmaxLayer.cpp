@@ -36,8 +36,8 @@ namespace arm_compute
 {
 template <bool IS_LOG>
 CLSoftmaxLayerGeneric<IS_LOG>::CLSoftmaxLayerGeneric(std::shared_ptr<IMemoryManager> memory_manager)
-    : _memory_group(std::move(memory_manager)), _max_shift_exp_sum_kernel(), _norm_kernel(), _flatten_ptr(), _reshape(), _max(), _sum(), _tmp(), _input_flattened(), _output_flattened(),
-      _needs_flattening(false)
+    : _memory_group(std::move(memory_manager)), _max_shift_exp_sum_kernel(), _norm_kernel(), _fused_kernel(), _flatten_ptr(), _reshape(), _max(), _sum(), _tmp(), _input_flattened(),
+      _output_flattened(), _needs_flattening(false), _run_fused(false)
 {
 }
 
@@ -116,6 +116,43 @@ void CLSoftmaxLayerGeneric<IS_LOG>::configure(const CLCompileContext &compile_co
     // or it is the original input case (2D case)
     const ICLTensor *input_2D = (_needs_flattening ? &_input_flattened : input);
 
+    SoftmaxKernelInfo softmax_info;
+    softmax_info.beta            = beta;
+    softmax_info.is_log          = IS_LOG;
+    softmax_info.input_data_type = input_2D->info()->data_type();
+
+    // A single-launch fused kernel covers the whole pipeline for the smaller float rows,
+    // avoiding the intermediate global tensors and the extra kernel launches
+    _run_fused = CLLogits1DFusedSoftmaxKernel::is_fused_supported(input_2D->info(), softmax_info);
+
+    if(_run_fused)
+    {
+        _fused_kernel.set_target(CLScheduler::get().target());
+
+        if(_needs_flattening)
+        {
+            // Add to the memory manager _output_flattened
+            _memory_group.manage(&_output_flattened);
+
+            // The fused kernel stores the result in a flat output tensor
+            _fused_kernel.configure(compile_context, input_2D, &_output_flattened, softmax_info);
+
+            // Reshape the flat output into a the requested (4D) output
+            _reshape.configure(compile_context, &_output_flattened, output);
+
+            // Allocate the intermediate flat tensors
+            _input_flattened.allocator()->allocate();
+            _output_flattened.allocator()->allocate();
+        }
+        else
+        {
+            // Softmax 2D case
+            _fused_kernel.configure(compile_context, input_2D, output, softmax_info);
+        }
+
+        return;
+    }
+
     // Create intermediate tensors shapes
     TensorInfo input_info    = input_2D->info()->clone()->reset_padding().set_is_resizable(true);
     DataType   tmp_data_type = is_data_type_quantized_asymmetric(input_2D->info()->data_type()) ? DataType::S32 : input_2D->info()->data_type();
@@ -135,11 +172,6 @@ void CLSoftmaxLayerGeneric<IS_LOG>::configure(const CLCompileContext &compile_co
     _memory_group.manage(&_max);
     _memory_group.manage(&_sum);
 
-    SoftmaxKernelInfo softmax_info;
-    softmax_info.beta            = beta;
-    softmax_info.is_log          = IS_LOG;
-    softmax_info.input_data_type = input_2D->info()->data_type();
-
     // Configure kernels
     _max_shift_exp_sum_kernel.configure(compile_context, input_2D, &_max, &_tmp, &_sum, softmax_info);
 
@@ -193,10 +225,14 @@ Status CLSoftmaxLayerGeneric<IS_LOG>::validate(const ITensorInfo *input, const I
 
     const bool needs_flattening = (first_n_reduce_axes > 1);
 
+    // Create the 2D tensor info the kernels operate on (flattened if needed)
+    TensorInfo tensor_info_flat;
+    const ITensorInfo *input_2D = input;
+
     if(needs_flattening)
     {
         const TensorShape shape_flatten = misc::shape_calculator::compute_softmax_shape(input, first_n_reduce_axes);
-        TensorInfo        tensor_info_flat(input->clone()->set_tensor_shape(shape_flatten).set_is_resizable(true));
+        tensor_info_flat                = TensorInfo(input->clone()->set_tensor_shape(shape_flatten).set_is_resizable(true));
 
         if(first_n_reduce_axes == 3)
         {
@@ -206,6 +242,8 @@ Status CLSoftmaxLayerGeneric<IS_LOG>::validate(const ITensorInfo *input, const I
         {
             ARM_COMPUTE_RETURN_ON_ERROR(CLReshapeLayer::validate(input, &tensor_info_flat));
         }
+
+        input_2D = &tensor_info_flat;
     }
 
     SoftmaxKernelInfo softmax_info;
@@ -213,13 +251,15 @@ Status CLSoftmaxLayerGeneric<IS_LOG>::validate(const ITensorInfo *input, const I
     softmax_info.is_log          = IS_LOG;
     softmax_info.input_data_type = input->data_type();
 
-    ARM_COMPUTE_RETURN_ON_ERROR(CLLogits1DMaxShiftExpSumKernel::validate(input, &tensor_info_max, &tensor_info_tmp, &tensor_info_sum));
-    ARM_COMPUTE_RETURN_ON_ERROR(CLLogits1DNormKernel::validate(&tensor_info_tmp, &tensor_info_sum, output, softmax_info));
-
-    if(needs_flattening)
+    if(CLLogits1DFusedSoftmaxKernel::is_fused_supported(input_2D, softmax_info))
     {
-        const TensorShape shape_flatten = misc::shape_calculator::compute_softmax_shape(input);
-        TensorInfo        tensor_info_flat(input->clone()->set_tensor_shape(shape_flatten).set_is_resizable(true));
+        TensorInfo tensor_info_output_flat(input_2D->clone()->set_is_resizable(true));
+        ARM_COMPUTE_RETURN_ON_ERROR(CLLogits1DFusedSoftmaxKernel::validate(input_2D, needs_flattening ? &tensor_info_output_flat : output, softmax_info));
+    }
+    else
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(CLLogits1DMaxShiftExpSumKernel::validate(input, &tensor_info_max, &tensor_info_tmp, &tensor_info_sum));
+        ARM_COMPUTE_RETURN_ON_ERROR(CLLogits1DNormKernel::validate(&tensor_info_tmp, &tensor_info_sum, output, softmax_info));
     }
 
     return Status{};
@@ -235,8 +275,15 @@ void           CLSoftmaxLayerGeneric<IS_LOG>::run()
         _flatten_ptr->run();
     }
 
-    CLScheduler::get().enqueue(_max_shift_exp_sum_kernel, false);
-    CLScheduler::get().enqueue(_norm_kernel, !_needs_flattening);
+    if(_run_fused)
+    {
+        CLScheduler::get().enqueue(_fused_kernel, !_needs_flattening);
+    }
+    else
+    {
+        CLScheduler::get().enqueue(_max_shift_exp_sum_kernel, false);
+        CLScheduler::get().enqueue(_norm_kernel, !_needs_flattening);
+    }
 
     if(_needs_flattening)
     {
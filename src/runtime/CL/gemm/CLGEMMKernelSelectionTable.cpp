@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CL/gemm/CLGEMMKernelSelectionTable.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Utils.h"
+
+#include <fstream>
+#include <sstream>
+#include <utility>
+
+namespace arm_compute
+{
+namespace cl_gemm
+{
+namespace
+{
+/** Build the table lookup key for the given selection parameters
+ *
+ * @param[in] data_type       Data type of the GEMM
+ * @param[in] m               Number of rows for the lhs matrix
+ * @param[in] n               Number of columns for the rhs matrix
+ * @param[in] k               Number of rows for the rhs matrix
+ * @param[in] is_rhs_constant True if the content of the rhs matrix is constant
+ *
+ * @return The lookup key
+ */
+std::string table_key(DataType data_type, unsigned int m, unsigned int n, unsigned int k, bool is_rhs_constant)
+{
+    std::ostringstream key;
+    key << string_from_data_type(data_type) << "_" << m << "_" << n << "_" << k << "_" << is_rhs_constant;
+    return key.str();
+}
+
+/** Convert a data type name as used in the table file to the corresponding @ref DataType
+ *
+ * @param[in] name Data type name
+ *
+ * @return The data type
+ */
+DataType data_type_from_string(const std::string &name)
+{
+    static const std::map<std::string, DataType> data_types =
+    {
+        { "F32", DataType::F32 },
+        { "F16", DataType::F16 },
+        { "QASYMM8", DataType::QASYMM8 },
+        { "QASYMM8_SIGNED", DataType::QASYMM8_SIGNED },
+        { "QSYMM8", DataType::QSYMM8 },
+        { "QSYMM8_PER_CHANNEL", DataType::QSYMM8_PER_CHANNEL }
+    };
+
+    const auto it = data_types.find(name);
+    ARM_COMPUTE_ERROR_ON_MSG(it == data_types.end(), "Not supported data type in GEMM kernel selection table");
+    return it->second;
+}
+
+/** Convert a kernel type name as used in the table file to the corresponding @ref CLGEMMKernelType
+ *
+ * @param[in] name Kernel type name
+ *
+ * @return The kernel type
+ */
+CLGEMMKernelType kernel_type_from_string(const std::string &name)
+{
+    static const std::map<std::string, CLGEMMKernelType> kernel_types =
+    {
+        { "native_v1", CLGEMMKernelType::NATIVE_V1 },
+        { "native", CLGEMMKernelType::NATIVE },
+        { "reshaped_v1", CLGEMMKernelType::RESHAPED_V1 },
+        { "reshaped", CLGEMMKernelType::RESHAPED },
+        { "reshaped_only_rhs", CLGEMMKernelType::RESHAPED_ONLY_RHS }
+    };
+
+    const auto it = kernel_types.find(name);
+    ARM_COMPUTE_ERROR_ON_MSG(it == kernel_types.end(), "Not supported kernel type in GEMM kernel selection table");
+    return it->second;
+}
+} // namespace
+
+CLGEMMKernelSelectionTable::CLGEMMKernelSelectionTable(GPUTarget gpu, std::unique_ptr<ICLGEMMKernelSelection> fallback)
+    : ICLGEMMKernelSelection(gpu), _table(), _fallback(std::move(fallback))
+{
+}
+
+void CLGEMMKernelSelectionTable::load_from_file(const std::string &filename)
+{
+    std::ifstream fs;
+    fs.exceptions(std::ifstream::badbit);
+    fs.open(filename, std::ios::in);
+    if(!fs.is_open())
+    {
+        ARM_COMPUTE_ERROR_VAR("Failed to open GEMM kernel selection table file %s", filename.c_str());
+    }
+
+    std::string line;
+    while(std::getline(fs, line))
+    {
+        // Skip empty lines and comments
+        if(line.empty() || line[0] == '#')
+        {
+            continue;
+        }
+
+        std::istringstream ss(line);
+        std::string        data_type_name;
+        unsigned int       m               = 0;
+        unsigned int       n               = 0;
+        unsigned int       k               = 0;
+        bool               is_rhs_constant = false;
+        std::string        kernel_type_name;
+
+        ss >> data_type_name >> m >> n >> k >> is_rhs_constant >> kernel_type_name;
+        if(ss.fail())
+        {
+            ARM_COMPUTE_ERROR_VAR("Malformed GEMM kernel selection table entry: %s", line.c_str());
+        }
+
+        const DataType data_type     = data_type_from_string(data_type_name);
+        _table[table_key(data_type, m, n, k, is_rhs_constant)] = kernel_type_from_string(kernel_type_name);
+    }
+}
+
+CLGEMMKernelType CLGEMMKernelSelectionTable::select_kernel(const CLGEMMKernelSelectionParams &params)
+{
+    const auto it = _table.find(table_key(params.data_type, params.m, params.n, params.k, params.is_rhs_constant));
+    if(it != _table.end())
+    {
+        return it->second;
+    }
+
+    // Fall back to the architecture heuristic for shapes not covered by the table
+    return _fallback->select_kernel(params);
+}
+} // namespace cl_gemm
+} // namespace arm_compute
@@ -83,16 +83,22 @@ CLGEMMKernelType CLGEMMKernelSelectionValhall::default_f16(unsigned int m, unsig
 
 CLGEMMKernelType CLGEMMKernelSelectionValhall::default_q8(unsigned int m, unsigned int n, unsigned int k, bool is_rhs_constant)
 {
-    ARM_COMPUTE_UNUSED(m, n, k);
+    ARM_COMPUTE_UNUSED(k);
 
-    if(is_rhs_constant)
+    if(!is_rhs_constant)
     {
-        return CLGEMMKernelType::RESHAPED_ONLY_RHS;
+        return CLGEMMKernelType::NATIVE;
     }
-    else
+
+    // The reshaped RHS kernels feed the arm_dot built-ins with k0 = 16 blocks; without the dot
+    // product extension the reshape overhead is only worth it for the larger workloads
+    const bool is_dot8_supported = dot8_supported(CLKernelLibrary::get().get_device());
+    if(!is_dot8_supported && ((m * n) < 256))
     {
         return CLGEMMKernelType::NATIVE;
     }
+
+    return CLGEMMKernelType::RESHAPED_ONLY_RHS;
 }
 } // namespace cl_gemm
 } // namespace arm_compute
@@ -23,18 +23,28 @@
  */
 #include "arm_compute/runtime/CPP/CPPScheduler.h"
 
+#include "arm_compute/runtime/KernelProfiler.h"
+
 #include "arm_compute/core/CPP/ICPPKernel.h"
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/Utils.h"
+#include "arm_compute/core/utils/misc/AllocationGuard.h"
 #include "arm_compute/runtime/CPUUtils.h"
 #include "support/Mutex.h"
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <cstdlib>
+#include <fstream>
 #include <iostream>
+#include <limits>
 #include <list>
+#include <map>
 #include <mutex>
+#include <sstream>
+#include <string>
 #include <system_error>
 #include <thread>
 
@@ -42,33 +52,209 @@ namespace arm_compute
 {
 namespace
 {
+/** Work-stealing feeder of workload indices.
+ *
+ * The range of workloads is initially split in contiguous strips, one per thread.
+ * Each thread pops indices from the head of its own strip and, once the strip is
+ * drained, steals the upper half of the largest strip still owned by another
+ * thread. This keeps fast cores busy instead of idling at the join barrier while
+ * a slow core works through its fixed share.
+ */
 class ThreadFeeder
 {
 public:
     /** Constructor
      *
-     * @param[in] start First value that will be returned by the feeder
-     * @param[in] end   End condition (The last value returned by get_next() will be end - 1)
+     * @param[in] num_threads Number of threads the range will be split across
+     * @param[in] start       First value that will be returned by the feeder
+     * @param[in] end         End condition (The last value returned by get_next() will be end - 1)
+     */
+    explicit ThreadFeeder(unsigned int num_threads = 1, unsigned int start = 0, unsigned int end = 0)
+        : ThreadFeeder(std::vector<float>(std::max(num_threads, 1u), 1.f), start, end)
+    {
+    }
+    /** Constructor with cost-weighted strips
+     *
+     * Each thread's initial strip is sized proportionally to its weight, so on
+     * asymmetric systems faster cores start with a bigger share of the range.
+     *
+     * @param[in] weights Relative throughput weight of each thread
+     * @param[in] start   First value that will be returned by the feeder
+     * @param[in] end     End condition (The last value returned by get_next() will be end - 1)
+     */
+    ThreadFeeder(const std::vector<float> &weights, unsigned int start, unsigned int end)
+        : _strips()
+    {
+        reset(weights, start, end);
+    }
+    /** Re-arm the feeder with a new range, reusing the strip storage
+     *
+     * Lets a long-lived feeder serve successive dispatches without reallocating
+     * its strips; only meaningful once the consuming threads have stopped.
+     *
+     * @param[in] weights Relative throughput weight of each thread
+     * @param[in] start   First value that will be returned by the feeder
+     * @param[in] end     End condition (The last value returned by get_next() will be end - 1)
+     */
+    void reset(const std::vector<float> &weights, unsigned int start, unsigned int end)
+    {
+        const size_t num_strips = std::max<size_t>(weights.size(), 1);
+        if(_strips.size() < num_strips)
+        {
+            // The atomic member makes Strip immovable so the vector cannot grow in
+            // place; swap in a freshly sized one. The capacity settles at the pool
+            // width after the first dispatches
+            std::vector<Strip> strips(num_strips);
+            _strips.swap(strips);
+        }
+
+        const unsigned int num_items    = end - start;
+        float              total_weight = 0.f;
+        for(auto w : weights)
+        {
+            total_weight += w;
+        }
+        total_weight = std::max(total_weight, 1.f);
+
+        float        acc_weight  = 0.f;
+        unsigned int strip_start = start;
+        for(size_t t = 0; t < num_strips; ++t)
+        {
+            acc_weight += (t < weights.size()) ? weights[t] : 1.f;
+            const unsigned int strip_end = (t + 1 == num_strips) ? end : start + static_cast<unsigned int>((acc_weight / total_weight) * num_items);
+            _strips[t].bounds            = pack(strip_start, strip_end);
+            strip_start                  = strip_end;
+        }
+        // Strips beyond the active width stay drained so pops, steals and the
+        // empty check skip them
+        for(size_t t = num_strips; t < _strips.size(); ++t)
+        {
+            _strips[t].bounds = pack(end, end);
+        }
+    }
+    /** Return the next element to process if there is one.
+     *
+     * Serves the calling thread's own strip first, then steals from the others.
+     *
+     * @param[in]  thread_id Id of the calling thread (owner of the preferred strip)
+     * @param[out] next      Will contain the next element if there is one.
+     *
+     * @return False if all strips have been drained and next wasn't set.
      */
-    explicit ThreadFeeder(unsigned int start = 0, unsigned int end = 0)
-        : _atomic_counter(start), _end(end)
+    bool get_next(unsigned int thread_id, unsigned int &next)
     {
+        if(thread_id < _strips.size() && pop(_strips[thread_id], next))
+        {
+            return true;
+        }
+        return steal(thread_id, next);
     }
-    /** Return the next element in the range if there is one.
+
+    /** Check whether all strips have been drained.
      *
-     * @param[out] next Will contain the next element if there is one.
+     * Only meaningful once the consuming threads have stopped, e.g. after a
+     * cooperative preemption point, as the strips are drained concurrently.
      *
-     * @return False if the end of the range has been reached and next wasn't set.
+     * @return True if no strip has any element left.
      */
-    bool get_next(unsigned int &next)
+    bool empty() const
     {
-        next = atomic_fetch_add_explicit(&_atomic_counter, 1u, std::memory_order_relaxed);
-        return next < _end;
+        for(const auto &strip : _strips)
+        {
+            const uint64_t bounds = strip.bounds.load(std::memory_order_relaxed);
+            if(head(bounds) < tail(bounds))
+            {
+                return false;
+            }
+        }
+        return true;
     }
 
 private:
-    std::atomic_uint   _atomic_counter;
-    const unsigned int _end;
+    struct Strip
+    {
+        // Head (low word) and tail (high word) packed together so that pop and
+        // steal can race on a single atomic word.
+        std::atomic<uint64_t> bounds{ 0 };
+    };
+
+    static uint64_t pack(unsigned int head, unsigned int tail)
+    {
+        return static_cast<uint64_t>(head) | (static_cast<uint64_t>(tail) << 32);
+    }
+    static unsigned int head(uint64_t bounds)
+    {
+        return static_cast<unsigned int>(bounds & 0xFFFFFFFFu);
+    }
+    static unsigned int tail(uint64_t bounds)
+    {
+        return static_cast<unsigned int>(bounds >> 32);
+    }
+
+    /** Take one element from the head of the given strip. */
+    bool pop(Strip &strip, unsigned int &next)
+    {
+        uint64_t bounds = strip.bounds.load(std::memory_order_relaxed);
+        while(head(bounds) < tail(bounds))
+        {
+            if(strip.bounds.compare_exchange_weak(bounds, pack(head(bounds) + 1, tail(bounds)), std::memory_order_acquire, std::memory_order_relaxed))
+            {
+                next = head(bounds);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /** Move the upper half of the fullest victim strip into the thief's strip and pop from it. */
+    bool steal(unsigned int thief_id, unsigned int &next)
+    {
+        while(true)
+        {
+            // Pick the victim with the most work left
+            unsigned int victim_id   = _strips.size();
+            unsigned int victim_left = 0;
+            for(unsigned int t = 0; t < _strips.size(); ++t)
+            {
+                if(t == thief_id)
+                {
+                    continue;
+                }
+                const uint64_t bounds = _strips[t].bounds.load(std::memory_order_relaxed);
+                if(tail(bounds) - head(bounds) > victim_left)
+                {
+                    victim_left = tail(bounds) - head(bounds);
+                    victim_id   = t;
+                }
+            }
+            if(victim_id == _strips.size())
+            {
+                return false;
+            }
+
+            Strip   &victim = _strips[victim_id];
+            uint64_t bounds = victim.bounds.load(std::memory_order_relaxed);
+            if(head(bounds) >= tail(bounds))
+            {
+                continue;
+            }
+            // Leave the lower half with the victim, take [mid, tail). A single
+            // remaining element is stolen outright rather than spun on.
+            const unsigned int mid = head(bounds) + (tail(bounds) - head(bounds)) / 2;
+            if(!victim.bounds.compare_exchange_weak(bounds, pack(head(bounds), mid), std::memory_order_acquire, std::memory_order_relaxed))
+            {
+                continue;
+            }
+            next = mid;
+            if(thief_id < _strips.size() && mid + 1 < tail(bounds))
+            {
+                _strips[thief_id].bounds.store(pack(mid + 1, tail(bounds)), std::memory_order_release);
+            }
+            return true;
+        }
+    }
+
+    std::vector<Strip> _strips;
 };
 
 /** Given two dimensions and a maxium number of threads to utilise, calcualte the best
@@ -126,23 +312,106 @@ std::pair<unsigned, unsigned> split_2d(unsigned max_threads, std::size_t m, std:
     }
 }
 
-/** Execute workloads[info.thread_id] first, then call the feeder to get the index of the next workload to run.
+/** Relative throughput weight of a core model, used to size the initial feeder strips.
  *
- * Will run workloads until the feeder reaches the end of its range.
+ * The figures are coarse single-core GEMM throughput ratios; precision doesn't
+ * matter much as the work-stealing feeder corrects residual imbalance.
+ */
+float cpu_model_weight(CPUModel model)
+{
+    switch(model)
+    {
+        case CPUModel::X1:
+            return 3.f;
+        case CPUModel::A73:
+        case CPUModel::GENERIC_FP16:
+        case CPUModel::GENERIC_FP16_DOT:
+            return 2.f;
+        case CPUModel::A53:
+        case CPUModel::A55r0:
+        case CPUModel::A55r1:
+        case CPUModel::GENERIC:
+        default:
+            return 1.f;
+    }
+}
+
+/** Compute per-thread weights from the detected core topology.
+ *
+ * Assumes the default 1:1 mapping of thread id to core id (which holds when
+ * affinity has been requested through set_num_threads_with_affinity).
+ *
+ * Fills the caller-provided buffer (reusing its capacity, so repeated calls do
+ * not allocate) with one weight per thread; all ones if the topology is
+ * homogeneous or unknown.
+ */
+void thread_weights(unsigned int num_threads, const CPUInfo &cpu_info, std::vector<float> &weights)
+{
+    weights.assign(num_threads, 1.f);
+    if(num_threads > cpu_info.get_cpu_num())
+    {
+        return;
+    }
+    bool asymmetric = false;
+    for(unsigned int t = 0; t < num_threads; ++t)
+    {
+        weights[t] = cpu_model_weight(cpu_info.get_cpu_model(t));
+        asymmetric = asymmetric || (weights[t] != weights[0]);
+    }
+    if(!asymmetric)
+    {
+        std::fill(weights.begin(), weights.end(), 1.f);
+    }
+}
+
+/** Number of application threads currently waiting to run HIGH priority workloads.
  *
- * @param[in]     workloads The array of workloads
- * @param[in,out] feeder    The feeder indicating which workload to execute next.
- * @param[in]     info      Threading and CPU info.
+ * Checked cooperatively by NORMAL priority runs between workloads: when non-zero
+ * they stop pulling further work from the feeder so the pool can be handed over.
  */
-void process_workloads(std::vector<IScheduler::Workload> &workloads, ThreadFeeder &feeder, const ThreadInfo &info)
+std::atomic<unsigned int> g_pending_high_prio{ 0 };
+
+/** Scheduling priority of the calling application thread, set through CPPScheduler::set_priority(). */
+thread_local CPPScheduler::Priority g_thread_priority = CPPScheduler::Priority::NORMAL;
+
+/** Run workloads handed out by the feeder until all strips (including stolen ones) are drained.
+ *
+ * Preemptible runs additionally stop at the first workload boundary where a HIGH
+ * priority request is pending, leaving the remaining indices in the feeder.
+ *
+ * @param[in]     workloads   The array of workloads
+ * @param[in,out] feeder      The feeder indicating which workload to execute next.
+ * @param[in]     info        Threading and CPU info.
+ * @param[in]     preemptible True if the run should yield to pending HIGH priority requests.
+ */
+void process_workloads(std::vector<IScheduler::Workload> &workloads, ThreadFeeder &feeder, const ThreadInfo &info, bool preemptible)
 {
-    unsigned int workload_index = info.thread_id;
-    do
+    unsigned int workload_index = 0;
+    while(feeder.get_next(info.thread_id, workload_index))
     {
         ARM_COMPUTE_ERROR_ON(workload_index >= workloads.size());
         workloads[workload_index](info);
+        if(preemptible && g_pending_high_prio.load(std::memory_order_relaxed) != 0)
+        {
+            return;
+        }
     }
-    while(feeder.get_next(workload_index));
+}
+
+/** Number of times a parked worker polls for new work before falling back to the condition variable. */
+constexpr unsigned int k_spin_attempts = 10000;
+
+/** Check whether two windows describe the same iteration space. */
+bool same_window(const Window &lhs, const Window &rhs)
+{
+    for(size_t d = 0; d < Coordinates::num_max_dimensions; ++d)
+    {
+        if(lhs[d].start() != rhs[d].start() || lhs[d].end() != rhs[d].end() || lhs[d].step() != rhs[d].step())
+        {
+            return false;
+        }
+    }
+    return true;
 }
 
 void set_thread_affinity(int core_id)
@@ -180,13 +449,13 @@ public:
 
     /** Request the worker thread to start executing workloads.
      *
-     * The thread will start by executing workloads[info.thread_id] and will then call the feeder to
-     * get the index of the following workload to run.
+     * The thread will drain its own strip of the feeder's range and then steal
+     * work from the other threads' strips until nothing is left.
      *
      * @note This function will return as soon as the workloads have been sent to the worker thread.
      * wait() needs to be called to ensure the execution is complete.
      */
-    void start(std::vector<IScheduler::Workload> *workloads, ThreadFeeder &feeder, const ThreadInfo &info);
+    void start(std::vector<IScheduler::Workload> *workloads, ThreadFeeder &feeder, const ThreadInfo &info, bool preemptible);
 
     /** Wait for the current kernel execution to complete. */
     void wait();
@@ -201,8 +470,9 @@ private:
     ThreadFeeder                      *_feeder{ nullptr };
     std::mutex                         _m{};
     std::condition_variable            _cv{};
-    bool                               _wait_for_work{ false };
+    std::atomic<bool>                  _wait_for_work{ false };
     bool                               _job_complete{ true };
+    bool                               _preemptible{ false };
     std::exception_ptr                 _current_exception{ nullptr };
     int                                _core_pin{ -1 };
 };
@@ -219,16 +489,17 @@ Thread::~Thread()
     if(_thread.joinable())
     {
         ThreadFeeder feeder;
-        start(nullptr, feeder, ThreadInfo());
+        start(nullptr, feeder, ThreadInfo(), false);
         _thread.join();
     }
 }
 
-void Thread::start(std::vector<IScheduler::Workload> *workloads, ThreadFeeder &feeder, const ThreadInfo &info)
+void Thread::start(std::vector<IScheduler::Workload> *workloads, ThreadFeeder &feeder, const ThreadInfo &info, bool preemptible)
 {
-    _workloads = workloads;
-    _feeder    = &feeder;
-    _info      = info;
+    _workloads   = workloads;
+    _feeder      = &feeder;
+    _info        = info;
+    _preemptible = preemptible;
     {
         std::lock_guard<std::mutex> lock(_m);
         _wait_for_work = true;
@@ -256,8 +527,14 @@ void Thread::worker_thread()
 
     while(true)
     {
+        // Spin briefly before parking on the condition variable: between
+        // back-to-back kernels this avoids paying the futex wake-up latency.
+        for(unsigned int i = 0; i < k_spin_attempts && !_wait_for_work.load(std::memory_order_relaxed); ++i)
+        {
+        }
+
         std::unique_lock<std::mutex> lock(_m);
-        _cv.wait(lock, [&] { return _wait_for_work; });
+        _cv.wait(lock, [&] { return _wait_for_work.load(std::memory_order_relaxed); });
         _wait_for_work = false;
 
         _current_exception = nullptr;
@@ -272,7 +549,7 @@ void Thread::worker_thread()
         try
         {
 #endif /* ARM_COMPUTE_EXCEPTIONS_ENABLED */
-            process_workloads(*_workloads, *_feeder, _info);
+            process_workloads(*_workloads, *_feeder, _info, _preemptible);
 
 #ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
         }
@@ -318,11 +595,285 @@ struct CPPScheduler::Impl final
         return _num_threads;
     }
 
+    /** Pick the number of dynamic-split granules for a kernel, adapting across iterations.
+     *
+     * Starts from the hinted granule count and, using the execution times recorded by
+     * @ref update_granules, coarsens the split of cheap kernels (whose granules drown in
+     * feeder overhead) and refines the split of expensive ones (which still tail-lag).
+     *
+     * @param[in] kernel_name    Name identifying the kernel class
+     * @param[in] hinted         Granule count derived from the hints
+     * @param[in] num_iterations Iterations available along the split dimension
+     *
+     * @return Number of granules to split the workload into
+     */
+    unsigned int adaptive_granules(const char *kernel_name, unsigned int hinted, unsigned int num_iterations)
+    {
+        arm_compute::lock_guard<std::mutex> lock(_granules_mutex);
+        auto                                it = _granules.find(kernel_name);
+        if(it == _granules.end())
+        {
+            _granules[kernel_name] = hinted;
+            return std::min(hinted, num_iterations);
+        }
+        return std::min(it->second, num_iterations);
+    }
+
+    /** Record a kernel's execution time and adapt its granule count for the next run. */
+    void update_granules(const char *kernel_name, unsigned int used_granules, std::chrono::microseconds elapsed)
+    {
+        // Per-granule cost targets: below the lower bound the feeder overhead dominates,
+        // above the upper bound a straggling granule leaves cores idle at the tail.
+        constexpr long long min_granule_time_us = 20;
+        constexpr long long max_granule_time_us = 200;
+
+        arm_compute::lock_guard<std::mutex> lock(_granules_mutex);
+        auto                                it = _granules.find(kernel_name);
+        if(it == _granules.end() || used_granules == 0)
+        {
+            return;
+        }
+        const long long granule_time_us = elapsed.count() / used_granules;
+        if(granule_time_us < min_granule_time_us && it->second > _num_threads)
+        {
+            it->second = std::max(_num_threads, it->second / 2);
+        }
+        else if(granule_time_us > max_granule_time_us && it->second < 16 * _num_threads)
+        {
+            it->second *= 2;
+        }
+    }
+
+    /** Online concurrency tuning state of one kernel class.
+     *
+     * The search starts at the full pool width and backs off: each candidate
+     * thread count is timed over a few runs and the next lower candidate is
+     * tried as long as it doesn't lose against the best average seen so far.
+     * Once the search has stopped the winner is persisted, so later processes
+     * start at the tuned width directly.
+     */
+    struct Concurrency
+    {
+        unsigned int best{ 0 };         /**< Best thread count found so far */
+        unsigned int candidate{ 0 };    /**< Thread count currently being measured, 0 until first sight */
+        unsigned int samples{ 0 };      /**< Runs measured at the current candidate */
+        long long    acc_us{ 0 };       /**< Accumulated execution time at the current candidate */
+        long long    best_us{ std::numeric_limits<long long>::max() }; /**< Best average execution time seen */
+        bool         tuned{ false };    /**< True once the search has converged (or was loaded from the profile) */
+    };
+
+    /** Get the thread count to use for a kernel class, starting its tuning search on first sight.
+     *
+     * Memory-bound kernel classes peak below the full pool width, and a global
+     * num_threads can't serve them and the compute-bound ones at once. The
+     * per-class profile is persisted in the same way as the arm_gemm blocking
+     * profiles: loaded lazily from the file named by ARM_COMPUTE_KERNEL_THREADS
+     * and written back whenever a search converges.
+     *
+     * @param[in] kernel_name Name identifying the kernel class
+     * @param[in] max_threads Thread count configured on the scheduler
+     *
+     * @return Number of threads to run this kernel class with
+     */
+    unsigned int concurrency(const char *kernel_name, unsigned int max_threads)
+    {
+        arm_compute::lock_guard<std::mutex> lock(_concurrency_mutex);
+        load_concurrency_profile();
+
+        Concurrency &state = _concurrency[kernel_name];
+        if(state.candidate == 0)
+        {
+            // First sight and not in the profile: start measuring at full width
+            state.best      = max_threads;
+            state.candidate = max_threads;
+        }
+        return std::min(state.tuned ? state.best : state.candidate, max_threads);
+    }
+
+    /** Record a kernel's execution time and advance its concurrency search.
+     *
+     * Runs where the thread count was capped below the candidate (e.g. by the
+     * iteration count) are not representative of the candidate and are skipped.
+     */
+    void update_concurrency(const char *kernel_name, unsigned int used_threads, std::chrono::microseconds elapsed)
+    {
+        constexpr unsigned int samples_per_candidate = 4;
+
+        arm_compute::lock_guard<std::mutex> lock(_concurrency_mutex);
+        auto                                it = _concurrency.find(kernel_name);
+        if(it == _concurrency.end() || it->second.tuned || used_threads != it->second.candidate)
+        {
+            return;
+        }
+
+        Concurrency &state = it->second;
+        state.acc_us += elapsed.count();
+        if(++state.samples < samples_per_candidate)
+        {
+            return;
+        }
+        const long long avg_us = state.acc_us / state.samples;
+        state.samples          = 0;
+        state.acc_us           = 0;
+
+        // A narrower run within 5% of the fastest average is treated as a win: it
+        // frees cores for concurrent work without costing this kernel anything.
+        if(avg_us <= state.best_us + state.best_us / 20)
+        {
+            state.best    = state.candidate;
+            state.best_us = std::min(state.best_us, avg_us);
+            if(state.candidate > 1)
+            {
+                state.candidate = std::max(1u, state.candidate / 2);
+                return;
+            }
+        }
+        state.tuned = true;
+        save_concurrency_profile();
+    }
+
+    /** Load the persisted concurrency profile on first use, called with the lock held.
+     *
+     * File format is one entry per line: "kernel_name num_threads".
+     */
+    void load_concurrency_profile()
+    {
+        if(_concurrency_loaded)
+        {
+            return;
+        }
+        _concurrency_loaded = true;
+
+        const char *env = getenv("ARM_COMPUTE_KERNEL_THREADS");
+        if(env == nullptr)
+        {
+            return;
+        }
+        _concurrency_file = env;
+
+        std::ifstream file(_concurrency_file);
+        std::string   line;
+        while(std::getline(file, line))
+        {
+            std::istringstream ss(line);
+            std::string        name;
+            unsigned int       threads = 0;
+            if(ss >> name >> threads && threads > 0)
+            {
+                Concurrency &state = _concurrency[name];
+                state.best         = threads;
+                state.candidate    = threads;
+                state.tuned        = true;
+            }
+        }
+    }
+
+    /** Persist the converged concurrency entries, called with the lock held. */
+    void save_concurrency_profile()
+    {
+        if(_concurrency_file.empty())
+        {
+            return;
+        }
+
+        std::ofstream file(_concurrency_file, std::ios::trunc);
+        for(const auto &entry : _concurrency)
+        {
+            if(entry.second.tuned)
+            {
+                file << entry.first << " " << entry.second.best << "\n";
+            }
+        }
+    }
+
+    /** Precomputed split windows of one kernel instance.
+     *
+     * For a fixed graph the window and split parameters of a configured kernel
+     * never change between frames, so the splits are derived once and replayed
+     * on every subsequent schedule of the same kernel.
+     */
+    struct StaticSchedule
+    {
+        Window              max_window{};      /**< Window the splits were derived from */
+        unsigned int        split_dimension{}; /**< Dimension the window was split along */
+        std::vector<Window> windows{};         /**< Precomputed per-granule windows */
+    };
+
+    /** Get the precomputed split windows for a kernel, deriving them on first sight.
+     *
+     * The cache is keyed on the kernel instance and revalidated against the
+     * current window and split parameters, so a reconfigured (or reallocated)
+     * kernel simply has its entry rebuilt.
+     *
+     * @param[in] kernel          Kernel being scheduled
+     * @param[in] max_window      Maximum window to split
+     * @param[in] split_dimension Dimension along which to split the window
+     * @param[in] num_windows     Number of granules to split the window into
+     *
+     * @return Reference to the precomputed windows, stable until the entry is rebuilt.
+     */
+    const std::vector<Window> &static_schedule(const ICPPKernel *kernel, const Window &max_window, unsigned int split_dimension, unsigned int num_windows)
+    {
+        arm_compute::lock_guard<std::mutex> lock(_schedules_mutex);
+        StaticSchedule                     &sched = _schedules[kernel];
+        if(sched.windows.size() != num_windows || sched.split_dimension != split_dimension || !same_window(sched.max_window, max_window))
+        {
+            sched.max_window      = max_window;
+            sched.split_dimension = split_dimension;
+            sched.windows.resize(num_windows);
+            for(unsigned int t = 0; t < num_windows; ++t)
+            {
+                sched.windows[t] = max_window.split_window(split_dimension, t, num_windows);
+                sched.windows[t].validate();
+            }
+        }
+        return sched.windows;
+    }
+
     void run_workloads(std::vector<IScheduler::Workload> &workloads);
 
-    unsigned int       _num_threads;
-    std::list<Thread>  _threads;
-    arm_compute::Mutex _run_workloads_mutex{};
+    /** Draw a feeder from the pool, creating one when the pool is empty
+     *
+     * Has to be called with the workloads mutex held. Each run owns its feeder until it
+     * releases it, so a preempted run's remaining strips survive while other runs use
+     * the pool.
+     *
+     * @return A feeder exclusively owned by the calling run
+     */
+    std::unique_ptr<ThreadFeeder> acquire_feeder()
+    {
+        if(_feeder_pool.empty())
+        {
+            return support::cpp14::make_unique<ThreadFeeder>();
+        }
+        std::unique_ptr<ThreadFeeder> feeder = std::move(_feeder_pool.back());
+        _feeder_pool.pop_back();
+        return feeder;
+    }
+
+    /** Return a feeder to the pool for reuse. Has to be called with the workloads mutex held
+     *
+     * @param[in] feeder Feeder to return
+     */
+    void release_feeder(std::unique_ptr<ThreadFeeder> feeder)
+    {
+        _feeder_pool.emplace_back(std::move(feeder));
+    }
+
+    unsigned int              _num_threads;
+    std::list<Thread>         _threads;
+    arm_compute::Mutex        _run_workloads_mutex{};
+    std::vector<std::unique_ptr<ThreadFeeder>> _feeder_pool{};    /**< Feeders reused across dispatches, guarded by the workloads mutex. Settles at the maximum number of overlapping runs */
+    std::vector<float>        _feeder_weights{}; /**< Weights buffer reused across dispatches, guarded by the workloads mutex */
+    std::atomic<unsigned int> _inline_threshold{ 0 }; /**< Window iterations below which kernels run inline on the caller, 0 until calibrated */
+    std::map<std::string, unsigned int> _granules{};       /**< Adapted dynamic-split granule count per kernel class */
+    arm_compute::Mutex                  _granules_mutex{};
+    std::map<std::string, Concurrency> _concurrency{};       /**< Tuned thread count per kernel class */
+    arm_compute::Mutex                 _concurrency_mutex{};
+    std::string                        _concurrency_file{};  /**< File the concurrency profile is persisted to */
+    bool                               _concurrency_loaded{ false };
+    std::map<const ICPPKernel *, StaticSchedule> _schedules{};       /**< Precomputed split windows per kernel instance */
+    arm_compute::Mutex                           _schedules_mutex{};
 };
 
 /*
@@ -360,59 +911,169 @@ unsigned int CPPScheduler::num_threads() const
     return _impl->num_threads();
 }
 
+void CPPScheduler::set_priority(Priority priority)
+{
+    g_thread_priority = priority;
+}
+
 #ifndef DOXYGEN_SKIP_THIS
 void CPPScheduler::run_workloads(std::vector<IScheduler::Workload> &workloads)
+{
+    run_workloads(workloads, _impl->num_threads());
+}
+
+void CPPScheduler::run_workloads(std::vector<IScheduler::Workload> &workloads, unsigned int max_threads)
 {
     // Mutex to ensure other threads won't interfere with the setup of the current thread's workloads
     // Other thread's workloads will be scheduled after the current thread's workloads have finished
     // This is not great because different threads workloads won't run in parallel but at least they
     // won't interfere each other and deadlock.
-    arm_compute::lock_guard<std::mutex> lock(_impl->_run_workloads_mutex);
-    const unsigned int                  num_threads = std::min(_impl->num_threads(), static_cast<unsigned int>(workloads.size()));
+    //
+    // A two-level priority scheme softens the serialization: HIGH priority requests announce
+    // themselves before blocking on the mutex, NORMAL priority runs release the pool at the next
+    // workload boundary and only resume their remaining workloads once no announcement is pending.
+    const bool high_prio = (g_thread_priority == Priority::HIGH);
+    if(high_prio)
+    {
+        ++g_pending_high_prio;
+    }
+    arm_compute::unique_lock<arm_compute::Mutex> lock(_impl->_run_workloads_mutex);
+    if(high_prio)
+    {
+        --g_pending_high_prio;
+    }
+    const unsigned int num_threads = std::min(std::min(_impl->num_threads(), max_threads), static_cast<unsigned int>(workloads.size()));
     if(num_threads < 1)
     {
         return;
     }
-    ThreadFeeder feeder(num_threads, workloads.size());
-    ThreadInfo   info;
-    info.cpu_info          = &_cpu_info;
-    info.num_threads       = num_threads;
-    unsigned int t         = 0;
-    auto         thread_it = _impl->_threads.begin();
-    for(; t < num_threads - 1; ++t, ++thread_it)
+    // On asymmetric topologies size the initial strips to each core's relative
+    // throughput so the prime core doesn't start with a 1/n chunk. The weights
+    // buffer and the feeders are owned by the scheduler and reused under the
+    // workloads mutex, so steady-state dispatches do not heap-allocate. Each run
+    // draws its own feeder: a preempted run keeps it across the handover below,
+    // so the HIGH priority runs it yields to reset a different object and the
+    // remaining strips are intact on resume
+    thread_weights(num_threads, _cpu_info, _impl->_feeder_weights);
+    std::unique_ptr<ThreadFeeder> owned_feeder = _impl->acquire_feeder();
+    ThreadFeeder                 &feeder       = *owned_feeder;
+    feeder.reset(_impl->_feeder_weights, 0, workloads.size());
+    ThreadInfo info;
+    info.cpu_info    = &_cpu_info;
+    info.num_threads = num_threads;
+    const bool preemptible = !high_prio;
+    while(true)
     {
-        info.thread_id = t;
-        thread_it->start(&workloads, feeder, info);
-    }
+        unsigned int t         = 0;
+        auto         thread_it = _impl->_threads.begin();
+        for(; t < num_threads - 1; ++t, ++thread_it)
+        {
+            info.thread_id = t;
+            thread_it->start(&workloads, feeder, info, preemptible);
+        }
 
-    info.thread_id = t;
-    process_workloads(workloads, feeder, info);
+        info.thread_id = t;
+        process_workloads(workloads, feeder, info, preemptible);
 #ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
-    try
-    {
+        try
+        {
 #endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
-        for(auto &thread : _impl->_threads)
+            for(auto &thread : _impl->_threads)
+            {
+                thread.wait();
+            }
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        }
+        catch(const std::system_error &e)
         {
-            thread.wait();
+            std::cerr << "Caught system_error with code " << e.code() << " meaning " << e.what() << '\n';
         }
-#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
-    }
-    catch(const std::system_error &e)
-    {
-        std::cerr << "Caught system_error with code " << e.code() << " meaning " << e.what() << '\n';
-    }
 #endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+        if(!preemptible || feeder.empty())
+        {
+            break;
+        }
+        // Preempted: hand the thread pool over to the waiting HIGH priority request(s)
+        // and resume the workloads still left in this run's feeder once they are all
+        // served. The feeder stays owned by this run while the mutex is released.
+        lock.unlock();
+        while(g_pending_high_prio.load(std::memory_order_relaxed) != 0)
+        {
+            std::this_thread::yield();
+        }
+        lock.lock();
+    }
+    _impl->release_feeder(std::move(owned_feeder));
 }
 #endif /* DOXYGEN_SKIP_THIS */
 
+void CPPScheduler::warmup()
+{
+    // Dispatch one trivial workload per thread: this spawns any missing worker,
+    // applies the requested core binding and first-touches the thread stacks, so
+    // the pool is parked hot before the first real kernel.
+    std::vector<IScheduler::Workload> workloads(_impl->num_threads(), [](const ThreadInfo &)
+    {
+    });
+    run_workloads(workloads);
+}
+
 void CPPScheduler::schedule_common(ICPPKernel *kernel, const Hints &hints, ITensorPack &tensors)
 {
     ARM_COMPUTE_ERROR_ON_MSG(!kernel, "The child class didn't set the kernel");
 
+    // In builds with the allocation interception, attribute any heap allocation
+    // of this dispatch (including the kernel's run) to the kernel
+    utils::ScopedAllocationGuard alloc_guard(kernel->name());
+
     const Window &max_window = kernel->window();
 
+    // Lazily calibrate the inline-execution threshold: time the round trip of handing an
+    // empty workload set to the pool (split, wake-up and join) and convert it to a number
+    // of window iterations with a conservative lower bound on the cost of one iteration.
+    // Kernels whose whole window is estimated cheaper than the dispatch itself then run
+    // inline on the calling thread, which for tiny shapes is often several times faster.
+    unsigned int inline_threshold = _impl->_inline_threshold.load(std::memory_order_relaxed);
+    if(inline_threshold == 0)
+    {
+        if(_impl->num_threads() > 1)
+        {
+            constexpr unsigned int calibration_rounds = 8;
+            constexpr long long    min_iteration_ns   = 50;
+
+            std::vector<IScheduler::Workload> noop(_impl->num_threads(), [](const ThreadInfo &)
+            {
+            });
+            // Spawn and park the pool outside the timed section
+            run_workloads(noop);
+            const auto start = std::chrono::steady_clock::now();
+            for(unsigned int i = 0; i < calibration_rounds; ++i)
+            {
+                run_workloads(noop);
+            }
+            const long long dispatch_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count() / calibration_rounds;
+            inline_threshold            = std::max<long long>(1, dispatch_ns / min_iteration_ns);
+        }
+        else
+        {
+            inline_threshold = 1;
+        }
+        _impl->_inline_threshold.store(inline_threshold, std::memory_order_relaxed);
+    }
+
     if(hints.split_dimension() == IScheduler::split_dimensions_all)
     {
+        if(max_window.num_iterations_total() < inline_threshold)
+        {
+            ThreadInfo info;
+            info.cpu_info = &_cpu_info;
+            Window thread_locator;
+            thread_locator.set(Window::DimX, Window::Dimension(0, 1));
+            thread_locator.set(Window::DimY, Window::Dimension(0, 1));
+            ScopedKernelProfile profile(kernel->name(), info.thread_id);
+            kernel->run_nd(max_window, info, thread_locator);
+            return;
+        }
         /*
          * if the split dim is size_t max then this signals we should parallelise over
          * all dimensions
@@ -424,46 +1085,64 @@ void CPPScheduler::schedule_common(ICPPKernel *kernel, const Hints &hints, ITens
         unsigned m_threads, n_threads;
         std::tie(m_threads, n_threads) = split_2d(_impl->_num_threads, m, n);
 
-        std::vector<IScheduler::Workload> workloads;
-        for(unsigned int ni = 0; ni != n_threads; ++ni)
+        // Package the dispatch state behind one pointer so the workload lambdas fit
+        // std::function's small-buffer storage: bigger captures would heap-allocate
+        // one block per workload on every dispatch
+        struct DispatchState2D
+        {
+            const Window *max_window;
+            ICPPKernel   *kernel;
+            unsigned int  m_threads;
+            unsigned int  n_threads;
+        };
+        DispatchState2D state{ &max_window, kernel, m_threads, n_threads };
+
+        // Reused per calling thread so its capacity settles after the first frames
+        static thread_local std::vector<IScheduler::Workload> workloads;
+        workloads.resize(m_threads * n_threads);
+        for(unsigned int t = 0; t < m_threads * n_threads; ++t)
         {
-            for(unsigned int mi = 0; mi != m_threads; ++mi)
+            //Capture 't' by copy, the dispatch state by reference:
+            workloads[t] = [t, &state](const ThreadInfo & info)
             {
-                workloads.push_back(
-                    [ni, mi, m_threads, n_threads, &max_window, &kernel](const ThreadInfo & info)
-                {
-                    //narrow the window to our mi-ni workload
-                    Window win = max_window.split_window(Window::DimX, mi, m_threads)
-                                 .split_window(Window::DimY, ni, n_threads);
+                const unsigned int mi = t % state.m_threads;
+                const unsigned int ni = t / state.m_threads;
 
-                    win.validate();
+                //narrow the window to our mi-ni workload
+                Window win = state.max_window->split_window(Window::DimX, mi, state.m_threads)
+                             .split_window(Window::DimY, ni, state.n_threads);
 
-                    Window thread_locator;
-                    thread_locator.set(Window::DimX, Window::Dimension(mi, m_threads));
-                    thread_locator.set(Window::DimY, Window::Dimension(ni, n_threads));
+                win.validate();
 
-                    thread_locator.validate();
+                Window thread_locator;
+                thread_locator.set(Window::DimX, Window::Dimension(mi, state.m_threads));
+                thread_locator.set(Window::DimY, Window::Dimension(ni, state.n_threads));
 
-                    kernel->run_nd(win, info, thread_locator);
-                });
-            }
+                thread_locator.validate();
+
+                ScopedKernelProfile profile(state.kernel->name(), info.thread_id);
+                state.kernel->run_nd(win, info, thread_locator);
+            };
         }
         run_workloads(workloads);
     }
     else
     {
         const unsigned int num_iterations = max_window.num_iterations(hints.split_dimension());
-        const unsigned int num_threads    = std::min(num_iterations, _impl->_num_threads);
+        // Memory-bound kernel classes peak below the full pool width: run each class
+        // at its tuned thread count, backing off from the global num_threads online.
+        const unsigned int num_threads = std::min(num_iterations, _impl->concurrency(kernel->name(), _impl->_num_threads));
 
         if(num_iterations == 0)
         {
             return;
         }
 
-        if(!kernel->is_parallelisable() || num_threads == 1)
+        if(!kernel->is_parallelisable() || num_threads == 1 || max_window.num_iterations_total() < inline_threshold)
         {
             ThreadInfo info;
             info.cpu_info = &_cpu_info;
+            ScopedKernelProfile profile(kernel->name(), info.thread_id);
             if(tensors.empty())
             {
                 kernel->run(max_window, info);
@@ -484,33 +1163,58 @@ void CPPScheduler::schedule_common(ICPPKernel *kernel, const Hints &hints, ITens
                 case StrategyHint::DYNAMIC:
                 {
                     const unsigned int granule_threshold = (hints.threshold() <= 0) ? num_threads : static_cast<unsigned int>(hints.threshold());
-                    // Make sure we don't use some windows which are too small as this might create some contention on the ThreadFeeder
-                    num_windows = num_iterations > granule_threshold ? granule_threshold : num_iterations;
+                    // Start from the hinted granule count and adapt it per kernel class from
+                    // the execution times recorded on previous runs. Too small windows would
+                    // create contention on the ThreadFeeder, too few would tail-lag.
+                    num_windows = _impl->adaptive_granules(kernel->name(), granule_threshold, num_iterations);
                     break;
                 }
                 default:
                     ARM_COMPUTE_ERROR("Unknown strategy");
             }
-            std::vector<IScheduler::Workload> workloads(num_windows);
+            // Replay the precomputed split windows of this kernel instance; they are
+            // only (re)derived when the kernel is seen for the first time or has been
+            // reconfigured, so steady-state frames skip the split computation.
+            const std::vector<Window> &windows = _impl->static_schedule(kernel, max_window, hints.split_dimension(), num_windows);
+
+            // Package the dispatch state behind one pointer so the workload lambdas fit
+            // std::function's small-buffer storage: bigger captures would heap-allocate
+            // one block per granule on every dispatch
+            struct DispatchState
+            {
+                const std::vector<Window> *windows;
+                ICPPKernel                *kernel;
+                ITensorPack               *tensors;
+            };
+            DispatchState state{ &windows, kernel, &tensors };
+
+            // Reused per calling thread so its capacity settles after the first frames
+            static thread_local std::vector<IScheduler::Workload> workloads;
+            workloads.resize(num_windows);
             for(unsigned int t = 0; t < num_windows; t++)
             {
-                //Capture 't' by copy, all the other variables by reference:
-                workloads[t] = [t, &hints, &max_window, &num_windows, &kernel, &tensors](const ThreadInfo & info)
+                //Capture 't' by copy, the dispatch state by reference:
+                workloads[t] = [t, &state](const ThreadInfo & info)
                 {
-                    Window win = max_window.split_window(hints.split_dimension(), t, num_windows);
-                    win.validate();
-
-                    if(tensors.empty())
+                    ScopedKernelProfile profile(state.kernel->name(), info.thread_id);
+                    if(state.tensors->empty())
                     {
-                        kernel->run(win, info);
+                        state.kernel->run((*state.windows)[t], info);
                     }
                     else
                     {
-                        kernel->run_op(tensors, win, info);
+                        state.kernel->run_op(*state.tensors, (*state.windows)[t], info);
                     }
                 };
             }
-            run_workloads(workloads);
+            const auto start = std::chrono::steady_clock::now();
+            run_workloads(workloads, num_threads);
+            const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+            if(hints.strategy() == StrategyHint::DYNAMIC)
+            {
+                _impl->update_granules(kernel->name(), num_windows, elapsed);
+            }
+            _impl->update_concurrency(kernel->name(), num_threads, elapsed);
         }
     }
 }
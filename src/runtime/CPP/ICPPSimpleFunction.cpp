@@ -24,15 +24,17 @@
 #include "arm_compute/runtime/CPP/ICPPSimpleFunction.h"
 
 #include "arm_compute/runtime/Scheduler.h"
+#include "arm_compute/runtime/Utils.h"
 
 using namespace arm_compute;
 
-ICPPSimpleFunction::ICPPSimpleFunction() // NOLINT
-    : _kernel()
+ICPPSimpleFunction::ICPPSimpleFunction(IRuntimeContext *ctx) // NOLINT
+    : _kernel(),
+      _ctx(ctx)
 {
 }
 
 void ICPPSimpleFunction::run()
 {
-    Scheduler::get().schedule(_kernel.get(), Window::DimY);
+    schedule_kernel_on_ctx(_ctx, _kernel.get(), Window::DimY);
 }
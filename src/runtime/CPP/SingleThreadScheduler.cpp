@@ -23,6 +23,8 @@
  */
 #include "arm_compute/runtime/SingleThreadScheduler.h"
 
+#include "arm_compute/runtime/KernelProfiler.h"
+
 #include "arm_compute/core/CPP/ICPPKernel.h"
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Utils.h"
@@ -46,6 +48,7 @@ void SingleThreadScheduler::schedule(ICPPKernel *kernel, const Hints &hints)
 
     ThreadInfo info;
     info.cpu_info = &_cpu_info;
+    ScopedKernelProfile profile(kernel->name(), info.thread_id);
     kernel->run(kernel->window(), info);
 }
 
@@ -54,6 +57,7 @@ void SingleThreadScheduler::schedule_op(ICPPKernel *kernel, const Hints &hints,
     ARM_COMPUTE_UNUSED(hints);
     ThreadInfo info;
     info.cpu_info = &_cpu_info;
+    ScopedKernelProfile profile(kernel->name(), info.thread_id);
     kernel->run_op(tensors, kernel->window(), info);
 }
 
@@ -26,6 +26,7 @@
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/Validate.h"
+#include "arm_compute/core/utils/quantization/QuantizationParamsCache.h"
 
 #include <cstddef>
 #include <ios>
@@ -288,25 +289,17 @@ void CPPDetectionPostProcessLayer::run()
     // Decode scores if necessary
     if(_dequantize_scores)
     {
-        if(_input_box_encoding->info()->data_type() == DataType::QASYMM8)
+        const DataType scores_data_type = _input_box_encoding->info()->data_type();
+        if(scores_data_type == DataType::QASYMM8 || scores_data_type == DataType::QASYMM8_SIGNED)
         {
+            const bool  is_signed = scores_data_type == DataType::QASYMM8_SIGNED;
+            const auto &dequant_lut = quantization::QuantizationParamsCache::get().dequantization_lut(_input_scores->info()->quantization_info().uniform(), is_signed);
             for(unsigned int idx_c = 0; idx_c < _num_classes_with_background; ++idx_c)
             {
                 for(unsigned int idx_b = 0; idx_b < _num_boxes; ++idx_b)
                 {
                     *(reinterpret_cast<float *>(_decoded_scores.ptr_to_element(Coordinates(idx_c, idx_b)))) =
-                        dequantize_qasymm8(*(reinterpret_cast<qasymm8_t *>(_input_scores->ptr_to_element(Coordinates(idx_c, idx_b)))), _input_scores->info()->quantization_info());
-                }
-            }
-        }
-        else if(_input_box_encoding->info()->data_type() == DataType::QASYMM8_SIGNED)
-        {
-            for(unsigned int idx_c = 0; idx_c < _num_classes_with_background; ++idx_c)
-            {
-                for(unsigned int idx_b = 0; idx_b < _num_boxes; ++idx_b)
-                {
-                    *(reinterpret_cast<float *>(_decoded_scores.ptr_to_element(Coordinates(idx_c, idx_b)))) =
-                        dequantize_qasymm8_signed(*(reinterpret_cast<qasymm8_signed_t *>(_input_scores->ptr_to_element(Coordinates(idx_c, idx_b)))), _input_scores->info()->quantization_info());
+                        dequant_lut[*(_input_scores->ptr_to_element(Coordinates(idx_c, idx_b)))];
                 }
             }
         }
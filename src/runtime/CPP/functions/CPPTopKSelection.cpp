@@ -21,29 +21,22 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
-#include "arm_compute/core/TracePoint.h"
-#include <stdio.h>
-#include <vector>
+#include "arm_compute/runtime/CPP/functions/CPPTopKSelection.h"
 
-#include "arm_compute/core/NEON/kernels/assembly/arm_gemm.hpp"
-#include "arm_compute/runtime/Array.h"
-#include "arm_compute/runtime/Pyramid.h"
-#include "arm_compute/runtime/common/LSTMParams.h"
-#include "utils/TypePrinter.h"
+#include "arm_compute/core/CPP/kernels/CPPTopKSelectionKernel.h"
+#include "support/MemorySupport.h"
 
 namespace arm_compute
 {
-TRACE_TO_STRING(KeyPointArray)
-TRACE_TO_STRING(Pyramid)
-TRACE_TO_STRING(LSTMParams<ITensor>)
-TRACE_TO_STRING(FullyConnectedLayerInfo)
-TRACE_TO_STRING(arm_gemm::Requantize32)
+void CPPTopKSelection::configure(const ITensor *scores, ITensor *values, ITensor *indices, const unsigned int k)
+{
+    auto kernel = arm_compute::support::cpp14::make_unique<CPPTopKSelectionKernel>();
+    kernel->configure(scores, values, indices, k);
+    _kernel = std::move(kernel);
+}
 
-CONST_PTR_CLASS(KeyPointArray)
-CONST_PTR_CLASS(Pyramid)
-CONST_PTR_CLASS(LSTMParams<ITensor>)
-CONST_PTR_CLASS(DetectionPostProcessLayerInfo)
-CONST_PTR_CLASS(FullyConnectedLayerInfo)
-CONST_PTR_CLASS(GenerateProposalsInfo)
-CONST_PTR_CLASS(arm_gemm::Requantize32)
+Status CPPTopKSelection::validate(const ITensorInfo *scores, const ITensorInfo *values, const ITensorInfo *indices, const unsigned int k)
+{
+    return CPPTopKSelectionKernel::validate(scores, values, indices, k);
+}
 } // namespace arm_compute
@@ -61,6 +61,26 @@
 #define HWCAP_ASIMDDP (1 << 20) // NOLINT
 #endif                          /* HWCAP_ASIMDDP */
 
+#ifndef HWCAP_SVE
+#define HWCAP_SVE (1 << 22) // NOLINT
+#endif                      /* HWCAP_SVE */
+
+#ifndef HWCAP_ASIMDFHM
+#define HWCAP_ASIMDFHM (1 << 23) // NOLINT
+#endif                           /* HWCAP_ASIMDFHM */
+
+#ifndef HWCAP2_SVE2
+#define HWCAP2_SVE2 (1 << 1) // NOLINT
+#endif                       /* HWCAP2_SVE2 */
+
+#ifndef HWCAP2_I8MM
+#define HWCAP2_I8MM (1 << 13) // NOLINT
+#endif                        /* HWCAP2_I8MM */
+
+#ifndef HWCAP2_BF16
+#define HWCAP2_BF16 (1 << 14) // NOLINT
+#endif                        /* HWCAP2_BF16 */
+
 namespace
 {
 using namespace arm_compute;
@@ -376,6 +396,16 @@ void get_cpu_configuration(CPUInfo &cpuinfo)
     {
         hwcaps_dot_support = true;
     }
+
+    // The remaining architecture features have no model-based fallback: they are
+    // only reported on kernels recent enough to expose the corresponding HWCAP bits.
+    const uint32_t hwcaps2 = getauxval(AT_HWCAP2);
+
+    cpuinfo.set_sve((hwcaps & HWCAP_SVE) != 0);
+    cpuinfo.set_fhm((hwcaps & HWCAP_ASIMDFHM) != 0);
+    cpuinfo.set_sve2((hwcaps2 & HWCAP2_SVE2) != 0);
+    cpuinfo.set_i8mm((hwcaps2 & HWCAP2_I8MM) != 0);
+    cpuinfo.set_bf16((hwcaps2 & HWCAP2_BF16) != 0);
 #endif /* defined(__aarch64__) */
 
     const unsigned int max_cpus = get_max_cpus();
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/ConstTensorStore.h"
+
+#include "arm_compute/core/Error.h"
+#include "support/MemorySupport.h"
+
+#include <cstring>
+
+namespace arm_compute
+{
+namespace
+{
+/** FNV-1a hash over a byte buffer, used to identify const tensors by content */
+uint64_t hash_content(const uint8_t *data, size_t size)
+{
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for(size_t i = 0; i < size; ++i)
+    {
+        hash = (hash ^ data[i]) * 0x100000001b3ULL;
+    }
+    return hash;
+}
+} // namespace
+
+ConstTensorStore &ConstTensorStore::get()
+{
+    static ConstTensorStore store;
+    return store;
+}
+
+const void *ConstTensorStore::deduplicate(const void *data, size_t size)
+{
+    ARM_COMPUTE_ERROR_ON(data == nullptr);
+    ARM_COMPUTE_ERROR_ON(size == 0);
+
+    const uint64_t hash = hash_content(static_cast<const uint8_t *>(data), size);
+
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+
+    const auto key = std::make_pair(hash, size);
+    auto       it  = _store.find(key);
+    if(it != _store.end())
+    {
+        // Hash and size match; verify the contents before sharing to rule out collisions
+        if(std::memcmp(it->second->buffer(), data, size) == 0)
+        {
+            _bytes_saved += size;
+            return it->second->buffer();
+        }
+        return data;
+    }
+
+    // First occurrence: store a copy, aligned so the shared buffer suits any consumer
+    auto region = support::cpp14::make_unique<MemoryRegion>(size, 64);
+    std::memcpy(region->buffer(), data, size);
+    it = _store.emplace(key, std::move(region)).first;
+
+    return it->second->buffer();
+}
+
+size_t ConstTensorStore::num_buffers() const
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+    return _store.size();
+}
+
+size_t ConstTensorStore::bytes_saved() const
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+    return _bytes_saved;
+}
+
+void ConstTensorStore::clear()
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+    _store.clear();
+    _bytes_saved = 0;
+}
+} // namespace arm_compute
@@ -27,6 +27,8 @@
 #include "arm_compute/core/GLES_COMPUTE/GCHelpers.h"
 #include "arm_compute/core/GLES_COMPUTE/GCKernelLibrary.h"
 
+#include <cstdlib>
+
 using namespace arm_compute;
 
 std::once_flag GCScheduler::_initialize_symbols;
@@ -65,6 +67,14 @@ void GCScheduler::init(EGLDisplay dpy, EGLContext ctx)
     _target = get_target_from_device();
 
     GCKernelLibrary::get().init("./cs_shaders/", dpy, ctx);
+
+    // Maintain an on-disk program binary cache in the directory given by ARM_COMPUTE_GC_CACHE_DIR,
+    // unless a cache directory has already been set explicitly
+    const char *cache_dir = std::getenv("ARM_COMPUTE_GC_CACHE_DIR");
+    if(cache_dir != nullptr && GCKernelLibrary::get().binary_cache_path().empty())
+    {
+        GCKernelLibrary::get().set_binary_cache_path(cache_dir);
+    }
 }
 
 GCScheduler &GCScheduler::get()
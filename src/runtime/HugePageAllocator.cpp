@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/HugePageAllocator.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/runtime/MemoryRegion.h"
+#include "support/MemorySupport.h"
+
+#include <cstdint>
+#include <sys/mman.h>
+
+namespace arm_compute
+{
+namespace
+{
+/** Memory region handing its backing memory back to the owning allocator on destruction */
+class HugePageMemoryRegion final : public IMemoryRegion
+{
+public:
+    HugePageMemoryRegion(HugePageAllocator &allocator, void *ptr, size_t size)
+        : IMemoryRegion(size), _allocator(allocator), _ptr(ptr)
+    {
+        MemoryCounters::get().record_allocation(_size);
+    }
+    HugePageMemoryRegion(const HugePageMemoryRegion &) = delete;
+    HugePageMemoryRegion &operator=(const HugePageMemoryRegion &) = delete;
+    ~HugePageMemoryRegion()
+    {
+        MemoryCounters::get().record_free(_size);
+        _allocator.free(_ptr);
+    }
+
+    // Inherited methods overridden:
+    void *buffer() final
+    {
+        return _ptr;
+    }
+    const void *buffer() const final
+    {
+        return _ptr;
+    }
+    std::unique_ptr<IMemoryRegion> extract_subregion(size_t offset, size_t size) final
+    {
+        if(_ptr != nullptr && (offset < _size) && (_size - offset >= size))
+        {
+            return support::cpp14::make_unique<MemoryRegion>(static_cast<uint8_t *>(_ptr) + offset, size);
+        }
+        return nullptr;
+    }
+
+private:
+    HugePageAllocator &_allocator;
+    void              *_ptr;
+};
+
+/** Rounds up a size to the next multiple of a granule */
+size_t round_up(size_t size, size_t granule)
+{
+    return ((size + granule - 1) / granule) * granule;
+}
+} // namespace
+
+HugePageAllocator::HugePageAllocator(size_t huge_page_size)
+    : _huge_page_size(huge_page_size), _allocations(), _allocations_mutex()
+{
+    ARM_COMPUTE_ERROR_ON_MSG(huge_page_size == 0 || (huge_page_size & (huge_page_size - 1)) != 0, "Huge page size must be a power of two");
+}
+
+void *HugePageAllocator::allocate(size_t size, size_t alignment)
+{
+    if(size == 0)
+    {
+        return nullptr;
+    }
+
+    // Explicit huge page mappings are aligned to the huge page size; larger
+    // alignments are satisfied by over-mapping and aligning within the mapping
+    const size_t extra_bytes  = (alignment > _huge_page_size) ? alignment : 0;
+    const size_t mapped_bytes = round_up(size + extra_bytes, _huge_page_size);
+
+    void *base = MAP_FAILED;
+#if defined(MAP_HUGETLB)
+    base = mmap(nullptr, mapped_bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+#endif /* defined(MAP_HUGETLB) */
+    if(base == MAP_FAILED)
+    {
+        // No huge pages reserved: fall back to regular pages and ask the kernel
+        // to back the (huge-page sized and aligned) range with transparent huge pages
+        base = mmap(nullptr, mapped_bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        ARM_COMPUTE_ERROR_ON_MSG(base == MAP_FAILED, "Failed to map memory");
+#if defined(MADV_HUGEPAGE)
+        madvise(base, mapped_bytes, MADV_HUGEPAGE);
+#endif /* defined(MADV_HUGEPAGE) */
+    }
+
+    void *ptr = base;
+    if(alignment != 0)
+    {
+        const uintptr_t addr = reinterpret_cast<uintptr_t>(base);
+        ptr                  = reinterpret_cast<void *>(round_up(addr, alignment));
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_allocations_mutex);
+        _allocations[ptr] = Mapping{ base, mapped_bytes };
+    }
+    return ptr;
+}
+
+void HugePageAllocator::free(void *ptr)
+{
+    if(ptr == nullptr)
+    {
+        return;
+    }
+
+    Mapping mapping{};
+    {
+        std::lock_guard<std::mutex> lock(_allocations_mutex);
+        auto                        it = _allocations.find(ptr);
+        ARM_COMPUTE_ERROR_ON_MSG(it == _allocations.end(), "Pointer was not allocated by this allocator");
+        mapping = it->second;
+        _allocations.erase(it);
+    }
+    munmap(mapping.base, mapping.mapped_bytes);
+}
+
+std::unique_ptr<IMemoryRegion> HugePageAllocator::make_region(size_t size, size_t alignment)
+{
+    void *ptr = allocate(size, alignment);
+    return support::cpp14::make_unique<HugePageMemoryRegion>(*this, ptr, size);
+}
+} // namespace arm_compute
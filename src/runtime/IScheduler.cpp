@@ -23,6 +23,8 @@
  */
 #include "arm_compute/runtime/IScheduler.h"
 
+#include "arm_compute/runtime/KernelProfiler.h"
+
 #include "arm_compute/core/Error.h"
 #include "arm_compute/runtime/CPUUtils.h"
 
@@ -53,8 +55,24 @@ unsigned int IScheduler::num_threads_hint() const
 }
 void IScheduler::run_tagged_workloads(std::vector<Workload> &workloads, const char *tag)
 {
-    ARM_COMPUTE_UNUSED(tag);
+    if(KernelProfiler::is_enabled())
+    {
+        const char *name = (tag != nullptr) ? tag : "tagged_workload";
+        for(auto &workload : workloads)
+        {
+            Workload original = std::move(workload);
+            workload           = [name, original](const ThreadInfo & info)
+            {
+                ScopedKernelProfile profile(name, info.thread_id);
+                original(info);
+            };
+        }
+    }
     run_workloads(workloads);
 }
 
+void IScheduler::warmup()
+{
+}
+
 } // namespace arm_compute
@@ -37,7 +37,7 @@
 namespace arm_compute
 {
 ISimpleLifetimeManager::ISimpleLifetimeManager()
-    : _active_group(nullptr), _active_elements(), _free_blobs(), _occupied_blobs(), _finalized_groups()
+    : _active_group(nullptr), _active_elements(), _free_blobs(), _occupied_blobs(), _finalized_groups(), _lifetime_serial(0)
 {
 }
 
@@ -81,7 +81,8 @@ void ISimpleLifetimeManager::start_lifetime(void *obj)
     }
 
     // Insert object in groups and mark its finalized state to false
-    _active_elements.insert(std::make_pair(obj, obj));
+    auto insert_it                        = _active_elements.insert(std::make_pair(obj, obj));
+    insert_it.first->second.start_serial = ++_lifetime_serial;
 }
 
 void ISimpleLifetimeManager::end_lifetime(void *obj, IMemory &obj_memory, size_t size, size_t alignment)
@@ -93,11 +94,12 @@ void ISimpleLifetimeManager::end_lifetime(void *obj, IMemory &obj_memory, size_t
     ARM_COMPUTE_ERROR_ON(active_object_it == std::end(_active_elements));
 
     // Update object fields and mark object as complete
-    Element &el  = active_object_it->second;
-    el.handle    = &obj_memory;
-    el.size      = size;
-    el.alignment = alignment;
-    el.status    = true;
+    Element &el   = active_object_it->second;
+    el.handle     = &obj_memory;
+    el.size       = size;
+    el.alignment  = alignment;
+    el.status     = true;
+    el.end_serial = ++_lifetime_serial;
 
     // Find object in the occupied lists
     auto occupied_blob_it = std::find_if(std::begin(_occupied_blobs), std::end(_occupied_blobs), [&obj](const Blob & b)
@@ -131,6 +133,112 @@ void ISimpleLifetimeManager::end_lifetime(void *obj, IMemory &obj_memory, size_t
     }
 }
 
+std::vector<ISimpleLifetimeManager::Element> ISimpleLifetimeManager::finalized_elements() const
+{
+    std::vector<Element> elements;
+    for(const auto &group : _finalized_groups)
+    {
+        for(const auto &element : group.second)
+        {
+            elements.push_back(element.second);
+        }
+    }
+    std::sort(std::begin(elements), std::end(elements), [](const Element & lhs, const Element & rhs)
+    {
+        return lhs.start_serial < rhs.start_serial;
+    });
+    return elements;
+}
+
+size_t ISimpleLifetimeManager::lifetime_serial() const
+{
+    return _lifetime_serial;
+}
+
+void ISimpleLifetimeManager::release_all_groups()
+{
+    for(auto &group : _finalized_groups)
+    {
+        group.first->mappings().clear();
+    }
+    _finalized_groups.clear();
+}
+
+MemoryReport ISimpleLifetimeManager::report() const
+{
+    MemoryReport report;
+    report.mapping_type = mapping_type();
+
+    // Collect per-object placements from the finalized groups
+    size_t group_id = 0;
+    for(const auto &group : _finalized_groups)
+    {
+        const auto &mappings = group.first->mappings();
+        for(const auto &element : group.second)
+        {
+            const Element &el = element.second;
+
+            MemoryRegionReport region;
+            region.group_id       = group_id;
+            region.size           = el.size;
+            region.alignment      = el.alignment;
+            region.lifetime_start = el.start_serial;
+            region.lifetime_end   = el.end_serial;
+
+            auto mapping_it  = mappings.find(el.handle);
+            region.placement = (mapping_it != std::end(mappings)) ? mapping_it->second : 0;
+
+            report.regions.push_back(region);
+        }
+        ++group_id;
+    }
+
+    // Aggregate the pool size from the placements
+    if(report.mapping_type == MappingType::BLOBS)
+    {
+        for(const auto &region : report.regions)
+        {
+            if(region.placement >= report.blob_sizes.size())
+            {
+                report.blob_sizes.resize(region.placement + 1, 0);
+            }
+            report.blob_sizes[region.placement] = std::max(report.blob_sizes[region.placement], region.size);
+        }
+        for(auto blob_size : report.blob_sizes)
+        {
+            report.total_bytes += blob_size;
+        }
+    }
+    else
+    {
+        for(const auto &region : report.regions)
+        {
+            report.total_bytes = std::max(report.total_bytes, region.placement + region.size);
+        }
+    }
+
+    // High-water mark of concurrently live bytes: sweep the lifetime serials of each
+    // group; groups time-share the pool, so the peak is the per-group maximum. The gap
+    // to total_bytes is the slack the placement strategy left on the table.
+    std::map<size_t, std::map<size_t, long long>> group_events;
+    for(const auto &region : report.regions)
+    {
+        group_events[region.group_id][region.lifetime_start] += static_cast<long long>(region.size);
+        group_events[region.group_id][region.lifetime_end] -= static_cast<long long>(region.size);
+    }
+    for(const auto &events : group_events)
+    {
+        long long live = 0;
+        for(const auto &event : events.second)
+        {
+            live = live + event.second;
+            report.peak_bytes = std::max(report.peak_bytes, static_cast<size_t>(std::max(live, 0LL)));
+        }
+    }
+
+    return report;
+}
+
 bool ISimpleLifetimeManager::are_all_finalized() const
 {
     return !std::any_of(std::begin(_active_elements), std::end(_active_elements), [](const std::pair<void *, Element> &e)
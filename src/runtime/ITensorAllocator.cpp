@@ -31,10 +31,20 @@
 using namespace arm_compute;
 
 ITensorAllocator::ITensorAllocator()
-    : _info(), _alignment(0)
+    : _info(), _alignment(0), _allocation_policy(AllocationPolicy::Lazy)
 {
 }
 
+void ITensorAllocator::set_allocation_policy(AllocationPolicy policy)
+{
+    _allocation_policy = policy;
+}
+
+AllocationPolicy ITensorAllocator::allocation_policy() const
+{
+    return _allocation_policy;
+}
+
 void ITensorAllocator::init(const TensorInfo &input, size_t alignment)
 {
     _info      = input;
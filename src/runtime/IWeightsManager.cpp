@@ -23,16 +23,83 @@
  */
 #include "arm_compute/runtime/IWeightsManager.h"
 
+#include <cstring>
+#include <fstream>
+
 namespace arm_compute
 {
+namespace
+{
+/** FNV-1a hash over a byte buffer, used to identify weight tensors by content */
+uint64_t hash_weights_content(const uint8_t *data, size_t size)
+{
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for(size_t i = 0; i < size; ++i)
+    {
+        hash = (hash ^ data[i]) * 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+/** FNV-1a hash over the properties of the source weights the transformed output depends
+ *  on: shape, data type and layout. Byte-identical buffers interpreted under different
+ *  descriptions (e.g. a transposed shape) must not share a transformed allocation. */
+uint64_t hash_weights_info(const ITensorInfo &info)
+{
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    auto     mix  = [&hash](uint64_t value)
+    {
+        hash = (hash ^ value) * 0x100000001b3ULL;
+    };
+    mix(info.num_dimensions());
+    for(size_t i = 0; i < info.num_dimensions(); ++i)
+    {
+        mix(info.dimension(i));
+    }
+    mix(static_cast<uint64_t>(info.data_type()));
+    mix(static_cast<uint64_t>(info.data_layout()));
+    return hash;
+}
+
+#if !defined(BARE_METAL)
+/** Magic number identifying a transformed weights cache file */
+constexpr uint32_t transformed_weights_magic = 0x574C4341; // "ACLW"
+/** Version of the transformed weights cache file layout. Version 2 added the source
+ *  description and transform parametrization hashes to each entry's key. */
+constexpr uint32_t transformed_weights_version = 2;
+
+/** Read a trivially copyable value from a byte buffer, advancing @p offset. Entries are packed,
+ *  so the value is copied out instead of being read in place to avoid unaligned accesses. */
+template <typename T>
+bool read_value(const unsigned char *data, size_t size, size_t &offset, T &value)
+{
+    if(offset + sizeof(T) > size)
+    {
+        return false;
+    }
+    std::memcpy(&value, data + offset, sizeof(T));
+    offset += sizeof(T);
+    return true;
+}
+
+/** Write a trivially copyable value to an output stream */
+template <typename T>
+void write_value(std::ofstream &file, const T &value)
+{
+    file.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+#endif /* !defined(BARE_METAL) */
+} // namespace
+
 IWeightsManager::IWeightsManager()
-    : _managed_weights(), _managed_weights_parents()
+    : _managed_weights(), _managed_weights_parents(), _deduplicated_weights(), _preloaded_weights()
 {
 }
 
 void IWeightsManager::manage(const ITensor *weights, ITransformWeights *parent)
 {
-    if(!are_weights_managed(weights))
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mutex);
+    if(_managed_weights.find(weights) == _managed_weights.end())
     {
         _managed_weights[weights];
     }
@@ -50,7 +117,10 @@ void IWeightsManager::manage(const ITensor *weights, ITransformWeights *parent)
 
 ITensor *IWeightsManager::run(const ITensor *weights, ITransformWeights *weights_transform)
 {
-    ARM_COMPUTE_ERROR_ON_MSG(!are_weights_managed(weights), "Cannot run function. Weights are not managed");
+    // Holding the lock across the transform serializes managed reshapes, but keeps the
+    // bookkeeping consistent when prepare runs concurrently across nodes
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mutex);
+    ARM_COMPUTE_ERROR_ON_MSG(_managed_weights.find(weights) == _managed_weights.end(), "Cannot run function. Weights are not managed");
 
     // Find if I have the same weights with weights transform. If I do, don't run the reshape
     auto     item = _managed_weights.find(weights);
@@ -68,10 +138,55 @@ ITensor *IWeightsManager::run(const ITensor *weights, ITransformWeights *weights
         }
     }
 
+    // Deduplicate by content: weights tensors that hash to the same bytes share
+    // one pretransposed allocation for a given transform, so shared-weight
+    // models (siamese encoders, tied embeddings) don't hold duplicate copies.
+    bool content_key_valid = false;
+    IWeightsManager::ContentKey content_key{};
+    if(perform_run && weights->buffer() != nullptr)
+    {
+        const size_t   weights_size = weights->info()->total_size();
+        const uint64_t content_hash = hash_weights_content(weights->buffer(), weights_size);
+        content_key                 = std::make_tuple(content_hash, weights_size, weights_transform->uid(), hash_weights_info(*weights->info()), weights_transform->parameters_hash());
+        content_key_valid           = true;
+
+        auto dedup_it = _deduplicated_weights.find(content_key);
+        if(dedup_it != _deduplicated_weights.end())
+        {
+            weights_tensor = dedup_it->second;
+            perform_run    = false;
+        }
+    }
+
+#if !defined(BARE_METAL)
+    // Warm start: restore the transformed contents from a preloaded cache file instead of
+    // running the reshape function
+    if(perform_run && content_key_valid && !_preloaded_weights.empty())
+    {
+        auto preloaded = _preloaded_weights.find(content_key);
+        if(preloaded != _preloaded_weights.end())
+        {
+            ITensor *transformed = weights_transform->get_weights();
+            if(transformed->info()->total_size() == preloaded->second.second && weights_transform->allocate_only())
+            {
+                std::memcpy(transformed->buffer(), preloaded->second.first, preloaded->second.second);
+                weights_transform->mark_as_run();
+                weights_tensor                     = transformed;
+                perform_run                        = false;
+                _deduplicated_weights[content_key] = weights_tensor;
+            }
+        }
+    }
+#endif /* !defined(BARE_METAL) */
+
     if(perform_run)
     {
         weights_transform->run();
         weights_tensor = weights_transform->get_weights();
+        if(content_key_valid)
+        {
+            _deduplicated_weights[content_key] = weights_tensor;
+        }
     }
 
     // Check if we can release memory from parent
@@ -111,12 +226,132 @@ ITensor *IWeightsManager::run(const ITensor *weights, ITransformWeights *weights
 
 bool IWeightsManager::are_weights_managed(const ITensor *weights)
 {
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mutex);
     return (_managed_weights.find(weights) != _managed_weights.end());
 }
 
+bool IWeightsManager::save_transformed_weights(const std::string &filename)
+{
+#if !defined(BARE_METAL)
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mutex);
+    std::ofstream file(filename, std::ios::binary);
+    if(!file.good())
+    {
+        return false;
+    }
+
+    // Only host-accessible tensors can be stored: device-side tensors (e.g. unmapped OpenCL
+    // buffers) are skipped and will be recomputed on the next start
+    uint64_t num_entries = 0;
+    for(auto &item : _deduplicated_weights)
+    {
+        if(item.second->buffer() != nullptr)
+        {
+            ++num_entries;
+        }
+    }
+
+    write_value(file, transformed_weights_magic);
+    write_value(file, transformed_weights_version);
+    write_value(file, num_entries);
+
+    for(auto &item : _deduplicated_weights)
+    {
+        const ITensor *transformed = item.second;
+        if(transformed->buffer() == nullptr)
+        {
+            continue;
+        }
+
+        const uint64_t data_size = transformed->info()->total_size();
+        write_value(file, std::get<0>(item.first));
+        write_value(file, static_cast<uint64_t>(std::get<1>(item.first)));
+        write_value(file, std::get<2>(item.first));
+        write_value(file, std::get<3>(item.first));
+        write_value(file, std::get<4>(item.first));
+        write_value(file, data_size);
+        file.write(reinterpret_cast<const char *>(transformed->buffer()), data_size);
+    }
+
+    return file.good();
+#else  /* !defined(BARE_METAL) */
+    ARM_COMPUTE_UNUSED(filename);
+    return false;
+#endif /* !defined(BARE_METAL) */
+}
+
+bool IWeightsManager::load_transformed_weights(const std::string &filename)
+{
+#if !defined(BARE_METAL)
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mutex);
+    _preloaded_weights.clear();
+    _preloaded_file.release();
+
+    // MMappedFile creates missing files on map: bail out early so a cold start doesn't leave
+    // an empty cache file behind
+    std::ifstream file(filename, std::ios::binary);
+    if(!file.good())
+    {
+        return false;
+    }
+    file.close();
+
+    // Map the cache instead of reading it so that its pages are shared with the page cache
+    // and faulted in on demand when the transformed contents are restored
+    if(!_preloaded_file.map(filename, 0, 0) || !_preloaded_file.is_mapped())
+    {
+        return false;
+    }
+
+    const unsigned char *data = _preloaded_file.data();
+    const size_t         size = _preloaded_file.file_size();
+
+    size_t   offset      = 0;
+    uint32_t magic       = 0;
+    uint32_t version     = 0;
+    uint64_t num_entries = 0;
+    if(!read_value(data, size, offset, magic) || magic != transformed_weights_magic
+       || !read_value(data, size, offset, version) || version != transformed_weights_version
+       || !read_value(data, size, offset, num_entries))
+    {
+        _preloaded_file.release();
+        return false;
+    }
+
+    for(uint64_t i = 0; i < num_entries; ++i)
+    {
+        uint64_t content_hash = 0;
+        uint64_t src_size     = 0;
+        uint32_t uid          = 0;
+        uint64_t info_hash    = 0;
+        uint64_t params_hash  = 0;
+        uint64_t data_size    = 0;
+        if(!read_value(data, size, offset, content_hash) || !read_value(data, size, offset, src_size)
+           || !read_value(data, size, offset, uid) || !read_value(data, size, offset, info_hash)
+           || !read_value(data, size, offset, params_hash) || !read_value(data, size, offset, data_size)
+           || offset + data_size > size)
+        {
+            _preloaded_weights.clear();
+            _preloaded_file.release();
+            return false;
+        }
+
+        const ContentKey key   = std::make_tuple(content_hash, static_cast<size_t>(src_size), uid, info_hash, params_hash);
+        _preloaded_weights[key] = std::make_pair(reinterpret_cast<const uint8_t *>(data + offset), static_cast<size_t>(data_size));
+        offset += data_size;
+    }
+
+    return true;
+#else  /* !defined(BARE_METAL) */
+    ARM_COMPUTE_UNUSED(filename);
+    return false;
+#endif /* !defined(BARE_METAL) */
+}
+
 ITensor *IWeightsManager::acquire(const ITensor *weights, ITransformWeights *weights_transform)
 {
-    ARM_COMPUTE_ERROR_ON_MSG(!are_weights_managed(weights), "Cannot acquire weights. Weights are not managed");
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mutex);
+    ARM_COMPUTE_ERROR_ON_MSG(_managed_weights.find(weights) == _managed_weights.end(), "Cannot acquire weights. Weights are not managed");
 
     ITensor *transformed_weights{ nullptr };
     auto     item = _managed_weights.find(weights);
@@ -141,8 +376,15 @@ ITensor *IWeightsManager::acquire(const ITensor *weights, ITransformWeights *wei
         item->second.emplace_back(weights_transform);
     }
 
-    // Manage the weights and store link to the parent node
-    manage(transformed_weights, weights_transform);
+    // Manage the weights and store link to the parent node (inline as the lock is already held)
+    if(_managed_weights.find(transformed_weights) == _managed_weights.end())
+    {
+        _managed_weights[transformed_weights];
+    }
+    if(_managed_weights_parents.find(transformed_weights) == _managed_weights_parents.end())
+    {
+        _managed_weights_parents[transformed_weights] = weights_transform;
+    }
 
     return transformed_weights;
 }
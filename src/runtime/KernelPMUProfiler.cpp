@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/KernelPMUProfiler.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+
+#if defined(__linux__) && !defined(BARE_METAL)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif /* defined(__linux__) && !defined(BARE_METAL) */
+
+namespace arm_compute
+{
+namespace
+{
+/** Report path from the environment, nullptr when profiling is disabled */
+const char *pmu_file()
+{
+    static const char *file = std::getenv("ARM_COMPUTE_PMU_FILE");
+    return file;
+}
+
+#if defined(__linux__) && !defined(BARE_METAL)
+/** Hardware counters attached to the owning thread */
+class ThreadCounters final
+{
+public:
+    ThreadCounters()
+    {
+        _cycles       = open_counter(PERF_COUNT_HW_CPU_CYCLES);
+        _instructions = open_counter(PERF_COUNT_HW_INSTRUCTIONS);
+        _cache_misses = open_counter(PERF_COUNT_HW_CACHE_MISSES);
+    }
+    ~ThreadCounters()
+    {
+        close_counter(_cycles);
+        close_counter(_instructions);
+        close_counter(_cache_misses);
+    }
+
+    KernelPMUProfiler::Sample read() const
+    {
+        KernelPMUProfiler::Sample sample;
+        sample.cycles       = read_counter(_cycles);
+        sample.instructions = read_counter(_instructions);
+        sample.cache_misses = read_counter(_cache_misses);
+        return sample;
+    }
+
+private:
+    static long open_counter(uint64_t config)
+    {
+        perf_event_attr attr{};
+        attr.type     = PERF_TYPE_HARDWARE;
+        attr.size     = sizeof(perf_event_attr);
+        attr.config   = config;
+        attr.disabled = 1;
+
+        // Measure the calling thread on any CPU
+        const long fd = syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+        if(fd >= 0)
+        {
+            ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+        return fd;
+    }
+
+    static void close_counter(long fd)
+    {
+        if(fd >= 0)
+        {
+            ::close(fd);
+        }
+    }
+
+    static uint64_t read_counter(long fd)
+    {
+        uint64_t value = 0;
+        if(fd < 0 || ::read(fd, &value, sizeof(value)) != sizeof(value))
+        {
+            return 0;
+        }
+        return value;
+    }
+
+    long _cycles{ -1 };
+    long _instructions{ -1 };
+    long _cache_misses{ -1 };
+};
+
+KernelPMUProfiler::Sample read_thread_counters()
+{
+    static thread_local ThreadCounters counters;
+    return counters.read();
+}
+#else  /* defined(__linux__) && !defined(BARE_METAL) */
+KernelPMUProfiler::Sample read_thread_counters()
+{
+    return KernelPMUProfiler::Sample{};
+}
+#endif /* defined(__linux__) && !defined(BARE_METAL) */
+
+/** Start sample of the kernel currently executing on this thread */
+thread_local KernelPMUProfiler::Sample tls_start_sample{};
+} // namespace
+
+KernelPMUProfiler &KernelPMUProfiler::get()
+{
+    static KernelPMUProfiler profiler;
+    return profiler;
+}
+
+bool KernelPMUProfiler::is_enabled()
+{
+    return pmu_file() != nullptr;
+}
+
+KernelPMUProfiler::~KernelPMUProfiler()
+{
+    if(is_enabled())
+    {
+        dump(pmu_file());
+    }
+}
+
+void KernelPMUProfiler::begin()
+{
+    tls_start_sample = read_thread_counters();
+}
+
+void KernelPMUProfiler::end(const char *name)
+{
+    const Sample end_sample = read_thread_counters();
+
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mutex);
+    Aggregate &aggregate = _aggregates[name];
+    ++aggregate.calls;
+    aggregate.cycles += end_sample.cycles - tls_start_sample.cycles;
+    aggregate.instructions += end_sample.instructions - tls_start_sample.instructions;
+    aggregate.cache_misses += end_sample.cache_misses - tls_start_sample.cache_misses;
+}
+
+std::map<std::string, KernelPMUProfiler::Aggregate> KernelPMUProfiler::aggregates() const
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mutex);
+    return _aggregates;
+}
+
+void KernelPMUProfiler::dump(const std::string &filename) const
+{
+    std::ofstream fs(filename, std::ios::out | std::ios::trunc);
+    if(!fs.is_open())
+    {
+        return;
+    }
+
+    fs << "name calls cycles instructions cache_misses ipc mpki\n";
+    fs << std::fixed << std::setprecision(3);
+    for(const auto &entry : aggregates())
+    {
+        const Aggregate &aggregate = entry.second;
+        const double     ipc       = (aggregate.cycles != 0) ? static_cast<double>(aggregate.instructions) / aggregate.cycles : 0.0;
+        const double     mpki      = (aggregate.instructions != 0) ? 1000.0 * aggregate.cache_misses / aggregate.instructions : 0.0;
+        fs << entry.first << " " << aggregate.calls << " " << aggregate.cycles << " " << aggregate.instructions << " "
+           << aggregate.cache_misses << " " << ipc << " " << mpki << "\n";
+    }
+}
+
+void KernelPMUProfiler::clear()
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mutex);
+    _aggregates.clear();
+}
+} // namespace arm_compute
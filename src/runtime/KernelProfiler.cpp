@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/KernelProfiler.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+
+namespace arm_compute
+{
+namespace
+{
+/** Dump path from the environment, nullptr when profiling is disabled */
+const char *trace_file()
+{
+    static const char *file = std::getenv("ARM_COMPUTE_TRACE_FILE");
+    return file;
+}
+} // namespace
+
+constexpr unsigned int KernelProfiler::capacity;
+
+KernelProfiler &KernelProfiler::get()
+{
+    static KernelProfiler profiler;
+    return profiler;
+}
+
+bool KernelProfiler::is_enabled()
+{
+    return trace_file() != nullptr;
+}
+
+KernelProfiler::KernelProfiler()
+    : _events(capacity), _next(0)
+{
+}
+
+KernelProfiler::~KernelProfiler()
+{
+    if(is_enabled())
+    {
+        dump(trace_file());
+    }
+}
+
+void KernelProfiler::record(const char *name, uint64_t start_ns, uint64_t end_ns, int32_t thread_id)
+{
+    const uint64_t slot = _next.fetch_add(1, std::memory_order_relaxed) % capacity;
+    _events[slot]       = { name, start_ns, end_ns, thread_id };
+}
+
+void KernelProfiler::dump(const std::string &filename) const
+{
+    std::ofstream fs(filename, std::ios::out | std::ios::trunc);
+    if(!fs.is_open())
+    {
+        return;
+    }
+
+    const uint64_t num_events = std::min<uint64_t>(_next.load(std::memory_order_relaxed), capacity);
+
+    fs << std::fixed << std::setprecision(3);
+    fs << "{\"traceEvents\":[";
+    bool first = true;
+    for(uint64_t i = 0; i < num_events; ++i)
+    {
+        const Event &event = _events[i];
+        if(event.name == nullptr || event.end_ns < event.start_ns)
+        {
+            continue;
+        }
+        if(!first)
+        {
+            fs << ",";
+        }
+        first = false;
+        fs << "{\"name\":\"" << event.name << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << event.thread_id
+           << ",\"ts\":" << static_cast<double>(event.start_ns) / 1000.0
+           << ",\"dur\":" << static_cast<double>(event.end_ns - event.start_ns) / 1000.0 << "}";
+    }
+    fs << "]}\n";
+}
+
+void KernelProfiler::clear()
+{
+    std::fill(_events.begin(), _events.end(), Event{});
+    _next.store(0, std::memory_order_relaxed);
+}
+} // namespace arm_compute
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/MemoizingFunction.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/ITensor.h"
+
+#include <algorithm>
+
+namespace arm_compute
+{
+namespace
+{
+/** FNV-1a hash over a byte buffer, used to detect changed input slices by content */
+uint64_t hash_content(const uint8_t *data, size_t size)
+{
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for(size_t i = 0; i < size; ++i)
+    {
+        hash = (hash ^ data[i]) * 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+/** Index of the dimension the input is sliced along: its outermost used dimension */
+size_t slicing_dimension(const ITensorInfo &info)
+{
+    return std::max<size_t>(info.num_dimensions(), 1) - 1;
+}
+
+/** Hash each slice of the tensor along its outermost dimension
+ *
+ * A slice's bytes cover all the lower dimensions including any padding, so the hashes
+ * together cover the whole accessed buffer.
+ */
+std::vector<uint64_t> hash_slices(const ITensor &tensor)
+{
+    const ITensorInfo &info        = *tensor.info();
+    const size_t       dim         = slicing_dimension(info);
+    const size_t       num_slices  = std::max<size_t>(info.dimension(dim), 1);
+    const size_t       slice_bytes = info.strides_in_bytes()[dim];
+    const uint8_t     *base        = tensor.buffer() + info.offset_first_element_in_bytes();
+
+    std::vector<uint64_t> hashes;
+    hashes.reserve(num_slices);
+    for(size_t i = 0; i < num_slices; ++i)
+    {
+        hashes.push_back(hash_content(base + i * slice_bytes, slice_bytes));
+    }
+    return hashes;
+}
+} // namespace
+
+MemoizingFunction::MemoizingFunction()
+    : _function(nullptr), _inputs(), _slice_hashes(), _dirty(), _num_skipped(0), _valid(false)
+{
+}
+
+MemoizingFunction::~MemoizingFunction() = default;
+
+void MemoizingFunction::configure(std::unique_ptr<IFunction> function, std::vector<const ITensor *> inputs)
+{
+    ARM_COMPUTE_ERROR_ON(function == nullptr);
+    ARM_COMPUTE_ERROR_ON(inputs.empty());
+
+    _function = std::move(function);
+    _inputs   = std::move(inputs);
+    _slice_hashes.resize(_inputs.size());
+    _dirty.assign(_inputs.size(), std::make_pair(0, 0));
+    _valid = false;
+}
+
+void MemoizingFunction::invalidate()
+{
+    _valid = false;
+}
+
+Window MemoizingFunction::dirty_window(size_t input_index) const
+{
+    ARM_COMPUTE_ERROR_ON(input_index >= _inputs.size());
+
+    const ITensorInfo &info = *_inputs[input_index]->info();
+    const size_t       dim  = slicing_dimension(info);
+
+    Window win;
+    win.use_tensor_dimensions(info.tensor_shape());
+    win.set(dim, Window::Dimension(_dirty[input_index].first, _dirty[input_index].second, 1));
+    return win;
+}
+
+size_t MemoizingFunction::num_skipped_runs() const
+{
+    return _num_skipped;
+}
+
+void MemoizingFunction::run()
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_function == nullptr, "The function was not configured!");
+
+    bool changed = !_valid;
+    for(size_t i = 0; i < _inputs.size(); ++i)
+    {
+        std::vector<uint64_t> hashes = hash_slices(*_inputs[i]);
+
+        // Dirty interval: [first, last) changed slices; everything on the first run
+        size_t first = 0;
+        size_t last  = hashes.size();
+        if(_valid && hashes.size() == _slice_hashes[i].size())
+        {
+            while(first < last && hashes[first] == _slice_hashes[i][first])
+            {
+                ++first;
+            }
+            while(last > first && hashes[last - 1] == _slice_hashes[i][last - 1])
+            {
+                --last;
+            }
+        }
+        _dirty[i] = std::make_pair(first, last);
+        changed   = changed || (first != last);
+
+        _slice_hashes[i] = std::move(hashes);
+    }
+
+    if(!changed)
+    {
+        ++_num_skipped;
+        return;
+    }
+
+    _function->run();
+    _valid = true;
+}
+
+void MemoizingFunction::prepare()
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_function == nullptr, "The function was not configured!");
+    _function->prepare();
+}
+} // namespace arm_compute
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/MemoryCounters.h"
+
+namespace arm_compute
+{
+MemoryCounters &MemoryCounters::get()
+{
+    static MemoryCounters counters;
+    return counters;
+}
+
+void MemoryCounters::record_allocation(size_t size)
+{
+    _num_allocations.fetch_add(1, std::memory_order_relaxed);
+    _allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+
+    const uint64_t live = _live_bytes.fetch_add(size, std::memory_order_relaxed) + size;
+    uint64_t       peak = _peak_bytes.load(std::memory_order_relaxed);
+    while(live > peak && !_peak_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed))
+    {
+    }
+}
+
+void MemoryCounters::record_free(size_t size)
+{
+    _num_frees.fetch_add(1, std::memory_order_relaxed);
+    _freed_bytes.fetch_add(size, std::memory_order_relaxed);
+    _live_bytes.fetch_sub(size, std::memory_order_relaxed);
+}
+
+void MemoryCounters::record_map(size_t size)
+{
+    _num_maps.fetch_add(1, std::memory_order_relaxed);
+    _mapped_bytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+void MemoryCounters::record_unmap(size_t size)
+{
+    _num_unmaps.fetch_add(1, std::memory_order_relaxed);
+    _unmapped_bytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+MemoryCounters::Snapshot MemoryCounters::snapshot() const
+{
+    Snapshot s;
+    s.num_allocations = _num_allocations.load(std::memory_order_relaxed);
+    s.num_frees       = _num_frees.load(std::memory_order_relaxed);
+    s.allocated_bytes = _allocated_bytes.load(std::memory_order_relaxed);
+    s.freed_bytes     = _freed_bytes.load(std::memory_order_relaxed);
+    s.live_bytes      = _live_bytes.load(std::memory_order_relaxed);
+    s.peak_bytes      = _peak_bytes.load(std::memory_order_relaxed);
+    s.num_maps        = _num_maps.load(std::memory_order_relaxed);
+    s.num_unmaps      = _num_unmaps.load(std::memory_order_relaxed);
+    s.mapped_bytes    = _mapped_bytes.load(std::memory_order_relaxed);
+    s.unmapped_bytes  = _unmapped_bytes.load(std::memory_order_relaxed);
+    return s;
+}
+
+void MemoryCounters::reset()
+{
+    _num_allocations.store(0, std::memory_order_relaxed);
+    _num_frees.store(0, std::memory_order_relaxed);
+    _allocated_bytes.store(0, std::memory_order_relaxed);
+    _freed_bytes.store(0, std::memory_order_relaxed);
+    _num_maps.store(0, std::memory_order_relaxed);
+    _num_unmaps.store(0, std::memory_order_relaxed);
+    _mapped_bytes.store(0, std::memory_order_relaxed);
+    _unmapped_bytes.store(0, std::memory_order_relaxed);
+    _peak_bytes.store(_live_bytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+} // namespace arm_compute
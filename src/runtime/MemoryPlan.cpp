@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/MemoryPlan.h"
+
+#include <algorithm>
+
+#if !defined(BARE_METAL)
+#include <fstream>
+#include <sstream>
+#endif /* !defined(BARE_METAL) */
+
+namespace arm_compute
+{
+Status save_memory_plan(const MemoryReport &plan, const std::string &filename)
+{
+#if !defined(BARE_METAL)
+    std::ofstream fs(filename, std::ios::out | std::ios::trunc);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!fs.is_open(), "Could not open memory plan file for writing");
+
+    // Sort by lifetime so two runs with the same registration order diff clean
+    std::vector<MemoryRegionReport> regions = plan.regions;
+    std::sort(std::begin(regions), std::end(regions), [](const MemoryRegionReport & lhs, const MemoryRegionReport & rhs)
+    {
+        return std::make_pair(lhs.lifetime_start, lhs.group_id) < std::make_pair(rhs.lifetime_start, rhs.group_id);
+    });
+
+    fs << "# memory plan: group placement size alignment lifetime_start lifetime_end\n";
+    fs << "type " << ((plan.mapping_type == MappingType::BLOBS) ? "BLOBS" : "OFFSETS") << "\n";
+    fs << "total " << plan.total_bytes << "\n";
+    fs << "peak " << plan.peak_bytes << "\n";
+    for(const auto &region : regions)
+    {
+        fs << "region " << region.group_id << " " << region.placement << " " << region.size << " "
+           << region.alignment << " " << region.lifetime_start << " " << region.lifetime_end << "\n";
+    }
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!fs.good(), "Error while writing memory plan file");
+
+    return Status{};
+#else  /* !defined(BARE_METAL) */
+    ARM_COMPUTE_UNUSED(plan, filename);
+    ARM_COMPUTE_RETURN_ERROR_MSG("Memory plan files are not supported on bare metal");
+#endif /* !defined(BARE_METAL) */
+}
+
+Status load_memory_plan(MemoryReport &plan, const std::string &filename)
+{
+#if !defined(BARE_METAL)
+    std::ifstream fs(filename, std::ios::in);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!fs.is_open(), "Could not open memory plan file for reading");
+
+    plan = MemoryReport{};
+
+    std::string line;
+    while(std::getline(fs, line))
+    {
+        std::istringstream ss(line);
+        std::string        tag;
+        if(!(ss >> tag) || tag[0] == '#')
+        {
+            continue;
+        }
+
+        if(tag == "type")
+        {
+            std::string type;
+            ARM_COMPUTE_RETURN_ERROR_ON_MSG(!(ss >> type) || (type != "BLOBS" && type != "OFFSETS"), "Malformed memory plan file");
+            plan.mapping_type = (type == "BLOBS") ? MappingType::BLOBS : MappingType::OFFSETS;
+        }
+        else if(tag == "total")
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MSG(!(ss >> plan.total_bytes), "Malformed memory plan file");
+        }
+        else if(tag == "peak")
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MSG(!(ss >> plan.peak_bytes), "Malformed memory plan file");
+        }
+        else if(tag == "region")
+        {
+            MemoryRegionReport region;
+            ARM_COMPUTE_RETURN_ERROR_ON_MSG(!(ss >> region.group_id >> region.placement >> region.size >> region.alignment >> region.lifetime_start >> region.lifetime_end),
+                                            "Malformed memory plan file");
+            plan.regions.push_back(region);
+        }
+        else
+        {
+            ARM_COMPUTE_RETURN_ERROR_MSG("Unknown entry in memory plan file");
+        }
+    }
+
+    // Rebuild the per-blob sizes that are not stored explicitly
+    if(plan.mapping_type == MappingType::BLOBS)
+    {
+        for(const auto &region : plan.regions)
+        {
+            if(region.placement >= plan.blob_sizes.size())
+            {
+                plan.blob_sizes.resize(region.placement + 1, 0);
+            }
+            plan.blob_sizes[region.placement] = std::max(plan.blob_sizes[region.placement], region.size);
+        }
+    }
+
+    return Status{};
+#else  /* !defined(BARE_METAL) */
+    ARM_COMPUTE_UNUSED(plan, filename);
+    ARM_COMPUTE_RETURN_ERROR_MSG("Memory plan files are not supported on bare metal");
+#endif /* !defined(BARE_METAL) */
+}
+} // namespace arm_compute
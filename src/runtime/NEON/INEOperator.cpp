@@ -22,12 +22,63 @@
  * SOFTWARE.
  */
 #include "arm_compute/runtime/NEON/INEOperator.h"
+#include "arm_compute/core/experimental/Types.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/Utils.h"
 
 namespace arm_compute
 {
 namespace experimental
 {
+namespace
+{
+/** Validates the aliasing of a tensor pack before dispatch
+ *
+ * A destination may alias a source only exactly and only when the operator supports
+ * in-place execution; partially overlapping tensors are never valid as the kernels give
+ * no ordering guarantees between reads and writes of different elements.
+ */
+void validate_pack_aliasing(const ITensorPack &tensors, bool in_place_supported)
+{
+    for(auto dst_it = tensors.begin(); dst_it != tensors.end(); ++dst_it)
+    {
+        const int      dst_id = static_cast<int>(dst_it->first);
+        const ITensor *dst    = dst_it->second.tensor;
+        if(dst_id < ACL_DST || dst_id >= ACL_INT || dst == nullptr || dst->buffer() == nullptr)
+        {
+            continue;
+        }
+        for(auto src_it = tensors.begin(); src_it != tensors.end(); ++src_it)
+        {
+            const int src_id = static_cast<int>(src_it->first);
+            if(!(src_id < ACL_DST || src_id >= ACL_SRC_VEC))
+            {
+                continue;
+            }
+            const ITensor *src = (src_it->second.ctensor != nullptr) ? src_it->second.ctensor : src_it->second.tensor;
+            if(src == nullptr || src->buffer() == nullptr)
+            {
+                continue;
+            }
+
+            const uint8_t *src_begin = src->buffer();
+            const uint8_t *src_end   = src_begin + src->info()->total_size();
+            const uint8_t *dst_begin = dst->buffer();
+            const uint8_t *dst_end   = dst_begin + dst->info()->total_size();
+            if(dst_end <= src_begin || src_end <= dst_begin)
+            {
+                continue;
+            }
+
+            const bool is_exact_alias = (src_begin == dst_begin) && (src_end == dst_end) && (src->info()->strides_in_bytes() == dst->info()->strides_in_bytes());
+            ARM_COMPUTE_ERROR_ON_MSG(!is_exact_alias, "Source and destination tensors partially overlap");
+            ARM_COMPUTE_ERROR_ON_MSG(!in_place_supported, "Operator does not support in-place execution");
+            ARM_COMPUTE_UNUSED(in_place_supported, is_exact_alias);
+        }
+    }
+}
+} // namespace
+
 INEOperator::INEOperator(IRuntimeContext *ctx)
     : _kernel(), _ctx(ctx), _workspace()
 {
@@ -40,7 +91,17 @@ void INEOperator::run(ITensorPack &tensors)
         ARM_COMPUTE_ERROR("No inputs provided");
     }
 
-    NEScheduler::get().schedule_op(_kernel.get(), Window::DimY, tensors);
+    validate_pack_aliasing(tensors, supports_in_place());
+
+    schedule_op_on_ctx(_ctx, _kernel.get(), Window::DimY, tensors);
+}
+
+std::future<void> INEOperator::run_async(ITensorPack &tensors)
+{
+    return std::async(std::launch::async, [this, &tensors]()
+    {
+        run(tensors);
+    });
 }
 
 void INEOperator::prepare(ITensorPack &constants)
@@ -24,17 +24,19 @@
 #include "arm_compute/runtime/NEON/INESimpleFunction.h"
 
 #include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/Utils.h"
 
 using namespace arm_compute;
 
-INESimpleFunction::INESimpleFunction() // NOLINT
+INESimpleFunction::INESimpleFunction(IRuntimeContext *ctx) // NOLINT
     : _kernel(),
-      _border_handler()
+      _border_handler(),
+      _ctx(ctx)
 {
 }
 
 void INESimpleFunction::run()
 {
-    NEScheduler::get().schedule(&_border_handler, Window::DimZ);
-    NEScheduler::get().schedule(_kernel.get(), Window::DimY);
+    schedule_kernel_on_ctx(_ctx, &_border_handler, Window::DimZ);
+    schedule_kernel_on_ctx(_ctx, _kernel.get(), Window::DimY);
 }
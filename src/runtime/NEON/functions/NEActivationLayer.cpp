@@ -36,15 +36,21 @@ namespace experimental
 {
 void NEActivationLayer::configure(const ITensorInfo *input, ITensorInfo *output, const ActivationLayerInfo &activation_info)
 {
-    auto k = arm_compute::support::cpp14::make_unique<NEActivationLayerKernel>();
-    k->configure(input, output, activation_info);
-    _kernel = std::move(k);
+    KernelCacheKey key("NEActivationLayerKernel");
+    key.add_tensor_info(input).add_tensor_info(output);
+    key.add_value(activation_info.enabled()).add_value(activation_info.activation()).add_value(activation_info.a()).add_value(activation_info.b());
+    create_kernel<NEActivationLayerKernel>(key, input, output, activation_info);
 }
 
 Status NEActivationLayer::validate(const ITensorInfo *input, const ITensorInfo *output, const ActivationLayerInfo &activation_info)
 {
     return NEActivationLayerKernel::validate(input, output, activation_info);
 }
+bool NEActivationLayer::supports_in_place() const
+{
+    // The activation kernel already runs in-place when configured without an output
+    return true;
+}
 } // namespace experimental
 
 struct NEActivationLayer::Impl
@@ -36,15 +36,20 @@ namespace experimental
 void NEArithmeticAddition::configure(const ITensorInfo *input1, const ITensorInfo *input2, ITensorInfo *output, ConvertPolicy policy, const ActivationLayerInfo &act_info)
 {
     ARM_COMPUTE_UNUSED(act_info);
-    auto k = arm_compute::support::cpp14::make_unique<NEArithmeticAdditionKernel>();
-    k->configure(input1, input2, output, policy);
-    _kernel = std::move(k);
+    KernelCacheKey key("NEArithmeticAdditionKernel");
+    key.add_tensor_info(input1).add_tensor_info(input2).add_tensor_info(output).add_value(policy);
+    create_kernel<NEArithmeticAdditionKernel>(key, input1, input2, output, policy);
 }
 Status NEArithmeticAddition::validate(const ITensorInfo *input1, const ITensorInfo *input2, const ITensorInfo *output, ConvertPolicy policy, const ActivationLayerInfo &act_info)
 {
     ARM_COMPUTE_RETURN_ERROR_ON(act_info.enabled());
     return NEArithmeticAdditionKernel::validate(input1, input2, output, policy);
 }
+bool NEArithmeticAddition::supports_in_place() const
+{
+    // The addition kernel reads all inputs of an element before writing it
+    return true;
+}
 } // namespace experimental
 
 struct NEArithmeticAddition::Impl
@@ -36,9 +36,9 @@ namespace experimental
 void NEArithmeticSubtraction::configure(const ITensorInfo *input1, const ITensorInfo *input2, ITensorInfo *output, ConvertPolicy policy, const ActivationLayerInfo &act_info)
 {
     ARM_COMPUTE_UNUSED(act_info);
-    auto k = arm_compute::support::cpp14::make_unique<NEArithmeticSubtractionKernel>();
-    k->configure(input1, input2, output, policy);
-    _kernel = std::move(k);
+    KernelCacheKey key("NEArithmeticSubtractionKernel");
+    key.add_tensor_info(input1).add_tensor_info(input2).add_tensor_info(output).add_value(policy);
+    create_kernel<NEArithmeticSubtractionKernel>(key, input1, input2, output, policy);
 }
 
 Status NEArithmeticSubtraction::validate(const ITensorInfo *input1, const ITensorInfo *input2, const ITensorInfo *output, ConvertPolicy policy, const ActivationLayerInfo &act_info)
@@ -46,6 +46,11 @@ Status NEArithmeticSubtraction::validate(const ITensorInfo *input1, const ITenso
     ARM_COMPUTE_RETURN_ERROR_ON(act_info.enabled());
     return NEArithmeticSubtractionKernel::validate(input1, input2, output, policy);
 }
+bool NEArithmeticSubtraction::supports_in_place() const
+{
+    // The subtraction kernel reads all inputs of an element before writing it
+    return true;
+}
 } // namespace experimental
 
 struct NEArithmeticSubtraction::Impl
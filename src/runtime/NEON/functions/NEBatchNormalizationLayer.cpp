@@ -33,7 +33,7 @@
 using namespace arm_compute;
 
 NEBatchNormalizationLayer::NEBatchNormalizationLayer()
-    : _norm_kernel()
+    : _norm_kernel(), _is_prepared(false)
 {
 }
 
@@ -53,5 +53,17 @@ Status NEBatchNormalizationLayer::validate(const ITensorInfo *input, const ITens
 
 void NEBatchNormalizationLayer::run()
 {
+    prepare();
     NEScheduler::get().schedule(&_norm_kernel, Window::DimY);
 }
+
+void NEBatchNormalizationLayer::prepare()
+{
+    if(!_is_prepared)
+    {
+        // Fold the per-channel parameters into packed scale/shift coefficients, so every
+        // run performs a single multiply-add per element instead of re-deriving them
+        _norm_kernel.fold_coefficients();
+        _is_prepared = true;
+    }
+}
@@ -39,10 +39,37 @@
 
 namespace arm_compute
 {
+namespace
+{
+/** Checks if @p src is already a view of the region of @p dst it would be copied to,
+ * i.e. its producer wrote through a sub-tensor of the concatenation output.
+ *
+ * @return True if copying @p src can be skipped
+ */
+bool input_is_write_through(const ITensor *src, const ITensor *dst, size_t axis, size_t axis_offset)
+{
+    if(src == nullptr || dst == nullptr || src->buffer() == nullptr || src->buffer() != dst->buffer())
+    {
+        return false;
+    }
+
+    // A sub-tensor view keeps the strides of its parent
+    const ITensorInfo *src_info = src->info();
+    const ITensorInfo *dst_info = dst->info();
+    if(src_info->strides_in_bytes() != dst_info->strides_in_bytes())
+    {
+        return false;
+    }
+
+    const size_t expected_offset = dst_info->offset_first_element_in_bytes() + axis_offset * dst_info->strides_in_bytes()[axis];
+    return src_info->offset_first_element_in_bytes() == expected_offset;
+}
+} // namespace
+
 namespace experimental
 {
 NEConcatenation::NEConcatenation()
-    : _concat_kernels(), _num_inputs(0), _axis(0)
+    : _concat_kernels(), _dst_offsets(), _num_inputs(0), _axis(0)
 {
 }
 
@@ -96,6 +123,7 @@ void NEConcatenation::configure(const std::vector<const ITensorInfo *> &inputs_v
             default:
                 ARM_COMPUTE_ERROR("Axis not supported");
         }
+        _dst_offsets.emplace_back(offset);
         offset += inputs_vector.at(i)->dimension(axis);
     }
 }
@@ -161,10 +189,17 @@ void NEConcatenation::run(ITensorPack &tensors)
     int i = 0;
     for(auto &k : _concat_kernels)
     {
-        ITensorPack pack;
-        pack.add_tensor(TensorType::ACL_SRC, tensors.get_const_tensor(ACL_SRC_VEC + i));
-        pack.add_tensor(TensorType::ACL_DST, tensors.get_tensor(ACL_DST));
-        NEScheduler::get().schedule_op(k.get(), Window::DimY, pack);
+        const ITensor *src = tensors.get_const_tensor(ACL_SRC_VEC + i);
+        ITensor       *dst = tensors.get_tensor(ACL_DST);
+
+        // Skip inputs whose producers already wrote through a sub-tensor of the output
+        if(!input_is_write_through(src, dst, _axis, _dst_offsets[i]))
+        {
+            ITensorPack pack;
+            pack.add_tensor(TensorType::ACL_SRC, src);
+            pack.add_tensor(TensorType::ACL_DST, dst);
+            NEScheduler::get().schedule_op(k.get(), Window::DimY, pack);
+        }
         ++i;
     }
 }
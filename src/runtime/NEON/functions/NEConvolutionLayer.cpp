@@ -24,6 +24,7 @@
 #include "arm_compute/runtime/NEON/functions/NEConvolutionLayer.h"
 
 #include "arm_compute/core/PixelValue.h"
+#include "arm_compute/core/TracePoint.h"
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
@@ -35,34 +36,40 @@
 
 namespace arm_compute
 {
-NEConvolutionLayer::NEConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager) //NOLINT
+NEConvolutionLayer::NEConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager, IWeightsManager *weights_manager) //NOLINT
     : _memory_manager(std::move(memory_manager)),
+      _weights_manager(weights_manager),
       _function()
 {
 }
 
 void NEConvolutionLayer::configure(ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, const WeightsInfo &weights_info,
-                                   const Size2D &dilation, const ActivationLayerInfo &act_info, bool enable_fast_math, unsigned int num_groups)
+                                   const Size2D &dilation, const ActivationLayerInfo &act_info, bool enable_fast_math, unsigned int num_groups, const ITensor *residual)
 {
+    CREATE_TRACEPOINT("NEConvolutionLayer::configure");
+
     // Perform validate step
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
     ARM_COMPUTE_UNUSED(num_groups);
     ARM_COMPUTE_ERROR_THROW_ON(NEConvolutionLayer::validate(input->info(), weights->info(), ((biases != nullptr) ? biases->info() : nullptr), output->info(), conv_info, weights_info, dilation, act_info,
-                                                            enable_fast_math, num_groups));
+                                                            enable_fast_math, num_groups, residual != nullptr ? residual->info() : nullptr));
 
-    switch(NEConvolutionLayer::get_convolution_method(input->info(), weights->info(), output->info(), conv_info, weights_info, dilation, act_info, enable_fast_math))
+    // Only the GEMM-based convolution implements the fused residual-add epilogue
+    const ConvolutionMethod conv_method = (residual != nullptr) ? ConvolutionMethod::GEMM
+                                          : NEConvolutionLayer::get_convolution_method(input->info(), weights->info(), output->info(), conv_info, weights_info, dilation, act_info, enable_fast_math);
+    switch(conv_method)
     {
         case ConvolutionMethod::WINOGRAD:
         {
-            auto f = arm_compute::support::cpp14::make_unique<NEWinogradConvolutionLayer>(_memory_manager);
+            auto f = arm_compute::support::cpp14::make_unique<NEWinogradConvolutionLayer>(_memory_manager, _weights_manager);
             f->configure(input, weights, biases, output, conv_info, act_info, enable_fast_math);
             _function = std::move(f);
             break;
         }
         case ConvolutionMethod::GEMM:
         {
-            auto f = arm_compute::support::cpp14::make_unique<NEGEMMConvolutionLayer>(_memory_manager);
-            f->configure(input, weights, biases, output, conv_info, weights_info, dilation, act_info);
+            auto f = arm_compute::support::cpp14::make_unique<NEGEMMConvolutionLayer>(_memory_manager, _weights_manager);
+            f->configure(input, weights, biases, output, conv_info, weights_info, dilation, act_info, num_groups, enable_fast_math, residual);
             _function = std::move(f);
             break;
         }
@@ -87,11 +94,15 @@ void NEConvolutionLayer::configure(ITensor *input, const ITensor *weights, const
 }
 
 Status NEConvolutionLayer::validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info,
-                                    const WeightsInfo &weights_info, const Size2D &dilation, const ActivationLayerInfo &act_info, bool enable_fast_math, unsigned int num_groups)
+                                    const WeightsInfo &weights_info, const Size2D &dilation, const ActivationLayerInfo &act_info, bool enable_fast_math, unsigned int num_groups,
+                                    const ITensorInfo *residual)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_MSG((num_groups != 1), "Grouping (num_groups != 1) is not supported on NEON");
 
-    switch(NEConvolutionLayer::get_convolution_method(input, weights, output, conv_info, weights_info, dilation, act_info, enable_fast_math))
+    // Only the GEMM-based convolution implements the fused residual-add epilogue
+    const ConvolutionMethod conv_method = (residual != nullptr) ? ConvolutionMethod::GEMM
+                                          : NEConvolutionLayer::get_convolution_method(input, weights, output, conv_info, weights_info, dilation, act_info, enable_fast_math);
+    switch(conv_method)
     {
         case ConvolutionMethod::WINOGRAD:
             //Validate Winograd
@@ -99,7 +110,7 @@ Status NEConvolutionLayer::validate(const ITensorInfo *input, const ITensorInfo
             break;
         case ConvolutionMethod::GEMM:
             //Validate Gemm-based Convolution
-            ARM_COMPUTE_RETURN_ON_ERROR(NEGEMMConvolutionLayer::validate(input, weights, biases, output, conv_info, weights_info, dilation, act_info));
+            ARM_COMPUTE_RETURN_ON_ERROR(NEGEMMConvolutionLayer::validate(input, weights, biases, output, conv_info, weights_info, dilation, act_info, num_groups, enable_fast_math, residual));
             break;
         case ConvolutionMethod::DIRECT:
             //Validate Direct Convolution
@@ -173,6 +184,15 @@ ConvolutionMethod NEConvolutionLayer::get_convolution_method(const ITensorInfo *
         {
             return ConvolutionMethod::DIRECT;
         }
+        // Strided NHWC convolutions with small square kernels map to the specialized direct kernels,
+        // avoiding the im2col/GEMM round-trip that a stride-2 layer would otherwise pay
+        if(input->data_layout() == DataLayout::NHWC && input->data_type() == DataType::F32
+           && (weights->dimension(idx_w) == 3 || weights->dimension(idx_w) == 5) && (weights->dimension(idx_w) == weights->dimension(idx_h))
+           && conv_info.stride() == std::make_pair(2U, 2U)
+           && (NEDirectConvolutionLayer::validate(input, weights, nullptr, output, conv_info, act_info)))
+        {
+            return ConvolutionMethod::DIRECT;
+        }
         if((weights->dimension(idx_h) > 7) && (input->dimension(idx_c) > output->dimension(idx_c)) && (NEFFTConvolutionLayer::validate(input, weights, nullptr, output, conv_info, act_info)))
         {
             return ConvolutionMethod::FFT;
@@ -220,6 +240,7 @@ ConvolutionMethod NEConvolutionLayer::get_convolution_method(const ITensorInfo *
 
 void NEConvolutionLayer::run()
 {
+    CREATE_TRACEPOINT("NEConvolutionLayer::run");
     prepare();
     _function->run();
 }
@@ -25,12 +25,141 @@
 
 #include "arm_compute/runtime/NEON/functions/NECropResize.h"
 
+#include "arm_compute/core/NEON/wrapper/wrapper.h"
+#include "support/Mutex.h"
+
+#include <algorithm>
+#include <cmath>
 #include <cstddef>
+#if !defined(BARE_METAL)
+#include <atomic>
+#include <thread>
+#include <vector>
+#endif /* !defined(BARE_METAL) */
 
 namespace arm_compute
 {
+namespace
+{
+/** Crops one box from the input and resizes it into the output slice in a single pass.
+ *
+ * The bilinear samples are taken directly from the source image, so no intermediate crop
+ * tensor is materialized. Samples that fall outside the crop region or the source image
+ * evaluate to the extrapolation value, matching the two-stage crop + scale pipeline.
+ */
+void fused_crop_resize_box(const ITensor *input, ITensor *output, const ITensor *boxes, const ITensor *box_ind, size_t box, float extrapolation_value)
+{
+    // The crop box is specified by normalized coordinates [y0, x0, y1, x1]
+    const float    y0          = *reinterpret_cast<const float *>(boxes->ptr_to_element(Coordinates(0, box)));
+    const float    x0          = *reinterpret_cast<const float *>(boxes->ptr_to_element(Coordinates(1, box)));
+    const float    y1          = *reinterpret_cast<const float *>(boxes->ptr_to_element(Coordinates(2, box)));
+    const float    x1          = *reinterpret_cast<const float *>(boxes->ptr_to_element(Coordinates(3, box)));
+    const uint32_t batch_index = *(reinterpret_cast<const int32_t *>(box_ind->ptr_to_element(Coordinates(box))));
+
+    const int32_t in_w         = static_cast<int32_t>(input->info()->dimension(1));
+    const int32_t in_h         = static_cast<int32_t>(input->info()->dimension(2));
+    const int32_t num_channels = static_cast<int32_t>(input->info()->dimension(0));
+
+    // Integer crop window, matching NECropKernel::configure_output_shape()
+    const int32_t start_x = std::floor(x0 * (in_w - 1) + 0.5f);
+    const int32_t start_y = std::floor(y0 * (in_h - 1) + 0.5f);
+    const int32_t end_x   = std::floor(x1 * (in_w - 1) + 0.5f);
+    const int32_t end_y   = std::floor(y1 * (in_h - 1) + 0.5f);
+
+    const int32_t crop_w = std::abs(end_x - start_x) + 1;
+    const int32_t crop_h = std::abs(end_y - start_y) + 1;
+    const int32_t dir_x  = (end_x >= start_x) ? 1 : -1;
+    const int32_t dir_y  = (end_y >= start_y) ? 1 : -1;
+
+    const int32_t out_w = static_cast<int32_t>(output->info()->dimension(1));
+    const int32_t out_h = static_cast<int32_t>(output->info()->dimension(2));
+
+    // Same scale ratios the scale stage uses with TOP_LEFT sampling
+    const float scale_x = static_cast<float>(crop_w) / static_cast<float>(out_w);
+    const float scale_y = static_cast<float>(crop_h) / static_cast<float>(out_h);
+
+    const Strides &in_strides = input->info()->strides_in_bytes();
+    const uint8_t *in_base    = input->buffer() + input->info()->offset_element_in_bytes(Coordinates(0, 0, 0, batch_index));
+
+    // Returns the pixel base address for crop coordinates (cx, cy), or nullptr when the
+    // sample falls outside the crop region or the source image
+    auto sample_ptr = [&](int32_t cx, int32_t cy) -> const float *
+    {
+        if(cx < 0 || cx >= crop_w || cy < 0 || cy >= crop_h)
+        {
+            return nullptr;
+        }
+        const int32_t ix = start_x + dir_x * cx;
+        const int32_t iy = start_y + dir_y * cy;
+        if(ix < 0 || ix >= in_w || iy < 0 || iy >= in_h)
+        {
+            return nullptr;
+        }
+        return reinterpret_cast<const float *>(in_base + ix * in_strides[1] + iy * in_strides[2]);
+    };
+
+    const int32_t window_step = 16 / sizeof(float);
+    const auto    extrap_vec  = wrapper::vdup_n(extrapolation_value, wrapper::traits::vector_128_tag());
+
+    for(int32_t oy = 0; oy < out_h; ++oy)
+    {
+        const float   fy = oy * scale_y;
+        const int32_t cy = static_cast<int32_t>(std::floor(fy));
+        const float   dy = fy - cy;
+
+        for(int32_t ox = 0; ox < out_w; ++ox)
+        {
+            const float   fx = ox * scale_x;
+            const int32_t cx = static_cast<int32_t>(std::floor(fx));
+            const float   dx = fx - cx;
+
+            const float *s00 = sample_ptr(cx, cy);
+            const float *s01 = sample_ptr(cx + 1, cy);
+            const float *s10 = sample_ptr(cx, cy + 1);
+            const float *s11 = sample_ptr(cx + 1, cy + 1);
+
+            const float w00 = (1.f - dx) * (1.f - dy);
+            const float w01 = dx * (1.f - dy);
+            const float w10 = (1.f - dx) * dy;
+            const float w11 = dx * dy;
+
+            float *out_ptr = reinterpret_cast<float *>(output->ptr_to_element(Coordinates(0, ox, oy, box)));
+
+            const auto w00_vec = wrapper::vdup_n(w00, wrapper::traits::vector_128_tag());
+            const auto w01_vec = wrapper::vdup_n(w01, wrapper::traits::vector_128_tag());
+            const auto w10_vec = wrapper::vdup_n(w10, wrapper::traits::vector_128_tag());
+            const auto w11_vec = wrapper::vdup_n(w11, wrapper::traits::vector_128_tag());
+
+            int32_t c = 0;
+            for(; c <= num_channels - window_step; c += window_step)
+            {
+                const auto v00 = (s00 != nullptr) ? wrapper::vloadq(s00 + c) : extrap_vec;
+                const auto v01 = (s01 != nullptr) ? wrapper::vloadq(s01 + c) : extrap_vec;
+                const auto v10 = (s10 != nullptr) ? wrapper::vloadq(s10 + c) : extrap_vec;
+                const auto v11 = (s11 != nullptr) ? wrapper::vloadq(s11 + c) : extrap_vec;
+
+                auto res = wrapper::vmul(v00, w00_vec);
+                res      = wrapper::vmla(res, v01, w01_vec);
+                res      = wrapper::vmla(res, v10, w10_vec);
+                res      = wrapper::vmla(res, v11, w11_vec);
+                wrapper::vstore(out_ptr + c, res);
+            }
+            for(; c < num_channels; ++c)
+            {
+                const float v00 = (s00 != nullptr) ? *(s00 + c) : extrapolation_value;
+                const float v01 = (s01 != nullptr) ? *(s01 + c) : extrapolation_value;
+                const float v10 = (s10 != nullptr) ? *(s10 + c) : extrapolation_value;
+                const float v11 = (s11 != nullptr) ? *(s11 + c) : extrapolation_value;
+
+                *(out_ptr + c) = v00 * w00 + v01 * w01 + v10 * w10 + v11 * w11;
+            }
+        }
+    }
+}
+} // namespace
+
 NECropResize::NECropResize()
-    : _output(nullptr), _num_boxes(0), _method(), _extrapolation_value(0), _crop(), _scale(), _crop_results(), _scaled_results()
+    : _input(nullptr), _boxes(nullptr), _box_ind(nullptr), _output(nullptr), _num_boxes(0), _method(), _extrapolation_value(0), _fused_path(false), _crop(), _scale(), _crop_results(), _scaled_results()
 {
 }
 
@@ -60,10 +189,21 @@ void NECropResize::configure(const ITensor *input, const ITensor *boxes, const I
     _num_boxes = boxes->info()->tensor_shape()[1];
     TensorShape out_shape(input->info()->tensor_shape()[0], crop_size.x, crop_size.y);
 
+    _input               = input;
+    _boxes               = boxes;
+    _box_ind             = box_ind;
     _output              = output;
     _method              = method;
     _extrapolation_value = extrapolation_value;
 
+    // F32 bilinear boxes are cropped and resized in a single fused pass directly into the
+    // output, so no per-box kernels or intermediate tensors are needed
+    _fused_path = (input->info()->data_type() == DataType::F32) && (method == InterpolationPolicy::BILINEAR);
+    if(_fused_path)
+    {
+        return;
+    }
+
     // For each crop box:
     // - A crop kernel is used to extract the initial cropped image as specified by boxes[i] from the 3D image input[box_ind[i]].
     // - A tensor is required to hold this initial cropped image.
@@ -102,6 +242,69 @@ void NECropResize::run()
 {
     ARM_COMPUTE_ERROR_ON_MSG(_output == nullptr, "Unconfigured function");
 
+    if(_fused_path)
+    {
+        // Process all boxes as one batched workload instead of one crop + scale dispatch per box
+#if !defined(BARE_METAL)
+        const unsigned int num_workers = std::min<unsigned int>(_num_boxes, std::max(2u, std::thread::hardware_concurrency() / 2));
+        if(num_workers > 1)
+        {
+            std::atomic<unsigned int> next_box(0);
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+            std::exception_ptr exception{ nullptr };
+            arm_compute::Mutex exception_mutex{};
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+
+            auto process_boxes = [&]()
+            {
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+                try
+                {
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+                    for(unsigned int box = next_box++; box < _num_boxes; box = next_box++)
+                    {
+                        fused_crop_resize_box(_input, _output, _boxes, _box_ind, box, _extrapolation_value);
+                    }
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+                }
+                catch(...)
+                {
+                    arm_compute::lock_guard<arm_compute::Mutex> lock(exception_mutex);
+                    if(exception == nullptr)
+                    {
+                        exception = std::current_exception();
+                    }
+                }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+            };
+
+            std::vector<std::thread> workers;
+            workers.reserve(num_workers - 1);
+            for(unsigned int i = 1; i < num_workers; ++i)
+            {
+                workers.emplace_back(process_boxes);
+            }
+            process_boxes();
+            for(auto &worker : workers)
+            {
+                worker.join();
+            }
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+            if(exception != nullptr)
+            {
+                std::rethrow_exception(exception);
+            }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+            return;
+        }
+#endif /* !defined(BARE_METAL) */
+        for(unsigned int box = 0; box < _num_boxes; ++box)
+        {
+            fused_crop_resize_box(_input, _output, _boxes, _box_ind, box, _extrapolation_value);
+        }
+        return;
+    }
+
     for(unsigned int i = 0; i < _num_boxes; ++i)
     {
         // Size of the crop box in _boxes and thus the shape of _crop_results[i]
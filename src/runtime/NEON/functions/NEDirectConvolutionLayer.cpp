@@ -26,6 +26,7 @@
 #include "arm_compute/core/PixelValue.h"
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/core/Validate.h"
+#include "arm_compute/core/utils/quantization/QuantizationParamsCache.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 
 #include <cmath>
@@ -33,9 +34,37 @@
 
 namespace arm_compute
 {
+namespace
+{
+bool can_fuse_activation(const ActivationLayerInfo &act_info, DataType data_type, bool has_bias)
+{
+    // The output stage kernel only runs when a bias is present and supports the ReLU family for float types
+    return has_bias && act_info.enabled() && is_data_type_float(data_type)
+           && ((act_info.activation() == ActivationLayerInfo::ActivationFunction::RELU)
+               || (act_info.activation() == ActivationLayerInfo::ActivationFunction::BOUNDED_RELU)
+               || (act_info.activation() == ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU));
+}
+
+/** Computes the requantization metadata applied after the S32 accumulation of the quantized path */
+DirectConvolutionLayerOutputStageKernelInfo compute_output_stage_info(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *output)
+{
+    const UniformQuantizationInfo iq_info = input->quantization_info().uniform();
+    const UniformQuantizationInfo wq_info = weights->quantization_info().uniform();
+    const UniformQuantizationInfo oq_info = output->quantization_info().uniform();
+
+    const float real_multiplier = iq_info.scale * wq_info.scale / oq_info.scale;
+
+    DirectConvolutionLayerOutputStageKernelInfo info;
+    quantization::QuantizationParamsCache::get().quantized_multiplier(real_multiplier, &info.result_fixedpoint_multiplier, &info.result_shift);
+    info.result_offset_after_shift = oq_info.offset;
+    info.output_data_type          = output->data_type();
+    return info;
+}
+} // namespace
+
 NEDirectConvolutionLayer::NEDirectConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager)
-    : _memory_group(std::move(memory_manager)), _output_stage_kernel(), _conv_kernel(), _input_border_handler(), _activationlayer_function(), _accumulator(), _has_bias(false),
-      _is_activationlayer_enabled(false), _dim_split(Window::DimZ)
+    : _memory_group(std::move(memory_manager)), _output_stage_kernel(), _conv_kernel(), _conv_kernel_quantized(), _input_border_handler(), _activationlayer_function(), _accumulator(), _has_bias(false),
+      _is_activationlayer_enabled(false), _is_quantized(false), _dim_split(Window::DimZ)
 {
 }
 
@@ -54,17 +83,38 @@ void NEDirectConvolutionLayer::configure(ITensor *input, const ITensor *weights,
     // Check if bias should be added in the convolution result
     _has_bias = (bias != nullptr);
 
+    _is_quantized = is_data_type_quantized_asymmetric(input->info()->data_type());
+    if(_is_quantized)
+    {
+        // Convolve into S32 accumulators without im2col and requantize them with the output stage kernel
+        _memory_group.manage(&_accumulator);
+        _conv_kernel_quantized.configure(input, weights, &_accumulator, conv_info);
+        _output_stage_kernel.configure(&_accumulator, bias, output, compute_output_stage_info(input->info(), weights->info(), output->info()));
+        _accumulator.allocator()->allocate();
+
+        _is_activationlayer_enabled = act_info.enabled();
+        if(_is_activationlayer_enabled)
+        {
+            _activationlayer_function.configure(output, nullptr, act_info);
+        }
+        return;
+    }
+
+    // Fuse the activation into the output stage when possible, so the activations are not re-read by a separate pass
+    const bool fuse_activation = can_fuse_activation(act_info, input->info()->data_type(), _has_bias);
+
     _conv_kernel.configure(input, weights, output, conv_info);
     if(_has_bias)
     {
-        _output_stage_kernel.configure(output, bias);
+        _output_stage_kernel.configure(output, bias, nullptr, DirectConvolutionLayerOutputStageKernelInfo(), nullptr, nullptr,
+                                       fuse_activation ? act_info : ActivationLayerInfo());
     }
 
     // Add zero padding XY
     _input_border_handler.configure(input, _conv_kernel.border_size(), BorderMode::CONSTANT, PixelValue(static_cast<float>(0.f)));
 
     //Configure Activation Layer
-    _is_activationlayer_enabled = act_info.enabled();
+    _is_activationlayer_enabled = act_info.enabled() && !fuse_activation;
     if(_is_activationlayer_enabled)
     {
         _activationlayer_function.configure(output, nullptr, act_info);
@@ -80,6 +130,25 @@ Status NEDirectConvolutionLayer::validate(const ITensorInfo *input, const ITenso
     DataType   data_type = input->data_type();
     TensorInfo accumulator(output->clone()->set_is_resizable(true).reset_padding().set_data_type(data_type));
 
+    if(is_data_type_quantized_asymmetric(data_type))
+    {
+        accumulator.set_data_type(DataType::S32);
+        ARM_COMPUTE_RETURN_ON_ERROR(NEDirectConvolutionLayer3x3QuantizedKernel::validate(input, weights, &accumulator, conv_info));
+        if(bias != nullptr)
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(bias, 1, DataType::S32);
+            ARM_COMPUTE_RETURN_ERROR_ON_MSG(bias->dimension(0) != weights->dimension(3),
+                                            "Biases size and number of input feature maps should match");
+            ARM_COMPUTE_RETURN_ERROR_ON_MSG(bias->num_dimensions() > 1, "Biases should be one dimensional");
+        }
+        ARM_COMPUTE_RETURN_ON_ERROR(NEDirectConvolutionLayerOutputStageKernel::validate(&accumulator, bias, output, compute_output_stage_info(input, weights, output)));
+        if(act_info.enabled())
+        {
+            ARM_COMPUTE_RETURN_ON_ERROR(NEActivationLayer::validate(output, nullptr, act_info));
+        }
+        return Status{};
+    }
+
     // Validate Convolution kernel
     ARM_COMPUTE_RETURN_ON_ERROR(NEDirectConvolutionLayerKernel::validate(input, weights, &accumulator, conv_info));
 
@@ -91,10 +160,13 @@ Status NEDirectConvolutionLayer::validate(const ITensorInfo *input, const ITenso
         ARM_COMPUTE_RETURN_ERROR_ON_MSG(bias->num_dimensions() > 1, "Biases should be one dimensional");
     }
 
+    const bool fuse_activation = can_fuse_activation(act_info, data_type, bias != nullptr);
+
     // Validate bias kernel
-    ARM_COMPUTE_RETURN_ON_ERROR(NEDirectConvolutionLayerOutputStageKernel::validate(&accumulator, bias, output));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEDirectConvolutionLayerOutputStageKernel::validate(&accumulator, bias, output, DirectConvolutionLayerOutputStageKernelInfo(), nullptr, nullptr,
+                                                                                    fuse_activation ? act_info : ActivationLayerInfo()));
 
-    if(act_info.enabled())
+    if(act_info.enabled() && !fuse_activation)
     {
         ARM_COMPUTE_RETURN_ON_ERROR(NEActivationLayer::validate(output, nullptr, act_info));
     }
@@ -104,15 +176,23 @@ Status NEDirectConvolutionLayer::validate(const ITensorInfo *input, const ITenso
 
 void NEDirectConvolutionLayer::run()
 {
-    NEScheduler::get().schedule(&_input_border_handler, Window::DimZ);
-
     MemoryGroupResourceScope scope_mg(_memory_group);
 
-    NEScheduler::get().schedule(&_conv_kernel, _dim_split);
-    if(_has_bias)
+    if(_is_quantized)
     {
+        // Out-of-bound taps behave as zero-point padding inside the kernel, so no border handling is needed
+        NEScheduler::get().schedule(&_conv_kernel_quantized, _dim_split);
         NEScheduler::get().schedule(&_output_stage_kernel, Window::DimY);
     }
+    else
+    {
+        NEScheduler::get().schedule(&_input_border_handler, Window::DimZ);
+        NEScheduler::get().schedule(&_conv_kernel, _dim_split);
+        if(_has_bias)
+        {
+            NEScheduler::get().schedule(&_output_stage_kernel, Window::DimY);
+        }
+    }
 
     if(_is_activationlayer_enabled)
     {
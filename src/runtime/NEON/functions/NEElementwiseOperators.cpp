@@ -36,9 +36,9 @@ namespace experimental
 {
 void NEElementwiseMax::configure(const ITensorInfo *input1, const ITensorInfo *input2, ITensorInfo *output)
 {
-    auto k = arm_compute::support::cpp14::make_unique<NEArithmeticOperationKernel>();
-    k->configure(ArithmeticOperation::MAX, input1, input2, output);
-    _kernel = std::move(k);
+    KernelCacheKey key("NEArithmeticOperationKernel");
+    key.add_value(ArithmeticOperation::MAX).add_tensor_info(input1).add_tensor_info(input2).add_tensor_info(output);
+    create_kernel<NEArithmeticOperationKernel>(key, ArithmeticOperation::MAX, input1, input2, output);
 }
 
 Status NEElementwiseMax::validate(const ITensorInfo *input1, const ITensorInfo *input2, const ITensorInfo *output)
@@ -48,9 +48,9 @@ Status NEElementwiseMax::validate(const ITensorInfo *input1, const ITensorInfo *
 
 void NEElementwiseMin::configure(const ITensorInfo *input1, const ITensorInfo *input2, ITensorInfo *output)
 {
-    auto k = arm_compute::support::cpp14::make_unique<NEArithmeticOperationKernel>();
-    k->configure(ArithmeticOperation::MIN, input1, input2, output);
-    _kernel = std::move(k);
+    KernelCacheKey key("NEArithmeticOperationKernel");
+    key.add_value(ArithmeticOperation::MIN).add_tensor_info(input1).add_tensor_info(input2).add_tensor_info(output);
+    create_kernel<NEArithmeticOperationKernel>(key, ArithmeticOperation::MIN, input1, input2, output);
 }
 
 Status NEElementwiseMin::validate(const ITensorInfo *input1, const ITensorInfo *input2, const ITensorInfo *output)
@@ -60,9 +60,9 @@ Status NEElementwiseMin::validate(const ITensorInfo *input1, const ITensorInfo *
 
 void NEElementwiseSquaredDiff::configure(const ITensorInfo *input1, const ITensorInfo *input2, ITensorInfo *output)
 {
-    auto k = arm_compute::support::cpp14::make_unique<NEArithmeticOperationKernel>();
-    k->configure(ArithmeticOperation::SQUARED_DIFF, input1, input2, output);
-    _kernel = std::move(k);
+    KernelCacheKey key("NEArithmeticOperationKernel");
+    key.add_value(ArithmeticOperation::SQUARED_DIFF).add_tensor_info(input1).add_tensor_info(input2).add_tensor_info(output);
+    create_kernel<NEArithmeticOperationKernel>(key, ArithmeticOperation::SQUARED_DIFF, input1, input2, output);
 }
 
 Status NEElementwiseSquaredDiff::validate(const ITensorInfo *input1, const ITensorInfo *input2, const ITensorInfo *output)
@@ -72,9 +72,9 @@ Status NEElementwiseSquaredDiff::validate(const ITensorInfo *input1, const ITens
 
 void NEElementwiseDivision::configure(const ITensorInfo *input1, const ITensorInfo *input2, ITensorInfo *output)
 {
-    auto k = arm_compute::support::cpp14::make_unique<NEDivisionOperationKernel>();
-    k->configure(input1, input2, output);
-    _kernel = std::move(k);
+    KernelCacheKey key("NEDivisionOperationKernel");
+    key.add_tensor_info(input1).add_tensor_info(input2).add_tensor_info(output);
+    create_kernel<NEDivisionOperationKernel>(key, input1, input2, output);
 }
 
 Status NEElementwiseDivision::validate(const ITensorInfo *input1, const ITensorInfo *input2, const ITensorInfo *output)
@@ -84,9 +84,9 @@ Status NEElementwiseDivision::validate(const ITensorInfo *input1, const ITensorI
 
 void NEElementwisePower::configure(const ITensorInfo *input1, const ITensorInfo *input2, ITensorInfo *output)
 {
-    auto k = arm_compute::support::cpp14::make_unique<NEPowerOperationKernel>();
-    k->configure(input1, input2, output);
-    _kernel = std::move(k);
+    KernelCacheKey key("NEPowerOperationKernel");
+    key.add_tensor_info(input1).add_tensor_info(input2).add_tensor_info(output);
+    create_kernel<NEPowerOperationKernel>(key, input1, input2, output);
 }
 
 Status NEElementwisePower::validate(const ITensorInfo *input1, const ITensorInfo *input2, const ITensorInfo *output)
@@ -97,9 +97,9 @@ Status NEElementwisePower::validate(const ITensorInfo *input1, const ITensorInfo
 template <ComparisonOperation COP>
 void NEElementwiseComparisonStatic<COP>::configure(const ITensorInfo *input1, const ITensorInfo *input2, ITensorInfo *output)
 {
-    auto k = arm_compute::support::cpp14::make_unique<NEComparisonOperationKernel>();
-    k->configure(COP, input1, input2, output);
-    _kernel = std::move(k);
+    KernelCacheKey key("NEComparisonOperationKernel");
+    key.add_value(COP).add_tensor_info(input1).add_tensor_info(input2).add_tensor_info(output);
+    create_kernel<NEComparisonOperationKernel>(key, COP, input1, input2, output);
 }
 
 template <ComparisonOperation COP>
@@ -110,9 +110,9 @@ Status NEElementwiseComparisonStatic<COP>::validate(const ITensorInfo *input1, c
 
 void NEElementwiseComparison::configure(const ITensorInfo *input1, const ITensorInfo *input2, ITensorInfo *output, ComparisonOperation op)
 {
-    auto k = arm_compute::support::cpp14::make_unique<NEComparisonOperationKernel>();
-    k->configure(op, input1, input2, output);
-    _kernel = std::move(k);
+    KernelCacheKey key("NEComparisonOperationKernel");
+    key.add_value(op).add_tensor_info(input1).add_tensor_info(input2).add_tensor_info(output);
+    create_kernel<NEComparisonOperationKernel>(key, op, input1, input2, output);
 }
 
 Status NEElementwiseComparison::validate(const ITensorInfo *input1, const ITensorInfo *input2, const ITensorInfo *output, ComparisonOperation op)
@@ -364,6 +364,14 @@ void NEFFTConvolutionLayer::prepare()
         _flip_weights_func.run();
         cur_weights->mark_as_unused();
 
+        // The permuted copy of the weights and the flip axis are only consumed by the flip,
+        // release them so the layer does not keep a weights-sized workspace across runs
+        if(_needs_permute)
+        {
+            _permuted_weights.allocator()->free();
+        }
+        _flip_axis.allocator()->free();
+
         // Pad weights
         _padded_weights.allocator()->allocate();
         _pad_weights_func.run();
@@ -74,28 +74,19 @@ std::pair<PixelValue, PixelValue> get_quantized_asymmetric_output_min_max(const
 Status get_gemmlowp_output_stage_info(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *output, const ActivationLayerInfo &act,
                                       GEMMLowpOutputStageInfo &gemmlowp_output_stage_info)
 {
-    const auto                    data_type = input->data_type();
-    const QuantizationInfo        oq_info   = output->quantization_info();
-    const UniformQuantizationInfo iq_unif   = input->quantization_info().uniform();
-    const UniformQuantizationInfo wq_unif   = weights->quantization_info().uniform();
-    const UniformQuantizationInfo oq_unif   = oq_info.uniform();
-
-    float   multiplier = (iq_unif.scale * wq_unif.scale) / oq_unif.scale;
-    int32_t output_multiplier;
-    int32_t output_shift;
-
-    ARM_COMPUTE_RETURN_ON_ERROR(quantization::calculate_quantized_multiplier(multiplier, &output_multiplier, &output_shift));
+    const auto             data_type = input->data_type();
+    const QuantizationInfo oq_info   = output->quantization_info();
 
     PixelValue type_min{};
     PixelValue type_max{};
     std::tie(type_min, type_max) = get_quantized_asymmetric_output_min_max(oq_info, act, data_type);
 
-    gemmlowp_output_stage_info.gemmlowp_multiplier = output_multiplier;
-    gemmlowp_output_stage_info.gemmlowp_shift      = output_shift;
-    gemmlowp_output_stage_info.gemmlowp_offset     = oq_unif.offset;
-    gemmlowp_output_stage_info.type                = GEMMLowpOutputStageType::QUANTIZE_DOWN_FIXEDPOINT;
-    gemmlowp_output_stage_info.gemmlowp_min_bound  = type_min.get<int32_t>();
-    gemmlowp_output_stage_info.gemmlowp_max_bound  = type_max.get<int32_t>();
+    gemmlowp_output_stage_info.gemmlowp_offset          = oq_info.uniform().offset;
+    gemmlowp_output_stage_info.type                     = GEMMLowpOutputStageType::QUANTIZE_DOWN_FIXEDPOINT;
+    gemmlowp_output_stage_info.gemmlowp_min_bound       = type_min.get<int32_t>();
+    gemmlowp_output_stage_info.gemmlowp_max_bound       = type_max.get<int32_t>();
+    gemmlowp_output_stage_info.is_quantized_per_channel = (weights->data_type() == DataType::QSYMM8_PER_CHANNEL);
+    ARM_COMPUTE_RETURN_ON_ERROR(quantization::calculate_quantized_multipliers(input->quantization_info(), weights->quantization_info(), oq_info, gemmlowp_output_stage_info));
 
     return Status{};
 }
@@ -107,7 +98,6 @@ Status validate_mm(const ITensorInfo *input, const ITensorInfo *weights, const I
         // Since we need negative offsets for computing convolution, we need to change QuantizationInfo()
         // Extract and negate input and weights offset
         const QuantizationInfo input_quantization_info(input->quantization_info().uniform().scale, -input->quantization_info().uniform().offset);
-        const QuantizationInfo weights_quantization_info(weights->quantization_info().uniform().scale, -weights->quantization_info().uniform().offset);
 
         GEMMLowpOutputStageInfo gemmlowp_output_stage_info;
         ARM_COMPUTE_RETURN_ON_ERROR(get_gemmlowp_output_stage_info(input, weights, output, act, gemmlowp_output_stage_info));
@@ -115,9 +105,16 @@ Status validate_mm(const ITensorInfo *input, const ITensorInfo *weights, const I
         GEMMInfo gemm_info;
         gemm_info.set_gemmlowp_output_stage(gemmlowp_output_stage_info);
 
+        // Symmetric per-channel weights have no offset to negate
+        std::unique_ptr<ITensorInfo> weights_qa = weights->clone();
+        if(!is_data_type_quantized_per_channel(weights->data_type()))
+        {
+            weights_qa->set_quantization_info(QuantizationInfo(weights->quantization_info().uniform().scale, -weights->quantization_info().uniform().offset));
+        }
+
         // Validate gemmlowp function
         ARM_COMPUTE_RETURN_ON_ERROR(NEGEMMLowpMatrixMultiplyCore::validate(&input->clone()->set_quantization_info(input_quantization_info),
-                                                                           &weights->clone()->set_quantization_info(weights_quantization_info),
+                                                                           weights_qa.get(),
                                                                            biases,
                                                                            output,
                                                                            gemm_info));
@@ -160,7 +157,10 @@ void NEFullyConnectedLayer::configure_mm(const ITensor *input, const ITensor *we
         const QuantizationInfo weights_quantization_info = weights->info()->quantization_info();
 
         input->info()->set_quantization_info(QuantizationInfo(input_quantization_info.uniform().scale, -input_quantization_info.uniform().offset));
-        weights->info()->set_quantization_info(QuantizationInfo(weights_quantization_info.uniform().scale, -weights_quantization_info.uniform().offset));
+        if(!is_data_type_quantized_per_channel(weights->info()->data_type()))
+        {
+            weights->info()->set_quantization_info(QuantizationInfo(weights_quantization_info.uniform().scale, -weights_quantization_info.uniform().offset));
+        }
 
         // Configure gemmlowp function and output stage for asymmetric quantized types
         GEMMLowpOutputStageInfo gemmlowp_output_stage_info;
@@ -316,7 +316,14 @@ Status NEFullyConnectedLayer::validate(const ITensorInfo *input, const ITensorIn
     ARM_COMPUTE_UNUSED(fc_info.retain_internal_weights);
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, weights, output);
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QASYMM8, DataType::QASYMM8_SIGNED, DataType::F16, DataType::F32);
-    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1, DataType::QASYMM8, DataType::QASYMM8_SIGNED, DataType::QSYMM8_PER_CHANNEL, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(is_data_type_quantized_per_channel(weights->data_type()) && !is_data_type_quantized_asymmetric(input->data_type()),
+                                    "Per-channel quantized weights need an asymmetric quantized input");
+    if(!is_data_type_quantized_per_channel(weights->data_type()))
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights);
+    }
     ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 2);
     ARM_COMPUTE_RETURN_ERROR_ON(biases != nullptr && biases->num_dimensions() > 1);
 
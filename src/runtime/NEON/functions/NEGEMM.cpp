@@ -28,6 +28,7 @@
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/TracePoint.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
@@ -43,22 +44,23 @@ namespace arm_compute
 {
 NEGEMM::NEGEMM(std::shared_ptr<IMemoryManager> memory_manager, IWeightsManager *weights_manager)
     : _memory_group(memory_manager), _weights_manager(weights_manager), _interleave_kernel(), _transpose_kernel(), _mm_kernel(), _asm_glue(memory_manager, weights_manager), _ma_kernel(),
-      _alpha_scale_func(nullptr), _add_bias(), _activation_func(), _tmp_a(), _tmp_b(), _tmp_d(), _original_b(nullptr), _run_vector_matrix_multiplication(false), _run_alpha_scale(false),
-      _run_addition(false), _run_bias_addition(false), _run_activation(false), _reshape_b_only_on_first_run(false), _is_prepared(false)
+      _alpha_scale_func(nullptr), _add_bias(), _activation_func(), _tmp_a(), _tmp_b(), _tmp_d(), _original_b(nullptr), _run_vector_matrix_multiplication(false), _run_interleave(false),
+      _run_alpha_scale(false), _run_addition(false), _run_bias_addition(false), _run_activation(false), _reshape_b_only_on_first_run(false), _is_prepared(false)
 {
 }
 
 void NEGEMM::configure(const ITensor *a, const ITensor *b, const ITensor *c, ITensor *d, float alpha, float beta, const GEMMInfo &gemm_info)
 {
+    CREATE_TRACEPOINT("NEGEMM::configure");
     ARM_COMPUTE_ERROR_THROW_ON(NEGEMM::validate(a->info(), b->info(), (c != nullptr) ? c->info() : nullptr, d->info(), alpha, beta, gemm_info));
 
     const bool is_c_bias     = gemm_info.reshape_b_only_on_first_run();
-    bool       run_optimised = bool(NEGEMMAssemblyDispatch::validate(a->info(), b->info(), (is_c_bias && c != nullptr) ? c->info() : nullptr, d->info(), gemm_info));
+    bool       run_optimised = !gemm_info.is_a_reshaped() && bool(NEGEMMAssemblyDispatch::validate(a->info(), b->info(), (is_c_bias && c != nullptr) ? c->info() : nullptr, d->info(), gemm_info));
 
     // Check if we need to reshape the matrix B only on the first run
     _is_prepared                      = false;
     _reshape_b_only_on_first_run      = gemm_info.reshape_b_only_on_first_run();
-    _run_vector_matrix_multiplication = a->info()->dimension(1) < 2;
+    _run_vector_matrix_multiplication = a->info()->dimension(1) < 2 && !gemm_info.is_a_reshaped();
     _original_b                       = b;
     _run_alpha_scale                  = alpha != 1.f;
     _run_bias_addition                = c != nullptr && gemm_info.reshape_b_only_on_first_run();
@@ -95,44 +97,61 @@ void NEGEMM::configure(const ITensor *a, const ITensor *b, const ITensor *c, ITe
         }
         else
         {
-            TensorShape shape_tmp_a = a->info()->tensor_shape();
-            TensorShape shape_tmp_b = b->info()->tensor_shape();
+            // A may arrive already in the 4x4 interleaved block layout (e.g. emitted by a fused im2col)
+            _run_interleave = !gemm_info.is_a_reshaped();
+
+            const ITensor *matrix_a = a;
 
-            shape_tmp_a.set(0, a->info()->dimension(0) * 4);
-            shape_tmp_a.set(1, std::ceil(a->info()->dimension(1) / 4.0f));
+            TensorShape shape_tmp_b = b->info()->tensor_shape();
 
             const unsigned int transpose_w = 16 / data_size_from_type(b->info()->data_type());
             shape_tmp_b.set(0, b->info()->dimension(1) * transpose_w);
             shape_tmp_b.set(1, std::ceil(b->info()->dimension(0) / static_cast<float>(transpose_w)));
 
-            TensorInfo info_a = a->info()->clone()->set_tensor_shape(shape_tmp_a).set_is_resizable(true);
             TensorInfo info_b = b->info()->clone()->set_tensor_shape(shape_tmp_b).set_is_resizable(true);
 
-            _tmp_a.allocator()->init(info_a);
             _tmp_b.allocator()->init(info_b);
 
+            if(_run_interleave)
+            {
+                TensorShape shape_tmp_a = a->info()->tensor_shape();
+                shape_tmp_a.set(0, a->info()->dimension(0) * 4);
+                shape_tmp_a.set(1, std::ceil(a->info()->dimension(1) / 4.0f));
+
+                TensorInfo info_a = a->info()->clone()->set_tensor_shape(shape_tmp_a).set_is_resizable(true);
+                _tmp_a.allocator()->init(info_a);
+                _memory_group.manage(&_tmp_a);
+            }
+
             // Manage intermediate buffers
-            _memory_group.manage(&_tmp_a);
             if(!_reshape_b_only_on_first_run)
             {
                 _memory_group.manage(&_tmp_b);
             }
 
-            int m = a->info()->dimension(1);
+            // When A is already reshaped its original height is only visible through the output
+            int m = _run_interleave ? a->info()->dimension(1) : d->info()->dimension(1);
             int n = b->info()->dimension(0);
-            int k = a->info()->dimension(0);
+            int k = _run_interleave ? a->info()->dimension(0) : a->info()->dimension(0) / 4;
 
             // Configure interleave kernel
-            _interleave_kernel.configure(a, &_tmp_a);
+            if(_run_interleave)
+            {
+                _interleave_kernel.configure(a, &_tmp_a);
+                matrix_a = &_tmp_a;
+            }
 
             // Configure transpose kernel
             _transpose_kernel.configure(b, &_tmp_b);
 
             // Configure matrix multiplication kernel
-            _mm_kernel.configure(&_tmp_a, &_tmp_b, gemm_output_to_use, alpha, true, GEMMReshapeInfo(m, n, k));
+            _mm_kernel.configure(matrix_a, &_tmp_b, gemm_output_to_use, alpha, true, GEMMReshapeInfo(m, n, k));
 
             // Allocate once the all configure methods have been called
-            _tmp_a.allocator()->allocate();
+            if(_run_interleave)
+            {
+                _tmp_a.allocator()->allocate();
+            }
             if(!_reshape_b_only_on_first_run)
             {
                 _tmp_b.allocator()->allocate();
@@ -169,8 +188,15 @@ Status NEGEMM::validate(const ITensorInfo *a, const ITensorInfo *b, const ITenso
     ARM_COMPUTE_RETURN_ERROR_ON_CPU_BF16_UNSUPPORTED(a);
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(a, 1, DataType::BFLOAT16, DataType::F16, DataType::F32);
     ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(a, b);
-    ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->dimension(0) != b->dimension(1), "The product AB is defined only if the number of columns in A is equal to the number of rows in B");
-    ARM_COMPUTE_RETURN_ERROR_ON_MSG(gemm_info.is_a_reshaped(), "Matrix A already reshaped is not supported");
+    if(gemm_info.is_a_reshaped())
+    {
+        // A carries 4x4 interleaved blocks: each row holds four rows of the original matrix
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->dimension(0) != b->dimension(1) * 4, "The product AB is defined only if the number of columns in A is equal to the number of rows in B");
+    }
+    else
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->dimension(0) != b->dimension(1), "The product AB is defined only if the number of columns in A is equal to the number of rows in B");
+    }
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(gemm_info.is_b_reshaped(), "Matrix B already reshaped is not supported");
     if(a->data_type() != DataType::BFLOAT16)
     {
@@ -179,6 +205,7 @@ Status NEGEMM::validate(const ITensorInfo *a, const ITensorInfo *b, const ITenso
 
     if(c != nullptr && !is_c_bias)
     {
+        ARM_COMPUTE_RETURN_ERROR_ON(gemm_info.is_a_reshaped());
         ARM_COMPUTE_RETURN_ERROR_ON(gemm_info.depth_output_gemm3d() != 0);
         ARM_COMPUTE_RETURN_ERROR_ON(gemm_info.reinterpret_input_as_3d());
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(c, output);
@@ -201,6 +228,10 @@ Status NEGEMM::validate(const ITensorInfo *a, const ITensorInfo *b, const ITenso
                 ARM_COMPUTE_RETURN_ERROR_ON(a->dimension(1) != output->dimension(1) * output->dimension(2));
             }
         }
+        else if(gemm_info.is_a_reshaped())
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON(static_cast<unsigned int>(std::ceil(output->dimension(1) / 4.0f)) != a->dimension(1));
+        }
         else
         {
             ARM_COMPUTE_RETURN_ERROR_ON(a->dimension(1) != output->dimension(1));
@@ -208,13 +239,43 @@ Status NEGEMM::validate(const ITensorInfo *a, const ITensorInfo *b, const ITenso
     }
 
     // Check if we need to run the optimized assembly kernel
-    const bool run_optimised = bool(NEGEMMAssemblyDispatch::validate(a, b, is_c_bias ? c : nullptr, output, gemm_info));
+    const bool run_optimised = !gemm_info.is_a_reshaped() && bool(NEGEMMAssemblyDispatch::validate(a, b, is_c_bias ? c : nullptr, output, gemm_info));
 
     if(!run_optimised)
     {
         ARM_COMPUTE_RETURN_ERROR_ON_MSG(gemm_info.reinterpret_input_as_3d(), "NEGEMM cannot reinterpret the input tensor as 3D");
         ARM_COMPUTE_RETURN_ERROR_ON_MSG(gemm_info.depth_output_gemm3d() != 0, "NEGEMM cannot reinterpret the output tensor as 3D");
 
+        if(gemm_info.is_a_reshaped())
+        {
+            // A arrives already in the 4x4 interleaved block layout (e.g. emitted by a fused im2col); only B is reshaped here
+            ARM_COMPUTE_RETURN_ERROR_ON_MSG(output->total_size() == 0, "The output must be initialized when matrix A is already reshaped");
+
+            const int m = output->dimension(1);
+            const int n = b->dimension(0);
+            const int k = a->dimension(0) / 4;
+
+            TensorInfo tmp_b_info{};
+            auto_init_if_empty(tmp_b_info, b->clone()->set_tensor_shape(compute_transpose1xW_with_element_size_shape(*b, 1)));
+            ARM_COMPUTE_RETURN_ON_ERROR(NEGEMMTranspose1xWKernel::validate(b, &tmp_b_info));
+
+            ARM_COMPUTE_RETURN_ON_ERROR(NEGEMMMatrixMultiplyKernel::validate(a, &tmp_b_info, output, alpha, true, GEMMReshapeInfo(m, n, k)));
+
+            if(c != nullptr && gemm_info.reshape_b_only_on_first_run())
+            {
+                ARM_COMPUTE_RETURN_ON_ERROR(NEArithmeticAddition::validate(output, c, output, ConvertPolicy::SATURATE));
+            }
+
+            // Validate activation
+            const ActivationLayerInfo &activation = gemm_info.activation_info();
+            if(activation.enabled())
+            {
+                ARM_COMPUTE_RETURN_ON_ERROR(NEActivationLayer::validate(output, nullptr, activation));
+            }
+
+            return Status{};
+        }
+
         // Check if the first input tensor is a vector.
         const bool run_vector_matrix_multiplication = a->dimension(1) < 2;
         // Check if we need to reshape the matrix A and matrix B
@@ -280,6 +341,7 @@ Status NEGEMM::validate(const ITensorInfo *a, const ITensorInfo *b, const ITenso
 
 void NEGEMM::run()
 {
+    CREATE_TRACEPOINT("NEGEMM::run");
     prepare();
 
     MemoryGroupResourceScope scope_mg(_memory_group);
@@ -296,8 +358,11 @@ void NEGEMM::run()
     {
         if(!_run_vector_matrix_multiplication)
         {
-            // Run interleave kernel
-            NEScheduler::get().schedule(&_interleave_kernel, Window::DimY);
+            // Run interleave kernel unless A arrived already reshaped
+            if(_run_interleave)
+            {
+                NEScheduler::get().schedule(&_interleave_kernel, Window::DimY);
+            }
 
             if(!_reshape_b_only_on_first_run)
             {
@@ -31,6 +31,7 @@
 
 #include "src/core/NEON/kernels/assembly/NEGEMMAssemblyWrapperKernel.h"
 
+#include <algorithm>
 #include <arm_neon.h>
 
 namespace arm_compute
@@ -41,12 +42,6 @@ arm_gemm::Activation map_to_arm_gemm_activation(const ActivationLayerInfo &act)
 {
     arm_gemm::Activation gemm_act;
 
-    // Early exit in case lower bound is other than 0, as it's not yet supported
-    if(act.b() != 0.f)
-    {
-        return gemm_act;
-    }
-
     switch(act.activation())
     {
         case ActivationLayerInfo::ActivationFunction::RELU:
@@ -69,6 +64,152 @@ arm_gemm::Activation map_to_arm_gemm_activation(const ActivationLayerInfo &act)
     return gemm_act;
 }
 
+/** Fold contiguous batches of A and D into M.
+ *
+ * Transformer-style workloads issue many tiny GEMMs as a batch; when each
+ * batch is laid out back-to-back in memory and B is shared across batches the
+ * problem is equivalent to a single GEMM with M' = M * batches. Folding lets
+ * arm_gemm schedule one flattened workload (and fill out_height-sized blocks
+ * across batch boundaries) instead of dispatching one M-block per tiny batch.
+ *
+ * @param[in]     a         Input tensor A
+ * @param[in]     b         Input tensor B
+ * @param[in]     d         Output tensor
+ * @param[in]     gemm_info GEMM meta-data
+ * @param[in,out] p         Extracted GEMM parameters, updated on success
+ *
+ * @return True if the batches were folded into M
+ */
+bool fold_batches_into_m(const ITensor *a, const ITensor *b, const ITensor *d, const GEMMInfo &gemm_info, INEGEMMWrapperKernel::Params &p)
+{
+    if(p.batches <= 1 || p.multis > 1 || gemm_info.reinterpret_input_as_3d() || gemm_info.depth_output_gemm3d() != 0)
+    {
+        return false;
+    }
+    // B must be shared by all the batches
+    if(b->info()->tensor_shape().total_size_upper(2) != 1)
+    {
+        return false;
+    }
+    // A and D batches must be back-to-back in memory so rows stay evenly strided across the fold
+    const auto &strides_a = a->info()->strides_in_bytes();
+    const auto &strides_d = d->info()->strides_in_bytes();
+    if(strides_a[2] != p.M * strides_a[1] || strides_d[2] != p.M * strides_d[1])
+    {
+        return false;
+    }
+    // The fold flattens every upper dimension, so a fourth dimension must be back-to-back too
+    if(a->info()->num_dimensions() > 3 && strides_a[3] != a->info()->dimension(2) * strides_a[2])
+    {
+        return false;
+    }
+    if(d->info()->num_dimensions() > 3 && strides_d[3] != d->info()->dimension(2) * strides_d[2])
+    {
+        return false;
+    }
+
+    p.M *= p.batches;
+    p.batches = 1;
+    return true;
+}
+
+/** Map batched GEMMs sharing a single B onto arm_gemm's multi dimension.
+ *
+ * Attention-style workloads run a (batch, heads) family of GEMMs in which A and D
+ * carry two upper dimensions while B holds one matrix shared by all of them. The
+ * default parameter extraction collapses every upper dimension into batches, which
+ * assumes the two dimensions are back-to-back in memory. Mapping the outermost
+ * dimension onto multis instead keeps one stride per dimension, so strided
+ * sub-views (e.g. slices of a fused QKV buffer) can be fed without being copied
+ * into a dense tensor first; the shared B is broadcast with a zero multi stride.
+ *
+ * @param[in]     a         Input tensor A
+ * @param[in]     b         Input tensor B
+ * @param[in]     d         Output tensor
+ * @param[in]     gemm_info GEMM meta-data
+ * @param[in,out] p         Extracted GEMM parameters, updated on success
+ *
+ * @return True if the outermost dimension was mapped onto multis
+ */
+bool map_shared_b_multis(const ITensor *a, const ITensor *b, const ITensor *d, const GEMMInfo &gemm_info, INEGEMMWrapperKernel::Params &p)
+{
+    if(p.multis > 1 || gemm_info.reinterpret_input_as_3d() || gemm_info.depth_output_gemm3d() != 0)
+    {
+        return false;
+    }
+    // B must be a single matrix shared by all the batches
+    if(b->info()->tensor_shape().total_size_upper(2) != 1)
+    {
+        return false;
+    }
+    // Only a 4D problem carries a second upper dimension with its own stride to honour
+    if(a->info()->num_dimensions() != 4 || d->info()->num_dimensions() != 4)
+    {
+        return false;
+    }
+
+    p.batches = d->info()->tensor_shape()[2];
+    p.multis  = d->info()->tensor_shape()[3];
+    return true;
+}
+
+/** Decide whether the block-sparse GEMM path should be used for the given weights.
+ *
+ * Scans B in 4x4 blocks (the block size of arm_gemm's sparse weight format) and
+ * accepts when the fraction of non-zero blocks is low enough that skipping
+ * blocks beats the dense kernels. Weights which are not resident at configure
+ * time cannot be probed and always take the dense path.
+ *
+ * @param[in] b Weights tensor
+ * @param[in] p Extracted GEMM parameters
+ *
+ * @return True if the sparse path should be requested
+ */
+bool use_sparse_gemm(const ITensor *b, const INEGEMMWrapperKernel::Params &p)
+{
+    // Below this fraction of non-zero 4x4 blocks the sparse path wins over the dense kernels
+    constexpr float        density_threshold = 0.35f;
+    constexpr unsigned int block_dim         = 4;
+
+    if(b->info()->data_type() != DataType::F32 || b->buffer() == nullptr || p.multis > 1)
+    {
+        return false;
+    }
+
+    const auto  *b_ptr = reinterpret_cast<const float *>(b->buffer() + b->info()->offset_first_element_in_bytes());
+    const size_t ldb   = b->info()->strides_in_bytes()[1] / sizeof(float);
+
+    const unsigned int kblocks = (p.K + block_dim - 1) / block_dim;
+    const unsigned int nblocks = (p.N + block_dim - 1) / block_dim;
+
+    unsigned int nonzero_blocks = 0;
+    for(unsigned int kb = 0; kb < kblocks; ++kb)
+    {
+        for(unsigned int nb = 0; nb < nblocks; ++nb)
+        {
+            const unsigned int kend = std::min((kb + 1) * block_dim, p.K);
+            const unsigned int nend = std::min((nb + 1) * block_dim, p.N);
+
+            bool nonzero = false;
+            for(unsigned int k = kb * block_dim; k < kend && !nonzero; ++k)
+            {
+                for(unsigned int n = nb * block_dim; n < nend; ++n)
+                {
+                    if(b_ptr[k * ldb + n] != 0.f)
+                    {
+                        nonzero = true;
+                        break;
+                    }
+                }
+            }
+            nonzero_blocks += nonzero ? 1 : 0;
+        }
+    }
+
+    const float density = static_cast<float>(nonzero_blocks) / static_cast<float>(kblocks * nblocks);
+    return density < density_threshold;
+}
+
 template <typename TypeInput, typename TypeOutput>
 class FallbackTransform : public ITransformWeights
 {
@@ -185,6 +326,20 @@ public:
     std::tuple<const int32_t *, const int32_t *> set_requantize_data(const std::vector<int32_t> &shifts,
                                                                      const std::vector<int32_t> &multipliers);
 
+    /** Record that contiguous batches of A and D were folded into M at configure time.
+     *
+     * The fold is only legal while A and D batches stay back-to-back in memory, which
+     * is re-checked on every run as later-configured kernels can still grow the
+     * tensors' padding before allocation.
+     *
+     * @param[in] rows_per_batch M of a single batch before the fold
+     */
+    void set_folded_batches(unsigned int rows_per_batch)
+    {
+        _folded_batches = true;
+        _rows_per_batch = rows_per_batch;
+    }
+
     // Inherited methods overridden:
     void run() override;
     void prepare() override;
@@ -237,6 +392,10 @@ private:
     std::vector<int32_t> _shifts{};
     /** Per channel quantization multipliers */
     std::vector<int32_t> _multipliers{};
+    /** True if batches of A and D were folded into M at configure time */
+    bool _folded_batches{ false };
+    /** M of a single batch before the fold */
+    unsigned int _rows_per_batch{ 0 };
 };
 
 template <typename TypeInput, typename TypeOutput, class OutputStage>
@@ -330,9 +489,10 @@ void Fallback<TypeInput, TypeOutput, OutputStage>::prepare()
         // Pretranspose B if required
         if(_gemm_kernel_asm->B_pretranspose_required())
         {
-            const int  ldb            = _b->info()->strides_in_bytes().y() / sizeof(TypeInput);
-            const auto in1_ptr        = reinterpret_cast<const TypeInput *>(_b->buffer() + _b->info()->offset_first_element_in_bytes());
-            const int  multi_stride_b = _b->info()->strides_in_bytes().z() / sizeof(TypeInput);
+            const int  ldb     = _b->info()->strides_in_bytes().y() / sizeof(TypeInput);
+            const auto in1_ptr = reinterpret_cast<const TypeInput *>(_b->buffer() + _b->info()->offset_first_element_in_bytes());
+            // A single B shared by every multi is broadcast with a zero stride
+            const int multi_stride_b = _b->info()->tensor_shape().total_size_upper(2) == 1 ? 0 : _b->info()->strides_in_bytes().z() / sizeof(TypeInput);
 
             if(_weights_manager && _weights_manager->are_weights_managed(_b))
             {
@@ -376,6 +536,24 @@ bool Fallback<TypeInput, TypeOutput, OutputStage>::is_configured() const
 template <typename TypeInput, typename TypeOutput, class OutputStage>
 void Fallback<TypeInput, TypeOutput, OutputStage>::run()
 {
+    // The fold decision was taken at configure time from the strides of A and D, but a
+    // later-configured kernel can still extend their padding before allocation and
+    // change the batch stride. The flattened GEMM would then read and write the rows of
+    // the upper batches at the wrong offsets, so re-verify the back-to-back layout here
+    // and fail loudly instead of producing silently wrong results.
+    if(_folded_batches)
+    {
+        const auto &strides_a = _a->info()->strides_in_bytes();
+        const auto &strides_d = _d->info()->strides_in_bytes();
+        ARM_COMPUTE_UNUSED(strides_a, strides_d);
+        ARM_COMPUTE_ERROR_ON_MSG(strides_a[2] != _rows_per_batch * strides_a[1] || strides_d[2] != _rows_per_batch * strides_d[1],
+                                 "Batches of A and D were folded into M but are no longer contiguous in memory");
+        ARM_COMPUTE_ERROR_ON_MSG(_a->info()->num_dimensions() > 3 && strides_a[3] != _a->info()->dimension(2) * strides_a[2],
+                                 "Batches of A were folded into M but are no longer contiguous in memory");
+        ARM_COMPUTE_ERROR_ON_MSG(_d->info()->num_dimensions() > 3 && strides_d[3] != _d->info()->dimension(2) * strides_d[2],
+                                 "Batches of D were folded into M but are no longer contiguous in memory");
+    }
+
     const int lda = _a->info()->strides_in_bytes().y() / sizeof(TypeInput);
     int       ldb = 0;
     const int ldd = _d->info()->strides_in_bytes().y() / sizeof(TypeOutput);
@@ -399,8 +577,9 @@ void Fallback<TypeInput, TypeOutput, OutputStage>::run()
     // Check if B is pre-tranposed and de-reference if not
     if(!_gemm_kernel_asm->B_is_pretransposed())
     {
-        ldb            = _b->info()->strides_in_bytes().y() / sizeof(TypeInput);
-        multi_stride_b = _b->info()->strides_in_bytes().z() / sizeof(TypeInput);
+        ldb = _b->info()->strides_in_bytes().y() / sizeof(TypeInput);
+        // A single B shared by every multi is broadcast with a zero stride
+        multi_stride_b = _b->info()->tensor_shape().total_size_upper(2) == 1 ? 0 : _b->info()->strides_in_bytes().z() / sizeof(TypeInput);
         in1_ptr        = reinterpret_cast<const TypeInput *>(_b->buffer() + _b->info()->offset_first_element_in_bytes());
     }
 
@@ -445,7 +624,8 @@ void Fallback<TypeInput, TypeOutput, OutputStage>::run()
         const int granule_threshold = 200;
         scheduling_hint             = IScheduler::Hints(IScheduler::split_dimensions_all, IScheduler::StrategyHint::STATIC, granule_threshold);
     }
-    else if(_kernel_info.method == arm_gemm::GemmMethod::QUANTIZE_WRAPPER_2D && (_d->info()->data_type() == DataType::QASYMM8 || _d->info()->data_type() == DataType::QASYMM8_SIGNED))
+    else if((_kernel_info.method == arm_gemm::GemmMethod::QUANTIZE_WRAPPER_2D || _kernel_info.method == arm_gemm::GemmMethod::GEMM_HYBRID_QUANTIZED)
+            && (_d->info()->data_type() == DataType::QASYMM8 || _d->info()->data_type() == DataType::QASYMM8_SIGNED))
     {
         //special case for QASYMM8 to support 2D parallelism, scheduler here may be tweaked differently compared to FP32 case
         const int granule_threshold = 200;
@@ -464,10 +644,32 @@ void create_arm_gemm(std::unique_ptr<NEGEMMAssemblyDispatch::IFallback> &arm_gem
     const CPUInfo               &ci          = NEScheduler::get().cpu_info();
     unsigned int                 num_threads = NEScheduler::get().num_threads();
 
-    arm_gemm::GemmArgs args(&ci, p.M, p.N, p.K, p.batches, p.multis, activation, num_threads);
+    const unsigned int rows_per_batch = p.M;
+    const bool         folded_batches = fold_batches_into_m(a, b, d, gemm_info, p);
+    if(!folded_batches)
+    {
+        map_shared_b_multis(a, b, d, gemm_info, p);
+    }
+
+    // Request the block-sparse kernels when the weights are resident and sparse
+    // enough; the selection heuristics never pick them on their own as the
+    // density of B is unknown inside arm_gemm.
+    arm_gemm::GemmConfig        gemm_cfg{};
+    const arm_gemm::GemmConfig *cfg = nullptr;
+    if(use_sparse_gemm(b, p))
+    {
+        gemm_cfg.method = arm_gemm::GemmMethod::GEMM_SPARSE;
+        cfg             = &gemm_cfg;
+    }
+
+    arm_gemm::GemmArgs args(&ci, p.M, p.N, p.K, p.batches, p.multis, activation, num_threads, gemm_info.fast_math(), gemm_info.fp_mixed_precision(), cfg);
 
     // Create arm_gemm fallback
     auto fallback = support::cpp14::make_unique<Fallback<TypeInput, TypeOutput>>();
+    if(folded_batches)
+    {
+        fallback->set_folded_batches(rows_per_batch);
+    }
     fallback->configure(a, b, c, d, args, gemm_info, memory_group, weights_manager);
     arm_gemm = std::move(fallback);
 }
@@ -482,10 +684,21 @@ void create_arm_gemm_quant(std::unique_ptr<NEGEMMAssemblyDispatch::IFallback> &a
     const CPUInfo               &ci          = NEScheduler::get().cpu_info();
     unsigned int                 num_threads = NEScheduler::get().num_threads();
 
+    const unsigned int rows_per_batch = p.M;
+    const bool         folded_batches = fold_batches_into_m(a, b, d, gemm_info, p);
+    if(!folded_batches)
+    {
+        map_shared_b_multis(a, b, d, gemm_info, p);
+    }
+
     arm_gemm::GemmArgs args(&ci, p.M, p.N, p.K, p.batches, p.multis, activation, num_threads);
 
     // Create arm_gemm fallback
     auto fallback = support::cpp14::make_unique<Fallback<TypeInput, TypeOutput, arm_gemm::Requantize32>>();
+    if(folded_batches)
+    {
+        fallback->set_folded_batches(rows_per_batch);
+    }
 
     // Configure requantization info
     const int32_t                 a_offset = -a->info()->quantization_info().uniform().offset;
@@ -514,6 +727,42 @@ void create_arm_gemm_quant(std::unique_ptr<NEGEMMAssemblyDispatch::IFallback> &a
     arm_gemm = std::move(fallback);
 }
 
+template <typename TypeInput, typename TypeOutput>
+void create_arm_gemm_indirect(std::unique_ptr<NEGEMMAssemblyDispatch::IFallback> &arm_gemm, MemoryGroup &memory_group,
+                              const ITensor *a, const ITensor *b, const ITensor *c, ITensor *d, arm_gemm::Activation activation, const GEMMInfo &gemm_info,
+                              const PadStrideInfo &conv_info, const Size2D &kernel_dims, IWeightsManager *weights_manager)
+{
+    const CPUInfo &ci          = NEScheduler::get().cpu_info();
+    unsigned int   num_threads = NEScheduler::get().num_threads();
+
+    // NHWC: a is [C, W, H, N], d is [OC, OW, OH, N]
+    arm_gemm::ConvolutionParameters cp{};
+    cp.input_width     = a->info()->dimension(1);
+    cp.input_height    = a->info()->dimension(2);
+    cp.input_channels  = a->info()->dimension(0);
+    cp.kernel_width    = kernel_dims.width;
+    cp.kernel_height   = kernel_dims.height;
+    cp.output_width    = d->info()->dimension(1);
+    cp.output_height   = d->info()->dimension(2);
+    cp.output_stride_w = conv_info.stride().first;
+    cp.output_stride_h = conv_info.stride().second;
+    cp.padding_top     = conv_info.pad_top();
+    cp.padding_left    = conv_info.pad_left();
+
+    const unsigned int M       = cp.output_width * cp.output_height;
+    const unsigned int N       = d->info()->dimension(0);
+    const unsigned int K       = cp.input_channels * cp.kernel_width * cp.kernel_height;
+    const unsigned int batches = a->info()->dimension(3);
+
+    arm_gemm::GemmConfig gemm_cfg(arm_gemm::GemmMethod::GEMM_INDIRECT);
+    arm_gemm::GemmArgs   args(&ci, M, N, K, batches, 1, activation, num_threads, gemm_info.fast_math(), gemm_info.fp_mixed_precision(), &gemm_cfg, &cp);
+
+    // Create arm_gemm fallback
+    auto fallback = support::cpp14::make_unique<Fallback<TypeInput, TypeOutput>>();
+    fallback->configure(a, b, c, d, args, gemm_info, memory_group, weights_manager);
+    arm_gemm = std::move(fallback);
+}
+
 } //namespace
 
 NEGEMMAssemblyDispatch::NEGEMMAssemblyDispatch(std::shared_ptr<IMemoryManager> memory_manager, IWeightsManager *weights_manager)
@@ -559,6 +808,42 @@ bool NEGEMMAssemblyDispatch::is_activation_supported(const ActivationLayerInfo &
     return act.type != arm_gemm::Activation::Type::None;
 }
 
+bool NEGEMMAssemblyDispatch::is_indirect_convolution_supported(const ITensorInfo *input, const ITensorInfo *weights,
+                                                               const PadStrideInfo &conv_info, const Size2D &dilation, const ActivationLayerInfo &act_info)
+{
+#ifdef __aarch64__
+    ARM_COMPUTE_UNUSED(conv_info);
+    if(input == nullptr || weights == nullptr)
+    {
+        return false;
+    }
+    // The offset table indexes whole input rows, which requires the channels to be dense in memory
+    if(input->data_layout() != DataLayout::NHWC || input->data_type() != DataType::F32 || weights->data_type() != DataType::F32)
+    {
+        return false;
+    }
+    // Dilation would need a sparser offset table; not supported yet
+    if(dilation != Size2D(1U, 1U))
+    {
+        return false;
+    }
+    // The hybrid kernels backing the indirect path need a minimum accumulation depth
+    if(input->dimension(0) * weights->dimension(1) * weights->dimension(2) < 4)
+    {
+        return false;
+    }
+    // There is no separate activation stage on this path, so the activation must be fused or absent
+    if(act_info.enabled() && !is_activation_supported(act_info))
+    {
+        return false;
+    }
+    return true;
+#else  /* __aarch64__ */
+    ARM_COMPUTE_UNUSED(input, weights, conv_info, dilation, act_info);
+    return false;
+#endif /* __aarch64__ */
+}
+
 void NEGEMMAssemblyDispatch::configure(const ITensor *a, const ITensor *b, const ITensor *c, ITensor *d, const GEMMInfo &gemm_info)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(a, b, d);
@@ -614,6 +899,22 @@ void NEGEMMAssemblyDispatch::configure(const ITensor *a, const ITensor *b, const
     }
 }
 
+void NEGEMMAssemblyDispatch::configure_indirect_convolution(const ITensor *a, const ITensor *b, const ITensor *c, ITensor *d,
+                                                            const PadStrideInfo &conv_info, const Size2D &kernel_dims, const GEMMInfo &gemm_info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(a, b, d);
+
+    //If we don't support the configuration, silently return: it is the caller's responsibility to check if configure() was successful via is_configured()
+    if(a->info()->data_type() != DataType::F32 || a->info()->data_layout() != DataLayout::NHWC)
+    {
+        return;
+    }
+
+    arm_gemm::Activation act = map_to_arm_gemm_activation(gemm_info.activation_info());
+
+    create_arm_gemm_indirect<float, float>(_arm_gemm, _memory_group, a, b, c, d, act, gemm_info, conv_info, kernel_dims, _weights_manager);
+}
+
 void NEGEMMAssemblyDispatch::prepare()
 {
     ARM_COMPUTE_ERROR_ON(_arm_gemm == nullptr);
@@ -90,22 +90,25 @@ void NEConvolutionLayerReshapeWeights::run()
 }
 
 NEGEMMConvolutionLayer::NEGEMMConvolutionLayer(const std::shared_ptr<IMemoryManager> &memory_manager, IWeightsManager *weights_manager)
-    : _memory_group(memory_manager), _weights_manager(weights_manager), _reshape_weights(), _reshape_weights_managed(), _im2col_kernel(), _mm_gemm(memory_manager), _mm_gemmlowp(memory_manager),
-      _col2im_kernel(), _reshape_layer(), _original_weights(nullptr), _im2col_output(), _weights_reshaped(), _gemm_output(), _tmp_output(), _data_layout(DataLayout::NCHW), _skip_im2col(false),
-      _skip_col2im(false), _is_quantized(false), _is_prepared(false)
+    : _memory_group(memory_manager), _weights_manager(weights_manager), _reshape_weights(), _reshape_weights_managed(), _transpose_weights(), _im2col_kernel(), _mm_gemm(memory_manager),
+      _mm_gemm_indirect(memory_manager, weights_manager), _mm_gemmlowp(memory_manager), _col2im_kernel(), _reshape_layer(), _original_weights(nullptr), _im2col_output(), _weights_flat(),
+      _weights_reshaped(), _gemm_output(), _tmp_output(), _data_layout(DataLayout::NCHW), _run_indirect(false), _skip_im2col(false), _skip_col2im(false), _transpose_1x1_weights(false),
+      _is_quantized(false), _is_prepared(false)
 {
 }
 
-void NEGEMMConvolutionLayer::configure_mm(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const ActivationLayerInfo &act_info, int gemm_3d_depth)
+void NEGEMMConvolutionLayer::configure_mm(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const ActivationLayerInfo &act_info, int gemm_3d_depth,
+                                          bool enable_fast_math, bool a_interleaved)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights);
     ARM_COMPUTE_ERROR_THROW_ON(validate_mm(input->info(), weights->info(), biases == nullptr ? nullptr : biases->info(), output == nullptr ? nullptr : output->info(),
-                                           act_info, gemm_3d_depth, _skip_im2col));
+                                           act_info, gemm_3d_depth, _skip_im2col, enable_fast_math, a_interleaved));
 
     // Create GEMMInfo structure
-    const GEMMInfo &gemm_info = GEMMInfo(false, false, true /* Reshape weights only for the first run */,
-                                         gemm_3d_depth, _skip_im2col /* Reinterpret the input as 3D if im2col is skipped */,
-                                         false, GEMMLowpOutputStageInfo(), false, false, act_info);
+    GEMMInfo gemm_info = GEMMInfo(a_interleaved, false, true /* Reshape weights only for the first run */,
+                                  gemm_3d_depth, _skip_im2col /* Reinterpret the input as 3D if im2col is skipped */,
+                                  false, GEMMLowpOutputStageInfo(), false, false, act_info);
+    gemm_info.set_fast_math(enable_fast_math);
 
     // Supported activations in GEMM
     const std::set<ActivationLayerInfo::ActivationFunction> supported_acts = { ActivationLayerInfo::ActivationFunction::RELU,
@@ -165,16 +168,17 @@ void NEGEMMConvolutionLayer::configure_mm(const ITensor *input, const ITensor *w
 }
 
 Status NEGEMMConvolutionLayer::validate_mm(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output,
-                                           const ActivationLayerInfo &act_info, int gemm_3d_depth, bool skip_im2col)
+                                           const ActivationLayerInfo &act_info, int gemm_3d_depth, bool skip_im2col, bool enable_fast_math, bool a_interleaved)
 {
     const DataType data_type             = input->data_type();
     const bool     is_quantized          = is_data_type_quantized_asymmetric(data_type);
     const bool     is_activation_enabled = act_info.enabled();
 
     // Create GEMMInfo structure
-    const GEMMInfo gemm_info = GEMMInfo(false, false, true /* Reshape weights only for the first run */,
-                                        gemm_3d_depth, skip_im2col /* Reinterpret the input as 3D if im2col is skipped */,
-                                        false, GEMMLowpOutputStageInfo(), false, false, act_info);
+    GEMMInfo gemm_info = GEMMInfo(a_interleaved, false, true /* Reshape weights only for the first run */,
+                                  gemm_3d_depth, skip_im2col /* Reinterpret the input as 3D if im2col is skipped */,
+                                  false, GEMMLowpOutputStageInfo(), false, false, act_info);
+    gemm_info.set_fast_math(enable_fast_math);
 
     if(is_quantized)
     {
@@ -238,7 +242,7 @@ Status NEGEMMConvolutionLayer::validate_gemm3d(const ITensorInfo *input_info, co
 }
 
 void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, const WeightsInfo &weights_info,
-                                       const Size2D &dilation, const ActivationLayerInfo &act_info, unsigned int num_groups)
+                                       const Size2D &dilation, const ActivationLayerInfo &act_info, unsigned int num_groups, bool enable_fast_math, const ITensor *residual)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
     ARM_COMPUTE_UNUSED(num_groups, weights_info);
@@ -250,7 +254,9 @@ void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weig
                                                                 weights_info,
                                                                 dilation,
                                                                 act_info,
-                                                                num_groups));
+                                                                num_groups,
+                                                                enable_fast_math,
+                                                                residual != nullptr ? residual->info() : nullptr));
 
     const DataType   data_type   = input->info()->data_type();
     const DataLayout data_layout = input->info()->data_layout();
@@ -295,6 +301,12 @@ void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weig
         _skip_col2im = false;
     }
 
+    // Check if the convolution can be fed to the assembly GEMM directly through an offset
+    // table, with no materialized im2col matrix. The 1x1 stride-1 case keeps the existing
+    // (cheaper) GEMM3D path.
+    _run_indirect = !_is_quantized && !_skip_im2col && _skip_col2im
+                    && NEGEMMAssemblyDispatch::is_indirect_convolution_supported(input->info(), weights->info(), conv_info, dilation, act_info);
+
     // Get parameters from conv_info
     unsigned int stride_x = 0;
     unsigned int stride_y = 0;
@@ -306,6 +318,11 @@ void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weig
     // Just append biases and do not transpose 1xW as it will be reshaped in NEGEMM
     const ITensor *weights_to_use = weights;
 
+    if(_weights_manager)
+    {
+        _weights_manager->manage(weights);
+    }
+
     if(_weights_manager && _weights_manager->are_weights_managed(weights))
     {
         _reshape_weights_managed.configure(weights, nullptr);
@@ -313,17 +330,58 @@ void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weig
     }
     else
     {
-        _reshape_weights.configure(weights, nullptr, &_weights_reshaped);
+        // The native weights of a 1x1 NHWC convolution are already a contiguous IFM x OFM matrix,
+        // so the generic im2col-oriented reshape degenerates to a plain 2D transpose which the
+        // vectorized transpose kernel performs considerably faster at prepare time
+        _transpose_1x1_weights = _skip_im2col && !weights->info()->has_padding();
+        if(_transpose_1x1_weights)
+        {
+            TensorInfo flat_info(TensorShape(weights->info()->dimension(0), weights->info()->dimension(idx_kernels)), 1, weights->info()->data_type());
+            flat_info.set_quantization_info(weights->info()->quantization_info());
+            _weights_flat.allocator()->init(flat_info);
+            _transpose_weights.configure(&_weights_flat, &_weights_reshaped);
+        }
+        else
+        {
+            _reshape_weights.configure(weights, nullptr, &_weights_reshaped);
+        }
         weights_to_use = &_weights_reshaped;
     }
 
+    if(_run_indirect)
+    {
+        // Configure the assembly GEMM to gather input rows on the fly; im2col and NEGEMM are not used
+        GEMMInfo gemm_info = GEMMInfo(false, false, true /* Reshape weights only for the first run */, conv_h, true /* Reinterpret the input as 3D */,
+                                      false, GEMMLowpOutputStageInfo(), false, false, act_info);
+        gemm_info.set_fast_math(enable_fast_math);
+        _mm_gemm_indirect.configure_indirect_convolution(input, weights_to_use, biases, output, conv_info, Size2D(kernel_width, kernel_height), gemm_info);
+        _run_indirect = _mm_gemm_indirect.is_configured();
+    }
+
     // Create tensor to store im2col reshaped inputs
-    if(!_skip_im2col)
+    bool fuse_interleave = false;
+    if(!_skip_im2col && !_run_indirect)
     {
         _memory_group.manage(&_im2col_output);
 
+        // When the GEMM is going to fall back to the native NEGEMM path, matrix A gets re-read and
+        // rewritten by NEGEMMInterleave4x4Kernel right after im2col. Emitting the interleaved block
+        // layout from im2col directly saves that extra pass over a matrix often larger than the LLC.
+        if(!_is_quantized && !_skip_col2im && (conv_w * conv_h > 1))
+        {
+            const TensorInfo im2col_info(compute_im2col_conv_shape(input->info(), Size2D(kernel_width, kernel_height), conv_info, false, dilation, false), 1, data_type);
+            const TensorInfo weights_gemm_info(TensorShape(mat_weights_cols, im2col_info.dimension(0)), 1, weights->info()->data_type());
+            TensorShape      shape_gemm = im2col_info.tensor_shape();
+            shape_gemm.set(0, mat_weights_cols);
+            shape_gemm.set(1, conv_w * conv_h);
+            const TensorInfo gemm_output_info(shape_gemm, 1, data_type == DataType::BFLOAT16 ? DataType::F32 : data_type);
+            GEMMInfo         asm_info = GEMMInfo(false, false, true, 0, false, false, GEMMLowpOutputStageInfo(), false, false, act_info);
+            asm_info.set_fast_math(enable_fast_math);
+            fuse_interleave = !bool(NEGEMMAssemblyDispatch::validate(&im2col_info, &weights_gemm_info, biases != nullptr ? biases->info() : nullptr, &gemm_output_info, asm_info));
+        }
+
         // Configure
-        _im2col_kernel.configure(input, &_im2col_output, Size2D(kernel_width, kernel_height), conv_info, false, dilation);
+        _im2col_kernel.configure(input, &_im2col_output, Size2D(kernel_width, kernel_height), conv_info, false, dilation, 1, fuse_interleave);
 
         // Update GEMM input
         gemm_input_to_use = &_im2col_output;
@@ -350,12 +408,15 @@ void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weig
         gemm_output_to_use = &_gemm_output;
     }
 
-    // Configure GEMM
-    // In case we need to skip col2im, GEMM3D (gemm_3d_depth != 0) must be called in order to avoid reshaping the output matrix
-    const unsigned int gemm_3d_depth = _skip_col2im ? conv_h : 0;
-    configure_mm(gemm_input_to_use, weights_to_use, biases, gemm_output_to_use, act_info, gemm_3d_depth);
+    if(!_run_indirect)
+    {
+        // Configure GEMM
+        // In case we need to skip col2im, GEMM3D (gemm_3d_depth != 0) must be called in order to avoid reshaping the output matrix
+        const unsigned int gemm_3d_depth = _skip_col2im ? conv_h : 0;
+        configure_mm(gemm_input_to_use, weights_to_use, biases, gemm_output_to_use, act_info, gemm_3d_depth, enable_fast_math, fuse_interleave);
+    }
 
-    if(!_skip_im2col)
+    if(!_skip_im2col && !_run_indirect)
     {
         _im2col_output.allocator()->allocate();
     }
@@ -364,8 +425,8 @@ void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weig
     {
         if(_data_layout == DataLayout::NCHW)
         {
-            // Configure col2im
-            _col2im_kernel.configure(gemm_output_to_use, output, Size2D(conv_w, conv_h));
+            // Configure col2im, with the residual tensor fused into its epilogue when provided
+            _col2im_kernel.configure(gemm_output_to_use, output, Size2D(conv_w, conv_h), residual);
         }
         else
         {
@@ -389,7 +450,7 @@ void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weig
 }
 
 Status NEGEMMConvolutionLayer::validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info,
-                                        const WeightsInfo &weights_info, const Size2D &dilation, const ActivationLayerInfo &act_info, unsigned int num_groups)
+                                        const WeightsInfo &weights_info, const Size2D &dilation, const ActivationLayerInfo &act_info, unsigned int num_groups, bool enable_fast_math, const ITensorInfo *residual)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, weights, output);
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(weights_info.are_reshaped(), "Weights already reshaped are not supported!");
@@ -517,12 +578,17 @@ Status NEGEMMConvolutionLayer::validate(const ITensorInfo *input, const ITensorI
     }
     info_gemm.set_quantization_info(output->quantization_info()).set_data_layout(input->data_layout());
     gemm_output_to_use = &info_gemm;
-    ARM_COMPUTE_RETURN_ON_ERROR(validate_mm(gemm_input_to_use, weights_to_use, biases, gemm_output_to_use, act_info, skip_col2im ? conv_h : 0, skip_im2col));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_mm(gemm_input_to_use, weights_to_use, biases, gemm_output_to_use, act_info, skip_col2im ? conv_h : 0, skip_im2col, enable_fast_math));
 
     // Validate Col2Im/ReshapeLayer
     if(!skip_col2im && (data_layout == DataLayout::NCHW))
     {
-        ARM_COMPUTE_RETURN_ON_ERROR(NECol2ImKernel::validate(gemm_output_to_use, output, Size2D(conv_w, conv_h)));
+        ARM_COMPUTE_RETURN_ON_ERROR(NECol2ImKernel::validate(gemm_output_to_use, output, Size2D(conv_w, conv_h), residual));
+    }
+    else
+    {
+        // The fused residual add lives in the col2im epilogue, so it is only available when col2im runs
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(residual != nullptr, "Fused residual add is only supported on the NCHW col2im path");
     }
 
     return Status{};
@@ -534,7 +600,7 @@ void NEGEMMConvolutionLayer::run()
 
     MemoryGroupResourceScope scope_mg(_memory_group);
 
-    if(!_skip_im2col)
+    if(!_skip_im2col && !_run_indirect)
     {
         // Run input reshaping
         unsigned int y_dim = get_data_layout_dimension_index(_data_layout, DataLayoutDimension::HEIGHT);
@@ -547,6 +613,11 @@ void NEGEMMConvolutionLayer::run()
         // Run gemmlowp
         _mm_gemmlowp.run();
     }
+    else if(_run_indirect)
+    {
+        // Run the assembly GEMM directly over the NHWC input
+        _mm_gemm_indirect.run();
+    }
     else
     {
         // Run gemm
@@ -579,12 +650,29 @@ void NEGEMMConvolutionLayer::prepare()
         {
             // Run weights reshaping and mark original weights tensor as unused
             _weights_reshaped.allocator()->allocate();
-            _reshape_weights.run();
+            if(_transpose_1x1_weights)
+            {
+                // Transpose the flat [IFM, OFM] view of the native 1x1 weights
+                _weights_flat.allocator()->import_memory(_original_weights->buffer());
+                _transpose_weights.run();
+                _weights_flat.allocator()->free();
+            }
+            else
+            {
+                _reshape_weights.run();
+            }
             _original_weights->mark_as_unused();
         }
 
         // Prepare GEMM
-        _is_quantized ? _mm_gemmlowp.prepare() : _mm_gemm.prepare();
+        if(_run_indirect)
+        {
+            _mm_gemm_indirect.prepare();
+        }
+        else
+        {
+            _is_quantized ? _mm_gemmlowp.prepare() : _mm_gemm.prepare();
+        }
         if(!_weights_reshaped.is_used())
         {
             _weights_reshaped.allocator()->free();
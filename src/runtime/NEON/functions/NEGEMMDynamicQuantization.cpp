@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NEGEMMDynamicQuantization.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/NEAsymm.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+
+#include <arm_neon.h>
+#include <cmath>
+
+namespace arm_compute
+{
+namespace
+{
+/** Largest quantized magnitude of the symmetric activation quantization */
+constexpr float symmetric_qmax = 127.f;
+
+/** Build a window iterating the tensor row by row, leaving the x dimension to the caller */
+Window make_row_window(const ITensorInfo &info)
+{
+    Window window;
+    window.use_tensor_dimensions(info.tensor_shape());
+    window.set(Window::DimX, Window::Dimension(0, 1, 1));
+    return window;
+}
+
+/** Measure the activation range and derive the symmetric per-tensor scale (abs-max over 127) */
+float compute_symmetric_scale(const ITensor *input)
+{
+    const int    window_end_x = static_cast<int>(input->info()->dimension(0));
+    const Window window       = make_row_window(*input->info());
+
+    float32x4_t vabs_max = vdupq_n_f32(0.f);
+    float       abs_max  = 0.f;
+
+    Iterator in(input, window);
+    execute_window_loop(window, [&](const Coordinates &)
+    {
+        const auto in_ptr = reinterpret_cast<const float *>(in.ptr());
+
+        int x = 0;
+        for(; x <= window_end_x - 4; x += 4)
+        {
+            vabs_max = vmaxq_f32(vabs_max, vabsq_f32(vld1q_f32(in_ptr + x)));
+        }
+        for(; x < window_end_x; ++x)
+        {
+            abs_max = std::max(abs_max, std::fabs(in_ptr[x]));
+        }
+    },
+    in);
+
+    const float32x2_t vmax_2 = vmax_f32(vget_low_f32(vabs_max), vget_high_f32(vabs_max));
+    abs_max                  = std::max(abs_max, std::max(vget_lane_f32(vmax_2, 0), vget_lane_f32(vmax_2, 1)));
+
+    // An all-zero activation carries no information; any scale reproduces it exactly
+    return (abs_max > 0.f) ? abs_max / symmetric_qmax : 1.f;
+}
+
+/** Quantize the F32 activations to QASYMM8_SIGNED with the runtime symmetric scale */
+void quantize_symmetric(const ITensor *input, ITensor *output, const UniformQuantizationInfo &qinfo)
+{
+    const int    window_end_x = static_cast<int>(input->info()->dimension(0));
+    const Window window       = make_row_window(*input->info());
+
+    Iterator in(input, window);
+    Iterator out(output, window);
+    execute_window_loop(window, [&](const Coordinates &)
+    {
+        const auto in_ptr  = reinterpret_cast<const float *>(in.ptr());
+        const auto out_ptr = reinterpret_cast<int8_t *>(out.ptr());
+
+        int x = 0;
+        for(; x <= window_end_x - 16; x += 16)
+        {
+            const float32x4x4_t vin =
+            {
+                {
+                    vld1q_f32(in_ptr + x),
+                    vld1q_f32(in_ptr + x + 4),
+                    vld1q_f32(in_ptr + x + 8),
+                    vld1q_f32(in_ptr + x + 12),
+                }
+            };
+            vst1q_s8(out_ptr + x, vquantize_signed(vin, qinfo));
+        }
+        for(; x < window_end_x; ++x)
+        {
+            out_ptr[x] = quantize_qasymm8_signed(in_ptr[x], qinfo);
+        }
+    },
+    in, out);
+}
+
+/** Dequantize the int32 GEMM result back to F32, adding the optional bias */
+void dequantize_add_bias(const ITensor *input, const ITensor *bias, ITensor *output, float scale)
+{
+    const int         window_end_x = static_cast<int>(input->info()->dimension(0));
+    const Window      window       = make_row_window(*input->info());
+    const float32x4_t vscale       = vdupq_n_f32(scale);
+    const auto        bias_ptr     = (bias != nullptr) ? reinterpret_cast<const float *>(bias->buffer() + bias->info()->offset_first_element_in_bytes()) : nullptr;
+
+    Iterator in(input, window);
+    Iterator out(output, window);
+    execute_window_loop(window, [&](const Coordinates &)
+    {
+        const auto in_ptr  = reinterpret_cast<const int32_t *>(in.ptr());
+        const auto out_ptr = reinterpret_cast<float *>(out.ptr());
+
+        int x = 0;
+        for(; x <= window_end_x - 4; x += 4)
+        {
+            float32x4_t vout = vmulq_f32(vcvtq_f32_s32(vld1q_s32(in_ptr + x)), vscale);
+            if(bias_ptr != nullptr)
+            {
+                vout = vaddq_f32(vout, vld1q_f32(bias_ptr + x));
+            }
+            vst1q_f32(out_ptr + x, vout);
+        }
+        for(; x < window_end_x; ++x)
+        {
+            out_ptr[x] = static_cast<float>(in_ptr[x]) * scale + ((bias_ptr != nullptr) ? bias_ptr[x] : 0.f);
+        }
+    },
+    in, out);
+}
+} // namespace
+
+NEGEMMDynamicQuantization::NEGEMMDynamicQuantization(std::shared_ptr<IMemoryManager> memory_manager)
+    : _memory_group(memory_manager), _mm(), _quantized_a(), _mm_result_s32(), _a(nullptr), _bias(nullptr), _output(nullptr), _b_scale(0.f)
+{
+}
+
+void NEGEMMDynamicQuantization::configure(const ITensor *a, const ITensor *b, const ITensor *bias, ITensor *output)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(a, b, output);
+    ARM_COMPUTE_ERROR_THROW_ON(NEGEMMDynamicQuantization::validate(a->info(), b->info(), bias != nullptr ? bias->info() : nullptr, output->info()));
+
+    _a       = a;
+    _bias    = bias;
+    _output  = output;
+    _b_scale = b->info()->quantization_info().uniform().scale;
+
+    // The scale below is a placeholder; the real one is measured from the activations on every run.
+    // It never reaches the int8 kernels, which only consume the (zero) offsets
+    _quantized_a.allocator()->init(TensorInfo(a->info()->tensor_shape(), 1, DataType::QASYMM8_SIGNED, QuantizationInfo(1.f, 0)));
+    _mm_result_s32.allocator()->init(TensorInfo(output->info()->tensor_shape(), 1, DataType::S32));
+
+    _memory_group.manage(&_quantized_a);
+    _memory_group.manage(&_mm_result_s32);
+
+    _mm.configure(&_quantized_a, b, nullptr, &_mm_result_s32);
+
+    _quantized_a.allocator()->allocate();
+    _mm_result_s32.allocator()->allocate();
+}
+
+Status NEGEMMDynamicQuantization::validate(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *bias, const ITensorInfo *output)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(a, b, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(a, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(b, 1, DataType::QASYMM8_SIGNED, DataType::QSYMM8);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(b->quantization_info().uniform().offset != 0, "Weights must be quantized with a symmetric (zero offset) scale");
+    if(bias != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(bias, 1, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON(bias->num_dimensions() > 1);
+        ARM_COMPUTE_RETURN_ERROR_ON(bias->dimension(0) != output->dimension(0));
+    }
+
+    const TensorInfo quantized_a  = a->clone()->set_data_type(DataType::QASYMM8_SIGNED).set_quantization_info(QuantizationInfo(1.f, 0));
+    const TensorInfo mm_result_s32(output->tensor_shape(), 1, DataType::S32);
+    ARM_COMPUTE_RETURN_ON_ERROR(NEGEMMLowpMatrixMultiplyCore::validate(&quantized_a, b, nullptr, &mm_result_s32));
+
+    return Status{};
+}
+
+void NEGEMMDynamicQuantization::run()
+{
+    prepare();
+
+    MemoryGroupResourceScope scope_mg(_memory_group);
+
+    // Measure the activation range and quantize with the derived scale
+    const float scale = compute_symmetric_scale(_a);
+    _quantized_a.info()->set_quantization_info(QuantizationInfo(scale, 0));
+    quantize_symmetric(_a, &_quantized_a, UniformQuantizationInfo(scale, 0));
+
+    _mm.run();
+
+    // Fold both scales into the dequantization of the int32 accumulators
+    dequantize_add_bias(&_mm_result_s32, _bias, _output, scale * _b_scale);
+}
+
+void NEGEMMDynamicQuantization::prepare()
+{
+    _mm.prepare();
+}
+} // namespace arm_compute
@@ -28,11 +28,61 @@
 #include "arm_compute/core/NEON/kernels/NEGEMMLowpQuantizeDownInt32ToInt16ScaleByFixedPointKernel.h"
 #include "arm_compute/core/NEON/kernels/NEGEMMLowpQuantizeDownInt32ToInt8ScaleByFixedPointKernel.h"
 #include "arm_compute/core/NEON/kernels/NEGEMMLowpQuantizeDownInt32ToUint8ScaleByFixedPointKernel.h"
+#include "arm_compute/core/Utils.h"
 #include "arm_compute/core/Validate.h"
 #include "support/MemorySupport.h"
 
+#include <algorithm>
+
 namespace arm_compute
 {
+namespace
+{
+/** Check if an activation can be folded into the output stage clamp
+ *
+ * @param[in] act_info  Activation to fuse
+ * @param[in] data_type Output data type
+ *
+ * @return True if the activation is disabled or maps onto a [min, max] range on the given data type
+ */
+bool is_activation_fusable(const ActivationLayerInfo &act_info, DataType data_type)
+{
+    if(!act_info.enabled())
+    {
+        return true;
+    }
+    const bool is_bounded_act = act_info.activation() == ActivationLayerInfo::ActivationFunction::RELU
+                                || act_info.activation() == ActivationLayerInfo::ActivationFunction::BOUNDED_RELU
+                                || act_info.activation() == ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU;
+    return is_bounded_act && is_data_type_quantized_asymmetric(data_type);
+}
+
+/** Fold the requested activation into the requantization bounds
+ *
+ * The quantize-down kernels already clamp each value to [gemmlowp_min_bound, gemmlowp_max_bound],
+ * so a bounded activation costs nothing extra once expressed in the quantized domain.
+ *
+ * @param[in] info   Output stage info, possibly carrying an activation
+ * @param[in] output Output tensor info
+ *
+ * @return A copy of @p info with the activation folded into the bounds
+ */
+GEMMLowpOutputStageInfo fuse_activation_into_bounds(const GEMMLowpOutputStageInfo &info, const ITensorInfo *output)
+{
+    GEMMLowpOutputStageInfo fused = info;
+    if(info.activation_info.enabled() && is_data_type_quantized_asymmetric(output->data_type()))
+    {
+        int32_t min_activation = 0;
+        int32_t max_activation = 0;
+        std::tie(min_activation, max_activation) = get_quantized_activation_min_max(info.activation_info, output->data_type(), output->quantization_info().uniform());
+        fused.gemmlowp_min_bound                 = std::max(fused.gemmlowp_min_bound, min_activation);
+        fused.gemmlowp_max_bound                 = std::min(fused.gemmlowp_max_bound, max_activation);
+        fused.activation_info                    = ActivationLayerInfo();
+    }
+    return fused;
+}
+} // namespace
+
 void NEGEMMLowpQuantizeDownInt32ToUint8ScaleByFixedPoint::configure(const ITensor *input, const ITensor *bias, ITensor *output, int result_fixedpoint_multiplier, int result_shift,
                                                                     int result_offset_after_shift, int min, int max)
 {
@@ -77,30 +127,34 @@ void NEGEMMLowpOutputStage::configure(const ITensor *input, const ITensor *bias,
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
     ARM_COMPUTE_ERROR_THROW_ON(NEGEMMLowpOutputStage::validate(input->info(), bias != nullptr ? bias->info() : nullptr, output->info(), info));
 
-    switch(info.type)
+    // Fold any fused activation into the requantization bounds; the kernel keeps a pointer
+    // to the info so the fused copy has to outlive configuration
+    _info = fuse_activation_into_bounds(info, output->info());
+
+    switch(_info.type)
     {
         case GEMMLowpOutputStageType::QUANTIZE_DOWN_FIXEDPOINT:
         {
-            switch(info.output_data_type)
+            switch(_info.output_data_type)
             {
                 case DataType::QASYMM8:
                 {
                     auto k = arm_compute::support::cpp14::make_unique<NEGEMMLowpQuantizeDownInt32ToUint8ScaleByFixedPointKernel>();
-                    k->configure(input, bias, output, info.gemmlowp_multiplier, info.gemmlowp_shift, info.gemmlowp_offset, info.gemmlowp_min_bound, info.gemmlowp_max_bound);
+                    k->configure(input, bias, output, _info.gemmlowp_multiplier, _info.gemmlowp_shift, _info.gemmlowp_offset, _info.gemmlowp_min_bound, _info.gemmlowp_max_bound);
                     _kernel = std::move(k);
                     break;
                 }
                 case DataType::QASYMM8_SIGNED:
                 {
                     auto k = arm_compute::support::cpp14::make_unique<NEGEMMLowpQuantizeDownInt32ToInt8ScaleByFixedPointKernel>();
-                    k->configure(input, bias, output, info.gemmlowp_multiplier, info.gemmlowp_shift, info.gemmlowp_offset, info.gemmlowp_min_bound, info.gemmlowp_max_bound);
+                    k->configure(input, bias, output, _info.gemmlowp_multiplier, _info.gemmlowp_shift, _info.gemmlowp_offset, _info.gemmlowp_min_bound, _info.gemmlowp_max_bound);
                     _kernel = std::move(k);
                     break;
                 }
                 case DataType::QSYMM16:
                 {
                     auto k = arm_compute::support::cpp14::make_unique<NEGEMMLowpQuantizeDownInt32ToInt16ScaleByFixedPointKernel>();
-                    k->configure(input, bias, output, info.gemmlowp_multiplier, info.gemmlowp_shift, info.gemmlowp_min_bound, info.gemmlowp_max_bound);
+                    k->configure(input, bias, output, _info.gemmlowp_multiplier, _info.gemmlowp_shift, _info.gemmlowp_min_bound, _info.gemmlowp_max_bound);
                     _kernel = std::move(k);
                     break;
                 }
@@ -114,13 +168,13 @@ void NEGEMMLowpOutputStage::configure(const ITensor *input, const ITensor *bias,
         }
         case GEMMLowpOutputStageType::QUANTIZE_DOWN:
         {
-            switch(info.output_data_type)
+            switch(_info.output_data_type)
             {
                 case DataType::QASYMM8:
                 case DataType::QASYMM8_SIGNED:
                 {
                     auto k = arm_compute::support::cpp14::make_unique<NEGEMMLowpQuantizeDownInt32ScaleKernel>();
-                    k->configure(input, bias, output, &info);
+                    k->configure(input, bias, output, &_info);
                     _kernel = std::move(k);
                     break;
                 }
@@ -144,19 +198,22 @@ Status NEGEMMLowpOutputStage::validate(const ITensorInfo *input, const ITensorIn
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::QASYMM8, DataType::QASYMM8_SIGNED, DataType::QSYMM16);
 
     ARM_COMPUTE_RETURN_ERROR_ON((info.type != GEMMLowpOutputStageType::QUANTIZE_DOWN) && (info.type != GEMMLowpOutputStageType::QUANTIZE_DOWN_FIXEDPOINT));
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!is_activation_fusable(info.activation_info, output->data_type()), "Activation cannot be folded into the output stage clamp.");
+
+    const GEMMLowpOutputStageInfo fused_info = fuse_activation_into_bounds(info, output);
 
-    switch(info.type)
+    switch(fused_info.type)
     {
         case GEMMLowpOutputStageType::QUANTIZE_DOWN_FIXEDPOINT:
         {
             switch(output->data_type())
             {
                 case DataType::QASYMM8:
-                    return NEGEMMLowpQuantizeDownInt32ToUint8ScaleByFixedPointKernel::validate(input, bias, output, info.gemmlowp_min_bound, info.gemmlowp_max_bound);
+                    return NEGEMMLowpQuantizeDownInt32ToUint8ScaleByFixedPointKernel::validate(input, bias, output, fused_info.gemmlowp_min_bound, fused_info.gemmlowp_max_bound);
                 case DataType::QASYMM8_SIGNED:
-                    return NEGEMMLowpQuantizeDownInt32ToInt8ScaleByFixedPointKernel::validate(input, bias, output, info.gemmlowp_min_bound, info.gemmlowp_max_bound);
+                    return NEGEMMLowpQuantizeDownInt32ToInt8ScaleByFixedPointKernel::validate(input, bias, output, fused_info.gemmlowp_min_bound, fused_info.gemmlowp_max_bound);
                 case DataType::QSYMM16:
-                    return NEGEMMLowpQuantizeDownInt32ToInt16ScaleByFixedPointKernel::validate(input, bias, output, info.gemmlowp_min_bound, info.gemmlowp_max_bound);
+                    return NEGEMMLowpQuantizeDownInt32ToInt16ScaleByFixedPointKernel::validate(input, bias, output, fused_info.gemmlowp_min_bound, fused_info.gemmlowp_max_bound);
                 default:
                     return ARM_COMPUTE_CREATE_ERROR(ErrorCode::RUNTIME_ERROR, "Unsupported output data type.");
             }
@@ -167,7 +224,7 @@ Status NEGEMMLowpOutputStage::validate(const ITensorInfo *input, const ITensorIn
             {
                 case DataType::QASYMM8:
                 case DataType::QASYMM8_SIGNED:
-                    return NEGEMMLowpQuantizeDownInt32ScaleKernel::validate(input, bias, output, &info);
+                    return NEGEMMLowpQuantizeDownInt32ScaleKernel::validate(input, bias, output, &fused_info);
                 default:
                     return ARM_COMPUTE_CREATE_ERROR(ErrorCode::RUNTIME_ERROR, "Unsupported output data type.");
             }
@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NEIncrementalMinMaxMean.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace arm_compute
+{
+NEIncrementalMinMaxMean::NEIncrementalMinMaxMean()
+    : _input(nullptr), _min(nullptr), _max(nullptr), _mean(nullptr), _tile_size(0), _tiles_x(0), _tiles_y(0), _tiles()
+{
+}
+
+void NEIncrementalMinMaxMean::configure(const IImage *input, void *min, void *max, float *mean, unsigned int tile_size)
+{
+    ARM_COMPUTE_ERROR_ON_TENSOR_NOT_2D(input);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8, DataType::S16, DataType::F32);
+    ARM_COMPUTE_ERROR_ON(nullptr == min);
+    ARM_COMPUTE_ERROR_ON(nullptr == max);
+    ARM_COMPUTE_ERROR_ON(nullptr == mean);
+    ARM_COMPUTE_ERROR_ON(tile_size == 0);
+
+    _input     = input;
+    _min       = min;
+    _max       = max;
+    _mean      = mean;
+    _tile_size = tile_size;
+    _tiles_x   = (input->info()->dimension(0) + tile_size - 1) / tile_size;
+    _tiles_y   = (input->info()->dimension(1) + tile_size - 1) / tile_size;
+    _tiles.assign(_tiles_x * _tiles_y, TileStats{});
+}
+
+template <typename T>
+void NEIncrementalMinMaxMean::evaluate_tile(TileStats &tile, unsigned int x0, unsigned int y0, unsigned int x1, unsigned int y1)
+{
+    const uint8_t *base     = _input->buffer() + _input->info()->offset_first_element_in_bytes();
+    const size_t   stride_y = _input->info()->strides_in_bytes().y();
+
+    T      tile_min = std::numeric_limits<T>::max();
+    T      tile_max = std::numeric_limits<T>::lowest();
+    double tile_sum = 0.0;
+
+    for(unsigned int y = y0; y < y1; ++y)
+    {
+        const auto row = reinterpret_cast<const T *>(base + y * stride_y);
+        for(unsigned int x = x0; x < x1; ++x)
+        {
+            const T pixel = row[x];
+            tile_min      = std::min(pixel, tile_min);
+            tile_max      = std::max(pixel, tile_max);
+            tile_sum += pixel;
+        }
+    }
+
+    tile.min = tile_min;
+    tile.max = tile_max;
+    tile.sum = tile_sum;
+}
+
+void NEIncrementalMinMaxMean::evaluate_tiles(unsigned int tile_x0, unsigned int tile_y0, unsigned int tile_x1, unsigned int tile_y1)
+{
+    const unsigned int width  = _input->info()->dimension(0);
+    const unsigned int height = _input->info()->dimension(1);
+
+    for(unsigned int ty = tile_y0; ty <= tile_y1; ++ty)
+    {
+        for(unsigned int tx = tile_x0; tx <= tile_x1; ++tx)
+        {
+            TileStats         &tile = _tiles[ty * _tiles_x + tx];
+            const unsigned int x0   = tx * _tile_size;
+            const unsigned int y0   = ty * _tile_size;
+            const unsigned int x1   = std::min(x0 + _tile_size, width);
+            const unsigned int y1   = std::min(y0 + _tile_size, height);
+
+            switch(_input->info()->data_type())
+            {
+                case DataType::U8:
+                    evaluate_tile<uint8_t>(tile, x0, y0, x1, y1);
+                    break;
+                case DataType::S16:
+                    evaluate_tile<int16_t>(tile, x0, y0, x1, y1);
+                    break;
+                case DataType::F32:
+                    evaluate_tile<float>(tile, x0, y0, x1, y1);
+                    break;
+                default:
+                    ARM_COMPUTE_ERROR("Unsupported data type");
+                    break;
+            }
+        }
+    }
+}
+
+void NEIncrementalMinMaxMean::reduce_tiles()
+{
+    float  frame_min = _tiles.front().min;
+    float  frame_max = _tiles.front().max;
+    double frame_sum = 0.0;
+
+    for(const auto &tile : _tiles)
+    {
+        frame_min = std::min(tile.min, frame_min);
+        frame_max = std::max(tile.max, frame_max);
+        frame_sum += tile.sum;
+    }
+
+    if(_input->info()->data_type() == DataType::F32)
+    {
+        *static_cast<float *>(_min) = frame_min;
+        *static_cast<float *>(_max) = frame_max;
+    }
+    else
+    {
+        *static_cast<int32_t *>(_min) = static_cast<int32_t>(frame_min);
+        *static_cast<int32_t *>(_max) = static_cast<int32_t>(frame_max);
+    }
+    *_mean = static_cast<float>(frame_sum / (static_cast<double>(_input->info()->dimension(0)) * _input->info()->dimension(1)));
+}
+
+void NEIncrementalMinMaxMean::update(const std::vector<Rectangle> &dirty_regions)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_tiles.empty(), "The function is not configured");
+
+    const unsigned int width  = _input->info()->dimension(0);
+    const unsigned int height = _input->info()->dimension(1);
+
+    for(const Rectangle &region : dirty_regions)
+    {
+        if(region.width == 0 || region.height == 0 || region.x >= width || region.y >= height)
+        {
+            continue;
+        }
+        // Clamp the region to the frame and convert its span to an inclusive tile range
+        const unsigned int x1      = std::min<unsigned int>(region.x + region.width, width) - 1;
+        const unsigned int y1      = std::min<unsigned int>(region.y + region.height, height) - 1;
+        const unsigned int tile_x0 = region.x / _tile_size;
+        const unsigned int tile_y0 = region.y / _tile_size;
+        const unsigned int tile_x1 = x1 / _tile_size;
+        const unsigned int tile_y1 = y1 / _tile_size;
+
+        evaluate_tiles(tile_x0, tile_y0, tile_x1, tile_y1);
+    }
+
+    reduce_tiles();
+}
+
+void NEIncrementalMinMaxMean::run()
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_tiles.empty(), "The function is not configured");
+
+    evaluate_tiles(0, 0, _tiles_x - 1, _tiles_y - 1);
+    reduce_tiles();
+}
+} // namespace arm_compute
@@ -28,15 +28,15 @@
 
 namespace arm_compute
 {
-void NEMeanStdDevNormalizationLayer::configure(ITensor *input, ITensor *output, float epsilon)
+void NEMeanStdDevNormalizationLayer::configure(ITensor *input, ITensor *output, float epsilon, const ITensor *gamma, const ITensor *beta)
 {
     auto k = arm_compute::support::cpp14::make_unique<NEMeanStdDevNormalizationKernel>();
-    k->configure(input, output, epsilon);
+    k->configure(input, output, epsilon, gamma, beta);
     _kernel = std::move(k);
 }
 
-Status NEMeanStdDevNormalizationLayer::validate(const ITensorInfo *input, const ITensorInfo *output, float epsilon)
+Status NEMeanStdDevNormalizationLayer::validate(const ITensorInfo *input, const ITensorInfo *output, float epsilon, const ITensorInfo *gamma, const ITensorInfo *beta)
 {
-    return NEMeanStdDevNormalizationKernel::validate(input, output, epsilon);
+    return NEMeanStdDevNormalizationKernel::validate(input, output, epsilon, gamma, beta);
 }
 } // namespace arm_compute
@@ -21,21 +21,18 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
-#include "arm_compute/core/TracePoint.h"
-#include "arm_compute/runtime/CL/CLArray.h"
-#include "arm_compute/runtime/CL/CLPyramid.h"
-#include "arm_compute/runtime/CL/functions/CLLSTMLayer.h"
-#include "utils/TypePrinter.h"
+#include "arm_compute/runtime/NEON/functions/NEMultiChannelTableLookup.h"
 
-#include <cstdio>
-#include <vector>
+#include "arm_compute/core/NEON/kernels/NEMultiChannelTableLookupKernel.h"
+#include "support/MemorySupport.h"
 
-namespace arm_compute
+#include <utility>
+
+using namespace arm_compute;
+
+void NEMultiChannelTableLookup::configure(const ITensor *input, const ILut *lut_r, const ILut *lut_g, const ILut *lut_b, ITensor *output)
 {
-TRACE_TO_STRING(CLPyramid)
-TRACE_TO_STRING(LSTMParams<ICLTensor>)
-TRACE_TO_STRING(CLCoordinates2DArray)
-CONST_PTR_CLASS(CLPyramid)
-CONST_PTR_CLASS(LSTMParams<ICLTensor>)
-CONST_PTR_CLASS(CLCoordinates2DArray)
-} // namespace arm_compute
+    auto k = arm_compute::support::cpp14::make_unique<NEMultiChannelTableLookupKernel>();
+    k->configure(input, lut_r, lut_g, lut_b, output);
+    _kernel = std::move(k);
+}
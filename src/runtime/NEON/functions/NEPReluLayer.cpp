@@ -33,9 +33,9 @@ namespace experimental
 {
 void NEPRelu::configure(const ITensorInfo *input, const ITensorInfo *alpha, ITensorInfo *output)
 {
-    auto k = arm_compute::support::cpp14::make_unique<NEArithmeticOperationKernel>();
-    k->configure(ArithmeticOperation::PRELU, input, alpha, output);
-    _kernel = std::move(k);
+    KernelCacheKey key("NEArithmeticOperationKernel");
+    key.add_value(ArithmeticOperation::PRELU).add_tensor_info(input).add_tensor_info(alpha).add_tensor_info(output);
+    create_kernel<NEArithmeticOperationKernel>(key, ArithmeticOperation::PRELU, input, alpha, output);
 }
 
 Status NEPRelu::validate(const ITensorInfo *input, const ITensorInfo *alpha, const ITensorInfo *output)
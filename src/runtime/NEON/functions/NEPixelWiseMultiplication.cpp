@@ -37,9 +37,10 @@ void NEPixelWiseMultiplication::configure(ITensorInfo *input1, ITensorInfo *inpu
                                           const ActivationLayerInfo &act_info)
 {
     ARM_COMPUTE_UNUSED(act_info);
-    auto k = arm_compute::support::cpp14::make_unique<NEPixelWiseMultiplicationKernel>();
-    k->configure(input1, input2, output, scale, overflow_policy, rounding_policy);
-    _kernel = std::move(k);
+    KernelCacheKey key("NEPixelWiseMultiplicationKernel");
+    key.add_tensor_info(input1).add_tensor_info(input2).add_tensor_info(output);
+    key.add_value(scale).add_value(overflow_policy).add_value(rounding_policy);
+    create_kernel<NEPixelWiseMultiplicationKernel>(key, input1, input2, output, scale, overflow_policy, rounding_policy);
 }
 Status NEPixelWiseMultiplication::validate(const ITensorInfo *input1, const ITensorInfo *input2, const ITensorInfo *output, float scale, ConvertPolicy overflow_policy, RoundingPolicy rounding_policy,
                                            const ActivationLayerInfo &act_info)
@@ -47,13 +48,18 @@ Status NEPixelWiseMultiplication::validate(const ITensorInfo *input1, const ITen
     ARM_COMPUTE_RETURN_ERROR_ON(act_info.enabled());
     return NEPixelWiseMultiplicationKernel::validate(input1, input2, output, scale, overflow_policy, rounding_policy);
 }
+bool NEPixelWiseMultiplication::supports_in_place() const
+{
+    // The multiplication kernel reads all inputs of an element before writing it
+    return true;
+}
 
 void NEComplexPixelWiseMultiplication::configure(ITensorInfo *input1, ITensorInfo *input2, ITensorInfo *output, const ActivationLayerInfo &act_info)
 {
     ARM_COMPUTE_UNUSED(act_info);
-    auto k = arm_compute::support::cpp14::make_unique<NEComplexPixelWiseMultiplicationKernel>();
-    k->configure(input1, input2, output);
-    _kernel = std::move(k);
+    KernelCacheKey key("NEComplexPixelWiseMultiplicationKernel");
+    key.add_tensor_info(input1).add_tensor_info(input2).add_tensor_info(output);
+    create_kernel<NEComplexPixelWiseMultiplicationKernel>(key, input1, input2, output);
 }
 
 Status NEComplexPixelWiseMultiplication::validate(const ITensorInfo *input1, const ITensorInfo *input2, const ITensorInfo *output, const ActivationLayerInfo &act_info)
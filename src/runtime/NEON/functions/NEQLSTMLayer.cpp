@@ -29,13 +29,32 @@
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/core/utils/misc/InfoHelpers.h"
 #include "arm_compute/core/utils/quantization/AsymmHelpers.h"
+#include "arm_compute/core/utils/quantization/QuantizationParamsCache.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "support/MemorySupport.h"
 
 namespace arm_compute
 {
 using namespace arm_compute::utils::info_helpers;
 namespace
 {
+/** Copy a gate's transposed weights into the fused weights tensor at the given unit offset
+ *
+ * The fused tensor concatenates the transposed gate weights along the unit (x) dimension,
+ * so one wide matrix multiplication can produce all gate pre-activations at once.
+ */
+void pack_transposed_weights(const Tensor &src, Tensor &dst, int unit_offset)
+{
+    Window window;
+    window.use_tensor_dimensions(src.info()->tensor_shape());
+    window.set(Window::DimX, Window::Dimension(0, 1, 1));
+    const size_t row_size = src.info()->dimension(0) * src.info()->element_size();
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        memcpy(dst.ptr_to_element(Coordinates(unit_offset, id.y())), src.ptr_to_element(Coordinates(0, id.y())), row_size);
+    });
+}
+
 Status validate_mm(GEMMLowpOutputStageInfo &gemmlowp_info, const ITensorInfo *mm_input, const ITensorInfo *mm_weights, const ITensorInfo *bias,
                    float gemmlowp_scale, const TensorInfo *mm_res_info, const TensorInfo *outstage_tensor_info)
 {
@@ -96,11 +115,23 @@ void NEQLSTMLayer::configure_mm(NEGEMMLowpMatrixMultiplyCore &mm, NEGEMMLowpOutp
     mm.configure(mm_input, mm_weights, nullptr, mm_res);
 
     // Configure output stage
-    quantization::calculate_quantized_multiplier(gemmlowp_scale, &gemmlowp_info.gemmlowp_multiplier, &gemmlowp_info.gemmlowp_shift);
+    quantization::QuantizationParamsCache::get().quantized_multiplier(gemmlowp_scale, &gemmlowp_info.gemmlowp_multiplier, &gemmlowp_info.gemmlowp_shift);
     outstage.configure(mm_res, bias, outstage_res, gemmlowp_info);
     mm_res->allocator()->allocate();
 }
 
+void NEQLSTMLayer::configure_gate_outstage(NEGEMMLowpOutputStage &outstage, GEMMLowpOutputStageInfo &gemmlowp_info,
+                                           const ITensor *mm_res, const ITensor *bias, Tensor *outstage_res,
+                                           float gemmlowp_scale, const TensorInfo &outstage_tensor_info)
+{
+    _memory_group.manage(outstage_res);
+    outstage_res->allocator()->init(outstage_tensor_info);
+
+    // Configure output stage on the gate's slice of the fused matrix-multiplication result
+    quantization::QuantizationParamsCache::get().quantized_multiplier(gemmlowp_scale, &gemmlowp_info.gemmlowp_multiplier, &gemmlowp_info.gemmlowp_shift);
+    outstage.configure(mm_res, bias, outstage_res, gemmlowp_info);
+}
+
 void NEQLSTMLayer::configure(const ITensor *input,
                              const ITensor *input_to_forget_weights, const ITensor *input_to_cell_weights, const ITensor *input_to_output_weights,
                              const ITensor *recurrent_to_forget_weights, const ITensor *recurrent_to_cell_weights, const ITensor *recurrent_to_output_weights,
@@ -212,6 +243,42 @@ void NEQLSTMLayer::configure(const ITensor *input,
         _transpose_projection_weights.configure(_projection_weights, &_projection_weights_transposed);
     }
 
+    // Batch the gate matrix multiplications: the input-to-gate products share the input and the
+    // recurrent-to-gate products share output_state_in, so the transposed gate weights are
+    // concatenated along the unit dimension (packed at prepare time) and each LHS is multiplied
+    // once. The weights are QSYMM8 with a zero offset, so the wide product is numerically
+    // identical to the per-gate ones; the gate-specific scales are applied by the per-gate
+    // output stages on slices of the wide result
+    const int        input_size = input->info()->dimension(0);
+    const int        num_gates  = _has_cifg ? 3 : 4;
+    const TensorInfo fused_mm_out_info(TensorShape(num_gates * num_units, batch_size), 1, DataType::S32);
+
+    _input_weights_fused.allocator()->init(TensorInfo(TensorShape(num_gates * num_units, input_size), 1, input_to_forget_weights->info()->data_type(),
+                                                      input_to_forget_weights->info()->quantization_info()));
+    _recurrent_weights_fused.allocator()->init(TensorInfo(TensorShape(num_gates * num_units, output_size), 1, recurrent_to_forget_weights->info()->data_type(),
+                                                          recurrent_to_forget_weights->info()->quantization_info()));
+    _mm_input_gates_res.allocator()->init(fused_mm_out_info);
+    _mm_recurrent_gates_res.allocator()->init(fused_mm_out_info);
+
+    _memory_group.manage(&_mm_input_gates_res);
+    _memory_group.manage(&_mm_recurrent_gates_res);
+    _mm_input_gates.configure(input, &_input_weights_fused, nullptr, &_mm_input_gates_res);
+    _mm_recurrent_gates.configure(output_state_in, &_recurrent_weights_fused, nullptr, &_mm_recurrent_gates_res);
+
+    // Per-gate views on the wide results; gate order: forget, cell, output[, input]
+    const TensorShape gate_mm_shape(num_units, batch_size);
+    _mm_input_to_forget_slice     = support::cpp14::make_unique<SubTensor>(&_mm_input_gates_res, gate_mm_shape, Coordinates(0 * num_units, 0));
+    _mm_recurrent_to_forget_slice = support::cpp14::make_unique<SubTensor>(&_mm_recurrent_gates_res, gate_mm_shape, Coordinates(0 * num_units, 0));
+    _mm_input_to_cell_slice       = support::cpp14::make_unique<SubTensor>(&_mm_input_gates_res, gate_mm_shape, Coordinates(1 * num_units, 0));
+    _mm_recurrent_to_cell_slice   = support::cpp14::make_unique<SubTensor>(&_mm_recurrent_gates_res, gate_mm_shape, Coordinates(1 * num_units, 0));
+    _mm_input_to_output_slice     = support::cpp14::make_unique<SubTensor>(&_mm_input_gates_res, gate_mm_shape, Coordinates(2 * num_units, 0));
+    _mm_recurrent_to_output_slice = support::cpp14::make_unique<SubTensor>(&_mm_recurrent_gates_res, gate_mm_shape, Coordinates(2 * num_units, 0));
+    if(!_has_cifg)
+    {
+        _mm_input_to_input_slice     = support::cpp14::make_unique<SubTensor>(&_mm_input_gates_res, gate_mm_shape, Coordinates(3 * num_units, 0));
+        _mm_recurrent_to_input_slice = support::cpp14::make_unique<SubTensor>(&_mm_recurrent_gates_res, gate_mm_shape, Coordinates(3 * num_units, 0));
+    }
+
     GEMMLowpOutputStageInfo gemmlowp_info;
     gemmlowp_info.type               = GEMMLowpOutputStageType::QUANTIZE_DOWN_FIXEDPOINT;
     gemmlowp_info.gemmlowp_min_bound = std::numeric_limits<int16_t>::lowest();
@@ -222,16 +289,14 @@ void NEQLSTMLayer::configure(const ITensor *input,
     // Forget gate.
     const TensorInfo forget_gate_outstage_info(mm_out_info.tensor_shape(), 1, DataType::QSYMM16, QuantizationInfo(lstm_params.forget_intermediate_scale(), 0));
     const float      input_to_forget_scale = input_to_forget_weights->info()->quantization_info().uniform().scale * qinput.scale / lstm_params.forget_intermediate_scale();
-    configure_mm(_mm_input_to_forget, _input_to_forget_outstage, gemmlowp_info,
-                 input, &_input_to_forget_weights_transposed, &_input_to_forget_eff_bias,
-                 &_mm_input_to_forget_res, &_input_to_forget_outstage_res, input_to_forget_scale,
-                 mm_out_info, forget_gate_outstage_info);
+    configure_gate_outstage(_input_to_forget_outstage, gemmlowp_info,
+                            _mm_input_to_forget_slice.get(), &_input_to_forget_eff_bias,
+                            &_input_to_forget_outstage_res, input_to_forget_scale, forget_gate_outstage_info);
 
     const float recurrent_to_forget_scale = recurrent_to_forget_weights->info()->quantization_info().uniform().scale * qoutput_state_in.scale / lstm_params.forget_intermediate_scale();
-    configure_mm(_mm_recurrent_to_forget, _recurrent_to_forget_outstage, gemmlowp_info,
-                 output_state_in, &_recurrent_to_forget_weights_transposed, &_recurrent_to_forget_eff_bias,
-                 &_mm_recurrent_to_forget_res, &_recurrent_to_forget_outstage_res, recurrent_to_forget_scale,
-                 mm_out_info, forget_gate_outstage_info);
+    configure_gate_outstage(_recurrent_to_forget_outstage, gemmlowp_info,
+                            _mm_recurrent_to_forget_slice.get(), &_recurrent_to_forget_eff_bias,
+                            &_recurrent_to_forget_outstage_res, recurrent_to_forget_scale, forget_gate_outstage_info);
 
     _accumulate_input_recurrent_forget.configure(&_input_to_forget_outstage_res, &_recurrent_to_forget_outstage_res, &_recurrent_to_forget_outstage_res, ConvertPolicy::SATURATE);
     _input_to_forget_outstage_res.allocator()->allocate();
@@ -244,7 +309,7 @@ void NEQLSTMLayer::configure(const ITensor *input,
         _cell_to_forget_outstage_res.allocator()->init(TensorInfo(_mul_cell_to_forget_res.info()->tensor_shape(), 1, DataType::QSYMM16, QuantizationInfo(lstm_params.forget_intermediate_scale(), 0)));
         _memory_group.manage(&_cell_to_forget_outstage_res);
         const float cell_to_forget_scale = std::pow(2, cell_shift) * lstm_params.cell_to_forget_weights()->info()->quantization_info().uniform().scale / lstm_params.forget_intermediate_scale();
-        quantization::calculate_quantized_multiplier(cell_to_forget_scale, &gemmlowp_info.gemmlowp_multiplier, &gemmlowp_info.gemmlowp_shift);
+        quantization::QuantizationParamsCache::get().quantized_multiplier(cell_to_forget_scale, &gemmlowp_info.gemmlowp_multiplier, &gemmlowp_info.gemmlowp_shift);
         _cell_to_forget_outstage.configure(&_mul_cell_to_forget_res, nullptr, &_cell_to_forget_outstage_res, gemmlowp_info);
         _mul_cell_to_forget_res.allocator()->allocate();
         _accumulate_cell_forget.configure(&_recurrent_to_forget_outstage_res, &_cell_to_forget_outstage_res, &_recurrent_to_forget_outstage_res, ConvertPolicy::SATURATE);
@@ -272,16 +337,14 @@ void NEQLSTMLayer::configure(const ITensor *input,
     // Modulation gate.
     const TensorInfo cell_outstage_info(mm_out_info.tensor_shape(), 1, DataType::QSYMM16, QuantizationInfo(lstm_params.cell_intermediate_scale(), 0));
     const float      input_to_cell_scale = input_to_cell_weights->info()->quantization_info().uniform().scale * qinput.scale / lstm_params.cell_intermediate_scale();
-    configure_mm(_mm_input_to_cell, _input_to_cell_outstage, gemmlowp_info,
-                 input, &_input_to_cell_weights_transposed, &_input_to_cell_eff_bias,
-                 &_mm_input_to_cell_res, &_input_to_cell_outstage_res, input_to_cell_scale,
-                 mm_out_info, cell_outstage_info);
+    configure_gate_outstage(_input_to_cell_outstage, gemmlowp_info,
+                            _mm_input_to_cell_slice.get(), &_input_to_cell_eff_bias,
+                            &_input_to_cell_outstage_res, input_to_cell_scale, cell_outstage_info);
 
     const float recurrent_to_cell_scale = recurrent_to_cell_weights->info()->quantization_info().uniform().scale * qoutput_state_in.scale / lstm_params.cell_intermediate_scale();
-    configure_mm(_mm_recurrent_to_cell, _recurrent_to_cell_outstage, gemmlowp_info,
-                 output_state_in, &_recurrent_to_cell_weights_transposed, &_recurrent_to_cell_eff_bias,
-                 &_mm_recurrent_to_cell_res, &_recurrent_to_cell_outstage_res, recurrent_to_cell_scale,
-                 mm_out_info, cell_outstage_info);
+    configure_gate_outstage(_recurrent_to_cell_outstage, gemmlowp_info,
+                            _mm_recurrent_to_cell_slice.get(), &_recurrent_to_cell_eff_bias,
+                            &_recurrent_to_cell_outstage_res, recurrent_to_cell_scale, cell_outstage_info);
 
     _accumulate_input_recurrent_modulation.configure(&_input_to_cell_outstage_res, &_recurrent_to_cell_outstage_res, &_recurrent_to_cell_outstage_res, ConvertPolicy::SATURATE);
     _input_to_cell_outstage_res.allocator()->allocate();
@@ -316,16 +379,14 @@ void NEQLSTMLayer::configure(const ITensor *input,
     {
         const TensorInfo input_outstage_info(TensorShape(num_units, batch_size), 1, DataType::QSYMM16, QuantizationInfo(lstm_params.input_intermediate_scale(), 0));
         const float      input_to_input_scale = _input_to_input_weights->info()->quantization_info().uniform().scale * qinput.scale / lstm_params.input_intermediate_scale();
-        configure_mm(_mm_input_to_input, _input_to_input_outstage, gemmlowp_info,
-                     input, &_input_to_input_weights_transposed, &_input_to_input_eff_bias,
-                     &_mm_input_to_input_res, &_input_to_input_outstage_res, input_to_input_scale,
-                     mm_out_info, input_outstage_info);
+        configure_gate_outstage(_input_to_input_outstage, gemmlowp_info,
+                                _mm_input_to_input_slice.get(), &_input_to_input_eff_bias,
+                                &_input_to_input_outstage_res, input_to_input_scale, input_outstage_info);
 
         const float recurrent_to_input_scale = _recurrent_to_input_weights->info()->quantization_info().uniform().scale * qoutput_state_in.scale / lstm_params.input_intermediate_scale();
-        configure_mm(_mm_recurrent_to_input, _recurrent_to_input_outstage, gemmlowp_info,
-                     output_state_in, &_recurrent_to_input_weights_transposed, &_recurrent_to_input_eff_bias,
-                     &_mm_recurrent_to_input_res, &_recurrent_to_input_outstage_res, recurrent_to_input_scale,
-                     mm_out_info, input_outstage_info);
+        configure_gate_outstage(_recurrent_to_input_outstage, gemmlowp_info,
+                                _mm_recurrent_to_input_slice.get(), &_recurrent_to_input_eff_bias,
+                                &_recurrent_to_input_outstage_res, recurrent_to_input_scale, input_outstage_info);
         _accumulate_input_recurrent_input.configure(&_input_to_input_outstage_res, &_recurrent_to_input_outstage_res, &_recurrent_to_input_outstage_res, ConvertPolicy::SATURATE);
         _input_to_input_outstage_res.allocator()->allocate();
 
@@ -335,7 +396,7 @@ void NEQLSTMLayer::configure(const ITensor *input,
             _memory_group.manage(&_mul_cell_to_input_res);
             _pixelwise_mul_cell_to_input.configure(cell_state_in, lstm_params.cell_to_input_weights(), &_mul_cell_to_input_res, 1.f, ConvertPolicy::SATURATE, RoundingPolicy::TO_ZERO);
             const float cell_to_input_scale = std::pow(2, cell_shift) * lstm_params.cell_to_input_weights()->info()->quantization_info().uniform().scale / lstm_params.input_intermediate_scale();
-            quantization::calculate_quantized_multiplier(cell_to_input_scale, &gemmlowp_info.gemmlowp_multiplier, &gemmlowp_info.gemmlowp_shift);
+            quantization::QuantizationParamsCache::get().quantized_multiplier(cell_to_input_scale, &gemmlowp_info.gemmlowp_multiplier, &gemmlowp_info.gemmlowp_shift);
             _cell_to_input_outstage_res.allocator()->init(TensorInfo(_mul_cell_to_input_res.info()->tensor_shape(), 1, DataType::QSYMM16, QuantizationInfo(lstm_params.input_intermediate_scale(), 0)));
             _memory_group.manage(&_cell_to_input_outstage_res);
             _cell_to_input_outstage.configure(&_mul_cell_to_input_res, nullptr, &_cell_to_input_outstage_res, gemmlowp_info);
@@ -376,16 +437,18 @@ void NEQLSTMLayer::configure(const ITensor *input,
     // Output gate.
     const TensorInfo output_outstage_info(TensorShape(num_units, batch_size), 1, DataType::QSYMM16, QuantizationInfo(lstm_params.output_intermediate_scale(), 0));
     const float      input_to_output_scale = input_to_output_weights->info()->quantization_info().uniform().scale * qinput.scale / lstm_params.output_intermediate_scale();
-    configure_mm(_mm_input_to_output, _input_to_output_outstage, gemmlowp_info,
-                 input, &_input_to_output_weights_transposed, &_input_to_output_eff_bias,
-                 &_mm_input_to_output_res, &_input_to_output_outstage_res, input_to_output_scale,
-                 mm_out_info, output_outstage_info);
+    configure_gate_outstage(_input_to_output_outstage, gemmlowp_info,
+                            _mm_input_to_output_slice.get(), &_input_to_output_eff_bias,
+                            &_input_to_output_outstage_res, input_to_output_scale, output_outstage_info);
 
     const float recurrent_to_output_scale = recurrent_to_output_weights->info()->quantization_info().uniform().scale * qoutput_state_in.scale / lstm_params.output_intermediate_scale();
-    configure_mm(_mm_recurrent_to_output, _recurrent_to_output_outstage, gemmlowp_info,
-                 output_state_in, &_recurrent_to_output_weights_transposed, &_recurrent_to_output_eff_bias,
-                 &_mm_recurrent_to_output_res, &_recurrent_to_output_outstage_res, recurrent_to_output_scale,
-                 mm_out_info, output_outstage_info);
+    configure_gate_outstage(_recurrent_to_output_outstage, gemmlowp_info,
+                            _mm_recurrent_to_output_slice.get(), &_recurrent_to_output_eff_bias,
+                            &_recurrent_to_output_outstage_res, recurrent_to_output_scale, output_outstage_info);
+
+    // All gate output stages are configured; close the lifetime of the wide results
+    _mm_input_gates_res.allocator()->allocate();
+    _mm_recurrent_gates_res.allocator()->allocate();
 
     _accumulate_input_recurrent_output.configure(&_recurrent_to_output_outstage_res, &_input_to_output_outstage_res, &_recurrent_to_output_outstage_res, ConvertPolicy::SATURATE);
     _input_to_output_outstage_res.allocator()->allocate();
@@ -399,7 +462,7 @@ void NEQLSTMLayer::configure(const ITensor *input,
         _pixelwise_mul_cell_to_output.configure(cell_state_out, lstm_params.cell_to_output_weights(), &_mul_cell_to_output_res, 1.f, ConvertPolicy::SATURATE, RoundingPolicy::TO_ZERO);
 
         const float cell_to_output_scale = std::pow(2, cell_shift) * lstm_params.cell_to_output_weights()->info()->quantization_info().uniform().scale / lstm_params.output_intermediate_scale();
-        quantization::calculate_quantized_multiplier(cell_to_output_scale, &gemmlowp_info.gemmlowp_multiplier, &gemmlowp_info.gemmlowp_shift);
+        quantization::QuantizationParamsCache::get().quantized_multiplier(cell_to_output_scale, &gemmlowp_info.gemmlowp_multiplier, &gemmlowp_info.gemmlowp_shift);
         _cell_to_output_outstage_res.allocator()->init(TensorInfo(_mul_cell_to_output_res.info()->tensor_shape(), 1, DataType::QSYMM16, QuantizationInfo(lstm_params.output_intermediate_scale(), 0)));
         _memory_group.manage(&_cell_to_output_outstage_res);
         _cell_to_output_outstage.configure(&_mul_cell_to_output_res, nullptr, &_cell_to_output_outstage_res, gemmlowp_info);
@@ -434,7 +497,7 @@ void NEQLSTMLayer::configure(const ITensor *input,
     _output_gate.allocator()->allocate();
     _input_gate.allocator()->allocate();
     const float hidden_state_scale = std::pow(2, -15) / lstm_params.hidden_state_scale() * std::pow(2, -15);
-    quantization::calculate_quantized_multiplier(hidden_state_scale, &gemmlowp_info.gemmlowp_multiplier, &gemmlowp_info.gemmlowp_shift, /* ignore_epsilon */ true);
+    quantization::QuantizationParamsCache::get().quantized_multiplier(hidden_state_scale, &gemmlowp_info.gemmlowp_multiplier, &gemmlowp_info.gemmlowp_shift, /* ignore_epsilon */ true);
     gemmlowp_info.gemmlowp_offset  = lstm_params.hidden_state_zero();
     gemmlowp_info.output_data_type = output_state_in->info()->data_type();
 
@@ -887,11 +950,13 @@ void NEQLSTMLayer::run()
     // Acquire all the temporaries
     MemoryGroupResourceScope scope_mg(_memory_group);
 
+    // Fused gate matrix multiplications: one wide GEMM per LHS produces every gate's
+    // pre-activations, the per-gate output stages below consume slices of the results
+    _mm_input_gates.run();
+    _mm_recurrent_gates.run();
+
     // Forget gate.
-    _mm_input_to_forget.run();
     _input_to_forget_outstage.run();
-
-    _mm_recurrent_to_forget.run();
     _recurrent_to_forget_outstage.run();
     _accumulate_input_recurrent_forget.run();
 
@@ -910,10 +975,7 @@ void NEQLSTMLayer::run()
     _forget_gate_sigmoid.run();
 
     // Modulation gate.
-    _mm_input_to_cell.run();
     _input_to_cell_outstage.run();
-
-    _mm_recurrent_to_cell.run();
     _recurrent_to_cell_outstage.run();
     _accumulate_input_recurrent_modulation.run();
 
@@ -931,9 +993,7 @@ void NEQLSTMLayer::run()
     }
     else
     {
-        _mm_input_to_input.run();
         _input_to_input_outstage.run();
-        _mm_recurrent_to_input.run();
         _recurrent_to_input_outstage.run();
         _accumulate_input_recurrent_input.run();
 
@@ -963,9 +1023,7 @@ void NEQLSTMLayer::run()
     }
 
     // Output gate.
-    _mm_input_to_output.run();
     _input_to_output_outstage.run();
-    _mm_recurrent_to_output.run();
     _recurrent_to_output_outstage.run();
     _accumulate_input_recurrent_output.run();
     if(_has_peephole)
@@ -1040,6 +1098,18 @@ void NEQLSTMLayer::prepare()
         _transpose_recurrent_to_cell_weights.run();
         _transpose_recurrent_to_output_weights.run();
 
+        // Pack the transposed gate weights side by side along the unit dimension for the
+        // fused gate matrix multiplications; gate order: forget, cell, output[, input]
+        const int num_units = _input_to_forget_weights->info()->dimension(1);
+        _input_weights_fused.allocator()->allocate();
+        _recurrent_weights_fused.allocator()->allocate();
+        pack_transposed_weights(_input_to_forget_weights_transposed, _input_weights_fused, 0 * num_units);
+        pack_transposed_weights(_input_to_cell_weights_transposed, _input_weights_fused, 1 * num_units);
+        pack_transposed_weights(_input_to_output_weights_transposed, _input_weights_fused, 2 * num_units);
+        pack_transposed_weights(_recurrent_to_forget_weights_transposed, _recurrent_weights_fused, 0 * num_units);
+        pack_transposed_weights(_recurrent_to_cell_weights_transposed, _recurrent_weights_fused, 1 * num_units);
+        pack_transposed_weights(_recurrent_to_output_weights_transposed, _recurrent_weights_fused, 2 * num_units);
+
         // Precompute effective biases
         if(_has_cifg)
         {
@@ -1056,6 +1126,10 @@ void NEQLSTMLayer::prepare()
             _recurrent_to_input_weights_transposed.allocator()->allocate();
             _transpose_input_to_input_weights.run();
             _transpose_recurrent_to_input_weights.run();
+            pack_transposed_weights(_input_to_input_weights_transposed, _input_weights_fused, 3 * num_units);
+            pack_transposed_weights(_recurrent_to_input_weights_transposed, _recurrent_weights_fused, 3 * num_units);
+            _input_to_input_weights_transposed.allocator()->free();
+            _recurrent_to_input_weights_transposed.allocator()->free();
             _input_to_input_weights->mark_as_unused();
             _recurrent_to_input_weights->mark_as_unused();
         }
@@ -1093,6 +1167,14 @@ void NEQLSTMLayer::prepare()
             }
         }
 
+        // The packed copies are what the GEMMs consume; release the per-gate transposed weights
+        _input_to_forget_weights_transposed.allocator()->free();
+        _input_to_cell_weights_transposed.allocator()->free();
+        _input_to_output_weights_transposed.allocator()->free();
+        _recurrent_to_forget_weights_transposed.allocator()->free();
+        _recurrent_to_cell_weights_transposed.allocator()->free();
+        _recurrent_to_output_weights_transposed.allocator()->free();
+
         // Mark weights as unused
         _input_to_forget_weights->mark_as_unused();
         _input_to_cell_weights->mark_as_unused();
@@ -24,10 +24,15 @@
 #include "arm_compute/runtime/NEON/functions/NEROIAlignLayer.h"
 
 #include "arm_compute/core/NEON/kernels/NEROIAlignLayerKernel.h"
-#include "support/MemorySupport.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
 
 namespace arm_compute
 {
+NEROIAlignLayer::NEROIAlignLayer()
+    : _roi_align_kernel()
+{
+}
+
 Status NEROIAlignLayer::validate(const ITensorInfo *input, const ITensorInfo *rois, ITensorInfo *output, const ROIPoolingLayerInfo &pool_info)
 {
     ARM_COMPUTE_RETURN_ON_ERROR(NEROIAlignLayerKernel::validate(input, rois, output, pool_info));
@@ -37,10 +42,14 @@ Status NEROIAlignLayer::validate(const ITensorInfo *input, const ITensorInfo *ro
 
 void NEROIAlignLayer::configure(const ITensor *input, const ITensor *rois, ITensor *output, const ROIPoolingLayerInfo &pool_info)
 {
-    // Configure ROI pooling kernel
-    auto k = arm_compute::support::cpp14::make_unique<NEROIAlignLayerKernel>();
-    k->configure(input, rois, output, pool_info);
-    _kernel = std::move(k);
+    // Configure ROI align kernel
+    _roi_align_kernel.configure(input, rois, output, pool_info);
 }
 
+void NEROIAlignLayer::run()
+{
+    // Parallelise over the (roi, channel) product: with a modest ROI count and many
+    // feature maps splitting the ROI dimension alone leaves most threads idle
+    NEScheduler::get().schedule(&_roi_align_kernel, IScheduler::Hints(IScheduler::split_dimensions_all));
+}
 } // namespace arm_compute
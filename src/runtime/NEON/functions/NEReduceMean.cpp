@@ -36,7 +36,7 @@ namespace
 } // namespace
 
 NEReduceMean::NEReduceMean(std::shared_ptr<IMemoryManager> memory_manager)
-    : _memory_group(std::move(memory_manager)), _reduction_kernels(), _reduced_outs(), _reshape(), _reduction_ops(), _keep_dims()
+    : _memory_group(std::move(memory_manager)), _reduction_kernels(), _reduced_outs(), _fused_kernel(), _reshape(), _reduction_ops(), _keep_dims(), _fuse(false)
 {
 }
 
@@ -108,38 +108,71 @@ void NEReduceMean::configure(ITensor *input, const Coordinates &reduction_axis,
     auto_init_if_empty(*output->info(), input->info()->clone()->set_tensor_shape(output_shape));
 
     _reduction_ops = reduction_axis.num_dimensions();
-    _reduction_kernels.resize(_reduction_ops);
-    _reduced_outs.resize(_reduction_ops - (keep_dims ? 1 : 0));
-    _keep_dims = keep_dims;
+    _keep_dims     = keep_dims;
 
     Coordinates axis_local = reduction_axis;
     const int   input_dims = input->info()->num_dimensions();
 
     convert_negative_axis(axis_local, input_dims);
 
-    // Perform reduction for every axis
-    for(int i = 0; i < _reduction_ops; ++i)
-    {
-        TensorShape out_shape = i == 0 ? input->info()->tensor_shape() : (&_reduced_outs[i - 1])->info()->tensor_shape();
-        out_shape.set(axis_local[i], 1);
-        auto in = (i == 0) ? input : (&_reduced_outs[i - 1]);
+    Coordinates axis_sorted = axis_local;
+    std::sort(axis_sorted.begin(), axis_sorted.begin() + _reduction_ops);
+
+    // Fuse the common spatial(-and-batch) axis sets into a single-pass kernel, cutting the
+    // intermediate tensors and the extra tensor streams of the single-axis chain
+    _fuse = input->info()->data_type() == DataType::F32
+            && ((_reduction_ops == 2 && axis_sorted[0] == 1 && axis_sorted[1] == 2)
+                || (_reduction_ops == 3 && axis_sorted[0] == 1 && axis_sorted[1] == 2 && axis_sorted[2] == 3));
 
-        if(i == _reduction_ops - 1 && keep_dims)
+    if(_fuse)
+    {
+        if(keep_dims)
         {
-            _reduction_kernels[i].configure(in, output, axis_local[i], ReductionOperation::MEAN_SUM);
+            _fused_kernel.configure(input, output, axis_local);
         }
         else
         {
-            _reduced_outs[i].allocator()->init(TensorInfo(out_shape, input->info()->num_channels(), input->info()->data_type(), input->info()->quantization_info()));
-            _memory_group.manage(&_reduced_outs[i]);
-            _reduction_kernels[i].configure(in, &_reduced_outs[i], axis_local[i], ReductionOperation::MEAN_SUM);
+            TensorShape out_shape = input->info()->tensor_shape();
+            for(int i = 0; i < _reduction_ops; ++i)
+            {
+                out_shape.set(axis_sorted[i], 1);
+            }
+            _reduced_outs.resize(1);
+            _reduced_outs[0].allocator()->init(TensorInfo(out_shape, input->info()->num_channels(), input->info()->data_type(), input->info()->quantization_info()));
+            _memory_group.manage(&_reduced_outs[0]);
+            _fused_kernel.configure(input, &_reduced_outs[0], axis_local);
+            _reduced_outs[0].allocator()->allocate();
         }
     }
-
-    // Allocate intermediate tensors
-    for(int i = 0; i < _reduction_ops - (keep_dims ? 1 : 0); ++i)
+    else
     {
-        _reduced_outs[i].allocator()->allocate();
+        _reduction_kernels.resize(_reduction_ops);
+        _reduced_outs.resize(_reduction_ops - (keep_dims ? 1 : 0));
+
+        // Perform reduction for every axis
+        for(int i = 0; i < _reduction_ops; ++i)
+        {
+            TensorShape out_shape = i == 0 ? input->info()->tensor_shape() : (&_reduced_outs[i - 1])->info()->tensor_shape();
+            out_shape.set(axis_local[i], 1);
+            auto in = (i == 0) ? input : (&_reduced_outs[i - 1]);
+
+            if(i == _reduction_ops - 1 && keep_dims)
+            {
+                _reduction_kernels[i].configure(in, output, axis_local[i], ReductionOperation::MEAN_SUM);
+            }
+            else
+            {
+                _reduced_outs[i].allocator()->init(TensorInfo(out_shape, input->info()->num_channels(), input->info()->data_type(), input->info()->quantization_info()));
+                _memory_group.manage(&_reduced_outs[i]);
+                _reduction_kernels[i].configure(in, &_reduced_outs[i], axis_local[i], ReductionOperation::MEAN_SUM);
+            }
+        }
+
+        // Allocate intermediate tensors
+        for(int i = 0; i < _reduction_ops - (keep_dims ? 1 : 0); ++i)
+        {
+            _reduced_outs[i].allocator()->allocate();
+        }
     }
 
     // Configure reshape layer if we want to drop the dimensions
@@ -154,16 +187,23 @@ void NEReduceMean::configure(ITensor *input, const Coordinates &reduction_axis,
             out_shape.remove_dimension(axis_local[i] - i);
         }
         auto_init_if_empty(*output->info(), input->info()->clone()->set_tensor_shape(out_shape));
-        _reshape.configure(&_reduced_outs[_reduction_ops - 1], output);
+        _reshape.configure(&_reduced_outs[_reduced_outs.size() - 1], output);
     }
 }
 
 void NEReduceMean::run()
 {
     MemoryGroupResourceScope scope_mg(_memory_group);
-    for(auto &kernel : _reduction_kernels)
+    if(_fuse)
+    {
+        NEScheduler::get().schedule(&_fused_kernel, Window::DimX);
+    }
+    else
     {
-        kernel.run();
+        for(auto &kernel : _reduction_kernels)
+        {
+            kernel.run();
+        }
     }
 
     if(!_keep_dims)
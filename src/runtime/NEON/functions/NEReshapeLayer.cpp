@@ -37,9 +37,9 @@ namespace experimental
 {
 void NEReshape::configure(const ITensorInfo *input, ITensorInfo *output)
 {
-    auto k = arm_compute::support::cpp14::make_unique<NEReshapeLayerKernel>();
-    k->configure(input, output);
-    _kernel = std::move(k);
+    KernelCacheKey key("NEReshapeLayerKernel");
+    key.add_tensor_info(input).add_tensor_info(output);
+    create_kernel<NEReshapeLayerKernel>(key, input, output);
 }
 
 Status NEReshape::validate(const ITensorInfo *input, const ITensorInfo *output)
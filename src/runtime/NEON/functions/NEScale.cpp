@@ -135,6 +135,15 @@ void NEScale::configure(ITensor *input, ITensor *output, const ScaleKernelInfo &
     {
         case InterpolationPolicy::NEAREST_NEIGHBOR:
         {
+            // Integer-factor upscaling replicates input pixels directly, the offsets table is not needed
+            if(data_layout == DataLayout::NCHW
+               && arm_compute::scale_utils::is_integer_upscale(input->info()->dimension(idx_width), input->info()->dimension(idx_height),
+                                                               output->info()->dimension(idx_width), output->info()->dimension(idx_height), is_align_corners_used))
+            {
+                _scale_kernel.configure(input, nullptr, nullptr, nullptr, output, info);
+                break;
+            }
+
             TensorInfo tensor_info_offsets(shape, Format::S32);
             _offsets.allocator()->init(tensor_info_offsets);
 
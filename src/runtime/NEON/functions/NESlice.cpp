@@ -28,11 +28,35 @@
 #include "arm_compute/core/Types.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/core/utils/helpers/tensor_transform.h"
+#include "arm_compute/runtime/Tensor.h"
 
 #include "support/MemorySupport.h"
 
 namespace arm_compute
 {
+namespace
+{
+/** Turns @p dst into a view of @p src starting at @p view_start, when both are plain tensors,
+ * the source already owns memory and the destination does not.
+ *
+ * @return True if the destination now shares the source buffer
+ */
+bool alias_slice_output(const ITensor *src, ITensor *dst, const Coordinates &view_start)
+{
+    const auto *src_tensor = dynamic_cast<const Tensor *>(src);
+    auto       *dst_tensor = dynamic_cast<Tensor *>(dst);
+    if(src_tensor == nullptr || dst_tensor == nullptr || src->buffer() == nullptr || dst->buffer() != nullptr)
+    {
+        return false;
+    }
+
+    // Initializing from the source allocator only reads it, hence the const_cast is safe
+    TensorInfo view_info = dst_tensor->allocator()->info();
+    dst_tensor->allocator()->init(*const_cast<Tensor *>(src_tensor)->allocator(), view_start, view_info);
+    return true;
+}
+} // namespace
+
 namespace experimental
 {
 void NESlice::configure(const ITensorInfo *input, ITensorInfo *output, const Coordinates &starts, const Coordinates &ends)
@@ -42,9 +66,10 @@ void NESlice::configure(const ITensorInfo *input, ITensorInfo *output, const Coo
     // Get absolute end coordinates
     const int32_t slice_end_mask = arm_compute::helpers::tensor_transform::construct_slice_end_mask(ends);
 
-    auto k = arm_compute::support::cpp14::make_unique<NEStridedSliceKernel>();
-    k->configure(input, output, starts, ends, BiStrides(), 0, slice_end_mask, 0);
-    _kernel = std::move(k);
+    KernelCacheKey key("NEStridedSliceKernel");
+    key.add_tensor_info(input).add_tensor_info(output).add_coordinates(starts).add_coordinates(ends).add_coordinates(BiStrides());
+    key.add_value(int32_t(0)).add_value(slice_end_mask).add_value(int32_t(0));
+    create_kernel<NEStridedSliceKernel>(key, input, output, starts, ends, BiStrides(), 0, slice_end_mask, 0);
 }
 
 Status NESlice::validate(const ITensorInfo *input, const ITensorInfo *output, const Coordinates &starts, const Coordinates &ends)
@@ -69,6 +94,9 @@ struct NESlice::Impl
     const ITensor                         *src{ nullptr };
     ITensor                               *dst{ nullptr };
     std::unique_ptr<experimental::NESlice> op{ nullptr };
+    bool                                   is_view{ false };
+    bool                                   aliased{ false };
+    Coordinates                            view_start{};
 };
 
 NESlice::NESlice()
@@ -90,10 +118,26 @@ void NESlice::configure(const ITensor *input, ITensor *output, const Coordinates
     _impl->dst = output;
     _impl->op  = arm_compute::support::cpp14::make_unique<experimental::NESlice>();
     _impl->op->configure(input->info(), output->info(), starts, ends);
+
+    // Contiguous slices alias the input memory instead of running the copy kernel
+    const int32_t slice_end_mask = arm_compute::helpers::tensor_transform::construct_slice_end_mask(ends);
+    _impl->is_view               = helpers::tensor_transform::slice_is_contiguous_view(input->info()->tensor_shape(), starts, ends, BiStrides(),
+                                                                                       0, slice_end_mask, 0, _impl->view_start);
 }
 
 void NESlice::run()
 {
+    if(_impl->is_view && !_impl->aliased)
+    {
+        // Deferred to the first run as the source tensor owns no memory at configure time
+        _impl->aliased = alias_slice_output(_impl->src, _impl->dst, _impl->view_start);
+    }
+    if(_impl->aliased)
+    {
+        // The output is a view of the input, there is nothing to compute
+        return;
+    }
+
     ITensorPack pack;
     pack.add_tensor(TensorType::ACL_SRC, _impl->src);
     pack.add_tensor(TensorType::ACL_DST, _impl->dst);
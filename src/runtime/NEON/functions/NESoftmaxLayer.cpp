@@ -30,10 +30,30 @@
 
 namespace arm_compute
 {
+namespace experimental
+{
+template <bool IS_LOG>
+void NESoftmaxGeneric<IS_LOG>::configure(const ITensorInfo *input, ITensorInfo *output, float beta)
+{
+    KernelCacheKey key(IS_LOG ? "NELogits1DOnlineLogSoftmaxKernel" : "NELogits1DOnlineSoftmaxKernel");
+    key.add_tensor_info(input).add_tensor_info(output).add_value(beta);
+    create_kernel<NELogits1DOnlineSoftmaxKernel<IS_LOG>>(key, input, output, beta);
+}
+
+template <bool IS_LOG>
+Status NESoftmaxGeneric<IS_LOG>::validate(const ITensorInfo *input, const ITensorInfo *output, float beta)
+{
+    return NELogits1DOnlineSoftmaxKernel<IS_LOG>::validate(input, output, beta);
+}
+
+template class NESoftmaxGeneric<false>;
+template class NESoftmaxGeneric<true>;
+} // namespace experimental
+
 template <bool IS_LOG>
 NESoftmaxLayerGeneric<IS_LOG>::NESoftmaxLayerGeneric(std::shared_ptr<IMemoryManager> memory_manager)
-    : _memory_group(std::move(memory_manager)), _max_kernel(), _softmax_kernel(), _flat_or_reshape_ptr(nullptr), _fill_border_kernel(), _reshape(), _max(), _tmp(), _input_flattened(), _output_flattened(),
-      _needs_flattening(false)
+    : _memory_group(std::move(memory_manager)), _max_kernel(), _softmax_kernel(), _online_softmax_kernel(), _flat_or_reshape_ptr(nullptr), _fill_border_kernel(), _reshape(), _max(), _tmp(),
+      _input_flattened(), _output_flattened(), _needs_flattening(false), _use_online_softmax(false)
 {
 }
 
@@ -97,6 +117,33 @@ void NESoftmaxLayerGeneric<IS_LOG>::configure(ITensor *input, ITensor *output, f
     // or it is the original input case (2D case)
     ITensor *input_2D = (_needs_flattening ? &_input_flattened : input);
 
+    // For float types the online-normalizer kernel fuses the max and exponentials-sum passes,
+    // so no intermediate max and exponentials tensors are needed and the logits are read at most twice
+    _use_online_softmax = !is_data_type_quantized_asymmetric(input_2D->info()->data_type());
+    if(_use_online_softmax)
+    {
+        if(_needs_flattening)
+        {
+            // Add to the memory manager _output_flattened
+            _memory_group.manage(&_output_flattened);
+
+            // The online softmax kernel stores the result in a flat output tensor
+            _online_softmax_kernel.configure(input_2D, &_output_flattened, beta);
+            _input_flattened.allocator()->allocate();
+
+            // Reshape the flat output into the requested (4D) output
+            _reshape.configure(&_output_flattened, output);
+
+            // Allocate the intermediate flat tensors
+            _output_flattened.allocator()->allocate();
+        }
+        else
+        {
+            _online_softmax_kernel.configure(input_2D, output, beta);
+        }
+        return;
+    }
+
     // Create intermediate tensors shapes
     const TensorInfo input_info    = input_2D->info()->clone()->reset_padding().set_is_resizable(true);
     DataType         tmp_data_type = is_data_type_quantized_asymmetric(input_2D->info()->data_type()) ? DataType::F32 : input_2D->info()->data_type();
@@ -180,8 +227,15 @@ Status NESoftmaxLayerGeneric<IS_LOG>::validate(const ITensorInfo *input, const I
         }
     }
 
-    ARM_COMPUTE_RETURN_ON_ERROR(NELogits1DMaxKernel::validate(input, &tensor_info_max_sum));
-    ARM_COMPUTE_RETURN_ON_ERROR(NELogits1DSoftmaxKernel<IS_LOG>::validate(&tensor_info_tmp, &tensor_info_max_sum, output, beta, &dont_care));
+    if(!is_data_type_quantized_asymmetric(input->data_type()))
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(NELogits1DOnlineSoftmaxKernel<IS_LOG>::validate(input, output, beta));
+    }
+    else
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(NELogits1DMaxKernel::validate(input, &tensor_info_max_sum));
+        ARM_COMPUTE_RETURN_ON_ERROR(NELogits1DSoftmaxKernel<IS_LOG>::validate(&tensor_info_tmp, &tensor_info_max_sum, output, beta, &dont_care));
+    }
 
     return Status{};
 }
@@ -196,9 +250,16 @@ void           NESoftmaxLayerGeneric<IS_LOG>::run()
         _flat_or_reshape_ptr->run();
     }
 
-    NEScheduler::get().schedule(&_fill_border_kernel, Window::DimY);
-    NEScheduler::get().schedule(&_max_kernel, Window::DimY);
-    NEScheduler::get().schedule(&_softmax_kernel, Window::DimY);
+    if(_use_online_softmax)
+    {
+        NEScheduler::get().schedule(&_online_softmax_kernel, Window::DimY);
+    }
+    else
+    {
+        NEScheduler::get().schedule(&_fill_border_kernel, Window::DimY);
+        NEScheduler::get().schedule(&_max_kernel, Window::DimY);
+        NEScheduler::get().schedule(&_softmax_kernel, Window::DimY);
+    }
 
     if(_needs_flattening)
     {
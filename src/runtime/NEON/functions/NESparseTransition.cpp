@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NESparseTransition.h"
+
+#include "arm_compute/core/NEON/kernels/NESparseCompressKernel.h"
+#include "support/MemorySupport.h"
+
+namespace arm_compute
+{
+void NESparseCompress::configure(const ITensor *input, ITensor *bitmap, ITensor *nonzeros, ITensor *nnz)
+{
+    auto k = arm_compute::support::cpp14::make_unique<NESparseCompressKernel>();
+    k->configure(input, bitmap, nonzeros, nnz);
+    _kernel = std::move(k);
+}
+
+Status NESparseCompress::validate(const ITensorInfo *input, const ITensorInfo *bitmap, const ITensorInfo *nonzeros, const ITensorInfo *nnz)
+{
+    return NESparseCompressKernel::validate(input, bitmap, nonzeros, nnz);
+}
+
+void NESparseDecompress::configure(const ITensor *bitmap, const ITensor *nonzeros, ITensor *output)
+{
+    auto k = arm_compute::support::cpp14::make_unique<NESparseDecompressKernel>();
+    k->configure(bitmap, nonzeros, output);
+    _kernel = std::move(k);
+}
+
+Status NESparseDecompress::validate(const ITensorInfo *bitmap, const ITensorInfo *nonzeros, const ITensorInfo *output)
+{
+    return NESparseDecompressKernel::validate(bitmap, nonzeros, output);
+}
+} // namespace arm_compute
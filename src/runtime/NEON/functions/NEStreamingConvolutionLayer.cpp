@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NEStreamingConvolutionLayer.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <cstring>
+
+namespace arm_compute
+{
+namespace
+{
+/** Shifts @p tensor left by @p shift elements along x and copies @p appended (of x dimension @p shift) into the freed columns */
+void shift_left_and_append(ITensor *tensor, const ITensor *appended, unsigned int shift)
+{
+    const size_t       element_size = tensor->info()->element_size();
+    const unsigned int width        = tensor->info()->dimension(0);
+
+    Window win;
+    win.use_tensor_dimensions(tensor->info()->tensor_shape());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator dst(tensor, win);
+    Iterator src(appended, win);
+
+    execute_window_loop(win, [&](const Coordinates &)
+    {
+        std::memmove(dst.ptr(), dst.ptr() + shift * element_size, (width - shift) * element_size);
+        std::memcpy(dst.ptr() + (width - shift) * element_size, src.ptr(), shift * element_size);
+    },
+    dst, src);
+}
+
+/** Copies the rightmost @p tail_width columns of @p src into @p dst (of x dimension @p tail_width) */
+void copy_tail(const ITensor *src, ITensor *dst, unsigned int tail_width)
+{
+    const size_t       element_size = src->info()->element_size();
+    const unsigned int src_width    = src->info()->dimension(0);
+
+    Window win;
+    win.use_tensor_dimensions(dst->info()->tensor_shape());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator in(src, win);
+    Iterator out(dst, win);
+
+    execute_window_loop(win, [&](const Coordinates &)
+    {
+        std::memcpy(out.ptr(), in.ptr() + (src_width - tail_width) * element_size, tail_width * element_size);
+    },
+    in, out);
+}
+} // namespace
+
+NEStreamingConvolutionLayer::NEStreamingConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager, IWeightsManager *weights_manager)
+    : _full_conv(memory_manager, weights_manager), _tail_conv(memory_manager, weights_manager), _window(), _tail_input(), _tail_output(), _input(nullptr), _output(nullptr), _hop(0), _new_cols(0),
+      _primed(false)
+{
+}
+
+void NEStreamingConvolutionLayer::configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, unsigned int window_width,
+                                            const ActivationLayerInfo &act_info, bool enable_fast_math)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
+    ARM_COMPUTE_ERROR_THROW_ON(NEStreamingConvolutionLayer::validate(input->info(), weights->info(), ((biases != nullptr) ? biases->info() : nullptr), output->info(), conv_info, window_width,
+                                                                     act_info, enable_fast_math));
+
+    const unsigned int kernel_width = weights->info()->dimension(0);
+    const unsigned int stride_x     = conv_info.stride().first;
+
+    _input    = input;
+    _output   = output;
+    _hop      = input->info()->dimension(0);
+    _new_cols = _hop / stride_x;
+    _primed   = false;
+
+    // The tail region covers every kernel position that overlaps the new frames
+    const unsigned int tail_width = kernel_width + (_new_cols - 1) * stride_x;
+
+    TensorShape window_shape = input->info()->tensor_shape();
+    window_shape.set(0, window_width);
+    TensorShape tail_input_shape = input->info()->tensor_shape();
+    tail_input_shape.set(0, tail_width);
+    TensorShape tail_output_shape = output->info()->tensor_shape();
+    tail_output_shape.set(0, _new_cols);
+
+    _window.allocator()->init(input->info()->clone()->set_tensor_shape(window_shape));
+    _tail_input.allocator()->init(input->info()->clone()->set_tensor_shape(tail_input_shape));
+    _tail_output.allocator()->init(output->info()->clone()->set_tensor_shape(tail_output_shape));
+
+    _full_conv.configure(&_window, weights, biases, output, conv_info, WeightsInfo(), Size2D(1U, 1U), act_info, enable_fast_math);
+    _tail_conv.configure(&_tail_input, weights, biases, &_tail_output, conv_info, WeightsInfo(), Size2D(1U, 1U), act_info, enable_fast_math);
+
+    // State tensors live across run() calls, so they stay outside the lifetime-managed pools
+    _window.allocator()->allocate();
+    _tail_input.allocator()->allocate();
+    _tail_output.allocator()->allocate();
+}
+
+Status NEStreamingConvolutionLayer::validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info,
+                                             unsigned int window_width, const ActivationLayerInfo &act_info, bool enable_fast_math)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, weights, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(input->data_layout() != DataLayout::NCHW, "Streaming convolution expects NCHW with time along the x dimension");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG((conv_info.pad_left() != 0) || (conv_info.pad_right() != 0), "Padding along the time axis is not supported: padded edge values would change as the window slides");
+
+    const unsigned int hop          = input->dimension(0);
+    const unsigned int kernel_width = weights->dimension(0);
+    const unsigned int stride_x     = conv_info.stride().first;
+
+    ARM_COMPUTE_RETURN_ERROR_ON(hop == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(window_width < kernel_width + hop, "Window must hold at least one kernel position besides the new frames");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(hop % stride_x != 0, "Hop must be a multiple of the x stride for cached output columns to stay aligned");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG((window_width - kernel_width) % stride_x != 0, "The last kernel position must land exactly at the window edge");
+
+    const unsigned int new_cols   = hop / stride_x;
+    const unsigned int tail_width = kernel_width + (new_cols - 1) * stride_x;
+
+    TensorShape window_shape = input->tensor_shape();
+    window_shape.set(0, window_width);
+    TensorShape tail_input_shape = input->tensor_shape();
+    tail_input_shape.set(0, tail_width);
+    TensorShape tail_output_shape = output->tensor_shape();
+    tail_output_shape.set(0, new_cols);
+
+    const TensorInfo window_info      = input->clone()->set_tensor_shape(window_shape);
+    const TensorInfo tail_input_info  = input->clone()->set_tensor_shape(tail_input_shape);
+    const TensorInfo tail_output_info = output->clone()->set_tensor_shape(tail_output_shape);
+
+    ARM_COMPUTE_RETURN_ON_ERROR(NEConvolutionLayer::validate(&window_info, weights, biases, output, conv_info, WeightsInfo(), Size2D(1U, 1U), act_info, enable_fast_math));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEConvolutionLayer::validate(&tail_input_info, weights, biases, &tail_output_info, conv_info, WeightsInfo(), Size2D(1U, 1U), act_info, enable_fast_math));
+
+    return Status{};
+}
+
+void NEStreamingConvolutionLayer::reset()
+{
+    _primed = false;
+}
+
+void NEStreamingConvolutionLayer::run()
+{
+    prepare();
+
+    if(!_primed)
+    {
+        // Prime the state: fill the window up to the new frames with zeros (the quantization
+        // offset for quantized types, whose bit pattern repeats per byte) and convolve all of it
+        const ITensorInfo *info = _window.info();
+        const uint8_t      fill = is_data_type_quantized_asymmetric(info->data_type()) ? static_cast<uint8_t>(info->quantization_info().uniform().offset) : 0;
+        std::memset(_window.buffer(), fill, info->total_size());
+
+        shift_left_and_append(&_window, _input, _hop);
+        _full_conv.run();
+        _primed = true;
+        return;
+    }
+
+    // Slide the window and recompute only the output columns the new frames influence
+    shift_left_and_append(&_window, _input, _hop);
+    copy_tail(&_window, &_tail_input, _tail_input.info()->dimension(0));
+    _tail_conv.run();
+    shift_left_and_append(_output, &_tail_output, _new_cols);
+}
+
+void NEStreamingConvolutionLayer::prepare()
+{
+    _full_conv.prepare();
+    _tail_conv.prepare();
+}
+} // namespace arm_compute
@@ -26,19 +26,47 @@
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/core/NEON/kernels/NEStridedSliceKernel.h"
 #include "arm_compute/core/Types.h"
+#include "arm_compute/core/utils/helpers/tensor_transform.h"
+#include "arm_compute/runtime/Tensor.h"
 #include "support/MemorySupport.h"
 
 namespace arm_compute
 {
+namespace
+{
+/** Aliases @p dst onto the region of @p src starting at @p view_start.
+ *
+ * Only possible when both are plain tensors, the source is already backed by memory and the
+ * destination has not been given its own backing memory.
+ *
+ * @return True if the destination now shares the source buffer
+ */
+bool try_alias_slice_output(const ITensor *src, ITensor *dst, const Coordinates &view_start)
+{
+    const auto *src_tensor = dynamic_cast<const Tensor *>(src);
+    auto       *dst_tensor = dynamic_cast<Tensor *>(dst);
+    if(src_tensor == nullptr || dst_tensor == nullptr || src->buffer() == nullptr || dst->buffer() != nullptr)
+    {
+        return false;
+    }
+
+    // Initializing from the source allocator only reads it, hence the const_cast is safe
+    TensorInfo view_info = dst_tensor->allocator()->info();
+    dst_tensor->allocator()->init(*const_cast<Tensor *>(src_tensor)->allocator(), view_start, view_info);
+    return true;
+}
+} // namespace
+
 namespace experimental
 {
 void NEStridedSlice::configure(const ITensorInfo *input, ITensorInfo *output,
                                const Coordinates &starts, const Coordinates &ends, const BiStrides &strides,
                                int32_t begin_mask, int32_t end_mask, int32_t shrink_axis_mask)
 {
-    auto k = arm_compute::support::cpp14::make_unique<NEStridedSliceKernel>();
-    k->configure(input, output, starts, ends, strides, begin_mask, end_mask, shrink_axis_mask);
-    _kernel = std::move(k);
+    KernelCacheKey key("NEStridedSliceKernel");
+    key.add_tensor_info(input).add_tensor_info(output).add_coordinates(starts).add_coordinates(ends).add_coordinates(strides);
+    key.add_value(begin_mask).add_value(end_mask).add_value(shrink_axis_mask);
+    create_kernel<NEStridedSliceKernel>(key, input, output, starts, ends, strides, begin_mask, end_mask, shrink_axis_mask);
 }
 
 Status NEStridedSlice::validate(const ITensorInfo *input, const ITensorInfo *output,
@@ -54,6 +82,9 @@ struct NEStridedSlice::Impl
     const ITensor                                *src{ nullptr };
     ITensor                                      *dst{ nullptr };
     std::unique_ptr<experimental::NEStridedSlice> op{ nullptr };
+    bool                                          is_view{ false };
+    bool                                          aliased{ false };
+    Coordinates                                   view_start{};
 };
 
 NEStridedSlice::NEStridedSlice()
@@ -72,10 +103,25 @@ void NEStridedSlice::configure(const ITensor *input, ITensor *output,
     _impl->dst = output;
     _impl->op  = arm_compute::support::cpp14::make_unique<experimental::NEStridedSlice>();
     _impl->op->configure(input->info(), output->info(), starts, ends, strides, begin_mask, end_mask, shrink_axis_mask);
+
+    // A contiguous unit-stride slice can alias the input memory instead of copying it
+    _impl->is_view = helpers::tensor_transform::slice_is_contiguous_view(input->info()->tensor_shape(), starts, ends, strides,
+                                                                         begin_mask, end_mask, shrink_axis_mask, _impl->view_start);
 }
 
 void NEStridedSlice::run()
 {
+    if(_impl->is_view && !_impl->aliased)
+    {
+        // Deferred to the first run as the source tensor owns no memory at configure time
+        _impl->aliased = try_alias_slice_output(_impl->src, _impl->dst, _impl->view_start);
+    }
+    if(_impl->aliased)
+    {
+        // The output is a view of the input, there is nothing to compute
+        return;
+    }
+
     ITensorPack pack;
     pack.add_tensor(TensorType::ACL_SRC, _impl->src);
     pack.add_tensor(TensorType::ACL_DST, _impl->dst);
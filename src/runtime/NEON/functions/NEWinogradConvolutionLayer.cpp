@@ -64,9 +64,18 @@ inline Status validate_kernel_3x3(const Size2D input_dims, const ITensorInfo *in
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
     else if(input->data_type() == DataType::F16)
     {
-        ARM_COMPUTE_RETURN_ON_ERROR((NEWinogradLayerTransformInputKernel<__fp16, 4, 4, 3, 3>::validate(input, input0, winograd_info)));
-        ARM_COMPUTE_RETURN_ON_ERROR((NEWinogradLayerTransformWeightsKernel<__fp16, 4, 4, 3, 3>::validate(weights, input1, winograd_info)));
-        ARM_COMPUTE_RETURN_ON_ERROR((NEWinogradLayerTransformOutputKernel<__fp16, 4, 4, 3, 3>::validate(batched_mm_output, biases, output, winograd_info)));
+        if(input_dims.width > 4 && input_dims.height > 4)
+        {
+            ARM_COMPUTE_RETURN_ON_ERROR((NEWinogradLayerTransformInputKernel<__fp16, 4, 4, 3, 3>::validate(input, input0, winograd_info)));
+            ARM_COMPUTE_RETURN_ON_ERROR((NEWinogradLayerTransformWeightsKernel<__fp16, 4, 4, 3, 3>::validate(weights, input1, winograd_info)));
+            ARM_COMPUTE_RETURN_ON_ERROR((NEWinogradLayerTransformOutputKernel<__fp16, 4, 4, 3, 3>::validate(batched_mm_output, biases, output, winograd_info)));
+        }
+        else
+        {
+            ARM_COMPUTE_RETURN_ON_ERROR((NEWinogradLayerTransformInputKernel<__fp16, 2, 2, 3, 3>::validate(input, input0, winograd_info)));
+            ARM_COMPUTE_RETURN_ON_ERROR((NEWinogradLayerTransformWeightsKernel<__fp16, 2, 2, 3, 3>::validate(weights, input1, winograd_info)));
+            ARM_COMPUTE_RETURN_ON_ERROR((NEWinogradLayerTransformOutputKernel<__fp16, 2, 2, 3, 3>::validate(batched_mm_output, biases, output, winograd_info)));
+        }
     }
 #endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
 
@@ -202,14 +211,11 @@ Status validate_arguments(const ITensorInfo *input, const ITensorInfo *weights,
 
 Size2D winograd_output_tile(const Size2D &input_dims, const Size2D &kernel_dims, DataType data_type)
 {
+    ARM_COMPUTE_UNUSED(data_type);
     Size2D output_tile = Size2D{};
     if(kernel_dims == Size2D(3U, 3U))
     {
         output_tile = (input_dims.width <= 4 || input_dims.height <= 4) ? Size2D(2U, 2U) : Size2D(4U, 4U);
-        if(data_type == DataType::F16)
-        {
-            output_tile = Size2D(4U, 4U);
-        }
     }
     else if(kernel_dims == Size2D(5U, 5U))
     {
@@ -249,6 +255,7 @@ bool check_support_fast_math(const Size2D &output_tile, const Size2D &kernel_siz
 
     const std::vector<WinogradConfiguration> fast_math_winograd_f16 =
     {
+        WinogradConfiguration(std::pair<int, int>(2, 2), std::pair<int, int>(3, 3)),
         WinogradConfiguration(std::pair<int, int>(4, 4), std::pair<int, int>(3, 3))
     };
 
@@ -297,10 +304,37 @@ arm_gemm::Activation arm_gemm_activation_from_acl_activation(const ActivationLay
 }
 } //namespace
 
-NEWinogradConvolutionLayer::NEWinogradConvolutionLayer(const std::shared_ptr<IMemoryManager> &memory_manager)
-    : _memory_group(memory_manager), _gemm_function(memory_manager), _transform_input_kernel(nullptr), _transform_output_kernel(nullptr), _transform_weights_kernel(nullptr), _activationlayer_function(),
-      _permute_input(), _permute_weights(), _permute_output(), _input_transformed(), _output_transformed(), _input_workspace(), _output_workspace(), _kernel_storage(), _input_nhwc(), _output_nhwc(),
-      _weights_hwio(), _input(), _weights(), _output(), _is_prepared(false), _is_activationlayer_enabled(false)
+namespace weights_transformations
+{
+void NEWinogradLayerTransformWeightsManaged::configure(const ITensor *weights, INEWinogradLayerTransformWeightsKernel *transform_kernel, const PermutationVector &permutation_vector,
+                                                       const TensorInfo &storage_info, size_t storage_alignment, int matrix_stride, int num_output_channels, int num_input_channels,
+                                                       const Size2D &output_tile, const Size2D &kernel_size)
+{
+    // Different Winograd configurations lay the transformed weights out differently, so the
+    // output tile and kernel size take part in the transform's identity
+    _uid    = 0x9 | (output_tile.width << 8) | (output_tile.height << 12) | (kernel_size.width << 16) | (kernel_size.height << 20);
+    _kernel = transform_kernel;
+    _permute.configure(weights, &_hwio, permutation_vector);
+    _output.allocator()->init(storage_info, storage_alignment);
+    transform_kernel->configure(&_hwio, &_output, matrix_stride, num_output_channels, num_input_channels);
+}
+
+void NEWinogradLayerTransformWeightsManaged::run()
+{
+    _hwio.allocator()->allocate();
+    _permute.run();
+    _output.allocator()->allocate();
+    NEScheduler::get().schedule(_kernel, Window::DimX);
+    _hwio.allocator()->free();
+    _reshape_run = true;
+}
+} // namespace weights_transformations
+
+NEWinogradConvolutionLayer::NEWinogradConvolutionLayer(const std::shared_ptr<IMemoryManager> &memory_manager, IWeightsManager *weights_manager)
+    : _memory_group(memory_manager), _weights_manager(weights_manager), _gemm_function(memory_manager), _transform_input_kernel(nullptr), _transform_output_kernel(nullptr),
+      _transform_weights_kernel(nullptr), _activationlayer_function(), _permute_input(), _permute_weights(), _permute_output(), _transform_weights_managed(), _input_transformed(),
+      _output_transformed(), _input_workspace(), _output_workspace(), _kernel_storage(), _input_nhwc(), _output_nhwc(), _weights_hwio(), _input(), _weights(), _output(), _is_prepared(false),
+      _is_activationlayer_enabled(false)
 {
 }
 
@@ -436,12 +470,24 @@ void NEWinogradConvolutionLayer::configure(const ITensor *input, const ITensor *
     {
         if(kernel_size == Size2D(3, 3))
         {
-            using config             = NEWinogradLayerConfiguration<__fp16, __fp16, 4, 4, 3, 3>;
-            transform_input_kernel   = support::cpp14::make_unique<config::TransformInputKernel>();
-            transform_weights_kernel = support::cpp14::make_unique<config::TransformWeightsKernel>();
-            transform_output_kernel  = support::cpp14::make_unique<config::TransformOutputKernel>();
-            n_gemms                  = config::WinogradBase::N_GEMMS;
-            N_BLOCK                  = config::WinogradConv::N_BLOCK;
+            if(input->info()->dimension(width_idx) > 4 && input->info()->dimension(height_idx) > 4)
+            {
+                using config             = NEWinogradLayerConfiguration<__fp16, __fp16, 4, 4, 3, 3>;
+                transform_input_kernel   = support::cpp14::make_unique<config::TransformInputKernel>();
+                transform_weights_kernel = support::cpp14::make_unique<config::TransformWeightsKernel>();
+                transform_output_kernel  = support::cpp14::make_unique<config::TransformOutputKernel>();
+                n_gemms                  = config::WinogradBase::N_GEMMS;
+                N_BLOCK                  = config::WinogradConv::N_BLOCK;
+            }
+            else
+            {
+                using config             = NEWinogradLayerConfiguration<__fp16, __fp16, 2, 2, 3, 3>;
+                transform_input_kernel   = support::cpp14::make_unique<config::TransformInputKernel>();
+                transform_weights_kernel = support::cpp14::make_unique<config::TransformWeightsKernel>();
+                transform_output_kernel  = support::cpp14::make_unique<config::TransformOutputKernel>();
+                n_gemms                  = config::WinogradBase::N_GEMMS;
+                N_BLOCK                  = config::WinogradConv::N_BLOCK;
+            }
         }
         else
         {
@@ -553,12 +599,28 @@ void NEWinogradConvolutionLayer::configure(const ITensor *input, const ITensor *
     }
 
     // Re-order a weight tensor from [Output feature map x Input feature map x Height x Width] to [Height x Width x Input feature map x Output feature map]
-    _permute_weights.configure(weights, &_weights_hwio, weights_permutation_vector);
-    transform_weights_kernel->configure(&_weights_hwio, &_kernel_storage, kernel_matrix_stride, out_channels, in_channels);
+    // and transform it into the Winograd domain. Routed through the weights manager when one is set,
+    // so functions sharing the manager and graph rebuilds reuse one transformed copy of identical weights
+    ITensor *weights_transformed = &_kernel_storage;
+    if(_weights_manager != nullptr)
+    {
+        _weights_manager->manage(weights);
+    }
+    if(_weights_manager != nullptr && _weights_manager->are_weights_managed(weights))
+    {
+        _transform_weights_managed.configure(weights, transform_weights_kernel.get(), weights_permutation_vector, b_info, storage_alignment, kernel_matrix_stride, out_channels, in_channels,
+                                             output_tile, kernel_size);
+        weights_transformed = _weights_manager->acquire(weights, &_transform_weights_managed);
+    }
+    else
+    {
+        _permute_weights.configure(weights, &_weights_hwio, weights_permutation_vector);
+        transform_weights_kernel->configure(&_weights_hwio, &_kernel_storage, kernel_matrix_stride, out_channels, in_channels);
+    }
 
     // Configure GEMM function
     _memory_group.manage(&_output_transformed);
-    _gemm_function.configure(&_input_transformed, &_kernel_storage, nullptr, &_output_transformed, 1.0f, 0.f);
+    _gemm_function.configure(&_input_transformed, weights_transformed, nullptr, &_output_transformed, 1.0f, 0.f);
     _input_transformed.allocator()->allocate();
 
     // Configure output transform function
@@ -755,16 +817,23 @@ void NEWinogradConvolutionLayer::prepare()
 {
     if(!_is_prepared)
     {
-        // Permute weights
-        _weights_hwio.allocator()->allocate();
-        _permute_weights.run();
-        _weights->mark_as_unused();
+        if(_weights_manager != nullptr && _weights_manager->are_weights_managed(_weights))
+        {
+            _weights_manager->run(_weights, &_transform_weights_managed);
+        }
+        else
+        {
+            // Permute weights
+            _weights_hwio.allocator()->allocate();
+            _permute_weights.run();
+            _weights->mark_as_unused();
 
-        // Transform weights
-        _kernel_storage.allocator()->allocate();
-        NEScheduler::get().schedule(_transform_weights_kernel.get(), Window::DimX);
+            // Transform weights
+            _kernel_storage.allocator()->allocate();
+            NEScheduler::get().schedule(_transform_weights_kernel.get(), Window::DimX);
 
-        _weights_hwio.allocator()->free();
+            _weights_hwio.allocator()->free();
+        }
         _is_prepared = true;
     }
 }
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NumaAwareAllocator.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/runtime/IScheduler.h"
+#include "arm_compute/runtime/MemoryRegion.h"
+#include "arm_compute/runtime/Scheduler.h"
+#include "support/MemorySupport.h"
+
+#include <cstring>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace arm_compute
+{
+namespace
+{
+/** Memory region handing its backing memory back to the owning allocator on destruction */
+class NumaMemoryRegion final : public IMemoryRegion
+{
+public:
+    NumaMemoryRegion(NumaAwareAllocator &allocator, void *ptr, size_t size)
+        : IMemoryRegion(size), _allocator(allocator), _ptr(ptr)
+    {
+        MemoryCounters::get().record_allocation(_size);
+    }
+    NumaMemoryRegion(const NumaMemoryRegion &) = delete;
+    NumaMemoryRegion &operator=(const NumaMemoryRegion &) = delete;
+    ~NumaMemoryRegion()
+    {
+        MemoryCounters::get().record_free(_size);
+        _allocator.free(_ptr);
+    }
+
+    // Inherited methods overridden:
+    void *buffer() final
+    {
+        return _ptr;
+    }
+    const void *buffer() const final
+    {
+        return _ptr;
+    }
+    std::unique_ptr<IMemoryRegion> extract_subregion(size_t offset, size_t size) final
+    {
+        if(_ptr != nullptr && (offset < _size) && (_size - offset >= size))
+        {
+            return support::cpp14::make_unique<MemoryRegion>(static_cast<uint8_t *>(_ptr) + offset, size);
+        }
+        return nullptr;
+    }
+
+private:
+    NumaAwareAllocator &_allocator;
+    void               *_ptr;
+};
+} // namespace
+
+NumaAwareAllocator::NumaAwareAllocator(PlacementPolicy policy, IScheduler *scheduler)
+    : _policy(policy), _scheduler(scheduler != nullptr ? scheduler : &Scheduler::get()), _allocations(), _allocations_mutex()
+{
+}
+
+void *NumaAwareAllocator::allocate(size_t size, size_t alignment)
+{
+    const size_t page_size = sysconf(_SC_PAGESIZE);
+    ARM_COMPUTE_ERROR_ON_MSG(alignment > page_size, "NumaAwareAllocator only supports alignments up to the page size");
+    ARM_COMPUTE_UNUSED(alignment);
+
+    if(size == 0)
+    {
+        return nullptr;
+    }
+
+    const size_t num_pages    = (size + page_size - 1) / page_size;
+    const size_t mapped_bytes = num_pages * page_size;
+    void        *ptr          = mmap(nullptr, mapped_bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    ARM_COMPUTE_ERROR_ON_MSG(ptr == MAP_FAILED, "Failed to map memory");
+
+    // First-touch the pages from the scheduler's (bound) worker threads so they
+    // are placed on the node/cluster of the thread that will process them
+    const unsigned int                num_threads = _scheduler->num_threads();
+    std::vector<IScheduler::Workload> workloads(num_threads);
+    for(unsigned int t = 0; t < num_threads; ++t)
+    {
+        workloads[t] = [=](const ThreadInfo &)
+        {
+            auto buffer = static_cast<uint8_t *>(ptr);
+            if(_policy == PlacementPolicy::Interleave)
+            {
+                for(size_t p = t; p < num_pages; p += num_threads)
+                {
+                    memset(buffer + p * page_size, 0, page_size);
+                }
+            }
+            else
+            {
+                const size_t first = (t * num_pages) / num_threads;
+                const size_t last  = ((t + 1) * num_pages) / num_threads;
+                if(last > first)
+                {
+                    memset(buffer + first * page_size, 0, (last - first) * page_size);
+                }
+            }
+        };
+    }
+    _scheduler->run_tagged_workloads(workloads, "NumaAwareAllocator/first_touch");
+
+    {
+        std::lock_guard<std::mutex> lock(_allocations_mutex);
+        _allocations[ptr] = mapped_bytes;
+    }
+    return ptr;
+}
+
+void NumaAwareAllocator::free(void *ptr)
+{
+    if(ptr == nullptr)
+    {
+        return;
+    }
+
+    size_t mapped_bytes = 0;
+    {
+        std::lock_guard<std::mutex> lock(_allocations_mutex);
+        auto                        it = _allocations.find(ptr);
+        ARM_COMPUTE_ERROR_ON_MSG(it == _allocations.end(), "Pointer was not allocated by this allocator");
+        mapped_bytes = it->second;
+        _allocations.erase(it);
+    }
+    munmap(ptr, mapped_bytes);
+}
+
+std::unique_ptr<IMemoryRegion> NumaAwareAllocator::make_region(size_t size, size_t alignment)
+{
+    void *ptr = allocate(size, alignment);
+    return support::cpp14::make_unique<NumaMemoryRegion>(*this, ptr, size);
+}
+} // namespace arm_compute
@@ -23,6 +23,8 @@
  */
 #include "arm_compute/runtime/OMP/OMPScheduler.h"
 
+#include "arm_compute/runtime/KernelProfiler.h"
+
 #include "arm_compute/core/CPP/ICPPKernel.h"
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
@@ -36,6 +38,9 @@ namespace arm_compute
 OMPScheduler::OMPScheduler() // NOLINT
     : _num_threads(omp_get_max_threads())
 {
+    // Disable dynamic team sizing so the runtime keeps the same team alive
+    // across schedule() calls instead of re-forking per kernel.
+    omp_set_dynamic(0);
 }
 
 unsigned int OMPScheduler::num_threads() const
@@ -63,6 +68,7 @@ void OMPScheduler::schedule(ICPPKernel *kernel, const Hints &hints)
     {
         ThreadInfo info;
         info.cpu_info = &_cpu_info;
+        ScopedKernelProfile profile(kernel->name(), info.thread_id);
         kernel->run(max_window, info);
     }
     else
@@ -76,6 +82,7 @@ void OMPScheduler::schedule(ICPPKernel *kernel, const Hints &hints)
             {
                 Window win = max_window.split_window(hints.split_dimension(), t, num_windows);
                 win.validate();
+                ScopedKernelProfile profile(kernel->name(), info.thread_id);
                 kernel->run(win, info);
             };
         }
@@ -97,6 +104,7 @@ void OMPScheduler::schedule_op(ICPPKernel *kernel, const Hints &hints, ITensorPa
     {
         ThreadInfo info;
         info.cpu_info = &_cpu_info;
+        ScopedKernelProfile profile(kernel->name(), info.thread_id);
         kernel->run_op(tensors, max_window, info);
     }
     else
@@ -110,6 +118,7 @@ void OMPScheduler::schedule_op(ICPPKernel *kernel, const Hints &hints, ITensorPa
             {
                 Window win = max_window.split_window(hints.split_dimension(), t, num_windows);
                 win.validate();
+                ScopedKernelProfile profile(kernel->name(), info.thread_id);
                 kernel->run_op(tensors, win, info);
             };
         }
@@ -128,11 +137,28 @@ void OMPScheduler::run_workloads(std::vector<arm_compute::IScheduler::Workload>
     ThreadInfo info;
     info.cpu_info    = &_cpu_info;
     info.num_threads = num_threads;
-    #pragma omp parallel firstprivate(info) num_threads(num_threads)
+    if(omp_in_parallel())
     {
-        const int tid  = omp_get_thread_num();
-        info.thread_id = tid;
-        workloads[tid](info);
+        // Already inside a caller-provided parallel region: don't fork a nested
+        // team, spread the workloads as tasks over the existing one instead.
+        for(unsigned int t = 0; t < num_threads; ++t)
+        {
+            #pragma omp task firstprivate(info, t)
+            {
+                info.thread_id = t;
+                workloads[t](info);
+            }
+        }
+        #pragma omp taskwait
+    }
+    else
+    {
+        #pragma omp parallel firstprivate(info) num_threads(num_threads)
+        {
+            const int tid  = omp_get_thread_num();
+            info.thread_id = tid;
+            workloads[tid](info);
+        }
     }
 }
 #endif /* DOXYGEN_SKIP_THIS */
@@ -45,10 +45,29 @@ size_t align_offset(size_t offset, size_t alignment)
 }
 } // namespace
 OffsetLifetimeManager::OffsetLifetimeManager()
-    : _blob(0)
+    : _blob(0), _imported_regions(), _imported_total(0)
 {
 }
 
+void OffsetLifetimeManager::import_plan(const MemoryReport &plan)
+{
+    ARM_COMPUTE_ERROR_ON(plan.mapping_type != MappingType::OFFSETS);
+
+    _imported_regions.clear();
+    for(const auto &region : plan.regions)
+    {
+        _imported_regions[region.lifetime_start] = region;
+    }
+    _imported_total = plan.total_bytes;
+
+    // Fix the blob upfront so a pool can be sized before any lifetime is registered
+    for(const auto &region : _imported_regions)
+    {
+        _blob.alignment = std::max(_blob.alignment, region.second.alignment);
+    }
+    _blob.size = std::max(_blob.size, _imported_total);
+}
+
 const OffsetLifetimeManager::info_type &OffsetLifetimeManager::info() const
 {
     return _blob;
@@ -70,6 +89,12 @@ void OffsetLifetimeManager::update_blobs_and_mappings()
     ARM_COMPUTE_ERROR_ON(!are_all_finalized());
     ARM_COMPUTE_ERROR_ON(_active_group == nullptr);
 
+    // Use the imported plan when it covers the group, skipping the offset calculation
+    if(!_imported_regions.empty() && update_mappings_from_plan())
+    {
+        return;
+    }
+
     // Update blob size
     size_t max_aggregated_size = 0;
     std::for_each(std::begin(_free_blobs), std::end(_free_blobs), [&](const Blob & b)
@@ -97,4 +122,40 @@ void OffsetLifetimeManager::update_blobs_and_mappings()
         ARM_COMPUTE_ERROR_ON(offset > _blob.size);
     }
 }
+
+bool OffsetLifetimeManager::update_mappings_from_plan()
+{
+    // Match every bound element against the plan before touching the mappings; a single
+    // mismatch (e.g. the network changed since the plan was exported) rejects the group
+    for(const auto &free_blob : _free_blobs)
+    {
+        for(const auto &bound_element_id : free_blob.bound_elements)
+        {
+            ARM_COMPUTE_ERROR_ON(_active_elements.find(bound_element_id) == std::end(_active_elements));
+            const Element &bound_element = _active_elements[bound_element_id];
+
+            auto region_it = _imported_regions.find(bound_element.start_serial);
+            if(region_it == std::end(_imported_regions)
+               || region_it->second.lifetime_end != bound_element.end_serial
+               || region_it->second.size < bound_element.size
+               || region_it->second.placement + bound_element.size > _imported_total)
+            {
+                return false;
+            }
+        }
+    }
+
+    auto &group_mappings = _active_group->mappings();
+    for(const auto &free_blob : _free_blobs)
+    {
+        for(const auto &bound_element_id : free_blob.bound_elements)
+        {
+            Element &bound_element               = _active_elements[bound_element_id];
+            group_mappings[bound_element.handle] = _imported_regions[bound_element.start_serial].placement;
+        }
+    }
+    _blob.owners = std::max(_blob.owners, _free_blobs.size());
+
+    return true;
+}
 } // namespace arm_compute
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/OperatorKernelCache.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/ITensorInfo.h"
+#include "arm_compute/core/Validate.h"
+
+#include <utility>
+
+namespace arm_compute
+{
+KernelCacheKey::KernelCacheKey(const char *kernel_name)
+    : _bytes()
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(kernel_name);
+    _bytes.append(kernel_name);
+    _bytes.push_back('\0');
+}
+
+KernelCacheKey &KernelCacheKey::add_tensor_info(const ITensorInfo *info)
+{
+    if(info == nullptr)
+    {
+        add_value(uint8_t(0));
+        return *this;
+    }
+    add_value(uint8_t(1));
+
+    const TensorShape &shape   = info->tensor_shape();
+    const Strides     &strides = info->strides_in_bytes();
+    add_value(shape.num_dimensions());
+    for(size_t d = 0; d < shape.num_dimensions(); ++d)
+    {
+        add_value(shape[d]);
+        add_value(strides[d]);
+    }
+    add_value(info->offset_first_element_in_bytes());
+    add_value(info->total_size());
+    add_value(info->data_type());
+    add_value(info->data_layout());
+
+    const QuantizationInfo    qinfo   = info->quantization_info();
+    const std::vector<float>  &scales  = qinfo.scale();
+    const std::vector<int32_t> &offsets = qinfo.offset();
+    add_value(scales.size());
+    for(float scale : scales)
+    {
+        add_value(scale);
+    }
+    add_value(offsets.size());
+    for(int32_t offset : offsets)
+    {
+        add_value(offset);
+    }
+    return *this;
+}
+
+KernelCacheKey &KernelCacheKey::add_coordinates(const Coordinates &coords)
+{
+    add_value(coords.num_dimensions());
+    for(size_t d = 0; d < coords.num_dimensions(); ++d)
+    {
+        add_value(coords[d]);
+    }
+    return *this;
+}
+
+const std::string &KernelCacheKey::bytes() const
+{
+    return _bytes;
+}
+
+void KernelCacheKey::append(const void *data, size_t size)
+{
+    _bytes.append(static_cast<const char *>(data), size);
+}
+
+std::shared_ptr<ICPPKernel> OperatorKernelCache::find(const KernelCacheKey &key)
+{
+    arm_compute::lock_guard<Mutex> lock(_mutex);
+    auto                           it = _kernels.find(key.bytes());
+    return (it != _kernels.end()) ? it->second : nullptr;
+}
+
+void OperatorKernelCache::add(const KernelCacheKey &key, std::shared_ptr<ICPPKernel> kernel)
+{
+    ARM_COMPUTE_ERROR_ON(kernel == nullptr);
+    arm_compute::lock_guard<Mutex> lock(_mutex);
+    _kernels.emplace(key.bytes(), std::move(kernel));
+}
+
+size_t OperatorKernelCache::size() const
+{
+    arm_compute::lock_guard<Mutex> lock(_mutex);
+    return _kernels.size();
+}
+} // namespace arm_compute
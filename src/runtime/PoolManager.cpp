@@ -33,14 +33,36 @@
 using namespace arm_compute;
 
 PoolManager::PoolManager()
-    : _free_pools(), _occupied_pools(), _sem(), _mtx()
+    : _free_pools(), _occupied_pools(), _sem(), _mtx(), _max_pools(0), _base_pools(0), _idle_release(1000), _last_exhausted()
 {
 }
 
+void PoolManager::set_elastic_growth(size_t max_pools, std::chrono::milliseconds idle_release)
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+    _max_pools    = max_pools;
+    _idle_release = idle_release;
+}
+
 IMemoryPool *PoolManager::lock_pool()
 {
     ARM_COMPUTE_ERROR_ON_MSG(_free_pools.empty() && _occupied_pools.empty(), "Haven't setup any pools!");
 
+    // On exhaustion duplicate an occupied pool instead of blocking, until the cap is hit
+    if(_max_pools > 0)
+    {
+        arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+        if(_free_pools.empty())
+        {
+            _last_exhausted = std::chrono::steady_clock::now();
+            if(!_occupied_pools.empty() && (_free_pools.size() + _occupied_pools.size()) < _max_pools)
+            {
+                _free_pools.push_front(_occupied_pools.front()->duplicate());
+                _sem->signal();
+            }
+        }
+    }
+
     _sem->wait();
     arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
     ARM_COMPUTE_ERROR_ON_MSG(_free_pools.empty(), "Empty pool must exist as semaphore has been signalled");
@@ -59,6 +81,15 @@ void PoolManager::unlock_pool(IMemoryPool *pool)
     });
     ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_occupied_pools), "Pool to be unlocked couldn't be found!");
     _free_pools.splice(std::begin(_free_pools), _occupied_pools, it);
+
+    // Destroy a surplus pool instead of returning it when the manager has been idle;
+    // the semaphore is not signalled, keeping its count equal to the free pools
+    const bool has_surplus = (_free_pools.size() + _occupied_pools.size()) > _base_pools;
+    if(_max_pools > 0 && has_surplus && (std::chrono::steady_clock::now() - _last_exhausted) > _idle_release)
+    {
+        _free_pools.pop_front();
+        return;
+    }
     _sem->signal();
 }
 
@@ -69,6 +100,7 @@ void PoolManager::register_pool(std::unique_ptr<IMemoryPool> pool)
 
     // Set pool
     _free_pools.push_front(std::move(pool));
+    _base_pools = _free_pools.size();
 
     // Update semaphore
     _sem = arm_compute::support::cpp14::make_unique<arm_compute::Semaphore>(_free_pools.size());
@@ -84,6 +116,7 @@ std::unique_ptr<IMemoryPool> PoolManager::release_pool()
         std::unique_ptr<IMemoryPool> pool = std::move(_free_pools.front());
         ARM_COMPUTE_ERROR_ON(_free_pools.front() != nullptr);
         _free_pools.pop_front();
+        _base_pools = std::min(_base_pools, _free_pools.size());
 
         // Update semaphore
         _sem = arm_compute::support::cpp14::make_unique<arm_compute::Semaphore>(_free_pools.size());
@@ -99,6 +132,7 @@ void PoolManager::clear_pools()
     arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
     ARM_COMPUTE_ERROR_ON_MSG(!_occupied_pools.empty(), "All pools should be free in order to clear the PoolManager!");
     _free_pools.clear();
+    _base_pools = 0;
 
     // Update semaphore
     _sem = nullptr;
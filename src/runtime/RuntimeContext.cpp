@@ -53,4 +53,9 @@ const DeviceProperties &RuntimeContext::properties()
 {
     return _device_props;
 }
+
+OperatorKernelCache *RuntimeContext::kernel_cache()
+{
+    return &_kernel_cache;
+}
 } // namespace arm_compute
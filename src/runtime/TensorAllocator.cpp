@@ -31,11 +31,33 @@
 #include "support/MemorySupport.h"
 
 #include <cstddef>
+#include <cstring>
+#if !defined(BARE_METAL) && !defined(_WIN64)
+#include <sys/mman.h>
+#endif /* !defined(BARE_METAL) && !defined(_WIN64) */
 
 using namespace arm_compute;
 
 namespace
 {
+/** Commits the pages of a freshly allocated buffer according to the allocation policy */
+void commit_pages(void *ptr, size_t size, AllocationPolicy policy)
+{
+    if(ptr == nullptr || size == 0 || policy == AllocationPolicy::Lazy)
+    {
+        return;
+    }
+
+    // Touch every page so the first inference does not pay the soft faults
+    std::memset(ptr, 0, size);
+#if !defined(BARE_METAL) && !defined(_WIN64)
+    if(policy == AllocationPolicy::Pinned)
+    {
+        mlock(ptr, size);
+    }
+#endif /* !defined(BARE_METAL) && !defined(_WIN64) */
+}
+
 bool validate_subtensor_shape(const TensorInfo &parent_info, const TensorInfo &child_info, const Coordinates &coords)
 {
     bool               is_valid     = true;
@@ -137,6 +159,7 @@ void TensorAllocator::allocate()
     if(_associated_memory_group == nullptr)
     {
         _memory.set_owned_region(support::cpp14::make_unique<MemoryRegion>(info().total_size(), alignment_to_use));
+        commit_pages(_memory.region()->buffer(), _memory.region()->size(), allocation_policy());
     }
     else
     {
@@ -147,6 +170,14 @@ void TensorAllocator::allocate()
 
 void TensorAllocator::free()
 {
+#if !defined(BARE_METAL) && !defined(_WIN64)
+    // Unlock pinned pages before the backing memory returns to the heap, so repeated
+    // allocations do not accumulate towards the memlock limit
+    if(allocation_policy() == AllocationPolicy::Pinned && _memory.region() != nullptr && _memory.region()->buffer() != nullptr)
+    {
+        munlock(_memory.region()->buffer(), _memory.region()->size());
+    }
+#endif /* !defined(BARE_METAL) && !defined(_WIN64) */
     _memory.set_region(nullptr);
     info().set_is_resizable(true);
 }
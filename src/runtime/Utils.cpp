@@ -63,6 +63,19 @@ void schedule_kernel_on_ctx(IRuntimeContext *ctx, ICPPKernel *kernel, const ISch
     }
 }
 
+void schedule_op_on_ctx(IRuntimeContext *ctx, ICPPKernel *kernel, const IScheduler::Hints &hints, ITensorPack &tensors)
+{
+    if(ctx)
+    {
+        ARM_COMPUTE_ERROR_ON(ctx->scheduler() == nullptr);
+        ctx->scheduler()->schedule_op(kernel, hints, tensors);
+    }
+    else
+    {
+        NEScheduler::get().schedule_op(kernel, hints, tensors);
+    }
+}
+
 unsigned int calculate_number_of_stages_only_x_axis(size_t input_x_dimension, unsigned int axis)
 {
     // We need only 1 stage for all axis except x-axis
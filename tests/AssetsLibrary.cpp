@@ -27,6 +27,7 @@
 #include "utils/TypePrinter.h"
 
 #include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/utils/misc/MMappedFile.h"
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wunused-parameter"
@@ -35,11 +36,13 @@
 
 #include <cctype>
 #include <fstream>
+#include <istream>
 #include <limits>
 #include <map>
 #include <mutex>
 #include <sstream>
 #include <stdexcept>
+#include <streambuf>
 #include <tuple>
 #include <unordered_map>
 #include <utility>
@@ -102,7 +105,7 @@ void extract_b_from_rgb(const RawTensor &src, RawTensor &dst)
     }
 }
 
-void discard_comments(std::ifstream &fs)
+void discard_comments(std::istream &fs)
 {
     while(fs.peek() == '#')
     {
@@ -110,7 +113,7 @@ void discard_comments(std::ifstream &fs)
     }
 }
 
-void discard_comments_and_spaces(std::ifstream &fs)
+void discard_comments_and_spaces(std::istream &fs)
 {
     while(true)
     {
@@ -125,7 +128,7 @@ void discard_comments_and_spaces(std::ifstream &fs)
     }
 }
 
-std::tuple<unsigned int, unsigned int, int> parse_netpbm_format_header(std::ifstream &fs, char number)
+std::tuple<unsigned int, unsigned int, int> parse_netpbm_format_header(std::istream &fs, char number)
 {
     // check file type magic number is valid
     std::array<char, 2> magic_number{ { 0 } };
@@ -173,17 +176,7 @@ std::tuple<unsigned int, unsigned int, int> parse_netpbm_format_header(std::ifst
     return std::make_tuple(width, height, max_value);
 }
 
-std::tuple<unsigned int, unsigned int, int> parse_ppm_header(std::ifstream &fs)
-{
-    return parse_netpbm_format_header(fs, '6');
-}
-
-std::tuple<unsigned int, unsigned int, int> parse_pgm_header(std::ifstream &fs)
-{
-    return parse_netpbm_format_header(fs, '5');
-}
-
-void check_image_size(std::ifstream &fs, size_t raw_size)
+void check_image_size(std::istream &fs, size_t raw_size)
 {
     const size_t current_position = fs.tellg();
     fs.seekg(0, std::ios_base::end);
@@ -196,7 +189,7 @@ void check_image_size(std::ifstream &fs, size_t raw_size)
     }
 }
 
-void read_image_buffer(std::ifstream &fs, RawTensor &raw)
+void read_image_buffer(std::istream &fs, RawTensor &raw)
 {
     fs.read(reinterpret_cast<std::fstream::char_type *>(raw.data()), raw.size());
 
@@ -206,49 +199,125 @@ void read_image_buffer(std::ifstream &fs, RawTensor &raw)
     }
 }
 
-RawTensor load_ppm(const std::string &path)
+#if !defined(BARE_METAL)
+/** Stream buffer exposing a read-only memory range, used to parse mapped assets in place */
+class MemoryStreamBuf final : public std::streambuf
 {
-    std::ifstream file(path, std::ios::in | std::ios::binary);
-
-    if(!file.good())
+public:
+    /** Construct over the given byte range */
+    MemoryStreamBuf(const unsigned char *data, size_t size)
     {
-        throw framework::FileNotFound("Could not load PPM image: " + path);
+        char *begin = const_cast<char *>(reinterpret_cast<const char *>(data));
+        setg(begin, begin, begin + size);
     }
 
-    unsigned int width  = 0;
-    unsigned int height = 0;
+protected:
+    // Inherited methods overridden (needed for tellg/seekg on the wrapping istream):
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override
+    {
+        ARM_COMPUTE_UNUSED(which);
+        char *target = gptr();
+        switch(dir)
+        {
+            case std::ios_base::beg:
+                target = eback() + off;
+                break;
+            case std::ios_base::cur:
+                target = gptr() + off;
+                break;
+            case std::ios_base::end:
+                target = egptr() + off;
+                break;
+            default:
+                return pos_type(off_type(-1));
+        }
+        if(target < eback() || target > egptr())
+        {
+            return pos_type(off_type(-1));
+        }
+        setg(eback(), target, egptr());
+        return pos_type(target - eback());
+    }
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override
+    {
+        return seekoff(off_type(pos), std::ios_base::beg, which);
+    }
+};
 
-    std::tie(width, height, std::ignore) = parse_ppm_header(file);
+/** Returns a shared read-only mapping of an asset file
+ *
+ * Mappings live for the whole process, so fixtures parsing the same asset share one
+ * mapping and repeated benchmark sweeps are served from the page cache instead of
+ * re-reading from storage.
+ */
+utils::mmap_io::MMappedFile &get_mapped_asset(const std::string &path)
+{
+    static std::map<std::string, utils::mmap_io::MMappedFile> mapped_assets;
+    static std::mutex                                         mapped_assets_mutex;
 
-    RawTensor raw(TensorShape(width, height), Format::RGB888);
+    std::lock_guard<std::mutex> lock(mapped_assets_mutex);
+    auto                        it = mapped_assets.find(path);
+    if(it != mapped_assets.end())
+    {
+        return it->second;
+    }
 
-    check_image_size(file, raw.size());
-    read_image_buffer(file, raw);
+    // MMappedFile creates missing files on map: probe first so a missing asset
+    // surfaces as FileNotFound instead of leaving an empty file behind
+    std::ifstream probe(path, std::ios::in | std::ios::binary);
+    if(!probe.good())
+    {
+        throw framework::FileNotFound("Could not load file: " + path);
+    }
+    probe.close();
 
-    return raw;
+    utils::mmap_io::MMappedFile &file = mapped_assets[path];
+    if(!file.map(path, 0, 0) || !file.is_mapped())
+    {
+        mapped_assets.erase(path);
+        throw std::runtime_error("Could not map file: " + path);
+    }
+    return file;
 }
+#endif /* !defined(BARE_METAL) */
 
-RawTensor load_pgm(const std::string &path)
+RawTensor load_netpbm(const std::string &path, char number, Format format)
 {
+#if !defined(BARE_METAL)
+    utils::mmap_io::MMappedFile &asset = get_mapped_asset(path);
+    MemoryStreamBuf              buffer(asset.data(), asset.file_size());
+    std::istream                 file(&buffer);
+#else  /* !defined(BARE_METAL) */
     std::ifstream file(path, std::ios::in | std::ios::binary);
 
     if(!file.good())
     {
-        throw framework::FileNotFound("Could not load PGM image: " + path);
+        throw framework::FileNotFound("Could not load file: " + path);
     }
+#endif /* !defined(BARE_METAL) */
 
     unsigned int width  = 0;
     unsigned int height = 0;
 
-    std::tie(width, height, std::ignore) = parse_pgm_header(file);
+    std::tie(width, height, std::ignore) = parse_netpbm_format_header(file, number);
 
-    RawTensor raw(TensorShape(width, height), Format::U8);
+    RawTensor raw(TensorShape(width, height), format);
 
     check_image_size(file, raw.size());
     read_image_buffer(file, raw);
 
     return raw;
 }
+
+RawTensor load_ppm(const std::string &path)
+{
+    return load_netpbm(path, '6', Format::RGB888);
+}
+
+RawTensor load_pgm(const std::string &path)
+{
+    return load_netpbm(path, '5', Format::U8);
+}
 } // namespace
 
 AssetsLibrary::AssetsLibrary(std::string path, std::random_device::result_type seed) //NOLINT
@@ -123,6 +123,15 @@ public:
         add_config(TensorShape(5U, 4U, 6U), TensorShape(30U), -1);
         add_config(TensorShape(3U, 5U, 7U), TensorShape(20U), -2);
 
+        // Axis-1 row-copy fast path: row sizes around its 32-byte copy width (exact
+        // multiple, one element short and one element over, per data type size) and
+        // more indices than rows, so repeated out-of-order indices are gathered
+        add_config(TensorShape(32U, 7U), TensorShape(40U), 1);
+        add_config(TensorShape(31U, 7U), TensorShape(9U), 1);
+        add_config(TensorShape(33U, 7U), TensorShape(9U), 1);
+        add_config(TensorShape(8U, 3U, 5U), TensorShape(12U), 1);
+        add_config(TensorShape(3U, 6U, 4U), TensorShape(11U), 1);
+
         // 4D input
         add_config(TensorShape(4U, 3U, 4U, 5U), TensorShape(4U), 0);
         add_config(TensorShape(4U, 3U, 5U, 5U), TensorShape(5U), 1);
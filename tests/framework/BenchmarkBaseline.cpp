@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "BenchmarkBaseline.h"
+
+#include <cmath>
+#include <fstream>
+#include <sstream>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace framework
+{
+namespace
+{
+/** Two-sided critical value of the t-distribution at the 95% confidence level,
+ * in the large sample limit. Benchmark runs rarely collect enough iterations to
+ * make the exact small-sample correction matter against a >x% threshold.
+ */
+constexpr double t_critical_95 = 1.96;
+} // namespace
+
+bool BenchmarkBaseline::load(const std::string &filename)
+{
+    std::ifstream stream(filename);
+    if(!stream.good())
+    {
+        return false;
+    }
+
+    _entries.clear();
+
+    std::string line;
+    while(!std::getline(stream, line).fail())
+    {
+        if(line.empty() || line[0] == '#')
+        {
+            continue;
+        }
+
+        // Numeric fields first, the key (which may contain spaces) runs to the end of the line
+        std::istringstream stream_line(line);
+        Entry              entry{};
+        std::string        key;
+        stream_line >> entry.mean >> entry.stddev >> entry.num_samples >> std::ws;
+        if(std::getline(stream_line, key).fail() || key.empty())
+        {
+            continue;
+        }
+        _entries[key] = entry;
+    }
+    return true;
+}
+
+bool BenchmarkBaseline::save(const std::string &filename) const
+{
+    std::ofstream stream(filename);
+    if(!stream.good())
+    {
+        return false;
+    }
+
+    stream << "# mean stddev num_samples key\n";
+    for(const auto &entry : _entries)
+    {
+        stream << entry.second.mean << " " << entry.second.stddev << " " << entry.second.num_samples << " " << entry.first << "\n";
+    }
+    return stream.good();
+}
+
+void BenchmarkBaseline::record(const std::string &key, double mean, double stddev, unsigned long long num_samples)
+{
+    _entries[key] = Entry{ mean, stddev, num_samples };
+}
+
+const BenchmarkBaseline::Entry *BenchmarkBaseline::find(const std::string &key) const
+{
+    const auto it = _entries.find(key);
+    return (it != _entries.end()) ? &it->second : nullptr;
+}
+
+bool BenchmarkBaseline::empty() const
+{
+    return _entries.empty();
+}
+
+bool BenchmarkBaseline::is_regression(const Entry &baseline, const Entry &current, double threshold)
+{
+    if(baseline.mean <= 0.0)
+    {
+        return false;
+    }
+
+    const double relative_increase = 100.0 * (current.mean - baseline.mean) / baseline.mean;
+    if(relative_increase <= threshold)
+    {
+        return false;
+    }
+
+    // Welch's t-test on the two sample sets; with a single sample (or zero
+    // variance) on either side no significance can be established and the
+    // threshold alone decides.
+    if(baseline.num_samples < 2 || current.num_samples < 2)
+    {
+        return true;
+    }
+    const double variance_term = (baseline.stddev * baseline.stddev) / baseline.num_samples + (current.stddev * current.stddev) / current.num_samples;
+    if(variance_term <= 0.0)
+    {
+        return true;
+    }
+    const double t = (current.mean - baseline.mean) / std::sqrt(variance_term);
+    return t > t_critical_95;
+}
+} // namespace framework
+} // namespace test
+} // namespace arm_compute
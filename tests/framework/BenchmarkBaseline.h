@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_TEST_BENCHMARK_BASELINE
+#define ARM_COMPUTE_TEST_BENCHMARK_BASELINE
+
+#include <map>
+#include <string>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace framework
+{
+/** Stored benchmark measurement summaries, used as the reference of a regression comparison.
+ *
+ * A baseline maps a key, formed from the test name and the instrument header of
+ * a measurement, to the summary statistics of that measurement's samples. The
+ * summaries of a run can be saved to a plain text file and reloaded by a later
+ * run to detect performance regressions.
+ */
+class BenchmarkBaseline
+{
+public:
+    /** Summary statistics of one measurement */
+    struct Entry
+    {
+        double             mean{ 0.0 };   /**< Mean of the collected samples */
+        double             stddev{ 0.0 }; /**< Standard deviation of the collected samples */
+        unsigned long long num_samples{ 0 }; /**< Number of collected samples */
+    };
+
+    /** Load baseline entries from a file.
+     *
+     * @param[in] filename File to load the entries from.
+     *
+     * @return True if the file could be opened and parsed.
+     */
+    bool load(const std::string &filename);
+
+    /** Save all entries to a file.
+     *
+     * @param[in] filename File to save the entries to.
+     *
+     * @return True if the file could be written.
+     */
+    bool save(const std::string &filename) const;
+
+    /** Add or replace the entry of a measurement.
+     *
+     * @param[in] key         Key identifying the measurement.
+     * @param[in] mean        Mean of the samples.
+     * @param[in] stddev      Standard deviation of the samples.
+     * @param[in] num_samples Number of samples.
+     */
+    void record(const std::string &key, double mean, double stddev, unsigned long long num_samples);
+
+    /** Look up the entry of a measurement.
+     *
+     * @param[in] key Key identifying the measurement.
+     *
+     * @return Pointer to the entry if present else nullptr.
+     */
+    const Entry *find(const std::string &key) const;
+
+    /** Check if the baseline contains any entries.
+     *
+     * @return True if no entries are stored.
+     */
+    bool empty() const;
+
+    /** Check whether a measurement regressed against a baseline entry.
+     *
+     * A measurement is reported as a regression if its mean exceeds the
+     * baseline mean by more than @p threshold percent and the difference is
+     * statistically significant at the 95% confidence level according to
+     * Welch's t-test. If either side carries too few samples to estimate a
+     * variance the significance test is skipped and only the threshold is
+     * applied.
+     *
+     * @param[in] baseline  Baseline entry to compare against.
+     * @param[in] current   Entry of the current run.
+     * @param[in] threshold Minimum relative increase of the mean, as a percentage, to report.
+     *
+     * @return True if @p current is a regression against @p baseline.
+     */
+    static bool is_regression(const Entry &baseline, const Entry &current, double threshold);
+
+private:
+    std::map<std::string, Entry> _entries{};
+};
+} // namespace framework
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_BENCHMARK_BASELINE */
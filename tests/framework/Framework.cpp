@@ -27,6 +27,7 @@
 #include "support/MemorySupport.h"
 #include "tests/framework/ParametersLibrary.h"
 #include "tests/framework/TestFilter.h"
+#include "tests/framework/instruments/InstrumentsStats.h"
 
 #ifdef ARM_COMPUTE_CL
 #include "arm_compute/runtime/CL/CLRuntimeContext.h"
@@ -35,9 +36,11 @@
 #endif /* ARM_COMPUTE_CL */
 
 #include <chrono>
+#include <iomanip>
 #include <iostream>
 #include <sstream>
 #include <type_traits>
+#include <vector>
 
 namespace arm_compute
 {
@@ -290,6 +293,13 @@ bool Framework::error_on_missing_assets() const
     return _error_on_missing_assets;
 }
 
+void Framework::set_baseline_options(std::string load_file, std::string store_file, double threshold)
+{
+    _baseline_load_file  = std::move(load_file);
+    _baseline_store_file = std::move(store_file);
+    _regression_threshold = threshold;
+}
+
 void Framework::run_test(const TestInfo &info, TestCaseFactory &test_factory)
 {
     if(test_factory.status() == TestCaseFactory::Status::DISABLED)
@@ -537,6 +547,92 @@ void Framework::run_test(const TestInfo &info, TestCaseFactory &test_factory)
     log_test_end(info);
 }
 
+bool Framework::compare_against_baseline()
+{
+    if(_baseline_load_file.empty() && _baseline_store_file.empty())
+    {
+        return true;
+    }
+
+    const bool have_reference = !_baseline_load_file.empty() && _baseline.load(_baseline_load_file);
+    if(!_baseline_load_file.empty() && !have_reference && _log_level > LogLevel::NONE)
+    {
+        std::cout << "Could not load benchmark baseline from '" << _baseline_load_file << "'\n";
+    }
+
+    std::vector<std::string> regressions;
+    std::vector<std::string> improvements;
+
+    for(const auto &test : _test_results)
+    {
+        for(const auto &instrument : test.second.measurements)
+        {
+            if(instrument.second.empty())
+            {
+                continue;
+            }
+
+            const InstrumentsStats    stats(instrument.second);
+            const Measurement::Value &mean_value = stats.mean();
+
+            BenchmarkBaseline::Entry current{};
+            current.mean        = mean_value.is_floating_point ? mean_value.v.floating_point : static_cast<double>(mean_value.v.integer);
+            current.stddev      = stats.relative_standard_deviation() / 100.0 * current.mean;
+            current.num_samples = instrument.second.size();
+
+            const std::string key = test.first.name + "/" + instrument.first;
+            _new_baseline.record(key, current.mean, current.stddev, current.num_samples);
+
+            if(!have_reference)
+            {
+                continue;
+            }
+
+            const BenchmarkBaseline::Entry *reference = _baseline.find(key);
+            if(reference == nullptr || reference->mean <= 0.0)
+            {
+                continue;
+            }
+
+            std::stringstream diff;
+            diff << "  " << key << ": " << reference->mean << " -> " << current.mean
+                 << " (" << std::showpos << std::fixed << std::setprecision(2)
+                 << 100.0 * (current.mean - reference->mean) / reference->mean << "%)";
+
+            if(BenchmarkBaseline::is_regression(*reference, current, _regression_threshold))
+            {
+                regressions.emplace_back(diff.str());
+            }
+            else if(BenchmarkBaseline::is_regression(current, *reference, _regression_threshold))
+            {
+                improvements.emplace_back(diff.str());
+            }
+        }
+    }
+
+    if(have_reference && _log_level > LogLevel::NONE)
+    {
+        std::cout << "Baseline comparison against '" << _baseline_load_file << "' (threshold " << _regression_threshold << "%): "
+                  << regressions.size() << " regression(s), " << improvements.size() << " improvement(s)\n";
+        for(const auto &line : regressions)
+        {
+            std::cout << line << " REGRESSION\n";
+        }
+        for(const auto &line : improvements)
+        {
+            std::cout << line << " improvement\n";
+        }
+    }
+
+    if(!_baseline_store_file.empty() && !_new_baseline.save(_baseline_store_file) && _log_level > LogLevel::NONE)
+    {
+        std::cout << "Could not store benchmark baseline to '" << _baseline_store_file << "'\n";
+    }
+
+    const bool comparison_ok = _baseline_load_file.empty() || have_reference;
+    return regressions.empty() && comparison_ok;
+}
+
 bool Framework::run()
 {
     // Clear old test results
@@ -612,9 +708,11 @@ bool Framework::run()
                   << results[TestResult::Status::DISABLED] << " disabled) in " << runtime.count() << " second(s)\n";
     }
 
+    const bool baseline_ok = compare_against_baseline();
+
     int num_successful_tests = results[TestResult::Status::SUCCESS] + results[TestResult::Status::EXPECTED_FAILURE] + results[TestResult::Status::DISABLED];
 
-    return (static_cast<unsigned int>(num_successful_tests) == _test_results.size());
+    return (static_cast<unsigned int>(num_successful_tests) == _test_results.size()) && baseline_ok;
 }
 
 void Framework::set_test_result(TestInfo info, TestResult result)
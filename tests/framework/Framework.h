@@ -24,6 +24,7 @@
 #ifndef ARM_COMPUTE_TEST_FRAMEWORK
 #define ARM_COMPUTE_TEST_FRAMEWORK
 
+#include "BenchmarkBaseline.h"
 #include "DatasetModes.h"
 #include "Exceptions.h"
 #include "Profiler.h"
@@ -251,6 +252,20 @@ public:
      */
     void set_error_on_missing_assets(bool error_on_missing_assets);
 
+    /** Configure benchmark baseline comparison and storage.
+     *
+     * If @p load_file is non-empty the measurements of the run are compared
+     * against the baseline stored in it; regressions of more than
+     * @p threshold percent that are statistically significant are reported in
+     * a diff report and make the run fail. If @p store_file is non-empty the
+     * measurement summaries of the run are saved to it as a new baseline.
+     *
+     * @param[in] load_file  File to load the reference baseline from. Empty disables the comparison.
+     * @param[in] store_file File to save the baseline of this run to. Empty disables saving.
+     * @param[in] threshold  Minimum relative increase of a mean, as a percentage, to report as regression.
+     */
+    void set_baseline_options(std::string load_file, std::string store_file, double threshold);
+
     /** Run all enabled test cases.
      *
      * @return True if all test cases executed successful.
@@ -316,6 +331,7 @@ private:
 
     void run_test(const TestInfo &info, TestCaseFactory &test_factory);
     std::map<TestResult::Status, int> count_test_results() const;
+    bool compare_against_baseline();
 
     /** Returns the current test suite name.
      *
@@ -340,6 +356,11 @@ private:
     bool                   _stop_on_error{ false };
     bool                   _error_on_missing_assets{ false };
     std::vector<Printer *> _printers{};
+    BenchmarkBaseline      _baseline{};
+    BenchmarkBaseline      _new_baseline{};
+    std::string            _baseline_load_file{};
+    std::string            _baseline_store_file{};
+    double                 _regression_threshold{ 5.0 };
 
     using create_function = std::unique_ptr<Instrument>();
     std::map<InstrumentsDescription, create_function *> _available_instruments{};
@@ -149,6 +149,12 @@ int main(int argc, char **argv)
     threads->set_help("Number of threads to use");
     auto cooldown_sec = parser.add_option<utils::SimpleOption<float>>("delay", -1.f);
     cooldown_sec->set_help("Delay to add between test executions in seconds");
+    auto baseline_file = parser.add_option<utils::SimpleOption<std::string>>("baseline-file", "");
+    baseline_file->set_help("File with a stored benchmark baseline to compare measurements against; significant regressions make the run fail");
+    auto store_baseline_file = parser.add_option<utils::SimpleOption<std::string>>("store-baseline-file", "");
+    store_baseline_file->set_help("File to store the benchmark baseline of this run to");
+    auto regression_threshold = parser.add_option<utils::SimpleOption<float>>("regression-threshold", 5.f);
+    regression_threshold->set_help("Minimum relative increase of a measurement mean, in percent, to report as regression");
 
     try
     {
@@ -285,6 +291,7 @@ int main(int argc, char **argv)
         framework.set_throw_errors(options.throw_errors->value());
         framework.set_stop_on_error(stop_on_error->value());
         framework.set_error_on_missing_assets(error_on_missing_assets->value());
+        framework.set_baseline_options(baseline_file->value(), store_baseline_file->value(), regression_threshold->value());
 
         bool success = true;
 
@@ -275,7 +275,9 @@ FIXTURE_DATA_TEST_CASE(RunSmall,
                                                        framework::dataset::make("ConvertPolicy", { ConvertPolicy::SATURATE })),
                                                framework::dataset::make("Src0QInfo", { QuantizationInfo(1.f / 32768.f, 0), QuantizationInfo(5.f / 32768.f, 0) })),
                                        framework::dataset::make("Src1QInfo", { QuantizationInfo(2.f / 32768.f, 0), QuantizationInfo(5.f / 32768.f, 0) })),
-                               framework::dataset::make("OutQInfo", { QuantizationInfo(5.f / 32768.f, 0) })))
+                               // Output scales above and below the input scales exercise both the
+                               // right-shift and left-shift sides of the fixed-point rescale
+                               framework::dataset::make("OutQInfo", { QuantizationInfo(5.f / 32768.f, 0), QuantizationInfo(1.f / 32768.f, 0) })))
 {
     // Validate output
 #ifdef __aarch64__
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEConcatenateLayer.h"
+#include "arm_compute/runtime/SubTensor.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/Globals.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/Utils.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/reference/ConcatenateLayer.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+/** Writes the reference data into @p view as a producer configured onto it would */
+void write_through_view(ITensor &view, const SimpleTensor<float> &src)
+{
+    Window win;
+    win.use_tensor_dimensions(view.info()->tensor_shape());
+    Iterator it(&view, win);
+    execute_window_loop(win, [&](const Coordinates &id)
+    {
+        *reinterpret_cast<float *>(it.ptr()) = src[coord2index(src.shape(), id)];
+    },
+    it);
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(ConcatenateLayer)
+
+DATA_TEST_CASE(WriteThrough, framework::DatasetMode::ALL, framework::dataset::make("Axis", { 0U, 1U, 2U, 3U }),
+               axis)
+{
+    // Three inputs along the concatenation axis: the first and last are written
+    // through sub-tensor views of the output, the middle one is a standalone
+    // tensor that still has to go down the copy path
+    const TensorShape base_shape(7U, 5U, 4U, 3U);
+    const size_t      sizes[3] = { 2U, 3U, 2U };
+
+    std::vector<TensorShape> shapes(3, base_shape);
+    TensorShape              dst_shape = base_shape;
+    dst_shape.set(axis, sizes[0] + sizes[1] + sizes[2]);
+    for(size_t i = 0; i < 3; ++i)
+    {
+        shapes[i].set(axis, sizes[i]);
+    }
+
+    // Create tensors and views into the output
+    Tensor      dst = create_tensor<Tensor>(dst_shape, DataType::F32);
+    Tensor      in1 = create_tensor<Tensor>(shapes[1], DataType::F32);
+    Coordinates coords0{};
+    Coordinates coords2{};
+    coords2.set(axis, sizes[0] + sizes[1]);
+    SubTensor view0(&dst, shapes[0], coords0);
+    SubTensor view2(&dst, shapes[2], coords2);
+
+    // Create and configure function
+    NEConcatenateLayer concat;
+    concat.configure({ &view0, &in1, &view2 }, &dst, axis);
+
+    // Allocate tensors
+    dst.allocator()->allocate();
+    in1.allocator()->allocate();
+
+    // Fill tensors; the view inputs are written in place as their producers would
+    std::vector<SimpleTensor<float>> ref_srcs;
+    for(size_t i = 0; i < 3; ++i)
+    {
+        ref_srcs.emplace_back(shapes[i], DataType::F32);
+        library->fill_tensor_uniform(ref_srcs[i], i);
+    }
+    write_through_view(view0, ref_srcs[0]);
+    write_through_view(view2, ref_srcs[2]);
+    library->fill_tensor_uniform(Accessor(in1), 1);
+
+    // Compute function
+    concat.run();
+
+    // Validate output against a plain concatenation of the three inputs
+    SimpleTensor<float> ref_dst{ dst_shape, DataType::F32 };
+    validate(Accessor(dst), reference::concatenate_layer(ref_srcs, ref_dst, axis));
+}
+
+TEST_SUITE_END() // ConcatenateLayer
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -369,6 +369,35 @@ TEST_SUITE_END() // WinogradLayer
 TEST_SUITE(GEMMConvolutionLayer)
 template <typename T>
 using NEGEMMConvolutionLayerFixture = ConvolutionValidationFixture<Tensor, Accessor, NEGEMMConvolutionLayer, T>;
+template <typename T>
+using NEGEMMConvolutionLayerResidualFixture = ConvolutionResidualValidationFixture<Tensor, Accessor, NEGEMMConvolutionLayer, T>;
+
+TEST_CASE(ValidateResidual, framework::DatasetMode::ALL)
+{
+    // The residual add is fused into the col2im epilogue, so it is accepted on the
+    // NCHW path and rejected when NHWC skips col2im
+    {
+        const TensorInfo input(TensorShape(23U, 27U, 5U), 1, DataType::F32);
+        const TensorInfo weights(TensorShape(3U, 3U, 5U, 21U), 1, DataType::F32);
+        const TensorInfo bias(TensorShape(21U), 1, DataType::F32);
+        const TensorInfo output(TensorShape(23U, 27U, 21U), 1, DataType::F32);
+        const Status     status = NEGEMMConvolutionLayer::validate(&input, &weights, &bias, &output, PadStrideInfo(1, 1, 1, 1), WeightsInfo(), Size2D(1U, 1U), ActivationLayerInfo(), 1, false,
+                                                                   &output);
+        ARM_COMPUTE_EXPECT(bool(status), framework::LogLevel::ERRORS);
+    }
+    {
+        TensorInfo input(TensorShape(5U, 23U, 27U), 1, DataType::F32);
+        TensorInfo weights(TensorShape(5U, 3U, 3U, 21U), 1, DataType::F32);
+        TensorInfo bias(TensorShape(21U), 1, DataType::F32);
+        TensorInfo output(TensorShape(21U, 23U, 27U), 1, DataType::F32);
+        input.set_data_layout(DataLayout::NHWC);
+        weights.set_data_layout(DataLayout::NHWC);
+        output.set_data_layout(DataLayout::NHWC);
+        const Status status = NEGEMMConvolutionLayer::validate(&input, &weights, &bias, &output, PadStrideInfo(1, 1, 1, 1), WeightsInfo(), Size2D(1U, 1U), ActivationLayerInfo(), 1, false,
+                                                               &output);
+        ARM_COMPUTE_EXPECT(!bool(status), framework::LogLevel::ERRORS);
+    }
+}
 
 TEST_SUITE(Float)
 #if defined(__ARM_FEATURE_BF16_VECTOR_ARITHMETIC) || defined(ARM_COMPUTE_FORCE_BF16)
@@ -409,6 +438,12 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NEGEMMConvolutionLayerFixture<float>, framework
     // Validate output
     validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, float(abs_tolerance_f32));
 }
+FIXTURE_DATA_TEST_CASE(RunResidual, NEGEMMConvolutionLayerResidualFixture<float>, framework::DatasetMode::PRECOMMIT, combine(datasets::SmallConvolutionLayerDataset(),
+                                                                                                                             framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, float(abs_tolerance_f32));
+}
 TEST_SUITE_END() // FP32
 TEST_SUITE_END() // Float
 
@@ -64,6 +64,25 @@ const auto PermuteVectors4 = framework::dataset::make("PermutationVector",
 const auto PermuteVectors         = concat(PermuteVectors3, PermuteVectors4);
 const auto PermuteParametersSmall = concat(concat(datasets::Small2DShapes(), datasets::Small3DShapes()), datasets::Small4DShapes()) * PermuteVectors;
 const auto PermuteParametersLarge = datasets::Large4DShapes() * PermuteVectors;
+/** The two permutations routed to the NCHW<->NHWC reorder shims */
+const auto PermuteVectorsLayout = framework::dataset::make("PermutationVector",
+{
+    PermutationVector(2U, 0U, 1U),
+    PermutationVector(1U, 2U, 0U),
+});
+/** Shapes exercising the vectorized reorder tiles: row lengths at, just below and just
+ *  above the 16-element (8-bit) and 8-element (16-bit) column tiles, and channel counts
+ *  around the 4-channel block, so the scalar tails of both directions are covered */
+const auto PermuteParametersReorder = framework::dataset::make("Shape",
+{
+    TensorShape{ 16U, 4U, 4U },
+                 TensorShape{ 15U, 3U, 5U },
+                 TensorShape{ 17U, 5U, 3U },
+                 TensorShape{ 8U, 9U, 6U },
+                 TensorShape{ 32U, 2U, 7U, 2U },
+                 TensorShape{ 33U, 2U, 6U, 2U }
+})
+* PermuteVectorsLayout;
 } // namespace
 TEST_SUITE(NEON)
 TEST_SUITE(Permute)
@@ -154,6 +173,13 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NEPermuteFixture<uint8_t>, framework::DatasetMo
     validate(Accessor(_target), _reference);
 }
 
+FIXTURE_DATA_TEST_CASE(RunReorder, NEPermuteFixture<uint8_t>, framework::DatasetMode::PRECOMMIT,
+                       PermuteParametersReorder * framework::dataset::make("DataType", DataType::U8))
+{
+    // Validate output
+    validate(Accessor(_target), _reference);
+}
+
 FIXTURE_DATA_TEST_CASE(RunLarge, NEPermuteFixture<uint8_t>, framework::DatasetMode::NIGHTLY,
                        PermuteParametersLarge * framework::dataset::make("DataType", DataType::U8))
 {
@@ -169,6 +195,13 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NEPermuteFixture<uint16_t>, framework::DatasetM
     // Validate output
     validate(Accessor(_target), _reference);
 }
+FIXTURE_DATA_TEST_CASE(RunReorder, NEPermuteFixture<uint16_t>, framework::DatasetMode::PRECOMMIT,
+                       PermuteParametersReorder * framework::dataset::make("DataType", DataType::U16))
+{
+    // Validate output
+    validate(Accessor(_target), _reference);
+}
+
 FIXTURE_DATA_TEST_CASE(RunLarge, NEPermuteFixture<uint16_t>, framework::DatasetMode::NIGHTLY,
                        PermuteParametersLarge * framework::dataset::make("DataType", DataType::U16))
 {
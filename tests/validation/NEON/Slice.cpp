@@ -81,6 +81,55 @@ DATA_TEST_CASE(Configuration,
     validate(dst.info()->valid_region(), valid_region);
 }
 
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(ContiguousView, framework::DatasetMode::ALL, zip(zip(zip(
+        framework::dataset::make("Shape", { TensorShape(27U),             // Rank-1 interval
+                                            TensorShape(27U, 8U, 4U),     // Outer interval over full lower dimensions
+                                            TensorShape(27U, 8U, 4U),     // Negative end on the outer dimension
+                                            TensorShape(27U, 3U, 1U, 1U), // Single-element upper dimensions
+                                            TensorShape(27U, 8U, 4U),     // Partial innermost dimension
+                                            TensorShape(27U, 8U, 4U)      // Partial middle dimension
+        }),
+        framework::dataset::make("Starts", { Coordinates(3), Coordinates(0, 0, 1), Coordinates(0, 0, 1), Coordinates(0, 1, 0, 0), Coordinates(3, 0, 0), Coordinates(0, 2, 0) })),
+        framework::dataset::make("Ends", { Coordinates(13), Coordinates(27, 8, 3), Coordinates(27, 8, -1), Coordinates(27, 3, 1, 1), Coordinates(13, 8, 4), Coordinates(27, 6, 4) })),
+        framework::dataset::make("ExpectedView", { true, true, true, true, false, false })),
+               shape, starts, ends, expected_view)
+{
+    // Create tensors
+    Tensor src = create_tensor<Tensor>(shape, DataType::F32);
+    Tensor dst;
+
+    // Create and configure function
+    NESlice slice;
+    slice.configure(&src, &dst, starts, ends);
+
+    // A view-ineligible slice runs the copy kernel and needs its own output buffer
+    src.allocator()->allocate();
+    if(!expected_view)
+    {
+        dst.allocator()->allocate();
+    }
+
+    // Fill tensors
+    library->fill_tensor_uniform(Accessor(src), 0);
+
+    // Compute function
+    slice.run();
+
+    // A contiguous slice must alias the input buffer, the others must not
+    ARM_COMPUTE_EXPECT(dst.buffer() != nullptr, framework::LogLevel::ERRORS);
+    const uint8_t *view_ptr = src.buffer() + src.info()->offset_element_in_bytes(starts);
+    ARM_COMPUTE_EXPECT((dst.buffer() == view_ptr) == expected_view, framework::LogLevel::ERRORS);
+
+    // Validate output
+    SimpleTensor<float> ref_src{ shape, DataType::F32 };
+    library->fill_tensor_uniform(ref_src, 0);
+    validate(Accessor(dst), reference::slice(ref_src, starts, ends));
+}
+// clang-format on
+// *INDENT-ON*
+
 template <typename T>
 using NESliceFixture = SliceFixture<Tensor, Accessor, NESlice, T>;
 
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NESparseTransition.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/Utils.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+TEST_SUITE(NEON)
+TEST_SUITE(SparseTransition)
+
+DATA_TEST_CASE(RoundTrip, framework::DatasetMode::ALL, zip(
+                   framework::dataset::make("Shape", { TensorShape(32U),         // Element count a multiple of 8
+                                                       TensorShape(13U),         // Trailing partially-filled bitmap byte
+                                                       TensorShape(9U, 5U, 3U),  // Multi-dimensional, 135 elements
+                                                       TensorShape(16U)          // All-zero tensor
+                                                     }),
+                   framework::dataset::make("AllZero", { false, false, false, true })),
+               shape, all_zero)
+{
+    const unsigned int num_elements = shape.total_size();
+
+    // Create tensors; the compressed outputs are auto-initialized at configure time
+    Tensor src = create_tensor<Tensor>(shape, DataType::F32);
+    Tensor dst = create_tensor<Tensor>(shape, DataType::F32);
+    Tensor bitmap{};
+    Tensor nonzeros{};
+    Tensor nnz{};
+
+    // Create and configure functions
+    NESparseCompress compress;
+    compress.configure(&src, &bitmap, &nonzeros, &nnz);
+    NESparseDecompress decompress;
+    decompress.configure(&bitmap, &nonzeros, &dst);
+
+    // Allocate tensors
+    src.allocator()->allocate();
+    dst.allocator()->allocate();
+    bitmap.allocator()->allocate();
+    nonzeros.allocator()->allocate();
+    nnz.allocator()->allocate();
+
+    // Fill the input with a deterministic mix of zeros and non-zeros
+    Accessor            src_acc(src);
+    SimpleTensor<float> ref_src{ shape, DataType::F32 };
+    uint32_t            expected_nnz = 0;
+    for(unsigned int i = 0; i < num_elements; ++i)
+    {
+        float value = 0.f;
+        if(!all_zero && (i % 3 != 0))
+        {
+            value = 0.5f + i;
+            ++expected_nnz;
+        }
+        *reinterpret_cast<float *>(src_acc(index2coord(shape, i))) = value;
+        ref_src[i]                                                 = value;
+    }
+
+    // Compute functions
+    compress.run();
+    decompress.run();
+
+    // The reported count must match the non-zeros actually present
+    ARM_COMPUTE_EXPECT(*reinterpret_cast<const uint32_t *>(nnz.buffer()) == expected_nnz, framework::LogLevel::ERRORS);
+
+    // The round trip must reproduce the dense input bit-exactly
+    validate(Accessor(dst), ref_src);
+}
+
+TEST_SUITE_END() // SparseTransition
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
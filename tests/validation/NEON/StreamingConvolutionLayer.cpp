@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEStreamingConvolutionLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/StreamingConvolutionLayerFixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+const RelativeTolerance<float> rel_tolerance_f32(0.01f);  /**< Relative tolerance for FP32 types */
+const AbsoluteTolerance<float> abs_tolerance_f32(0.002f); /**< Absolute tolerance for FP32 types */
+
+/** Streaming configurations: plain stride, stride_x > 1 and a mid-stream reset */
+const auto StreamingConvolutionDataset = zip(zip(zip(zip(zip(zip(zip(
+    framework::dataset::make("InputShape", { TensorShape(4U, 9U, 3U), TensorShape(4U, 9U, 3U), TensorShape(4U, 9U, 3U) }),
+    framework::dataset::make("WeightsShape", { TensorShape(3U, 3U, 3U, 5U), TensorShape(3U, 3U, 3U, 5U), TensorShape(3U, 3U, 3U, 5U) })),
+    framework::dataset::make("BiasShape", { TensorShape(5U), TensorShape(5U), TensorShape(5U) })),
+    framework::dataset::make("OutputShape", { TensorShape(14U, 7U, 5U), TensorShape(7U, 7U, 5U), TensorShape(14U, 7U, 5U) })),
+    framework::dataset::make("ConvInfo", { PadStrideInfo(1, 1, 0, 0), PadStrideInfo(2, 1, 0, 0), PadStrideInfo(1, 1, 0, 0) })),
+    framework::dataset::make("WindowWidth", { 16U, 15U, 16U })),
+    framework::dataset::make("NumSteps", { 4U, 3U, 5U })),
+    framework::dataset::make("UseReset", { false, false, true }));
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(StreamingConvolutionLayer)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(zip(zip(zip(zip(
+        framework::dataset::make("InputInfo", { TensorInfo(TensorShape(4U, 9U, 3U), 1, DataType::F32),  // valid
+                                                TensorInfo(TensorShape(4U, 9U, 3U), 1, DataType::F32),  // padding along x
+                                                TensorInfo(TensorShape(4U, 9U, 3U), 1, DataType::F32),  // window too small for kernel and hop
+                                                TensorInfo(TensorShape(4U, 9U, 3U), 1, DataType::F32),  // hop not a multiple of the x stride
+                                                TensorInfo(TensorShape(4U, 9U, 3U), 1, DataType::F32)   // last kernel position misses the window edge
+        }),
+        framework::dataset::make("WeightsInfo", { TensorInfo(TensorShape(3U, 3U, 3U, 5U), 1, DataType::F32),
+                                                  TensorInfo(TensorShape(3U, 3U, 3U, 5U), 1, DataType::F32),
+                                                  TensorInfo(TensorShape(3U, 3U, 3U, 5U), 1, DataType::F32),
+                                                  TensorInfo(TensorShape(3U, 3U, 3U, 5U), 1, DataType::F32),
+                                                  TensorInfo(TensorShape(3U, 3U, 3U, 5U), 1, DataType::F32)
+        })),
+        framework::dataset::make("BiasesInfo", { TensorInfo(TensorShape(5U), 1, DataType::F32),
+                                                 TensorInfo(TensorShape(5U), 1, DataType::F32),
+                                                 TensorInfo(TensorShape(5U), 1, DataType::F32),
+                                                 TensorInfo(TensorShape(5U), 1, DataType::F32),
+                                                 TensorInfo(TensorShape(5U), 1, DataType::F32)
+        })),
+        framework::dataset::make("OutputInfo", { TensorInfo(TensorShape(14U, 7U, 5U), 1, DataType::F32),
+                                                 TensorInfo(TensorShape(16U, 7U, 5U), 1, DataType::F32),
+                                                 TensorInfo(TensorShape(4U, 7U, 5U), 1, DataType::F32),
+                                                 TensorInfo(TensorShape(6U, 7U, 5U), 1, DataType::F32),
+                                                 TensorInfo(TensorShape(7U, 7U, 5U), 1, DataType::F32)
+        })),
+        framework::dataset::make("ConvInfo", { PadStrideInfo(1, 1, 0, 0),
+                                               PadStrideInfo(1, 1, 1, 0),
+                                               PadStrideInfo(1, 1, 0, 0),
+                                               PadStrideInfo(3, 1, 0, 0),
+                                               PadStrideInfo(2, 1, 0, 0)
+        })),
+        framework::dataset::make("WindowWidth", { 16U, 16U, 6U, 18U, 16U })),
+        framework::dataset::make("Expected", { true, false, false, false, false })),
+               input_info, weights_info, biases_info, output_info, conv_info, window_width, expected)
+{
+    const Status status = NEStreamingConvolutionLayer::validate(&input_info.clone()->set_is_resizable(false), &weights_info.clone()->set_is_resizable(false),
+                                                                &biases_info.clone()->set_is_resizable(false), &output_info.clone()->set_is_resizable(false), conv_info, window_width);
+    ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+template <typename T>
+using NEStreamingConvolutionLayerFixture = StreamingConvolutionValidationFixture<Tensor, Accessor, NEStreamingConvolutionLayer, T>;
+
+TEST_SUITE(Float)
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEStreamingConvolutionLayerFixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(StreamingConvolutionDataset, framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, float(abs_tolerance_f32));
+}
+TEST_SUITE_END() // FP32
+TEST_SUITE_END() // Float
+
+TEST_SUITE_END() // StreamingConvolutionLayer
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -83,6 +83,59 @@ DATA_TEST_CASE(Configuration,
     validate(dst.info()->valid_region(), valid_region);
 }
 
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(ContiguousView, framework::DatasetMode::ALL, zip(zip(zip(zip(zip(zip(zip(
+        framework::dataset::make("Shape", { TensorShape(27U),         // Rank-1 interval
+                                            TensorShape(27U, 8U, 4U), // Lower dimensions covered through begin/end masks
+                                            TensorShape(27U, 8U, 4U), // Negative end on the outer dimension
+                                            TensorShape(27U, 8U, 4U), // Non-unit stride
+                                            TensorShape(27U, 8U, 4U), // Shrunk axis changes the rank
+                                            TensorShape(27U, 8U, 4U)  // Partial innermost dimension
+        }),
+        framework::dataset::make("Starts", { Coordinates(3), Coordinates(0, 0, 2), Coordinates(0, 0, 1), Coordinates(0, 0, 0), Coordinates(0, 0, 1), Coordinates(3, 0, 0) })),
+        framework::dataset::make("Ends", { Coordinates(13), Coordinates(0, 0, 4), Coordinates(27, 8, -1), Coordinates(27, 8, 4), Coordinates(27, 8, 2), Coordinates(13, 8, 4) })),
+        framework::dataset::make("Strides", { BiStrides(1), BiStrides(1, 1, 1), BiStrides(1, 1, 1), BiStrides(1, 1, 2), BiStrides(1, 1, 1), BiStrides(1, 1, 1) })),
+        framework::dataset::make("BeginMask", { 0, 3, 0, 0, 0, 0 })),
+        framework::dataset::make("EndMask", { 0, 3, 0, 0, 0, 0 })),
+        framework::dataset::make("ShrinkMask", { 0, 0, 0, 0, 4, 0 })),
+        framework::dataset::make("ExpectedView", { true, true, true, false, false, false })),
+               shape, starts, ends, strides, begin_mask, end_mask, shrink_mask, expected_view)
+{
+    // Create tensors
+    Tensor src = create_tensor<Tensor>(shape, DataType::F32);
+    Tensor dst;
+
+    // Create and configure function
+    NEStridedSlice strided_slice;
+    strided_slice.configure(&src, &dst, starts, ends, strides, begin_mask, end_mask, shrink_mask);
+
+    // A view-ineligible slice runs the copy kernel and needs its own output buffer
+    src.allocator()->allocate();
+    if(!expected_view)
+    {
+        dst.allocator()->allocate();
+    }
+
+    // Fill tensors
+    library->fill_tensor_uniform(Accessor(src), 0);
+
+    // Compute function
+    strided_slice.run();
+
+    // A contiguous unit-stride slice must alias the input buffer, the others must not
+    ARM_COMPUTE_EXPECT(dst.buffer() != nullptr, framework::LogLevel::ERRORS);
+    const uint8_t *view_ptr = src.buffer() + src.info()->offset_element_in_bytes(starts);
+    ARM_COMPUTE_EXPECT((dst.buffer() == view_ptr) == expected_view, framework::LogLevel::ERRORS);
+
+    // Validate output
+    SimpleTensor<float> ref_src{ shape, DataType::F32 };
+    library->fill_tensor_uniform(ref_src, 0);
+    validate(Accessor(dst), reference::strided_slice(ref_src, starts, ends, strides, begin_mask, end_mask, shrink_mask));
+}
+// clang-format on
+// *INDENT-ON*
+
 template <typename T>
 using NEStridedSliceFixture = StridedSliceFixture<Tensor, Accessor, NEStridedSlice, T>;
 
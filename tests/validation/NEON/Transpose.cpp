@@ -40,6 +40,20 @@ namespace test
 {
 namespace validation
 {
+namespace
+{
+/** Shapes exercising the structure of the 8x8 micro-transpose of the 8/16-bit paths:
+ *  both dimensions multiples of 8 (main loop only), a width with a scalar x-tail, a
+ *  height hitting the y-leftover loop, both remainders at once, and a width spanning
+ *  several cache-sized column blocks of the kernel's run() */
+const auto TransposeBlockedShapes = framework::dataset::make("Shape", { TensorShape{ 64U, 32U },
+                                                                        TensorShape{ 67U, 32U },
+                                                                        TensorShape{ 64U, 29U },
+                                                                        TensorShape{ 61U, 27U },
+                                                                        TensorShape{ 600U, 21U }
+                                                                      });
+} // namespace
+
 TEST_SUITE(NEON)
 TEST_SUITE(Transpose)
 
@@ -77,6 +91,12 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NETransposeFixture<uint8_t>, framework::Dataset
     // Validate output
     validate(Accessor(_target), _reference);
 }
+FIXTURE_DATA_TEST_CASE(RunBlocked, NETransposeFixture<uint8_t>, framework::DatasetMode::PRECOMMIT, combine(TransposeBlockedShapes,
+                                                                                                           framework::dataset::make("DataType", DataType::U8)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference);
+}
 FIXTURE_DATA_TEST_CASE(RunLarge, NETransposeFixture<uint8_t>, framework::DatasetMode::NIGHTLY, combine(concat(datasets::Large1DShapes(), datasets::Large2DShapes()),
                                                                                                        framework::dataset::make("DataType", DataType::U8)))
 {
@@ -92,6 +112,12 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NETransposeFixture<uint16_t>, framework::Datase
     // Validate output
     validate(Accessor(_target), _reference);
 }
+FIXTURE_DATA_TEST_CASE(RunBlocked, NETransposeFixture<uint16_t>, framework::DatasetMode::PRECOMMIT, combine(TransposeBlockedShapes,
+                                                                                                            framework::dataset::make("DataType", DataType::U16)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference);
+}
 FIXTURE_DATA_TEST_CASE(RunLarge, NETransposeFixture<uint16_t>, framework::DatasetMode::NIGHTLY, combine(concat(datasets::Large1DShapes(), datasets::Large2DShapes()),
                                                                                                         framework::dataset::make("DataType", DataType::U16)))
 {
@@ -34,6 +34,7 @@
 #include "tests/framework/Fixture.h"
 #include "tests/validation/Helpers.h"
 #include "tests/validation/reference/ActivationLayer.h"
+#include "tests/validation/reference/ArithmeticOperations.h"
 #include "tests/validation/reference/ConvolutionLayer.h"
 #include "tests/validation/reference/Permute.h"
 #include "tests/validation/reference/Utils.h"
@@ -260,6 +261,84 @@ public:
     }
 };
 
+/** Fixture for the residual tensor fused into the col2im epilogue; compares the fused
+ * run against a reference convolution followed by an element-wise addition. NCHW only.
+ */
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class ConvolutionResidualValidationFixture : public framework::Fixture
+{
+public:
+    template <typename...>
+    void setup(TensorShape input_shape, TensorShape weights_shape, TensorShape bias_shape, TensorShape output_shape, PadStrideInfo info, Size2D dilation, DataType data_type)
+    {
+        _target    = compute_target(input_shape, weights_shape, bias_shape, output_shape, info, dilation, data_type);
+        _reference = compute_reference(input_shape, weights_shape, bias_shape, output_shape, info, dilation, data_type);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        std::uniform_real_distribution<> distribution(-1.0f, 1.0f);
+        library->fill(tensor, distribution, i);
+    }
+
+    TensorType compute_target(const TensorShape &input_shape, const TensorShape &weights_shape, const TensorShape &bias_shape, const TensorShape &output_shape, const PadStrideInfo &info,
+                              const Size2D &dilation, DataType data_type)
+    {
+        // Create tensors
+        TensorType src      = create_tensor<TensorType>(input_shape, data_type);
+        TensorType weights  = create_tensor<TensorType>(weights_shape, data_type);
+        TensorType bias     = create_tensor<TensorType>(bias_shape, data_type);
+        TensorType residual = create_tensor<TensorType>(output_shape, data_type);
+        TensorType dst      = create_tensor<TensorType>(output_shape, data_type);
+
+        // Create and configure function with the residual fused into the col2im epilogue
+        FunctionType conv;
+        conv.configure(&src, &weights, &bias, &dst, info, WeightsInfo(), dilation, ActivationLayerInfo(), 1, false, &residual);
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        weights.allocator()->allocate();
+        bias.allocator()->allocate();
+        residual.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        // Fill tensors
+        fill(AccessorType(src), 0);
+        fill(AccessorType(weights), 1);
+        fill(AccessorType(bias), 2);
+        fill(AccessorType(residual), 3);
+
+        // Compute function
+        conv.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape &input_shape, const TensorShape &weights_shape, const TensorShape &bias_shape, const TensorShape &output_shape, const PadStrideInfo &info,
+                                      const Size2D &dilation, DataType data_type)
+    {
+        // Create reference
+        SimpleTensor<T> src{ input_shape, data_type };
+        SimpleTensor<T> weights{ weights_shape, data_type };
+        SimpleTensor<T> bias{ bias_shape, data_type };
+        SimpleTensor<T> residual{ output_shape, data_type };
+
+        fill(src, 0);
+        fill(weights, 1);
+        fill(bias, 2);
+        fill(residual, 3);
+
+        // The fused epilogue must match a convolution followed by an element-wise add
+        SimpleTensor<T> conv_out = reference::convolution_layer<T>(src, weights, bias, output_shape, info, dilation);
+        return reference::arithmetic_operation<T>(ArithmeticOperation::ADD, conv_out, residual, data_type, ConvertPolicy::SATURATE);
+    }
+
+    TensorType      _target{};
+    SimpleTensor<T> _reference{};
+};
+
 template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
 class ConvolutionValidationQuantizedFixture : public ConvolutionValidationGenericFixture<TensorType, AccessorType, FunctionType, T, T>
 {
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_TEST_STREAMING_CONVOLUTION_LAYER_FIXTURE
+#define ARM_COMPUTE_TEST_STREAMING_CONVOLUTION_LAYER_FIXTURE
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/ConvolutionLayer.h"
+
+#include <algorithm>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+/** Fixture for streaming convolutions: feeds the frames of each step incrementally and
+ * compares the cached result against a one-shot convolution of the equivalent full window.
+ */
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class StreamingConvolutionValidationFixture : public framework::Fixture
+{
+public:
+    template <typename...>
+    void setup(TensorShape input_shape, TensorShape weights_shape, TensorShape bias_shape, TensorShape output_shape, PadStrideInfo info, unsigned int window_width, unsigned int num_steps,
+               bool use_reset, DataType data_type)
+    {
+        // Resetting half-way through discards the cached state and primes it again
+        const unsigned int reset_step = use_reset ? num_steps / 2 : num_steps;
+
+        _target    = compute_target(input_shape, weights_shape, bias_shape, output_shape, info, window_width, num_steps, reset_step, data_type);
+        _reference = compute_reference(input_shape, weights_shape, bias_shape, output_shape, info, window_width, num_steps, reset_step, data_type);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        std::uniform_real_distribution<> distribution(-1.0f, 1.0f);
+        library->fill(tensor, distribution, i);
+    }
+
+    /** Shifts @p window left by @p hop elements along x and appends the columns of @p frame */
+    void shift_append(SimpleTensor<T> &window, const SimpleTensor<T> &frame, unsigned int hop)
+    {
+        const unsigned int width = window.shape()[0];
+        const unsigned int rows  = window.num_elements() / width;
+        for(unsigned int r = 0; r < rows; ++r)
+        {
+            T       *row       = window.data() + r * width;
+            const T *frame_row = frame.data() + r * hop;
+            std::copy(row + hop, row + width, row);
+            std::copy(frame_row, frame_row + hop, row + width - hop);
+        }
+    }
+
+    TensorType compute_target(const TensorShape &input_shape, const TensorShape &weights_shape, const TensorShape &bias_shape, const TensorShape &output_shape, const PadStrideInfo &info,
+                              unsigned int window_width, unsigned int num_steps, unsigned int reset_step, DataType data_type)
+    {
+        // Create tensors
+        TensorType src     = create_tensor<TensorType>(input_shape, data_type);
+        TensorType weights = create_tensor<TensorType>(weights_shape, data_type);
+        TensorType bias    = create_tensor<TensorType>(bias_shape, data_type);
+        TensorType dst     = create_tensor<TensorType>(output_shape, data_type);
+
+        // Create and configure function
+        FunctionType conv;
+        conv.configure(&src, &weights, &bias, &dst, info, window_width);
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        weights.allocator()->allocate();
+        bias.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        // Fill weights and biases once, then feed one frame batch per step
+        fill(AccessorType(weights), 0);
+        fill(AccessorType(bias), 1);
+        for(unsigned int step = 0; step < num_steps; ++step)
+        {
+            if(step == reset_step)
+            {
+                conv.reset();
+            }
+            fill(AccessorType(src), 2 + step);
+            conv.run();
+        }
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape &input_shape, const TensorShape &weights_shape, const TensorShape &bias_shape, const TensorShape &output_shape, const PadStrideInfo &info,
+                                      unsigned int window_width, unsigned int num_steps, unsigned int reset_step, DataType data_type)
+    {
+        // Create reference
+        SimpleTensor<T> weights{ weights_shape, data_type };
+        SimpleTensor<T> bias{ bias_shape, data_type };
+
+        fill(weights, 0);
+        fill(bias, 1);
+
+        // Replay the stream into an explicit window and convolve it in one shot
+        TensorShape window_shape = input_shape;
+        window_shape.set(0, window_width);
+        SimpleTensor<T>    window{ window_shape, data_type };
+        const unsigned int hop = input_shape[0];
+
+        std::fill(window.data(), window.data() + window.num_elements(), T(0));
+        for(unsigned int step = 0; step < num_steps; ++step)
+        {
+            if(step == reset_step)
+            {
+                std::fill(window.data(), window.data() + window.num_elements(), T(0));
+            }
+            SimpleTensor<T> frame{ input_shape, data_type };
+            fill(frame, 2 + step);
+            shift_append(window, frame, hop);
+        }
+
+        return reference::convolution_layer<T>(window, weights, bias, output_shape, info, Size2D(1U, 1U));
+    }
+
+    TensorType      _target{};
+    SimpleTensor<T> _reference{};
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_STREAMING_CONVOLUTION_LAYER_FIXTURE */
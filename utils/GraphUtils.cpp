@@ -26,6 +26,7 @@
 
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/Types.h"
+#include "arm_compute/core/utils/misc/Cast.h"
 #include "arm_compute/graph/Logger.h"
 #include "arm_compute/runtime/SubTensor.h"
 
@@ -35,9 +36,18 @@
 #pragma GCC diagnostic pop
 #include "utils/Utils.h"
 
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif /* defined(__ARM_NEON) */
+
+#include <cstring>
+#include <fcntl.h>
 #include <inttypes.h>
 #include <iomanip>
 #include <limits>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 using namespace arm_compute::graph_utils;
 
@@ -60,6 +70,195 @@ std::pair<arm_compute::TensorShape, arm_compute::PermutationVector> compute_perm
 
     return std::make_pair(permuted_shape, perm);
 }
+
+#if defined(__ARM_NEON)
+/** Fused mean subtraction and scaling over a dense F32 NCHW tensor, a plane at a time
+ *
+ * @return True if the tensor was processed, false if its configuration needs the per-element path
+ */
+bool caffe_preprocess_neon(ITensor &tensor, const std::array<float, 3> &mean, float scale)
+{
+    const ITensorInfo *info = tensor.info();
+    if(info->data_type() != DataType::F32 || info->data_layout() != DataLayout::NCHW || info->has_padding())
+    {
+        return false;
+    }
+
+    const TensorShape &shape        = info->tensor_shape();
+    const size_t       plane_elems  = static_cast<size_t>(shape[0]) * shape[1];
+    const size_t       num_channels = shape[2];
+    const size_t       num_planes   = (plane_elems != 0) ? shape.total_size() / plane_elems : 0;
+    auto              *base         = reinterpret_cast<float *>(tensor.buffer() + info->offset_first_element_in_bytes());
+
+    const float32x4_t scale_v = vdupq_n_f32(scale);
+    for(size_t p = 0; p < num_planes; ++p)
+    {
+        const float       m      = mean[p % num_channels];
+        const float32x4_t mean_v = vdupq_n_f32(m);
+        float            *ptr    = base + p * plane_elems;
+        size_t            i      = 0;
+        for(; i + 4 <= plane_elems; i += 4)
+        {
+            vst1q_f32(ptr + i, vmulq_f32(vsubq_f32(vld1q_f32(ptr + i), mean_v), scale_v));
+        }
+        for(; i < plane_elems; ++i)
+        {
+            ptr[i] = (ptr[i] - m) * scale;
+        }
+    }
+    return true;
+}
+
+/** Fused range normalization over a dense F32 tensor
+ *
+ * @return True if the tensor was processed, false if its configuration needs the per-element path
+ */
+bool tf_preprocess_neon(ITensor &tensor, float min_range, float max_range)
+{
+    const ITensorInfo *info = tensor.info();
+    if(info->data_type() != DataType::F32 || info->has_padding())
+    {
+        return false;
+    }
+
+    // x / 255 * range + min folds into one multiply-accumulate per lane
+    const float       factor   = (max_range - min_range) / 255.f;
+    const float32x4_t factor_v = vdupq_n_f32(factor);
+    const float32x4_t min_v    = vdupq_n_f32(min_range);
+
+    auto        *ptr   = reinterpret_cast<float *>(tensor.buffer() + info->offset_first_element_in_bytes());
+    const size_t elems = info->tensor_shape().total_size();
+    size_t       i     = 0;
+    for(; i + 4 <= elems; i += 4)
+    {
+        vst1q_f32(ptr + i, vmlaq_f32(min_v, vld1q_f32(ptr + i), factor_v));
+    }
+    for(; i < elems; ++i)
+    {
+        ptr[i] = ptr[i] * factor + min_range;
+    }
+    return true;
+}
+#endif /* defined(__ARM_NEON) */
+
+/** Decompresses one LZ4 block (raw block format, no frame) into dst
+ *
+ * @param[in]  src     Compressed block
+ * @param[in]  src_len Compressed block length in bytes
+ * @param[out] dst     Destination buffer
+ * @param[in]  dst_cap Destination capacity in bytes
+ *
+ * @return Number of bytes written, or 0 on malformed input
+ */
+size_t lz4_block_decompress(const uint8_t *src, size_t src_len, uint8_t *dst, size_t dst_cap)
+{
+    const uint8_t *src_end = src + src_len;
+    uint8_t       *dst_ptr = dst;
+    uint8_t       *dst_end = dst + dst_cap;
+
+    while(src < src_end)
+    {
+        const uint8_t token = *src++;
+
+        // Literal run
+        size_t literal_len = token >> 4;
+        if(literal_len == 15)
+        {
+            uint8_t extra = 0;
+            do
+            {
+                if(src >= src_end)
+                {
+                    return 0;
+                }
+                extra = *src++;
+                literal_len += extra;
+            }
+            while(extra == 255);
+        }
+        if(literal_len > static_cast<size_t>(src_end - src) || literal_len > static_cast<size_t>(dst_end - dst_ptr))
+        {
+            return 0;
+        }
+        memcpy(dst_ptr, src, literal_len);
+        src += literal_len;
+        dst_ptr += literal_len;
+
+        // The last sequence of a block holds only literals
+        if(src >= src_end)
+        {
+            break;
+        }
+
+        // Match copy; matches may overlap their own output so they are copied bytewise
+        if(src + 2 > src_end)
+        {
+            return 0;
+        }
+        const size_t offset = static_cast<size_t>(src[0]) | (static_cast<size_t>(src[1]) << 8);
+        src += 2;
+        if(offset == 0 || offset > static_cast<size_t>(dst_ptr - dst))
+        {
+            return 0;
+        }
+        size_t match_len = (token & 0x0F) + 4;
+        if((token & 0x0F) == 15)
+        {
+            uint8_t extra = 0;
+            do
+            {
+                if(src >= src_end)
+                {
+                    return 0;
+                }
+                extra = *src++;
+                match_len += extra;
+            }
+            while(extra == 255);
+        }
+        if(match_len > static_cast<size_t>(dst_end - dst_ptr))
+        {
+            return 0;
+        }
+        const uint8_t *match = dst_ptr - offset;
+        for(size_t i = 0; i < match_len; ++i)
+        {
+            dst_ptr[i] = match[i];
+        }
+        dst_ptr += match_len;
+    }
+    return dst_ptr - dst;
+}
+
+/** Reads a little-endian integer from a stream */
+template <typename T>
+T read_le(std::ifstream &fs)
+{
+    uint8_t bytes[sizeof(T)] = { 0 };
+    fs.read(reinterpret_cast<char *>(bytes), sizeof(T));
+    T value = 0;
+    for(size_t i = 0; i < sizeof(T); ++i)
+    {
+        value |= static_cast<T>(bytes[i]) << (8 * i);
+    }
+    return value;
+}
+
+/** Asks the kernel to read a file ahead of the sequential pass the loader is about to do */
+void hint_file_readahead(const std::string &filename)
+{
+#if defined(POSIX_FADV_SEQUENTIAL) && defined(POSIX_FADV_WILLNEED)
+    const int fd = open(filename.c_str(), O_RDONLY);
+    if(fd >= 0)
+    {
+        posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+        posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+        close(fd);
+    }
+#else  /* defined(POSIX_FADV_SEQUENTIAL) && defined(POSIX_FADV_WILLNEED) */
+    ARM_COMPUTE_UNUSED(filename);
+#endif /* defined(POSIX_FADV_SEQUENTIAL) && defined(POSIX_FADV_WILLNEED) */
+}
 } // namespace
 
 TFPreproccessor::TFPreproccessor(float min_range, float max_range)
@@ -68,6 +267,12 @@ TFPreproccessor::TFPreproccessor(float min_range, float max_range)
 }
 void TFPreproccessor::preprocess(ITensor &tensor)
 {
+#if defined(__ARM_NEON)
+    if(tf_preprocess_neon(tensor, _min_range, _max_range))
+    {
+        return;
+    }
+#endif /* defined(__ARM_NEON) */
     if(tensor.info()->data_type() == DataType::F32)
     {
         preprocess_typed<float>(tensor);
@@ -109,6 +314,12 @@ CaffePreproccessor::CaffePreproccessor(std::array<float, 3> mean, bool bgr, floa
 
 void CaffePreproccessor::preprocess(ITensor &tensor)
 {
+#if defined(__ARM_NEON)
+    if(caffe_preprocess_neon(tensor, _mean, _scale))
+    {
+        return;
+    }
+#endif /* defined(__ARM_NEON) */
     if(tensor.info()->data_type() == DataType::F32)
     {
         preprocess_typed<float>(tensor);
@@ -177,6 +388,70 @@ bool DummyAccessor::access_tensor(ITensor &tensor)
     return ret;
 }
 
+ImportMemoryAccessor::ImportMemoryAccessor(void *data, size_t size, graph::Target target)
+    : _data(data), _size(size), _target(target), _import_attempted(false), _imported(false), _consumed(false)
+{
+}
+
+bool ImportMemoryAccessor::try_import(ITensor &tensor)
+{
+    // Only CPU backed tensors can import plain host memory
+    if(_target != graph::Target::NEON)
+    {
+        return false;
+    }
+
+    // The buffer replaces the whole backing allocation, so the tensor layout has to be
+    // dense and the sizes have to match
+    if(tensor.info()->has_padding() || tensor.info()->total_size() != _size)
+    {
+        return false;
+    }
+
+    auto *cpu_tensor = arm_compute::utils::cast::polymorphic_downcast<arm_compute::Tensor *>(&tensor);
+    return bool(cpu_tensor->allocator()->import_memory(_data));
+}
+
+bool ImportMemoryAccessor::access_tensor(ITensor &tensor)
+{
+    if(!_import_attempted)
+    {
+        _import_attempted = true;
+        _imported         = try_import(tensor);
+        if(!_imported)
+        {
+            ARM_COMPUTE_LOG_GRAPH_INFO("Could not import buffer as tensor memory; falling back to copying" << std::endl);
+        }
+    }
+
+    // Zero-copy: the tensor reads and writes the caller's buffer directly. Otherwise fall
+    // back to copying the buffer into the tensor row by row
+    if(!_imported && !_consumed)
+    {
+        ARM_COMPUTE_ERROR_ON(tensor.info()->total_size() > _size);
+
+        const size_t row_size = tensor.info()->dimension(0) * tensor.info()->element_size();
+
+        Window window;
+        window.use_tensor_dimensions(tensor.info()->tensor_shape());
+        window.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+        const auto *src = static_cast<const uint8_t *>(_data);
+
+        Iterator it(&tensor, window);
+        execute_window_loop(window, [&](const Coordinates &)
+        {
+            std::memcpy(it.ptr(), src, row_size);
+            src += row_size;
+        },
+        it);
+    }
+
+    // Serve exactly one frame per graph execution
+    _consumed = !_consumed;
+    return _consumed;
+}
+
 NumPyAccessor::NumPyAccessor(std::string npy_path, TensorShape shape, DataType data_type, DataLayout data_layout, std::ostream &output_stream)
     : _npy_tensor(), _filename(std::move(npy_path)), _output_stream(output_stream)
 {
@@ -760,6 +1035,7 @@ bool NumPyBinLoader::access_tensor(ITensor &tensor)
 {
     if(!_already_loaded)
     {
+        hint_file_readahead(_filename);
         utils::NPYLoader loader;
         loader.open(_filename, _file_layout);
         loader.fill_tensor(tensor);
@@ -768,3 +1044,193 @@ bool NumPyBinLoader::access_tensor(ITensor &tensor)
     _already_loaded = !_already_loaded;
     return _already_loaded;
 }
+
+CompressedWeightLoader::CompressedWeightLoader(std::string filename, DataLayout file_layout)
+    : _already_loaded(false), _filename(std::move(filename)), _file_layout(file_layout)
+{
+}
+
+bool CompressedWeightLoader::access_tensor(ITensor &tensor)
+{
+    if(!_already_loaded)
+    {
+        hint_file_readahead(_filename);
+
+        std::ifstream fs;
+        fs.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+        fs.open(_filename, std::ios::in | std::ios::binary);
+
+        // Container header
+        char magic[8] = { 0 };
+        fs.read(magic, sizeof(magic));
+        ARM_COMPUTE_ERROR_ON_MSG(memcmp(magic, "ACLZWGT1", sizeof(magic)) != 0, "Not a compressed weight container");
+        const uint8_t  codec         = read_le<uint8_t>(fs);
+        const uint8_t  fortran_order = read_le<uint8_t>(fs);
+        const uint16_t typestr_len   = read_le<uint16_t>(fs);
+        std::string    typestr(typestr_len, '\0');
+        fs.read(&typestr[0], typestr_len);
+        const uint32_t num_dims = read_le<uint32_t>(fs);
+        size_t         file_elements = 1;
+        for(uint32_t i = 0; i < num_dims; ++i)
+        {
+            file_elements *= read_le<uint64_t>(fs);
+        }
+        const uint32_t block_size = read_le<uint32_t>(fs);
+        const uint32_t num_blocks = read_le<uint32_t>(fs);
+        const uint64_t data_size  = read_le<uint64_t>(fs);
+
+        // The payload is raw tensor data and streams straight into the buffer, so the
+        // shipped tensor has to match the accessed one exactly
+        ARM_COMPUTE_ERROR_ON_MSG(codec > 1, "Unknown codec in compressed weight container");
+        ARM_COMPUTE_ERROR_ON_MSG(fortran_order != 0, "Fortran-order containers are not supported");
+        ARM_COMPUTE_ERROR_ON_MSG(typestr != utils::get_typestring(tensor.info()->data_type()), "Container data type does not match the tensor");
+        ARM_COMPUTE_ERROR_ON_MSG(file_elements != tensor.info()->tensor_shape().total_size(), "Container shape does not match the tensor");
+        ARM_COMPUTE_ERROR_ON_MSG(_file_layout != tensor.info()->data_layout(), "Container layout does not match the tensor");
+        ARM_COMPUTE_ERROR_ON_MSG(tensor.info()->has_padding(), "Compressed weight containers require a dense tensor");
+        ARM_COMPUTE_ERROR_ON_MSG(data_size != file_elements * tensor.info()->element_size(), "Corrupt compressed weight container");
+
+        // Stream the blocks, decompressing each one directly into the tensor
+        std::vector<uint8_t> scratch;
+        uint8_t             *out    = tensor.buffer() + tensor.info()->offset_first_element_in_bytes();
+        uint64_t             offset = 0;
+        for(uint32_t block = 0; block < num_blocks; ++block)
+        {
+            const uint32_t block_header = read_le<uint32_t>(fs);
+            const bool     stored       = (codec == 0) || ((block_header & 0x80000000u) != 0);
+            const uint32_t payload_len  = block_header & 0x7fffffffu;
+            const uint64_t expected     = std::min<uint64_t>(block_size, data_size - offset);
+
+            if(stored)
+            {
+                ARM_COMPUTE_ERROR_ON_MSG(payload_len != expected, "Corrupt compressed weight container");
+                fs.read(reinterpret_cast<char *>(out + offset), payload_len);
+            }
+            else
+            {
+                scratch.resize(payload_len);
+                fs.read(reinterpret_cast<char *>(scratch.data()), payload_len);
+                const size_t written = lz4_block_decompress(scratch.data(), payload_len, out + offset, data_size - offset);
+                ARM_COMPUTE_ERROR_ON_MSG(written != expected, "Corrupt compressed weight container");
+                ARM_COMPUTE_UNUSED(written);
+            }
+            offset += expected;
+        }
+        ARM_COMPUTE_ERROR_ON_MSG(offset != data_size, "Corrupt compressed weight container");
+    }
+
+    _already_loaded = !_already_loaded;
+    return _already_loaded;
+}
+
+NumPyMmapLoader::NumPyMmapLoader(std::string filename, DataLayout file_layout, graph::Target target)
+    : _already_loaded(false), _filename(std::move(filename)), _file_layout(file_layout), _target(target), _mapping(nullptr), _mapped_bytes(0)
+{
+}
+
+NumPyMmapLoader::~NumPyMmapLoader()
+{
+    if(_mapping != nullptr)
+    {
+        munmap(_mapping, _mapped_bytes);
+    }
+}
+
+bool NumPyMmapLoader::try_import(ITensor &tensor)
+{
+    // Importing host memory is only supported by the NEON backend and the mapping is
+    // handed to the tensor as-is, so the layout has to be dense
+    if(_target != graph::Target::NEON || tensor.info()->has_padding())
+    {
+        return false;
+    }
+
+    // Parse and validate the header
+    std::vector<unsigned long> file_shape;
+    bool                       fortran_order = false;
+    std::string                typestr;
+    size_t                     data_offset = 0;
+    try
+    {
+        std::ifstream fs;
+        fs.open(_filename, std::ios::in | std::ios::binary);
+        if(!fs.good())
+        {
+            return false;
+        }
+        fs.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+        std::tie(file_shape, fortran_order, typestr) = utils::parse_npy_header(fs);
+        data_offset = static_cast<size_t>(fs.tellg());
+    }
+    catch(const std::ifstream::failure &e)
+    {
+        return false;
+    }
+
+    // The data section has to match the tensor exactly as no conversion or permute is possible
+    if(fortran_order || typestr != utils::get_typestring(tensor.info()->data_type()) || _file_layout != tensor.info()->data_layout())
+    {
+        return false;
+    }
+    size_t file_elements = 1;
+    for(auto dim : file_shape)
+    {
+        file_elements *= dim;
+    }
+    if(file_elements != tensor.info()->tensor_shape().total_size())
+    {
+        return false;
+    }
+
+    // Map the whole file read-only; the pages stay clean and are shared across processes
+    const int fd = open(_filename.c_str(), O_RDONLY);
+    if(fd < 0)
+    {
+        return false;
+    }
+    struct stat file_status;
+    if(fstat(fd, &file_status) != 0 || static_cast<size_t>(file_status.st_size) < data_offset + tensor.info()->total_size())
+    {
+        close(fd);
+        return false;
+    }
+    void *base = mmap(nullptr, file_status.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if(base == MAP_FAILED)
+    {
+        return false;
+    }
+#if defined(MADV_WILLNEED)
+    // Start faulting the weights in asynchronously instead of one page at a time on first use
+    madvise(base, file_status.st_size, MADV_WILLNEED);
+#endif /* defined(MADV_WILLNEED) */
+
+    // Back the tensor directly with the mapped data section
+    auto *cpu_tensor = arm_compute::utils::cast::polymorphic_downcast<arm_compute::Tensor *>(&tensor);
+    if(!bool(cpu_tensor->allocator()->import_memory(static_cast<uint8_t *>(base) + data_offset)))
+    {
+        munmap(base, file_status.st_size);
+        return false;
+    }
+
+    _mapping      = base;
+    _mapped_bytes = file_status.st_size;
+    return true;
+}
+
+bool NumPyMmapLoader::access_tensor(ITensor &tensor)
+{
+    if(!_already_loaded)
+    {
+        if(!try_import(tensor))
+        {
+            ARM_COMPUTE_LOG_GRAPH_INFO("NumPyMmapLoader: could not map " << _filename << " directly, copying instead" << std::endl);
+            hint_file_readahead(_filename);
+            utils::NPYLoader loader;
+            loader.open(_filename, _file_layout);
+            loader.fill_tensor(tensor);
+        }
+    }
+
+    _already_loaded = !_already_loaded;
+    return _already_loaded;
+}
@@ -35,6 +35,7 @@
 #include "utils/CommonGraphOptions.h"
 
 #include <array>
+#include <fstream>
 #include <random>
 #include <string>
 #include <vector>
@@ -142,6 +143,45 @@ private:
     unsigned int _maximum;
 };
 
+/** Import memory accessor class
+ *
+ * Points the tensor it accesses directly at a caller provided buffer instead of copying
+ * through it, falling back to a copy when the buffer cannot be imported. Importing is
+ * supported for NEON tensors whose layout is dense and whose total size matches the
+ * buffer; CL tensors and padded layouts always take the copy path.
+ */
+class ImportMemoryAccessor final : public graph::ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[in] data   Buffer to import. Has to stay valid and unchanged in size for the lifetime of the graph.
+     * @param[in] size   Size of the buffer in bytes
+     * @param[in] target Target the accessed tensor belongs to
+     */
+    ImportMemoryAccessor(void *data, size_t size, graph::Target target);
+    /** Allow instances of this class to be move constructed */
+    ImportMemoryAccessor(ImportMemoryAccessor &&) = default;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    ImportMemoryAccessor(const ImportMemoryAccessor &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    ImportMemoryAccessor &operator=(const ImportMemoryAccessor &) = delete;
+
+    // Inherited methods overriden:
+    bool access_tensor(ITensor &tensor) override;
+
+private:
+    /** Attempts to import the buffer as the backing memory of the tensor */
+    bool try_import(ITensor &tensor);
+
+    void         *_data;
+    size_t        _size;
+    graph::Target _target;
+    bool          _import_attempted;
+    bool          _imported;
+    bool          _consumed;
+};
+
 /** NumPy accessor class */
 class NumPyAccessor final : public graph::ITensorAccessor
 {
@@ -449,6 +489,79 @@ private:
     const DataLayout  _file_layout;
 };
 
+/** Memory-mapping numpy binary loader class
+ *
+ * Validates the NPY header, maps the data section of the file read-only and backs the
+ * accessed tensor with the mapping through import_memory, so the weights are clean
+ * page-cache pages shared between worker processes and never copied. Falls back to the
+ * @ref NumPyBinLoader copy path when the mapping cannot back the tensor directly (CL
+ * tensors, padded layouts, layout or type mismatches).
+ */
+class NumPyMmapLoader final : public graph::ITensorAccessor
+{
+public:
+    /** Default Constructor
+     *
+     * @param[in] filename    Binary file name
+     * @param[in] file_layout (Optional) Layout of the numpy tensor data. Defaults to NCHW
+     * @param[in] target      (Optional) Target the accessed tensor belongs to. Defaults to NEON
+     */
+    NumPyMmapLoader(std::string filename, DataLayout file_layout = DataLayout::NCHW, graph::Target target = graph::Target::NEON);
+    /** Allows instances to move constructed */
+    NumPyMmapLoader(NumPyMmapLoader &&) = default;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NumPyMmapLoader(const NumPyMmapLoader &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NumPyMmapLoader &operator=(const NumPyMmapLoader &) = delete;
+    /** Destructor, unmaps the file */
+    ~NumPyMmapLoader();
+
+    // Inherited methods overriden:
+    bool access_tensor(ITensor &tensor) override;
+
+private:
+    /** Attempts to map the file and import its data section as the tensor's backing memory */
+    bool try_import(ITensor &tensor);
+
+    bool              _already_loaded;
+    const std::string _filename;
+    const DataLayout  _file_layout;
+    graph::Target     _target;
+    void             *_mapping;
+    size_t            _mapped_bytes;
+};
+
+/** Compressed weight container loader
+ *
+ * Reads the block-compressed weight containers produced by scripts/compress_weights.py
+ * (an LZ4- or store-coded tensor split into fixed-size blocks, shipped as <name>.npy.aclz)
+ * and decompresses each block straight into the accessed tensor's buffer, so cold start
+ * never writes a decompressed temporary to storage. The container carries the tensor
+ * metadata, so the payload is raw tensor data and the fill is a single streaming pass.
+ * The shipped layout and type have to match the tensor exactly and the tensor has to be
+ * dense: the packer is expected to produce containers per deployment configuration.
+ */
+class CompressedWeightLoader final : public graph::ITensorAccessor
+{
+public:
+    /** Default Constructor
+     *
+     * @param[in] filename    Container file name
+     * @param[in] file_layout (Optional) Layout of the contained tensor data. Defaults to NCHW
+     */
+    CompressedWeightLoader(std::string filename, DataLayout file_layout = DataLayout::NCHW);
+    /** Allows instances to move constructed */
+    CompressedWeightLoader(CompressedWeightLoader &&) = default;
+
+    // Inherited methods overriden:
+    bool access_tensor(ITensor &tensor) override;
+
+private:
+    bool              _already_loaded;
+    const std::string _filename;
+    const DataLayout  _file_layout;
+};
+
 /** Generates appropriate random accessor
  *
  * @param[in] lower Lower random values bound
@@ -482,6 +595,12 @@ inline std::unique_ptr<graph::ITensorAccessor> get_weights_accessor(const std::s
     }
     else
     {
+        // Prefer a compressed weight container when one is shipped next to the numpy file
+        const std::string compressed_file = path + data_file + ".aclz";
+        if(std::ifstream(compressed_file).good())
+        {
+            return arm_compute::support::cpp14::make_unique<CompressedWeightLoader>(compressed_file, file_layout);
+        }
         return arm_compute::support::cpp14::make_unique<NumPyBinLoader>(path + data_file, file_layout);
     }
 }
@@ -37,9 +37,14 @@
 #include "stb/stb_image.h"
 #pragma GCC diagnostic pop
 
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif /* defined(__ARM_NEON) */
+
 #include <cstdlib>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace arm_compute
 {
@@ -277,6 +282,17 @@ public:
             // Validate feeding data
             validate_info(tensor.info());
 
+#if defined(__ARM_NEON)
+            // Deinterleave and widen whole rows with NEON when the target is a dense NCHW
+            // plane; the per-element fallback below covers every other configuration
+            if(fill_planar_tensor_neon(tensor, bgr))
+            {
+                // Unmap buffer if creating a CLTensor
+                unmap(tensor);
+                return;
+            }
+#endif /* defined(__ARM_NEON) */
+
             // Stride across channels
             size_t stride_z = 0;
 
@@ -357,6 +373,89 @@ protected:
         ARM_COMPUTE_UNUSED(tensor_info);
     }
 
+#if defined(__ARM_NEON)
+    /** Fills a dense NCHW tensor row by row, deinterleaving 16 pixels at a time with LD3
+     *
+     * @param[in,out] tensor Tensor to fill. U8/QASYMM8 planes are stored directly, F32 planes are widened in registers.
+     * @param[in]     bgr    Fill the first plane with the blue channel
+     *
+     * @return True if the tensor was filled, false if its configuration needs the per-element path
+     */
+    template <typename T>
+    bool fill_planar_tensor_neon(T &tensor, bool bgr)
+    {
+        const ITensorInfo *info = tensor.info();
+        const DataType     dt   = info->data_type();
+        if(info->data_layout() != DataLayout::NCHW || (dt != DataType::U8 && dt != DataType::QASYMM8 && dt != DataType::F32))
+        {
+            return false;
+        }
+        if(info->strides_in_bytes()[0] != info->element_size())
+        {
+            return false;
+        }
+
+        const size_t stride_y     = info->strides_in_bytes()[1];
+        const size_t plane_stride = info->strides_in_bytes()[2];
+        uint8_t     *base         = tensor.buffer() + info->offset_first_element_in_bytes();
+
+        std::vector<uint8_t> row_data(static_cast<size_t>(_width) * 3);
+        for(unsigned int y = 0; y < _height; ++y)
+        {
+            _feeder->get_row(row_data.data(), row_data.size());
+            const uint8_t *src   = row_data.data();
+            uint8_t       *row   = base + y * stride_y;
+            uint8_t       *dst_r = row + (bgr ? 2 : 0) * plane_stride;
+            uint8_t       *dst_g = row + 1 * plane_stride;
+            uint8_t       *dst_b = row + (bgr ? 0 : 2) * plane_stride;
+
+            unsigned int x = 0;
+            if(dt == DataType::F32)
+            {
+                const auto store_widened = [](float *dst, uint8x16_t v)
+                {
+                    const uint16x8_t lo = vmovl_u8(vget_low_u8(v));
+                    const uint16x8_t hi = vmovl_u8(vget_high_u8(v));
+                    vst1q_f32(dst + 0, vcvtq_f32_u32(vmovl_u16(vget_low_u16(lo))));
+                    vst1q_f32(dst + 4, vcvtq_f32_u32(vmovl_u16(vget_high_u16(lo))));
+                    vst1q_f32(dst + 8, vcvtq_f32_u32(vmovl_u16(vget_low_u16(hi))));
+                    vst1q_f32(dst + 12, vcvtq_f32_u32(vmovl_u16(vget_high_u16(hi))));
+                };
+                for(; x + 16 <= _width; x += 16)
+                {
+                    const uint8x16x3_t pix = vld3q_u8(src + 3 * x);
+                    store_widened(reinterpret_cast<float *>(dst_r) + x, pix.val[0]);
+                    store_widened(reinterpret_cast<float *>(dst_g) + x, pix.val[1]);
+                    store_widened(reinterpret_cast<float *>(dst_b) + x, pix.val[2]);
+                }
+                for(; x < _width; ++x)
+                {
+                    reinterpret_cast<float *>(dst_r)[x] = static_cast<float>(src[3 * x + 0]);
+                    reinterpret_cast<float *>(dst_g)[x] = static_cast<float>(src[3 * x + 1]);
+                    reinterpret_cast<float *>(dst_b)[x] = static_cast<float>(src[3 * x + 2]);
+                }
+            }
+            else
+            {
+                for(; x + 16 <= _width; x += 16)
+                {
+                    const uint8x16x3_t pix = vld3q_u8(src + 3 * x);
+                    vst1q_u8(dst_r + x, pix.val[0]);
+                    vst1q_u8(dst_g + x, pix.val[1]);
+                    vst1q_u8(dst_b + x, pix.val[2]);
+                }
+                for(; x < _width; ++x)
+                {
+                    dst_r[x] = src[3 * x + 0];
+                    dst_g[x] = src[3 * x + 1];
+                    dst_b[x] = src[3 * x + 2];
+                }
+            }
+        }
+        return true;
+    }
+#endif /* defined(__ARM_NEON) */
+
 protected:
     std::unique_ptr<IImageDataFeeder> _feeder;
     unsigned int                      _width;
@@ -28,10 +28,19 @@
 #include "arm_compute/runtime/CL/CLScheduler.h"
 #endif /* ARM_COMPUTE_CL */
 
+#include <algorithm>
+#include <atomic>
 #include <cctype>
 #include <cerrno>
 #include <iomanip>
 #include <string>
+#include <thread>
+#include <vector>
+
+#if !defined(BARE_METAL) && !defined(_WIN32)
+#include <fcntl.h>
+#include <unistd.h>
+#endif /* !defined(BARE_METAL) && !defined(_WIN32) */
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wswitch-default"
@@ -241,6 +250,66 @@ std::tuple<std::vector<unsigned long>, bool, std::string> parse_npy_header(std::
     return std::make_tuple(shape, fortran_order, typestr);
 }
 
+bool parallel_read_file(const std::string &filename, size_t file_offset, uint8_t *dst, size_t size)
+{
+#if !defined(BARE_METAL) && !defined(_WIN32)
+    const int fd = open(filename.c_str(), O_RDONLY);
+    if(fd < 0)
+    {
+        return false;
+    }
+#if defined(POSIX_FADV_SEQUENTIAL) && defined(POSIX_FADV_WILLNEED)
+    // Hint the access pattern so the kernel aggressively reads the range ahead
+    posix_fadvise(fd, file_offset, size, POSIX_FADV_SEQUENTIAL);
+    posix_fadvise(fd, file_offset, size, POSIX_FADV_WILLNEED);
+#endif /* defined(POSIX_FADV_SEQUENTIAL) && defined(POSIX_FADV_WILLNEED) */
+
+    constexpr size_t chunk_size = 8 * 1024 * 1024;
+    const size_t     num_chunks = (size + chunk_size - 1) / chunk_size;
+
+    std::atomic<size_t> next_chunk(0);
+    std::atomic<bool>   success(true);
+    auto                worker = [&]()
+    {
+        for(size_t chunk = next_chunk++; chunk < num_chunks && success; chunk = next_chunk++)
+        {
+            const size_t offset = chunk * chunk_size;
+            const size_t length = std::min(chunk_size, size - offset);
+            size_t       done   = 0;
+            while(done < length)
+            {
+                const ssize_t bytes = pread(fd, dst + offset + done, length - done, file_offset + offset + done);
+                if(bytes <= 0)
+                {
+                    success = false;
+                    break;
+                }
+                done += bytes;
+            }
+        }
+    };
+
+    // The calling thread acts as one of the readers
+    const unsigned int num_readers = std::min<unsigned int>(num_chunks, std::max(2u, std::thread::hardware_concurrency() / 2));
+    std::vector<std::thread> readers;
+    for(unsigned int i = 1; i < num_readers; ++i)
+    {
+        readers.emplace_back(worker);
+    }
+    worker();
+    for(auto &t : readers)
+    {
+        t.join();
+    }
+
+    close(fd);
+    return success;
+#else  /* !defined(BARE_METAL) && !defined(_WIN32) */
+    ARM_COMPUTE_UNUSED(filename, file_offset, dst, size);
+    return false;
+#endif /* !defined(BARE_METAL) && !defined(_WIN32) */
+}
+
 /** This function returns the amount of memory free reading from /proc/meminfo
  *
  * @return The free memory in kB
@@ -146,6 +146,21 @@ std::tuple<unsigned int, unsigned int, int> parse_ppm_header(std::ifstream &fs);
  */
 std::tuple<std::vector<unsigned long>, bool, std::string> parse_npy_header(std::ifstream &fs);
 
+/** Read a range of a file into a destination buffer in parallel chunks
+ *
+ * The file range is hinted to the kernel for readahead and copied chunk by chunk on a small
+ * pool of threads, so large payloads are bound by storage bandwidth instead of a single read
+ * stream. The destination can be any writable buffer, including a mapped CLTensor.
+ *
+ * @param[in]  filename    File to read from
+ * @param[in]  file_offset Offset of the range inside the file in bytes
+ * @param[out] dst         Destination buffer, at least @p size bytes
+ * @param[in]  size        Number of bytes to read
+ *
+ * @return True if the whole range was read, false if unsupported on this platform or on read failure
+ */
+bool parallel_read_file(const std::string &filename, size_t file_offset, uint8_t *dst, size_t size);
+
 /** Obtain numpy type string from DataType.
  *
  * @param[in] data_type Data type.
@@ -330,7 +345,7 @@ class NPYLoader
 public:
     /** Default constructor */
     NPYLoader()
-        : _fs(), _shape(), _fortran_order(false), _typestring(), _file_layout(DataLayout::NCHW)
+        : _fs(), _filename(), _shape(), _fortran_order(false), _typestring(), _file_layout(DataLayout::NCHW)
     {
     }
 
@@ -347,6 +362,7 @@ public:
             _fs.open(npy_filename, std::ios::in | std::ios::binary);
             ARM_COMPUTE_EXIT_ON_MSG_VAR(!_fs.good(), "Failed to load binary data from %s", npy_filename.c_str());
             _fs.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+            _filename    = npy_filename;
             _file_layout = file_layout;
 
             std::tie(_shape, _fortran_order, _typestring) = parse_npy_header(_fs);
@@ -470,8 +486,25 @@ public:
                     // Read data
                     if(!are_layouts_different && !_fortran_order && tensor.info()->padding().empty())
                     {
-                        // If tensor has no padding read directly from stream.
-                        _fs.read(reinterpret_cast<char *>(tensor.buffer()), tensor.info()->total_size());
+                        // Large payloads stream from the file in parallel chunks straight into the
+                        // tensor buffer (already mapped for CLTensors), so filling is bound by
+                        // storage bandwidth and needs no intermediate copy
+                        constexpr size_t streaming_threshold = 8 * 1024 * 1024;
+                        const size_t     payload_size        = tensor.info()->total_size();
+                        bool             streamed            = false;
+                        if(payload_size >= streaming_threshold && !_filename.empty())
+                        {
+                            streamed = parallel_read_file(_filename, current_position, tensor.buffer(), payload_size);
+                            if(streamed)
+                            {
+                                _fs.seekg(current_position + payload_size, std::ios_base::beg);
+                            }
+                        }
+                        if(!streamed)
+                        {
+                            // If tensor has no padding read directly from stream.
+                            _fs.read(reinterpret_cast<char *>(tensor.buffer()), payload_size);
+                        }
                     }
                     else
                     {
@@ -528,6 +561,7 @@ public:
 
 private:
     std::ifstream              _fs;
+    std::string                _filename;
     std::vector<unsigned long> _shape;
     bool                       _fortran_order;
     std::string                _typestring;